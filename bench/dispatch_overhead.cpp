@@ -0,0 +1,99 @@
+// Cost of a GL call through the thread-local current table compared to the
+// plain glad_gl* global pointer.
+//
+// Both paths call the same stub, loaded through a stub loader, so the numbers
+// are the dispatch overhead alone. The thread-local path runs on a worker
+// thread with its own table, the way a shared-context upload thread would.
+//
+// usage: bench_dispatch_overhead [calls]
+
+#define GLAD_THREAD_LOCAL_DISPATCH
+#include <glad/glad.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+unsigned int lastBound = 0;
+
+const GLubyte* APIENTRY stubGetString(GLenum name) {
+    return name == GL_VERSION ? (const GLubyte*)"3.3.0 stub" : (const GLubyte*)"";
+}
+
+void APIENTRY stubGetIntegerv(GLenum, GLint *data) {
+    *data = 0;
+}
+
+void APIENTRY stubBindVertexArray(GLuint array) {
+    lastBound = array;
+}
+
+void APIENTRY stubUnused() {
+}
+
+void* stubLoader(const char *name) {
+    if (strcmp(name, "glGetString") == 0) return (void*)stubGetString;
+    if (strcmp(name, "glGetIntegerv") == 0) return (void*)stubGetIntegerv;
+    if (strcmp(name, "glBindVertexArray") == 0) return (void*)stubBindVertexArray;
+    return (void*)stubUnused;
+}
+
+template <typename Fn>
+double nsPerCall(long calls, Fn fn) {
+    auto start = Clock::now();
+    fn();
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double)calls;
+}
+
+}
+
+int main(int argc, char **argv) {
+    long calls = argc > 1 ? std::atol(argv[1]) : 10000000;
+
+    if (!gladLoadGLLoader(stubLoader)) {
+        std::cerr << "Failed to load the stub driver" << std::endl;
+        return 1;
+    }
+
+    double global = nsPerCall(calls, [&] {
+        for (long i = 0; i < calls; i++) {
+            glad_glBindVertexArray((GLuint)i);
+        }
+    });
+
+    double threadLocal = 0.0;
+    std::thread worker([&] {
+        GladGLContext context = {};
+        if (!gladLoadGLContext(&context, stubLoader)) {
+            return;
+        }
+        gladSetGLContext(&context);
+
+        threadLocal = nsPerCall(calls, [&] {
+            for (long i = 0; i < calls; i++) {
+                glBindVertexArray((GLuint)i);
+            }
+        });
+
+        gladUnloadGLContext(&context);
+    });
+    worker.join();
+
+    if (threadLocal == 0.0 || lastBound != (GLuint)(calls - 1)) {
+        std::cerr << "The thread-local table did not dispatch" << std::endl;
+        return 1;
+    }
+
+    std::cout << calls << " calls" << std::endl;
+    std::cout << "global pointer:      " << global << " ns/call" << std::endl;
+    std::cout << "thread-local table:  " << threadLocal << " ns/call ("
+              << threadLocal / global << "x)" << std::endl;
+    return 0;
+}
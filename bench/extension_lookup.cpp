@@ -0,0 +1,182 @@
+// Extension list construction and lookup cost against a synthetic driver.
+//
+// A stub loader hands gladLoadGLLoader a fake glGetStringi reporting a few
+// hundred extensions, so no context is needed. The loader source is compiled
+// into this file to time its static get_exts, and the linear strcmp scan it
+// used before the hash table is kept here as the baseline.
+//
+// usage: bench_extension_lookup [extensions] [queries]
+
+// The loader's own headers come first so the macros below only reach its
+// code, not the declarations.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+
+// Count the allocations get_exts makes.
+static int allocations = 0;
+
+static void* countingMalloc(size_t size) {
+    allocations++;
+    return malloc(size);
+}
+
+#define malloc countingMalloc
+#include "../src/glad.c"
+#undef malloc
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::vector<std::string> extensions;
+
+const GLubyte* APIENTRY stubGetString(GLenum name) {
+    return name == GL_VERSION ? (const GLubyte*)"3.3.0 stub" : (const GLubyte*)"";
+}
+
+void APIENTRY stubGetIntegerv(GLenum pname, GLint *data) {
+    *data = pname == GL_NUM_EXTENSIONS ? (GLint)extensions.size() : 0;
+}
+
+const GLubyte* APIENTRY stubGetStringi(GLenum name, GLuint index) {
+    if (name != GL_EXTENSIONS || index >= extensions.size()) {
+        return nullptr;
+    }
+    return (const GLubyte*)extensions[index].c_str();
+}
+
+void APIENTRY stubUnused() {
+}
+
+void* stubLoader(const char *name) {
+    if (strcmp(name, "glGetString") == 0) return (void*)stubGetString;
+    if (strcmp(name, "glGetIntegerv") == 0) return (void*)stubGetIntegerv;
+    if (strcmp(name, "glGetStringi") == 0) return (void*)stubGetStringi;
+    return (void*)stubUnused;
+}
+
+// The lookup as it was before the hash table: one heap string per name and
+// a strcmp against every one of them per query.
+struct LinearExtensions {
+    std::vector<char*> names;
+
+    void build() {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        names.resize(count);
+        for (GLint i = 0; i < count; i++) {
+            const char *ext = (const char*)glGetStringi(GL_EXTENSIONS, i);
+            size_t len = strlen(ext);
+            names[i] = (char*)malloc(len + 1);
+            memcpy(names[i], ext, len + 1);
+        }
+    }
+
+    void release() {
+        for (char *name : names) {
+            free(name);
+        }
+        names.clear();
+    }
+
+    int has(const char *ext) const {
+        for (char *name : names) {
+            if (strcmp(name, ext) == 0) {
+                return 1;
+            }
+        }
+        return 0;
+    }
+};
+
+void makeExtensions(size_t count) {
+    static const char *vendors[] = {"ARB", "EXT", "KHR", "NV", "AMD", "INTEL", "MESA", "OES"};
+    static const char *features[] = {
+        "texture_storage", "buffer_storage", "multi_draw_indirect", "debug",
+        "shader_image_load_store", "sparse_texture", "bindless_texture",
+        "compute_shader", "direct_state_access", "gpu_shader5"
+    };
+
+    for (size_t i = 0; i < count; i++) {
+        extensions.push_back(std::string("GL_") + vendors[i % 8] + "_" +
+                             features[(i / 8) % 10] + "_" + std::to_string(i));
+    }
+}
+
+template <typename Fn>
+double nsPerOp(size_t ops, Fn fn) {
+    auto start = Clock::now();
+    fn();
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double)ops;
+}
+
+}
+
+int main(int argc, char **argv) {
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 480;
+    size_t queries = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+    makeExtensions(count);
+
+    if (!gladLoadGLLoader(stubLoader)) {
+        std::cerr << "Failed to load the stub driver" << std::endl;
+        return 1;
+    }
+
+    // Half the queries hit (spread over the whole list), half miss.
+    std::vector<std::string> probes;
+    for (size_t i = 0; i < 64; i++) {
+        probes.push_back(i % 2 ? extensions[(i * 7919) % count] : "GL_ARB_not_there_" + std::to_string(i));
+    }
+
+    const int builds = 1000;
+    LinearExtensions linear;
+    double linearBuild = nsPerOp(builds, [&] {
+        for (int i = 0; i < builds; i++) {
+            linear.build();
+            linear.release();
+        }
+    });
+    allocations = 0;
+    double hashedBuild = nsPerOp(builds, [&] {
+        for (int i = 0; i < builds; i++) {
+            free_exts(&exts_gl);
+            get_exts(&exts_gl, 3, glGetString, glGetIntegerv, glGetStringi);
+        }
+    });
+    int hashedAllocations = allocations / builds;
+
+    linear.build();
+    int hits = 0;
+    double linearQuery = nsPerOp(queries, [&] {
+        for (size_t i = 0; i < queries; i++) {
+            hits += linear.has(probes[i % probes.size()].c_str());
+        }
+    });
+    double hashedQuery = nsPerOp(queries, [&] {
+        for (size_t i = 0; i < queries; i++) {
+            hits -= gladHasExtension(probes[i % probes.size()].c_str());
+        }
+    });
+    linear.release();
+
+    if (hits != 0) {
+        std::cerr << "Linear and hashed lookups disagree" << std::endl;
+        return 1;
+    }
+
+    std::cout << count << " extensions, " << queries << " queries" << std::endl;
+    std::cout << "linear  build: " << linearBuild << " ns (" << count + 1 << " allocations)"
+              << "  query: " << linearQuery << " ns" << std::endl;
+    std::cout << "hashed  build: " << hashedBuild << " ns (" << hashedAllocations << " allocation)"
+              << "  query: " << hashedQuery << " ns" << std::endl;
+    return 0;
+}
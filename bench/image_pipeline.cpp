@@ -0,0 +1,281 @@
+// How loadImages (decoding plus a gamma-correct mip chain per file) scales
+// from 1 to N worker threads, in images/s and MB/s of decoded pixels. The
+// corpus is written to a temporary directory first and looks like the
+// learnopengl textures: mostly 512x512 with a few 1024x1024 and 2048x2048,
+// photographic noise as JPEG, sprites with alpha and large flat areas as
+// PNG, plus some uncompressed and run-length encoded TGA and PPM. Each run
+// is the median of several; speedup is against one worker.
+//
+// usage: bench_image_pipeline [max threads] [images]
+
+#include "image_loader.h"
+#include "job_system.h"
+
+#include <png.h>
+#include <jpeglib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const int runs = 3;
+
+enum Format {
+    Jpeg,
+    Png,
+    TgaRle,
+    Tga,
+    Ppm,
+};
+
+const char *const extensions[] = {".jpg", ".png", ".tga", ".tga", ".ppm"};
+
+struct Spec {
+    int width;
+    int height;
+    Format format;
+};
+
+// Repeats in this order, like a level's worth of diffuse, specular and
+// sprite textures.
+const Spec corpus[] = {
+    {512, 512, Jpeg},    {512, 512, Png},     {500, 500, Jpeg},      {1024, 1024, Jpeg},
+    {512, 512, Tga},     {512, 512, TgaRle},  {2048, 2048, Jpeg},    {1024, 1024, Png},
+    {512, 512, Jpeg},    {512, 512, Png},     {500, 500, Ppm},       {1024, 1024, Jpeg},
+};
+
+template <typename Fn>
+double medianMs(Fn fn) {
+    std::vector<double> times;
+    for (int i = 0; i < runs; i++) {
+        auto start = Clock::now();
+        fn();
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+// RGBA: 32 pixel tiles of a color each; with noise, grain on top of them.
+std::vector<unsigned char> makePixels(int width, int height, int seed, bool noise) {
+    std::vector<unsigned char> pixels((size_t)width * height * 4);
+    unsigned state = (unsigned)seed * 2654435761u + 1;
+    unsigned char *out = pixels.data();
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++, out += 4) {
+            unsigned tile = (unsigned)(x / 32 * 7919 + y / 32 * 104729 + seed * 31) * 2246822519u;
+            int grain = 0;
+            if (noise) {
+                state = state * 1664525u + 1013904223u;
+                grain = (int)(state >> 26) - 32;
+            }
+            for (int c = 0; c < 3; c++) {
+                out[c] = (unsigned char)std::min(255, std::max(0, (int)(tile >> (c * 8) & 0xFF) + grain));
+            }
+            out[3] = noise ? 255 : (unsigned char)(tile >> 24 | 0x80);
+        }
+    }
+    return pixels;
+}
+
+void writeTga(FILE *file, int width, int height, bool rle, const std::vector<unsigned char> &pixels) {
+    int bytes = rle ? 4 : 3;
+    unsigned char header[18] = {};
+    header[2] = (unsigned char)(rle ? 10 : 2);
+    header[12] = (unsigned char)(width & 0xFF);
+    header[13] = (unsigned char)(width >> 8);
+    header[14] = (unsigned char)(height & 0xFF);
+    header[15] = (unsigned char)(height >> 8);
+    header[16] = (unsigned char)(bytes * 8);
+    // Top-left origin, and 8 alpha bits when there is alpha.
+    header[17] = (unsigned char)(0x20 | (rle ? 8 : 0));
+    fwrite(header, 1, sizeof(header), file);
+
+    std::vector<unsigned char> data;
+    auto pixel = [&](int x, int y) {
+        const unsigned char *p = pixels.data() + ((size_t)y * width + x) * 4;
+        data.push_back(p[2]);
+        data.push_back(p[1]);
+        data.push_back(p[0]);
+        if (bytes == 4) {
+            data.push_back(p[3]);
+        }
+    };
+    auto same = [&](int x, int y, int other) {
+        const unsigned char *row = pixels.data() + (size_t)y * width * 4;
+        return std::equal(row + x * 4, row + x * 4 + 4, row + other * 4);
+    };
+    for (int y = 0; y < height; y++) {
+        if (!rle) {
+            for (int x = 0; x < width; x++) {
+                pixel(x, y);
+            }
+            continue;
+        }
+        // Packets stay within a row.
+        for (int x = 0; x < width;) {
+            int run = 1;
+            while (x + run < width && run < 128 && same(x, y, x + run)) {
+                run++;
+            }
+            if (run > 1) {
+                data.push_back((unsigned char)(0x80 | (run - 1)));
+                pixel(x, y);
+                x += run;
+                continue;
+            }
+            int count = 1;
+            while (x + count < width && count < 128 && !(x + count + 1 < width && same(x + count, y, x + count + 1))) {
+                count++;
+            }
+            data.push_back((unsigned char)(count - 1));
+            for (int i = 0; i < count; i++) {
+                pixel(x + i, y);
+            }
+            x += count;
+        }
+    }
+    fwrite(data.data(), 1, data.size(), file);
+}
+
+bool writePng(FILE *file, int width, int height, const std::vector<unsigned char> &pixels) {
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    png.width = width;
+    png.height = height;
+    png.format = PNG_FORMAT_RGBA;
+    return png_image_write_to_stdio(&png, file, 0, pixels.data(), 0, nullptr) != 0;
+}
+
+// Quality 90 with 4:2:0 chroma, as most photo tools save.
+void writeJpeg(FILE *file, int width, int height, const std::vector<unsigned char> &pixels) {
+    jpeg_compress_struct info;
+    jpeg_error_mgr error;
+    info.err = jpeg_std_error(&error);
+    jpeg_create_compress(&info);
+    jpeg_stdio_dest(&info, file);
+    info.image_width = width;
+    info.image_height = height;
+    info.input_components = 3;
+    info.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&info);
+    jpeg_set_quality(&info, 90, TRUE);
+    jpeg_start_compress(&info, TRUE);
+    std::vector<unsigned char> row((size_t)width * 3);
+    while (info.next_scanline < info.image_height) {
+        const unsigned char *in = pixels.data() + (size_t)info.next_scanline * width * 4;
+        for (int x = 0; x < width; x++) {
+            memcpy(&row[(size_t)x * 3], in + x * 4, 3);
+        }
+        JSAMPROW rows = row.data();
+        jpeg_write_scanlines(&info, &rows, 1);
+    }
+    jpeg_finish_compress(&info);
+    jpeg_destroy_compress(&info);
+}
+
+void writePpm(FILE *file, int width, int height, const std::vector<unsigned char> &pixels) {
+    fprintf(file, "P6\n# bench_image_pipeline\n%d %d\n255\n", width, height);
+    std::vector<unsigned char> data;
+    data.reserve((size_t)width * height * 3);
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        data.insert(data.end(), pixels.begin() + i, pixels.begin() + i + 3);
+    }
+    fwrite(data.data(), 1, data.size(), file);
+}
+
+}
+
+int main(int argc, char **argv) {
+    int hardware = (int)std::thread::hardware_concurrency();
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : (hardware > 0 ? hardware : 1);
+    int images = argc > 2 ? std::atoi(argv[2]) : 48;
+
+    char directory[] = "/tmp/bench_image_pipeline.XXXXXX";
+    if (mkdtemp(directory) == nullptr) {
+        std::cerr << "Failed to create a temporary directory" << std::endl;
+        return 1;
+    }
+    std::vector<std::string> paths;
+    double fileMegabytes = 0.0;
+    double megabytes = 0.0;
+    for (int i = 0; i < images; i++) {
+        const Spec &spec = corpus[i % (sizeof(corpus) / sizeof(corpus[0]))];
+        std::string path = std::string(directory) + "/" + std::to_string(i) + extensions[spec.format];
+        FILE *file = fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            std::cerr << "Failed to write " << path << std::endl;
+            return 1;
+        }
+        bool flat = spec.format == Png || spec.format == TgaRle;
+        std::vector<unsigned char> pixels = makePixels(spec.width, spec.height, i, !flat);
+        if (spec.format == Jpeg) {
+            writeJpeg(file, spec.width, spec.height, pixels);
+        } else if (spec.format == Png) {
+            if (!writePng(file, spec.width, spec.height, pixels)) {
+                fclose(file);
+                std::cerr << "Failed to write " << path << std::endl;
+                return 1;
+            }
+        } else if (spec.format == Ppm) {
+            writePpm(file, spec.width, spec.height, pixels);
+        } else {
+            writeTga(file, spec.width, spec.height, spec.format == TgaRle, pixels);
+        }
+        fileMegabytes += ftell(file) / (1024.0 * 1024.0);
+        fclose(file);
+        paths.push_back(path);
+        megabytes += pixels.size() / (1024.0 * 1024.0);
+    }
+    std::cout << images << " images, " << fileMegabytes << " MB of files, " << megabytes
+              << " MB decoded (level 0)" << std::endl;
+
+    std::vector<int> counts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(maxThreads);
+
+    double base = 0.0;
+    int result = 0;
+    for (int threads : counts) {
+        jobs::JobSystem system(threads);
+        std::vector<LoadedImage> loaded(paths.size());
+        double ms = medianMs([&] {
+            loadImages(system, paths, [&](size_t index, LoadedImage &image) {
+                loaded[index] = std::move(image);
+            });
+        });
+        for (const LoadedImage &image : loaded) {
+            if (!image.error.empty() || image.levels.empty() || image.levels.back().width != 1 ||
+                image.levels.back().height != 1) {
+                std::cerr << image.path << ": " << (image.error.empty() ? "incomplete mip chain" : image.error)
+                          << std::endl;
+                result = 1;
+            }
+        }
+        if (threads == 1) {
+            base = ms;
+        }
+        std::cout << threads << " threads: " << ms << " ms, " << images * 1000.0 / ms << " images/s, "
+                  << megabytes * 1000.0 / ms << " MB/s (x" << base / ms << ")" << std::endl;
+    }
+
+    for (const std::string &path : paths) {
+        unlink(path.c_str());
+    }
+    rmdir(directory);
+    return result;
+}
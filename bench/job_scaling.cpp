@@ -0,0 +1,145 @@
+// How parallelFor and parallelReduce scale from 1 to N worker threads on two
+// engine-like loops: transforming vertex positions by a matrix (animation,
+// skinning) and counting the spheres inside a frustum (culling). Each run is
+// the median of several; speedup is against one worker.
+//
+// usage: bench_job_scaling [max threads] [items]
+
+#include "job_system.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Vec4 {
+    float x, y, z, w;
+};
+
+struct Plane {
+    float x, y, z, d;
+};
+
+const int runs = 7;
+const size_t grain = 4096;
+
+template <typename Fn>
+double medianMs(Fn fn) {
+    std::vector<double> times;
+    for (int i = 0; i < runs; i++) {
+        auto start = Clock::now();
+        fn();
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+void transform(const float *matrix, const Vec4 *in, Vec4 *out, size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+        const Vec4 &v = in[i];
+        out[i].x = matrix[0] * v.x + matrix[4] * v.y + matrix[8] * v.z + matrix[12] * v.w;
+        out[i].y = matrix[1] * v.x + matrix[5] * v.y + matrix[9] * v.z + matrix[13] * v.w;
+        out[i].z = matrix[2] * v.x + matrix[6] * v.y + matrix[10] * v.z + matrix[14] * v.w;
+        out[i].w = matrix[3] * v.x + matrix[7] * v.y + matrix[11] * v.z + matrix[15] * v.w;
+    }
+}
+
+// Spheres are x, y, z, radius.
+size_t countVisible(const Plane *planes, const Vec4 *spheres, size_t first, size_t last) {
+    size_t visible = 0;
+    for (size_t i = first; i < last; i++) {
+        const Vec4 &s = spheres[i];
+        bool inside = true;
+        for (int p = 0; p < 6; p++) {
+            if (planes[p].x * s.x + planes[p].y * s.y + planes[p].z * s.z + planes[p].d < -s.w) {
+                inside = false;
+                break;
+            }
+        }
+        visible += inside;
+    }
+    return visible;
+}
+
+}
+
+int main(int argc, char **argv) {
+    int hardware = (int)std::thread::hardware_concurrency();
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : (hardware > 0 ? hardware : 1);
+    size_t items = argc > 2 ? (size_t)std::atol(argv[2]) : 4 * 1024 * 1024;
+
+    std::vector<Vec4> positions(items);
+    std::vector<Vec4> transformed(items);
+    srand(1);
+    for (Vec4 &v : positions) {
+        v.x = (float)rand() / RAND_MAX * 200.0f - 100.0f;
+        v.y = (float)rand() / RAND_MAX * 200.0f - 100.0f;
+        v.z = (float)rand() / RAND_MAX * 200.0f - 100.0f;
+        v.w = (float)rand() / RAND_MAX * 2.0f;
+    }
+    const float matrix[16] = {
+        0.8f, 0.1f, 0.0f, 0.0f,  -0.1f, 0.8f, 0.2f, 0.0f,  0.0f, -0.2f, 0.9f, 0.0f,  1.0f, 2.0f, 3.0f, 1.0f,
+    };
+    // A 90 degree frustum looking down -z, from 1 to 100.
+    const float n = (float)std::sqrt(0.5);
+    const Plane planes[6] = {
+        {n, 0.0f, -n, 0.0f}, {-n, 0.0f, -n, 0.0f}, {0.0f, n, -n, 0.0f}, {0.0f, -n, -n, 0.0f},
+        {0.0f, 0.0f, -1.0f, -1.0f}, {0.0f, 0.0f, 1.0f, 100.0f},
+    };
+
+    double serialTransform = medianMs([&] {
+        transform(matrix, positions.data(), transformed.data(), 0, items);
+    });
+    size_t expected = 0;
+    double serialCull = medianMs([&] {
+        expected = countVisible(planes, positions.data(), 0, items);
+    });
+    std::cout << items << " items, serial: transform " << serialTransform << " ms, cull "
+              << serialCull << " ms (" << expected << " visible)" << std::endl;
+
+    std::vector<int> counts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(maxThreads);
+
+    double baseTransform = 0.0;
+    double baseCull = 0.0;
+    for (int threads : counts) {
+        jobs::JobSystem system(threads);
+        double transformMs = medianMs([&] {
+            jobs::parallelFor(system, 0, items, grain, [&](size_t first, size_t last) {
+                transform(matrix, positions.data(), transformed.data(), first, last);
+            });
+        });
+        size_t visible = 0;
+        double cullMs = medianMs([&] {
+            visible = jobs::parallelReduce(system, 0, items, grain, (size_t)0,
+                [&](size_t first, size_t last) {
+                    return countVisible(planes, positions.data(), first, last);
+                },
+                [](size_t a, size_t b) {
+                    return a + b;
+                });
+        });
+        if (visible != expected) {
+            std::cerr << "parallelReduce counted " << visible << " instead of " << expected << std::endl;
+            return 1;
+        }
+        if (threads == 1) {
+            baseTransform = transformMs;
+            baseCull = cullMs;
+        }
+        std::cout << threads << " threads: transform " << transformMs << " ms (x" << baseTransform / transformMs
+                  << "), cull " << cullMs << " ms (x" << baseCull / cullMs << ")" << std::endl;
+    }
+    return 0;
+}
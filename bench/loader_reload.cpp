@@ -0,0 +1,66 @@
+// Cost of loading again, e.g. for a new context or between tests, with
+// gladLoadGL (opens and closes libGL and looks up every name each time)
+// against gladLoadGLResident (keeps libGL open and caches the lookups).
+//
+// usage: bench_loader_reload [loads]
+
+#include <glad/glad.h>
+#include "headless_context.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Fn>
+double usPerLoad(int loads, Fn fn) {
+    auto start = Clock::now();
+    for (int i = 0; i < loads; i++) {
+        if (!fn()) {
+            return -1.0;
+        }
+    }
+    auto end = Clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / loads;
+}
+
+}
+
+int main(int argc, char **argv) {
+    int loads = argc > 1 ? std::atoi(argv[1]) : 200;
+    if (loads < 1) {
+        loads = 1;
+    }
+
+    if (!createHeadlessContext()) {
+        return 1;
+    }
+
+    double reopening = usPerLoad(loads, gladLoadGL);
+
+    if (!gladLoadGLResident()) {
+        std::cerr << "Failed to load GL" << std::endl;
+        return 1;
+    }
+    gladLoadStats first = gladGetLoadStats();
+
+    double resident = usPerLoad(loads, gladLoadGLResident);
+    gladLoadStats last = gladGetLoadStats();
+    gladCloseGL();
+
+    if (reopening < 0.0 || resident < 0.0) {
+        std::cerr << "Failed to load GL" << std::endl;
+        return 1;
+    }
+
+    std::cout << "gladLoadGL:                  " << reopening << " us/load" << std::endl;
+    std::cout << "gladLoadGLResident (first):  " << first.load_us << " us"
+              << " (open " << first.open_us << " us, resolve " << first.resolve_us
+              << " us, " << first.resolved << " lookups)" << std::endl;
+    std::cout << "gladLoadGLResident (reload): " << resident << " us/load"
+              << " (" << last.resolved << " lookups)" << std::endl;
+    return 0;
+}
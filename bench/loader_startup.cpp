@@ -0,0 +1,179 @@
+// Startup cost of eager vs lazy entry point resolution.
+//
+// Every run happens in a freshly forked process so the driver is loaded and
+// the symbol lookups are done from cold each time. A run times the loader
+// call and then a typical first frame (buffer upload, shader compile, one
+// draw), which is where the lazy trampolines pay for their lookups.
+//
+// usage: bench_loader_startup [runs]
+
+#include <glad/glad.h>
+#include "headless_context.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct RunResult {
+    double loadUs;
+    double firstFrameUs;
+    int lookups;
+};
+
+int lookups = 0;
+
+void* countingLoader(const char *name) {
+    lookups++;
+    return headlessGetProcAddress(name);
+}
+
+const char *vertexSource =
+    "#version 330 core\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "void main() { gl_Position = vec4(aPos, 1.0); }\n";
+
+const char *fragmentSource =
+    "#version 330 core\n"
+    "out vec4 FragColor;\n"
+    "void main() { FragColor = vec4(1.0, 0.5, 0.2, 1.0); }\n";
+
+void drawFirstFrame() {
+    const float vertices[] = {
+        -0.5f, -0.5f, 0.0f,
+         0.5f, -0.5f, 0.0f,
+         0.0f,  0.5f, 0.0f
+    };
+
+    unsigned int vao, vbo;
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexSource, NULL);
+    glCompileShader(vertexShader);
+    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentSource, NULL);
+    glCompileShader(fragmentShader);
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    glViewport(0, 0, 1, 1);
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(program);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glFinish();
+}
+
+// Runs in the forked child; the result goes back to the parent over a pipe.
+RunResult runOnce(bool lazy) {
+    RunResult result = {-1.0, -1.0, 0};
+    if (!createHeadlessContext()) {
+        return result;
+    }
+
+    auto start = Clock::now();
+    int loaded = lazy ? gladLoadGLLoaderLazy(countingLoader)
+                      : gladLoadGLLoader(countingLoader);
+    auto loadedAt = Clock::now();
+    if (!loaded) {
+        return result;
+    }
+    result.lookups = lookups;
+
+    drawFirstFrame();
+    auto drawnAt = Clock::now();
+
+    result.loadUs = std::chrono::duration<double, std::micro>(loadedAt - start).count();
+    result.firstFrameUs = std::chrono::duration<double, std::micro>(drawnAt - start).count();
+    return result;
+}
+
+bool runForked(bool lazy, RunResult &result) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return false;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        RunResult child = runOnce(lazy);
+        ssize_t written = write(fds[1], &child, sizeof(child));
+        _exit(written == sizeof(child) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    ssize_t got = read(fds[0], &result, sizeof(result));
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return got == sizeof(result) && result.loadUs >= 0.0;
+}
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+void report(const char *mode, const std::vector<RunResult> &runs) {
+    std::vector<double> load, frame;
+    for (const RunResult &run : runs) {
+        load.push_back(run.loadUs);
+        frame.push_back(run.firstFrameUs);
+    }
+
+    std::cout << mode
+              << "  load: " << median(load) << " us"
+              << "  load+first frame: " << median(frame) << " us"
+              << "  lookups during load: " << runs.front().lookups
+              << std::endl;
+}
+
+}
+
+int main(int argc, char **argv) {
+    int runs = argc > 1 ? std::atoi(argv[1]) : 20;
+    if (runs < 1) {
+        runs = 1;
+    }
+
+    std::vector<RunResult> eager, lazy;
+    for (int i = 0; i < runs; i++) {
+        // Interleave the modes so drift on the machine hits both equally.
+        RunResult result;
+        if (!runForked(false, result)) {
+            std::cerr << "Eager run failed" << std::endl;
+            return 1;
+        }
+        eager.push_back(result);
+        if (!runForked(true, result)) {
+            std::cerr << "Lazy run failed" << std::endl;
+            return 1;
+        }
+        lazy.push_back(result);
+    }
+
+    std::cout << "medians over " << runs << " cold runs" << std::endl;
+    report("eager", eager);
+    report("lazy ", lazy);
+    return 0;
+}
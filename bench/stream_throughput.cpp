@@ -0,0 +1,230 @@
+// How fast vertex data rewritten every frame reaches the GPU, in MB/s, for
+// four ways of streaming it: glBufferSubData into a buffer still in use
+// (the driver synchronizes), orphaning with glBufferData first, and a
+// StreamBuffer ring, mapped unsynchronized each frame or persistently. Each
+// frame writes its data in 16 batches and draws every batch as points, so
+// the GPU really reads what was streamed; rasterizer discard keeps it from
+// spending the time on pixels instead.
+//
+// usage: bench_stream_throughput [MB per frame] [frames]
+
+#include <glad/glad.h>
+#include "headless_context.h"
+#include "state_cache.h"
+#include "stream_buffer.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const int batches = 16;
+const int frameRegions = 3;
+
+const char *vertexSource = R"(#version 330 core
+layout(location = 0) in vec2 position;
+void main() {
+    gl_Position = vec4(position, 0.0, 1.0);
+}
+)";
+
+const char *fragmentSource = R"(#version 330 core
+out vec4 fragColor;
+void main() {
+    fragColor = vec4(1.0);
+}
+)";
+
+GLuint compile(GLenum type, const char *source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    return shader;
+}
+
+GLuint link() {
+    GLuint vertexShader = compile(GL_VERTEX_SHADER, vertexSource);
+    GLuint fragmentShader = compile(GL_FRAGMENT_SHADER, fragmentSource);
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+// Points the vertex array's only attribute at `buffer`.
+void usePositions(StateCache &state, GLuint vertexArray, GLuint buffer) {
+    state.bindVertexArray(vertexArray);
+    state.bindBuffer(GL_ARRAY_BUFFER, buffer);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+}
+
+double mbPerSecond(size_t bytes, Clock::time_point start) {
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return bytes / seconds / (1024.0 * 1024.0);
+}
+
+// One buffer, rewritten in place or orphaned first.
+double bufferSubData(StateCache &state, GLuint vertexArray, const std::vector<float> &vertices,
+                     int frames, bool orphan) {
+    GLsizeiptr size = (GLsizeiptr)(vertices.size() * sizeof(float));
+    GLsizeiptr batchSize = size / batches;
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    usePositions(state, vertexArray, buffer);
+    glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    glFinish();
+
+    Clock::time_point start = Clock::now();
+    for (int frame = 0; frame < frames; frame++) {
+        if (orphan) {
+            glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        }
+        for (int batch = 0; batch < batches; batch++) {
+            glBufferSubData(GL_ARRAY_BUFFER, batch * batchSize, batchSize,
+                            (const char*)vertices.data() + batch * batchSize);
+            glDrawArrays(GL_POINTS, (GLint)(batch * batchSize / 8), (GLsizei)(batchSize / 8));
+        }
+    }
+    glFinish();
+    double result = mbPerSecond((size_t)size * frames, start);
+
+    state.deletedBuffer(buffer);
+    glDeleteBuffers(1, &buffer);
+    return result;
+}
+
+double streamBuffer(StateCache &state, GLuint vertexArray, const std::vector<float> &vertices,
+                    int frames, bool persistent, StreamBuffer::Stats &stats) {
+    GLsizeiptr size = (GLsizeiptr)(vertices.size() * sizeof(float));
+    GLsizeiptr batchSize = size / batches;
+    StreamBuffer stream;
+    if (!stream.create(state, size, frameRegions, persistent) ||
+        (stream.mode() == StreamBuffer::Mode::Persistent) != persistent) {
+        stream.destroy(state);
+        return -1.0;
+    }
+    usePositions(state, vertexArray, stream.buffer());
+    glFinish();
+
+    Clock::time_point start = Clock::now();
+    GLintptr offsets[batches];
+    for (int frame = 0; frame < frames; frame++) {
+        stream.beginFrame(state);
+        for (int batch = 0; batch < batches; batch++) {
+            void *data = stream.allocate(state, batchSize, 8, offsets[batch]);
+            if (data == nullptr) {
+                stream.destroy(state);
+                return -1.0;
+            }
+            memcpy(data, (const char*)vertices.data() + batch * batchSize, batchSize);
+        }
+        stream.unmap(state);
+        for (int batch = 0; batch < batches; batch++) {
+            glDrawArrays(GL_POINTS, (GLint)(offsets[batch] / 8), (GLsizei)(batchSize / 8));
+        }
+        stream.endFrame();
+    }
+    glFinish();
+    double result = mbPerSecond((size_t)size * frames, start);
+
+    stats = stream.stats();
+    stream.destroy(state);
+    return result;
+}
+
+void report(const char *name, double result) {
+    std::cout << name;
+    if (result < 0.0) {
+        std::cout << "not available" << std::endl;
+    } else {
+        std::cout << result << " MB/s" << std::endl;
+    }
+}
+
+void report(const char *name, double result, const StreamBuffer::Stats &stats) {
+    report(name, result);
+    if (result >= 0.0) {
+        std::cout << "    " << stats.waits << " of " << stats.frames << " frames waited "
+                  << stats.waitMilliseconds << " ms for the GPU" << std::endl;
+    }
+}
+
+}
+
+int main(int argc, char **argv) {
+    double megabytes = argc > 1 ? std::atof(argv[1]) : 4.0;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 200;
+    if (megabytes <= 0.0 || frames < 1) {
+        std::cerr << "usage: bench_stream_throughput [MB per frame] [frames]" << std::endl;
+        return 1;
+    }
+
+    if (!createHeadlessContext()) {
+        return 1;
+    }
+    if (!gladLoadGL()) {
+        std::cerr << "Failed to load GL" << std::endl;
+        return 1;
+    }
+
+    // Whole points, split evenly into the batches.
+    size_t points = (size_t)(megabytes * 1024 * 1024 / 8) / batches * batches;
+    std::vector<float> vertices(points * 2);
+    for (size_t i = 0; i < points; i++) {
+        vertices[i * 2] = (float)(i % 64) / 32.0f - 1.0f;
+        vertices[i * 2 + 1] = (float)(i / 64 % 64) / 32.0f - 1.0f;
+    }
+
+    GLuint program = link();
+    if (program == 0) {
+        std::cerr << "Failed to build the program" << std::endl;
+        return 1;
+    }
+    GLuint texture = 0;
+    GLuint framebuffer = 0;
+    GLuint vertexArray = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 64, 64, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glGenFramebuffers(1, &framebuffer);
+    glGenVertexArrays(1, &vertexArray);
+
+    StateCache state;
+    state.bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    state.viewport(0, 0, 64, 64);
+    state.enable(GL_RASTERIZER_DISCARD);
+    state.useProgram(program);
+
+    std::cout << glGetString(GL_RENDERER) << ", " << points * 8 / 1024.0 / 1024.0 << " MB per frame in "
+              << batches << " batches, " << frames << " frames" << std::endl;
+    report("glBufferSubData:                ", bufferSubData(state, vertexArray, vertices, frames, false));
+    report("glBufferData + glBufferSubData: ", bufferSubData(state, vertexArray, vertices, frames, true));
+    StreamBuffer::Stats stats;
+    double unsynchronized = streamBuffer(state, vertexArray, vertices, frames, false, stats);
+    report("StreamBuffer, unsynchronized:   ", unsynchronized, stats);
+    double persistent = streamBuffer(state, vertexArray, vertices, frames, true, stats);
+    report("StreamBuffer, persistent:       ", persistent, stats);
+
+    glDeleteVertexArrays(1, &vertexArray);
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteTextures(1, &texture);
+    glDeleteProgram(program);
+    destroyHeadlessContext();
+    return 0;
+}
@@ -0,0 +1,33 @@
+# glad_minimal_loader(<out_var> <source>...)
+#
+# Adds a build step that scans the given sources (and headers) for the GL
+# functions they call and generates a loader resolving only those, see
+# generate_glad_minimal.cmake. The generated file is returned in <out_var>;
+# add it to the target in place of src/glad.c. It is regenerated whenever
+# one of the sources or glad.h changes.
+
+set( GLAD_MINIMAL_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/generate_glad_minimal.cmake)
+
+function( glad_minimal_loader out_var)
+    set( header ${PROJECT_SOURCE_DIR}/include/glad/glad.h)
+    set( output ${CMAKE_CURRENT_BINARY_DIR}/glad_minimal/glad_minimal.cpp)
+
+    set( sources "")
+    foreach( source ${ARGN})
+        get_filename_component( source ${source} ABSOLUTE)
+        list( APPEND sources ${source})
+    endforeach()
+    # A list cannot be passed through -D, the script splits on | again.
+    string( REPLACE ";" "|" joined "${sources}")
+
+    add_custom_command(
+        OUTPUT ${output}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_CURRENT_BINARY_DIR}/glad_minimal
+        COMMAND ${CMAKE_COMMAND} -DGLAD_HEADER=${header} -DSOURCES=${joined} -DOUTPUT=${output}
+                -P ${GLAD_MINIMAL_SCRIPT}
+        DEPENDS ${sources} ${header} ${GLAD_MINIMAL_SCRIPT}
+        COMMENT "Generating a GL loader for the functions used"
+        VERBATIM)
+
+    set( ${out_var} ${output} PARENT_SCOPE)
+endfunction()
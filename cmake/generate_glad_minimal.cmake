@@ -0,0 +1,99 @@
+# Writes a C++ loader that resolves only the GL functions some sources call.
+# Run in script mode by glad_minimal_loader() in GladMinimalLoader.cmake:
+#
+#   cmake -DGLAD_HEADER=<glad.h> -DSOURCES=<a|b|...> -DOUTPUT=<file.cpp>
+#         -P generate_glad_minimal.cmake
+#
+# Every gl* token in the sources that glad.h declares an entry point for is
+# kept, comments included, so at worst a function is resolved needlessly.
+
+if( NOT GLAD_HEADER OR NOT SOURCES OR NOT OUTPUT)
+    message( FATAL_ERROR "GLAD_HEADER, SOURCES and OUTPUT must be set")
+endif()
+
+# Entry points glad.h knows, with their pointer types.
+file( STRINGS ${GLAD_HEADER} declarations REGEX "^GLAPI PFN[A-Z0-9_]+PROC glad_gl[A-Za-z0-9_]+;$")
+set( known "")
+foreach( declaration ${declarations})
+    string( REGEX REPLACE "^GLAPI (PFN[A-Z0-9_]+PROC) glad_(gl[A-Za-z0-9_]+);$" "\\2;\\1" entry "${declaration}")
+    list( GET entry 0 name)
+    list( GET entry 1 type)
+    set( type_${name} ${type})
+    list( APPEND known ${name})
+endforeach()
+
+# glGetString is always needed for the version.
+set( used glGetString)
+string( REPLACE "|" ";" SOURCES "${SOURCES}")
+foreach( source ${SOURCES})
+    file( READ ${source} text)
+    string( REGEX MATCHALL "gl[A-Z][A-Za-z0-9_]*" tokens "${text}")
+    list( REMOVE_DUPLICATES tokens)
+    foreach( token ${tokens})
+        if( DEFINED type_${token})
+            list( APPEND used ${token})
+        endif()
+    endforeach()
+endforeach()
+list( REMOVE_DUPLICATES used)
+list( SORT used)
+list( LENGTH used count)
+
+set( pointers "")
+set( names "")
+set( slots "")
+foreach( name ${used})
+    string( APPEND pointers "${type_${name}} glad_${name} = nullptr;\n")
+    string( APPEND names "    \"${name}\",\n")
+    string( APPEND slots "    (void**)&glad_${name},\n")
+endforeach()
+
+set( code "// Generated by cmake/generate_glad_minimal.cmake, do not edit.
+//
+// Replaces src/glad.c for a program that only calls the ${count} entry points
+// below. Anything else glad.c provides (gladLoadGL, the extension queries,
+// the GLAD_GL_* flags, GLCapabilities) is left out, so using it fails to link.
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdio>
+
+${pointers}
+struct gladGLversionStruct GLVersion = { 0, 0 };
+
+namespace {
+
+constexpr const char *procNames[] = {
+${names}};
+
+constexpr size_t procCount = sizeof(procNames) / sizeof(procNames[0]);
+
+void **const procSlots[procCount] = {
+${slots}};
+
+}
+
+int gladLoadGLLoader(GLADloadproc load) {
+    for (size_t i = 0; i < procCount; i++) {
+        *procSlots[i] = load(procNames[i]);
+    }
+
+    GLVersion.major = 0;
+    GLVersion.minor = 0;
+    const char *version = glad_glGetString != nullptr ? (const char*)glad_glGetString(GL_VERSION) : nullptr;
+    if (version == nullptr || sscanf(version, \"%d.%d\", &GLVersion.major, &GLVersion.minor) != 2) {
+        return 0;
+    }
+    return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+")
+
+# Leave the file alone when nothing changed, so it is not compiled again.
+if( EXISTS ${OUTPUT})
+    file( READ ${OUTPUT} previous)
+    if( previous STREQUAL code)
+        return()
+    endif()
+endif()
+file( WRITE ${OUTPUT} "${code}")
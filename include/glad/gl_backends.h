@@ -0,0 +1,29 @@
+/*
+ * The libraries glad's loader can take GL from on Linux and BSD, with the
+ * function that resolves names in each; see gladSetGLBackends in glad.h.
+ * GLX needs an X server to start; EGL and OSMesa also work on machines
+ * without one. Kept apart from glad.c so code creating contexts for these
+ * backends (src/headless_context.cpp) opens the same libraries, also when
+ * it is built against the minimal loader.
+ */
+#ifndef GLAD_GL_BACKENDS_H
+#define GLAD_GL_BACKENDS_H
+
+#include <stddef.h>
+
+struct gladGLBackend {
+    const char *name;
+    /* Tried in order, up to the first NULL. */
+    const char *libraries[4];
+    const char *getProcAddress;
+};
+
+static const struct gladGLBackend GLAD_GL_BACKENDS[] = {
+    {"glx", {"libGL.so.1", "libGL.so", NULL, NULL}, "glXGetProcAddressARB"},
+    {"egl", {"libEGL.so.1", "libEGL.so", NULL, NULL}, "eglGetProcAddress"},
+    {"osmesa", {"libOSMesa.so.8", "libOSMesa.so.6", "libOSMesa.so", NULL}, "OSMesaGetProcAddress"}
+};
+
+#define GLAD_NUM_GL_BACKENDS (sizeof(GLAD_GL_BACKENDS) / sizeof(GLAD_GL_BACKENDS[0]))
+
+#endif
@@ -4,19 +4,27 @@
 
     Language/Generator: C/C++
     Specification: gl
-    APIs: gl=3.3
+    APIs: gl=4.5
     Profile: core
     Extensions:
-        
+        GL_ARB_buffer_storage,
+        GL_ARB_direct_state_access,
+        GL_ARB_multi_draw_indirect,
+        GL_KHR_debug,
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=4.5" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_multi_draw_indirect,GL_KHR_debug,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.5&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_direct_state_access&extensions=GL_ARB_multi_draw_indirect&extensions=GL_KHR_debug&extensions=GL_KHR_parallel_shader_compile
+
+    Extended from the glad 0.1.33 output for gl=3.3 by the scripts in
+    tools/glad, which also regenerate the loader's own tables (see
+    "Regenerating the loader" in README.md).
 */
 
 
@@ -52,6 +60,30 @@ struct gladGLversionStruct {
     int minor;
 };
 
+/* Hashed extension names, see get_exts in glad.c. */
+struct gladGLExtensions {
+    char *block;
+    unsigned int mask;
+};
+
+/* Capability tiers, lowest first. GLAD_GL_TIER_45 means buffer storage,
+ * direct state access and multi draw indirect are all usable, through GL 4.5
+ * or the ARB extensions on an older core context. */
+#define GLAD_GL_TIER_NONE 0
+#define GLAD_GL_TIER_33 1
+#define GLAD_GL_TIER_45 2
+
+/* What the loaded context can do beyond GL 3.3, so a renderer can pick its
+ * path once after loading. A feature is only set when its core version or
+ * extension is there and its entry points loaded. */
+struct gladGLCapabilities {
+    int tier;
+    int buffer_storage;         /* glBufferStorage, persistent mappings */
+    int direct_state_access;    /* glCreate*, glNamedBuffer*, glTexture* */
+    int multi_draw_indirect;    /* glMultiDrawArrays/ElementsIndirect */
+    int debug_output;           /* glDebugMessageCallback, object labels */
+};
+
 typedef void* (* GLADloadproc)(const char *name);
 
 #ifndef GLAPI
@@ -82,10 +114,69 @@ typedef void* (* GLADloadproc)(const char *name);
 
 GLAPI struct gladGLversionStruct GLVersion;
 
+GLAPI struct gladGLCapabilities GLCapabilities;
+
 GLAPI int gladLoadGL(void);
 
+/* Sets where gladLoadGL, gladLoadGLResident and gladLoadGLLazy look for GL
+ * on Linux and BSD: a comma separated list of "glx" (libGL), "egl" (libEGL)
+ * and "osmesa" (libOSMesa), tried in order. NULL goes back to
+ * $GLAD_GL_BACKENDS, or "glx,egl,osmesa" when that is unset. Takes effect
+ * the next time the library is opened, after gladCloseGL for the resident
+ * loader. The context being loaded must belong to the chosen library. */
+GLAPI void gladSetGLBackends(const char *backends);
+
+/* "glx", "egl" or "osmesa" while a library is open, NULL otherwise. */
+GLAPI const char *gladGetGLBackend(void);
+
+/* Opens the library gladLoadGL would, unless one is open already, and keeps
+ * it open until gladCloseGL. gladGetGLProcAddress then resolves names
+ * through it; it is a GLADloadproc, e.g. for gladLoadGLContext. */
+GLAPI int gladOpenGL(void);
+GLAPI void *gladGetGLProcAddress(const char *name);
+
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+struct gladLoadStats {
+    double open_us;     /* opening libGL, zero while it is resident */
+    double resolve_us;  /* looking up the entry points */
+    double load_us;     /* the whole load */
+    int resolved;       /* lookups that went to the library */
+};
+
+/* Like gladLoadGL, but libGL stays open and the entry points are resolved
+ * once and cached, so later loads skip both. gladCloseGL releases it. */
+GLAPI int gladLoadGLResident(void);
+
+GLAPI struct gladLoadStats gladGetLoadStats(void);
+
+GLAPI void gladCloseGL(void);
+
+#ifdef GLAD_PROFILE
+/* Built with GLAD_PROFILE every glad_gl* call is counted and timed per
+ * thread. The report is printed to stderr at exit, and also written as CSV
+ * to $GLAD_PROFILE_CSV when that is set. */
+GLAPI void gladProfileReport(void);
+
+GLAPI int gladProfileWriteCSV(const char *path);
+#endif
+
+/* Like gladLoadGL/gladLoadGLLoader, but entry points are resolved on their
+ * first call instead of up front. The loader must stay valid afterwards, so
+ * gladLoadGLLazy leaves the library open and a later gladLoadGL reuses it.
+ * Pointers are trampolines until then and so never NULL: check
+ * GLCapabilities or the GLAD_GL_* flags rather than the pointer. The entry
+ * points GLCapabilities depends on are resolved during loading. A missing
+ * entry point called through its trampoline does nothing and returns 0. */
+GLAPI int gladLoadGLLazy(void);
+
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
+/* Extension names are read once while loading and kept until the next load,
+ * so this never calls into GL and can be used from any thread as long as no
+ * load runs at the same time. */
+GLAPI int gladHasExtension(const char *name);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -951,6 +1042,531 @@ typedef void (APIENTRY *GLVULKANPROCNV)(void);
 #define GL_TIME_ELAPSED 0x88BF
 #define GL_TIMESTAMP 0x8E28
 #define GL_INT_2_10_10_10_REV 0x8D9F
+#define GL_SAMPLE_SHADING 0x8C36
+#define GL_MIN_SAMPLE_SHADING_VALUE 0x8C37
+#define GL_MIN_PROGRAM_TEXTURE_GATHER_OFFSET 0x8E5E
+#define GL_MAX_PROGRAM_TEXTURE_GATHER_OFFSET 0x8E5F
+#define GL_TEXTURE_CUBE_MAP_ARRAY 0x9009
+#define GL_TEXTURE_BINDING_CUBE_MAP_ARRAY 0x900A
+#define GL_PROXY_TEXTURE_CUBE_MAP_ARRAY 0x900B
+#define GL_SAMPLER_CUBE_MAP_ARRAY 0x900C
+#define GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW 0x900D
+#define GL_INT_SAMPLER_CUBE_MAP_ARRAY 0x900E
+#define GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY 0x900F
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#define GL_DRAW_INDIRECT_BUFFER_BINDING 0x8F43
+#define GL_GEOMETRY_SHADER_INVOCATIONS 0x887F
+#define GL_MAX_GEOMETRY_SHADER_INVOCATIONS 0x8E5A
+#define GL_MIN_FRAGMENT_INTERPOLATION_OFFSET 0x8E5B
+#define GL_MAX_FRAGMENT_INTERPOLATION_OFFSET 0x8E5C
+#define GL_FRAGMENT_INTERPOLATION_OFFSET_BITS 0x8E5D
+#define GL_MAX_VERTEX_STREAMS 0x8E71
+#define GL_DOUBLE_VEC2 0x8FFC
+#define GL_DOUBLE_VEC3 0x8FFD
+#define GL_DOUBLE_VEC4 0x8FFE
+#define GL_DOUBLE_MAT2 0x8F46
+#define GL_DOUBLE_MAT3 0x8F47
+#define GL_DOUBLE_MAT4 0x8F48
+#define GL_DOUBLE_MAT2x3 0x8F49
+#define GL_DOUBLE_MAT2x4 0x8F4A
+#define GL_DOUBLE_MAT3x2 0x8F4B
+#define GL_DOUBLE_MAT3x4 0x8F4C
+#define GL_DOUBLE_MAT4x2 0x8F4D
+#define GL_DOUBLE_MAT4x3 0x8F4E
+#define GL_ACTIVE_SUBROUTINES 0x8DE5
+#define GL_ACTIVE_SUBROUTINE_UNIFORMS 0x8DE6
+#define GL_ACTIVE_SUBROUTINE_UNIFORM_LOCATIONS 0x8E47
+#define GL_ACTIVE_SUBROUTINE_MAX_LENGTH 0x8E48
+#define GL_ACTIVE_SUBROUTINE_UNIFORM_MAX_LENGTH 0x8E49
+#define GL_MAX_SUBROUTINES 0x8DE7
+#define GL_MAX_SUBROUTINE_UNIFORM_LOCATIONS 0x8DE8
+#define GL_NUM_COMPATIBLE_SUBROUTINES 0x8E4A
+#define GL_COMPATIBLE_SUBROUTINES 0x8E4B
+#define GL_PATCHES 0x000E
+#define GL_PATCH_VERTICES 0x8E72
+#define GL_PATCH_DEFAULT_INNER_LEVEL 0x8E73
+#define GL_PATCH_DEFAULT_OUTER_LEVEL 0x8E74
+#define GL_TESS_CONTROL_OUTPUT_VERTICES 0x8E75
+#define GL_TESS_GEN_MODE 0x8E76
+#define GL_TESS_GEN_SPACING 0x8E77
+#define GL_TESS_GEN_VERTEX_ORDER 0x8E78
+#define GL_TESS_GEN_POINT_MODE 0x8E79
+#define GL_ISOLINES 0x8E7A
+#define GL_FRACTIONAL_ODD 0x8E7B
+#define GL_FRACTIONAL_EVEN 0x8E7C
+#define GL_MAX_PATCH_VERTICES 0x8E7D
+#define GL_MAX_TESS_GEN_LEVEL 0x8E7E
+#define GL_MAX_TESS_CONTROL_UNIFORM_COMPONENTS 0x8E7F
+#define GL_MAX_TESS_EVALUATION_UNIFORM_COMPONENTS 0x8E80
+#define GL_MAX_TESS_CONTROL_TEXTURE_IMAGE_UNITS 0x8E81
+#define GL_MAX_TESS_EVALUATION_TEXTURE_IMAGE_UNITS 0x8E82
+#define GL_MAX_TESS_CONTROL_OUTPUT_COMPONENTS 0x8E83
+#define GL_MAX_TESS_PATCH_COMPONENTS 0x8E84
+#define GL_MAX_TESS_CONTROL_TOTAL_OUTPUT_COMPONENTS 0x8E85
+#define GL_MAX_TESS_EVALUATION_OUTPUT_COMPONENTS 0x8E86
+#define GL_MAX_TESS_CONTROL_UNIFORM_BLOCKS 0x8E89
+#define GL_MAX_TESS_EVALUATION_UNIFORM_BLOCKS 0x8E8A
+#define GL_MAX_TESS_CONTROL_INPUT_COMPONENTS 0x886C
+#define GL_MAX_TESS_EVALUATION_INPUT_COMPONENTS 0x886D
+#define GL_MAX_COMBINED_TESS_CONTROL_UNIFORM_COMPONENTS 0x8E1E
+#define GL_MAX_COMBINED_TESS_EVALUATION_UNIFORM_COMPONENTS 0x8E1F
+#define GL_UNIFORM_BLOCK_REFERENCED_BY_TESS_CONTROL_SHADER 0x84F0
+#define GL_UNIFORM_BLOCK_REFERENCED_BY_TESS_EVALUATION_SHADER 0x84F1
+#define GL_TESS_EVALUATION_SHADER 0x8E87
+#define GL_TESS_CONTROL_SHADER 0x8E88
+#define GL_TRANSFORM_FEEDBACK 0x8E22
+#define GL_TRANSFORM_FEEDBACK_BUFFER_PAUSED 0x8E23
+#define GL_TRANSFORM_FEEDBACK_BUFFER_ACTIVE 0x8E24
+#define GL_TRANSFORM_FEEDBACK_BINDING 0x8E25
+#define GL_MAX_TRANSFORM_FEEDBACK_BUFFERS 0x8E70
+#define GL_FIXED 0x140C
+#define GL_IMPLEMENTATION_COLOR_READ_TYPE 0x8B9A
+#define GL_IMPLEMENTATION_COLOR_READ_FORMAT 0x8B9B
+#define GL_LOW_FLOAT 0x8DF0
+#define GL_MEDIUM_FLOAT 0x8DF1
+#define GL_HIGH_FLOAT 0x8DF2
+#define GL_LOW_INT 0x8DF3
+#define GL_MEDIUM_INT 0x8DF4
+#define GL_HIGH_INT 0x8DF5
+#define GL_SHADER_COMPILER 0x8DFA
+#define GL_SHADER_BINARY_FORMATS 0x8DF8
+#define GL_NUM_SHADER_BINARY_FORMATS 0x8DF9
+#define GL_MAX_VERTEX_UNIFORM_VECTORS 0x8DFB
+#define GL_MAX_VARYING_VECTORS 0x8DFC
+#define GL_MAX_FRAGMENT_UNIFORM_VECTORS 0x8DFD
+#define GL_RGB565 0x8D62
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_PROGRAM_BINARY_FORMATS 0x87FF
+#define GL_VERTEX_SHADER_BIT 0x00000001
+#define GL_FRAGMENT_SHADER_BIT 0x00000002
+#define GL_GEOMETRY_SHADER_BIT 0x00000004
+#define GL_TESS_CONTROL_SHADER_BIT 0x00000008
+#define GL_TESS_EVALUATION_SHADER_BIT 0x00000010
+#define GL_ALL_SHADER_BITS 0xFFFFFFFF
+#define GL_PROGRAM_SEPARABLE 0x8258
+#define GL_ACTIVE_PROGRAM 0x8259
+#define GL_PROGRAM_PIPELINE_BINDING 0x825A
+#define GL_MAX_VIEWPORTS 0x825B
+#define GL_VIEWPORT_SUBPIXEL_BITS 0x825C
+#define GL_VIEWPORT_BOUNDS_RANGE 0x825D
+#define GL_LAYER_PROVOKING_VERTEX 0x825E
+#define GL_VIEWPORT_INDEX_PROVOKING_VERTEX 0x825F
+#define GL_UNDEFINED_VERTEX 0x8260
+#define GL_COPY_READ_BUFFER_BINDING 0x8F36
+#define GL_COPY_WRITE_BUFFER_BINDING 0x8F37
+#define GL_TRANSFORM_FEEDBACK_ACTIVE 0x8E24
+#define GL_TRANSFORM_FEEDBACK_PAUSED 0x8E23
+#define GL_UNPACK_COMPRESSED_BLOCK_WIDTH 0x9127
+#define GL_UNPACK_COMPRESSED_BLOCK_HEIGHT 0x9128
+#define GL_UNPACK_COMPRESSED_BLOCK_DEPTH 0x9129
+#define GL_UNPACK_COMPRESSED_BLOCK_SIZE 0x912A
+#define GL_PACK_COMPRESSED_BLOCK_WIDTH 0x912B
+#define GL_PACK_COMPRESSED_BLOCK_HEIGHT 0x912C
+#define GL_PACK_COMPRESSED_BLOCK_DEPTH 0x912D
+#define GL_PACK_COMPRESSED_BLOCK_SIZE 0x912E
+#define GL_NUM_SAMPLE_COUNTS 0x9380
+#define GL_MIN_MAP_BUFFER_ALIGNMENT 0x90BC
+#define GL_ATOMIC_COUNTER_BUFFER 0x92C0
+#define GL_ATOMIC_COUNTER_BUFFER_BINDING 0x92C1
+#define GL_ATOMIC_COUNTER_BUFFER_START 0x92C2
+#define GL_ATOMIC_COUNTER_BUFFER_SIZE 0x92C3
+#define GL_ATOMIC_COUNTER_BUFFER_DATA_SIZE 0x92C4
+#define GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTERS 0x92C5
+#define GL_ATOMIC_COUNTER_BUFFER_ACTIVE_ATOMIC_COUNTER_INDICES 0x92C6
+#define GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_VERTEX_SHADER 0x92C7
+#define GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_TESS_CONTROL_SHADER 0x92C8
+#define GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_TESS_EVALUATION_SHADER 0x92C9
+#define GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_GEOMETRY_SHADER 0x92CA
+#define GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_FRAGMENT_SHADER 0x92CB
+#define GL_MAX_VERTEX_ATOMIC_COUNTER_BUFFERS 0x92CC
+#define GL_MAX_TESS_CONTROL_ATOMIC_COUNTER_BUFFERS 0x92CD
+#define GL_MAX_TESS_EVALUATION_ATOMIC_COUNTER_BUFFERS 0x92CE
+#define GL_MAX_GEOMETRY_ATOMIC_COUNTER_BUFFERS 0x92CF
+#define GL_MAX_FRAGMENT_ATOMIC_COUNTER_BUFFERS 0x92D0
+#define GL_MAX_COMBINED_ATOMIC_COUNTER_BUFFERS 0x92D1
+#define GL_MAX_VERTEX_ATOMIC_COUNTERS 0x92D2
+#define GL_MAX_TESS_CONTROL_ATOMIC_COUNTERS 0x92D3
+#define GL_MAX_TESS_EVALUATION_ATOMIC_COUNTERS 0x92D4
+#define GL_MAX_GEOMETRY_ATOMIC_COUNTERS 0x92D5
+#define GL_MAX_FRAGMENT_ATOMIC_COUNTERS 0x92D6
+#define GL_MAX_COMBINED_ATOMIC_COUNTERS 0x92D7
+#define GL_MAX_ATOMIC_COUNTER_BUFFER_SIZE 0x92D8
+#define GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS 0x92DC
+#define GL_ACTIVE_ATOMIC_COUNTER_BUFFERS 0x92D9
+#define GL_UNIFORM_ATOMIC_COUNTER_BUFFER_INDEX 0x92DA
+#define GL_UNSIGNED_INT_ATOMIC_COUNTER 0x92DB
+#define GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT 0x00000001
+#define GL_ELEMENT_ARRAY_BARRIER_BIT 0x00000002
+#define GL_UNIFORM_BARRIER_BIT 0x00000004
+#define GL_TEXTURE_FETCH_BARRIER_BIT 0x00000008
+#define GL_SHADER_IMAGE_ACCESS_BARRIER_BIT 0x00000020
+#define GL_COMMAND_BARRIER_BIT 0x00000040
+#define GL_PIXEL_BUFFER_BARRIER_BIT 0x00000080
+#define GL_TEXTURE_UPDATE_BARRIER_BIT 0x00000100
+#define GL_BUFFER_UPDATE_BARRIER_BIT 0x00000200
+#define GL_FRAMEBUFFER_BARRIER_BIT 0x00000400
+#define GL_TRANSFORM_FEEDBACK_BARRIER_BIT 0x00000800
+#define GL_ATOMIC_COUNTER_BARRIER_BIT 0x00001000
+#define GL_ALL_BARRIER_BITS 0xFFFFFFFF
+#define GL_MAX_IMAGE_UNITS 0x8F38
+#define GL_MAX_COMBINED_IMAGE_UNITS_AND_FRAGMENT_OUTPUTS 0x8F39
+#define GL_IMAGE_BINDING_NAME 0x8F3A
+#define GL_IMAGE_BINDING_LEVEL 0x8F3B
+#define GL_IMAGE_BINDING_LAYERED 0x8F3C
+#define GL_IMAGE_BINDING_LAYER 0x8F3D
+#define GL_IMAGE_BINDING_ACCESS 0x8F3E
+#define GL_IMAGE_1D 0x904C
+#define GL_IMAGE_2D 0x904D
+#define GL_IMAGE_3D 0x904E
+#define GL_IMAGE_2D_RECT 0x904F
+#define GL_IMAGE_CUBE 0x9050
+#define GL_IMAGE_BUFFER 0x9051
+#define GL_IMAGE_1D_ARRAY 0x9052
+#define GL_IMAGE_2D_ARRAY 0x9053
+#define GL_IMAGE_CUBE_MAP_ARRAY 0x9054
+#define GL_IMAGE_2D_MULTISAMPLE 0x9055
+#define GL_IMAGE_2D_MULTISAMPLE_ARRAY 0x9056
+#define GL_INT_IMAGE_1D 0x9057
+#define GL_INT_IMAGE_2D 0x9058
+#define GL_INT_IMAGE_3D 0x9059
+#define GL_INT_IMAGE_2D_RECT 0x905A
+#define GL_INT_IMAGE_CUBE 0x905B
+#define GL_INT_IMAGE_BUFFER 0x905C
+#define GL_INT_IMAGE_1D_ARRAY 0x905D
+#define GL_INT_IMAGE_2D_ARRAY 0x905E
+#define GL_INT_IMAGE_CUBE_MAP_ARRAY 0x905F
+#define GL_INT_IMAGE_2D_MULTISAMPLE 0x9060
+#define GL_INT_IMAGE_2D_MULTISAMPLE_ARRAY 0x9061
+#define GL_UNSIGNED_INT_IMAGE_1D 0x9062
+#define GL_UNSIGNED_INT_IMAGE_2D 0x9063
+#define GL_UNSIGNED_INT_IMAGE_3D 0x9064
+#define GL_UNSIGNED_INT_IMAGE_2D_RECT 0x9065
+#define GL_UNSIGNED_INT_IMAGE_CUBE 0x9066
+#define GL_UNSIGNED_INT_IMAGE_BUFFER 0x9067
+#define GL_UNSIGNED_INT_IMAGE_1D_ARRAY 0x9068
+#define GL_UNSIGNED_INT_IMAGE_2D_ARRAY 0x9069
+#define GL_UNSIGNED_INT_IMAGE_CUBE_MAP_ARRAY 0x906A
+#define GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE 0x906B
+#define GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY 0x906C
+#define GL_MAX_IMAGE_SAMPLES 0x906D
+#define GL_IMAGE_BINDING_FORMAT 0x906E
+#define GL_IMAGE_FORMAT_COMPATIBILITY_TYPE 0x90C7
+#define GL_IMAGE_FORMAT_COMPATIBILITY_BY_SIZE 0x90C8
+#define GL_IMAGE_FORMAT_COMPATIBILITY_BY_CLASS 0x90C9
+#define GL_MAX_VERTEX_IMAGE_UNIFORMS 0x90CA
+#define GL_MAX_TESS_CONTROL_IMAGE_UNIFORMS 0x90CB
+#define GL_MAX_TESS_EVALUATION_IMAGE_UNIFORMS 0x90CC
+#define GL_MAX_GEOMETRY_IMAGE_UNIFORMS 0x90CD
+#define GL_MAX_FRAGMENT_IMAGE_UNIFORMS 0x90CE
+#define GL_MAX_COMBINED_IMAGE_UNIFORMS 0x90CF
+#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#define GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM 0x8E8D
+#define GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT 0x8E8E
+#define GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT 0x8E8F
+#define GL_TEXTURE_IMMUTABLE_FORMAT 0x912F
+#define GL_NUM_SHADING_LANGUAGE_VERSIONS 0x82E9
+#define GL_VERTEX_ATTRIB_ARRAY_LONG 0x874E
+#define GL_COMPRESSED_RGB8_ETC2 0x9274
+#define GL_COMPRESSED_SRGB8_ETC2 0x9275
+#define GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2 0x9276
+#define GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2 0x9277
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#define GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC 0x9279
+#define GL_COMPRESSED_R11_EAC 0x9270
+#define GL_COMPRESSED_SIGNED_R11_EAC 0x9271
+#define GL_COMPRESSED_RG11_EAC 0x9272
+#define GL_COMPRESSED_SIGNED_RG11_EAC 0x9273
+#define GL_PRIMITIVE_RESTART_FIXED_INDEX 0x8D69
+#define GL_ANY_SAMPLES_PASSED_CONSERVATIVE 0x8D6A
+#define GL_MAX_ELEMENT_INDEX 0x8D6B
+#define GL_COMPUTE_SHADER 0x91B9
+#define GL_MAX_COMPUTE_UNIFORM_BLOCKS 0x91BB
+#define GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS 0x91BC
+#define GL_MAX_COMPUTE_IMAGE_UNIFORMS 0x91BD
+#define GL_MAX_COMPUTE_SHARED_MEMORY_SIZE 0x8262
+#define GL_MAX_COMPUTE_UNIFORM_COMPONENTS 0x8263
+#define GL_MAX_COMPUTE_ATOMIC_COUNTER_BUFFERS 0x8264
+#define GL_MAX_COMPUTE_ATOMIC_COUNTERS 0x8265
+#define GL_MAX_COMBINED_COMPUTE_UNIFORM_COMPONENTS 0x8266
+#define GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS 0x90EB
+#define GL_MAX_COMPUTE_WORK_GROUP_COUNT 0x91BE
+#define GL_MAX_COMPUTE_WORK_GROUP_SIZE 0x91BF
+#define GL_COMPUTE_WORK_GROUP_SIZE 0x8267
+#define GL_UNIFORM_BLOCK_REFERENCED_BY_COMPUTE_SHADER 0x90EC
+#define GL_ATOMIC_COUNTER_BUFFER_REFERENCED_BY_COMPUTE_SHADER 0x90ED
+#define GL_DISPATCH_INDIRECT_BUFFER 0x90EE
+#define GL_DISPATCH_INDIRECT_BUFFER_BINDING 0x90EF
+#define GL_COMPUTE_SHADER_BIT 0x00000020
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
+#define GL_DEBUG_NEXT_LOGGED_MESSAGE_LENGTH 0x8243
+#define GL_DEBUG_CALLBACK_FUNCTION 0x8244
+#define GL_DEBUG_CALLBACK_USER_PARAM 0x8245
+#define GL_DEBUG_SOURCE_API 0x8246
+#define GL_DEBUG_SOURCE_WINDOW_SYSTEM 0x8247
+#define GL_DEBUG_SOURCE_SHADER_COMPILER 0x8248
+#define GL_DEBUG_SOURCE_THIRD_PARTY 0x8249
+#define GL_DEBUG_SOURCE_APPLICATION 0x824A
+#define GL_DEBUG_SOURCE_OTHER 0x824B
+#define GL_DEBUG_TYPE_ERROR 0x824C
+#define GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR 0x824D
+#define GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR 0x824E
+#define GL_DEBUG_TYPE_PORTABILITY 0x824F
+#define GL_DEBUG_TYPE_PERFORMANCE 0x8250
+#define GL_DEBUG_TYPE_OTHER 0x8251
+#define GL_MAX_DEBUG_MESSAGE_LENGTH 0x9143
+#define GL_MAX_DEBUG_LOGGED_MESSAGES 0x9144
+#define GL_DEBUG_LOGGED_MESSAGES 0x9145
+#define GL_DEBUG_SEVERITY_HIGH 0x9146
+#define GL_DEBUG_SEVERITY_MEDIUM 0x9147
+#define GL_DEBUG_SEVERITY_LOW 0x9148
+#define GL_DEBUG_TYPE_MARKER 0x8268
+#define GL_DEBUG_TYPE_PUSH_GROUP 0x8269
+#define GL_DEBUG_TYPE_POP_GROUP 0x826A
+#define GL_DEBUG_SEVERITY_NOTIFICATION 0x826B
+#define GL_MAX_DEBUG_GROUP_STACK_DEPTH 0x826C
+#define GL_DEBUG_GROUP_STACK_DEPTH 0x826D
+#define GL_BUFFER 0x82E0
+#define GL_SHADER 0x82E1
+#define GL_PROGRAM 0x82E2
+#define GL_QUERY 0x82E3
+#define GL_PROGRAM_PIPELINE 0x82E4
+#define GL_SAMPLER 0x82E6
+#define GL_MAX_LABEL_LENGTH 0x82E8
+#define GL_DEBUG_OUTPUT 0x92E0
+#define GL_CONTEXT_FLAG_DEBUG_BIT 0x00000002
+#define GL_MAX_UNIFORM_LOCATIONS 0x826E
+#define GL_FRAMEBUFFER_DEFAULT_WIDTH 0x9310
+#define GL_FRAMEBUFFER_DEFAULT_HEIGHT 0x9311
+#define GL_FRAMEBUFFER_DEFAULT_LAYERS 0x9312
+#define GL_FRAMEBUFFER_DEFAULT_SAMPLES 0x9313
+#define GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS 0x9314
+#define GL_MAX_FRAMEBUFFER_WIDTH 0x9315
+#define GL_MAX_FRAMEBUFFER_HEIGHT 0x9316
+#define GL_MAX_FRAMEBUFFER_LAYERS 0x9317
+#define GL_MAX_FRAMEBUFFER_SAMPLES 0x9318
+#define GL_INTERNALFORMAT_SUPPORTED 0x826F
+#define GL_INTERNALFORMAT_PREFERRED 0x8270
+#define GL_INTERNALFORMAT_RED_SIZE 0x8271
+#define GL_INTERNALFORMAT_GREEN_SIZE 0x8272
+#define GL_INTERNALFORMAT_BLUE_SIZE 0x8273
+#define GL_INTERNALFORMAT_ALPHA_SIZE 0x8274
+#define GL_INTERNALFORMAT_DEPTH_SIZE 0x8275
+#define GL_INTERNALFORMAT_STENCIL_SIZE 0x8276
+#define GL_INTERNALFORMAT_SHARED_SIZE 0x8277
+#define GL_INTERNALFORMAT_RED_TYPE 0x8278
+#define GL_INTERNALFORMAT_GREEN_TYPE 0x8279
+#define GL_INTERNALFORMAT_BLUE_TYPE 0x827A
+#define GL_INTERNALFORMAT_ALPHA_TYPE 0x827B
+#define GL_INTERNALFORMAT_DEPTH_TYPE 0x827C
+#define GL_INTERNALFORMAT_STENCIL_TYPE 0x827D
+#define GL_MAX_WIDTH 0x827E
+#define GL_MAX_HEIGHT 0x827F
+#define GL_MAX_DEPTH 0x8280
+#define GL_MAX_LAYERS 0x8281
+#define GL_MAX_COMBINED_DIMENSIONS 0x8282
+#define GL_COLOR_COMPONENTS 0x8283
+#define GL_DEPTH_COMPONENTS 0x8284
+#define GL_STENCIL_COMPONENTS 0x8285
+#define GL_COLOR_RENDERABLE 0x8286
+#define GL_DEPTH_RENDERABLE 0x8287
+#define GL_STENCIL_RENDERABLE 0x8288
+#define GL_FRAMEBUFFER_RENDERABLE 0x8289
+#define GL_FRAMEBUFFER_RENDERABLE_LAYERED 0x828A
+#define GL_FRAMEBUFFER_BLEND 0x828B
+#define GL_READ_PIXELS 0x828C
+#define GL_READ_PIXELS_FORMAT 0x828D
+#define GL_READ_PIXELS_TYPE 0x828E
+#define GL_TEXTURE_IMAGE_FORMAT 0x828F
+#define GL_TEXTURE_IMAGE_TYPE 0x8290
+#define GL_GET_TEXTURE_IMAGE_FORMAT 0x8291
+#define GL_GET_TEXTURE_IMAGE_TYPE 0x8292
+#define GL_MIPMAP 0x8293
+#define GL_MANUAL_GENERATE_MIPMAP 0x8294
+#define GL_AUTO_GENERATE_MIPMAP 0x8295
+#define GL_COLOR_ENCODING 0x8296
+#define GL_SRGB_READ 0x8297
+#define GL_SRGB_WRITE 0x8298
+#define GL_FILTER 0x829A
+#define GL_VERTEX_TEXTURE 0x829B
+#define GL_TESS_CONTROL_TEXTURE 0x829C
+#define GL_TESS_EVALUATION_TEXTURE 0x829D
+#define GL_GEOMETRY_TEXTURE 0x829E
+#define GL_FRAGMENT_TEXTURE 0x829F
+#define GL_COMPUTE_TEXTURE 0x82A0
+#define GL_TEXTURE_SHADOW 0x82A1
+#define GL_TEXTURE_GATHER 0x82A2
+#define GL_TEXTURE_GATHER_SHADOW 0x82A3
+#define GL_SHADER_IMAGE_LOAD 0x82A4
+#define GL_SHADER_IMAGE_STORE 0x82A5
+#define GL_SHADER_IMAGE_ATOMIC 0x82A6
+#define GL_IMAGE_TEXEL_SIZE 0x82A7
+#define GL_IMAGE_COMPATIBILITY_CLASS 0x82A8
+#define GL_IMAGE_PIXEL_FORMAT 0x82A9
+#define GL_IMAGE_PIXEL_TYPE 0x82AA
+#define GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_TEST 0x82AC
+#define GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_TEST 0x82AD
+#define GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_WRITE 0x82AE
+#define GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_WRITE 0x82AF
+#define GL_TEXTURE_COMPRESSED_BLOCK_WIDTH 0x82B1
+#define GL_TEXTURE_COMPRESSED_BLOCK_HEIGHT 0x82B2
+#define GL_TEXTURE_COMPRESSED_BLOCK_SIZE 0x82B3
+#define GL_CLEAR_BUFFER 0x82B4
+#define GL_TEXTURE_VIEW 0x82B5
+#define GL_VIEW_COMPATIBILITY_CLASS 0x82B6
+#define GL_FULL_SUPPORT 0x82B7
+#define GL_CAVEAT_SUPPORT 0x82B8
+#define GL_IMAGE_CLASS_4_X_32 0x82B9
+#define GL_IMAGE_CLASS_2_X_32 0x82BA
+#define GL_IMAGE_CLASS_1_X_32 0x82BB
+#define GL_IMAGE_CLASS_4_X_16 0x82BC
+#define GL_IMAGE_CLASS_2_X_16 0x82BD
+#define GL_IMAGE_CLASS_1_X_16 0x82BE
+#define GL_IMAGE_CLASS_4_X_8 0x82BF
+#define GL_IMAGE_CLASS_2_X_8 0x82C0
+#define GL_IMAGE_CLASS_1_X_8 0x82C1
+#define GL_IMAGE_CLASS_11_11_10 0x82C2
+#define GL_IMAGE_CLASS_10_10_10_2 0x82C3
+#define GL_VIEW_CLASS_128_BITS 0x82C4
+#define GL_VIEW_CLASS_96_BITS 0x82C5
+#define GL_VIEW_CLASS_64_BITS 0x82C6
+#define GL_VIEW_CLASS_48_BITS 0x82C7
+#define GL_VIEW_CLASS_32_BITS 0x82C8
+#define GL_VIEW_CLASS_24_BITS 0x82C9
+#define GL_VIEW_CLASS_16_BITS 0x82CA
+#define GL_VIEW_CLASS_8_BITS 0x82CB
+#define GL_VIEW_CLASS_S3TC_DXT1_RGB 0x82CC
+#define GL_VIEW_CLASS_S3TC_DXT1_RGBA 0x82CD
+#define GL_VIEW_CLASS_S3TC_DXT3_RGBA 0x82CE
+#define GL_VIEW_CLASS_S3TC_DXT5_RGBA 0x82CF
+#define GL_VIEW_CLASS_RGTC1_RED 0x82D0
+#define GL_VIEW_CLASS_RGTC2_RG 0x82D1
+#define GL_VIEW_CLASS_BPTC_UNORM 0x82D2
+#define GL_VIEW_CLASS_BPTC_FLOAT 0x82D3
+#define GL_UNIFORM 0x92E1
+#define GL_UNIFORM_BLOCK 0x92E2
+#define GL_PROGRAM_INPUT 0x92E3
+#define GL_PROGRAM_OUTPUT 0x92E4
+#define GL_BUFFER_VARIABLE 0x92E5
+#define GL_SHADER_STORAGE_BLOCK 0x92E6
+#define GL_VERTEX_SUBROUTINE 0x92E8
+#define GL_TESS_CONTROL_SUBROUTINE 0x92E9
+#define GL_TESS_EVALUATION_SUBROUTINE 0x92EA
+#define GL_GEOMETRY_SUBROUTINE 0x92EB
+#define GL_FRAGMENT_SUBROUTINE 0x92EC
+#define GL_COMPUTE_SUBROUTINE 0x92ED
+#define GL_VERTEX_SUBROUTINE_UNIFORM 0x92EE
+#define GL_TESS_CONTROL_SUBROUTINE_UNIFORM 0x92EF
+#define GL_TESS_EVALUATION_SUBROUTINE_UNIFORM 0x92F0
+#define GL_GEOMETRY_SUBROUTINE_UNIFORM 0x92F1
+#define GL_FRAGMENT_SUBROUTINE_UNIFORM 0x92F2
+#define GL_COMPUTE_SUBROUTINE_UNIFORM 0x92F3
+#define GL_TRANSFORM_FEEDBACK_VARYING 0x92F4
+#define GL_ACTIVE_RESOURCES 0x92F5
+#define GL_MAX_NAME_LENGTH 0x92F6
+#define GL_MAX_NUM_ACTIVE_VARIABLES 0x92F7
+#define GL_MAX_NUM_COMPATIBLE_SUBROUTINES 0x92F8
+#define GL_NAME_LENGTH 0x92F9
+#define GL_TYPE 0x92FA
+#define GL_ARRAY_SIZE 0x92FB
+#define GL_OFFSET 0x92FC
+#define GL_BLOCK_INDEX 0x92FD
+#define GL_ARRAY_STRIDE 0x92FE
+#define GL_MATRIX_STRIDE 0x92FF
+#define GL_IS_ROW_MAJOR 0x9300
+#define GL_ATOMIC_COUNTER_BUFFER_INDEX 0x9301
+#define GL_BUFFER_BINDING 0x9302
+#define GL_BUFFER_DATA_SIZE 0x9303
+#define GL_NUM_ACTIVE_VARIABLES 0x9304
+#define GL_ACTIVE_VARIABLES 0x9305
+#define GL_REFERENCED_BY_VERTEX_SHADER 0x9306
+#define GL_REFERENCED_BY_TESS_CONTROL_SHADER 0x9307
+#define GL_REFERENCED_BY_TESS_EVALUATION_SHADER 0x9308
+#define GL_REFERENCED_BY_GEOMETRY_SHADER 0x9309
+#define GL_REFERENCED_BY_FRAGMENT_SHADER 0x930A
+#define GL_REFERENCED_BY_COMPUTE_SHADER 0x930B
+#define GL_TOP_LEVEL_ARRAY_SIZE 0x930C
+#define GL_TOP_LEVEL_ARRAY_STRIDE 0x930D
+#define GL_LOCATION 0x930E
+#define GL_LOCATION_INDEX 0x930F
+#define GL_IS_PER_PATCH 0x92E7
+#define GL_SHADER_STORAGE_BUFFER 0x90D2
+#define GL_SHADER_STORAGE_BUFFER_BINDING 0x90D3
+#define GL_SHADER_STORAGE_BUFFER_START 0x90D4
+#define GL_SHADER_STORAGE_BUFFER_SIZE 0x90D5
+#define GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS 0x90D6
+#define GL_MAX_GEOMETRY_SHADER_STORAGE_BLOCKS 0x90D7
+#define GL_MAX_TESS_CONTROL_SHADER_STORAGE_BLOCKS 0x90D8
+#define GL_MAX_TESS_EVALUATION_SHADER_STORAGE_BLOCKS 0x90D9
+#define GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS 0x90DA
+#define GL_MAX_COMPUTE_SHADER_STORAGE_BLOCKS 0x90DB
+#define GL_MAX_COMBINED_SHADER_STORAGE_BLOCKS 0x90DC
+#define GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS 0x90DD
+#define GL_MAX_SHADER_STORAGE_BLOCK_SIZE 0x90DE
+#define GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT 0x90DF
+#define GL_SHADER_STORAGE_BARRIER_BIT 0x00002000
+#define GL_MAX_COMBINED_SHADER_OUTPUT_RESOURCES 0x8F39
+#define GL_DEPTH_STENCIL_TEXTURE_MODE 0x90EA
+#define GL_TEXTURE_BUFFER_OFFSET 0x919D
+#define GL_TEXTURE_BUFFER_SIZE 0x919E
+#define GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT 0x919F
+#define GL_TEXTURE_VIEW_MIN_LEVEL 0x82DB
+#define GL_TEXTURE_VIEW_NUM_LEVELS 0x82DC
+#define GL_TEXTURE_VIEW_MIN_LAYER 0x82DD
+#define GL_TEXTURE_VIEW_NUM_LAYERS 0x82DE
+#define GL_TEXTURE_IMMUTABLE_LEVELS 0x82DF
+#define GL_VERTEX_ATTRIB_BINDING 0x82D4
+#define GL_VERTEX_ATTRIB_RELATIVE_OFFSET 0x82D5
+#define GL_VERTEX_BINDING_DIVISOR 0x82D6
+#define GL_VERTEX_BINDING_OFFSET 0x82D7
+#define GL_VERTEX_BINDING_STRIDE 0x82D8
+#define GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET 0x82D9
+#define GL_MAX_VERTEX_ATTRIB_BINDINGS 0x82DA
+#define GL_VERTEX_BINDING_BUFFER 0x8F4F
+#define GL_MAX_VERTEX_ATTRIB_STRIDE 0x82E5
+#define GL_PRIMITIVE_RESTART_FOR_PATCHES_SUPPORTED 0x8221
+#define GL_TEXTURE_BUFFER_BINDING 0x8C2A
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
+#define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
+#define GL_BUFFER_STORAGE_FLAGS 0x8220
+#define GL_CLEAR_TEXTURE 0x9365
+#define GL_LOCATION_COMPONENT 0x934A
+#define GL_TRANSFORM_FEEDBACK_BUFFER_INDEX 0x934B
+#define GL_TRANSFORM_FEEDBACK_BUFFER_STRIDE 0x934C
+#define GL_QUERY_BUFFER 0x9192
+#define GL_QUERY_BUFFER_BARRIER_BIT 0x00008000
+#define GL_QUERY_BUFFER_BINDING 0x9193
+#define GL_QUERY_RESULT_NO_WAIT 0x9194
+#define GL_MIRROR_CLAMP_TO_EDGE 0x8743
+#define GL_CONTEXT_LOST 0x0507
+#define GL_NEGATIVE_ONE_TO_ONE 0x935E
+#define GL_ZERO_TO_ONE 0x935F
+#define GL_CLIP_ORIGIN 0x935C
+#define GL_CLIP_DEPTH_MODE 0x935D
+#define GL_QUERY_WAIT_INVERTED 0x8E17
+#define GL_QUERY_NO_WAIT_INVERTED 0x8E18
+#define GL_QUERY_BY_REGION_WAIT_INVERTED 0x8E19
+#define GL_QUERY_BY_REGION_NO_WAIT_INVERTED 0x8E1A
+#define GL_MAX_CULL_DISTANCES 0x82F9
+#define GL_MAX_COMBINED_CLIP_AND_CULL_DISTANCES 0x82FA
+#define GL_TEXTURE_TARGET 0x1006
+#define GL_QUERY_TARGET 0x82EA
+#define GL_GUILTY_CONTEXT_RESET 0x8253
+#define GL_INNOCENT_CONTEXT_RESET 0x8254
+#define GL_UNKNOWN_CONTEXT_RESET 0x8255
+#define GL_RESET_NOTIFICATION_STRATEGY 0x8256
+#define GL_LOSE_CONTEXT_ON_RESET 0x8252
+#define GL_NO_RESET_NOTIFICATION 0x8261
+#define GL_CONTEXT_FLAG_ROBUST_ACCESS_BIT 0x00000004
+#define GL_CONTEXT_RELEASE_BEHAVIOR 0x82FB
+#define GL_CONTEXT_RELEASE_BEHAVIOR_FLUSH 0x82FC
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
 #ifndef GL_VERSION_1_0
 #define GL_VERSION_1_0 1
 GLAPI int GLAD_GL_VERSION_1_0;
@@ -2121,6 +2737,3098 @@ typedef void (APIENTRYP PFNGLSECONDARYCOLORP3UIVPROC)(GLenum type, const GLuint
 GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
 #define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv
 #endif
+#ifndef GL_VERSION_4_0
+#define GL_VERSION_4_0 1
+GLAPI int GLAD_GL_VERSION_4_0;
+typedef void (APIENTRYP PFNGLMINSAMPLESHADINGPROC)(GLfloat value);
+GLAPI PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading;
+#define glMinSampleShading glad_glMinSampleShading
+typedef void (APIENTRYP PFNGLBLENDEQUATIONIPROC)(GLuint buf, GLenum mode);
+GLAPI PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi;
+#define glBlendEquationi glad_glBlendEquationi
+typedef void (APIENTRYP PFNGLBLENDEQUATIONSEPARATEIPROC)(GLuint buf, GLenum modeRGB, GLenum modeAlpha);
+GLAPI PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei;
+#define glBlendEquationSeparatei glad_glBlendEquationSeparatei
+typedef void (APIENTRYP PFNGLBLENDFUNCIPROC)(GLuint buf, GLenum src, GLenum dst);
+GLAPI PFNGLBLENDFUNCIPROC glad_glBlendFunci;
+#define glBlendFunci glad_glBlendFunci
+typedef void (APIENTRYP PFNGLBLENDFUNCSEPARATEIPROC)(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+GLAPI PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei;
+#define glBlendFuncSeparatei glad_glBlendFuncSeparatei
+typedef void (APIENTRYP PFNGLDRAWARRAYSINDIRECTPROC)(GLenum mode, const void *indirect);
+GLAPI PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect;
+#define glDrawArraysIndirect glad_glDrawArraysIndirect
+typedef void (APIENTRYP PFNGLDRAWELEMENTSINDIRECTPROC)(GLenum mode, GLenum type, const void *indirect);
+GLAPI PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect;
+#define glDrawElementsIndirect glad_glDrawElementsIndirect
+typedef void (APIENTRYP PFNGLUNIFORM1DPROC)(GLint location, GLdouble x);
+GLAPI PFNGLUNIFORM1DPROC glad_glUniform1d;
+#define glUniform1d glad_glUniform1d
+typedef void (APIENTRYP PFNGLUNIFORM2DPROC)(GLint location, GLdouble x, GLdouble y);
+GLAPI PFNGLUNIFORM2DPROC glad_glUniform2d;
+#define glUniform2d glad_glUniform2d
+typedef void (APIENTRYP PFNGLUNIFORM3DPROC)(GLint location, GLdouble x, GLdouble y, GLdouble z);
+GLAPI PFNGLUNIFORM3DPROC glad_glUniform3d;
+#define glUniform3d glad_glUniform3d
+typedef void (APIENTRYP PFNGLUNIFORM4DPROC)(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+GLAPI PFNGLUNIFORM4DPROC glad_glUniform4d;
+#define glUniform4d glad_glUniform4d
+typedef void (APIENTRYP PFNGLUNIFORM1DVPROC)(GLint location, GLsizei count, const GLdouble *value);
+GLAPI PFNGLUNIFORM1DVPROC glad_glUniform1dv;
+#define glUniform1dv glad_glUniform1dv
+typedef void (APIENTRYP PFNGLUNIFORM2DVPROC)(GLint location, GLsizei count, const GLdouble *value);
+GLAPI PFNGLUNIFORM2DVPROC glad_glUniform2dv;
+#define glUniform2dv glad_glUniform2dv
+typedef void (APIENTRYP PFNGLUNIFORM3DVPROC)(GLint location, GLsizei count, const GLdouble *value);
+GLAPI PFNGLUNIFORM3DVPROC glad_glUniform3dv;
+#define glUniform3dv glad_glUniform3dv
+typedef void (APIENTRYP PFNGLUNIFORM4DVPROC)(GLint location, GLsizei count, const GLdouble *value);
+GLAPI PFNGLUNIFORM4DVPROC glad_glUniform4dv;
+#define glUniform4dv glad_glUniform4dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX2DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv;
+#define glUniformMatrix2dv glad_glUniformMatrix2dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX3DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv;
+#define glUniformMatrix3dv glad_glUniformMatrix3dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX4DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv;
+#define glUniformMatrix4dv glad_glUniformMatrix4dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX2X3DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv;
+#define glUniformMatrix2x3dv glad_glUniformMatrix2x3dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX2X4DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv;
+#define glUniformMatrix2x4dv glad_glUniformMatrix2x4dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX3X2DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv;
+#define glUniformMatrix3x2dv glad_glUniformMatrix3x2dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX3X4DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv;
+#define glUniformMatrix3x4dv glad_glUniformMatrix3x4dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX4X2DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv;
+#define glUniformMatrix4x2dv glad_glUniformMatrix4x2dv
+typedef void (APIENTRYP PFNGLUNIFORMMATRIX4X3DVPROC)(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv;
+#define glUniformMatrix4x3dv glad_glUniformMatrix4x3dv
+typedef void (APIENTRYP PFNGLGETUNIFORMDVPROC)(GLuint program, GLint location, GLdouble *params);
+GLAPI PFNGLGETUNIFORMDVPROC glad_glGetUniformdv;
+#define glGetUniformdv glad_glGetUniformdv
+typedef GLint (APIENTRYP PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)(GLuint program, GLenum shadertype, const GLchar *name);
+GLAPI PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation;
+#define glGetSubroutineUniformLocation glad_glGetSubroutineUniformLocation
+typedef GLuint (APIENTRYP PFNGLGETSUBROUTINEINDEXPROC)(GLuint program, GLenum shadertype, const GLchar *name);
+GLAPI PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex;
+#define glGetSubroutineIndex glad_glGetSubroutineIndex
+typedef void (APIENTRYP PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values);
+GLAPI PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv;
+#define glGetActiveSubroutineUniformiv glad_glGetActiveSubroutineUniformiv
+typedef void (APIENTRYP PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name);
+GLAPI PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName;
+#define glGetActiveSubroutineUniformName glad_glGetActiveSubroutineUniformName
+typedef void (APIENTRYP PFNGLGETACTIVESUBROUTINENAMEPROC)(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name);
+GLAPI PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName;
+#define glGetActiveSubroutineName glad_glGetActiveSubroutineName
+typedef void (APIENTRYP PFNGLUNIFORMSUBROUTINESUIVPROC)(GLenum shadertype, GLsizei count, const GLuint *indices);
+GLAPI PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv;
+#define glUniformSubroutinesuiv glad_glUniformSubroutinesuiv
+typedef void (APIENTRYP PFNGLGETUNIFORMSUBROUTINEUIVPROC)(GLenum shadertype, GLint location, GLuint *params);
+GLAPI PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv;
+#define glGetUniformSubroutineuiv glad_glGetUniformSubroutineuiv
+typedef void (APIENTRYP PFNGLGETPROGRAMSTAGEIVPROC)(GLuint program, GLenum shadertype, GLenum pname, GLint *values);
+GLAPI PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv;
+#define glGetProgramStageiv glad_glGetProgramStageiv
+typedef void (APIENTRYP PFNGLPATCHPARAMETERIPROC)(GLenum pname, GLint value);
+GLAPI PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri;
+#define glPatchParameteri glad_glPatchParameteri
+typedef void (APIENTRYP PFNGLPATCHPARAMETERFVPROC)(GLenum pname, const GLfloat *values);
+GLAPI PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv;
+#define glPatchParameterfv glad_glPatchParameterfv
+typedef void (APIENTRYP PFNGLBINDTRANSFORMFEEDBACKPROC)(GLenum target, GLuint id);
+GLAPI PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback;
+#define glBindTransformFeedback glad_glBindTransformFeedback
+typedef void (APIENTRYP PFNGLDELETETRANSFORMFEEDBACKSPROC)(GLsizei n, const GLuint *ids);
+GLAPI PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks;
+#define glDeleteTransformFeedbacks glad_glDeleteTransformFeedbacks
+typedef void (APIENTRYP PFNGLGENTRANSFORMFEEDBACKSPROC)(GLsizei n, GLuint *ids);
+GLAPI PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks;
+#define glGenTransformFeedbacks glad_glGenTransformFeedbacks
+typedef GLboolean (APIENTRYP PFNGLISTRANSFORMFEEDBACKPROC)(GLuint id);
+GLAPI PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback;
+#define glIsTransformFeedback glad_glIsTransformFeedback
+typedef void (APIENTRYP PFNGLPAUSETRANSFORMFEEDBACKPROC)(void);
+GLAPI PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback;
+#define glPauseTransformFeedback glad_glPauseTransformFeedback
+typedef void (APIENTRYP PFNGLRESUMETRANSFORMFEEDBACKPROC)(void);
+GLAPI PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback;
+#define glResumeTransformFeedback glad_glResumeTransformFeedback
+typedef void (APIENTRYP PFNGLDRAWTRANSFORMFEEDBACKPROC)(GLenum mode, GLuint id);
+GLAPI PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback;
+#define glDrawTransformFeedback glad_glDrawTransformFeedback
+typedef void (APIENTRYP PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)(GLenum mode, GLuint id, GLuint stream);
+GLAPI PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream;
+#define glDrawTransformFeedbackStream glad_glDrawTransformFeedbackStream
+typedef void (APIENTRYP PFNGLBEGINQUERYINDEXEDPROC)(GLenum target, GLuint index, GLuint id);
+GLAPI PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed;
+#define glBeginQueryIndexed glad_glBeginQueryIndexed
+typedef void (APIENTRYP PFNGLENDQUERYINDEXEDPROC)(GLenum target, GLuint index);
+GLAPI PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed;
+#define glEndQueryIndexed glad_glEndQueryIndexed
+typedef void (APIENTRYP PFNGLGETQUERYINDEXEDIVPROC)(GLenum target, GLuint index, GLenum pname, GLint *params);
+GLAPI PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv;
+#define glGetQueryIndexediv glad_glGetQueryIndexediv
+#endif
+#ifndef GL_VERSION_4_1
+#define GL_VERSION_4_1 1
+GLAPI int GLAD_GL_VERSION_4_1;
+typedef void (APIENTRYP PFNGLRELEASESHADERCOMPILERPROC)(void);
+GLAPI PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler;
+#define glReleaseShaderCompiler glad_glReleaseShaderCompiler
+typedef void (APIENTRYP PFNGLSHADERBINARYPROC)(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length);
+GLAPI PFNGLSHADERBINARYPROC glad_glShaderBinary;
+#define glShaderBinary glad_glShaderBinary
+typedef void (APIENTRYP PFNGLGETSHADERPRECISIONFORMATPROC)(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision);
+GLAPI PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat;
+#define glGetShaderPrecisionFormat glad_glGetShaderPrecisionFormat
+typedef void (APIENTRYP PFNGLDEPTHRANGEFPROC)(GLfloat n, GLfloat f);
+GLAPI PFNGLDEPTHRANGEFPROC glad_glDepthRangef;
+#define glDepthRangef glad_glDepthRangef
+typedef void (APIENTRYP PFNGLCLEARDEPTHFPROC)(GLfloat d);
+GLAPI PFNGLCLEARDEPTHFPROC glad_glClearDepthf;
+#define glClearDepthf glad_glClearDepthf
+typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+GLAPI PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary;
+#define glGetProgramBinary glad_glGetProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+GLAPI PFNGLPROGRAMBINARYPROC glad_glProgramBinary;
+#define glProgramBinary glad_glProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+GLAPI PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri;
+#define glProgramParameteri glad_glProgramParameteri
+typedef void (APIENTRYP PFNGLUSEPROGRAMSTAGESPROC)(GLuint pipeline, GLbitfield stages, GLuint program);
+GLAPI PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages;
+#define glUseProgramStages glad_glUseProgramStages
+typedef void (APIENTRYP PFNGLACTIVESHADERPROGRAMPROC)(GLuint pipeline, GLuint program);
+GLAPI PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram;
+#define glActiveShaderProgram glad_glActiveShaderProgram
+typedef GLuint (APIENTRYP PFNGLCREATESHADERPROGRAMVPROC)(GLenum type, GLsizei count, const GLchar *const*strings);
+GLAPI PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv;
+#define glCreateShaderProgramv glad_glCreateShaderProgramv
+typedef void (APIENTRYP PFNGLBINDPROGRAMPIPELINEPROC)(GLuint pipeline);
+GLAPI PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline;
+#define glBindProgramPipeline glad_glBindProgramPipeline
+typedef void (APIENTRYP PFNGLDELETEPROGRAMPIPELINESPROC)(GLsizei n, const GLuint *pipelines);
+GLAPI PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines;
+#define glDeleteProgramPipelines glad_glDeleteProgramPipelines
+typedef void (APIENTRYP PFNGLGENPROGRAMPIPELINESPROC)(GLsizei n, GLuint *pipelines);
+GLAPI PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines;
+#define glGenProgramPipelines glad_glGenProgramPipelines
+typedef GLboolean (APIENTRYP PFNGLISPROGRAMPIPELINEPROC)(GLuint pipeline);
+GLAPI PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline;
+#define glIsProgramPipeline glad_glIsProgramPipeline
+typedef void (APIENTRYP PFNGLGETPROGRAMPIPELINEIVPROC)(GLuint pipeline, GLenum pname, GLint *params);
+GLAPI PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv;
+#define glGetProgramPipelineiv glad_glGetProgramPipelineiv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM1IPROC)(GLuint program, GLint location, GLint v0);
+GLAPI PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i;
+#define glProgramUniform1i glad_glProgramUniform1i
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM1IVPROC)(GLuint program, GLint location, GLsizei count, const GLint *value);
+GLAPI PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv;
+#define glProgramUniform1iv glad_glProgramUniform1iv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM1FPROC)(GLuint program, GLint location, GLfloat v0);
+GLAPI PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f;
+#define glProgramUniform1f glad_glProgramUniform1f
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM1FVPROC)(GLuint program, GLint location, GLsizei count, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv;
+#define glProgramUniform1fv glad_glProgramUniform1fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM1DPROC)(GLuint program, GLint location, GLdouble v0);
+GLAPI PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d;
+#define glProgramUniform1d glad_glProgramUniform1d
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM1DVPROC)(GLuint program, GLint location, GLsizei count, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv;
+#define glProgramUniform1dv glad_glProgramUniform1dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM1UIPROC)(GLuint program, GLint location, GLuint v0);
+GLAPI PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui;
+#define glProgramUniform1ui glad_glProgramUniform1ui
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM1UIVPROC)(GLuint program, GLint location, GLsizei count, const GLuint *value);
+GLAPI PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv;
+#define glProgramUniform1uiv glad_glProgramUniform1uiv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM2IPROC)(GLuint program, GLint location, GLint v0, GLint v1);
+GLAPI PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i;
+#define glProgramUniform2i glad_glProgramUniform2i
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM2IVPROC)(GLuint program, GLint location, GLsizei count, const GLint *value);
+GLAPI PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv;
+#define glProgramUniform2iv glad_glProgramUniform2iv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM2FPROC)(GLuint program, GLint location, GLfloat v0, GLfloat v1);
+GLAPI PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f;
+#define glProgramUniform2f glad_glProgramUniform2f
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM2FVPROC)(GLuint program, GLint location, GLsizei count, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv;
+#define glProgramUniform2fv glad_glProgramUniform2fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM2DPROC)(GLuint program, GLint location, GLdouble v0, GLdouble v1);
+GLAPI PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d;
+#define glProgramUniform2d glad_glProgramUniform2d
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM2DVPROC)(GLuint program, GLint location, GLsizei count, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv;
+#define glProgramUniform2dv glad_glProgramUniform2dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM2UIPROC)(GLuint program, GLint location, GLuint v0, GLuint v1);
+GLAPI PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui;
+#define glProgramUniform2ui glad_glProgramUniform2ui
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM2UIVPROC)(GLuint program, GLint location, GLsizei count, const GLuint *value);
+GLAPI PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv;
+#define glProgramUniform2uiv glad_glProgramUniform2uiv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM3IPROC)(GLuint program, GLint location, GLint v0, GLint v1, GLint v2);
+GLAPI PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i;
+#define glProgramUniform3i glad_glProgramUniform3i
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM3IVPROC)(GLuint program, GLint location, GLsizei count, const GLint *value);
+GLAPI PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv;
+#define glProgramUniform3iv glad_glProgramUniform3iv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM3FPROC)(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+GLAPI PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f;
+#define glProgramUniform3f glad_glProgramUniform3f
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM3FVPROC)(GLuint program, GLint location, GLsizei count, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv;
+#define glProgramUniform3fv glad_glProgramUniform3fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM3DPROC)(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2);
+GLAPI PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d;
+#define glProgramUniform3d glad_glProgramUniform3d
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM3DVPROC)(GLuint program, GLint location, GLsizei count, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv;
+#define glProgramUniform3dv glad_glProgramUniform3dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM3UIPROC)(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2);
+GLAPI PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui;
+#define glProgramUniform3ui glad_glProgramUniform3ui
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM3UIVPROC)(GLuint program, GLint location, GLsizei count, const GLuint *value);
+GLAPI PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv;
+#define glProgramUniform3uiv glad_glProgramUniform3uiv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM4IPROC)(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
+GLAPI PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i;
+#define glProgramUniform4i glad_glProgramUniform4i
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM4IVPROC)(GLuint program, GLint location, GLsizei count, const GLint *value);
+GLAPI PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv;
+#define glProgramUniform4iv glad_glProgramUniform4iv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM4FPROC)(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+GLAPI PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f;
+#define glProgramUniform4f glad_glProgramUniform4f
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM4FVPROC)(GLuint program, GLint location, GLsizei count, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv;
+#define glProgramUniform4fv glad_glProgramUniform4fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM4DPROC)(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3);
+GLAPI PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d;
+#define glProgramUniform4d glad_glProgramUniform4d
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM4DVPROC)(GLuint program, GLint location, GLsizei count, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv;
+#define glProgramUniform4dv glad_glProgramUniform4dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM4UIPROC)(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3);
+GLAPI PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui;
+#define glProgramUniform4ui glad_glProgramUniform4ui
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORM4UIVPROC)(GLuint program, GLint location, GLsizei count, const GLuint *value);
+GLAPI PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv;
+#define glProgramUniform4uiv glad_glProgramUniform4uiv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX2FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv;
+#define glProgramUniformMatrix2fv glad_glProgramUniformMatrix2fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX3FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv;
+#define glProgramUniformMatrix3fv glad_glProgramUniformMatrix3fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX4FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv;
+#define glProgramUniformMatrix4fv glad_glProgramUniformMatrix4fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX2DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv;
+#define glProgramUniformMatrix2dv glad_glProgramUniformMatrix2dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX3DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv;
+#define glProgramUniformMatrix3dv glad_glProgramUniformMatrix3dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX4DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv;
+#define glProgramUniformMatrix4dv glad_glProgramUniformMatrix4dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv;
+#define glProgramUniformMatrix2x3fv glad_glProgramUniformMatrix2x3fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv;
+#define glProgramUniformMatrix3x2fv glad_glProgramUniformMatrix3x2fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv;
+#define glProgramUniformMatrix2x4fv glad_glProgramUniformMatrix2x4fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv;
+#define glProgramUniformMatrix4x2fv glad_glProgramUniformMatrix4x2fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv;
+#define glProgramUniformMatrix3x4fv glad_glProgramUniformMatrix3x4fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv;
+#define glProgramUniformMatrix4x3fv glad_glProgramUniformMatrix4x3fv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv;
+#define glProgramUniformMatrix2x3dv glad_glProgramUniformMatrix2x3dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv;
+#define glProgramUniformMatrix3x2dv glad_glProgramUniformMatrix3x2dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv;
+#define glProgramUniformMatrix2x4dv glad_glProgramUniformMatrix2x4dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv;
+#define glProgramUniformMatrix4x2dv glad_glProgramUniformMatrix4x2dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv;
+#define glProgramUniformMatrix3x4dv glad_glProgramUniformMatrix3x4dv
+typedef void (APIENTRYP PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value);
+GLAPI PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv;
+#define glProgramUniformMatrix4x3dv glad_glProgramUniformMatrix4x3dv
+typedef void (APIENTRYP PFNGLVALIDATEPROGRAMPIPELINEPROC)(GLuint pipeline);
+GLAPI PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline;
+#define glValidateProgramPipeline glad_glValidateProgramPipeline
+typedef void (APIENTRYP PFNGLGETPROGRAMPIPELINEINFOLOGPROC)(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+GLAPI PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog;
+#define glGetProgramPipelineInfoLog glad_glGetProgramPipelineInfoLog
+typedef void (APIENTRYP PFNGLVERTEXATTRIBL1DPROC)(GLuint index, GLdouble x);
+GLAPI PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d;
+#define glVertexAttribL1d glad_glVertexAttribL1d
+typedef void (APIENTRYP PFNGLVERTEXATTRIBL2DPROC)(GLuint index, GLdouble x, GLdouble y);
+GLAPI PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d;
+#define glVertexAttribL2d glad_glVertexAttribL2d
+typedef void (APIENTRYP PFNGLVERTEXATTRIBL3DPROC)(GLuint index, GLdouble x, GLdouble y, GLdouble z);
+GLAPI PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d;
+#define glVertexAttribL3d glad_glVertexAttribL3d
+typedef void (APIENTRYP PFNGLVERTEXATTRIBL4DPROC)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+GLAPI PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d;
+#define glVertexAttribL4d glad_glVertexAttribL4d
+typedef void (APIENTRYP PFNGLVERTEXATTRIBL1DVPROC)(GLuint index, const GLdouble *v);
+GLAPI PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv;
+#define glVertexAttribL1dv glad_glVertexAttribL1dv
+typedef void (APIENTRYP PFNGLVERTEXATTRIBL2DVPROC)(GLuint index, const GLdouble *v);
+GLAPI PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv;
+#define glVertexAttribL2dv glad_glVertexAttribL2dv
+typedef void (APIENTRYP PFNGLVERTEXATTRIBL3DVPROC)(GLuint index, const GLdouble *v);
+GLAPI PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv;
+#define glVertexAttribL3dv glad_glVertexAttribL3dv
+typedef void (APIENTRYP PFNGLVERTEXATTRIBL4DVPROC)(GLuint index, const GLdouble *v);
+GLAPI PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv;
+#define glVertexAttribL4dv glad_glVertexAttribL4dv
+typedef void (APIENTRYP PFNGLVERTEXATTRIBLPOINTERPROC)(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
+GLAPI PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer;
+#define glVertexAttribLPointer glad_glVertexAttribLPointer
+typedef void (APIENTRYP PFNGLGETVERTEXATTRIBLDVPROC)(GLuint index, GLenum pname, GLdouble *params);
+GLAPI PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv;
+#define glGetVertexAttribLdv glad_glGetVertexAttribLdv
+typedef void (APIENTRYP PFNGLVIEWPORTARRAYVPROC)(GLuint first, GLsizei count, const GLfloat *v);
+GLAPI PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv;
+#define glViewportArrayv glad_glViewportArrayv
+typedef void (APIENTRYP PFNGLVIEWPORTINDEXEDFPROC)(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h);
+GLAPI PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf;
+#define glViewportIndexedf glad_glViewportIndexedf
+typedef void (APIENTRYP PFNGLVIEWPORTINDEXEDFVPROC)(GLuint index, const GLfloat *v);
+GLAPI PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv;
+#define glViewportIndexedfv glad_glViewportIndexedfv
+typedef void (APIENTRYP PFNGLSCISSORARRAYVPROC)(GLuint first, GLsizei count, const GLint *v);
+GLAPI PFNGLSCISSORARRAYVPROC glad_glScissorArrayv;
+#define glScissorArrayv glad_glScissorArrayv
+typedef void (APIENTRYP PFNGLSCISSORINDEXEDPROC)(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height);
+GLAPI PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed;
+#define glScissorIndexed glad_glScissorIndexed
+typedef void (APIENTRYP PFNGLSCISSORINDEXEDVPROC)(GLuint index, const GLint *v);
+GLAPI PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv;
+#define glScissorIndexedv glad_glScissorIndexedv
+typedef void (APIENTRYP PFNGLDEPTHRANGEARRAYVPROC)(GLuint first, GLsizei count, const GLdouble *v);
+GLAPI PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv;
+#define glDepthRangeArrayv glad_glDepthRangeArrayv
+typedef void (APIENTRYP PFNGLDEPTHRANGEINDEXEDPROC)(GLuint index, GLdouble n, GLdouble f);
+GLAPI PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed;
+#define glDepthRangeIndexed glad_glDepthRangeIndexed
+typedef void (APIENTRYP PFNGLGETFLOATI_VPROC)(GLenum target, GLuint index, GLfloat *data);
+GLAPI PFNGLGETFLOATI_VPROC glad_glGetFloati_v;
+#define glGetFloati_v glad_glGetFloati_v
+typedef void (APIENTRYP PFNGLGETDOUBLEI_VPROC)(GLenum target, GLuint index, GLdouble *data);
+GLAPI PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v;
+#define glGetDoublei_v glad_glGetDoublei_v
+#endif
+#ifndef GL_VERSION_4_2
+#define GL_VERSION_4_2 1
+GLAPI int GLAD_GL_VERSION_4_2;
+typedef void (APIENTRYP PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance);
+GLAPI PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance;
+#define glDrawArraysInstancedBaseInstance glad_glDrawArraysInstancedBaseInstance
+typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance);
+GLAPI PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance;
+#define glDrawElementsInstancedBaseInstance glad_glDrawElementsInstancedBaseInstance
+typedef void (APIENTRYP PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance);
+GLAPI PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance;
+#define glDrawElementsInstancedBaseVertexBaseInstance glad_glDrawElementsInstancedBaseVertexBaseInstance
+typedef void (APIENTRYP PFNGLGETINTERNALFORMATIVPROC)(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params);
+GLAPI PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ;
+#define glGetInternalformativ glad_glGetInternalformativ
+typedef void (APIENTRYP PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params);
+GLAPI PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv;
+#define glGetActiveAtomicCounterBufferiv glad_glGetActiveAtomicCounterBufferiv
+typedef void (APIENTRYP PFNGLBINDIMAGETEXTUREPROC)(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format);
+GLAPI PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture;
+#define glBindImageTexture glad_glBindImageTexture
+typedef void (APIENTRYP PFNGLMEMORYBARRIERPROC)(GLbitfield barriers);
+GLAPI PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier;
+#define glMemoryBarrier glad_glMemoryBarrier
+typedef void (APIENTRYP PFNGLTEXSTORAGE1DPROC)(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width);
+GLAPI PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D;
+#define glTexStorage1D glad_glTexStorage1D
+typedef void (APIENTRYP PFNGLTEXSTORAGE2DPROC)(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+GLAPI PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D;
+#define glTexStorage2D glad_glTexStorage2D
+typedef void (APIENTRYP PFNGLTEXSTORAGE3DPROC)(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth);
+GLAPI PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D;
+#define glTexStorage3D glad_glTexStorage3D
+typedef void (APIENTRYP PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)(GLenum mode, GLuint id, GLsizei instancecount);
+GLAPI PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced;
+#define glDrawTransformFeedbackInstanced glad_glDrawTransformFeedbackInstanced
+typedef void (APIENTRYP PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount);
+GLAPI PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced;
+#define glDrawTransformFeedbackStreamInstanced glad_glDrawTransformFeedbackStreamInstanced
+#endif
+#ifndef GL_VERSION_4_3
+#define GL_VERSION_4_3 1
+GLAPI int GLAD_GL_VERSION_4_3;
+typedef void (APIENTRYP PFNGLCLEARBUFFERDATAPROC)(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data);
+GLAPI PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData;
+#define glClearBufferData glad_glClearBufferData
+typedef void (APIENTRYP PFNGLCLEARBUFFERSUBDATAPROC)(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data);
+GLAPI PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData;
+#define glClearBufferSubData glad_glClearBufferSubData
+typedef void (APIENTRYP PFNGLDISPATCHCOMPUTEPROC)(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
+GLAPI PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute;
+#define glDispatchCompute glad_glDispatchCompute
+typedef void (APIENTRYP PFNGLDISPATCHCOMPUTEINDIRECTPROC)(GLintptr indirect);
+GLAPI PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect;
+#define glDispatchComputeIndirect glad_glDispatchComputeIndirect
+typedef void (APIENTRYP PFNGLCOPYIMAGESUBDATAPROC)(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth);
+GLAPI PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData;
+#define glCopyImageSubData glad_glCopyImageSubData
+typedef void (APIENTRYP PFNGLFRAMEBUFFERPARAMETERIPROC)(GLenum target, GLenum pname, GLint param);
+GLAPI PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri;
+#define glFramebufferParameteri glad_glFramebufferParameteri
+typedef void (APIENTRYP PFNGLGETFRAMEBUFFERPARAMETERIVPROC)(GLenum target, GLenum pname, GLint *params);
+GLAPI PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv;
+#define glGetFramebufferParameteriv glad_glGetFramebufferParameteriv
+typedef void (APIENTRYP PFNGLGETINTERNALFORMATI64VPROC)(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params);
+GLAPI PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v;
+#define glGetInternalformati64v glad_glGetInternalformati64v
+typedef void (APIENTRYP PFNGLINVALIDATETEXSUBIMAGEPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth);
+GLAPI PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage;
+#define glInvalidateTexSubImage glad_glInvalidateTexSubImage
+typedef void (APIENTRYP PFNGLINVALIDATETEXIMAGEPROC)(GLuint texture, GLint level);
+GLAPI PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage;
+#define glInvalidateTexImage glad_glInvalidateTexImage
+typedef void (APIENTRYP PFNGLINVALIDATEBUFFERSUBDATAPROC)(GLuint buffer, GLintptr offset, GLsizeiptr length);
+GLAPI PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData;
+#define glInvalidateBufferSubData glad_glInvalidateBufferSubData
+typedef void (APIENTRYP PFNGLINVALIDATEBUFFERDATAPROC)(GLuint buffer);
+GLAPI PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData;
+#define glInvalidateBufferData glad_glInvalidateBufferData
+typedef void (APIENTRYP PFNGLINVALIDATEFRAMEBUFFERPROC)(GLenum target, GLsizei numAttachments, const GLenum *attachments);
+GLAPI PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer;
+#define glInvalidateFramebuffer glad_glInvalidateFramebuffer
+typedef void (APIENTRYP PFNGLINVALIDATESUBFRAMEBUFFERPROC)(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height);
+GLAPI PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer;
+#define glInvalidateSubFramebuffer glad_glInvalidateSubFramebuffer
+typedef void (APIENTRYP PFNGLMULTIDRAWARRAYSINDIRECTPROC)(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride);
+GLAPI PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect;
+#define glMultiDrawArraysIndirect glad_glMultiDrawArraysIndirect
+typedef void (APIENTRYP PFNGLMULTIDRAWELEMENTSINDIRECTPROC)(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride);
+GLAPI PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect;
+#define glMultiDrawElementsIndirect glad_glMultiDrawElementsIndirect
+typedef void (APIENTRYP PFNGLGETPROGRAMINTERFACEIVPROC)(GLuint program, GLenum programInterface, GLenum pname, GLint *params);
+GLAPI PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv;
+#define glGetProgramInterfaceiv glad_glGetProgramInterfaceiv
+typedef GLuint (APIENTRYP PFNGLGETPROGRAMRESOURCEINDEXPROC)(GLuint program, GLenum programInterface, const GLchar *name);
+GLAPI PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex;
+#define glGetProgramResourceIndex glad_glGetProgramResourceIndex
+typedef void (APIENTRYP PFNGLGETPROGRAMRESOURCENAMEPROC)(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name);
+GLAPI PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName;
+#define glGetProgramResourceName glad_glGetProgramResourceName
+typedef void (APIENTRYP PFNGLGETPROGRAMRESOURCEIVPROC)(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params);
+GLAPI PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv;
+#define glGetProgramResourceiv glad_glGetProgramResourceiv
+typedef GLint (APIENTRYP PFNGLGETPROGRAMRESOURCELOCATIONPROC)(GLuint program, GLenum programInterface, const GLchar *name);
+GLAPI PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation;
+#define glGetProgramResourceLocation glad_glGetProgramResourceLocation
+typedef GLint (APIENTRYP PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)(GLuint program, GLenum programInterface, const GLchar *name);
+GLAPI PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex;
+#define glGetProgramResourceLocationIndex glad_glGetProgramResourceLocationIndex
+typedef void (APIENTRYP PFNGLSHADERSTORAGEBLOCKBINDINGPROC)(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding);
+GLAPI PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding;
+#define glShaderStorageBlockBinding glad_glShaderStorageBlockBinding
+typedef void (APIENTRYP PFNGLTEXBUFFERRANGEPROC)(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size);
+GLAPI PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange;
+#define glTexBufferRange glad_glTexBufferRange
+typedef void (APIENTRYP PFNGLTEXSTORAGE2DMULTISAMPLEPROC)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
+GLAPI PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample;
+#define glTexStorage2DMultisample glad_glTexStorage2DMultisample
+typedef void (APIENTRYP PFNGLTEXSTORAGE3DMULTISAMPLEPROC)(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
+GLAPI PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample;
+#define glTexStorage3DMultisample glad_glTexStorage3DMultisample
+typedef void (APIENTRYP PFNGLTEXTUREVIEWPROC)(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers);
+GLAPI PFNGLTEXTUREVIEWPROC glad_glTextureView;
+#define glTextureView glad_glTextureView
+typedef void (APIENTRYP PFNGLBINDVERTEXBUFFERPROC)(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+GLAPI PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer;
+#define glBindVertexBuffer glad_glBindVertexBuffer
+typedef void (APIENTRYP PFNGLVERTEXATTRIBFORMATPROC)(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
+GLAPI PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat;
+#define glVertexAttribFormat glad_glVertexAttribFormat
+typedef void (APIENTRYP PFNGLVERTEXATTRIBIFORMATPROC)(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+GLAPI PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat;
+#define glVertexAttribIFormat glad_glVertexAttribIFormat
+typedef void (APIENTRYP PFNGLVERTEXATTRIBLFORMATPROC)(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+GLAPI PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat;
+#define glVertexAttribLFormat glad_glVertexAttribLFormat
+typedef void (APIENTRYP PFNGLVERTEXATTRIBBINDINGPROC)(GLuint attribindex, GLuint bindingindex);
+GLAPI PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding;
+#define glVertexAttribBinding glad_glVertexAttribBinding
+typedef void (APIENTRYP PFNGLVERTEXBINDINGDIVISORPROC)(GLuint bindingindex, GLuint divisor);
+GLAPI PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor;
+#define glVertexBindingDivisor glad_glVertexBindingDivisor
+typedef void (APIENTRYP PFNGLDEBUGMESSAGECONTROLPROC)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled);
+GLAPI PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl;
+#define glDebugMessageControl glad_glDebugMessageControl
+typedef void (APIENTRYP PFNGLDEBUGMESSAGEINSERTPROC)(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf);
+GLAPI PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert;
+#define glDebugMessageInsert glad_glDebugMessageInsert
+typedef void (APIENTRYP PFNGLDEBUGMESSAGECALLBACKPROC)(GLDEBUGPROC callback, const void *userParam);
+GLAPI PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback;
+#define glDebugMessageCallback glad_glDebugMessageCallback
+typedef GLuint (APIENTRYP PFNGLGETDEBUGMESSAGELOGPROC)(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog);
+GLAPI PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog;
+#define glGetDebugMessageLog glad_glGetDebugMessageLog
+typedef void (APIENTRYP PFNGLPUSHDEBUGGROUPPROC)(GLenum source, GLuint id, GLsizei length, const GLchar *message);
+GLAPI PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup;
+#define glPushDebugGroup glad_glPushDebugGroup
+typedef void (APIENTRYP PFNGLPOPDEBUGGROUPPROC)(void);
+GLAPI PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup;
+#define glPopDebugGroup glad_glPopDebugGroup
+typedef void (APIENTRYP PFNGLOBJECTLABELPROC)(GLenum identifier, GLuint name, GLsizei length, const GLchar *label);
+GLAPI PFNGLOBJECTLABELPROC glad_glObjectLabel;
+#define glObjectLabel glad_glObjectLabel
+typedef void (APIENTRYP PFNGLGETOBJECTLABELPROC)(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label);
+GLAPI PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel;
+#define glGetObjectLabel glad_glGetObjectLabel
+typedef void (APIENTRYP PFNGLOBJECTPTRLABELPROC)(const void *ptr, GLsizei length, const GLchar *label);
+GLAPI PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel;
+#define glObjectPtrLabel glad_glObjectPtrLabel
+typedef void (APIENTRYP PFNGLGETOBJECTPTRLABELPROC)(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label);
+GLAPI PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel;
+#define glGetObjectPtrLabel glad_glGetObjectPtrLabel
+typedef void (APIENTRYP PFNGLGETPOINTERVPROC)(GLenum pname, void **params);
+GLAPI PFNGLGETPOINTERVPROC glad_glGetPointerv;
+#define glGetPointerv glad_glGetPointerv
+#endif
+#ifndef GL_VERSION_4_4
+#define GL_VERSION_4_4 1
+GLAPI int GLAD_GL_VERSION_4_4;
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+GLAPI PFNGLBUFFERSTORAGEPROC glad_glBufferStorage;
+#define glBufferStorage glad_glBufferStorage
+typedef void (APIENTRYP PFNGLCLEARTEXIMAGEPROC)(GLuint texture, GLint level, GLenum format, GLenum type, const void *data);
+GLAPI PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage;
+#define glClearTexImage glad_glClearTexImage
+typedef void (APIENTRYP PFNGLCLEARTEXSUBIMAGEPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data);
+GLAPI PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage;
+#define glClearTexSubImage glad_glClearTexSubImage
+typedef void (APIENTRYP PFNGLBINDBUFFERSBASEPROC)(GLenum target, GLuint first, GLsizei count, const GLuint *buffers);
+GLAPI PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase;
+#define glBindBuffersBase glad_glBindBuffersBase
+typedef void (APIENTRYP PFNGLBINDBUFFERSRANGEPROC)(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes);
+GLAPI PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange;
+#define glBindBuffersRange glad_glBindBuffersRange
+typedef void (APIENTRYP PFNGLBINDTEXTURESPROC)(GLuint first, GLsizei count, const GLuint *textures);
+GLAPI PFNGLBINDTEXTURESPROC glad_glBindTextures;
+#define glBindTextures glad_glBindTextures
+typedef void (APIENTRYP PFNGLBINDSAMPLERSPROC)(GLuint first, GLsizei count, const GLuint *samplers);
+GLAPI PFNGLBINDSAMPLERSPROC glad_glBindSamplers;
+#define glBindSamplers glad_glBindSamplers
+typedef void (APIENTRYP PFNGLBINDIMAGETEXTURESPROC)(GLuint first, GLsizei count, const GLuint *textures);
+GLAPI PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures;
+#define glBindImageTextures glad_glBindImageTextures
+typedef void (APIENTRYP PFNGLBINDVERTEXBUFFERSPROC)(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides);
+GLAPI PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers;
+#define glBindVertexBuffers glad_glBindVertexBuffers
+#endif
+#ifndef GL_VERSION_4_5
+#define GL_VERSION_4_5 1
+GLAPI int GLAD_GL_VERSION_4_5;
+typedef void (APIENTRYP PFNGLCLIPCONTROLPROC)(GLenum origin, GLenum depth);
+GLAPI PFNGLCLIPCONTROLPROC glad_glClipControl;
+#define glClipControl glad_glClipControl
+typedef void (APIENTRYP PFNGLCREATETRANSFORMFEEDBACKSPROC)(GLsizei n, GLuint *ids);
+GLAPI PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks;
+#define glCreateTransformFeedbacks glad_glCreateTransformFeedbacks
+typedef void (APIENTRYP PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)(GLuint xfb, GLuint index, GLuint buffer);
+GLAPI PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase;
+#define glTransformFeedbackBufferBase glad_glTransformFeedbackBufferBase
+typedef void (APIENTRYP PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+GLAPI PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange;
+#define glTransformFeedbackBufferRange glad_glTransformFeedbackBufferRange
+typedef void (APIENTRYP PFNGLGETTRANSFORMFEEDBACKIVPROC)(GLuint xfb, GLenum pname, GLint *param);
+GLAPI PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv;
+#define glGetTransformFeedbackiv glad_glGetTransformFeedbackiv
+typedef void (APIENTRYP PFNGLGETTRANSFORMFEEDBACKI_VPROC)(GLuint xfb, GLenum pname, GLuint index, GLint *param);
+GLAPI PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v;
+#define glGetTransformFeedbacki_v glad_glGetTransformFeedbacki_v
+typedef void (APIENTRYP PFNGLGETTRANSFORMFEEDBACKI64_VPROC)(GLuint xfb, GLenum pname, GLuint index, GLint64 *param);
+GLAPI PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v;
+#define glGetTransformFeedbacki64_v glad_glGetTransformFeedbacki64_v
+typedef void (APIENTRYP PFNGLCREATEBUFFERSPROC)(GLsizei n, GLuint *buffers);
+GLAPI PFNGLCREATEBUFFERSPROC glad_glCreateBuffers;
+#define glCreateBuffers glad_glCreateBuffers
+typedef void (APIENTRYP PFNGLNAMEDBUFFERSTORAGEPROC)(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags);
+GLAPI PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage;
+#define glNamedBufferStorage glad_glNamedBufferStorage
+typedef void (APIENTRYP PFNGLNAMEDBUFFERDATAPROC)(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage);
+GLAPI PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData;
+#define glNamedBufferData glad_glNamedBufferData
+typedef void (APIENTRYP PFNGLNAMEDBUFFERSUBDATAPROC)(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data);
+GLAPI PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData;
+#define glNamedBufferSubData glad_glNamedBufferSubData
+typedef void (APIENTRYP PFNGLCOPYNAMEDBUFFERSUBDATAPROC)(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+GLAPI PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData;
+#define glCopyNamedBufferSubData glad_glCopyNamedBufferSubData
+typedef void (APIENTRYP PFNGLCLEARNAMEDBUFFERDATAPROC)(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data);
+GLAPI PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData;
+#define glClearNamedBufferData glad_glClearNamedBufferData
+typedef void (APIENTRYP PFNGLCLEARNAMEDBUFFERSUBDATAPROC)(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data);
+GLAPI PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData;
+#define glClearNamedBufferSubData glad_glClearNamedBufferSubData
+typedef void * (APIENTRYP PFNGLMAPNAMEDBUFFERPROC)(GLuint buffer, GLenum access);
+GLAPI PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer;
+#define glMapNamedBuffer glad_glMapNamedBuffer
+typedef void * (APIENTRYP PFNGLMAPNAMEDBUFFERRANGEPROC)(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+GLAPI PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange;
+#define glMapNamedBufferRange glad_glMapNamedBufferRange
+typedef GLboolean (APIENTRYP PFNGLUNMAPNAMEDBUFFERPROC)(GLuint buffer);
+GLAPI PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer;
+#define glUnmapNamedBuffer glad_glUnmapNamedBuffer
+typedef void (APIENTRYP PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)(GLuint buffer, GLintptr offset, GLsizeiptr length);
+GLAPI PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange;
+#define glFlushMappedNamedBufferRange glad_glFlushMappedNamedBufferRange
+typedef void (APIENTRYP PFNGLGETNAMEDBUFFERPARAMETERIVPROC)(GLuint buffer, GLenum pname, GLint *params);
+GLAPI PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv;
+#define glGetNamedBufferParameteriv glad_glGetNamedBufferParameteriv
+typedef void (APIENTRYP PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)(GLuint buffer, GLenum pname, GLint64 *params);
+GLAPI PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v;
+#define glGetNamedBufferParameteri64v glad_glGetNamedBufferParameteri64v
+typedef void (APIENTRYP PFNGLGETNAMEDBUFFERPOINTERVPROC)(GLuint buffer, GLenum pname, void **params);
+GLAPI PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv;
+#define glGetNamedBufferPointerv glad_glGetNamedBufferPointerv
+typedef void (APIENTRYP PFNGLGETNAMEDBUFFERSUBDATAPROC)(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data);
+GLAPI PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData;
+#define glGetNamedBufferSubData glad_glGetNamedBufferSubData
+typedef void (APIENTRYP PFNGLCREATEFRAMEBUFFERSPROC)(GLsizei n, GLuint *framebuffers);
+GLAPI PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers;
+#define glCreateFramebuffers glad_glCreateFramebuffers
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+GLAPI PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer;
+#define glNamedFramebufferRenderbuffer glad_glNamedFramebufferRenderbuffer
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)(GLuint framebuffer, GLenum pname, GLint param);
+GLAPI PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri;
+#define glNamedFramebufferParameteri glad_glNamedFramebufferParameteri
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level);
+GLAPI PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture;
+#define glNamedFramebufferTexture glad_glNamedFramebufferTexture
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer);
+GLAPI PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer;
+#define glNamedFramebufferTextureLayer glad_glNamedFramebufferTextureLayer
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)(GLuint framebuffer, GLenum buf);
+GLAPI PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer;
+#define glNamedFramebufferDrawBuffer glad_glNamedFramebufferDrawBuffer
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)(GLuint framebuffer, GLsizei n, const GLenum *bufs);
+GLAPI PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers;
+#define glNamedFramebufferDrawBuffers glad_glNamedFramebufferDrawBuffers
+typedef void (APIENTRYP PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)(GLuint framebuffer, GLenum src);
+GLAPI PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer;
+#define glNamedFramebufferReadBuffer glad_glNamedFramebufferReadBuffer
+typedef void (APIENTRYP PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments);
+GLAPI PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData;
+#define glInvalidateNamedFramebufferData glad_glInvalidateNamedFramebufferData
+typedef void (APIENTRYP PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height);
+GLAPI PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData;
+#define glInvalidateNamedFramebufferSubData glad_glInvalidateNamedFramebufferSubData
+typedef void (APIENTRYP PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value);
+GLAPI PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv;
+#define glClearNamedFramebufferiv glad_glClearNamedFramebufferiv
+typedef void (APIENTRYP PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value);
+GLAPI PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv;
+#define glClearNamedFramebufferuiv glad_glClearNamedFramebufferuiv
+typedef void (APIENTRYP PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value);
+GLAPI PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv;
+#define glClearNamedFramebufferfv glad_glClearNamedFramebufferfv
+typedef void (APIENTRYP PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil);
+GLAPI PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi;
+#define glClearNamedFramebufferfi glad_glClearNamedFramebufferfi
+typedef void (APIENTRYP PFNGLBLITNAMEDFRAMEBUFFERPROC)(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+GLAPI PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer;
+#define glBlitNamedFramebuffer glad_glBlitNamedFramebuffer
+typedef GLenum (APIENTRYP PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)(GLuint framebuffer, GLenum target);
+GLAPI PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus;
+#define glCheckNamedFramebufferStatus glad_glCheckNamedFramebufferStatus
+typedef void (APIENTRYP PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)(GLuint framebuffer, GLenum pname, GLint *param);
+GLAPI PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv;
+#define glGetNamedFramebufferParameteriv glad_glGetNamedFramebufferParameteriv
+typedef void (APIENTRYP PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params);
+GLAPI PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv;
+#define glGetNamedFramebufferAttachmentParameteriv glad_glGetNamedFramebufferAttachmentParameteriv
+typedef void (APIENTRYP PFNGLCREATERENDERBUFFERSPROC)(GLsizei n, GLuint *renderbuffers);
+GLAPI PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers;
+#define glCreateRenderbuffers glad_glCreateRenderbuffers
+typedef void (APIENTRYP PFNGLNAMEDRENDERBUFFERSTORAGEPROC)(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height);
+GLAPI PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage;
+#define glNamedRenderbufferStorage glad_glNamedRenderbufferStorage
+typedef void (APIENTRYP PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);
+GLAPI PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample;
+#define glNamedRenderbufferStorageMultisample glad_glNamedRenderbufferStorageMultisample
+typedef void (APIENTRYP PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)(GLuint renderbuffer, GLenum pname, GLint *params);
+GLAPI PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv;
+#define glGetNamedRenderbufferParameteriv glad_glGetNamedRenderbufferParameteriv
+typedef void (APIENTRYP PFNGLCREATETEXTURESPROC)(GLenum target, GLsizei n, GLuint *textures);
+GLAPI PFNGLCREATETEXTURESPROC glad_glCreateTextures;
+#define glCreateTextures glad_glCreateTextures
+typedef void (APIENTRYP PFNGLTEXTUREBUFFERPROC)(GLuint texture, GLenum internalformat, GLuint buffer);
+GLAPI PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer;
+#define glTextureBuffer glad_glTextureBuffer
+typedef void (APIENTRYP PFNGLTEXTUREBUFFERRANGEPROC)(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size);
+GLAPI PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange;
+#define glTextureBufferRange glad_glTextureBufferRange
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE1DPROC)(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width);
+GLAPI PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D;
+#define glTextureStorage1D glad_glTextureStorage1D
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE2DPROC)(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+GLAPI PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D;
+#define glTextureStorage2D glad_glTextureStorage2D
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE3DPROC)(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth);
+GLAPI PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D;
+#define glTextureStorage3D glad_glTextureStorage3D
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
+GLAPI PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample;
+#define glTextureStorage2DMultisample glad_glTextureStorage2DMultisample
+typedef void (APIENTRYP PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
+GLAPI PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample;
+#define glTextureStorage3DMultisample glad_glTextureStorage3DMultisample
+typedef void (APIENTRYP PFNGLTEXTURESUBIMAGE1DPROC)(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
+GLAPI PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D;
+#define glTextureSubImage1D glad_glTextureSubImage1D
+typedef void (APIENTRYP PFNGLTEXTURESUBIMAGE2DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+GLAPI PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D;
+#define glTextureSubImage2D glad_glTextureSubImage2D
+typedef void (APIENTRYP PFNGLTEXTURESUBIMAGE3DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
+GLAPI PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D;
+#define glTextureSubImage3D glad_glTextureSubImage3D
+typedef void (APIENTRYP PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data);
+GLAPI PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D;
+#define glCompressedTextureSubImage1D glad_glCompressedTextureSubImage1D
+typedef void (APIENTRYP PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
+GLAPI PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D;
+#define glCompressedTextureSubImage2D glad_glCompressedTextureSubImage2D
+typedef void (APIENTRYP PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data);
+GLAPI PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D;
+#define glCompressedTextureSubImage3D glad_glCompressedTextureSubImage3D
+typedef void (APIENTRYP PFNGLCOPYTEXTURESUBIMAGE1DPROC)(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
+GLAPI PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D;
+#define glCopyTextureSubImage1D glad_glCopyTextureSubImage1D
+typedef void (APIENTRYP PFNGLCOPYTEXTURESUBIMAGE2DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+GLAPI PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D;
+#define glCopyTextureSubImage2D glad_glCopyTextureSubImage2D
+typedef void (APIENTRYP PFNGLCOPYTEXTURESUBIMAGE3DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+GLAPI PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D;
+#define glCopyTextureSubImage3D glad_glCopyTextureSubImage3D
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERFPROC)(GLuint texture, GLenum pname, GLfloat param);
+GLAPI PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf;
+#define glTextureParameterf glad_glTextureParameterf
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERFVPROC)(GLuint texture, GLenum pname, const GLfloat *param);
+GLAPI PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv;
+#define glTextureParameterfv glad_glTextureParameterfv
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERIPROC)(GLuint texture, GLenum pname, GLint param);
+GLAPI PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri;
+#define glTextureParameteri glad_glTextureParameteri
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERIIVPROC)(GLuint texture, GLenum pname, const GLint *params);
+GLAPI PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv;
+#define glTextureParameterIiv glad_glTextureParameterIiv
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERIUIVPROC)(GLuint texture, GLenum pname, const GLuint *params);
+GLAPI PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv;
+#define glTextureParameterIuiv glad_glTextureParameterIuiv
+typedef void (APIENTRYP PFNGLTEXTUREPARAMETERIVPROC)(GLuint texture, GLenum pname, const GLint *param);
+GLAPI PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv;
+#define glTextureParameteriv glad_glTextureParameteriv
+typedef void (APIENTRYP PFNGLGENERATETEXTUREMIPMAPPROC)(GLuint texture);
+GLAPI PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap;
+#define glGenerateTextureMipmap glad_glGenerateTextureMipmap
+typedef void (APIENTRYP PFNGLBINDTEXTUREUNITPROC)(GLuint unit, GLuint texture);
+GLAPI PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit;
+#define glBindTextureUnit glad_glBindTextureUnit
+typedef void (APIENTRYP PFNGLGETTEXTUREIMAGEPROC)(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels);
+GLAPI PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage;
+#define glGetTextureImage glad_glGetTextureImage
+typedef void (APIENTRYP PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)(GLuint texture, GLint level, GLsizei bufSize, void *pixels);
+GLAPI PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage;
+#define glGetCompressedTextureImage glad_glGetCompressedTextureImage
+typedef void (APIENTRYP PFNGLGETTEXTURELEVELPARAMETERFVPROC)(GLuint texture, GLint level, GLenum pname, GLfloat *params);
+GLAPI PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv;
+#define glGetTextureLevelParameterfv glad_glGetTextureLevelParameterfv
+typedef void (APIENTRYP PFNGLGETTEXTURELEVELPARAMETERIVPROC)(GLuint texture, GLint level, GLenum pname, GLint *params);
+GLAPI PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv;
+#define glGetTextureLevelParameteriv glad_glGetTextureLevelParameteriv
+typedef void (APIENTRYP PFNGLGETTEXTUREPARAMETERFVPROC)(GLuint texture, GLenum pname, GLfloat *params);
+GLAPI PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv;
+#define glGetTextureParameterfv glad_glGetTextureParameterfv
+typedef void (APIENTRYP PFNGLGETTEXTUREPARAMETERIIVPROC)(GLuint texture, GLenum pname, GLint *params);
+GLAPI PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv;
+#define glGetTextureParameterIiv glad_glGetTextureParameterIiv
+typedef void (APIENTRYP PFNGLGETTEXTUREPARAMETERIUIVPROC)(GLuint texture, GLenum pname, GLuint *params);
+GLAPI PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv;
+#define glGetTextureParameterIuiv glad_glGetTextureParameterIuiv
+typedef void (APIENTRYP PFNGLGETTEXTUREPARAMETERIVPROC)(GLuint texture, GLenum pname, GLint *params);
+GLAPI PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv;
+#define glGetTextureParameteriv glad_glGetTextureParameteriv
+typedef void (APIENTRYP PFNGLCREATEVERTEXARRAYSPROC)(GLsizei n, GLuint *arrays);
+GLAPI PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays;
+#define glCreateVertexArrays glad_glCreateVertexArrays
+typedef void (APIENTRYP PFNGLDISABLEVERTEXARRAYATTRIBPROC)(GLuint vaobj, GLuint index);
+GLAPI PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib;
+#define glDisableVertexArrayAttrib glad_glDisableVertexArrayAttrib
+typedef void (APIENTRYP PFNGLENABLEVERTEXARRAYATTRIBPROC)(GLuint vaobj, GLuint index);
+GLAPI PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib;
+#define glEnableVertexArrayAttrib glad_glEnableVertexArrayAttrib
+typedef void (APIENTRYP PFNGLVERTEXARRAYELEMENTBUFFERPROC)(GLuint vaobj, GLuint buffer);
+GLAPI PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer;
+#define glVertexArrayElementBuffer glad_glVertexArrayElementBuffer
+typedef void (APIENTRYP PFNGLVERTEXARRAYVERTEXBUFFERPROC)(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+GLAPI PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer;
+#define glVertexArrayVertexBuffer glad_glVertexArrayVertexBuffer
+typedef void (APIENTRYP PFNGLVERTEXARRAYVERTEXBUFFERSPROC)(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides);
+GLAPI PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers;
+#define glVertexArrayVertexBuffers glad_glVertexArrayVertexBuffers
+typedef void (APIENTRYP PFNGLVERTEXARRAYATTRIBBINDINGPROC)(GLuint vaobj, GLuint attribindex, GLuint bindingindex);
+GLAPI PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding;
+#define glVertexArrayAttribBinding glad_glVertexArrayAttribBinding
+typedef void (APIENTRYP PFNGLVERTEXARRAYATTRIBFORMATPROC)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
+GLAPI PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat;
+#define glVertexArrayAttribFormat glad_glVertexArrayAttribFormat
+typedef void (APIENTRYP PFNGLVERTEXARRAYATTRIBIFORMATPROC)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+GLAPI PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat;
+#define glVertexArrayAttribIFormat glad_glVertexArrayAttribIFormat
+typedef void (APIENTRYP PFNGLVERTEXARRAYATTRIBLFORMATPROC)(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+GLAPI PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat;
+#define glVertexArrayAttribLFormat glad_glVertexArrayAttribLFormat
+typedef void (APIENTRYP PFNGLVERTEXARRAYBINDINGDIVISORPROC)(GLuint vaobj, GLuint bindingindex, GLuint divisor);
+GLAPI PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor;
+#define glVertexArrayBindingDivisor glad_glVertexArrayBindingDivisor
+typedef void (APIENTRYP PFNGLGETVERTEXARRAYIVPROC)(GLuint vaobj, GLenum pname, GLint *param);
+GLAPI PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv;
+#define glGetVertexArrayiv glad_glGetVertexArrayiv
+typedef void (APIENTRYP PFNGLGETVERTEXARRAYINDEXEDIVPROC)(GLuint vaobj, GLuint index, GLenum pname, GLint *param);
+GLAPI PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv;
+#define glGetVertexArrayIndexediv glad_glGetVertexArrayIndexediv
+typedef void (APIENTRYP PFNGLGETVERTEXARRAYINDEXED64IVPROC)(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param);
+GLAPI PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv;
+#define glGetVertexArrayIndexed64iv glad_glGetVertexArrayIndexed64iv
+typedef void (APIENTRYP PFNGLCREATESAMPLERSPROC)(GLsizei n, GLuint *samplers);
+GLAPI PFNGLCREATESAMPLERSPROC glad_glCreateSamplers;
+#define glCreateSamplers glad_glCreateSamplers
+typedef void (APIENTRYP PFNGLCREATEPROGRAMPIPELINESPROC)(GLsizei n, GLuint *pipelines);
+GLAPI PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines;
+#define glCreateProgramPipelines glad_glCreateProgramPipelines
+typedef void (APIENTRYP PFNGLCREATEQUERIESPROC)(GLenum target, GLsizei n, GLuint *ids);
+GLAPI PFNGLCREATEQUERIESPROC glad_glCreateQueries;
+#define glCreateQueries glad_glCreateQueries
+typedef void (APIENTRYP PFNGLGETQUERYBUFFEROBJECTI64VPROC)(GLuint id, GLuint buffer, GLenum pname, GLintptr offset);
+GLAPI PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v;
+#define glGetQueryBufferObjecti64v glad_glGetQueryBufferObjecti64v
+typedef void (APIENTRYP PFNGLGETQUERYBUFFEROBJECTIVPROC)(GLuint id, GLuint buffer, GLenum pname, GLintptr offset);
+GLAPI PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv;
+#define glGetQueryBufferObjectiv glad_glGetQueryBufferObjectiv
+typedef void (APIENTRYP PFNGLGETQUERYBUFFEROBJECTUI64VPROC)(GLuint id, GLuint buffer, GLenum pname, GLintptr offset);
+GLAPI PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v;
+#define glGetQueryBufferObjectui64v glad_glGetQueryBufferObjectui64v
+typedef void (APIENTRYP PFNGLGETQUERYBUFFEROBJECTUIVPROC)(GLuint id, GLuint buffer, GLenum pname, GLintptr offset);
+GLAPI PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv;
+#define glGetQueryBufferObjectuiv glad_glGetQueryBufferObjectuiv
+typedef void (APIENTRYP PFNGLMEMORYBARRIERBYREGIONPROC)(GLbitfield barriers);
+GLAPI PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion;
+#define glMemoryBarrierByRegion glad_glMemoryBarrierByRegion
+typedef void (APIENTRYP PFNGLGETTEXTURESUBIMAGEPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels);
+GLAPI PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage;
+#define glGetTextureSubImage glad_glGetTextureSubImage
+typedef void (APIENTRYP PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels);
+GLAPI PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage;
+#define glGetCompressedTextureSubImage glad_glGetCompressedTextureSubImage
+typedef GLenum (APIENTRYP PFNGLGETGRAPHICSRESETSTATUSPROC)(void);
+GLAPI PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus;
+#define glGetGraphicsResetStatus glad_glGetGraphicsResetStatus
+typedef void (APIENTRYP PFNGLGETNCOMPRESSEDTEXIMAGEPROC)(GLenum target, GLint lod, GLsizei bufSize, void *pixels);
+GLAPI PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage;
+#define glGetnCompressedTexImage glad_glGetnCompressedTexImage
+typedef void (APIENTRYP PFNGLGETNTEXIMAGEPROC)(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels);
+GLAPI PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage;
+#define glGetnTexImage glad_glGetnTexImage
+typedef void (APIENTRYP PFNGLGETNUNIFORMDVPROC)(GLuint program, GLint location, GLsizei bufSize, GLdouble *params);
+GLAPI PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv;
+#define glGetnUniformdv glad_glGetnUniformdv
+typedef void (APIENTRYP PFNGLGETNUNIFORMFVPROC)(GLuint program, GLint location, GLsizei bufSize, GLfloat *params);
+GLAPI PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv;
+#define glGetnUniformfv glad_glGetnUniformfv
+typedef void (APIENTRYP PFNGLGETNUNIFORMIVPROC)(GLuint program, GLint location, GLsizei bufSize, GLint *params);
+GLAPI PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv;
+#define glGetnUniformiv glad_glGetnUniformiv
+typedef void (APIENTRYP PFNGLGETNUNIFORMUIVPROC)(GLuint program, GLint location, GLsizei bufSize, GLuint *params);
+GLAPI PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv;
+#define glGetnUniformuiv glad_glGetnUniformuiv
+typedef void (APIENTRYP PFNGLREADNPIXELSPROC)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data);
+GLAPI PFNGLREADNPIXELSPROC glad_glReadnPixels;
+#define glReadnPixels glad_glReadnPixels
+typedef void (APIENTRYP PFNGLTEXTUREBARRIERPROC)(void);
+GLAPI PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier;
+#define glTextureBarrier glad_glTextureBarrier
+#endif
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+GLAPI int GLAD_GL_ARB_buffer_storage;
+#endif
+#ifndef GL_ARB_direct_state_access
+#define GL_ARB_direct_state_access 1
+GLAPI int GLAD_GL_ARB_direct_state_access;
+#endif
+#ifndef GL_ARB_multi_draw_indirect
+#define GL_ARB_multi_draw_indirect 1
+GLAPI int GLAD_GL_ARB_multi_draw_indirect;
+#endif
+#ifndef GL_KHR_debug
+#define GL_KHR_debug 1
+GLAPI int GLAD_GL_KHR_debug;
+#endif
+#ifndef GL_KHR_parallel_shader_compile
+#define GL_KHR_parallel_shader_compile 1
+GLAPI int GLAD_GL_KHR_parallel_shader_compile;
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+GLAPI PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;
+#define glMaxShaderCompilerThreadsKHR glad_glMaxShaderCompilerThreadsKHR
+#endif
+
+/* A dispatch table with its own version and extension state, for running
+ * several contexts side by side. Each one is loaded while its GL context is
+ * current and calls only go through the table, e.g. context->DrawArrays(...).
+ * Zero initialise the struct before its first load. */
+typedef struct GladGLContext {
+    struct gladGLversionStruct version;
+    int VERSION_1_0;
+    int VERSION_1_1;
+    int VERSION_1_2;
+    int VERSION_1_3;
+    int VERSION_1_4;
+    int VERSION_1_5;
+    int VERSION_2_0;
+    int VERSION_2_1;
+    int VERSION_3_0;
+    int VERSION_3_1;
+    int VERSION_3_2;
+    int VERSION_3_3;
+    int VERSION_4_0;
+    int VERSION_4_1;
+    int VERSION_4_2;
+    int VERSION_4_3;
+    int VERSION_4_4;
+    int VERSION_4_5;
+    int ARB_buffer_storage;
+    int ARB_direct_state_access;
+    int ARB_multi_draw_indirect;
+    int KHR_debug;
+    int KHR_parallel_shader_compile;
+    struct gladGLExtensions extensions;
+    struct gladGLCapabilities capabilities;
+    PFNGLCULLFACEPROC CullFace;
+    PFNGLFRONTFACEPROC FrontFace;
+    PFNGLHINTPROC Hint;
+    PFNGLLINEWIDTHPROC LineWidth;
+    PFNGLPOINTSIZEPROC PointSize;
+    PFNGLPOLYGONMODEPROC PolygonMode;
+    PFNGLSCISSORPROC Scissor;
+    PFNGLTEXPARAMETERFPROC TexParameterf;
+    PFNGLTEXPARAMETERFVPROC TexParameterfv;
+    PFNGLTEXPARAMETERIPROC TexParameteri;
+    PFNGLTEXPARAMETERIVPROC TexParameteriv;
+    PFNGLTEXIMAGE1DPROC TexImage1D;
+    PFNGLTEXIMAGE2DPROC TexImage2D;
+    PFNGLDRAWBUFFERPROC DrawBuffer;
+    PFNGLCLEARPROC Clear;
+    PFNGLCLEARCOLORPROC ClearColor;
+    PFNGLCLEARSTENCILPROC ClearStencil;
+    PFNGLCLEARDEPTHPROC ClearDepth;
+    PFNGLSTENCILMASKPROC StencilMask;
+    PFNGLCOLORMASKPROC ColorMask;
+    PFNGLDEPTHMASKPROC DepthMask;
+    PFNGLDISABLEPROC Disable;
+    PFNGLENABLEPROC Enable;
+    PFNGLFINISHPROC Finish;
+    PFNGLFLUSHPROC Flush;
+    PFNGLBLENDFUNCPROC BlendFunc;
+    PFNGLLOGICOPPROC LogicOp;
+    PFNGLSTENCILFUNCPROC StencilFunc;
+    PFNGLSTENCILOPPROC StencilOp;
+    PFNGLDEPTHFUNCPROC DepthFunc;
+    PFNGLPIXELSTOREFPROC PixelStoref;
+    PFNGLPIXELSTOREIPROC PixelStorei;
+    PFNGLREADBUFFERPROC ReadBuffer;
+    PFNGLREADPIXELSPROC ReadPixels;
+    PFNGLGETBOOLEANVPROC GetBooleanv;
+    PFNGLGETDOUBLEVPROC GetDoublev;
+    PFNGLGETERRORPROC GetError;
+    PFNGLGETFLOATVPROC GetFloatv;
+    PFNGLGETINTEGERVPROC GetIntegerv;
+    PFNGLGETSTRINGPROC GetString;
+    PFNGLGETTEXIMAGEPROC GetTexImage;
+    PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+    PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+    PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+    PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+    PFNGLISENABLEDPROC IsEnabled;
+    PFNGLDEPTHRANGEPROC DepthRange;
+    PFNGLVIEWPORTPROC Viewport;
+    PFNGLDRAWARRAYSPROC DrawArrays;
+    PFNGLDRAWELEMENTSPROC DrawElements;
+    PFNGLPOLYGONOFFSETPROC PolygonOffset;
+    PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+    PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+    PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+    PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+    PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+    PFNGLBINDTEXTUREPROC BindTexture;
+    PFNGLDELETETEXTURESPROC DeleteTextures;
+    PFNGLGENTEXTURESPROC GenTextures;
+    PFNGLISTEXTUREPROC IsTexture;
+    PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+    PFNGLTEXIMAGE3DPROC TexImage3D;
+    PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+    PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+    PFNGLACTIVETEXTUREPROC ActiveTexture;
+    PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+    PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+    PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+    PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+    PFNGLPOINTPARAMETERFPROC PointParameterf;
+    PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+    PFNGLPOINTPARAMETERIPROC PointParameteri;
+    PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+    PFNGLBLENDCOLORPROC BlendColor;
+    PFNGLBLENDEQUATIONPROC BlendEquation;
+    PFNGLGENQUERIESPROC GenQueries;
+    PFNGLDELETEQUERIESPROC DeleteQueries;
+    PFNGLISQUERYPROC IsQuery;
+    PFNGLBEGINQUERYPROC BeginQuery;
+    PFNGLENDQUERYPROC EndQuery;
+    PFNGLGETQUERYIVPROC GetQueryiv;
+    PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLGENBUFFERSPROC GenBuffers;
+    PFNGLISBUFFERPROC IsBuffer;
+    PFNGLBUFFERDATAPROC BufferData;
+    PFNGLBUFFERSUBDATAPROC BufferSubData;
+    PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+    PFNGLMAPBUFFERPROC MapBuffer;
+    PFNGLUNMAPBUFFERPROC UnmapBuffer;
+    PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+    PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+    PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+    PFNGLDRAWBUFFERSPROC DrawBuffers;
+    PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+    PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+    PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+    PFNGLATTACHSHADERPROC AttachShader;
+    PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+    PFNGLCOMPILESHADERPROC CompileShader;
+    PFNGLCREATEPROGRAMPROC CreateProgram;
+    PFNGLCREATESHADERPROC CreateShader;
+    PFNGLDELETEPROGRAMPROC DeleteProgram;
+    PFNGLDELETESHADERPROC DeleteShader;
+    PFNGLDETACHSHADERPROC DetachShader;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+    PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+    PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+    PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+    PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+    PFNGLGETPROGRAMIVPROC GetProgramiv;
+    PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+    PFNGLGETSHADERIVPROC GetShaderiv;
+    PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+    PFNGLGETSHADERSOURCEPROC GetShaderSource;
+    PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+    PFNGLGETUNIFORMFVPROC GetUniformfv;
+    PFNGLGETUNIFORMIVPROC GetUniformiv;
+    PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+    PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+    PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+    PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+    PFNGLISPROGRAMPROC IsProgram;
+    PFNGLISSHADERPROC IsShader;
+    PFNGLLINKPROGRAMPROC LinkProgram;
+    PFNGLSHADERSOURCEPROC ShaderSource;
+    PFNGLUSEPROGRAMPROC UseProgram;
+    PFNGLUNIFORM1FPROC Uniform1f;
+    PFNGLUNIFORM2FPROC Uniform2f;
+    PFNGLUNIFORM3FPROC Uniform3f;
+    PFNGLUNIFORM4FPROC Uniform4f;
+    PFNGLUNIFORM1IPROC Uniform1i;
+    PFNGLUNIFORM2IPROC Uniform2i;
+    PFNGLUNIFORM3IPROC Uniform3i;
+    PFNGLUNIFORM4IPROC Uniform4i;
+    PFNGLUNIFORM1FVPROC Uniform1fv;
+    PFNGLUNIFORM2FVPROC Uniform2fv;
+    PFNGLUNIFORM3FVPROC Uniform3fv;
+    PFNGLUNIFORM4FVPROC Uniform4fv;
+    PFNGLUNIFORM1IVPROC Uniform1iv;
+    PFNGLUNIFORM2IVPROC Uniform2iv;
+    PFNGLUNIFORM3IVPROC Uniform3iv;
+    PFNGLUNIFORM4IVPROC Uniform4iv;
+    PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+    PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+    PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+    PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+    PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+    PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+    PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+    PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+    PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+    PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+    PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+    PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+    PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+    PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+    PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+    PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+    PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+    PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+    PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+    PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+    PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+    PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+    PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+    PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+    PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+    PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+    PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+    PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+    PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+    PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+    PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+    PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+    PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+    PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+    PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+    PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+    PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+    PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+    PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+    PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+    PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+    PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+    PFNGLCOLORMASKIPROC ColorMaski;
+    PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+    PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+    PFNGLENABLEIPROC Enablei;
+    PFNGLDISABLEIPROC Disablei;
+    PFNGLISENABLEDIPROC IsEnabledi;
+    PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+    PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+    PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+    PFNGLBINDBUFFERBASEPROC BindBufferBase;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+    PFNGLCLAMPCOLORPROC ClampColor;
+    PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+    PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+    PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+    PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+    PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+    PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+    PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+    PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+    PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+    PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+    PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+    PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+    PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+    PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+    PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+    PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+    PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+    PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+    PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+    PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+    PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+    PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+    PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+    PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+    PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+    PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+    PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+    PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+    PFNGLUNIFORM1UIPROC Uniform1ui;
+    PFNGLUNIFORM2UIPROC Uniform2ui;
+    PFNGLUNIFORM3UIPROC Uniform3ui;
+    PFNGLUNIFORM4UIPROC Uniform4ui;
+    PFNGLUNIFORM1UIVPROC Uniform1uiv;
+    PFNGLUNIFORM2UIVPROC Uniform2uiv;
+    PFNGLUNIFORM3UIVPROC Uniform3uiv;
+    PFNGLUNIFORM4UIVPROC Uniform4uiv;
+    PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+    PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+    PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+    PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+    PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+    PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+    PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+    PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+    PFNGLGETSTRINGIPROC GetStringi;
+    PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+    PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+    PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+    PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+    PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+    PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+    PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+    PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+    PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+    PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+    PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+    PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+    PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+    PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+    PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+    PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+    PFNGLISVERTEXARRAYPROC IsVertexArray;
+    PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+    PFNGLTEXBUFFERPROC TexBuffer;
+    PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+    PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+    PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+    PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+    PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+    PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+    PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+    PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+    PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+    PFNGLFENCESYNCPROC FenceSync;
+    PFNGLISSYNCPROC IsSync;
+    PFNGLDELETESYNCPROC DeleteSync;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLWAITSYNCPROC WaitSync;
+    PFNGLGETINTEGER64VPROC GetInteger64v;
+    PFNGLGETSYNCIVPROC GetSynciv;
+    PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+    PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+    PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+    PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+    PFNGLSAMPLEMASKIPROC SampleMaski;
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+    PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+    PFNGLGENSAMPLERSPROC GenSamplers;
+    PFNGLDELETESAMPLERSPROC DeleteSamplers;
+    PFNGLISSAMPLERPROC IsSampler;
+    PFNGLBINDSAMPLERPROC BindSampler;
+    PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+    PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+    PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+    PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+    PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+    PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+    PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+    PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+    PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+    PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+    PFNGLQUERYCOUNTERPROC QueryCounter;
+    PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+    PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+    PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+    PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+    PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+    PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+    PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+    PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+    PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+    PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+    PFNGLVERTEXP2UIPROC VertexP2ui;
+    PFNGLVERTEXP2UIVPROC VertexP2uiv;
+    PFNGLVERTEXP3UIPROC VertexP3ui;
+    PFNGLVERTEXP3UIVPROC VertexP3uiv;
+    PFNGLVERTEXP4UIPROC VertexP4ui;
+    PFNGLVERTEXP4UIVPROC VertexP4uiv;
+    PFNGLTEXCOORDP1UIPROC TexCoordP1ui;
+    PFNGLTEXCOORDP1UIVPROC TexCoordP1uiv;
+    PFNGLTEXCOORDP2UIPROC TexCoordP2ui;
+    PFNGLTEXCOORDP2UIVPROC TexCoordP2uiv;
+    PFNGLTEXCOORDP3UIPROC TexCoordP3ui;
+    PFNGLTEXCOORDP3UIVPROC TexCoordP3uiv;
+    PFNGLTEXCOORDP4UIPROC TexCoordP4ui;
+    PFNGLTEXCOORDP4UIVPROC TexCoordP4uiv;
+    PFNGLMULTITEXCOORDP1UIPROC MultiTexCoordP1ui;
+    PFNGLMULTITEXCOORDP1UIVPROC MultiTexCoordP1uiv;
+    PFNGLMULTITEXCOORDP2UIPROC MultiTexCoordP2ui;
+    PFNGLMULTITEXCOORDP2UIVPROC MultiTexCoordP2uiv;
+    PFNGLMULTITEXCOORDP3UIPROC MultiTexCoordP3ui;
+    PFNGLMULTITEXCOORDP3UIVPROC MultiTexCoordP3uiv;
+    PFNGLMULTITEXCOORDP4UIPROC MultiTexCoordP4ui;
+    PFNGLMULTITEXCOORDP4UIVPROC MultiTexCoordP4uiv;
+    PFNGLNORMALP3UIPROC NormalP3ui;
+    PFNGLNORMALP3UIVPROC NormalP3uiv;
+    PFNGLCOLORP3UIPROC ColorP3ui;
+    PFNGLCOLORP3UIVPROC ColorP3uiv;
+    PFNGLCOLORP4UIPROC ColorP4ui;
+    PFNGLCOLORP4UIVPROC ColorP4uiv;
+    PFNGLSECONDARYCOLORP3UIPROC SecondaryColorP3ui;
+    PFNGLSECONDARYCOLORP3UIVPROC SecondaryColorP3uiv;
+    PFNGLMINSAMPLESHADINGPROC MinSampleShading;
+    PFNGLBLENDEQUATIONIPROC BlendEquationi;
+    PFNGLBLENDEQUATIONSEPARATEIPROC BlendEquationSeparatei;
+    PFNGLBLENDFUNCIPROC BlendFunci;
+    PFNGLBLENDFUNCSEPARATEIPROC BlendFuncSeparatei;
+    PFNGLDRAWARRAYSINDIRECTPROC DrawArraysIndirect;
+    PFNGLDRAWELEMENTSINDIRECTPROC DrawElementsIndirect;
+    PFNGLUNIFORM1DPROC Uniform1d;
+    PFNGLUNIFORM2DPROC Uniform2d;
+    PFNGLUNIFORM3DPROC Uniform3d;
+    PFNGLUNIFORM4DPROC Uniform4d;
+    PFNGLUNIFORM1DVPROC Uniform1dv;
+    PFNGLUNIFORM2DVPROC Uniform2dv;
+    PFNGLUNIFORM3DVPROC Uniform3dv;
+    PFNGLUNIFORM4DVPROC Uniform4dv;
+    PFNGLUNIFORMMATRIX2DVPROC UniformMatrix2dv;
+    PFNGLUNIFORMMATRIX3DVPROC UniformMatrix3dv;
+    PFNGLUNIFORMMATRIX4DVPROC UniformMatrix4dv;
+    PFNGLUNIFORMMATRIX2X3DVPROC UniformMatrix2x3dv;
+    PFNGLUNIFORMMATRIX2X4DVPROC UniformMatrix2x4dv;
+    PFNGLUNIFORMMATRIX3X2DVPROC UniformMatrix3x2dv;
+    PFNGLUNIFORMMATRIX3X4DVPROC UniformMatrix3x4dv;
+    PFNGLUNIFORMMATRIX4X2DVPROC UniformMatrix4x2dv;
+    PFNGLUNIFORMMATRIX4X3DVPROC UniformMatrix4x3dv;
+    PFNGLGETUNIFORMDVPROC GetUniformdv;
+    PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC GetSubroutineUniformLocation;
+    PFNGLGETSUBROUTINEINDEXPROC GetSubroutineIndex;
+    PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC GetActiveSubroutineUniformiv;
+    PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC GetActiveSubroutineUniformName;
+    PFNGLGETACTIVESUBROUTINENAMEPROC GetActiveSubroutineName;
+    PFNGLUNIFORMSUBROUTINESUIVPROC UniformSubroutinesuiv;
+    PFNGLGETUNIFORMSUBROUTINEUIVPROC GetUniformSubroutineuiv;
+    PFNGLGETPROGRAMSTAGEIVPROC GetProgramStageiv;
+    PFNGLPATCHPARAMETERIPROC PatchParameteri;
+    PFNGLPATCHPARAMETERFVPROC PatchParameterfv;
+    PFNGLBINDTRANSFORMFEEDBACKPROC BindTransformFeedback;
+    PFNGLDELETETRANSFORMFEEDBACKSPROC DeleteTransformFeedbacks;
+    PFNGLGENTRANSFORMFEEDBACKSPROC GenTransformFeedbacks;
+    PFNGLISTRANSFORMFEEDBACKPROC IsTransformFeedback;
+    PFNGLPAUSETRANSFORMFEEDBACKPROC PauseTransformFeedback;
+    PFNGLRESUMETRANSFORMFEEDBACKPROC ResumeTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKPROC DrawTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC DrawTransformFeedbackStream;
+    PFNGLBEGINQUERYINDEXEDPROC BeginQueryIndexed;
+    PFNGLENDQUERYINDEXEDPROC EndQueryIndexed;
+    PFNGLGETQUERYINDEXEDIVPROC GetQueryIndexediv;
+    PFNGLRELEASESHADERCOMPILERPROC ReleaseShaderCompiler;
+    PFNGLSHADERBINARYPROC ShaderBinary;
+    PFNGLGETSHADERPRECISIONFORMATPROC GetShaderPrecisionFormat;
+    PFNGLDEPTHRANGEFPROC DepthRangef;
+    PFNGLCLEARDEPTHFPROC ClearDepthf;
+    PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+    PFNGLPROGRAMBINARYPROC ProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+    PFNGLUSEPROGRAMSTAGESPROC UseProgramStages;
+    PFNGLACTIVESHADERPROGRAMPROC ActiveShaderProgram;
+    PFNGLCREATESHADERPROGRAMVPROC CreateShaderProgramv;
+    PFNGLBINDPROGRAMPIPELINEPROC BindProgramPipeline;
+    PFNGLDELETEPROGRAMPIPELINESPROC DeleteProgramPipelines;
+    PFNGLGENPROGRAMPIPELINESPROC GenProgramPipelines;
+    PFNGLISPROGRAMPIPELINEPROC IsProgramPipeline;
+    PFNGLGETPROGRAMPIPELINEIVPROC GetProgramPipelineiv;
+    PFNGLPROGRAMUNIFORM1IPROC ProgramUniform1i;
+    PFNGLPROGRAMUNIFORM1IVPROC ProgramUniform1iv;
+    PFNGLPROGRAMUNIFORM1FPROC ProgramUniform1f;
+    PFNGLPROGRAMUNIFORM1FVPROC ProgramUniform1fv;
+    PFNGLPROGRAMUNIFORM1DPROC ProgramUniform1d;
+    PFNGLPROGRAMUNIFORM1DVPROC ProgramUniform1dv;
+    PFNGLPROGRAMUNIFORM1UIPROC ProgramUniform1ui;
+    PFNGLPROGRAMUNIFORM1UIVPROC ProgramUniform1uiv;
+    PFNGLPROGRAMUNIFORM2IPROC ProgramUniform2i;
+    PFNGLPROGRAMUNIFORM2IVPROC ProgramUniform2iv;
+    PFNGLPROGRAMUNIFORM2FPROC ProgramUniform2f;
+    PFNGLPROGRAMUNIFORM2FVPROC ProgramUniform2fv;
+    PFNGLPROGRAMUNIFORM2DPROC ProgramUniform2d;
+    PFNGLPROGRAMUNIFORM2DVPROC ProgramUniform2dv;
+    PFNGLPROGRAMUNIFORM2UIPROC ProgramUniform2ui;
+    PFNGLPROGRAMUNIFORM2UIVPROC ProgramUniform2uiv;
+    PFNGLPROGRAMUNIFORM3IPROC ProgramUniform3i;
+    PFNGLPROGRAMUNIFORM3IVPROC ProgramUniform3iv;
+    PFNGLPROGRAMUNIFORM3FPROC ProgramUniform3f;
+    PFNGLPROGRAMUNIFORM3FVPROC ProgramUniform3fv;
+    PFNGLPROGRAMUNIFORM3DPROC ProgramUniform3d;
+    PFNGLPROGRAMUNIFORM3DVPROC ProgramUniform3dv;
+    PFNGLPROGRAMUNIFORM3UIPROC ProgramUniform3ui;
+    PFNGLPROGRAMUNIFORM3UIVPROC ProgramUniform3uiv;
+    PFNGLPROGRAMUNIFORM4IPROC ProgramUniform4i;
+    PFNGLPROGRAMUNIFORM4IVPROC ProgramUniform4iv;
+    PFNGLPROGRAMUNIFORM4FPROC ProgramUniform4f;
+    PFNGLPROGRAMUNIFORM4FVPROC ProgramUniform4fv;
+    PFNGLPROGRAMUNIFORM4DPROC ProgramUniform4d;
+    PFNGLPROGRAMUNIFORM4DVPROC ProgramUniform4dv;
+    PFNGLPROGRAMUNIFORM4UIPROC ProgramUniform4ui;
+    PFNGLPROGRAMUNIFORM4UIVPROC ProgramUniform4uiv;
+    PFNGLPROGRAMUNIFORMMATRIX2FVPROC ProgramUniformMatrix2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3FVPROC ProgramUniformMatrix3fv;
+    PFNGLPROGRAMUNIFORMMATRIX4FVPROC ProgramUniformMatrix4fv;
+    PFNGLPROGRAMUNIFORMMATRIX2DVPROC ProgramUniformMatrix2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3DVPROC ProgramUniformMatrix3dv;
+    PFNGLPROGRAMUNIFORMMATRIX4DVPROC ProgramUniformMatrix4dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC ProgramUniformMatrix2x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC ProgramUniformMatrix3x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC ProgramUniformMatrix2x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC ProgramUniformMatrix4x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC ProgramUniformMatrix3x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC ProgramUniformMatrix4x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC ProgramUniformMatrix2x3dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC ProgramUniformMatrix3x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC ProgramUniformMatrix2x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC ProgramUniformMatrix4x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC ProgramUniformMatrix3x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC ProgramUniformMatrix4x3dv;
+    PFNGLVALIDATEPROGRAMPIPELINEPROC ValidateProgramPipeline;
+    PFNGLGETPROGRAMPIPELINEINFOLOGPROC GetProgramPipelineInfoLog;
+    PFNGLVERTEXATTRIBL1DPROC VertexAttribL1d;
+    PFNGLVERTEXATTRIBL2DPROC VertexAttribL2d;
+    PFNGLVERTEXATTRIBL3DPROC VertexAttribL3d;
+    PFNGLVERTEXATTRIBL4DPROC VertexAttribL4d;
+    PFNGLVERTEXATTRIBL1DVPROC VertexAttribL1dv;
+    PFNGLVERTEXATTRIBL2DVPROC VertexAttribL2dv;
+    PFNGLVERTEXATTRIBL3DVPROC VertexAttribL3dv;
+    PFNGLVERTEXATTRIBL4DVPROC VertexAttribL4dv;
+    PFNGLVERTEXATTRIBLPOINTERPROC VertexAttribLPointer;
+    PFNGLGETVERTEXATTRIBLDVPROC GetVertexAttribLdv;
+    PFNGLVIEWPORTARRAYVPROC ViewportArrayv;
+    PFNGLVIEWPORTINDEXEDFPROC ViewportIndexedf;
+    PFNGLVIEWPORTINDEXEDFVPROC ViewportIndexedfv;
+    PFNGLSCISSORARRAYVPROC ScissorArrayv;
+    PFNGLSCISSORINDEXEDPROC ScissorIndexed;
+    PFNGLSCISSORINDEXEDVPROC ScissorIndexedv;
+    PFNGLDEPTHRANGEARRAYVPROC DepthRangeArrayv;
+    PFNGLDEPTHRANGEINDEXEDPROC DepthRangeIndexed;
+    PFNGLGETFLOATI_VPROC GetFloati_v;
+    PFNGLGETDOUBLEI_VPROC GetDoublei_v;
+    PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC DrawArraysInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC DrawElementsInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC DrawElementsInstancedBaseVertexBaseInstance;
+    PFNGLGETINTERNALFORMATIVPROC GetInternalformativ;
+    PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC GetActiveAtomicCounterBufferiv;
+    PFNGLBINDIMAGETEXTUREPROC BindImageTexture;
+    PFNGLMEMORYBARRIERPROC MemoryBarrier;
+    PFNGLTEXSTORAGE1DPROC TexStorage1D;
+    PFNGLTEXSTORAGE2DPROC TexStorage2D;
+    PFNGLTEXSTORAGE3DPROC TexStorage3D;
+    PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC DrawTransformFeedbackInstanced;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC DrawTransformFeedbackStreamInstanced;
+    PFNGLCLEARBUFFERDATAPROC ClearBufferData;
+    PFNGLCLEARBUFFERSUBDATAPROC ClearBufferSubData;
+    PFNGLDISPATCHCOMPUTEPROC DispatchCompute;
+    PFNGLDISPATCHCOMPUTEINDIRECTPROC DispatchComputeIndirect;
+    PFNGLCOPYIMAGESUBDATAPROC CopyImageSubData;
+    PFNGLFRAMEBUFFERPARAMETERIPROC FramebufferParameteri;
+    PFNGLGETFRAMEBUFFERPARAMETERIVPROC GetFramebufferParameteriv;
+    PFNGLGETINTERNALFORMATI64VPROC GetInternalformati64v;
+    PFNGLINVALIDATETEXSUBIMAGEPROC InvalidateTexSubImage;
+    PFNGLINVALIDATETEXIMAGEPROC InvalidateTexImage;
+    PFNGLINVALIDATEBUFFERSUBDATAPROC InvalidateBufferSubData;
+    PFNGLINVALIDATEBUFFERDATAPROC InvalidateBufferData;
+    PFNGLINVALIDATEFRAMEBUFFERPROC InvalidateFramebuffer;
+    PFNGLINVALIDATESUBFRAMEBUFFERPROC InvalidateSubFramebuffer;
+    PFNGLMULTIDRAWARRAYSINDIRECTPROC MultiDrawArraysIndirect;
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC MultiDrawElementsIndirect;
+    PFNGLGETPROGRAMINTERFACEIVPROC GetProgramInterfaceiv;
+    PFNGLGETPROGRAMRESOURCEINDEXPROC GetProgramResourceIndex;
+    PFNGLGETPROGRAMRESOURCENAMEPROC GetProgramResourceName;
+    PFNGLGETPROGRAMRESOURCEIVPROC GetProgramResourceiv;
+    PFNGLGETPROGRAMRESOURCELOCATIONPROC GetProgramResourceLocation;
+    PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC GetProgramResourceLocationIndex;
+    PFNGLSHADERSTORAGEBLOCKBINDINGPROC ShaderStorageBlockBinding;
+    PFNGLTEXBUFFERRANGEPROC TexBufferRange;
+    PFNGLTEXSTORAGE2DMULTISAMPLEPROC TexStorage2DMultisample;
+    PFNGLTEXSTORAGE3DMULTISAMPLEPROC TexStorage3DMultisample;
+    PFNGLTEXTUREVIEWPROC TextureView;
+    PFNGLBINDVERTEXBUFFERPROC BindVertexBuffer;
+    PFNGLVERTEXATTRIBFORMATPROC VertexAttribFormat;
+    PFNGLVERTEXATTRIBIFORMATPROC VertexAttribIFormat;
+    PFNGLVERTEXATTRIBLFORMATPROC VertexAttribLFormat;
+    PFNGLVERTEXATTRIBBINDINGPROC VertexAttribBinding;
+    PFNGLVERTEXBINDINGDIVISORPROC VertexBindingDivisor;
+    PFNGLDEBUGMESSAGECONTROLPROC DebugMessageControl;
+    PFNGLDEBUGMESSAGEINSERTPROC DebugMessageInsert;
+    PFNGLDEBUGMESSAGECALLBACKPROC DebugMessageCallback;
+    PFNGLGETDEBUGMESSAGELOGPROC GetDebugMessageLog;
+    PFNGLPUSHDEBUGGROUPPROC PushDebugGroup;
+    PFNGLPOPDEBUGGROUPPROC PopDebugGroup;
+    PFNGLOBJECTLABELPROC ObjectLabel;
+    PFNGLGETOBJECTLABELPROC GetObjectLabel;
+    PFNGLOBJECTPTRLABELPROC ObjectPtrLabel;
+    PFNGLGETOBJECTPTRLABELPROC GetObjectPtrLabel;
+    PFNGLGETPOINTERVPROC GetPointerv;
+    PFNGLBUFFERSTORAGEPROC BufferStorage;
+    PFNGLCLEARTEXIMAGEPROC ClearTexImage;
+    PFNGLCLEARTEXSUBIMAGEPROC ClearTexSubImage;
+    PFNGLBINDBUFFERSBASEPROC BindBuffersBase;
+    PFNGLBINDBUFFERSRANGEPROC BindBuffersRange;
+    PFNGLBINDTEXTURESPROC BindTextures;
+    PFNGLBINDSAMPLERSPROC BindSamplers;
+    PFNGLBINDIMAGETEXTURESPROC BindImageTextures;
+    PFNGLBINDVERTEXBUFFERSPROC BindVertexBuffers;
+    PFNGLCLIPCONTROLPROC ClipControl;
+    PFNGLCREATETRANSFORMFEEDBACKSPROC CreateTransformFeedbacks;
+    PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC TransformFeedbackBufferBase;
+    PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC TransformFeedbackBufferRange;
+    PFNGLGETTRANSFORMFEEDBACKIVPROC GetTransformFeedbackiv;
+    PFNGLGETTRANSFORMFEEDBACKI_VPROC GetTransformFeedbacki_v;
+    PFNGLGETTRANSFORMFEEDBACKI64_VPROC GetTransformFeedbacki64_v;
+    PFNGLCREATEBUFFERSPROC CreateBuffers;
+    PFNGLNAMEDBUFFERSTORAGEPROC NamedBufferStorage;
+    PFNGLNAMEDBUFFERDATAPROC NamedBufferData;
+    PFNGLNAMEDBUFFERSUBDATAPROC NamedBufferSubData;
+    PFNGLCOPYNAMEDBUFFERSUBDATAPROC CopyNamedBufferSubData;
+    PFNGLCLEARNAMEDBUFFERDATAPROC ClearNamedBufferData;
+    PFNGLCLEARNAMEDBUFFERSUBDATAPROC ClearNamedBufferSubData;
+    PFNGLMAPNAMEDBUFFERPROC MapNamedBuffer;
+    PFNGLMAPNAMEDBUFFERRANGEPROC MapNamedBufferRange;
+    PFNGLUNMAPNAMEDBUFFERPROC UnmapNamedBuffer;
+    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC FlushMappedNamedBufferRange;
+    PFNGLGETNAMEDBUFFERPARAMETERIVPROC GetNamedBufferParameteriv;
+    PFNGLGETNAMEDBUFFERPARAMETERI64VPROC GetNamedBufferParameteri64v;
+    PFNGLGETNAMEDBUFFERPOINTERVPROC GetNamedBufferPointerv;
+    PFNGLGETNAMEDBUFFERSUBDATAPROC GetNamedBufferSubData;
+    PFNGLCREATEFRAMEBUFFERSPROC CreateFramebuffers;
+    PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC NamedFramebufferRenderbuffer;
+    PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC NamedFramebufferParameteri;
+    PFNGLNAMEDFRAMEBUFFERTEXTUREPROC NamedFramebufferTexture;
+    PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC NamedFramebufferTextureLayer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC NamedFramebufferDrawBuffer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC NamedFramebufferDrawBuffers;
+    PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC NamedFramebufferReadBuffer;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC InvalidateNamedFramebufferData;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC InvalidateNamedFramebufferSubData;
+    PFNGLCLEARNAMEDFRAMEBUFFERIVPROC ClearNamedFramebufferiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC ClearNamedFramebufferuiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFVPROC ClearNamedFramebufferfv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFIPROC ClearNamedFramebufferfi;
+    PFNGLBLITNAMEDFRAMEBUFFERPROC BlitNamedFramebuffer;
+    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC CheckNamedFramebufferStatus;
+    PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC GetNamedFramebufferParameteriv;
+    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetNamedFramebufferAttachmentParameteriv;
+    PFNGLCREATERENDERBUFFERSPROC CreateRenderbuffers;
+    PFNGLNAMEDRENDERBUFFERSTORAGEPROC NamedRenderbufferStorage;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC NamedRenderbufferStorageMultisample;
+    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC GetNamedRenderbufferParameteriv;
+    PFNGLCREATETEXTURESPROC CreateTextures;
+    PFNGLTEXTUREBUFFERPROC TextureBuffer;
+    PFNGLTEXTUREBUFFERRANGEPROC TextureBufferRange;
+    PFNGLTEXTURESTORAGE1DPROC TextureStorage1D;
+    PFNGLTEXTURESTORAGE2DPROC TextureStorage2D;
+    PFNGLTEXTURESTORAGE3DPROC TextureStorage3D;
+    PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC TextureStorage2DMultisample;
+    PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC TextureStorage3DMultisample;
+    PFNGLTEXTURESUBIMAGE1DPROC TextureSubImage1D;
+    PFNGLTEXTURESUBIMAGE2DPROC TextureSubImage2D;
+    PFNGLTEXTURESUBIMAGE3DPROC TextureSubImage3D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC CompressedTextureSubImage1D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC CompressedTextureSubImage2D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC CompressedTextureSubImage3D;
+    PFNGLCOPYTEXTURESUBIMAGE1DPROC CopyTextureSubImage1D;
+    PFNGLCOPYTEXTURESUBIMAGE2DPROC CopyTextureSubImage2D;
+    PFNGLCOPYTEXTURESUBIMAGE3DPROC CopyTextureSubImage3D;
+    PFNGLTEXTUREPARAMETERFPROC TextureParameterf;
+    PFNGLTEXTUREPARAMETERFVPROC TextureParameterfv;
+    PFNGLTEXTUREPARAMETERIPROC TextureParameteri;
+    PFNGLTEXTUREPARAMETERIIVPROC TextureParameterIiv;
+    PFNGLTEXTUREPARAMETERIUIVPROC TextureParameterIuiv;
+    PFNGLTEXTUREPARAMETERIVPROC TextureParameteriv;
+    PFNGLGENERATETEXTUREMIPMAPPROC GenerateTextureMipmap;
+    PFNGLBINDTEXTUREUNITPROC BindTextureUnit;
+    PFNGLGETTEXTUREIMAGEPROC GetTextureImage;
+    PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC GetCompressedTextureImage;
+    PFNGLGETTEXTURELEVELPARAMETERFVPROC GetTextureLevelParameterfv;
+    PFNGLGETTEXTURELEVELPARAMETERIVPROC GetTextureLevelParameteriv;
+    PFNGLGETTEXTUREPARAMETERFVPROC GetTextureParameterfv;
+    PFNGLGETTEXTUREPARAMETERIIVPROC GetTextureParameterIiv;
+    PFNGLGETTEXTUREPARAMETERIUIVPROC GetTextureParameterIuiv;
+    PFNGLGETTEXTUREPARAMETERIVPROC GetTextureParameteriv;
+    PFNGLCREATEVERTEXARRAYSPROC CreateVertexArrays;
+    PFNGLDISABLEVERTEXARRAYATTRIBPROC DisableVertexArrayAttrib;
+    PFNGLENABLEVERTEXARRAYATTRIBPROC EnableVertexArrayAttrib;
+    PFNGLVERTEXARRAYELEMENTBUFFERPROC VertexArrayElementBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERPROC VertexArrayVertexBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERSPROC VertexArrayVertexBuffers;
+    PFNGLVERTEXARRAYATTRIBBINDINGPROC VertexArrayAttribBinding;
+    PFNGLVERTEXARRAYATTRIBFORMATPROC VertexArrayAttribFormat;
+    PFNGLVERTEXARRAYATTRIBIFORMATPROC VertexArrayAttribIFormat;
+    PFNGLVERTEXARRAYATTRIBLFORMATPROC VertexArrayAttribLFormat;
+    PFNGLVERTEXARRAYBINDINGDIVISORPROC VertexArrayBindingDivisor;
+    PFNGLGETVERTEXARRAYIVPROC GetVertexArrayiv;
+    PFNGLGETVERTEXARRAYINDEXEDIVPROC GetVertexArrayIndexediv;
+    PFNGLGETVERTEXARRAYINDEXED64IVPROC GetVertexArrayIndexed64iv;
+    PFNGLCREATESAMPLERSPROC CreateSamplers;
+    PFNGLCREATEPROGRAMPIPELINESPROC CreateProgramPipelines;
+    PFNGLCREATEQUERIESPROC CreateQueries;
+    PFNGLGETQUERYBUFFEROBJECTI64VPROC GetQueryBufferObjecti64v;
+    PFNGLGETQUERYBUFFEROBJECTIVPROC GetQueryBufferObjectiv;
+    PFNGLGETQUERYBUFFEROBJECTUI64VPROC GetQueryBufferObjectui64v;
+    PFNGLGETQUERYBUFFEROBJECTUIVPROC GetQueryBufferObjectuiv;
+    PFNGLMEMORYBARRIERBYREGIONPROC MemoryBarrierByRegion;
+    PFNGLGETTEXTURESUBIMAGEPROC GetTextureSubImage;
+    PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC GetCompressedTextureSubImage;
+    PFNGLGETGRAPHICSRESETSTATUSPROC GetGraphicsResetStatus;
+    PFNGLGETNCOMPRESSEDTEXIMAGEPROC GetnCompressedTexImage;
+    PFNGLGETNTEXIMAGEPROC GetnTexImage;
+    PFNGLGETNUNIFORMDVPROC GetnUniformdv;
+    PFNGLGETNUNIFORMFVPROC GetnUniformfv;
+    PFNGLGETNUNIFORMIVPROC GetnUniformiv;
+    PFNGLGETNUNIFORMUIVPROC GetnUniformuiv;
+    PFNGLREADNPIXELSPROC ReadnPixels;
+    PFNGLTEXTUREBARRIERPROC TextureBarrier;
+    PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreadsKHR;
+} GladGLContext;
+
+GLAPI int gladLoadGLContext(GladGLContext *context, GLADloadproc load);
+
+GLAPI int gladContextHasExtension(const GladGLContext *context, const char *name);
+
+/* Frees the extension table; the function pointers stay usable. */
+GLAPI void gladUnloadGLContext(GladGLContext *context);
+
+#ifndef GLAD_THREAD_LOCAL
+# if defined(_MSC_VER)
+#  define GLAD_THREAD_LOCAL __declspec(thread)
+# elif defined(__GNUC__)
+#  define GLAD_THREAD_LOCAL __thread
+# elif defined(__cplusplus)
+#  define GLAD_THREAD_LOCAL thread_local
+# else
+#  define GLAD_THREAD_LOCAL _Thread_local
+# endif
+#endif
+
+/* The calling thread's current table, see GLAD_THREAD_LOCAL_DISPATCH. */
+GLAPI GLAD_THREAD_LOCAL GladGLContext *glad_gl_current_context;
+
+GLAPI void gladSetGLContext(GladGLContext *context);
+
+GLAPI GladGLContext *gladGetGLContext(void);
+
+/* With GLAD_THREAD_LOCAL_DISPATCH defined every gl* call goes through the
+ * calling thread's current table instead of the glad_gl* globals, so each
+ * thread calls into its own context. A thread has to gladSetGLContext a
+ * loaded table before its first GL call. */
+#ifdef GLAD_THREAD_LOCAL_DISPATCH
+#undef glCullFace
+#define glCullFace (glad_gl_current_context->CullFace)
+#undef glFrontFace
+#define glFrontFace (glad_gl_current_context->FrontFace)
+#undef glHint
+#define glHint (glad_gl_current_context->Hint)
+#undef glLineWidth
+#define glLineWidth (glad_gl_current_context->LineWidth)
+#undef glPointSize
+#define glPointSize (glad_gl_current_context->PointSize)
+#undef glPolygonMode
+#define glPolygonMode (glad_gl_current_context->PolygonMode)
+#undef glScissor
+#define glScissor (glad_gl_current_context->Scissor)
+#undef glTexParameterf
+#define glTexParameterf (glad_gl_current_context->TexParameterf)
+#undef glTexParameterfv
+#define glTexParameterfv (glad_gl_current_context->TexParameterfv)
+#undef glTexParameteri
+#define glTexParameteri (glad_gl_current_context->TexParameteri)
+#undef glTexParameteriv
+#define glTexParameteriv (glad_gl_current_context->TexParameteriv)
+#undef glTexImage1D
+#define glTexImage1D (glad_gl_current_context->TexImage1D)
+#undef glTexImage2D
+#define glTexImage2D (glad_gl_current_context->TexImage2D)
+#undef glDrawBuffer
+#define glDrawBuffer (glad_gl_current_context->DrawBuffer)
+#undef glClear
+#define glClear (glad_gl_current_context->Clear)
+#undef glClearColor
+#define glClearColor (glad_gl_current_context->ClearColor)
+#undef glClearStencil
+#define glClearStencil (glad_gl_current_context->ClearStencil)
+#undef glClearDepth
+#define glClearDepth (glad_gl_current_context->ClearDepth)
+#undef glStencilMask
+#define glStencilMask (glad_gl_current_context->StencilMask)
+#undef glColorMask
+#define glColorMask (glad_gl_current_context->ColorMask)
+#undef glDepthMask
+#define glDepthMask (glad_gl_current_context->DepthMask)
+#undef glDisable
+#define glDisable (glad_gl_current_context->Disable)
+#undef glEnable
+#define glEnable (glad_gl_current_context->Enable)
+#undef glFinish
+#define glFinish (glad_gl_current_context->Finish)
+#undef glFlush
+#define glFlush (glad_gl_current_context->Flush)
+#undef glBlendFunc
+#define glBlendFunc (glad_gl_current_context->BlendFunc)
+#undef glLogicOp
+#define glLogicOp (glad_gl_current_context->LogicOp)
+#undef glStencilFunc
+#define glStencilFunc (glad_gl_current_context->StencilFunc)
+#undef glStencilOp
+#define glStencilOp (glad_gl_current_context->StencilOp)
+#undef glDepthFunc
+#define glDepthFunc (glad_gl_current_context->DepthFunc)
+#undef glPixelStoref
+#define glPixelStoref (glad_gl_current_context->PixelStoref)
+#undef glPixelStorei
+#define glPixelStorei (glad_gl_current_context->PixelStorei)
+#undef glReadBuffer
+#define glReadBuffer (glad_gl_current_context->ReadBuffer)
+#undef glReadPixels
+#define glReadPixels (glad_gl_current_context->ReadPixels)
+#undef glGetBooleanv
+#define glGetBooleanv (glad_gl_current_context->GetBooleanv)
+#undef glGetDoublev
+#define glGetDoublev (glad_gl_current_context->GetDoublev)
+#undef glGetError
+#define glGetError (glad_gl_current_context->GetError)
+#undef glGetFloatv
+#define glGetFloatv (glad_gl_current_context->GetFloatv)
+#undef glGetIntegerv
+#define glGetIntegerv (glad_gl_current_context->GetIntegerv)
+#undef glGetString
+#define glGetString (glad_gl_current_context->GetString)
+#undef glGetTexImage
+#define glGetTexImage (glad_gl_current_context->GetTexImage)
+#undef glGetTexParameterfv
+#define glGetTexParameterfv (glad_gl_current_context->GetTexParameterfv)
+#undef glGetTexParameteriv
+#define glGetTexParameteriv (glad_gl_current_context->GetTexParameteriv)
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv (glad_gl_current_context->GetTexLevelParameterfv)
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv (glad_gl_current_context->GetTexLevelParameteriv)
+#undef glIsEnabled
+#define glIsEnabled (glad_gl_current_context->IsEnabled)
+#undef glDepthRange
+#define glDepthRange (glad_gl_current_context->DepthRange)
+#undef glViewport
+#define glViewport (glad_gl_current_context->Viewport)
+#undef glDrawArrays
+#define glDrawArrays (glad_gl_current_context->DrawArrays)
+#undef glDrawElements
+#define glDrawElements (glad_gl_current_context->DrawElements)
+#undef glPolygonOffset
+#define glPolygonOffset (glad_gl_current_context->PolygonOffset)
+#undef glCopyTexImage1D
+#define glCopyTexImage1D (glad_gl_current_context->CopyTexImage1D)
+#undef glCopyTexImage2D
+#define glCopyTexImage2D (glad_gl_current_context->CopyTexImage2D)
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D (glad_gl_current_context->CopyTexSubImage1D)
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D (glad_gl_current_context->CopyTexSubImage2D)
+#undef glTexSubImage1D
+#define glTexSubImage1D (glad_gl_current_context->TexSubImage1D)
+#undef glTexSubImage2D
+#define glTexSubImage2D (glad_gl_current_context->TexSubImage2D)
+#undef glBindTexture
+#define glBindTexture (glad_gl_current_context->BindTexture)
+#undef glDeleteTextures
+#define glDeleteTextures (glad_gl_current_context->DeleteTextures)
+#undef glGenTextures
+#define glGenTextures (glad_gl_current_context->GenTextures)
+#undef glIsTexture
+#define glIsTexture (glad_gl_current_context->IsTexture)
+#undef glDrawRangeElements
+#define glDrawRangeElements (glad_gl_current_context->DrawRangeElements)
+#undef glTexImage3D
+#define glTexImage3D (glad_gl_current_context->TexImage3D)
+#undef glTexSubImage3D
+#define glTexSubImage3D (glad_gl_current_context->TexSubImage3D)
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D (glad_gl_current_context->CopyTexSubImage3D)
+#undef glActiveTexture
+#define glActiveTexture (glad_gl_current_context->ActiveTexture)
+#undef glSampleCoverage
+#define glSampleCoverage (glad_gl_current_context->SampleCoverage)
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D (glad_gl_current_context->CompressedTexImage3D)
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D (glad_gl_current_context->CompressedTexImage2D)
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D (glad_gl_current_context->CompressedTexImage1D)
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D (glad_gl_current_context->CompressedTexSubImage3D)
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D (glad_gl_current_context->CompressedTexSubImage2D)
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D (glad_gl_current_context->CompressedTexSubImage1D)
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage (glad_gl_current_context->GetCompressedTexImage)
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate (glad_gl_current_context->BlendFuncSeparate)
+#undef glMultiDrawArrays
+#define glMultiDrawArrays (glad_gl_current_context->MultiDrawArrays)
+#undef glMultiDrawElements
+#define glMultiDrawElements (glad_gl_current_context->MultiDrawElements)
+#undef glPointParameterf
+#define glPointParameterf (glad_gl_current_context->PointParameterf)
+#undef glPointParameterfv
+#define glPointParameterfv (glad_gl_current_context->PointParameterfv)
+#undef glPointParameteri
+#define glPointParameteri (glad_gl_current_context->PointParameteri)
+#undef glPointParameteriv
+#define glPointParameteriv (glad_gl_current_context->PointParameteriv)
+#undef glBlendColor
+#define glBlendColor (glad_gl_current_context->BlendColor)
+#undef glBlendEquation
+#define glBlendEquation (glad_gl_current_context->BlendEquation)
+#undef glGenQueries
+#define glGenQueries (glad_gl_current_context->GenQueries)
+#undef glDeleteQueries
+#define glDeleteQueries (glad_gl_current_context->DeleteQueries)
+#undef glIsQuery
+#define glIsQuery (glad_gl_current_context->IsQuery)
+#undef glBeginQuery
+#define glBeginQuery (glad_gl_current_context->BeginQuery)
+#undef glEndQuery
+#define glEndQuery (glad_gl_current_context->EndQuery)
+#undef glGetQueryiv
+#define glGetQueryiv (glad_gl_current_context->GetQueryiv)
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv (glad_gl_current_context->GetQueryObjectiv)
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv (glad_gl_current_context->GetQueryObjectuiv)
+#undef glBindBuffer
+#define glBindBuffer (glad_gl_current_context->BindBuffer)
+#undef glDeleteBuffers
+#define glDeleteBuffers (glad_gl_current_context->DeleteBuffers)
+#undef glGenBuffers
+#define glGenBuffers (glad_gl_current_context->GenBuffers)
+#undef glIsBuffer
+#define glIsBuffer (glad_gl_current_context->IsBuffer)
+#undef glBufferData
+#define glBufferData (glad_gl_current_context->BufferData)
+#undef glBufferSubData
+#define glBufferSubData (glad_gl_current_context->BufferSubData)
+#undef glGetBufferSubData
+#define glGetBufferSubData (glad_gl_current_context->GetBufferSubData)
+#undef glMapBuffer
+#define glMapBuffer (glad_gl_current_context->MapBuffer)
+#undef glUnmapBuffer
+#define glUnmapBuffer (glad_gl_current_context->UnmapBuffer)
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv (glad_gl_current_context->GetBufferParameteriv)
+#undef glGetBufferPointerv
+#define glGetBufferPointerv (glad_gl_current_context->GetBufferPointerv)
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate (glad_gl_current_context->BlendEquationSeparate)
+#undef glDrawBuffers
+#define glDrawBuffers (glad_gl_current_context->DrawBuffers)
+#undef glStencilOpSeparate
+#define glStencilOpSeparate (glad_gl_current_context->StencilOpSeparate)
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate (glad_gl_current_context->StencilFuncSeparate)
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate (glad_gl_current_context->StencilMaskSeparate)
+#undef glAttachShader
+#define glAttachShader (glad_gl_current_context->AttachShader)
+#undef glBindAttribLocation
+#define glBindAttribLocation (glad_gl_current_context->BindAttribLocation)
+#undef glCompileShader
+#define glCompileShader (glad_gl_current_context->CompileShader)
+#undef glCreateProgram
+#define glCreateProgram (glad_gl_current_context->CreateProgram)
+#undef glCreateShader
+#define glCreateShader (glad_gl_current_context->CreateShader)
+#undef glDeleteProgram
+#define glDeleteProgram (glad_gl_current_context->DeleteProgram)
+#undef glDeleteShader
+#define glDeleteShader (glad_gl_current_context->DeleteShader)
+#undef glDetachShader
+#define glDetachShader (glad_gl_current_context->DetachShader)
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray (glad_gl_current_context->DisableVertexAttribArray)
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray (glad_gl_current_context->EnableVertexAttribArray)
+#undef glGetActiveAttrib
+#define glGetActiveAttrib (glad_gl_current_context->GetActiveAttrib)
+#undef glGetActiveUniform
+#define glGetActiveUniform (glad_gl_current_context->GetActiveUniform)
+#undef glGetAttachedShaders
+#define glGetAttachedShaders (glad_gl_current_context->GetAttachedShaders)
+#undef glGetAttribLocation
+#define glGetAttribLocation (glad_gl_current_context->GetAttribLocation)
+#undef glGetProgramiv
+#define glGetProgramiv (glad_gl_current_context->GetProgramiv)
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog (glad_gl_current_context->GetProgramInfoLog)
+#undef glGetShaderiv
+#define glGetShaderiv (glad_gl_current_context->GetShaderiv)
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog (glad_gl_current_context->GetShaderInfoLog)
+#undef glGetShaderSource
+#define glGetShaderSource (glad_gl_current_context->GetShaderSource)
+#undef glGetUniformLocation
+#define glGetUniformLocation (glad_gl_current_context->GetUniformLocation)
+#undef glGetUniformfv
+#define glGetUniformfv (glad_gl_current_context->GetUniformfv)
+#undef glGetUniformiv
+#define glGetUniformiv (glad_gl_current_context->GetUniformiv)
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv (glad_gl_current_context->GetVertexAttribdv)
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv (glad_gl_current_context->GetVertexAttribfv)
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv (glad_gl_current_context->GetVertexAttribiv)
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv (glad_gl_current_context->GetVertexAttribPointerv)
+#undef glIsProgram
+#define glIsProgram (glad_gl_current_context->IsProgram)
+#undef glIsShader
+#define glIsShader (glad_gl_current_context->IsShader)
+#undef glLinkProgram
+#define glLinkProgram (glad_gl_current_context->LinkProgram)
+#undef glShaderSource
+#define glShaderSource (glad_gl_current_context->ShaderSource)
+#undef glUseProgram
+#define glUseProgram (glad_gl_current_context->UseProgram)
+#undef glUniform1f
+#define glUniform1f (glad_gl_current_context->Uniform1f)
+#undef glUniform2f
+#define glUniform2f (glad_gl_current_context->Uniform2f)
+#undef glUniform3f
+#define glUniform3f (glad_gl_current_context->Uniform3f)
+#undef glUniform4f
+#define glUniform4f (glad_gl_current_context->Uniform4f)
+#undef glUniform1i
+#define glUniform1i (glad_gl_current_context->Uniform1i)
+#undef glUniform2i
+#define glUniform2i (glad_gl_current_context->Uniform2i)
+#undef glUniform3i
+#define glUniform3i (glad_gl_current_context->Uniform3i)
+#undef glUniform4i
+#define glUniform4i (glad_gl_current_context->Uniform4i)
+#undef glUniform1fv
+#define glUniform1fv (glad_gl_current_context->Uniform1fv)
+#undef glUniform2fv
+#define glUniform2fv (glad_gl_current_context->Uniform2fv)
+#undef glUniform3fv
+#define glUniform3fv (glad_gl_current_context->Uniform3fv)
+#undef glUniform4fv
+#define glUniform4fv (glad_gl_current_context->Uniform4fv)
+#undef glUniform1iv
+#define glUniform1iv (glad_gl_current_context->Uniform1iv)
+#undef glUniform2iv
+#define glUniform2iv (glad_gl_current_context->Uniform2iv)
+#undef glUniform3iv
+#define glUniform3iv (glad_gl_current_context->Uniform3iv)
+#undef glUniform4iv
+#define glUniform4iv (glad_gl_current_context->Uniform4iv)
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv (glad_gl_current_context->UniformMatrix2fv)
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv (glad_gl_current_context->UniformMatrix3fv)
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv (glad_gl_current_context->UniformMatrix4fv)
+#undef glValidateProgram
+#define glValidateProgram (glad_gl_current_context->ValidateProgram)
+#undef glVertexAttrib1d
+#define glVertexAttrib1d (glad_gl_current_context->VertexAttrib1d)
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv (glad_gl_current_context->VertexAttrib1dv)
+#undef glVertexAttrib1f
+#define glVertexAttrib1f (glad_gl_current_context->VertexAttrib1f)
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv (glad_gl_current_context->VertexAttrib1fv)
+#undef glVertexAttrib1s
+#define glVertexAttrib1s (glad_gl_current_context->VertexAttrib1s)
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv (glad_gl_current_context->VertexAttrib1sv)
+#undef glVertexAttrib2d
+#define glVertexAttrib2d (glad_gl_current_context->VertexAttrib2d)
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv (glad_gl_current_context->VertexAttrib2dv)
+#undef glVertexAttrib2f
+#define glVertexAttrib2f (glad_gl_current_context->VertexAttrib2f)
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv (glad_gl_current_context->VertexAttrib2fv)
+#undef glVertexAttrib2s
+#define glVertexAttrib2s (glad_gl_current_context->VertexAttrib2s)
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv (glad_gl_current_context->VertexAttrib2sv)
+#undef glVertexAttrib3d
+#define glVertexAttrib3d (glad_gl_current_context->VertexAttrib3d)
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv (glad_gl_current_context->VertexAttrib3dv)
+#undef glVertexAttrib3f
+#define glVertexAttrib3f (glad_gl_current_context->VertexAttrib3f)
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv (glad_gl_current_context->VertexAttrib3fv)
+#undef glVertexAttrib3s
+#define glVertexAttrib3s (glad_gl_current_context->VertexAttrib3s)
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv (glad_gl_current_context->VertexAttrib3sv)
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv (glad_gl_current_context->VertexAttrib4Nbv)
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv (glad_gl_current_context->VertexAttrib4Niv)
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv (glad_gl_current_context->VertexAttrib4Nsv)
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub (glad_gl_current_context->VertexAttrib4Nub)
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv (glad_gl_current_context->VertexAttrib4Nubv)
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv (glad_gl_current_context->VertexAttrib4Nuiv)
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv (glad_gl_current_context->VertexAttrib4Nusv)
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv (glad_gl_current_context->VertexAttrib4bv)
+#undef glVertexAttrib4d
+#define glVertexAttrib4d (glad_gl_current_context->VertexAttrib4d)
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv (glad_gl_current_context->VertexAttrib4dv)
+#undef glVertexAttrib4f
+#define glVertexAttrib4f (glad_gl_current_context->VertexAttrib4f)
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv (glad_gl_current_context->VertexAttrib4fv)
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv (glad_gl_current_context->VertexAttrib4iv)
+#undef glVertexAttrib4s
+#define glVertexAttrib4s (glad_gl_current_context->VertexAttrib4s)
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv (glad_gl_current_context->VertexAttrib4sv)
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv (glad_gl_current_context->VertexAttrib4ubv)
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv (glad_gl_current_context->VertexAttrib4uiv)
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv (glad_gl_current_context->VertexAttrib4usv)
+#undef glVertexAttribPointer
+#define glVertexAttribPointer (glad_gl_current_context->VertexAttribPointer)
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv (glad_gl_current_context->UniformMatrix2x3fv)
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv (glad_gl_current_context->UniformMatrix3x2fv)
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv (glad_gl_current_context->UniformMatrix2x4fv)
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv (glad_gl_current_context->UniformMatrix4x2fv)
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv (glad_gl_current_context->UniformMatrix3x4fv)
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv (glad_gl_current_context->UniformMatrix4x3fv)
+#undef glColorMaski
+#define glColorMaski (glad_gl_current_context->ColorMaski)
+#undef glGetBooleani_v
+#define glGetBooleani_v (glad_gl_current_context->GetBooleani_v)
+#undef glGetIntegeri_v
+#define glGetIntegeri_v (glad_gl_current_context->GetIntegeri_v)
+#undef glEnablei
+#define glEnablei (glad_gl_current_context->Enablei)
+#undef glDisablei
+#define glDisablei (glad_gl_current_context->Disablei)
+#undef glIsEnabledi
+#define glIsEnabledi (glad_gl_current_context->IsEnabledi)
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback (glad_gl_current_context->BeginTransformFeedback)
+#undef glEndTransformFeedback
+#define glEndTransformFeedback (glad_gl_current_context->EndTransformFeedback)
+#undef glBindBufferRange
+#define glBindBufferRange (glad_gl_current_context->BindBufferRange)
+#undef glBindBufferBase
+#define glBindBufferBase (glad_gl_current_context->BindBufferBase)
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings (glad_gl_current_context->TransformFeedbackVaryings)
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying (glad_gl_current_context->GetTransformFeedbackVarying)
+#undef glClampColor
+#define glClampColor (glad_gl_current_context->ClampColor)
+#undef glBeginConditionalRender
+#define glBeginConditionalRender (glad_gl_current_context->BeginConditionalRender)
+#undef glEndConditionalRender
+#define glEndConditionalRender (glad_gl_current_context->EndConditionalRender)
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer (glad_gl_current_context->VertexAttribIPointer)
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv (glad_gl_current_context->GetVertexAttribIiv)
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv (glad_gl_current_context->GetVertexAttribIuiv)
+#undef glVertexAttribI1i
+#define glVertexAttribI1i (glad_gl_current_context->VertexAttribI1i)
+#undef glVertexAttribI2i
+#define glVertexAttribI2i (glad_gl_current_context->VertexAttribI2i)
+#undef glVertexAttribI3i
+#define glVertexAttribI3i (glad_gl_current_context->VertexAttribI3i)
+#undef glVertexAttribI4i
+#define glVertexAttribI4i (glad_gl_current_context->VertexAttribI4i)
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui (glad_gl_current_context->VertexAttribI1ui)
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui (glad_gl_current_context->VertexAttribI2ui)
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui (glad_gl_current_context->VertexAttribI3ui)
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui (glad_gl_current_context->VertexAttribI4ui)
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv (glad_gl_current_context->VertexAttribI1iv)
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv (glad_gl_current_context->VertexAttribI2iv)
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv (glad_gl_current_context->VertexAttribI3iv)
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv (glad_gl_current_context->VertexAttribI4iv)
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv (glad_gl_current_context->VertexAttribI1uiv)
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv (glad_gl_current_context->VertexAttribI2uiv)
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv (glad_gl_current_context->VertexAttribI3uiv)
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv (glad_gl_current_context->VertexAttribI4uiv)
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv (glad_gl_current_context->VertexAttribI4bv)
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv (glad_gl_current_context->VertexAttribI4sv)
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv (glad_gl_current_context->VertexAttribI4ubv)
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv (glad_gl_current_context->VertexAttribI4usv)
+#undef glGetUniformuiv
+#define glGetUniformuiv (glad_gl_current_context->GetUniformuiv)
+#undef glBindFragDataLocation
+#define glBindFragDataLocation (glad_gl_current_context->BindFragDataLocation)
+#undef glGetFragDataLocation
+#define glGetFragDataLocation (glad_gl_current_context->GetFragDataLocation)
+#undef glUniform1ui
+#define glUniform1ui (glad_gl_current_context->Uniform1ui)
+#undef glUniform2ui
+#define glUniform2ui (glad_gl_current_context->Uniform2ui)
+#undef glUniform3ui
+#define glUniform3ui (glad_gl_current_context->Uniform3ui)
+#undef glUniform4ui
+#define glUniform4ui (glad_gl_current_context->Uniform4ui)
+#undef glUniform1uiv
+#define glUniform1uiv (glad_gl_current_context->Uniform1uiv)
+#undef glUniform2uiv
+#define glUniform2uiv (glad_gl_current_context->Uniform2uiv)
+#undef glUniform3uiv
+#define glUniform3uiv (glad_gl_current_context->Uniform3uiv)
+#undef glUniform4uiv
+#define glUniform4uiv (glad_gl_current_context->Uniform4uiv)
+#undef glTexParameterIiv
+#define glTexParameterIiv (glad_gl_current_context->TexParameterIiv)
+#undef glTexParameterIuiv
+#define glTexParameterIuiv (glad_gl_current_context->TexParameterIuiv)
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv (glad_gl_current_context->GetTexParameterIiv)
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv (glad_gl_current_context->GetTexParameterIuiv)
+#undef glClearBufferiv
+#define glClearBufferiv (glad_gl_current_context->ClearBufferiv)
+#undef glClearBufferuiv
+#define glClearBufferuiv (glad_gl_current_context->ClearBufferuiv)
+#undef glClearBufferfv
+#define glClearBufferfv (glad_gl_current_context->ClearBufferfv)
+#undef glClearBufferfi
+#define glClearBufferfi (glad_gl_current_context->ClearBufferfi)
+#undef glGetStringi
+#define glGetStringi (glad_gl_current_context->GetStringi)
+#undef glIsRenderbuffer
+#define glIsRenderbuffer (glad_gl_current_context->IsRenderbuffer)
+#undef glBindRenderbuffer
+#define glBindRenderbuffer (glad_gl_current_context->BindRenderbuffer)
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers (glad_gl_current_context->DeleteRenderbuffers)
+#undef glGenRenderbuffers
+#define glGenRenderbuffers (glad_gl_current_context->GenRenderbuffers)
+#undef glRenderbufferStorage
+#define glRenderbufferStorage (glad_gl_current_context->RenderbufferStorage)
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv (glad_gl_current_context->GetRenderbufferParameteriv)
+#undef glIsFramebuffer
+#define glIsFramebuffer (glad_gl_current_context->IsFramebuffer)
+#undef glBindFramebuffer
+#define glBindFramebuffer (glad_gl_current_context->BindFramebuffer)
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers (glad_gl_current_context->DeleteFramebuffers)
+#undef glGenFramebuffers
+#define glGenFramebuffers (glad_gl_current_context->GenFramebuffers)
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus (glad_gl_current_context->CheckFramebufferStatus)
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D (glad_gl_current_context->FramebufferTexture1D)
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D (glad_gl_current_context->FramebufferTexture2D)
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D (glad_gl_current_context->FramebufferTexture3D)
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer (glad_gl_current_context->FramebufferRenderbuffer)
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv (glad_gl_current_context->GetFramebufferAttachmentParameteriv)
+#undef glGenerateMipmap
+#define glGenerateMipmap (glad_gl_current_context->GenerateMipmap)
+#undef glBlitFramebuffer
+#define glBlitFramebuffer (glad_gl_current_context->BlitFramebuffer)
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample (glad_gl_current_context->RenderbufferStorageMultisample)
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer (glad_gl_current_context->FramebufferTextureLayer)
+#undef glMapBufferRange
+#define glMapBufferRange (glad_gl_current_context->MapBufferRange)
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange (glad_gl_current_context->FlushMappedBufferRange)
+#undef glBindVertexArray
+#define glBindVertexArray (glad_gl_current_context->BindVertexArray)
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays (glad_gl_current_context->DeleteVertexArrays)
+#undef glGenVertexArrays
+#define glGenVertexArrays (glad_gl_current_context->GenVertexArrays)
+#undef glIsVertexArray
+#define glIsVertexArray (glad_gl_current_context->IsVertexArray)
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced (glad_gl_current_context->DrawArraysInstanced)
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced (glad_gl_current_context->DrawElementsInstanced)
+#undef glTexBuffer
+#define glTexBuffer (glad_gl_current_context->TexBuffer)
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex (glad_gl_current_context->PrimitiveRestartIndex)
+#undef glCopyBufferSubData
+#define glCopyBufferSubData (glad_gl_current_context->CopyBufferSubData)
+#undef glGetUniformIndices
+#define glGetUniformIndices (glad_gl_current_context->GetUniformIndices)
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv (glad_gl_current_context->GetActiveUniformsiv)
+#undef glGetActiveUniformName
+#define glGetActiveUniformName (glad_gl_current_context->GetActiveUniformName)
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex (glad_gl_current_context->GetUniformBlockIndex)
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv (glad_gl_current_context->GetActiveUniformBlockiv)
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName (glad_gl_current_context->GetActiveUniformBlockName)
+#undef glUniformBlockBinding
+#define glUniformBlockBinding (glad_gl_current_context->UniformBlockBinding)
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex (glad_gl_current_context->DrawElementsBaseVertex)
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex (glad_gl_current_context->DrawRangeElementsBaseVertex)
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex (glad_gl_current_context->DrawElementsInstancedBaseVertex)
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex (glad_gl_current_context->MultiDrawElementsBaseVertex)
+#undef glProvokingVertex
+#define glProvokingVertex (glad_gl_current_context->ProvokingVertex)
+#undef glFenceSync
+#define glFenceSync (glad_gl_current_context->FenceSync)
+#undef glIsSync
+#define glIsSync (glad_gl_current_context->IsSync)
+#undef glDeleteSync
+#define glDeleteSync (glad_gl_current_context->DeleteSync)
+#undef glClientWaitSync
+#define glClientWaitSync (glad_gl_current_context->ClientWaitSync)
+#undef glWaitSync
+#define glWaitSync (glad_gl_current_context->WaitSync)
+#undef glGetInteger64v
+#define glGetInteger64v (glad_gl_current_context->GetInteger64v)
+#undef glGetSynciv
+#define glGetSynciv (glad_gl_current_context->GetSynciv)
+#undef glGetInteger64i_v
+#define glGetInteger64i_v (glad_gl_current_context->GetInteger64i_v)
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v (glad_gl_current_context->GetBufferParameteri64v)
+#undef glFramebufferTexture
+#define glFramebufferTexture (glad_gl_current_context->FramebufferTexture)
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample (glad_gl_current_context->TexImage2DMultisample)
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample (glad_gl_current_context->TexImage3DMultisample)
+#undef glGetMultisamplefv
+#define glGetMultisamplefv (glad_gl_current_context->GetMultisamplefv)
+#undef glSampleMaski
+#define glSampleMaski (glad_gl_current_context->SampleMaski)
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed (glad_gl_current_context->BindFragDataLocationIndexed)
+#undef glGetFragDataIndex
+#define glGetFragDataIndex (glad_gl_current_context->GetFragDataIndex)
+#undef glGenSamplers
+#define glGenSamplers (glad_gl_current_context->GenSamplers)
+#undef glDeleteSamplers
+#define glDeleteSamplers (glad_gl_current_context->DeleteSamplers)
+#undef glIsSampler
+#define glIsSampler (glad_gl_current_context->IsSampler)
+#undef glBindSampler
+#define glBindSampler (glad_gl_current_context->BindSampler)
+#undef glSamplerParameteri
+#define glSamplerParameteri (glad_gl_current_context->SamplerParameteri)
+#undef glSamplerParameteriv
+#define glSamplerParameteriv (glad_gl_current_context->SamplerParameteriv)
+#undef glSamplerParameterf
+#define glSamplerParameterf (glad_gl_current_context->SamplerParameterf)
+#undef glSamplerParameterfv
+#define glSamplerParameterfv (glad_gl_current_context->SamplerParameterfv)
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv (glad_gl_current_context->SamplerParameterIiv)
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv (glad_gl_current_context->SamplerParameterIuiv)
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv (glad_gl_current_context->GetSamplerParameteriv)
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv (glad_gl_current_context->GetSamplerParameterIiv)
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv (glad_gl_current_context->GetSamplerParameterfv)
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv (glad_gl_current_context->GetSamplerParameterIuiv)
+#undef glQueryCounter
+#define glQueryCounter (glad_gl_current_context->QueryCounter)
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v (glad_gl_current_context->GetQueryObjecti64v)
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v (glad_gl_current_context->GetQueryObjectui64v)
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor (glad_gl_current_context->VertexAttribDivisor)
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui (glad_gl_current_context->VertexAttribP1ui)
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv (glad_gl_current_context->VertexAttribP1uiv)
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui (glad_gl_current_context->VertexAttribP2ui)
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv (glad_gl_current_context->VertexAttribP2uiv)
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui (glad_gl_current_context->VertexAttribP3ui)
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv (glad_gl_current_context->VertexAttribP3uiv)
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui (glad_gl_current_context->VertexAttribP4ui)
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv (glad_gl_current_context->VertexAttribP4uiv)
+#undef glVertexP2ui
+#define glVertexP2ui (glad_gl_current_context->VertexP2ui)
+#undef glVertexP2uiv
+#define glVertexP2uiv (glad_gl_current_context->VertexP2uiv)
+#undef glVertexP3ui
+#define glVertexP3ui (glad_gl_current_context->VertexP3ui)
+#undef glVertexP3uiv
+#define glVertexP3uiv (glad_gl_current_context->VertexP3uiv)
+#undef glVertexP4ui
+#define glVertexP4ui (glad_gl_current_context->VertexP4ui)
+#undef glVertexP4uiv
+#define glVertexP4uiv (glad_gl_current_context->VertexP4uiv)
+#undef glTexCoordP1ui
+#define glTexCoordP1ui (glad_gl_current_context->TexCoordP1ui)
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv (glad_gl_current_context->TexCoordP1uiv)
+#undef glTexCoordP2ui
+#define glTexCoordP2ui (glad_gl_current_context->TexCoordP2ui)
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv (glad_gl_current_context->TexCoordP2uiv)
+#undef glTexCoordP3ui
+#define glTexCoordP3ui (glad_gl_current_context->TexCoordP3ui)
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv (glad_gl_current_context->TexCoordP3uiv)
+#undef glTexCoordP4ui
+#define glTexCoordP4ui (glad_gl_current_context->TexCoordP4ui)
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv (glad_gl_current_context->TexCoordP4uiv)
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui (glad_gl_current_context->MultiTexCoordP1ui)
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv (glad_gl_current_context->MultiTexCoordP1uiv)
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui (glad_gl_current_context->MultiTexCoordP2ui)
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv (glad_gl_current_context->MultiTexCoordP2uiv)
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui (glad_gl_current_context->MultiTexCoordP3ui)
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv (glad_gl_current_context->MultiTexCoordP3uiv)
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui (glad_gl_current_context->MultiTexCoordP4ui)
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv (glad_gl_current_context->MultiTexCoordP4uiv)
+#undef glNormalP3ui
+#define glNormalP3ui (glad_gl_current_context->NormalP3ui)
+#undef glNormalP3uiv
+#define glNormalP3uiv (glad_gl_current_context->NormalP3uiv)
+#undef glColorP3ui
+#define glColorP3ui (glad_gl_current_context->ColorP3ui)
+#undef glColorP3uiv
+#define glColorP3uiv (glad_gl_current_context->ColorP3uiv)
+#undef glColorP4ui
+#define glColorP4ui (glad_gl_current_context->ColorP4ui)
+#undef glColorP4uiv
+#define glColorP4uiv (glad_gl_current_context->ColorP4uiv)
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui (glad_gl_current_context->SecondaryColorP3ui)
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv (glad_gl_current_context->SecondaryColorP3uiv)
+#undef glMinSampleShading
+#define glMinSampleShading (glad_gl_current_context->MinSampleShading)
+#undef glBlendEquationi
+#define glBlendEquationi (glad_gl_current_context->BlendEquationi)
+#undef glBlendEquationSeparatei
+#define glBlendEquationSeparatei (glad_gl_current_context->BlendEquationSeparatei)
+#undef glBlendFunci
+#define glBlendFunci (glad_gl_current_context->BlendFunci)
+#undef glBlendFuncSeparatei
+#define glBlendFuncSeparatei (glad_gl_current_context->BlendFuncSeparatei)
+#undef glDrawArraysIndirect
+#define glDrawArraysIndirect (glad_gl_current_context->DrawArraysIndirect)
+#undef glDrawElementsIndirect
+#define glDrawElementsIndirect (glad_gl_current_context->DrawElementsIndirect)
+#undef glUniform1d
+#define glUniform1d (glad_gl_current_context->Uniform1d)
+#undef glUniform2d
+#define glUniform2d (glad_gl_current_context->Uniform2d)
+#undef glUniform3d
+#define glUniform3d (glad_gl_current_context->Uniform3d)
+#undef glUniform4d
+#define glUniform4d (glad_gl_current_context->Uniform4d)
+#undef glUniform1dv
+#define glUniform1dv (glad_gl_current_context->Uniform1dv)
+#undef glUniform2dv
+#define glUniform2dv (glad_gl_current_context->Uniform2dv)
+#undef glUniform3dv
+#define glUniform3dv (glad_gl_current_context->Uniform3dv)
+#undef glUniform4dv
+#define glUniform4dv (glad_gl_current_context->Uniform4dv)
+#undef glUniformMatrix2dv
+#define glUniformMatrix2dv (glad_gl_current_context->UniformMatrix2dv)
+#undef glUniformMatrix3dv
+#define glUniformMatrix3dv (glad_gl_current_context->UniformMatrix3dv)
+#undef glUniformMatrix4dv
+#define glUniformMatrix4dv (glad_gl_current_context->UniformMatrix4dv)
+#undef glUniformMatrix2x3dv
+#define glUniformMatrix2x3dv (glad_gl_current_context->UniformMatrix2x3dv)
+#undef glUniformMatrix2x4dv
+#define glUniformMatrix2x4dv (glad_gl_current_context->UniformMatrix2x4dv)
+#undef glUniformMatrix3x2dv
+#define glUniformMatrix3x2dv (glad_gl_current_context->UniformMatrix3x2dv)
+#undef glUniformMatrix3x4dv
+#define glUniformMatrix3x4dv (glad_gl_current_context->UniformMatrix3x4dv)
+#undef glUniformMatrix4x2dv
+#define glUniformMatrix4x2dv (glad_gl_current_context->UniformMatrix4x2dv)
+#undef glUniformMatrix4x3dv
+#define glUniformMatrix4x3dv (glad_gl_current_context->UniformMatrix4x3dv)
+#undef glGetUniformdv
+#define glGetUniformdv (glad_gl_current_context->GetUniformdv)
+#undef glGetSubroutineUniformLocation
+#define glGetSubroutineUniformLocation (glad_gl_current_context->GetSubroutineUniformLocation)
+#undef glGetSubroutineIndex
+#define glGetSubroutineIndex (glad_gl_current_context->GetSubroutineIndex)
+#undef glGetActiveSubroutineUniformiv
+#define glGetActiveSubroutineUniformiv (glad_gl_current_context->GetActiveSubroutineUniformiv)
+#undef glGetActiveSubroutineUniformName
+#define glGetActiveSubroutineUniformName (glad_gl_current_context->GetActiveSubroutineUniformName)
+#undef glGetActiveSubroutineName
+#define glGetActiveSubroutineName (glad_gl_current_context->GetActiveSubroutineName)
+#undef glUniformSubroutinesuiv
+#define glUniformSubroutinesuiv (glad_gl_current_context->UniformSubroutinesuiv)
+#undef glGetUniformSubroutineuiv
+#define glGetUniformSubroutineuiv (glad_gl_current_context->GetUniformSubroutineuiv)
+#undef glGetProgramStageiv
+#define glGetProgramStageiv (glad_gl_current_context->GetProgramStageiv)
+#undef glPatchParameteri
+#define glPatchParameteri (glad_gl_current_context->PatchParameteri)
+#undef glPatchParameterfv
+#define glPatchParameterfv (glad_gl_current_context->PatchParameterfv)
+#undef glBindTransformFeedback
+#define glBindTransformFeedback (glad_gl_current_context->BindTransformFeedback)
+#undef glDeleteTransformFeedbacks
+#define glDeleteTransformFeedbacks (glad_gl_current_context->DeleteTransformFeedbacks)
+#undef glGenTransformFeedbacks
+#define glGenTransformFeedbacks (glad_gl_current_context->GenTransformFeedbacks)
+#undef glIsTransformFeedback
+#define glIsTransformFeedback (glad_gl_current_context->IsTransformFeedback)
+#undef glPauseTransformFeedback
+#define glPauseTransformFeedback (glad_gl_current_context->PauseTransformFeedback)
+#undef glResumeTransformFeedback
+#define glResumeTransformFeedback (glad_gl_current_context->ResumeTransformFeedback)
+#undef glDrawTransformFeedback
+#define glDrawTransformFeedback (glad_gl_current_context->DrawTransformFeedback)
+#undef glDrawTransformFeedbackStream
+#define glDrawTransformFeedbackStream (glad_gl_current_context->DrawTransformFeedbackStream)
+#undef glBeginQueryIndexed
+#define glBeginQueryIndexed (glad_gl_current_context->BeginQueryIndexed)
+#undef glEndQueryIndexed
+#define glEndQueryIndexed (glad_gl_current_context->EndQueryIndexed)
+#undef glGetQueryIndexediv
+#define glGetQueryIndexediv (glad_gl_current_context->GetQueryIndexediv)
+#undef glReleaseShaderCompiler
+#define glReleaseShaderCompiler (glad_gl_current_context->ReleaseShaderCompiler)
+#undef glShaderBinary
+#define glShaderBinary (glad_gl_current_context->ShaderBinary)
+#undef glGetShaderPrecisionFormat
+#define glGetShaderPrecisionFormat (glad_gl_current_context->GetShaderPrecisionFormat)
+#undef glDepthRangef
+#define glDepthRangef (glad_gl_current_context->DepthRangef)
+#undef glClearDepthf
+#define glClearDepthf (glad_gl_current_context->ClearDepthf)
+#undef glGetProgramBinary
+#define glGetProgramBinary (glad_gl_current_context->GetProgramBinary)
+#undef glProgramBinary
+#define glProgramBinary (glad_gl_current_context->ProgramBinary)
+#undef glProgramParameteri
+#define glProgramParameteri (glad_gl_current_context->ProgramParameteri)
+#undef glUseProgramStages
+#define glUseProgramStages (glad_gl_current_context->UseProgramStages)
+#undef glActiveShaderProgram
+#define glActiveShaderProgram (glad_gl_current_context->ActiveShaderProgram)
+#undef glCreateShaderProgramv
+#define glCreateShaderProgramv (glad_gl_current_context->CreateShaderProgramv)
+#undef glBindProgramPipeline
+#define glBindProgramPipeline (glad_gl_current_context->BindProgramPipeline)
+#undef glDeleteProgramPipelines
+#define glDeleteProgramPipelines (glad_gl_current_context->DeleteProgramPipelines)
+#undef glGenProgramPipelines
+#define glGenProgramPipelines (glad_gl_current_context->GenProgramPipelines)
+#undef glIsProgramPipeline
+#define glIsProgramPipeline (glad_gl_current_context->IsProgramPipeline)
+#undef glGetProgramPipelineiv
+#define glGetProgramPipelineiv (glad_gl_current_context->GetProgramPipelineiv)
+#undef glProgramUniform1i
+#define glProgramUniform1i (glad_gl_current_context->ProgramUniform1i)
+#undef glProgramUniform1iv
+#define glProgramUniform1iv (glad_gl_current_context->ProgramUniform1iv)
+#undef glProgramUniform1f
+#define glProgramUniform1f (glad_gl_current_context->ProgramUniform1f)
+#undef glProgramUniform1fv
+#define glProgramUniform1fv (glad_gl_current_context->ProgramUniform1fv)
+#undef glProgramUniform1d
+#define glProgramUniform1d (glad_gl_current_context->ProgramUniform1d)
+#undef glProgramUniform1dv
+#define glProgramUniform1dv (glad_gl_current_context->ProgramUniform1dv)
+#undef glProgramUniform1ui
+#define glProgramUniform1ui (glad_gl_current_context->ProgramUniform1ui)
+#undef glProgramUniform1uiv
+#define glProgramUniform1uiv (glad_gl_current_context->ProgramUniform1uiv)
+#undef glProgramUniform2i
+#define glProgramUniform2i (glad_gl_current_context->ProgramUniform2i)
+#undef glProgramUniform2iv
+#define glProgramUniform2iv (glad_gl_current_context->ProgramUniform2iv)
+#undef glProgramUniform2f
+#define glProgramUniform2f (glad_gl_current_context->ProgramUniform2f)
+#undef glProgramUniform2fv
+#define glProgramUniform2fv (glad_gl_current_context->ProgramUniform2fv)
+#undef glProgramUniform2d
+#define glProgramUniform2d (glad_gl_current_context->ProgramUniform2d)
+#undef glProgramUniform2dv
+#define glProgramUniform2dv (glad_gl_current_context->ProgramUniform2dv)
+#undef glProgramUniform2ui
+#define glProgramUniform2ui (glad_gl_current_context->ProgramUniform2ui)
+#undef glProgramUniform2uiv
+#define glProgramUniform2uiv (glad_gl_current_context->ProgramUniform2uiv)
+#undef glProgramUniform3i
+#define glProgramUniform3i (glad_gl_current_context->ProgramUniform3i)
+#undef glProgramUniform3iv
+#define glProgramUniform3iv (glad_gl_current_context->ProgramUniform3iv)
+#undef glProgramUniform3f
+#define glProgramUniform3f (glad_gl_current_context->ProgramUniform3f)
+#undef glProgramUniform3fv
+#define glProgramUniform3fv (glad_gl_current_context->ProgramUniform3fv)
+#undef glProgramUniform3d
+#define glProgramUniform3d (glad_gl_current_context->ProgramUniform3d)
+#undef glProgramUniform3dv
+#define glProgramUniform3dv (glad_gl_current_context->ProgramUniform3dv)
+#undef glProgramUniform3ui
+#define glProgramUniform3ui (glad_gl_current_context->ProgramUniform3ui)
+#undef glProgramUniform3uiv
+#define glProgramUniform3uiv (glad_gl_current_context->ProgramUniform3uiv)
+#undef glProgramUniform4i
+#define glProgramUniform4i (glad_gl_current_context->ProgramUniform4i)
+#undef glProgramUniform4iv
+#define glProgramUniform4iv (glad_gl_current_context->ProgramUniform4iv)
+#undef glProgramUniform4f
+#define glProgramUniform4f (glad_gl_current_context->ProgramUniform4f)
+#undef glProgramUniform4fv
+#define glProgramUniform4fv (glad_gl_current_context->ProgramUniform4fv)
+#undef glProgramUniform4d
+#define glProgramUniform4d (glad_gl_current_context->ProgramUniform4d)
+#undef glProgramUniform4dv
+#define glProgramUniform4dv (glad_gl_current_context->ProgramUniform4dv)
+#undef glProgramUniform4ui
+#define glProgramUniform4ui (glad_gl_current_context->ProgramUniform4ui)
+#undef glProgramUniform4uiv
+#define glProgramUniform4uiv (glad_gl_current_context->ProgramUniform4uiv)
+#undef glProgramUniformMatrix2fv
+#define glProgramUniformMatrix2fv (glad_gl_current_context->ProgramUniformMatrix2fv)
+#undef glProgramUniformMatrix3fv
+#define glProgramUniformMatrix3fv (glad_gl_current_context->ProgramUniformMatrix3fv)
+#undef glProgramUniformMatrix4fv
+#define glProgramUniformMatrix4fv (glad_gl_current_context->ProgramUniformMatrix4fv)
+#undef glProgramUniformMatrix2dv
+#define glProgramUniformMatrix2dv (glad_gl_current_context->ProgramUniformMatrix2dv)
+#undef glProgramUniformMatrix3dv
+#define glProgramUniformMatrix3dv (glad_gl_current_context->ProgramUniformMatrix3dv)
+#undef glProgramUniformMatrix4dv
+#define glProgramUniformMatrix4dv (glad_gl_current_context->ProgramUniformMatrix4dv)
+#undef glProgramUniformMatrix2x3fv
+#define glProgramUniformMatrix2x3fv (glad_gl_current_context->ProgramUniformMatrix2x3fv)
+#undef glProgramUniformMatrix3x2fv
+#define glProgramUniformMatrix3x2fv (glad_gl_current_context->ProgramUniformMatrix3x2fv)
+#undef glProgramUniformMatrix2x4fv
+#define glProgramUniformMatrix2x4fv (glad_gl_current_context->ProgramUniformMatrix2x4fv)
+#undef glProgramUniformMatrix4x2fv
+#define glProgramUniformMatrix4x2fv (glad_gl_current_context->ProgramUniformMatrix4x2fv)
+#undef glProgramUniformMatrix3x4fv
+#define glProgramUniformMatrix3x4fv (glad_gl_current_context->ProgramUniformMatrix3x4fv)
+#undef glProgramUniformMatrix4x3fv
+#define glProgramUniformMatrix4x3fv (glad_gl_current_context->ProgramUniformMatrix4x3fv)
+#undef glProgramUniformMatrix2x3dv
+#define glProgramUniformMatrix2x3dv (glad_gl_current_context->ProgramUniformMatrix2x3dv)
+#undef glProgramUniformMatrix3x2dv
+#define glProgramUniformMatrix3x2dv (glad_gl_current_context->ProgramUniformMatrix3x2dv)
+#undef glProgramUniformMatrix2x4dv
+#define glProgramUniformMatrix2x4dv (glad_gl_current_context->ProgramUniformMatrix2x4dv)
+#undef glProgramUniformMatrix4x2dv
+#define glProgramUniformMatrix4x2dv (glad_gl_current_context->ProgramUniformMatrix4x2dv)
+#undef glProgramUniformMatrix3x4dv
+#define glProgramUniformMatrix3x4dv (glad_gl_current_context->ProgramUniformMatrix3x4dv)
+#undef glProgramUniformMatrix4x3dv
+#define glProgramUniformMatrix4x3dv (glad_gl_current_context->ProgramUniformMatrix4x3dv)
+#undef glValidateProgramPipeline
+#define glValidateProgramPipeline (glad_gl_current_context->ValidateProgramPipeline)
+#undef glGetProgramPipelineInfoLog
+#define glGetProgramPipelineInfoLog (glad_gl_current_context->GetProgramPipelineInfoLog)
+#undef glVertexAttribL1d
+#define glVertexAttribL1d (glad_gl_current_context->VertexAttribL1d)
+#undef glVertexAttribL2d
+#define glVertexAttribL2d (glad_gl_current_context->VertexAttribL2d)
+#undef glVertexAttribL3d
+#define glVertexAttribL3d (glad_gl_current_context->VertexAttribL3d)
+#undef glVertexAttribL4d
+#define glVertexAttribL4d (glad_gl_current_context->VertexAttribL4d)
+#undef glVertexAttribL1dv
+#define glVertexAttribL1dv (glad_gl_current_context->VertexAttribL1dv)
+#undef glVertexAttribL2dv
+#define glVertexAttribL2dv (glad_gl_current_context->VertexAttribL2dv)
+#undef glVertexAttribL3dv
+#define glVertexAttribL3dv (glad_gl_current_context->VertexAttribL3dv)
+#undef glVertexAttribL4dv
+#define glVertexAttribL4dv (glad_gl_current_context->VertexAttribL4dv)
+#undef glVertexAttribLPointer
+#define glVertexAttribLPointer (glad_gl_current_context->VertexAttribLPointer)
+#undef glGetVertexAttribLdv
+#define glGetVertexAttribLdv (glad_gl_current_context->GetVertexAttribLdv)
+#undef glViewportArrayv
+#define glViewportArrayv (glad_gl_current_context->ViewportArrayv)
+#undef glViewportIndexedf
+#define glViewportIndexedf (glad_gl_current_context->ViewportIndexedf)
+#undef glViewportIndexedfv
+#define glViewportIndexedfv (glad_gl_current_context->ViewportIndexedfv)
+#undef glScissorArrayv
+#define glScissorArrayv (glad_gl_current_context->ScissorArrayv)
+#undef glScissorIndexed
+#define glScissorIndexed (glad_gl_current_context->ScissorIndexed)
+#undef glScissorIndexedv
+#define glScissorIndexedv (glad_gl_current_context->ScissorIndexedv)
+#undef glDepthRangeArrayv
+#define glDepthRangeArrayv (glad_gl_current_context->DepthRangeArrayv)
+#undef glDepthRangeIndexed
+#define glDepthRangeIndexed (glad_gl_current_context->DepthRangeIndexed)
+#undef glGetFloati_v
+#define glGetFloati_v (glad_gl_current_context->GetFloati_v)
+#undef glGetDoublei_v
+#define glGetDoublei_v (glad_gl_current_context->GetDoublei_v)
+#undef glDrawArraysInstancedBaseInstance
+#define glDrawArraysInstancedBaseInstance (glad_gl_current_context->DrawArraysInstancedBaseInstance)
+#undef glDrawElementsInstancedBaseInstance
+#define glDrawElementsInstancedBaseInstance (glad_gl_current_context->DrawElementsInstancedBaseInstance)
+#undef glDrawElementsInstancedBaseVertexBaseInstance
+#define glDrawElementsInstancedBaseVertexBaseInstance (glad_gl_current_context->DrawElementsInstancedBaseVertexBaseInstance)
+#undef glGetInternalformativ
+#define glGetInternalformativ (glad_gl_current_context->GetInternalformativ)
+#undef glGetActiveAtomicCounterBufferiv
+#define glGetActiveAtomicCounterBufferiv (glad_gl_current_context->GetActiveAtomicCounterBufferiv)
+#undef glBindImageTexture
+#define glBindImageTexture (glad_gl_current_context->BindImageTexture)
+#undef glMemoryBarrier
+#define glMemoryBarrier (glad_gl_current_context->MemoryBarrier)
+#undef glTexStorage1D
+#define glTexStorage1D (glad_gl_current_context->TexStorage1D)
+#undef glTexStorage2D
+#define glTexStorage2D (glad_gl_current_context->TexStorage2D)
+#undef glTexStorage3D
+#define glTexStorage3D (glad_gl_current_context->TexStorage3D)
+#undef glDrawTransformFeedbackInstanced
+#define glDrawTransformFeedbackInstanced (glad_gl_current_context->DrawTransformFeedbackInstanced)
+#undef glDrawTransformFeedbackStreamInstanced
+#define glDrawTransformFeedbackStreamInstanced (glad_gl_current_context->DrawTransformFeedbackStreamInstanced)
+#undef glClearBufferData
+#define glClearBufferData (glad_gl_current_context->ClearBufferData)
+#undef glClearBufferSubData
+#define glClearBufferSubData (glad_gl_current_context->ClearBufferSubData)
+#undef glDispatchCompute
+#define glDispatchCompute (glad_gl_current_context->DispatchCompute)
+#undef glDispatchComputeIndirect
+#define glDispatchComputeIndirect (glad_gl_current_context->DispatchComputeIndirect)
+#undef glCopyImageSubData
+#define glCopyImageSubData (glad_gl_current_context->CopyImageSubData)
+#undef glFramebufferParameteri
+#define glFramebufferParameteri (glad_gl_current_context->FramebufferParameteri)
+#undef glGetFramebufferParameteriv
+#define glGetFramebufferParameteriv (glad_gl_current_context->GetFramebufferParameteriv)
+#undef glGetInternalformati64v
+#define glGetInternalformati64v (glad_gl_current_context->GetInternalformati64v)
+#undef glInvalidateTexSubImage
+#define glInvalidateTexSubImage (glad_gl_current_context->InvalidateTexSubImage)
+#undef glInvalidateTexImage
+#define glInvalidateTexImage (glad_gl_current_context->InvalidateTexImage)
+#undef glInvalidateBufferSubData
+#define glInvalidateBufferSubData (glad_gl_current_context->InvalidateBufferSubData)
+#undef glInvalidateBufferData
+#define glInvalidateBufferData (glad_gl_current_context->InvalidateBufferData)
+#undef glInvalidateFramebuffer
+#define glInvalidateFramebuffer (glad_gl_current_context->InvalidateFramebuffer)
+#undef glInvalidateSubFramebuffer
+#define glInvalidateSubFramebuffer (glad_gl_current_context->InvalidateSubFramebuffer)
+#undef glMultiDrawArraysIndirect
+#define glMultiDrawArraysIndirect (glad_gl_current_context->MultiDrawArraysIndirect)
+#undef glMultiDrawElementsIndirect
+#define glMultiDrawElementsIndirect (glad_gl_current_context->MultiDrawElementsIndirect)
+#undef glGetProgramInterfaceiv
+#define glGetProgramInterfaceiv (glad_gl_current_context->GetProgramInterfaceiv)
+#undef glGetProgramResourceIndex
+#define glGetProgramResourceIndex (glad_gl_current_context->GetProgramResourceIndex)
+#undef glGetProgramResourceName
+#define glGetProgramResourceName (glad_gl_current_context->GetProgramResourceName)
+#undef glGetProgramResourceiv
+#define glGetProgramResourceiv (glad_gl_current_context->GetProgramResourceiv)
+#undef glGetProgramResourceLocation
+#define glGetProgramResourceLocation (glad_gl_current_context->GetProgramResourceLocation)
+#undef glGetProgramResourceLocationIndex
+#define glGetProgramResourceLocationIndex (glad_gl_current_context->GetProgramResourceLocationIndex)
+#undef glShaderStorageBlockBinding
+#define glShaderStorageBlockBinding (glad_gl_current_context->ShaderStorageBlockBinding)
+#undef glTexBufferRange
+#define glTexBufferRange (glad_gl_current_context->TexBufferRange)
+#undef glTexStorage2DMultisample
+#define glTexStorage2DMultisample (glad_gl_current_context->TexStorage2DMultisample)
+#undef glTexStorage3DMultisample
+#define glTexStorage3DMultisample (glad_gl_current_context->TexStorage3DMultisample)
+#undef glTextureView
+#define glTextureView (glad_gl_current_context->TextureView)
+#undef glBindVertexBuffer
+#define glBindVertexBuffer (glad_gl_current_context->BindVertexBuffer)
+#undef glVertexAttribFormat
+#define glVertexAttribFormat (glad_gl_current_context->VertexAttribFormat)
+#undef glVertexAttribIFormat
+#define glVertexAttribIFormat (glad_gl_current_context->VertexAttribIFormat)
+#undef glVertexAttribLFormat
+#define glVertexAttribLFormat (glad_gl_current_context->VertexAttribLFormat)
+#undef glVertexAttribBinding
+#define glVertexAttribBinding (glad_gl_current_context->VertexAttribBinding)
+#undef glVertexBindingDivisor
+#define glVertexBindingDivisor (glad_gl_current_context->VertexBindingDivisor)
+#undef glDebugMessageControl
+#define glDebugMessageControl (glad_gl_current_context->DebugMessageControl)
+#undef glDebugMessageInsert
+#define glDebugMessageInsert (glad_gl_current_context->DebugMessageInsert)
+#undef glDebugMessageCallback
+#define glDebugMessageCallback (glad_gl_current_context->DebugMessageCallback)
+#undef glGetDebugMessageLog
+#define glGetDebugMessageLog (glad_gl_current_context->GetDebugMessageLog)
+#undef glPushDebugGroup
+#define glPushDebugGroup (glad_gl_current_context->PushDebugGroup)
+#undef glPopDebugGroup
+#define glPopDebugGroup (glad_gl_current_context->PopDebugGroup)
+#undef glObjectLabel
+#define glObjectLabel (glad_gl_current_context->ObjectLabel)
+#undef glGetObjectLabel
+#define glGetObjectLabel (glad_gl_current_context->GetObjectLabel)
+#undef glObjectPtrLabel
+#define glObjectPtrLabel (glad_gl_current_context->ObjectPtrLabel)
+#undef glGetObjectPtrLabel
+#define glGetObjectPtrLabel (glad_gl_current_context->GetObjectPtrLabel)
+#undef glGetPointerv
+#define glGetPointerv (glad_gl_current_context->GetPointerv)
+#undef glBufferStorage
+#define glBufferStorage (glad_gl_current_context->BufferStorage)
+#undef glClearTexImage
+#define glClearTexImage (glad_gl_current_context->ClearTexImage)
+#undef glClearTexSubImage
+#define glClearTexSubImage (glad_gl_current_context->ClearTexSubImage)
+#undef glBindBuffersBase
+#define glBindBuffersBase (glad_gl_current_context->BindBuffersBase)
+#undef glBindBuffersRange
+#define glBindBuffersRange (glad_gl_current_context->BindBuffersRange)
+#undef glBindTextures
+#define glBindTextures (glad_gl_current_context->BindTextures)
+#undef glBindSamplers
+#define glBindSamplers (glad_gl_current_context->BindSamplers)
+#undef glBindImageTextures
+#define glBindImageTextures (glad_gl_current_context->BindImageTextures)
+#undef glBindVertexBuffers
+#define glBindVertexBuffers (glad_gl_current_context->BindVertexBuffers)
+#undef glClipControl
+#define glClipControl (glad_gl_current_context->ClipControl)
+#undef glCreateTransformFeedbacks
+#define glCreateTransformFeedbacks (glad_gl_current_context->CreateTransformFeedbacks)
+#undef glTransformFeedbackBufferBase
+#define glTransformFeedbackBufferBase (glad_gl_current_context->TransformFeedbackBufferBase)
+#undef glTransformFeedbackBufferRange
+#define glTransformFeedbackBufferRange (glad_gl_current_context->TransformFeedbackBufferRange)
+#undef glGetTransformFeedbackiv
+#define glGetTransformFeedbackiv (glad_gl_current_context->GetTransformFeedbackiv)
+#undef glGetTransformFeedbacki_v
+#define glGetTransformFeedbacki_v (glad_gl_current_context->GetTransformFeedbacki_v)
+#undef glGetTransformFeedbacki64_v
+#define glGetTransformFeedbacki64_v (glad_gl_current_context->GetTransformFeedbacki64_v)
+#undef glCreateBuffers
+#define glCreateBuffers (glad_gl_current_context->CreateBuffers)
+#undef glNamedBufferStorage
+#define glNamedBufferStorage (glad_gl_current_context->NamedBufferStorage)
+#undef glNamedBufferData
+#define glNamedBufferData (glad_gl_current_context->NamedBufferData)
+#undef glNamedBufferSubData
+#define glNamedBufferSubData (glad_gl_current_context->NamedBufferSubData)
+#undef glCopyNamedBufferSubData
+#define glCopyNamedBufferSubData (glad_gl_current_context->CopyNamedBufferSubData)
+#undef glClearNamedBufferData
+#define glClearNamedBufferData (glad_gl_current_context->ClearNamedBufferData)
+#undef glClearNamedBufferSubData
+#define glClearNamedBufferSubData (glad_gl_current_context->ClearNamedBufferSubData)
+#undef glMapNamedBuffer
+#define glMapNamedBuffer (glad_gl_current_context->MapNamedBuffer)
+#undef glMapNamedBufferRange
+#define glMapNamedBufferRange (glad_gl_current_context->MapNamedBufferRange)
+#undef glUnmapNamedBuffer
+#define glUnmapNamedBuffer (glad_gl_current_context->UnmapNamedBuffer)
+#undef glFlushMappedNamedBufferRange
+#define glFlushMappedNamedBufferRange (glad_gl_current_context->FlushMappedNamedBufferRange)
+#undef glGetNamedBufferParameteriv
+#define glGetNamedBufferParameteriv (glad_gl_current_context->GetNamedBufferParameteriv)
+#undef glGetNamedBufferParameteri64v
+#define glGetNamedBufferParameteri64v (glad_gl_current_context->GetNamedBufferParameteri64v)
+#undef glGetNamedBufferPointerv
+#define glGetNamedBufferPointerv (glad_gl_current_context->GetNamedBufferPointerv)
+#undef glGetNamedBufferSubData
+#define glGetNamedBufferSubData (glad_gl_current_context->GetNamedBufferSubData)
+#undef glCreateFramebuffers
+#define glCreateFramebuffers (glad_gl_current_context->CreateFramebuffers)
+#undef glNamedFramebufferRenderbuffer
+#define glNamedFramebufferRenderbuffer (glad_gl_current_context->NamedFramebufferRenderbuffer)
+#undef glNamedFramebufferParameteri
+#define glNamedFramebufferParameteri (glad_gl_current_context->NamedFramebufferParameteri)
+#undef glNamedFramebufferTexture
+#define glNamedFramebufferTexture (glad_gl_current_context->NamedFramebufferTexture)
+#undef glNamedFramebufferTextureLayer
+#define glNamedFramebufferTextureLayer (glad_gl_current_context->NamedFramebufferTextureLayer)
+#undef glNamedFramebufferDrawBuffer
+#define glNamedFramebufferDrawBuffer (glad_gl_current_context->NamedFramebufferDrawBuffer)
+#undef glNamedFramebufferDrawBuffers
+#define glNamedFramebufferDrawBuffers (glad_gl_current_context->NamedFramebufferDrawBuffers)
+#undef glNamedFramebufferReadBuffer
+#define glNamedFramebufferReadBuffer (glad_gl_current_context->NamedFramebufferReadBuffer)
+#undef glInvalidateNamedFramebufferData
+#define glInvalidateNamedFramebufferData (glad_gl_current_context->InvalidateNamedFramebufferData)
+#undef glInvalidateNamedFramebufferSubData
+#define glInvalidateNamedFramebufferSubData (glad_gl_current_context->InvalidateNamedFramebufferSubData)
+#undef glClearNamedFramebufferiv
+#define glClearNamedFramebufferiv (glad_gl_current_context->ClearNamedFramebufferiv)
+#undef glClearNamedFramebufferuiv
+#define glClearNamedFramebufferuiv (glad_gl_current_context->ClearNamedFramebufferuiv)
+#undef glClearNamedFramebufferfv
+#define glClearNamedFramebufferfv (glad_gl_current_context->ClearNamedFramebufferfv)
+#undef glClearNamedFramebufferfi
+#define glClearNamedFramebufferfi (glad_gl_current_context->ClearNamedFramebufferfi)
+#undef glBlitNamedFramebuffer
+#define glBlitNamedFramebuffer (glad_gl_current_context->BlitNamedFramebuffer)
+#undef glCheckNamedFramebufferStatus
+#define glCheckNamedFramebufferStatus (glad_gl_current_context->CheckNamedFramebufferStatus)
+#undef glGetNamedFramebufferParameteriv
+#define glGetNamedFramebufferParameteriv (glad_gl_current_context->GetNamedFramebufferParameteriv)
+#undef glGetNamedFramebufferAttachmentParameteriv
+#define glGetNamedFramebufferAttachmentParameteriv (glad_gl_current_context->GetNamedFramebufferAttachmentParameteriv)
+#undef glCreateRenderbuffers
+#define glCreateRenderbuffers (glad_gl_current_context->CreateRenderbuffers)
+#undef glNamedRenderbufferStorage
+#define glNamedRenderbufferStorage (glad_gl_current_context->NamedRenderbufferStorage)
+#undef glNamedRenderbufferStorageMultisample
+#define glNamedRenderbufferStorageMultisample (glad_gl_current_context->NamedRenderbufferStorageMultisample)
+#undef glGetNamedRenderbufferParameteriv
+#define glGetNamedRenderbufferParameteriv (glad_gl_current_context->GetNamedRenderbufferParameteriv)
+#undef glCreateTextures
+#define glCreateTextures (glad_gl_current_context->CreateTextures)
+#undef glTextureBuffer
+#define glTextureBuffer (glad_gl_current_context->TextureBuffer)
+#undef glTextureBufferRange
+#define glTextureBufferRange (glad_gl_current_context->TextureBufferRange)
+#undef glTextureStorage1D
+#define glTextureStorage1D (glad_gl_current_context->TextureStorage1D)
+#undef glTextureStorage2D
+#define glTextureStorage2D (glad_gl_current_context->TextureStorage2D)
+#undef glTextureStorage3D
+#define glTextureStorage3D (glad_gl_current_context->TextureStorage3D)
+#undef glTextureStorage2DMultisample
+#define glTextureStorage2DMultisample (glad_gl_current_context->TextureStorage2DMultisample)
+#undef glTextureStorage3DMultisample
+#define glTextureStorage3DMultisample (glad_gl_current_context->TextureStorage3DMultisample)
+#undef glTextureSubImage1D
+#define glTextureSubImage1D (glad_gl_current_context->TextureSubImage1D)
+#undef glTextureSubImage2D
+#define glTextureSubImage2D (glad_gl_current_context->TextureSubImage2D)
+#undef glTextureSubImage3D
+#define glTextureSubImage3D (glad_gl_current_context->TextureSubImage3D)
+#undef glCompressedTextureSubImage1D
+#define glCompressedTextureSubImage1D (glad_gl_current_context->CompressedTextureSubImage1D)
+#undef glCompressedTextureSubImage2D
+#define glCompressedTextureSubImage2D (glad_gl_current_context->CompressedTextureSubImage2D)
+#undef glCompressedTextureSubImage3D
+#define glCompressedTextureSubImage3D (glad_gl_current_context->CompressedTextureSubImage3D)
+#undef glCopyTextureSubImage1D
+#define glCopyTextureSubImage1D (glad_gl_current_context->CopyTextureSubImage1D)
+#undef glCopyTextureSubImage2D
+#define glCopyTextureSubImage2D (glad_gl_current_context->CopyTextureSubImage2D)
+#undef glCopyTextureSubImage3D
+#define glCopyTextureSubImage3D (glad_gl_current_context->CopyTextureSubImage3D)
+#undef glTextureParameterf
+#define glTextureParameterf (glad_gl_current_context->TextureParameterf)
+#undef glTextureParameterfv
+#define glTextureParameterfv (glad_gl_current_context->TextureParameterfv)
+#undef glTextureParameteri
+#define glTextureParameteri (glad_gl_current_context->TextureParameteri)
+#undef glTextureParameterIiv
+#define glTextureParameterIiv (glad_gl_current_context->TextureParameterIiv)
+#undef glTextureParameterIuiv
+#define glTextureParameterIuiv (glad_gl_current_context->TextureParameterIuiv)
+#undef glTextureParameteriv
+#define glTextureParameteriv (glad_gl_current_context->TextureParameteriv)
+#undef glGenerateTextureMipmap
+#define glGenerateTextureMipmap (glad_gl_current_context->GenerateTextureMipmap)
+#undef glBindTextureUnit
+#define glBindTextureUnit (glad_gl_current_context->BindTextureUnit)
+#undef glGetTextureImage
+#define glGetTextureImage (glad_gl_current_context->GetTextureImage)
+#undef glGetCompressedTextureImage
+#define glGetCompressedTextureImage (glad_gl_current_context->GetCompressedTextureImage)
+#undef glGetTextureLevelParameterfv
+#define glGetTextureLevelParameterfv (glad_gl_current_context->GetTextureLevelParameterfv)
+#undef glGetTextureLevelParameteriv
+#define glGetTextureLevelParameteriv (glad_gl_current_context->GetTextureLevelParameteriv)
+#undef glGetTextureParameterfv
+#define glGetTextureParameterfv (glad_gl_current_context->GetTextureParameterfv)
+#undef glGetTextureParameterIiv
+#define glGetTextureParameterIiv (glad_gl_current_context->GetTextureParameterIiv)
+#undef glGetTextureParameterIuiv
+#define glGetTextureParameterIuiv (glad_gl_current_context->GetTextureParameterIuiv)
+#undef glGetTextureParameteriv
+#define glGetTextureParameteriv (glad_gl_current_context->GetTextureParameteriv)
+#undef glCreateVertexArrays
+#define glCreateVertexArrays (glad_gl_current_context->CreateVertexArrays)
+#undef glDisableVertexArrayAttrib
+#define glDisableVertexArrayAttrib (glad_gl_current_context->DisableVertexArrayAttrib)
+#undef glEnableVertexArrayAttrib
+#define glEnableVertexArrayAttrib (glad_gl_current_context->EnableVertexArrayAttrib)
+#undef glVertexArrayElementBuffer
+#define glVertexArrayElementBuffer (glad_gl_current_context->VertexArrayElementBuffer)
+#undef glVertexArrayVertexBuffer
+#define glVertexArrayVertexBuffer (glad_gl_current_context->VertexArrayVertexBuffer)
+#undef glVertexArrayVertexBuffers
+#define glVertexArrayVertexBuffers (glad_gl_current_context->VertexArrayVertexBuffers)
+#undef glVertexArrayAttribBinding
+#define glVertexArrayAttribBinding (glad_gl_current_context->VertexArrayAttribBinding)
+#undef glVertexArrayAttribFormat
+#define glVertexArrayAttribFormat (glad_gl_current_context->VertexArrayAttribFormat)
+#undef glVertexArrayAttribIFormat
+#define glVertexArrayAttribIFormat (glad_gl_current_context->VertexArrayAttribIFormat)
+#undef glVertexArrayAttribLFormat
+#define glVertexArrayAttribLFormat (glad_gl_current_context->VertexArrayAttribLFormat)
+#undef glVertexArrayBindingDivisor
+#define glVertexArrayBindingDivisor (glad_gl_current_context->VertexArrayBindingDivisor)
+#undef glGetVertexArrayiv
+#define glGetVertexArrayiv (glad_gl_current_context->GetVertexArrayiv)
+#undef glGetVertexArrayIndexediv
+#define glGetVertexArrayIndexediv (glad_gl_current_context->GetVertexArrayIndexediv)
+#undef glGetVertexArrayIndexed64iv
+#define glGetVertexArrayIndexed64iv (glad_gl_current_context->GetVertexArrayIndexed64iv)
+#undef glCreateSamplers
+#define glCreateSamplers (glad_gl_current_context->CreateSamplers)
+#undef glCreateProgramPipelines
+#define glCreateProgramPipelines (glad_gl_current_context->CreateProgramPipelines)
+#undef glCreateQueries
+#define glCreateQueries (glad_gl_current_context->CreateQueries)
+#undef glGetQueryBufferObjecti64v
+#define glGetQueryBufferObjecti64v (glad_gl_current_context->GetQueryBufferObjecti64v)
+#undef glGetQueryBufferObjectiv
+#define glGetQueryBufferObjectiv (glad_gl_current_context->GetQueryBufferObjectiv)
+#undef glGetQueryBufferObjectui64v
+#define glGetQueryBufferObjectui64v (glad_gl_current_context->GetQueryBufferObjectui64v)
+#undef glGetQueryBufferObjectuiv
+#define glGetQueryBufferObjectuiv (glad_gl_current_context->GetQueryBufferObjectuiv)
+#undef glMemoryBarrierByRegion
+#define glMemoryBarrierByRegion (glad_gl_current_context->MemoryBarrierByRegion)
+#undef glGetTextureSubImage
+#define glGetTextureSubImage (glad_gl_current_context->GetTextureSubImage)
+#undef glGetCompressedTextureSubImage
+#define glGetCompressedTextureSubImage (glad_gl_current_context->GetCompressedTextureSubImage)
+#undef glGetGraphicsResetStatus
+#define glGetGraphicsResetStatus (glad_gl_current_context->GetGraphicsResetStatus)
+#undef glGetnCompressedTexImage
+#define glGetnCompressedTexImage (glad_gl_current_context->GetnCompressedTexImage)
+#undef glGetnTexImage
+#define glGetnTexImage (glad_gl_current_context->GetnTexImage)
+#undef glGetnUniformdv
+#define glGetnUniformdv (glad_gl_current_context->GetnUniformdv)
+#undef glGetnUniformfv
+#define glGetnUniformfv (glad_gl_current_context->GetnUniformfv)
+#undef glGetnUniformiv
+#define glGetnUniformiv (glad_gl_current_context->GetnUniformiv)
+#undef glGetnUniformuiv
+#define glGetnUniformuiv (glad_gl_current_context->GetnUniformuiv)
+#undef glReadnPixels
+#define glReadnPixels (glad_gl_current_context->ReadnPixels)
+#undef glTextureBarrier
+#define glTextureBarrier (glad_gl_current_context->TextureBarrier)
+#undef glMaxShaderCompilerThreadsKHR
+#define glMaxShaderCompilerThreadsKHR (glad_gl_current_context->MaxShaderCompilerThreadsKHR)
+#endif
 
 #ifdef __cplusplus
 }
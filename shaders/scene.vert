@@ -0,0 +1,15 @@
+#version 330 core
+layout(location = 0) in vec2 position;
+layout(std140) uniform View {
+    vec2 cameraPosition;
+    vec2 cameraZoom;
+};
+layout(std140) uniform Object {
+    vec2 offset;
+    vec2 scale;
+    vec3 color;
+};
+void main() {
+    vec2 world = position * scale + offset;
+    gl_Position = vec4((world - cameraPosition) * cameraZoom, 0.0, 1.0);
+}
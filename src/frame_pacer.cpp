@@ -0,0 +1,37 @@
+#include "frame_pacer.h"
+
+#include <thread>
+
+FramePacer::FramePacer(double fps) {
+    setRate(fps);
+}
+
+void FramePacer::setRate(double fps) {
+    fps_ = fps > 0.0 ? fps : 0.0;
+    period_ = fps_ > 0.0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / fps_))
+        : Clock::duration::zero();
+    started_ = false;
+}
+
+void FramePacer::wait() {
+    if (fps_ == 0.0) {
+        return;
+    }
+    Clock::time_point now = Clock::now();
+    if (!started_) {
+        deadline_ = now + period_;
+        started_ = true;
+    }
+
+    if (now < deadline_) {
+        std::this_thread::sleep_until(deadline_);
+        deadline_ += period_;
+        return;
+    }
+    missed_++;
+    deadline_ += period_;
+    if (deadline_ < now) {
+        deadline_ = now + period_;
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <chrono>
+
+// Caps the frame rate by sleeping until each frame's deadline. Deadlines are
+// spaced one period apart from the first wait(), not from whenever the last
+// frame ended, so the rate does not drift. A frame that misses its deadline
+// by more than a period moves the schedule instead of being followed by a
+// burst of frames trying to catch up.
+class FramePacer {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // 0 for no limit.
+    explicit FramePacer(double fps = 0.0);
+
+    void setRate(double fps);
+    double rate() const { return fps_; }
+
+    // Sleeps until the end of the current frame's period.
+    void wait();
+
+    // Deadlines that had already passed when wait() was called.
+    unsigned long long missed() const { return missed_; }
+
+private:
+    double fps_ = 0.0;
+    Clock::duration period_{};
+    Clock::time_point deadline_{};
+    bool started_ = false;
+    unsigned long long missed_ = 0;
+};
+
+#endif
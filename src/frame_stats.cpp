@@ -0,0 +1,67 @@
+#include "frame_stats.h"
+
+#include <algorithm>
+
+namespace {
+
+double percentile(const std::vector<double> &sorted, double p) {
+    size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+}
+
+FrameStats::FrameStats(size_t capacity, double hitchFactor)
+    : hitchFactor_(hitchFactor) {
+    times_.reserve(capacity);
+    scratch_.reserve(capacity);
+}
+
+void FrameStats::add(double ms) {
+    // Judged against the frames before it; nth_element on a copy of at most
+    // `capacity` of them is a few microseconds.
+    if (!times_.empty()) {
+        scratch_.assign(times_.begin(), times_.end());
+        std::vector<double>::iterator middle = scratch_.begin() + (scratch_.size() - 1) / 2;
+        std::nth_element(scratch_.begin(), middle, scratch_.end());
+        if (ms > hitchFactor_ * *middle) {
+            intervalHitches_++;
+            totalHitches_++;
+        }
+    }
+    if (times_.size() < times_.capacity()) {
+        times_.push_back(ms);
+    } else {
+        times_[next_] = ms;
+        next_ = (next_ + 1) % times_.size();
+    }
+    totalFrames_++;
+}
+
+FrameStats::Summary FrameStats::summary() const {
+    Summary summary;
+    if (times_.empty()) {
+        return summary;
+    }
+    std::vector<double> sorted = times_;
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (double ms : sorted) {
+        sum += ms;
+    }
+    summary.frames = sorted.size();
+    summary.mean = sum / sorted.size();
+    summary.p50 = percentile(sorted, 0.50);
+    summary.p95 = percentile(sorted, 0.95);
+    summary.p99 = percentile(sorted, 0.99);
+    summary.max = sorted.back();
+    summary.hitches = intervalHitches_;
+    return summary;
+}
+
+FrameStats::Summary FrameStats::report() {
+    Summary summary = this->summary();
+    intervalHitches_ = 0;
+    return summary;
+}
@@ -0,0 +1,50 @@
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <cstddef>
+#include <vector>
+
+// Keeps the last `capacity` frame times in a ring and summarizes them. A
+// hitch is a frame that took more than hitchFactor times the median of the
+// ring before it, so it adapts to whatever rate the loop runs at. add()
+// counts hitches as frames come in; report() hands out those since the
+// last report, so the reports add up to totalHitches().
+class FrameStats {
+public:
+    struct Summary {
+        unsigned long long frames = 0;  // in the ring
+        double mean = 0.0;
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+        // Since the last report(), not over the ring.
+        unsigned long long hitches = 0;
+    };
+
+    explicit FrameStats(size_t capacity = 1024, double hitchFactor = 2.0);
+
+    void add(double ms);
+
+    // Over the frames in the ring; sorts a copy, so not for every frame.
+    Summary summary() const;
+
+    // summary(), and starts the next interval of hitches.
+    Summary report();
+
+    // Over every frame added.
+    unsigned long long totalFrames() const { return totalFrames_; }
+    unsigned long long totalHitches() const { return totalHitches_; }
+
+private:
+    std::vector<double> times_;
+    size_t next_ = 0;
+    double hitchFactor_;
+    unsigned long long totalFrames_ = 0;
+    unsigned long long totalHitches_ = 0;
+    unsigned long long intervalHitches_ = 0;
+    // A copy of the ring that add() finds the median in.
+    std::vector<double> scratch_;
+};
+
+#endif
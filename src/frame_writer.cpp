@@ -0,0 +1,281 @@
+#include "frame_writer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+bool endsWith(const std::string &text, const char *suffix) {
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+// Splits a per-frame path at its one frame number, "%d" with an optional 0
+// flag and width ("%05d"), and turns "%%" into "%". False for any other
+// conversion or more than one, which would read arguments that are not
+// there if the path were used as a printf format.
+bool parseFramePattern(const std::string &path, std::string &prefix, std::string &suffix, int &width,
+                       bool &zeros) {
+    bool found = false;
+    prefix.clear();
+    suffix.clear();
+    for (size_t i = 0; i < path.size(); i++) {
+        std::string &out = found ? suffix : prefix;
+        if (path[i] != '%') {
+            out += path[i];
+            continue;
+        }
+        if (i + 1 < path.size() && path[i + 1] == '%') {
+            out += '%';
+            i++;
+            continue;
+        }
+        if (found) {
+            return false;
+        }
+        size_t j = i + 1;
+        zeros = j < path.size() && path[j] == '0';
+        if (zeros) {
+            j++;
+        }
+        width = 0;
+        while (j < path.size() && isdigit((unsigned char)path[j]) && width < 100) {
+            width = width * 10 + (path[j++] - '0');
+        }
+        if (j >= path.size() || path[j] != 'd' || width >= 100) {
+            return false;
+        }
+        found = true;
+        i = j;
+    }
+    return found;
+}
+
+unsigned char clampByte(int value) {
+    return (unsigned char)std::min(std::max(value, 0), 255);
+}
+
+}
+
+FrameWriter::~FrameWriter() {
+    close();
+}
+
+FrameWriter::Format FrameWriter::formatFor(const std::string &path) {
+    if (endsWith(path, ".ppm")) {
+        return Format::Ppm;
+    }
+    if (endsWith(path, ".y4m")) {
+        return Format::Y4m;
+    }
+    return Format::Raw;
+}
+
+bool FrameWriter::open(const std::string &path, Format format, int width, int height, int fps, int buffers) {
+    if (thread_.joinable()) {
+        return false;
+    }
+    path_ = path;
+    format_ = format;
+    width_ = width;
+    height_ = height;
+    perFrameFiles_ = format == Format::Ppm && path.find('%') != std::string::npos;
+    if (perFrameFiles_ && !parseFramePattern(path, namePrefix_, nameSuffix_, nameWidth_, nameZeros_)) {
+        std::cerr << "The output path " << path << " needs exactly one frame number like %05d"
+                  << " (and %% for a literal %)" << std::endl;
+        return false;
+    }
+    if (!perFrameFiles_) {
+        file_ = fopen(path.c_str(), "wb");
+        if (file_ == nullptr) {
+            std::cerr << "Failed to open " << path << std::endl;
+            return false;
+        }
+        if (format == Format::Y4m) {
+            fprintf(file_, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg XCOLORRANGE=FULL\n", width, height, fps);
+        }
+    }
+
+    free_.assign(buffers > 0 ? buffers : 1, std::vector<unsigned char>((size_t)width * height * 4));
+    queued_.clear();
+    submitted_ = 0;
+    closing_ = false;
+    failed_ = false;
+    stats_ = Stats();
+    thread_ = std::thread(&FrameWriter::run, this);
+    return true;
+}
+
+void FrameWriter::submit(const unsigned char *pixels) {
+    std::vector<unsigned char> buffer;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (free_.empty()) {
+            auto start = std::chrono::steady_clock::now();
+            changed_.wait(lock, [this] { return !free_.empty(); });
+            stats_.stallMilliseconds += std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
+        }
+        buffer.swap(free_.back());
+        free_.pop_back();
+    }
+
+    memcpy(buffer.data(), pixels, buffer.size());
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queued_.push_back(std::move(buffer));
+    }
+    changed_.notify_all();
+}
+
+bool FrameWriter::close() {
+    if (!thread_.joinable()) {
+        return !failed_;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closing_ = true;
+    }
+    changed_.notify_all();
+    thread_.join();
+    if (file_ != nullptr) {
+        if (fclose(file_) != 0) {
+            failed_ = true;
+        }
+        file_ = nullptr;
+    }
+    return !failed_;
+}
+
+FrameWriter::Stats FrameWriter::stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void FrameWriter::run() {
+    unsigned long long index = 0;
+    for (;;) {
+        std::vector<unsigned char> buffer;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            changed_.wait(lock, [this] { return closing_ || !queued_.empty(); });
+            if (queued_.empty()) {
+                return;
+            }
+            buffer.swap(queued_.front());
+            queued_.erase(queued_.begin());
+        }
+
+        bool written = !failed_ && write(buffer, index++);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (written) {
+                stats_.frames++;
+            } else if (!failed_) {
+                std::cerr << "Failed to write frame " << index - 1 << " to " << path_ << std::endl;
+                failed_ = true;
+            }
+            free_.push_back(std::move(buffer));
+        }
+        changed_.notify_all();
+    }
+}
+
+bool FrameWriter::write(const std::vector<unsigned char> &pixels, unsigned long long index) {
+    if (!perFrameFiles_) {
+        return writeFile(file_, pixels);
+    }
+    std::string number = std::to_string(index);
+    if ((int)number.size() < nameWidth_) {
+        number.insert(0, nameWidth_ - number.size(), nameZeros_ ? '0' : ' ');
+    }
+    std::string name = namePrefix_ + number + nameSuffix_;
+    FILE *file = fopen(name.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool written = writeFile(file, pixels);
+    return fclose(file) == 0 && written;
+}
+
+bool FrameWriter::writeFile(FILE *file, const std::vector<unsigned char> &pixels) {
+    const size_t stride = (size_t)width_ * 4;
+    // GL's rows are bottom up, every format here is top down.
+    auto row = [&](int y) { return pixels.data() + (size_t)(height_ - 1 - y) * stride; };
+
+    size_t header = 0;
+    switch (format_) {
+    case Format::Raw:
+        converted_.resize(pixels.size());
+        for (int y = 0; y < height_; y++) {
+            memcpy(converted_.data() + y * stride, row(y), stride);
+        }
+        break;
+
+    case Format::Ppm: {
+        char text[64];
+        int length = snprintf(text, sizeof(text), "P6\n%d %d\n255\n", width_, height_);
+        converted_.assign(text, text + length);
+        header = converted_.size();
+        converted_.resize(header + (size_t)width_ * height_ * 3);
+        unsigned char *out = converted_.data() + header;
+        for (int y = 0; y < height_; y++) {
+            const unsigned char *in = row(y);
+            for (int x = 0; x < width_; x++) {
+                *out++ = in[x * 4 + 0];
+                *out++ = in[x * 4 + 1];
+                *out++ = in[x * 4 + 2];
+            }
+        }
+        break;
+    }
+
+    case Format::Y4m: {
+        // JFIF (full range BT.601) in 8 bit fixed point; chroma is the
+        // average of each 2x2 block.
+        const int chromaWidth = (width_ + 1) / 2;
+        const int chromaHeight = (height_ + 1) / 2;
+        const char frame[] = "FRAME\n";
+        header = sizeof(frame) - 1;
+        converted_.assign(frame, frame + header);
+        converted_.resize(header + (size_t)width_ * height_ + 2 * (size_t)chromaWidth * chromaHeight);
+        unsigned char *luma = converted_.data() + header;
+        unsigned char *cb = luma + (size_t)width_ * height_;
+        unsigned char *cr = cb + (size_t)chromaWidth * chromaHeight;
+        for (int y = 0; y < height_; y++) {
+            const unsigned char *in = row(y);
+            for (int x = 0; x < width_; x++) {
+                int r = in[x * 4 + 0], g = in[x * 4 + 1], b = in[x * 4 + 2];
+                luma[(size_t)y * width_ + x] = clampByte((77 * r + 150 * g + 29 * b + 128) >> 8);
+            }
+        }
+        for (int cy = 0; cy < chromaHeight; cy++) {
+            const unsigned char *top = row(2 * cy);
+            const unsigned char *bottom = row(std::min(2 * cy + 1, height_ - 1));
+            for (int cx = 0; cx < chromaWidth; cx++) {
+                int x0 = 2 * cx * 4;
+                int x1 = std::min(2 * cx + 1, width_ - 1) * 4;
+                int r = top[x0] + top[x1] + bottom[x0] + bottom[x1];
+                int g = top[x0 + 1] + top[x1 + 1] + bottom[x0 + 1] + bottom[x1 + 1];
+                int b = top[x0 + 2] + top[x1 + 2] + bottom[x0 + 2] + bottom[x1 + 2];
+                // The sums are four pixels, hence >> 10 instead of >> 8.
+                cb[(size_t)cy * chromaWidth + cx] = clampByte(((-43 * r - 85 * g + 128 * b + 512) >> 10) + 128);
+                cr[(size_t)cy * chromaWidth + cx] = clampByte(((128 * r - 107 * g - 21 * b + 512) >> 10) + 128);
+            }
+        }
+        break;
+    }
+    }
+
+    if (fwrite(converted_.data(), 1, converted_.size(), file) != converted_.size()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.bytes += converted_.size();
+    return true;
+}
@@ -0,0 +1,85 @@
+#ifndef FRAME_WRITER_H
+#define FRAME_WRITER_H
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Writes rendered frames to disk on a background thread, so the render loop
+// only pays for a memcpy. Frames are RGBA8, bottom row first, as read from
+// GL; the writer flips them and converts as the format needs:
+//
+//   raw  the RGBA8 frames back to back, top row first, in one file
+//   ppm  binary RGB PPM; one file per frame when the path contains a printf
+//        style frame number ("out/%05d.ppm", %% for a literal %), otherwise
+//        all frames in one stream (ffmpeg -f image2pipe)
+//   y4m  a YUV4MPEG2 stream in 4:2:0 (C420jpeg, full range BT.601), for
+//        ffmpeg or any video player
+//
+// A fixed number of frame buffers circulates between the two threads;
+// submit() blocks when the disk falls that far behind.
+class FrameWriter {
+public:
+    enum class Format { Raw, Ppm, Y4m };
+
+    struct Stats {
+        unsigned long long frames = 0;
+        unsigned long long bytes = 0;
+        // Time the render thread waited for a free buffer.
+        double stallMilliseconds = 0.0;
+    };
+
+    FrameWriter() = default;
+    ~FrameWriter();
+
+    FrameWriter(const FrameWriter &) = delete;
+    FrameWriter &operator=(const FrameWriter &) = delete;
+
+    // The format from the path's extension, Raw when there is none of the
+    // above.
+    static Format formatFor(const std::string &path);
+
+    bool open(const std::string &path, Format format, int width, int height, int fps, int buffers = 8);
+
+    // Copies a frame and queues it for writing.
+    void submit(const unsigned char *pixels);
+
+    // Writes what is queued and closes the file; false if a write failed.
+    bool close();
+
+    Stats stats();
+
+private:
+    void run();
+    bool write(const std::vector<unsigned char> &pixels, unsigned long long index);
+    bool writeFile(FILE *file, const std::vector<unsigned char> &pixels);
+
+    std::string path_;
+    Format format_ = Format::Raw;
+    int width_ = 0;
+    int height_ = 0;
+    bool perFrameFiles_ = false;
+    // A per-frame file's name around its frame number, which is padded to
+    // nameWidth_ with zeros or spaces.
+    std::string namePrefix_;
+    std::string nameSuffix_;
+    int nameWidth_ = 0;
+    bool nameZeros_ = false;
+    FILE *file_ = nullptr;
+    std::vector<unsigned char> converted_;
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::vector<std::vector<unsigned char>> free_;
+    std::vector<std::vector<unsigned char>> queued_;   // oldest first
+    unsigned long long submitted_ = 0;
+    bool closing_ = false;
+    bool failed_ = false;
+    Stats stats_;
+};
+
+#endif
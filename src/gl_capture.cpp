@@ -0,0 +1,568 @@
+#include "gl_capture.h"
+#include "gl_capture_format.h"
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace glcapture {
+
+namespace {
+
+const size_t flushSize = 1024 * 1024;
+
+// Blobs at least this large skip the staging buffer.
+const size_t directWriteSize = 64 * 1024;
+
+struct Mapping {
+    unsigned char *pointer;
+    GLsizeiptr length;
+    bool explicitFlush;
+};
+
+struct State {
+    FILE *file = nullptr;
+    std::vector<unsigned char> buffer;
+    Stats stats;
+    std::chrono::steady_clock::time_point lastFrame;
+
+    // Where the shims are installed: the current context's table, or the
+    // global pointers when it is nullptr.
+    GladGLContext *table = nullptr;
+    GladGLContext real;
+
+    GLuint unpackBuffer = 0;
+    GLint unpackAlignment = 4;
+    GLint unpackRowLength = 0;
+    GLint unpackImageHeight = 0;
+    GLint unpackSkipPixels = 0;
+    GLint unpackSkipRows = 0;
+    GLint unpackSkipImages = 0;
+
+    // Write mappings by target, and by buffer for glMapNamedBuffer(Range),
+    // published at flush or unmap time.
+    std::unordered_map<GLenum, Mapping> mappings;
+    std::unordered_map<GLuint, Mapping> namedMappings;
+    bool warnedPersistent = false;
+};
+
+State capture;
+
+void flush() {
+    if (!capture.buffer.empty()) {
+        fwrite(capture.buffer.data(), 1, capture.buffer.size(), capture.file);
+        capture.stats.bytes += capture.buffer.size();
+        capture.buffer.clear();
+    }
+}
+
+void write(const void *data, size_t size) {
+    if (size >= directWriteSize) {
+        flush();
+        fwrite(data, 1, size, capture.file);
+        capture.stats.bytes += size;
+        return;
+    }
+    const unsigned char *bytes = (const unsigned char*)data;
+    capture.buffer.insert(capture.buffer.end(), bytes, bytes + size);
+}
+
+void pad(uint64_t size) {
+    static const unsigned char zeros[8] = {};
+    write(zeros, (size_t)(align8(size) - size));
+}
+
+// Collects the slots and blobs of one call and writes the record when it
+// goes out of scope. Blob data is not copied, it has to stay valid until then.
+class Record {
+public:
+    explicit Record(uint16_t opcode) : opcode_(opcode) {
+        if (opcode < namedMappedWrite) {
+            capture.stats.calls++;
+        }
+    }
+
+    ~Record() {
+        RecordHeader header;
+        uint64_t size = sizeof(header) + slotCount_ * sizeof(uint64_t);
+        for (int i = 0; i < blobCount_; i++) {
+            size += sizeof(uint64_t) + align8(blobs_[i].size);
+        }
+        header.size = (uint32_t)size;
+        header.opcode = opcode_;
+        header.slots = (uint16_t)slotCount_;
+        write(&header, sizeof(header));
+        write(slots_, slotCount_ * sizeof(uint64_t));
+        for (int i = 0; i < blobCount_; i++) {
+            write(&blobs_[i].size, sizeof(uint64_t));
+            write(blobs_[i].data, (size_t)blobs_[i].size);
+            pad(blobs_[i].size);
+        }
+        if (capture.buffer.size() >= flushSize) {
+            flush();
+        }
+    }
+
+    template <typename T>
+    void arg(T value) {
+        static_assert(sizeof(T) <= sizeof(uint64_t), "argument does not fit a slot");
+        uint64_t slot = 0;
+        memcpy(&slot, &value, sizeof(value));
+        slots_[slotCount_++] = slot;
+    }
+
+    // Captures size bytes behind pointer, or only its value when size is 0.
+    void pointer(const void *pointer, size_t size) {
+        arg(size != 0 ? nullptr : pointer);
+        blobs_[blobCount_].data = pointer;
+        blobs_[blobCount_].size = size;
+        blobCount_++;
+    }
+
+private:
+    struct Blob {
+        const void *data;
+        uint64_t size;
+    };
+
+    uint16_t opcode_;
+    int slotCount_ = 0;
+    int blobCount_ = 0;
+    uint64_t slots_[16];
+    Blob blobs_[4];
+};
+
+int components(GLenum format) {
+    switch (format) {
+    case GL_RG:
+    case GL_RG_INTEGER:
+    case GL_DEPTH_STENCIL:
+        return 2;
+    case GL_RGB:
+    case GL_BGR:
+    case GL_RGB_INTEGER:
+    case GL_BGR_INTEGER:
+        return 3;
+    case GL_RGBA:
+    case GL_BGRA:
+    case GL_RGBA_INTEGER:
+    case GL_BGRA_INTEGER:
+        return 4;
+    default:
+        return 1;
+    }
+}
+
+size_t pixelSize(GLenum format, GLenum type) {
+    switch (type) {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:
+        return components(format);
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:
+        return 2 * components(format);
+    case GL_UNSIGNED_INT:
+    case GL_INT:
+    case GL_FLOAT:
+        return 4 * components(format);
+    // Packed types hold a whole pixel.
+    case GL_UNSIGNED_BYTE_3_3_2:
+    case GL_UNSIGNED_BYTE_2_3_3_REV:
+        return 1;
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_5_6_5_REV:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+        return 2;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+        return 8;
+    default:
+        return 4;
+    }
+}
+
+// Bytes read from client memory by an upload; 0 when pixels is an offset
+// into the bound unpack buffer.
+size_t unpackBytes(const void *pixels, GLsizei width, GLsizei height, GLsizei depth,
+                   GLenum format, GLenum type) {
+    if (capture.unpackBuffer != 0 || pixels == nullptr || width <= 0 || height <= 0 || depth <= 0) {
+        return 0;
+    }
+    size_t pixel = pixelSize(format, type);
+    size_t rowLength = capture.unpackRowLength > 0 ? capture.unpackRowLength : width;
+    size_t alignment = capture.unpackAlignment > 0 ? capture.unpackAlignment : 1;
+    size_t rowStride = (rowLength * pixel + alignment - 1) / alignment * alignment;
+    size_t imageHeight = capture.unpackImageHeight > 0 ? capture.unpackImageHeight : height;
+    size_t imageStride = rowStride * imageHeight;
+    size_t skip = capture.unpackSkipPixels * pixel + capture.unpackSkipRows * rowStride;
+    if (depth > 1) {
+        skip += capture.unpackSkipImages * imageStride;
+    }
+    return skip + (depth - 1) * imageStride + (height - 1) * rowStride + width * pixel;
+}
+
+size_t unpackBytes(const void *data, GLsizei imageSize) {
+    return capture.unpackBuffer != 0 || data == nullptr || imageSize < 0 ? 0 : (size_t)imageSize;
+}
+
+// One texel or buffer element of a clear value.
+size_t clearBytes(const void *data, GLenum format, GLenum type) {
+    return data != nullptr ? pixelSize(format, type) : 0;
+}
+
+// Debug strings and labels: length bytes, or NUL terminated when negative.
+size_t stringBytes(const GLchar *string, GLsizei length) {
+    if (string == nullptr) {
+        return 0;
+    }
+    return length >= 0 ? (size_t)length : strlen(string) + 1;
+}
+
+size_t parameterCount(GLenum pname) {
+    return pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1;
+}
+
+void trackPixelStore(GLenum pname, GLint param) {
+    switch (pname) {
+    case GL_UNPACK_ALIGNMENT:    capture.unpackAlignment = param; break;
+    case GL_UNPACK_ROW_LENGTH:   capture.unpackRowLength = param; break;
+    case GL_UNPACK_IMAGE_HEIGHT: capture.unpackImageHeight = param; break;
+    case GL_UNPACK_SKIP_PIXELS:  capture.unpackSkipPixels = param; break;
+    case GL_UNPACK_SKIP_ROWS:    capture.unpackSkipRows = param; break;
+    case GL_UNPACK_SKIP_IMAGES:  capture.unpackSkipImages = param; break;
+    default: break;
+    }
+}
+
+// key is the target for mappedWrite and the buffer for namedMappedWrite.
+void writeMapped(uint16_t opcode, const std::unordered_map<GLuint, Mapping> &mappings,
+                 GLuint key, GLintptr offset, GLsizeiptr length) {
+    auto found = mappings.find(key);
+    if (found == mappings.end() || offset < 0 || length <= 0 ||
+        offset + length > found->second.length) {
+        return;
+    }
+    Record record(opcode);
+    record.arg(key);
+    record.arg(offset);
+    record.pointer(found->second.pointer + offset, (size_t)length);
+}
+
+// Writes through a persistent mapping that are never flushed explicitly
+// reach the GL without a call the capture could hook.
+void checkPersistent(GLbitfield access) {
+    if ((access & GL_MAP_PERSISTENT_BIT) && (access & GL_MAP_WRITE_BIT) &&
+        !(access & GL_MAP_FLUSH_EXPLICIT_BIT) && !capture.warnedPersistent) {
+        capture.warnedPersistent = true;
+        fprintf(stderr, "glcapture: writes through persistent mappings are only captured "
+                        "when flushed with glFlushMapped(Named)BufferRange\n");
+    }
+}
+
+// Joins a string array as NUL terminated strings, the way replay expects it.
+std::string joinStrings(GLsizei count, const GLchar *const *strings, const GLint *lengths) {
+    std::string joined;
+    for (GLsizei i = 0; i < count; i++) {
+        if (lengths != nullptr && lengths[i] >= 0) {
+            joined.append(strings[i], (size_t)lengths[i]);
+        } else {
+            joined.append(strings[i]);
+        }
+        joined.push_back('\0');
+    }
+    return joined;
+}
+
+struct CaptureEntryPoint {
+    void **global;
+    size_t offset;
+    void *shim;
+};
+
+#include "gl_capture_shims.inc"
+
+const size_t opcodeCount = sizeof(opcodeNames) / sizeof(opcodeNames[0]);
+
+// Hand written shims: the calls that feed the tracking above.
+
+void APIENTRY capture_glBindBuffer(GLenum target, GLuint buffer) {
+    capture.real.BindBuffer(target, buffer);
+    if (target == GL_PIXEL_UNPACK_BUFFER) {
+        capture.unpackBuffer = buffer;
+    }
+    Record record(opcode_glBindBuffer);
+    record.arg(target);
+    record.arg(buffer);
+}
+
+void APIENTRY capture_glPixelStorei(GLenum pname, GLint param) {
+    capture.real.PixelStorei(pname, param);
+    trackPixelStore(pname, param);
+    Record record(opcode_glPixelStorei);
+    record.arg(pname);
+    record.arg(param);
+}
+
+void APIENTRY capture_glPixelStoref(GLenum pname, GLfloat param) {
+    capture.real.PixelStoref(pname, param);
+    trackPixelStore(pname, (GLint)param);
+    Record record(opcode_glPixelStoref);
+    record.arg(pname);
+    record.arg(param);
+}
+
+void* APIENTRY capture_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    void *result = capture.real.MapBufferRange(target, offset, length, access);
+    checkPersistent(access);
+    if (result != nullptr && (access & GL_MAP_WRITE_BIT)) {
+        capture.mappings[target] = Mapping{(unsigned char*)result, length,
+                                           (access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0};
+    } else {
+        capture.mappings.erase(target);
+    }
+    Record record(opcode_glMapBufferRange);
+    record.arg(target);
+    record.arg(offset);
+    record.arg(length);
+    record.arg(access);
+    record.arg(result);
+    return result;
+}
+
+void* APIENTRY capture_glMapBuffer(GLenum target, GLenum access) {
+    void *result = capture.real.MapBuffer(target, access);
+    if (result != nullptr && access != GL_READ_ONLY) {
+        GLint size = 0;
+        capture.real.GetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+        capture.mappings[target] = Mapping{(unsigned char*)result, size, false};
+    } else {
+        capture.mappings.erase(target);
+    }
+    Record record(opcode_glMapBuffer);
+    record.arg(target);
+    record.arg(access);
+    record.arg(result);
+    return result;
+}
+
+void APIENTRY capture_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    writeMapped(mappedWrite, capture.mappings, target, offset, length);
+    capture.real.FlushMappedBufferRange(target, offset, length);
+    Record record(opcode_glFlushMappedBufferRange);
+    record.arg(target);
+    record.arg(offset);
+    record.arg(length);
+}
+
+GLboolean APIENTRY capture_glUnmapBuffer(GLenum target) {
+    auto found = capture.mappings.find(target);
+    if (found != capture.mappings.end()) {
+        if (!found->second.explicitFlush) {
+            writeMapped(mappedWrite, capture.mappings, target, 0, found->second.length);
+        }
+        capture.mappings.erase(found);
+    }
+    GLboolean result = capture.real.UnmapBuffer(target);
+    Record record(opcode_glUnmapBuffer);
+    record.arg(target);
+    record.arg(result);
+    return result;
+}
+
+void* APIENTRY capture_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    void *result = capture.real.MapNamedBufferRange(buffer, offset, length, access);
+    checkPersistent(access);
+    if (result != nullptr && (access & GL_MAP_WRITE_BIT)) {
+        capture.namedMappings[buffer] = Mapping{(unsigned char*)result, length,
+                                                (access & GL_MAP_FLUSH_EXPLICIT_BIT) != 0};
+    } else {
+        capture.namedMappings.erase(buffer);
+    }
+    Record record(opcode_glMapNamedBufferRange);
+    record.arg(buffer);
+    record.arg(offset);
+    record.arg(length);
+    record.arg(access);
+    record.arg(result);
+    return result;
+}
+
+void* APIENTRY capture_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    void *result = capture.real.MapNamedBuffer(buffer, access);
+    if (result != nullptr && access != GL_READ_ONLY) {
+        GLint size = 0;
+        capture.real.GetNamedBufferParameteriv(buffer, GL_BUFFER_SIZE, &size);
+        capture.namedMappings[buffer] = Mapping{(unsigned char*)result, size, false};
+    } else {
+        capture.namedMappings.erase(buffer);
+    }
+    Record record(opcode_glMapNamedBuffer);
+    record.arg(buffer);
+    record.arg(access);
+    record.arg(result);
+    return result;
+}
+
+void APIENTRY capture_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+    writeMapped(namedMappedWrite, capture.namedMappings, buffer, offset, length);
+    capture.real.FlushMappedNamedBufferRange(buffer, offset, length);
+    Record record(opcode_glFlushMappedNamedBufferRange);
+    record.arg(buffer);
+    record.arg(offset);
+    record.arg(length);
+}
+
+GLboolean APIENTRY capture_glUnmapNamedBuffer(GLuint buffer) {
+    auto found = capture.namedMappings.find(buffer);
+    if (found != capture.namedMappings.end()) {
+        if (!found->second.explicitFlush) {
+            writeMapped(namedMappedWrite, capture.namedMappings, buffer, 0, found->second.length);
+        }
+        capture.namedMappings.erase(found);
+    }
+    GLboolean result = capture.real.UnmapNamedBuffer(buffer);
+    Record record(opcode_glUnmapNamedBuffer);
+    record.arg(buffer);
+    record.arg(result);
+    return result;
+}
+
+void APIENTRY capture_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    capture.real.ShaderSource(shader, count, string, length);
+    std::string sources = joinStrings(count, string, length);
+    Record record(opcode_glShaderSource);
+    record.arg(shader);
+    record.arg(count);
+    record.pointer(sources.data(), sources.size());
+    record.pointer(nullptr, 0);
+}
+
+void APIENTRY capture_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    capture.real.TransformFeedbackVaryings(program, count, varyings, bufferMode);
+    std::string names = joinStrings(count, varyings, nullptr);
+    Record record(opcode_glTransformFeedbackVaryings);
+    record.arg(program);
+    record.arg(count);
+    record.pointer(names.data(), names.size());
+    record.arg(bufferMode);
+}
+
+GLuint APIENTRY capture_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+    GLuint result = capture.real.CreateShaderProgramv(type, count, strings);
+    std::string sources = joinStrings(count, strings, nullptr);
+    Record record(opcode_glCreateShaderProgramv);
+    record.arg(type);
+    record.arg(count);
+    record.pointer(sources.data(), sources.size());
+    record.arg(result);
+    return result;
+}
+
+void** entryPoint(GladGLContext *table, const CaptureEntryPoint &entry) {
+    return table != nullptr ? (void**)((char*)table + entry.offset) : entry.global;
+}
+
+void install() {
+    for (const CaptureEntryPoint &entry : entryPoints) {
+        void **slot = entryPoint(capture.table, entry);
+        void **real = (void**)((char*)&capture.real + entry.offset);
+        *real = *slot;
+        if (*slot != nullptr) {
+            *slot = entry.shim;
+        }
+    }
+}
+
+void uninstall() {
+    for (const CaptureEntryPoint &entry : entryPoints) {
+        void **slot = entryPoint(capture.table, entry);
+        void **real = (void**)((char*)&capture.real + entry.offset);
+        if (*slot == entry.shim) {
+            *slot = *real;
+        }
+    }
+}
+
+}
+
+bool start(const char *path) {
+    if (capture.file != nullptr) {
+        return false;
+    }
+    capture.file = fopen(path, "wb");
+    if (capture.file == nullptr) {
+        return false;
+    }
+
+    std::string names;
+    for (size_t i = 0; i < opcodeCount; i++) {
+        names.append(opcodeNames[i]);
+        names.push_back('\0');
+    }
+    FileHeader header;
+    memcpy(header.magic, fileMagic, sizeof(header.magic));
+    header.version = fileVersion;
+    header.opcodeCount = (uint32_t)opcodeCount;
+    header.namesSize = (uint32_t)align8(names.size());
+    capture.stats = Stats();
+    write(&header, sizeof(header));
+    write(names.data(), names.size());
+    pad(names.size());
+
+#ifdef GLAD_THREAD_LOCAL_DISPATCH
+    capture.table = gladGetGLContext();
+#else
+    capture.table = nullptr;
+#endif
+    capture.mappings.clear();
+    capture.namedMappings.clear();
+    capture.lastFrame = std::chrono::steady_clock::now();
+    install();
+    return true;
+}
+
+void frame() {
+    if (capture.file == nullptr) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    uint64_t elapsed = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        now - capture.lastFrame).count();
+    capture.lastFrame = now;
+    {
+        Record record(frameMarker);
+        record.arg((uint64_t)capture.stats.frames);
+        record.arg(elapsed);
+    }
+    capture.stats.frames++;
+    flush();
+}
+
+void stop() {
+    if (capture.file == nullptr) {
+        return;
+    }
+    uninstall();
+    flush();
+    fclose(capture.file);
+    capture.file = nullptr;
+}
+
+bool active() {
+    return capture.file != nullptr;
+}
+
+Stats stats() {
+    return capture.stats;
+}
+
+}
@@ -0,0 +1,46 @@
+#ifndef GL_CAPTURE_H
+#define GL_CAPTURE_H
+
+// Records every GL call made through glad into a file that the replay tool
+// plays back against another context, so driver cost can be measured on
+// real frames without the engine around it.
+//
+// start() wraps the loaded entry points (the global glad_gl* pointers, or
+// the current GladGLContext with GLAD_THREAD_LOCAL_DISPATCH) with shims
+// that call through and then append the call, its arguments and the data it
+// reads: buffer contents, texture images, shader sources, uniform values and
+// whatever the application writes into mapped buffers. Call it right after
+// loading GL, before any object is created, or replay will not know the
+// objects the stream refers to. Calls are expected from one thread, the one
+// that owns the context.
+//
+// Buffer offsets (vertex attrib pointers, indices) are stored as they are, so
+// client side vertex arrays are not supported, as in a core profile. Pixel
+// data is sized from the UNPACK_ALIGNMENT, ROW_LENGTH, IMAGE_HEIGHT and SKIP
+// pixel store settings made through glPixelStorei. Writes through persistent
+// mappings (GL_MAP_PERSISTENT_BIT) are only seen when the application flushes
+// them with glFlushMappedBufferRange or glFlushMappedNamedBufferRange. See
+// gl_capture_format.h for the file layout.
+
+namespace glcapture {
+
+struct Stats {
+    unsigned long long calls = 0;
+    unsigned long long frames = 0;
+    unsigned long long bytes = 0;
+};
+
+bool start(const char *path);
+
+// Marks the end of a frame, e.g. right after swapping buffers.
+void frame();
+
+// Puts the real entry points back and closes the file.
+void stop();
+
+bool active();
+Stats stats();
+
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef GL_CAPTURE_FORMAT_H
+#define GL_CAPTURE_FORMAT_H
+
+// Layout of the command stream written by gl_capture.cpp and read by replay.
+// Everything is little endian and 8 byte aligned, so the file can be mapped
+// and records read in place; a capture cut short (the process died) is still
+// readable up to its last complete record.
+//
+//   FileHeader
+//   entry point names, NUL terminated, in opcode order, padded to 8 bytes
+//   records until the end of the file
+//
+// A record is a RecordHeader followed by `slots` 8 byte argument slots, one
+// per parameter in declaration order plus one for the result of functions
+// that return something, and then one blob per pointer parameter, in order:
+// a u64 byte count and the bytes, padded to 8. Scalars are stored in the low
+// bytes of their slot. A pointer parameter whose data was captured has a
+// zero slot and a non-empty blob; otherwise (buffer offsets, NULL, outputs)
+// the slot holds the pointer value and the blob is empty.
+
+#include <cstdint>
+
+namespace glcapture {
+
+const char fileMagic[4] = {'G', 'L', 'C', 'P'};
+// Version 2 added namedMappedWrite; version 1 files are still read.
+const uint32_t fileVersion = 2;
+
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t opcodeCount;
+    uint32_t namesSize;     // including the padding
+};
+
+struct RecordHeader {
+    uint32_t size;          // including this header, a multiple of 8
+    uint16_t opcode;
+    uint16_t slots;
+};
+
+// Opcodes above the entry points, from the top down.
+
+// End of a frame; one slot with the frame number, one with the time since
+// the previous marker in nanoseconds.
+const uint16_t frameMarker = 0xFFFF;
+
+// Bytes the application wrote through a mapping, recorded right before the
+// glUnmapBuffer or glFlushMappedBufferRange that publishes them. Slots: the
+// target and the offset into the mapped range; one blob with the bytes.
+const uint16_t mappedWrite = 0xFFFE;
+
+// The same for a buffer mapped with glMapNamedBuffer(Range); the first slot
+// is the buffer name instead of the target.
+const uint16_t namedMappedWrite = 0xFFFD;
+
+inline uint64_t align8(uint64_t size) {
+    return (size + 7) & ~(uint64_t)7;
+}
+
+}
+
+#endif
@@ -0,0 +1,330 @@
+#include "gl_debug.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace gldebug {
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// A power of two. Messages come in bursts (a shader that fails to compile,
+// a broken draw repeated every frame), the rate limit keeps the steady state
+// well below this.
+const size_t queueSize = 1024;
+
+// How long the drain thread sleeps when the queue is empty.
+const std::chrono::milliseconds drainInterval(5);
+
+// IDs ignore() can take; glDebugMessageControl only filters IDs of one
+// source and type, so they are checked in the callback.
+const int maxIgnoredIds = 64;
+
+const GLenum firstSource = GL_DEBUG_SOURCE_API;
+const int sourceCount = GL_DEBUG_SOURCE_OTHER - GL_DEBUG_SOURCE_API + 1;
+
+// Bounded multi-producer queue (Vyukov): a slot's sequence number says
+// whether it is free for the producer holding ticket n (sequence == n) or
+// holds a message for the consumer at n (sequence == n + 1).
+class Queue {
+public:
+    Queue() {
+        for (size_t i = 0; i < queueSize; i++) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(const Message &message) {
+        size_t position = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot &slot = slots_[position & (queueSize - 1)];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+            if (difference == 0) {
+                if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.message = message;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Single consumer, the drain thread.
+    bool pop(Message &message) {
+        Slot &slot = slots_[head_ & (queueSize - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            return false;
+        }
+        message = slot.message;
+        slot.sequence.store(head_ + queueSize, std::memory_order_release);
+        head_++;
+        return true;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        Message message;
+    };
+
+    Slot slots_[queueSize];
+    alignas(64) std::atomic<size_t> tail_{0};
+    alignas(64) size_t head_ = 0;
+};
+
+// Messages a source delivered in the current one second window.
+struct RateLimit {
+    std::atomic<long long> window{-1};
+    std::atomic<unsigned int> count{0};
+    std::atomic<unsigned long long> suppressed{0};
+};
+
+struct Counters {
+    std::atomic<unsigned long long> received{0};
+    std::atomic<unsigned long long> delivered{0};
+    std::atomic<unsigned long long> ignored{0};
+    std::atomic<unsigned long long> rateLimited{0};
+    std::atomic<unsigned long long> dropped{0};
+};
+
+struct State {
+    bool active = false;
+    Options options;
+    Clock::time_point started;
+    std::thread drainer;
+    std::atomic<bool> draining{false};
+    Queue queue;
+    std::atomic<GLuint> ignoredIds[maxIgnoredIds];
+    std::atomic<int> ignoredCount{0};
+    RateLimit limits[sourceCount];
+    Counters counters;
+};
+
+State debug;
+
+bool ignored(GLuint id) {
+    int count = debug.ignoredCount.load(std::memory_order_acquire);
+    for (int i = 0; i < count; i++) {
+        if (debug.ignoredIds[i].load(std::memory_order_relaxed) == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool allowed(GLenum source) {
+    if (debug.options.maxPerSecond == 0) {
+        return true;
+    }
+    int index = source >= firstSource && source < firstSource + sourceCount
+        ? (int)(source - firstSource) : sourceCount - 1;
+    RateLimit &limit = debug.limits[index];
+
+    long long window = std::chrono::duration_cast<std::chrono::seconds>(Clock::now() - debug.started).count();
+    long long current = limit.window.load(std::memory_order_relaxed);
+    if (current != window && limit.window.compare_exchange_strong(current, window, std::memory_order_relaxed)) {
+        limit.count.store(0, std::memory_order_relaxed);
+    }
+    if (limit.count.fetch_add(1, std::memory_order_relaxed) < debug.options.maxPerSecond) {
+        return true;
+    }
+    limit.suppressed.fetch_add(1, std::memory_order_relaxed);
+    debug.counters.rateLimited.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void APIENTRY callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+                       const GLchar *text, const void *) {
+    debug.counters.received.fetch_add(1, std::memory_order_relaxed);
+    if (ignored(id)) {
+        debug.counters.ignored.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (!allowed(source)) {
+        return;
+    }
+
+    Message message;
+    message.source = source;
+    message.type = type;
+    message.id = id;
+    message.severity = severity;
+    size_t size = length >= 0 ? (size_t)length : strlen(text);
+    if (size >= sizeof(message.text)) {
+        size = sizeof(message.text) - 1;
+    }
+    memcpy(message.text, text, size);
+    message.text[size] = '\0';
+
+    if (!debug.queue.push(message)) {
+        debug.counters.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void print(const Message &message) {
+    std::cerr << "GL " << severityName(message.severity) << " " << typeName(message.type)
+              << " from " << sourceName(message.source) << " (" << message.id << "): "
+              << message.text << std::endl;
+}
+
+void deliver() {
+    Message message;
+    while (debug.queue.pop(message)) {
+        if (debug.options.handler) {
+            debug.options.handler(message);
+        } else {
+            print(message);
+        }
+        debug.counters.delivered.fetch_add(1, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < sourceCount; i++) {
+        unsigned long long suppressed = debug.limits[i].suppressed.exchange(0, std::memory_order_relaxed);
+        if (suppressed != 0) {
+            std::cerr << "GL debug: " << suppressed << " messages from "
+                      << sourceName(firstSource + i) << " over the rate limit" << std::endl;
+        }
+    }
+}
+
+void drain() {
+    while (debug.draining.load(std::memory_order_acquire)) {
+        deliver();
+        std::this_thread::sleep_for(drainInterval);
+    }
+}
+
+bool hasDebugOutput() {
+#ifdef GLAD_THREAD_LOCAL_DISPATCH
+    GladGLContext *context = gladGetGLContext();
+    return context != nullptr && context->capabilities.debug_output;
+#else
+    return GLCapabilities.debug_output != 0;
+#endif
+}
+
+}
+
+bool start(const Options &options) {
+    if (debug.active || !hasDebugOutput()) {
+        return false;
+    }
+    debug.options = options;
+    debug.started = Clock::now();
+    for (RateLimit &limit : debug.limits) {
+        limit.window.store(-1, std::memory_order_relaxed);
+        limit.count.store(0, std::memory_order_relaxed);
+        limit.suppressed.store(0, std::memory_order_relaxed);
+    }
+    debug.counters.received.store(0, std::memory_order_relaxed);
+    debug.counters.delivered.store(0, std::memory_order_relaxed);
+    debug.counters.ignored.store(0, std::memory_order_relaxed);
+    debug.counters.rateLimited.store(0, std::memory_order_relaxed);
+    debug.counters.dropped.store(0, std::memory_order_relaxed);
+
+    glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+    if (!options.notifications) {
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+    }
+    for (GLuint id : options.ignoredIds) {
+        ignore(id);
+    }
+
+    debug.draining.store(true, std::memory_order_release);
+    debug.drainer = std::thread(drain);
+
+    glDebugMessageCallback(callback, nullptr);
+    if (options.synchronous) {
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    } else {
+        glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    }
+    glEnable(GL_DEBUG_OUTPUT);
+    debug.active = true;
+    return true;
+}
+
+bool ignore(GLuint id) {
+    if (ignored(id)) {
+        return true;
+    }
+    int count = debug.ignoredCount.load(std::memory_order_relaxed);
+    if (count == maxIgnoredIds) {
+        return false;
+    }
+    debug.ignoredIds[count].store(id, std::memory_order_relaxed);
+    debug.ignoredCount.store(count + 1, std::memory_order_release);
+    return true;
+}
+
+void stop() {
+    if (!debug.active) {
+        return;
+    }
+    glDisable(GL_DEBUG_OUTPUT);
+    glDebugMessageCallback(nullptr, nullptr);
+    // A driver thread may still be inside the callback; whatever it queues
+    // after the last deliver() is handed out by the next start().
+    debug.draining.store(false, std::memory_order_release);
+    debug.drainer.join();
+    deliver();
+    debug.active = false;
+}
+
+bool active() {
+    return debug.active;
+}
+
+Stats stats() {
+    Stats stats;
+    stats.received = debug.counters.received.load(std::memory_order_relaxed);
+    stats.delivered = debug.counters.delivered.load(std::memory_order_relaxed);
+    stats.ignored = debug.counters.ignored.load(std::memory_order_relaxed);
+    stats.rateLimited = debug.counters.rateLimited.load(std::memory_order_relaxed);
+    stats.dropped = debug.counters.dropped.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const char *sourceName(GLenum source) {
+    switch (source) {
+    case GL_DEBUG_SOURCE_API: return "API";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window system";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY: return "third party";
+    case GL_DEBUG_SOURCE_APPLICATION: return "application";
+    default: return "other";
+    }
+}
+
+const char *typeName(GLenum type) {
+    switch (type) {
+    case GL_DEBUG_TYPE_ERROR: return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated behavior";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behavior";
+    case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+    case GL_DEBUG_TYPE_MARKER: return "marker";
+    case GL_DEBUG_TYPE_PUSH_GROUP: return "push group";
+    case GL_DEBUG_TYPE_POP_GROUP: return "pop group";
+    default: return "other";
+    }
+}
+
+const char *severityName(GLenum severity) {
+    switch (severity) {
+    case GL_DEBUG_SEVERITY_HIGH: return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+    case GL_DEBUG_SEVERITY_LOW: return "low";
+    default: return "notification";
+    }
+}
+
+}
@@ -0,0 +1,77 @@
+#ifndef GL_DEBUG_H
+#define GL_DEBUG_H
+
+// Collects GL errors and driver messages through KHR_debug (core in GL 4.3)
+// instead of polling glGetError, which makes the driver finish pending work
+// before it can answer.
+//
+// start() enables asynchronous debug output and installs a callback that
+// only copies each message into a fixed size lock-free queue; the driver may
+// call it from any of its threads. A background thread drains the queue and
+// hands the messages to the handler, by default a line on stderr. Messages
+// with an ignored ID are dropped in the callback, and each source (API,
+// shader compiler, ...) may deliver at most maxPerSecond messages per second;
+// the rest are counted and reported as one line. start() and stop() make GL
+// calls and belong on the thread that owns the context.
+
+#include <glad/glad.h>
+
+#include <functional>
+#include <vector>
+
+namespace gldebug {
+
+struct Message {
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    GLenum severity;
+    // Truncated to fit the queue slot.
+    char text[240];
+};
+
+struct Options {
+    std::vector<GLuint> ignoredIds;
+    // Per source; 0 for no limit.
+    unsigned int maxPerSecond = 20;
+    // GL_DEBUG_SEVERITY_NOTIFICATION messages (buffer placement hints and
+    // the like) are only generated when this is set.
+    bool notifications = false;
+    // Have the driver call back on the thread and inside the call that
+    // caused the message, for breakpoints; slower.
+    bool synchronous = false;
+    // Runs on the drain thread. Prints to stderr when empty.
+    std::function<void(const Message &)> handler;
+};
+
+struct Stats {
+    unsigned long long received = 0;
+    unsigned long long delivered = 0;
+    unsigned long long ignored = 0;
+    unsigned long long rateLimited = 0;
+    // Lost because the queue was full.
+    unsigned long long dropped = 0;
+};
+
+// Fails when the context has no debug output (GLCapabilities.debug_output).
+bool start(const Options &options = Options());
+
+// Drops messages with this ID from now on, Options::ignoredIds included. Up
+// to 64 IDs; false when that many are ignored already. Call it from one
+// thread at a time.
+bool ignore(GLuint id);
+
+// Uninstalls the callback and delivers what is still queued.
+void stop();
+
+bool active();
+Stats stats();
+
+// "API", "shader compiler", "error", "high", ... for printing.
+const char *sourceName(GLenum source);
+const char *typeName(GLenum type);
+const char *severityName(GLenum severity);
+
+}
+
+#endif
@@ -4,24 +4,39 @@
 
     Language/Generator: C/C++
     Specification: gl
-    APIs: gl=3.3
+    APIs: gl=4.5
     Profile: core
     Extensions:
-        
+        GL_ARB_buffer_storage,
+        GL_ARB_direct_state_access,
+        GL_ARB_multi_draw_indirect,
+        GL_KHR_debug,
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=4.5" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_multi_draw_indirect,GL_KHR_debug,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.5&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_direct_state_access&extensions=GL_ARB_multi_draw_indirect&extensions=GL_KHR_debug&extensions=GL_KHR_parallel_shader_compile
+
+    Extended from the glad 0.1.33 output for gl=3.3 by the scripts in
+    tools/glad, which also regenerate the loader's own tables (see
+    "Regenerating the loader" in README.md).
 */
 
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+/* clock_gettime */
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+/* The loader itself always works on the glad_gl* globals. */
+#undef GLAD_THREAD_LOCAL_DISPATCH
 #include <glad/glad.h>
 
 static void* get_proc(const char *namez);
@@ -75,8 +90,17 @@ void close_gl(void) {
         libGL = NULL;
     }
 }
+
+void gladSetGLBackends(const char *backends) {
+    (void)backends;
+}
+
+const char *gladGetGLBackend(void) {
+    return libGL != NULL ? "wgl" : NULL;
+}
 #else
 #include <dlfcn.h>
+#include <time.h>
 static void* libGL;
 
 #if !defined(__APPLE__) && !defined(__HAIKU__)
@@ -84,6 +108,7 @@ typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
 static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
 #endif
 
+#if defined(__APPLE__) || defined(__HAIKU__)
 static
 int open_gl(void) {
 #ifdef __APPLE__
@@ -102,19 +127,85 @@ int open_gl(void) {
         libGL = dlopen(NAMES[index], RTLD_NOW | RTLD_GLOBAL);
 
         if(libGL != NULL) {
-#if defined(__APPLE__) || defined(__HAIKU__)
             return 1;
+        }
+    }
+
+    return 0;
+}
+
+void gladSetGLBackends(const char *backends) {
+    (void)backends;
+}
+
+const char *gladGetGLBackend(void) {
+    return libGL != NULL ? "system" : NULL;
+}
 #else
-            gladGetProcAddressPtr = (PFNGLXGETPROCADDRESSPROC_PRIVATE)dlsym(libGL,
-                "glXGetProcAddressARB");
-            return gladGetProcAddressPtr != NULL;
-#endif
+/* The libraries open_gl can take the entry points from. */
+#include <glad/gl_backends.h>
+
+static char gl_backend_order[64];
+static const struct gladGLBackend *gl_backend_opened = NULL;
+
+static int open_gl_backend(const struct gladGLBackend *backend) {
+    unsigned int index;
+    for(index = 0; backend->libraries[index] != NULL; index++) {
+        libGL = dlopen(backend->libraries[index], RTLD_NOW | RTLD_GLOBAL);
+        if(libGL == NULL) {
+            continue;
+        }
+
+        gladGetProcAddressPtr = (PFNGLXGETPROCADDRESSPROC_PRIVATE)dlsym(libGL,
+            backend->getProcAddress);
+        if(gladGetProcAddressPtr != NULL) {
+            gl_backend_opened = backend;
+            return 1;
+        }
+        dlclose(libGL);
+        libGL = NULL;
+    }
+    return 0;
+}
+
+static
+int open_gl(void) {
+    const char *order = gl_backend_order[0] != '\0' ? gl_backend_order : getenv("GLAD_GL_BACKENDS");
+    const char *next;
+    size_t length;
+    unsigned int index;
+
+    if(order == NULL || order[0] == '\0') {
+        order = "glx,egl,osmesa";
+    }
+
+    /* Backends in the order listed, unknown names are skipped. */
+    for(next = order; *next != '\0'; next += length + (next[length] == ',')) {
+        length = strcspn(next, ",");
+        for(index = 0; index < GLAD_NUM_GL_BACKENDS; index++) {
+            if(strlen(GLAD_GL_BACKENDS[index].name) == length &&
+                    strncmp(GLAD_GL_BACKENDS[index].name, next, length) == 0 &&
+                    open_gl_backend(&GLAD_GL_BACKENDS[index])) {
+                return 1;
+            }
         }
     }
 
     return 0;
 }
 
+void gladSetGLBackends(const char *backends) {
+    gl_backend_order[0] = '\0';
+    if(backends != NULL) {
+        strncat(gl_backend_order, backends, sizeof(gl_backend_order) - 1);
+    }
+}
+
+const char *gladGetGLBackend(void) {
+    return libGL != NULL && gl_backend_opened != NULL ? gl_backend_opened->name : NULL;
+}
+#endif
+
 static
 void close_gl(void) {
     if(libGL != NULL) {
@@ -145,9 +236,796 @@ void* get_proc(const char *namez) {
     return result;
 }
 
+static unsigned long long now_ns(void) {
+#if defined(_WIN32) || defined(__CYGWIN__)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)(counter.QuadPart / frequency.QuadPart) * 1000000000ull +
+        (unsigned long long)(counter.QuadPart % frequency.QuadPart) * 1000000000ull /
+        (unsigned long long)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ull + (unsigned long long)now.tv_nsec;
+#endif
+}
+
+/* Resident loading keeps libGL open between loads and resolves every name of
+ * the sorted table below in a single pass. Later loads only look the names
+ * up in the cache, which makes loading again for another context cheap. */
+static const char *proc_names[] = {
+    "glActiveShaderProgram",
+    "glActiveTexture",
+    "glAttachShader",
+    "glBeginConditionalRender",
+    "glBeginQuery",
+    "glBeginQueryIndexed",
+    "glBeginTransformFeedback",
+    "glBindAttribLocation",
+    "glBindBuffer",
+    "glBindBufferBase",
+    "glBindBufferRange",
+    "glBindBuffersBase",
+    "glBindBuffersRange",
+    "glBindFragDataLocation",
+    "glBindFragDataLocationIndexed",
+    "glBindFramebuffer",
+    "glBindImageTexture",
+    "glBindImageTextures",
+    "glBindProgramPipeline",
+    "glBindRenderbuffer",
+    "glBindSampler",
+    "glBindSamplers",
+    "glBindTexture",
+    "glBindTextureUnit",
+    "glBindTextures",
+    "glBindTransformFeedback",
+    "glBindVertexArray",
+    "glBindVertexBuffer",
+    "glBindVertexBuffers",
+    "glBlendColor",
+    "glBlendEquation",
+    "glBlendEquationSeparate",
+    "glBlendEquationSeparatei",
+    "glBlendEquationi",
+    "glBlendFunc",
+    "glBlendFuncSeparate",
+    "glBlendFuncSeparatei",
+    "glBlendFunci",
+    "glBlitFramebuffer",
+    "glBlitNamedFramebuffer",
+    "glBufferData",
+    "glBufferStorage",
+    "glBufferSubData",
+    "glCheckFramebufferStatus",
+    "glCheckNamedFramebufferStatus",
+    "glClampColor",
+    "glClear",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glClearBufferfi",
+    "glClearBufferfv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearColor",
+    "glClearDepth",
+    "glClearDepthf",
+    "glClearNamedBufferData",
+    "glClearNamedBufferSubData",
+    "glClearNamedFramebufferfi",
+    "glClearNamedFramebufferfv",
+    "glClearNamedFramebufferiv",
+    "glClearNamedFramebufferuiv",
+    "glClearStencil",
+    "glClearTexImage",
+    "glClearTexSubImage",
+    "glClientWaitSync",
+    "glClipControl",
+    "glColorMask",
+    "glColorMaski",
+    "glColorP3ui",
+    "glColorP3uiv",
+    "glColorP4ui",
+    "glColorP4uiv",
+    "glCompileShader",
+    "glCompressedTexImage1D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage3D",
+    "glCompressedTexSubImage1D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D",
+    "glCompressedTextureSubImage3D",
+    "glCopyBufferSubData",
+    "glCopyImageSubData",
+    "glCopyNamedBufferSubData",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glCopyTexSubImage3D",
+    "glCopyTextureSubImage1D",
+    "glCopyTextureSubImage2D",
+    "glCopyTextureSubImage3D",
+    "glCreateBuffers",
+    "glCreateFramebuffers",
+    "glCreateProgram",
+    "glCreateProgramPipelines",
+    "glCreateQueries",
+    "glCreateRenderbuffers",
+    "glCreateSamplers",
+    "glCreateShader",
+    "glCreateShaderProgramv",
+    "glCreateTextures",
+    "glCreateTransformFeedbacks",
+    "glCreateVertexArrays",
+    "glCullFace",
+    "glDebugMessageCallback",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDeleteBuffers",
+    "glDeleteFramebuffers",
+    "glDeleteProgram",
+    "glDeleteProgramPipelines",
+    "glDeleteQueries",
+    "glDeleteRenderbuffers",
+    "glDeleteSamplers",
+    "glDeleteShader",
+    "glDeleteSync",
+    "glDeleteTextures",
+    "glDeleteTransformFeedbacks",
+    "glDeleteVertexArrays",
+    "glDepthFunc",
+    "glDepthMask",
+    "glDepthRange",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glDepthRangef",
+    "glDetachShader",
+    "glDisable",
+    "glDisableVertexArrayAttrib",
+    "glDisableVertexAttribArray",
+    "glDisablei",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glDrawArrays",
+    "glDrawArraysIndirect",
+    "glDrawArraysInstanced",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawBuffer",
+    "glDrawBuffers",
+    "glDrawElements",
+    "glDrawElementsBaseVertex",
+    "glDrawElementsIndirect",
+    "glDrawElementsInstanced",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertex",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glDrawRangeElements",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStream",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glEnable",
+    "glEnableVertexArrayAttrib",
+    "glEnableVertexAttribArray",
+    "glEnablei",
+    "glEndConditionalRender",
+    "glEndQuery",
+    "glEndQueryIndexed",
+    "glEndTransformFeedback",
+    "glFenceSync",
+    "glFinish",
+    "glFlush",
+    "glFlushMappedBufferRange",
+    "glFlushMappedNamedBufferRange",
+    "glFramebufferParameteri",
+    "glFramebufferRenderbuffer",
+    "glFramebufferTexture",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferTextureLayer",
+    "glFrontFace",
+    "glGenBuffers",
+    "glGenFramebuffers",
+    "glGenProgramPipelines",
+    "glGenQueries",
+    "glGenRenderbuffers",
+    "glGenSamplers",
+    "glGenTextures",
+    "glGenTransformFeedbacks",
+    "glGenVertexArrays",
+    "glGenerateMipmap",
+    "glGenerateTextureMipmap",
+    "glGetActiveAtomicCounterBufferiv",
+    "glGetActiveAttrib",
+    "glGetActiveSubroutineName",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveUniform",
+    "glGetActiveUniformBlockName",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformName",
+    "glGetActiveUniformsiv",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetBooleani_v",
+    "glGetBooleanv",
+    "glGetBufferParameteri64v",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glGetBufferSubData",
+    "glGetCompressedTexImage",
+    "glGetCompressedTextureImage",
+    "glGetCompressedTextureSubImage",
+    "glGetDebugMessageLog",
+    "glGetDoublei_v",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloati_v",
+    "glGetFloatv",
+    "glGetFragDataIndex",
+    "glGetFragDataLocation",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGetFramebufferParameteriv",
+    "glGetGraphicsResetStatus",
+    "glGetInteger64i_v",
+    "glGetInteger64v",
+    "glGetIntegeri_v",
+    "glGetIntegerv",
+    "glGetInternalformati64v",
+    "glGetInternalformativ",
+    "glGetMultisamplefv",
+    "glGetNamedBufferParameteri64v",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedBufferPointerv",
+    "glGetNamedBufferSubData",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glGetNamedFramebufferParameteriv",
+    "glGetNamedRenderbufferParameteriv",
+    "glGetObjectLabel",
+    "glGetObjectPtrLabel",
+    "glGetPointerv",
+    "glGetProgramBinary",
+    "glGetProgramInfoLog",
+    "glGetProgramInterfaceiv",
+    "glGetProgramPipelineInfoLog",
+    "glGetProgramPipelineiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramStageiv",
+    "glGetProgramiv",
+    "glGetQueryBufferObjecti64v",
+    "glGetQueryBufferObjectiv",
+    "glGetQueryBufferObjectui64v",
+    "glGetQueryBufferObjectuiv",
+    "glGetQueryIndexediv",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectui64v",
+    "glGetQueryObjectuiv",
+    "glGetQueryiv",
+    "glGetRenderbufferParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterIuiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameteriv",
+    "glGetShaderInfoLog",
+    "glGetShaderPrecisionFormat",
+    "glGetShaderSource",
+    "glGetShaderiv",
+    "glGetString",
+    "glGetStringi",
+    "glGetSubroutineIndex",
+    "glGetSubroutineUniformLocation",
+    "glGetSynciv",
+    "glGetTexImage",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTextureImage",
+    "glGetTextureLevelParameterfv",
+    "glGetTextureLevelParameteriv",
+    "glGetTextureParameterIiv",
+    "glGetTextureParameterIuiv",
+    "glGetTextureParameterfv",
+    "glGetTextureParameteriv",
+    "glGetTextureSubImage",
+    "glGetTransformFeedbackVarying",
+    "glGetTransformFeedbacki64_v",
+    "glGetTransformFeedbacki_v",
+    "glGetTransformFeedbackiv",
+    "glGetUniformBlockIndex",
+    "glGetUniformIndices",
+    "glGetUniformLocation",
+    "glGetUniformSubroutineuiv",
+    "glGetUniformdv",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetUniformuiv",
+    "glGetVertexArrayIndexed64iv",
+    "glGetVertexArrayIndexediv",
+    "glGetVertexArrayiv",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glGetVertexAttribLdv",
+    "glGetVertexAttribPointerv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetnCompressedTexImage",
+    "glGetnTexImage",
+    "glGetnUniformdv",
+    "glGetnUniformfv",
+    "glGetnUniformiv",
+    "glGetnUniformuiv",
+    "glHint",
+    "glInvalidateBufferData",
+    "glInvalidateBufferSubData",
+    "glInvalidateFramebuffer",
+    "glInvalidateNamedFramebufferData",
+    "glInvalidateNamedFramebufferSubData",
+    "glInvalidateSubFramebuffer",
+    "glInvalidateTexImage",
+    "glInvalidateTexSubImage",
+    "glIsBuffer",
+    "glIsEnabled",
+    "glIsEnabledi",
+    "glIsFramebuffer",
+    "glIsProgram",
+    "glIsProgramPipeline",
+    "glIsQuery",
+    "glIsRenderbuffer",
+    "glIsSampler",
+    "glIsShader",
+    "glIsSync",
+    "glIsTexture",
+    "glIsTransformFeedback",
+    "glIsVertexArray",
+    "glLineWidth",
+    "glLinkProgram",
+    "glLogicOp",
+    "glMapBuffer",
+    "glMapBufferRange",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glMaxShaderCompilerThreadsKHR",
+    "glMemoryBarrier",
+    "glMemoryBarrierByRegion",
+    "glMinSampleShading",
+    "glMultiDrawArrays",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElements",
+    "glMultiDrawElementsBaseVertex",
+    "glMultiDrawElementsIndirect",
+    "glMultiTexCoordP1ui",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexCoordP2ui",
+    "glMultiTexCoordP2uiv",
+    "glMultiTexCoordP3ui",
+    "glMultiTexCoordP3uiv",
+    "glMultiTexCoordP4ui",
+    "glMultiTexCoordP4uiv",
+    "glNamedBufferData",
+    "glNamedBufferStorage",
+    "glNamedBufferSubData",
+    "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers",
+    "glNamedFramebufferParameteri",
+    "glNamedFramebufferReadBuffer",
+    "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferTexture",
+    "glNamedFramebufferTextureLayer",
+    "glNamedRenderbufferStorage",
+    "glNamedRenderbufferStorageMultisample",
+    "glNormalP3ui",
+    "glNormalP3uiv",
+    "glObjectLabel",
+    "glObjectPtrLabel",
+    "glPatchParameterfv",
+    "glPatchParameteri",
+    "glPauseTransformFeedback",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glPointSize",
+    "glPolygonMode",
+    "glPolygonOffset",
+    "glPopDebugGroup",
+    "glPrimitiveRestartIndex",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix4x3dv",
+    "glProgramUniformMatrix4x3fv",
+    "glProvokingVertex",
+    "glPushDebugGroup",
+    "glQueryCounter",
+    "glReadBuffer",
+    "glReadPixels",
+    "glReadnPixels",
+    "glReleaseShaderCompiler",
+    "glRenderbufferStorage",
+    "glRenderbufferStorageMultisample",
+    "glResumeTransformFeedback",
+    "glSampleCoverage",
+    "glSampleMaski",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glScissor",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glSecondaryColorP3ui",
+    "glSecondaryColorP3uiv",
+    "glShaderBinary",
+    "glShaderSource",
+    "glShaderStorageBlockBinding",
+    "glStencilFunc",
+    "glStencilFuncSeparate",
+    "glStencilMask",
+    "glStencilMaskSeparate",
+    "glStencilOp",
+    "glStencilOpSeparate",
+    "glTexBuffer",
+    "glTexBufferRange",
+    "glTexCoordP1ui",
+    "glTexCoordP1uiv",
+    "glTexCoordP2ui",
+    "glTexCoordP2uiv",
+    "glTexCoordP3ui",
+    "glTexCoordP3uiv",
+    "glTexCoordP4ui",
+    "glTexCoordP4uiv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glTexImage2DMultisample",
+    "glTexImage3D",
+    "glTexImage3DMultisample",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage2DMultisample",
+    "glTexStorage3D",
+    "glTexStorage3DMultisample",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glTexSubImage3D",
+    "glTextureBarrier",
+    "glTextureBuffer",
+    "glTextureBufferRange",
+    "glTextureParameterIiv",
+    "glTextureParameterIuiv",
+    "glTextureParameterf",
+    "glTextureParameterfv",
+    "glTextureParameteri",
+    "glTextureParameteriv",
+    "glTextureStorage1D",
+    "glTextureStorage2D",
+    "glTextureStorage2DMultisample",
+    "glTextureStorage3D",
+    "glTextureStorage3DMultisample",
+    "glTextureSubImage1D",
+    "glTextureSubImage2D",
+    "glTextureSubImage3D",
+    "glTextureView",
+    "glTransformFeedbackBufferBase",
+    "glTransformFeedbackBufferRange",
+    "glTransformFeedbackVaryings",
+    "glUniform1d",
+    "glUniform1dv",
+    "glUniform1f",
+    "glUniform1fv",
+    "glUniform1i",
+    "glUniform1iv",
+    "glUniform1ui",
+    "glUniform1uiv",
+    "glUniform2d",
+    "glUniform2dv",
+    "glUniform2f",
+    "glUniform2fv",
+    "glUniform2i",
+    "glUniform2iv",
+    "glUniform2ui",
+    "glUniform2uiv",
+    "glUniform3d",
+    "glUniform3dv",
+    "glUniform3f",
+    "glUniform3fv",
+    "glUniform3i",
+    "glUniform3iv",
+    "glUniform3ui",
+    "glUniform3uiv",
+    "glUniform4d",
+    "glUniform4dv",
+    "glUniform4f",
+    "glUniform4fv",
+    "glUniform4i",
+    "glUniform4iv",
+    "glUniform4ui",
+    "glUniform4uiv",
+    "glUniformBlockBinding",
+    "glUniformMatrix2dv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix4fv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix4x3dv",
+    "glUniformMatrix4x3fv",
+    "glUniformSubroutinesuiv",
+    "glUnmapBuffer",
+    "glUnmapNamedBuffer",
+    "glUseProgram",
+    "glUseProgramStages",
+    "glValidateProgram",
+    "glValidateProgramPipeline",
+    "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat",
+    "glVertexArrayAttribIFormat",
+    "glVertexArrayAttribLFormat",
+    "glVertexArrayBindingDivisor",
+    "glVertexArrayElementBuffer",
+    "glVertexArrayVertexBuffer",
+    "glVertexArrayVertexBuffers",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribBinding",
+    "glVertexAttribDivisor",
+    "glVertexAttribFormat",
+    "glVertexAttribI1i",
+    "glVertexAttribI1iv",
+    "glVertexAttribI1ui",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2i",
+    "glVertexAttribI2iv",
+    "glVertexAttribI2ui",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3i",
+    "glVertexAttribI3iv",
+    "glVertexAttribI3ui",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4i",
+    "glVertexAttribI4iv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4ui",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4usv",
+    "glVertexAttribIFormat",
+    "glVertexAttribIPointer",
+    "glVertexAttribL1d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2d",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3d",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4d",
+    "glVertexAttribL4dv",
+    "glVertexAttribLFormat",
+    "glVertexAttribLPointer",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glVertexAttribPointer",
+    "glVertexBindingDivisor",
+    "glVertexP2ui",
+    "glVertexP2uiv",
+    "glVertexP3ui",
+    "glVertexP3uiv",
+    "glVertexP4ui",
+    "glVertexP4uiv",
+    "glViewport",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glWaitSync"
+};
+
+#define NUM_PROCS (sizeof(proc_names) / sizeof(proc_names[0]))
+
+#if !defined(_WIN32) && !defined(__CYGWIN__)
+/* wglGetProcAddress answers depend on the current context, so Windows has
+ * to resolve again on every load. */
+#define GLAD_CACHE_PROCS 1
+#endif
+
+static void* proc_cache[NUM_PROCS];
+static int proc_cache_filled = 0;
+static struct gladLoadStats load_stats;
+
+static int compare_proc_name(const void *name, const void *entry) {
+    return strcmp((const char *)name, *(const char * const *)entry);
+}
+
+static void* get_proc_cached(const char *namez) {
+    const char **entry = (const char **)bsearch(namez, proc_names, NUM_PROCS,
+        sizeof(proc_names[0]), compare_proc_name);
+
+    if(entry == NULL) {
+        load_stats.resolved++;
+        return get_proc(namez);
+    }
+    return proc_cache[entry - proc_names];
+}
+
+int gladLoadGLResident(void) {
+    unsigned long long start, opened, resolved;
+    unsigned int index;
+    int status;
+
+    start = now_ns();
+    load_stats.resolved = 0;
+    if(libGL == NULL && !open_gl()) {
+        return 0;
+    }
+    opened = now_ns();
+
+#ifdef GLAD_CACHE_PROCS
+    if(!proc_cache_filled) {
+#endif
+        for(index = 0; index < NUM_PROCS; index++) {
+            proc_cache[index] = get_proc(proc_names[index]);
+        }
+        load_stats.resolved = (int)NUM_PROCS;
+        proc_cache_filled = 1;
+#ifdef GLAD_CACHE_PROCS
+    }
+#endif
+    resolved = now_ns();
+
+    status = gladLoadGLLoader(&get_proc_cached);
+
+    load_stats.open_us = (double)(opened - start) / 1e3;
+    load_stats.resolve_us = (double)(resolved - opened) / 1e3;
+    load_stats.load_us = (double)(now_ns() - start) / 1e3;
+    return status;
+}
+
+struct gladLoadStats gladGetLoadStats(void) {
+    return load_stats;
+}
+
+void gladCloseGL(void) {
+    close_gl();
+    proc_cache_filled = 0;
+}
+
+int gladOpenGL(void) {
+    return libGL != NULL || open_gl();
+}
+
+void *gladGetGLProcAddress(const char *name) {
+    return get_proc(name);
+}
+
 int gladLoadGL(void) {
     int status = 0;
 
+    /* Lazy trampolines and resident loads keep resolving through a library
+     * that is already open, so it is used and left open. */
+    if(libGL != NULL) {
+        return gladLoadGLLoader(&get_proc);
+    }
     if(open_gl()) {
         status = gladLoadGLLoader(&get_proc);
         close_gl();
@@ -156,8 +1034,20 @@ int gladLoadGL(void) {
     return status;
 }
 
+int gladLoadGLLazy(void) {
+    /* The trampolines resolve through get_proc long after loading returns,
+     * so the library is kept open instead of closed again. */
+    if(libGL == NULL && !open_gl()) {
+        return 0;
+    }
+
+    return gladLoadGLLoaderLazy(&get_proc);
+}
+
 struct gladGLversionStruct GLVersion = { 0, 0 };
 
+struct gladGLCapabilities GLCapabilities = { 0, 0, 0, 0, 0 };
+
 #if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
 #define _GLAD_IS_SOME_NEW_VERSION 1
 #endif
@@ -165,93 +1055,153 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* The extension names are copied into a single block: an open addressing
+ * hash table of name offsets followed by the NUL terminated names. A slot
+ * holds the offset of its name plus one, zero marks an empty slot. */
+static struct gladGLExtensions exts_gl = { NULL, 0 };
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        unsigned int index;
+#define EXTS_SLOTS(exts) ((unsigned int *)(exts)->block)
+#define EXTS_NAMES(exts) ((exts)->block + ((exts)->mask + 1) * sizeof(unsigned int))
 
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
+static unsigned int hash_ext(const char *ext, size_t len) {
+    /* FNV-1a */
+    unsigned int hash = 2166136261u;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= (unsigned char)ext[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-        if (exts_i == NULL) {
-            return 0;
-        }
+static int alloc_exts(struct gladGLExtensions *exts, size_t count, size_t names_size) {
+    unsigned int capacity = 16;
+    size_t slots_size;
 
-        for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+    while(capacity < count * 2) {
+        capacity *= 2;
+    }
+    slots_size = capacity * sizeof(unsigned int);
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
+    exts->block = (char *)malloc(slots_size + names_size);
+    if(exts->block == NULL) {
+        return 0;
     }
-#endif
+    memset(exts->block, 0, slots_size);
+    exts->mask = capacity - 1;
     return 1;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+/* Appends the name at offset `used` of the names area and indexes it. */
+static size_t add_ext(struct gladGLExtensions *exts, size_t used, const char *ext, size_t len) {
+    unsigned int *slots = EXTS_SLOTS(exts);
+    char *names = EXTS_NAMES(exts);
+    unsigned int index = hash_ext(ext, len) & exts->mask;
+
+    memcpy(names + used, ext, len);
+    names[used + len] = '\0';
+
+    while(slots[index] != 0) {
+        index = (index + 1) & exts->mask;
     }
+    slots[index] = (unsigned int)used + 1;
+    return used + len + 1;
 }
 
-static int has_ext(const char *ext) {
+static int get_exts(struct gladGLExtensions *exts, int major,
+                    PFNGLGETSTRINGPROC get_string,
+                    PFNGLGETINTEGERVPROC get_integerv,
+                    PFNGLGETSTRINGIPROC get_stringi) {
+    size_t count = 0;
+    size_t names_size = 0;
+    size_t used = 0;
+
 #ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
+    if(major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+        const char *names = (const char *)get_string(GL_EXTENSIONS);
+        const char *ext;
+        size_t len;
+
+        if(names == NULL) {
             return 0;
         }
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
+        /* Every name but the last is followed by a space, which leaves
+         * room for the terminators. */
+        for(ext = names; *ext != '\0'; ext += len) {
+            while(*ext == ' ') ext++;
+            len = strcspn(ext, " ");
+            if(len > 0) count++;
+        }
+        names_size = strlen(names) + 1;
 
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
+        if(!alloc_exts(exts, count, names_size)) {
+            return 0;
+        }
+
+        for(ext = names; *ext != '\0'; ext += len) {
+            while(*ext == ' ') ext++;
+            len = strcspn(ext, " ");
+            if(len > 0) used = add_ext(exts, used, ext, len);
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+        unsigned int index;
+        int num_exts_i = 0;
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
+        get_integerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if(num_exts_i < 0) {
+            num_exts_i = 0;
+        }
+        count = (size_t)num_exts_i;
+
+        /* Size everything first so the names and the table share one
+         * allocation. The returned strings are static, asking twice is cheap. */
+        for(index = 0; index < count; index++) {
+            const char *gl_str_tmp = (const char*)get_stringi(GL_EXTENSIONS, index);
+            if(gl_str_tmp != NULL) names_size += strlen(gl_str_tmp) + 1;
+        }
+
+        if(!alloc_exts(exts, count, names_size)) {
+            return 0;
+        }
+
+        for(index = 0; index < count; index++) {
+            const char *gl_str_tmp = (const char*)get_stringi(GL_EXTENSIONS, index);
+            if(gl_str_tmp != NULL) used = add_ext(exts, used, gl_str_tmp, strlen(gl_str_tmp));
         }
     }
+#else
+    (void)major; (void)get_integerv; (void)get_stringi;
 #endif
+    return 1;
+}
+
+static void free_exts(struct gladGLExtensions *exts) {
+    free(exts->block);
+    exts->block = NULL;
+    exts->mask = 0;
+}
+
+static int has_ext(const struct gladGLExtensions *exts, const char *ext) {
+    const unsigned int *slots;
+    const char *names;
+    unsigned int index;
+
+    if(exts->block == NULL || ext == NULL) {
+        return 0;
+    }
+    slots = EXTS_SLOTS(exts);
+    names = EXTS_NAMES(exts);
+
+    index = hash_ext(ext, strlen(ext)) & exts->mask;
+    while(slots[index] != 0) {
+        if(strcmp(names + slots[index] - 1, ext) == 0) {
+            return 1;
+        }
+        index = (index + 1) & exts->mask;
+    }
 
     return 0;
 }
@@ -267,41 +1217,84 @@ int GLAD_GL_VERSION_3_0 = 0;
 int GLAD_GL_VERSION_3_1 = 0;
 int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
+int GLAD_GL_VERSION_4_0 = 0;
+int GLAD_GL_VERSION_4_1 = 0;
+int GLAD_GL_VERSION_4_2 = 0;
+int GLAD_GL_VERSION_4_3 = 0;
+int GLAD_GL_VERSION_4_4 = 0;
+int GLAD_GL_VERSION_4_5 = 0;
+int GLAD_GL_ARB_buffer_storage = 0;
+int GLAD_GL_ARB_direct_state_access = 0;
+int GLAD_GL_ARB_multi_draw_indirect = 0;
+int GLAD_GL_KHR_debug = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = NULL;
 PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
 PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
 PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
 PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
+PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = NULL;
 PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
 PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
 PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
 PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
 PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
+PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase = NULL;
+PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange = NULL;
 PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
 PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
 PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
+PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = NULL;
+PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures = NULL;
+PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = NULL;
 PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
 PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
+PFNGLBINDSAMPLERSPROC glad_glBindSamplers = NULL;
 PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
+PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = NULL;
+PFNGLBINDTEXTURESPROC glad_glBindTextures = NULL;
+PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = NULL;
 PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
+PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer = NULL;
+PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers = NULL;
 PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
 PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
 PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
+PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = NULL;
+PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = NULL;
 PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
 PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
+PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = NULL;
+PFNGLBLENDFUNCIPROC glad_glBlendFunci = NULL;
 PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
+PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer = NULL;
 PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
 PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
 PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
+PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus = NULL;
 PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
 PFNGLCLEARPROC glad_glClear = NULL;
+PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData = NULL;
+PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData = NULL;
 PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
 PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
 PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
 PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
 PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
 PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
+PFNGLCLEARDEPTHFPROC glad_glClearDepthf = NULL;
+PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData = NULL;
+PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv = NULL;
+PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv = NULL;
 PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
+PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage = NULL;
+PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage = NULL;
 PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
+PFNGLCLIPCONTROLPROC glad_glClipControl = NULL;
 PFNGLCOLORMASKPROC glad_glColorMask = NULL;
 PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
 PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
@@ -315,52 +1308,94 @@ PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
 PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
 PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
 PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D = NULL;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D = NULL;
 PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
+PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData = NULL;
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData = NULL;
 PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
 PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
 PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
 PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
 PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D = NULL;
+PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D = NULL;
+PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = NULL;
+PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers = NULL;
 PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
+PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines = NULL;
+PFNGLCREATEQUERIESPROC glad_glCreateQueries = NULL;
+PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers = NULL;
+PFNGLCREATESAMPLERSPROC glad_glCreateSamplers = NULL;
 PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
+PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = NULL;
+PFNGLCREATETEXTURESPROC glad_glCreateTextures = NULL;
+PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks = NULL;
+PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = NULL;
 PFNGLCULLFACEPROC glad_glCullFace = NULL;
+PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
+PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
+PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
 PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
 PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
 PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
+PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = NULL;
 PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
 PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
 PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
 PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
 PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
 PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
+PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = NULL;
 PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
 PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
 PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
 PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
+PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = NULL;
+PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = NULL;
+PFNGLDEPTHRANGEFPROC glad_glDepthRangef = NULL;
 PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
 PFNGLDISABLEPROC glad_glDisable = NULL;
+PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib = NULL;
 PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
 PFNGLDISABLEIPROC glad_glDisablei = NULL;
+PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = NULL;
+PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect = NULL;
 PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
 PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
 PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
 PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
 PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
 PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
 PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
 PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
 PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
+PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = NULL;
+PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = NULL;
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = NULL;
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = NULL;
 PFNGLENABLEPROC glad_glEnable = NULL;
+PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib = NULL;
 PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
 PFNGLENABLEIPROC glad_glEnablei = NULL;
 PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
 PFNGLENDQUERYPROC glad_glEndQuery = NULL;
+PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = NULL;
 PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
 PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
 PFNGLFINISHPROC glad_glFinish = NULL;
 PFNGLFLUSHPROC glad_glFlush = NULL;
 PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
+PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange = NULL;
+PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri = NULL;
 PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
 PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
 PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
@@ -370,13 +1405,20 @@ PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
 PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
 PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
 PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
+PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = NULL;
 PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
 PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
 PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
 PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
+PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = NULL;
 PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
 PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
+PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap = NULL;
+PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = NULL;
 PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
+PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = NULL;
+PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = NULL;
+PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = NULL;
 PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
 PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
 PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
@@ -391,19 +1433,53 @@ PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
 PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
 PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
 PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
+PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage = NULL;
+PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage = NULL;
+PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
+PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = NULL;
 PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
 PFNGLGETERRORPROC glad_glGetError = NULL;
+PFNGLGETFLOATI_VPROC glad_glGetFloati_v = NULL;
 PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
 PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
 PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
 PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
+PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv = NULL;
+PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus = NULL;
 PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
 PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
 PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
 PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
+PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v = NULL;
+PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = NULL;
 PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
+PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v = NULL;
+PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv = NULL;
+PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv = NULL;
+PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData = NULL;
+PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv = NULL;
+PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv = NULL;
+PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv = NULL;
+PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
+PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
+PFNGLGETPOINTERVPROC glad_glGetPointerv = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
 PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
+PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv = NULL;
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = NULL;
+PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = NULL;
+PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex = NULL;
+PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation = NULL;
+PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex = NULL;
+PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName = NULL;
+PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv = NULL;
+PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = NULL;
 PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
+PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v = NULL;
+PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv = NULL;
+PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v = NULL;
+PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv = NULL;
+PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = NULL;
 PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
 PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
 PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
@@ -415,10 +1491,13 @@ PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
 PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
 PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
 PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
+PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = NULL;
 PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
 PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
 PFNGLGETSTRINGPROC glad_glGetString = NULL;
 PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
+PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = NULL;
+PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = NULL;
 PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
 PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
 PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
@@ -427,40 +1506,81 @@ PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
 PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
 PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
 PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
+PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage = NULL;
+PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv = NULL;
+PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv = NULL;
+PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv = NULL;
+PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv = NULL;
+PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv = NULL;
+PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv = NULL;
+PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage = NULL;
 PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
+PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v = NULL;
+PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v = NULL;
+PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv = NULL;
 PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
 PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
 PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
+PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = NULL;
+PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = NULL;
 PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
 PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
 PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
+PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv = NULL;
+PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv = NULL;
+PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv = NULL;
 PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
 PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
+PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = NULL;
 PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
 PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
 PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
 PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
+PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage = NULL;
+PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage = NULL;
+PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv = NULL;
+PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv = NULL;
+PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv = NULL;
+PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv = NULL;
 PFNGLHINTPROC glad_glHint = NULL;
+PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = NULL;
+PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = NULL;
+PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = NULL;
+PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData = NULL;
+PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData = NULL;
+PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = NULL;
+PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = NULL;
+PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = NULL;
 PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
 PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
 PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
 PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
 PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
+PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = NULL;
 PFNGLISQUERYPROC glad_glIsQuery = NULL;
 PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
 PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
 PFNGLISSHADERPROC glad_glIsShader = NULL;
 PFNGLISSYNCPROC glad_glIsSync = NULL;
 PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
+PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = NULL;
 PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
 PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
 PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
 PFNGLLOGICOPPROC glad_glLogicOp = NULL;
 PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
 PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
+PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer = NULL;
+PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
+PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
+PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion = NULL;
+PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = NULL;
 PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
 PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
 PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
 PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
 PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
 PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
@@ -469,8 +1589,25 @@ PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
 PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
 PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
 PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
+PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = NULL;
+PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = NULL;
+PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = NULL;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer = NULL;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers = NULL;
+PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri = NULL;
+PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer = NULL;
+PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer = NULL;
+PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture = NULL;
+PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer = NULL;
+PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage = NULL;
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample = NULL;
 PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
 PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
+PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
+PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
+PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = NULL;
+PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = NULL;
+PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = NULL;
 PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
 PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
 PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
@@ -480,13 +1617,70 @@ PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
 PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
 PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
 PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
+PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
 PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = NULL;
+PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = NULL;
+PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = NULL;
+PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = NULL;
+PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = NULL;
+PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = NULL;
+PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = NULL;
+PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = NULL;
+PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = NULL;
+PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = NULL;
+PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = NULL;
+PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = NULL;
+PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = NULL;
+PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = NULL;
+PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = NULL;
+PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = NULL;
+PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = NULL;
+PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = NULL;
+PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = NULL;
+PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = NULL;
+PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = NULL;
+PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = NULL;
+PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = NULL;
+PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = NULL;
+PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = NULL;
+PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = NULL;
+PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = NULL;
+PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = NULL;
+PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = NULL;
+PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = NULL;
+PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = NULL;
+PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = NULL;
+PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = NULL;
 PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
+PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
 PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
 PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
 PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
+PFNGLREADNPIXELSPROC glad_glReadnPixels = NULL;
+PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = NULL;
 PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
 PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
+PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = NULL;
 PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
 PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
 PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
@@ -496,9 +1690,14 @@ PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
 PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
 PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
 PFNGLSCISSORPROC glad_glScissor = NULL;
+PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = NULL;
+PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = NULL;
+PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = NULL;
 PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
 PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
+PFNGLSHADERBINARYPROC glad_glShaderBinary = NULL;
 PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
+PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding = NULL;
 PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
 PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
 PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
@@ -506,6 +1705,7 @@ PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
 PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
 PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
 PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
+PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange = NULL;
 PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
 PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
 PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
@@ -525,28 +1725,61 @@ PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
 PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
 PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
 PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
+PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
+PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample = NULL;
+PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample = NULL;
 PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
 PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
 PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
+PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier = NULL;
+PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer = NULL;
+PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange = NULL;
+PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv = NULL;
+PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv = NULL;
+PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf = NULL;
+PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv = NULL;
+PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = NULL;
+PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv = NULL;
+PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D = NULL;
+PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = NULL;
+PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample = NULL;
+PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D = NULL;
+PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample = NULL;
+PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D = NULL;
+PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = NULL;
+PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D = NULL;
+PFNGLTEXTUREVIEWPROC glad_glTextureView = NULL;
+PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase = NULL;
+PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange = NULL;
 PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
+PFNGLUNIFORM1DPROC glad_glUniform1d = NULL;
+PFNGLUNIFORM1DVPROC glad_glUniform1dv = NULL;
 PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
 PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
 PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
 PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
 PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
 PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
+PFNGLUNIFORM2DPROC glad_glUniform2d = NULL;
+PFNGLUNIFORM2DVPROC glad_glUniform2dv = NULL;
 PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
 PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
 PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
 PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
 PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
 PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
+PFNGLUNIFORM3DPROC glad_glUniform3d = NULL;
+PFNGLUNIFORM3DVPROC glad_glUniform3dv = NULL;
 PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
 PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
 PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
 PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
 PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
 PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
+PFNGLUNIFORM4DPROC glad_glUniform4d = NULL;
+PFNGLUNIFORM4DVPROC glad_glUniform4dv = NULL;
 PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
 PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
 PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
@@ -554,18 +1787,39 @@ PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
 PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
 PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
 PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
+PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = NULL;
 PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
+PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = NULL;
 PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
+PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = NULL;
 PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
+PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = NULL;
 PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
+PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = NULL;
 PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
+PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = NULL;
 PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
+PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = NULL;
 PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
+PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = NULL;
 PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
+PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = NULL;
 PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
+PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = NULL;
 PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
+PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer = NULL;
 PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
+PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = NULL;
 PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
+PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = NULL;
+PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding = NULL;
+PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat = NULL;
+PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat = NULL;
+PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat = NULL;
+PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor = NULL;
+PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer = NULL;
+PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer = NULL;
+PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers = NULL;
 PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
 PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
 PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
@@ -602,7 +1856,9 @@ PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
 PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
 PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
 PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
+PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding = NULL;
 PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
+PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat = NULL;
 PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
 PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
 PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
@@ -623,7 +1879,18 @@ PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
 PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
 PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
 PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
+PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat = NULL;
 PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
+PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = NULL;
+PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = NULL;
+PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = NULL;
+PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = NULL;
+PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = NULL;
+PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = NULL;
+PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = NULL;
+PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = NULL;
+PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat = NULL;
+PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = NULL;
 PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
 PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
 PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
@@ -633,6 +1900,7 @@ PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
 PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
 PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
 PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
+PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor = NULL;
 PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
 PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
 PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
@@ -640,6 +1908,9 @@ PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
 PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
 PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
 PFNGLVIEWPORTPROC glad_glViewport = NULL;
+PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
+PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
+PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
@@ -1054,87 +2325,13712 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
-static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
-	return 1;
+static void load_GL_VERSION_4_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)load("glMinSampleShading");
+	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)load("glBlendEquationi");
+	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)load("glBlendEquationSeparatei");
+	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)load("glBlendFunci");
+	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)load("glBlendFuncSeparatei");
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+	glad_glUniform1d = (PFNGLUNIFORM1DPROC)load("glUniform1d");
+	glad_glUniform2d = (PFNGLUNIFORM2DPROC)load("glUniform2d");
+	glad_glUniform3d = (PFNGLUNIFORM3DPROC)load("glUniform3d");
+	glad_glUniform4d = (PFNGLUNIFORM4DPROC)load("glUniform4d");
+	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)load("glUniform1dv");
+	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)load("glUniform2dv");
+	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)load("glUniform3dv");
+	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)load("glUniform4dv");
+	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)load("glUniformMatrix2dv");
+	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)load("glUniformMatrix3dv");
+	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)load("glUniformMatrix4dv");
+	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)load("glUniformMatrix2x3dv");
+	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)load("glUniformMatrix2x4dv");
+	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)load("glUniformMatrix3x2dv");
+	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)load("glUniformMatrix3x4dv");
+	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)load("glUniformMatrix4x2dv");
+	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)load("glUniformMatrix4x3dv");
+	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)load("glGetUniformdv");
+	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)load("glGetSubroutineUniformLocation");
+	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)load("glGetSubroutineIndex");
+	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)load("glGetActiveSubroutineUniformiv");
+	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)load("glGetActiveSubroutineUniformName");
+	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)load("glGetActiveSubroutineName");
+	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)load("glUniformSubroutinesuiv");
+	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)load("glGetUniformSubroutineuiv");
+	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)load("glGetProgramStageiv");
+	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)load("glPatchParameteri");
+	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)load("glPatchParameterfv");
+	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)load("glBindTransformFeedback");
+	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)load("glDeleteTransformFeedbacks");
+	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)load("glGenTransformFeedbacks");
+	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)load("glIsTransformFeedback");
+	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)load("glPauseTransformFeedback");
+	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)load("glResumeTransformFeedback");
+	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)load("glDrawTransformFeedback");
+	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)load("glDrawTransformFeedbackStream");
+	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)load("glBeginQueryIndexed");
+	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)load("glEndQueryIndexed");
+	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)load("glGetQueryIndexediv");
 }
-
-static void find_coreGL(void) {
-
-    /* Thank you @elmindreda
-     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
-     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
-     */
-    int i, major, minor;
-
-    const char* version;
-    const char* prefixes[] = {
-        "OpenGL ES-CM ",
-        "OpenGL ES-CL ",
-        "OpenGL ES ",
-        NULL
-    };
-
-    version = (const char*) glGetString(GL_VERSION);
-    if (!version) return;
-
-    for (i = 0;  prefixes[i];  i++) {
-        const size_t length = strlen(prefixes[i]);
-        if (strncmp(version, prefixes[i], length) == 0) {
-            version += length;
-            break;
-        }
-    }
-
-/* PR #18 */
-#ifdef _MSC_VER
-    sscanf_s(version, "%d.%d", &major, &minor);
-#else
-    sscanf(version, "%d.%d", &major, &minor);
-#endif
-
-    GLVersion.major = major; GLVersion.minor = minor;
-    max_loaded_major = major; max_loaded_minor = minor;
-	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
-	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
-	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
-	GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
-	GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
-	GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
-	GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
-	GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
-	GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
-	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
-	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
-	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
-	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
-		max_loaded_major = 3;
-		max_loaded_minor = 3;
-	}
+static void load_GL_VERSION_4_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)load("glReleaseShaderCompiler");
+	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)load("glShaderBinary");
+	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)load("glGetShaderPrecisionFormat");
+	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)load("glDepthRangef");
+	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)load("glClearDepthf");
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)load("glUseProgramStages");
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)load("glActiveShaderProgram");
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)load("glCreateShaderProgramv");
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)load("glBindProgramPipeline");
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)load("glDeleteProgramPipelines");
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)load("glGenProgramPipelines");
+	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)load("glIsProgramPipeline");
+	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)load("glGetProgramPipelineiv");
+	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)load("glProgramUniform1i");
+	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)load("glProgramUniform1iv");
+	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)load("glProgramUniform1f");
+	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)load("glProgramUniform1fv");
+	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)load("glProgramUniform1d");
+	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)load("glProgramUniform1dv");
+	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)load("glProgramUniform1ui");
+	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)load("glProgramUniform1uiv");
+	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)load("glProgramUniform2i");
+	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)load("glProgramUniform2iv");
+	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)load("glProgramUniform2f");
+	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)load("glProgramUniform2fv");
+	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)load("glProgramUniform2d");
+	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)load("glProgramUniform2dv");
+	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)load("glProgramUniform2ui");
+	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)load("glProgramUniform2uiv");
+	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)load("glProgramUniform3i");
+	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)load("glProgramUniform3iv");
+	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)load("glProgramUniform3f");
+	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)load("glProgramUniform3fv");
+	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)load("glProgramUniform3d");
+	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)load("glProgramUniform3dv");
+	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)load("glProgramUniform3ui");
+	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)load("glProgramUniform3uiv");
+	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)load("glProgramUniform4i");
+	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)load("glProgramUniform4iv");
+	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)load("glProgramUniform4f");
+	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)load("glProgramUniform4fv");
+	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)load("glProgramUniform4d");
+	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)load("glProgramUniform4dv");
+	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)load("glProgramUniform4ui");
+	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)load("glProgramUniform4uiv");
+	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)load("glProgramUniformMatrix2fv");
+	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)load("glProgramUniformMatrix3fv");
+	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)load("glProgramUniformMatrix4fv");
+	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)load("glProgramUniformMatrix2dv");
+	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)load("glProgramUniformMatrix3dv");
+	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)load("glProgramUniformMatrix4dv");
+	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)load("glProgramUniformMatrix2x3fv");
+	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)load("glProgramUniformMatrix3x2fv");
+	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)load("glProgramUniformMatrix2x4fv");
+	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)load("glProgramUniformMatrix4x2fv");
+	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)load("glProgramUniformMatrix3x4fv");
+	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)load("glProgramUniformMatrix4x3fv");
+	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)load("glProgramUniformMatrix2x3dv");
+	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)load("glProgramUniformMatrix3x2dv");
+	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)load("glProgramUniformMatrix2x4dv");
+	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)load("glProgramUniformMatrix4x2dv");
+	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)load("glProgramUniformMatrix3x4dv");
+	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)load("glProgramUniformMatrix4x3dv");
+	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)load("glValidateProgramPipeline");
+	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)load("glGetProgramPipelineInfoLog");
+	glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)load("glVertexAttribL1d");
+	glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)load("glVertexAttribL2d");
+	glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)load("glVertexAttribL3d");
+	glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)load("glVertexAttribL4d");
+	glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)load("glVertexAttribL1dv");
+	glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)load("glVertexAttribL2dv");
+	glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)load("glVertexAttribL3dv");
+	glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)load("glVertexAttribL4dv");
+	glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)load("glVertexAttribLPointer");
+	glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)load("glGetVertexAttribLdv");
+	glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)load("glViewportArrayv");
+	glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)load("glViewportIndexedf");
+	glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)load("glViewportIndexedfv");
+	glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)load("glScissorArrayv");
+	glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)load("glScissorIndexed");
+	glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)load("glScissorIndexedv");
+	glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)load("glDepthRangeArrayv");
+	glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)load("glDepthRangeIndexed");
+	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)load("glGetFloati_v");
+	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)load("glGetDoublei_v");
 }
+static void load_GL_VERSION_4_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
+	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)load("glGetInternalformativ");
+	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)load("glGetActiveAtomicCounterBufferiv");
+	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)load("glBindImageTexture");
+	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)load("glMemoryBarrier");
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
+	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)load("glDrawTransformFeedbackInstanced");
+	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)load("glDrawTransformFeedbackStreamInstanced");
+}
+static void load_GL_VERSION_4_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)load("glClearBufferData");
+	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)load("glClearBufferSubData");
+	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)load("glDispatchCompute");
+	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)load("glDispatchComputeIndirect");
+	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)load("glCopyImageSubData");
+	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)load("glFramebufferParameteri");
+	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)load("glGetFramebufferParameteriv");
+	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)load("glGetInternalformati64v");
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)load("glGetProgramInterfaceiv");
+	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)load("glGetProgramResourceIndex");
+	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)load("glGetProgramResourceName");
+	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)load("glGetProgramResourceiv");
+	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)load("glGetProgramResourceLocation");
+	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)load("glGetProgramResourceLocationIndex");
+	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)load("glShaderStorageBlockBinding");
+	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)load("glTexBufferRange");
+	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)load("glTexStorage2DMultisample");
+	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)load("glTexStorage3DMultisample");
+	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)load("glTextureView");
+	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)load("glBindVertexBuffer");
+	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)load("glVertexAttribFormat");
+	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)load("glVertexAttribIFormat");
+	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)load("glVertexAttribLFormat");
+	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)load("glVertexAttribBinding");
+	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)load("glVertexBindingDivisor");
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+}
+static void load_GL_VERSION_4_4(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)load("glClearTexImage");
+	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)load("glClearTexSubImage");
+	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)load("glBindBuffersBase");
+	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)load("glBindBuffersRange");
+	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)load("glBindTextures");
+	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)load("glBindSamplers");
+	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)load("glBindImageTextures");
+	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)load("glBindVertexBuffers");
+}
+static void load_GL_VERSION_4_5(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)load("glClipControl");
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)load("glMemoryBarrierByRegion");
+	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)load("glGetTextureSubImage");
+	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)load("glGetCompressedTextureSubImage");
+	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)load("glGetGraphicsResetStatus");
+	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)load("glGetnCompressedTexImage");
+	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)load("glGetnTexImage");
+	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)load("glGetnUniformdv");
+	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)load("glGetnUniformfv");
+	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)load("glGetnUniformiv");
+	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)load("glGetnUniformuiv");
+	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)load("glReadnPixels");
+	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)load("glTextureBarrier");
+}
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_direct_state_access(GLADloadproc load) {
+	if(!GLAD_GL_ARB_direct_state_access) return;
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+}
+static void load_GL_ARB_multi_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+}
+static void load_GL_KHR_debug(GLADloadproc load) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+#ifndef GLAD_PROFILE
+/* Lazy loading: every pointer starts out as a trampoline that resolves the
+ * real entry point on its first call, patches the pointer and forwards the
+ * call. Concurrent first calls race benignly, both store the same address.
+ * An entry point the driver does not have leaves its trampoline in place,
+ * and calling it does nothing and returns 0 instead of jumping to NULL. */
+static GLADloadproc glad_lazy_load = NULL;
 
-int gladLoadGLLoader(GLADloadproc load) {
-	GLVersion.major = 0; GLVersion.minor = 0;
-	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
-	if(glGetString == NULL) return 0;
-	if(glGetString(GL_VERSION) == NULL) return 0;
-	find_coreGL();
-	load_GL_VERSION_1_0(load);
-	load_GL_VERSION_1_1(load);
-	load_GL_VERSION_1_2(load);
-	load_GL_VERSION_1_3(load);
-	load_GL_VERSION_1_4(load);
-	load_GL_VERSION_1_5(load);
-	load_GL_VERSION_2_0(load);
-	load_GL_VERSION_2_1(load);
-	load_GL_VERSION_3_0(load);
-	load_GL_VERSION_3_1(load);
-	load_GL_VERSION_3_2(load);
-	load_GL_VERSION_3_3(load);
-
-	if (!find_extensionsGL()) return 0;
-	return GLVersion.major != 0 || GLVersion.minor != 0;
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+	PFNGLCULLFACEPROC proc = (PFNGLCULLFACEPROC)glad_lazy_load("glCullFace");
+	if(proc == NULL) return;
+	glad_glCullFace = proc;
+	proc(mode);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+	PFNGLFRONTFACEPROC proc = (PFNGLFRONTFACEPROC)glad_lazy_load("glFrontFace");
+	if(proc == NULL) return;
+	glad_glFrontFace = proc;
+	proc(mode);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+	PFNGLHINTPROC proc = (PFNGLHINTPROC)glad_lazy_load("glHint");
+	if(proc == NULL) return;
+	glad_glHint = proc;
+	proc(target, mode);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+	PFNGLLINEWIDTHPROC proc = (PFNGLLINEWIDTHPROC)glad_lazy_load("glLineWidth");
+	if(proc == NULL) return;
+	glad_glLineWidth = proc;
+	proc(width);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+	PFNGLPOINTSIZEPROC proc = (PFNGLPOINTSIZEPROC)glad_lazy_load("glPointSize");
+	if(proc == NULL) return;
+	glad_glPointSize = proc;
+	proc(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+	PFNGLPOLYGONMODEPROC proc = (PFNGLPOLYGONMODEPROC)glad_lazy_load("glPolygonMode");
+	if(proc == NULL) return;
+	glad_glPolygonMode = proc;
+	proc(face, mode);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLSCISSORPROC proc = (PFNGLSCISSORPROC)glad_lazy_load("glScissor");
+	if(proc == NULL) return;
+	glad_glScissor = proc;
+	proc(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	PFNGLTEXPARAMETERFPROC proc = (PFNGLTEXPARAMETERFPROC)glad_lazy_load("glTexParameterf");
+	if(proc == NULL) return;
+	glad_glTexParameterf = proc;
+	proc(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	PFNGLTEXPARAMETERFVPROC proc = (PFNGLTEXPARAMETERFVPROC)glad_lazy_load("glTexParameterfv");
+	if(proc == NULL) return;
+	glad_glTexParameterfv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	PFNGLTEXPARAMETERIPROC proc = (PFNGLTEXPARAMETERIPROC)glad_lazy_load("glTexParameteri");
+	if(proc == NULL) return;
+	glad_glTexParameteri = proc;
+	proc(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	PFNGLTEXPARAMETERIVPROC proc = (PFNGLTEXPARAMETERIVPROC)glad_lazy_load("glTexParameteriv");
+	if(proc == NULL) return;
+	glad_glTexParameteriv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXIMAGE1DPROC proc = (PFNGLTEXIMAGE1DPROC)glad_lazy_load("glTexImage1D");
+	if(proc == NULL) return;
+	glad_glTexImage1D = proc;
+	proc(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXIMAGE2DPROC proc = (PFNGLTEXIMAGE2DPROC)glad_lazy_load("glTexImage2D");
+	if(proc == NULL) return;
+	glad_glTexImage2D = proc;
+	proc(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+	PFNGLDRAWBUFFERPROC proc = (PFNGLDRAWBUFFERPROC)glad_lazy_load("glDrawBuffer");
+	if(proc == NULL) return;
+	glad_glDrawBuffer = proc;
+	proc(buf);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+	PFNGLCLEARPROC proc = (PFNGLCLEARPROC)glad_lazy_load("glClear");
+	if(proc == NULL) return;
+	glad_glClear = proc;
+	proc(mask);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	PFNGLCLEARCOLORPROC proc = (PFNGLCLEARCOLORPROC)glad_lazy_load("glClearColor");
+	if(proc == NULL) return;
+	glad_glClearColor = proc;
+	proc(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+	PFNGLCLEARSTENCILPROC proc = (PFNGLCLEARSTENCILPROC)glad_lazy_load("glClearStencil");
+	if(proc == NULL) return;
+	glad_glClearStencil = proc;
+	proc(s);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+	PFNGLCLEARDEPTHPROC proc = (PFNGLCLEARDEPTHPROC)glad_lazy_load("glClearDepth");
+	if(proc == NULL) return;
+	glad_glClearDepth = proc;
+	proc(depth);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+	PFNGLSTENCILMASKPROC proc = (PFNGLSTENCILMASKPROC)glad_lazy_load("glStencilMask");
+	if(proc == NULL) return;
+	glad_glStencilMask = proc;
+	proc(mask);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	PFNGLCOLORMASKPROC proc = (PFNGLCOLORMASKPROC)glad_lazy_load("glColorMask");
+	if(proc == NULL) return;
+	glad_glColorMask = proc;
+	proc(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+	PFNGLDEPTHMASKPROC proc = (PFNGLDEPTHMASKPROC)glad_lazy_load("glDepthMask");
+	if(proc == NULL) return;
+	glad_glDepthMask = proc;
+	proc(flag);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+	PFNGLDISABLEPROC proc = (PFNGLDISABLEPROC)glad_lazy_load("glDisable");
+	if(proc == NULL) return;
+	glad_glDisable = proc;
+	proc(cap);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+	PFNGLENABLEPROC proc = (PFNGLENABLEPROC)glad_lazy_load("glEnable");
+	if(proc == NULL) return;
+	glad_glEnable = proc;
+	proc(cap);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+	PFNGLFINISHPROC proc = (PFNGLFINISHPROC)glad_lazy_load("glFinish");
+	if(proc == NULL) return;
+	glad_glFinish = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+	PFNGLFLUSHPROC proc = (PFNGLFLUSHPROC)glad_lazy_load("glFlush");
+	if(proc == NULL) return;
+	glad_glFlush = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	PFNGLBLENDFUNCPROC proc = (PFNGLBLENDFUNCPROC)glad_lazy_load("glBlendFunc");
+	if(proc == NULL) return;
+	glad_glBlendFunc = proc;
+	proc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+	PFNGLLOGICOPPROC proc = (PFNGLLOGICOPPROC)glad_lazy_load("glLogicOp");
+	if(proc == NULL) return;
+	glad_glLogicOp = proc;
+	proc(opcode);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	PFNGLSTENCILFUNCPROC proc = (PFNGLSTENCILFUNCPROC)glad_lazy_load("glStencilFunc");
+	if(proc == NULL) return;
+	glad_glStencilFunc = proc;
+	proc(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	PFNGLSTENCILOPPROC proc = (PFNGLSTENCILOPPROC)glad_lazy_load("glStencilOp");
+	if(proc == NULL) return;
+	glad_glStencilOp = proc;
+	proc(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+	PFNGLDEPTHFUNCPROC proc = (PFNGLDEPTHFUNCPROC)glad_lazy_load("glDepthFunc");
+	if(proc == NULL) return;
+	glad_glDepthFunc = proc;
+	proc(func);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	PFNGLPIXELSTOREFPROC proc = (PFNGLPIXELSTOREFPROC)glad_lazy_load("glPixelStoref");
+	if(proc == NULL) return;
+	glad_glPixelStoref = proc;
+	proc(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+	PFNGLPIXELSTOREIPROC proc = (PFNGLPIXELSTOREIPROC)glad_lazy_load("glPixelStorei");
+	if(proc == NULL) return;
+	glad_glPixelStorei = proc;
+	proc(pname, param);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+	PFNGLREADBUFFERPROC proc = (PFNGLREADBUFFERPROC)glad_lazy_load("glReadBuffer");
+	if(proc == NULL) return;
+	glad_glReadBuffer = proc;
+	proc(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	PFNGLREADPIXELSPROC proc = (PFNGLREADPIXELSPROC)glad_lazy_load("glReadPixels");
+	if(proc == NULL) return;
+	glad_glReadPixels = proc;
+	proc(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	PFNGLGETBOOLEANVPROC proc = (PFNGLGETBOOLEANVPROC)glad_lazy_load("glGetBooleanv");
+	if(proc == NULL) return;
+	glad_glGetBooleanv = proc;
+	proc(pname, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	PFNGLGETDOUBLEVPROC proc = (PFNGLGETDOUBLEVPROC)glad_lazy_load("glGetDoublev");
+	if(proc == NULL) return;
+	glad_glGetDoublev = proc;
+	proc(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+	PFNGLGETERRORPROC proc = (PFNGLGETERRORPROC)glad_lazy_load("glGetError");
+	if(proc == NULL) return 0;
+	glad_glGetError = proc;
+	return proc();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	PFNGLGETFLOATVPROC proc = (PFNGLGETFLOATVPROC)glad_lazy_load("glGetFloatv");
+	if(proc == NULL) return;
+	glad_glGetFloatv = proc;
+	proc(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	PFNGLGETINTEGERVPROC proc = (PFNGLGETINTEGERVPROC)glad_lazy_load("glGetIntegerv");
+	if(proc == NULL) return;
+	glad_glGetIntegerv = proc;
+	proc(pname, data);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	PFNGLGETTEXIMAGEPROC proc = (PFNGLGETTEXIMAGEPROC)glad_lazy_load("glGetTexImage");
+	if(proc == NULL) return;
+	glad_glGetTexImage = proc;
+	proc(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	PFNGLGETTEXPARAMETERFVPROC proc = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_load("glGetTexParameterfv");
+	if(proc == NULL) return;
+	glad_glGetTexParameterfv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETTEXPARAMETERIVPROC proc = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_load("glGetTexParameteriv");
+	if(proc == NULL) return;
+	glad_glGetTexParameteriv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	PFNGLGETTEXLEVELPARAMETERFVPROC proc = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_load("glGetTexLevelParameterfv");
+	if(proc == NULL) return;
+	glad_glGetTexLevelParameterfv = proc;
+	proc(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	PFNGLGETTEXLEVELPARAMETERIVPROC proc = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_load("glGetTexLevelParameteriv");
+	if(proc == NULL) return;
+	glad_glGetTexLevelParameteriv = proc;
+	proc(target, level, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+	PFNGLISENABLEDPROC proc = (PFNGLISENABLEDPROC)glad_lazy_load("glIsEnabled");
+	if(proc == NULL) return 0;
+	glad_glIsEnabled = proc;
+	return proc(cap);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+	PFNGLDEPTHRANGEPROC proc = (PFNGLDEPTHRANGEPROC)glad_lazy_load("glDepthRange");
+	if(proc == NULL) return;
+	glad_glDepthRange = proc;
+	proc(n, f);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLVIEWPORTPROC proc = (PFNGLVIEWPORTPROC)glad_lazy_load("glViewport");
+	if(proc == NULL) return;
+	glad_glViewport = proc;
+	proc(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	PFNGLDRAWARRAYSPROC proc = (PFNGLDRAWARRAYSPROC)glad_lazy_load("glDrawArrays");
+	if(proc == NULL) return;
+	glad_glDrawArrays = proc;
+	proc(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	PFNGLDRAWELEMENTSPROC proc = (PFNGLDRAWELEMENTSPROC)glad_lazy_load("glDrawElements");
+	if(proc == NULL) return;
+	glad_glDrawElements = proc;
+	proc(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	PFNGLPOLYGONOFFSETPROC proc = (PFNGLPOLYGONOFFSETPROC)glad_lazy_load("glPolygonOffset");
+	if(proc == NULL) return;
+	glad_glPolygonOffset = proc;
+	proc(factor, units);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	PFNGLCOPYTEXIMAGE1DPROC proc = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_load("glCopyTexImage1D");
+	if(proc == NULL) return;
+	glad_glCopyTexImage1D = proc;
+	proc(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	PFNGLCOPYTEXIMAGE2DPROC proc = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_load("glCopyTexImage2D");
+	if(proc == NULL) return;
+	glad_glCopyTexImage2D = proc;
+	proc(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	PFNGLCOPYTEXSUBIMAGE1DPROC proc = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_load("glCopyTexSubImage1D");
+	if(proc == NULL) return;
+	glad_glCopyTexSubImage1D = proc;
+	proc(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLCOPYTEXSUBIMAGE2DPROC proc = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_load("glCopyTexSubImage2D");
+	if(proc == NULL) return;
+	glad_glCopyTexSubImage2D = proc;
+	proc(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXSUBIMAGE1DPROC proc = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_load("glTexSubImage1D");
+	if(proc == NULL) return;
+	glad_glTexSubImage1D = proc;
+	proc(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXSUBIMAGE2DPROC proc = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_load("glTexSubImage2D");
+	if(proc == NULL) return;
+	glad_glTexSubImage2D = proc;
+	proc(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+	PFNGLBINDTEXTUREPROC proc = (PFNGLBINDTEXTUREPROC)glad_lazy_load("glBindTexture");
+	if(proc == NULL) return;
+	glad_glBindTexture = proc;
+	proc(target, texture);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	PFNGLDELETETEXTURESPROC proc = (PFNGLDELETETEXTURESPROC)glad_lazy_load("glDeleteTextures");
+	if(proc == NULL) return;
+	glad_glDeleteTextures = proc;
+	proc(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	PFNGLGENTEXTURESPROC proc = (PFNGLGENTEXTURESPROC)glad_lazy_load("glGenTextures");
+	if(proc == NULL) return;
+	glad_glGenTextures = proc;
+	proc(n, textures);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+	PFNGLISTEXTUREPROC proc = (PFNGLISTEXTUREPROC)glad_lazy_load("glIsTexture");
+	if(proc == NULL) return 0;
+	glad_glIsTexture = proc;
+	return proc(texture);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	PFNGLDRAWRANGEELEMENTSPROC proc = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_load("glDrawRangeElements");
+	if(proc == NULL) return;
+	glad_glDrawRangeElements = proc;
+	proc(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXIMAGE3DPROC proc = (PFNGLTEXIMAGE3DPROC)glad_lazy_load("glTexImage3D");
+	if(proc == NULL) return;
+	glad_glTexImage3D = proc;
+	proc(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXSUBIMAGE3DPROC proc = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_load("glTexSubImage3D");
+	if(proc == NULL) return;
+	glad_glTexSubImage3D = proc;
+	proc(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLCOPYTEXSUBIMAGE3DPROC proc = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_load("glCopyTexSubImage3D");
+	if(proc == NULL) return;
+	glad_glCopyTexSubImage3D = proc;
+	proc(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+	PFNGLACTIVETEXTUREPROC proc = (PFNGLACTIVETEXTUREPROC)glad_lazy_load("glActiveTexture");
+	if(proc == NULL) return;
+	glad_glActiveTexture = proc;
+	proc(texture);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	PFNGLSAMPLECOVERAGEPROC proc = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_load("glSampleCoverage");
+	if(proc == NULL) return;
+	glad_glSampleCoverage = proc;
+	proc(value, invert);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXIMAGE3DPROC proc = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_load("glCompressedTexImage3D");
+	if(proc == NULL) return;
+	glad_glCompressedTexImage3D = proc;
+	proc(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXIMAGE2DPROC proc = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_load("glCompressedTexImage2D");
+	if(proc == NULL) return;
+	glad_glCompressedTexImage2D = proc;
+	proc(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXIMAGE1DPROC proc = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_load("glCompressedTexImage1D");
+	if(proc == NULL) return;
+	glad_glCompressedTexImage1D = proc;
+	proc(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC proc = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_load("glCompressedTexSubImage3D");
+	if(proc == NULL) return;
+	glad_glCompressedTexSubImage3D = proc;
+	proc(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC proc = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_load("glCompressedTexSubImage2D");
+	if(proc == NULL) return;
+	glad_glCompressedTexSubImage2D = proc;
+	proc(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC proc = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_load("glCompressedTexSubImage1D");
+	if(proc == NULL) return;
+	glad_glCompressedTexSubImage1D = proc;
+	proc(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	PFNGLGETCOMPRESSEDTEXIMAGEPROC proc = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_load("glGetCompressedTexImage");
+	if(proc == NULL) return;
+	glad_glGetCompressedTexImage = proc;
+	proc(target, level, img);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	PFNGLBLENDFUNCSEPARATEPROC proc = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_load("glBlendFuncSeparate");
+	if(proc == NULL) return;
+	glad_glBlendFuncSeparate = proc;
+	proc(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	PFNGLMULTIDRAWARRAYSPROC proc = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_load("glMultiDrawArrays");
+	if(proc == NULL) return;
+	glad_glMultiDrawArrays = proc;
+	proc(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	PFNGLMULTIDRAWELEMENTSPROC proc = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_load("glMultiDrawElements");
+	if(proc == NULL) return;
+	glad_glMultiDrawElements = proc;
+	proc(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	PFNGLPOINTPARAMETERFPROC proc = (PFNGLPOINTPARAMETERFPROC)glad_lazy_load("glPointParameterf");
+	if(proc == NULL) return;
+	glad_glPointParameterf = proc;
+	proc(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	PFNGLPOINTPARAMETERFVPROC proc = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_load("glPointParameterfv");
+	if(proc == NULL) return;
+	glad_glPointParameterfv = proc;
+	proc(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+	PFNGLPOINTPARAMETERIPROC proc = (PFNGLPOINTPARAMETERIPROC)glad_lazy_load("glPointParameteri");
+	if(proc == NULL) return;
+	glad_glPointParameteri = proc;
+	proc(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	PFNGLPOINTPARAMETERIVPROC proc = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_load("glPointParameteriv");
+	if(proc == NULL) return;
+	glad_glPointParameteriv = proc;
+	proc(pname, params);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	PFNGLBLENDCOLORPROC proc = (PFNGLBLENDCOLORPROC)glad_lazy_load("glBlendColor");
+	if(proc == NULL) return;
+	glad_glBlendColor = proc;
+	proc(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+	PFNGLBLENDEQUATIONPROC proc = (PFNGLBLENDEQUATIONPROC)glad_lazy_load("glBlendEquation");
+	if(proc == NULL) return;
+	glad_glBlendEquation = proc;
+	proc(mode);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	PFNGLGENQUERIESPROC proc = (PFNGLGENQUERIESPROC)glad_lazy_load("glGenQueries");
+	if(proc == NULL) return;
+	glad_glGenQueries = proc;
+	proc(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	PFNGLDELETEQUERIESPROC proc = (PFNGLDELETEQUERIESPROC)glad_lazy_load("glDeleteQueries");
+	if(proc == NULL) return;
+	glad_glDeleteQueries = proc;
+	proc(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+	PFNGLISQUERYPROC proc = (PFNGLISQUERYPROC)glad_lazy_load("glIsQuery");
+	if(proc == NULL) return 0;
+	glad_glIsQuery = proc;
+	return proc(id);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+	PFNGLBEGINQUERYPROC proc = (PFNGLBEGINQUERYPROC)glad_lazy_load("glBeginQuery");
+	if(proc == NULL) return;
+	glad_glBeginQuery = proc;
+	proc(target, id);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+	PFNGLENDQUERYPROC proc = (PFNGLENDQUERYPROC)glad_lazy_load("glEndQuery");
+	if(proc == NULL) return;
+	glad_glEndQuery = proc;
+	proc(target);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETQUERYIVPROC proc = (PFNGLGETQUERYIVPROC)glad_lazy_load("glGetQueryiv");
+	if(proc == NULL) return;
+	glad_glGetQueryiv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	PFNGLGETQUERYOBJECTIVPROC proc = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_load("glGetQueryObjectiv");
+	if(proc == NULL) return;
+	glad_glGetQueryObjectiv = proc;
+	proc(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	PFNGLGETQUERYOBJECTUIVPROC proc = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_load("glGetQueryObjectuiv");
+	if(proc == NULL) return;
+	glad_glGetQueryObjectuiv = proc;
+	proc(id, pname, params);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	PFNGLBINDBUFFERPROC proc = (PFNGLBINDBUFFERPROC)glad_lazy_load("glBindBuffer");
+	if(proc == NULL) return;
+	glad_glBindBuffer = proc;
+	proc(target, buffer);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	PFNGLDELETEBUFFERSPROC proc = (PFNGLDELETEBUFFERSPROC)glad_lazy_load("glDeleteBuffers");
+	if(proc == NULL) return;
+	glad_glDeleteBuffers = proc;
+	proc(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	PFNGLGENBUFFERSPROC proc = (PFNGLGENBUFFERSPROC)glad_lazy_load("glGenBuffers");
+	if(proc == NULL) return;
+	glad_glGenBuffers = proc;
+	proc(n, buffers);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+	PFNGLISBUFFERPROC proc = (PFNGLISBUFFERPROC)glad_lazy_load("glIsBuffer");
+	if(proc == NULL) return 0;
+	glad_glIsBuffer = proc;
+	return proc(buffer);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	PFNGLBUFFERDATAPROC proc = (PFNGLBUFFERDATAPROC)glad_lazy_load("glBufferData");
+	if(proc == NULL) return;
+	glad_glBufferData = proc;
+	proc(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	PFNGLBUFFERSUBDATAPROC proc = (PFNGLBUFFERSUBDATAPROC)glad_lazy_load("glBufferSubData");
+	if(proc == NULL) return;
+	glad_glBufferSubData = proc;
+	proc(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	PFNGLGETBUFFERSUBDATAPROC proc = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_load("glGetBufferSubData");
+	if(proc == NULL) return;
+	glad_glGetBufferSubData = proc;
+	proc(target, offset, size, data);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+	PFNGLMAPBUFFERPROC proc = (PFNGLMAPBUFFERPROC)glad_lazy_load("glMapBuffer");
+	if(proc == NULL) return 0;
+	glad_glMapBuffer = proc;
+	return proc(target, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+	PFNGLUNMAPBUFFERPROC proc = (PFNGLUNMAPBUFFERPROC)glad_lazy_load("glUnmapBuffer");
+	if(proc == NULL) return 0;
+	glad_glUnmapBuffer = proc;
+	return proc(target);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETBUFFERPARAMETERIVPROC proc = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_load("glGetBufferParameteriv");
+	if(proc == NULL) return;
+	glad_glGetBufferParameteriv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	PFNGLGETBUFFERPOINTERVPROC proc = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_load("glGetBufferPointerv");
+	if(proc == NULL) return;
+	glad_glGetBufferPointerv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	PFNGLBLENDEQUATIONSEPARATEPROC proc = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_load("glBlendEquationSeparate");
+	if(proc == NULL) return;
+	glad_glBlendEquationSeparate = proc;
+	proc(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	PFNGLDRAWBUFFERSPROC proc = (PFNGLDRAWBUFFERSPROC)glad_lazy_load("glDrawBuffers");
+	if(proc == NULL) return;
+	glad_glDrawBuffers = proc;
+	proc(n, bufs);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	PFNGLSTENCILOPSEPARATEPROC proc = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_load("glStencilOpSeparate");
+	if(proc == NULL) return;
+	glad_glStencilOpSeparate = proc;
+	proc(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	PFNGLSTENCILFUNCSEPARATEPROC proc = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_load("glStencilFuncSeparate");
+	if(proc == NULL) return;
+	glad_glStencilFuncSeparate = proc;
+	proc(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	PFNGLSTENCILMASKSEPARATEPROC proc = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_load("glStencilMaskSeparate");
+	if(proc == NULL) return;
+	glad_glStencilMaskSeparate = proc;
+	proc(face, mask);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+	PFNGLATTACHSHADERPROC proc = (PFNGLATTACHSHADERPROC)glad_lazy_load("glAttachShader");
+	if(proc == NULL) return;
+	glad_glAttachShader = proc;
+	proc(program, shader);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	PFNGLBINDATTRIBLOCATIONPROC proc = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_load("glBindAttribLocation");
+	if(proc == NULL) return;
+	glad_glBindAttribLocation = proc;
+	proc(program, index, name);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+	PFNGLCOMPILESHADERPROC proc = (PFNGLCOMPILESHADERPROC)glad_lazy_load("glCompileShader");
+	if(proc == NULL) return;
+	glad_glCompileShader = proc;
+	proc(shader);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+	PFNGLCREATEPROGRAMPROC proc = (PFNGLCREATEPROGRAMPROC)glad_lazy_load("glCreateProgram");
+	if(proc == NULL) return 0;
+	glad_glCreateProgram = proc;
+	return proc();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+	PFNGLCREATESHADERPROC proc = (PFNGLCREATESHADERPROC)glad_lazy_load("glCreateShader");
+	if(proc == NULL) return 0;
+	glad_glCreateShader = proc;
+	return proc(type);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+	PFNGLDELETEPROGRAMPROC proc = (PFNGLDELETEPROGRAMPROC)glad_lazy_load("glDeleteProgram");
+	if(proc == NULL) return;
+	glad_glDeleteProgram = proc;
+	proc(program);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+	PFNGLDELETESHADERPROC proc = (PFNGLDELETESHADERPROC)glad_lazy_load("glDeleteShader");
+	if(proc == NULL) return;
+	glad_glDeleteShader = proc;
+	proc(shader);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+	PFNGLDETACHSHADERPROC proc = (PFNGLDETACHSHADERPROC)glad_lazy_load("glDetachShader");
+	if(proc == NULL) return;
+	glad_glDetachShader = proc;
+	proc(program, shader);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+	PFNGLDISABLEVERTEXATTRIBARRAYPROC proc = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_load("glDisableVertexAttribArray");
+	if(proc == NULL) return;
+	glad_glDisableVertexAttribArray = proc;
+	proc(index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+	PFNGLENABLEVERTEXATTRIBARRAYPROC proc = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_load("glEnableVertexAttribArray");
+	if(proc == NULL) return;
+	glad_glEnableVertexAttribArray = proc;
+	proc(index);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	PFNGLGETACTIVEATTRIBPROC proc = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_load("glGetActiveAttrib");
+	if(proc == NULL) return;
+	glad_glGetActiveAttrib = proc;
+	proc(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	PFNGLGETACTIVEUNIFORMPROC proc = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_load("glGetActiveUniform");
+	if(proc == NULL) return;
+	glad_glGetActiveUniform = proc;
+	proc(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	PFNGLGETATTACHEDSHADERSPROC proc = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_load("glGetAttachedShaders");
+	if(proc == NULL) return;
+	glad_glGetAttachedShaders = proc;
+	proc(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	PFNGLGETATTRIBLOCATIONPROC proc = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_load("glGetAttribLocation");
+	if(proc == NULL) return 0;
+	glad_glGetAttribLocation = proc;
+	return proc(program, name);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	PFNGLGETPROGRAMIVPROC proc = (PFNGLGETPROGRAMIVPROC)glad_lazy_load("glGetProgramiv");
+	if(proc == NULL) return;
+	glad_glGetProgramiv = proc;
+	proc(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	PFNGLGETPROGRAMINFOLOGPROC proc = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_load("glGetProgramInfoLog");
+	if(proc == NULL) return;
+	glad_glGetProgramInfoLog = proc;
+	proc(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	PFNGLGETSHADERIVPROC proc = (PFNGLGETSHADERIVPROC)glad_lazy_load("glGetShaderiv");
+	if(proc == NULL) return;
+	glad_glGetShaderiv = proc;
+	proc(shader, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	PFNGLGETSHADERINFOLOGPROC proc = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_load("glGetShaderInfoLog");
+	if(proc == NULL) return;
+	glad_glGetShaderInfoLog = proc;
+	proc(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	PFNGLGETSHADERSOURCEPROC proc = (PFNGLGETSHADERSOURCEPROC)glad_lazy_load("glGetShaderSource");
+	if(proc == NULL) return;
+	glad_glGetShaderSource = proc;
+	proc(shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	PFNGLGETUNIFORMLOCATIONPROC proc = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_load("glGetUniformLocation");
+	if(proc == NULL) return 0;
+	glad_glGetUniformLocation = proc;
+	return proc(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	PFNGLGETUNIFORMFVPROC proc = (PFNGLGETUNIFORMFVPROC)glad_lazy_load("glGetUniformfv");
+	if(proc == NULL) return;
+	glad_glGetUniformfv = proc;
+	proc(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	PFNGLGETUNIFORMIVPROC proc = (PFNGLGETUNIFORMIVPROC)glad_lazy_load("glGetUniformiv");
+	if(proc == NULL) return;
+	glad_glGetUniformiv = proc;
+	proc(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	PFNGLGETVERTEXATTRIBDVPROC proc = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_load("glGetVertexAttribdv");
+	if(proc == NULL) return;
+	glad_glGetVertexAttribdv = proc;
+	proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	PFNGLGETVERTEXATTRIBFVPROC proc = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_load("glGetVertexAttribfv");
+	if(proc == NULL) return;
+	glad_glGetVertexAttribfv = proc;
+	proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	PFNGLGETVERTEXATTRIBIVPROC proc = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_load("glGetVertexAttribiv");
+	if(proc == NULL) return;
+	glad_glGetVertexAttribiv = proc;
+	proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	PFNGLGETVERTEXATTRIBPOINTERVPROC proc = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_load("glGetVertexAttribPointerv");
+	if(proc == NULL) return;
+	glad_glGetVertexAttribPointerv = proc;
+	proc(index, pname, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+	PFNGLISPROGRAMPROC proc = (PFNGLISPROGRAMPROC)glad_lazy_load("glIsProgram");
+	if(proc == NULL) return 0;
+	glad_glIsProgram = proc;
+	return proc(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+	PFNGLISSHADERPROC proc = (PFNGLISSHADERPROC)glad_lazy_load("glIsShader");
+	if(proc == NULL) return 0;
+	glad_glIsShader = proc;
+	return proc(shader);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+	PFNGLLINKPROGRAMPROC proc = (PFNGLLINKPROGRAMPROC)glad_lazy_load("glLinkProgram");
+	if(proc == NULL) return;
+	glad_glLinkProgram = proc;
+	proc(program);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	PFNGLSHADERSOURCEPROC proc = (PFNGLSHADERSOURCEPROC)glad_lazy_load("glShaderSource");
+	if(proc == NULL) return;
+	glad_glShaderSource = proc;
+	proc(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+	PFNGLUSEPROGRAMPROC proc = (PFNGLUSEPROGRAMPROC)glad_lazy_load("glUseProgram");
+	if(proc == NULL) return;
+	glad_glUseProgram = proc;
+	proc(program);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+	PFNGLUNIFORM1FPROC proc = (PFNGLUNIFORM1FPROC)glad_lazy_load("glUniform1f");
+	if(proc == NULL) return;
+	glad_glUniform1f = proc;
+	proc(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	PFNGLUNIFORM2FPROC proc = (PFNGLUNIFORM2FPROC)glad_lazy_load("glUniform2f");
+	if(proc == NULL) return;
+	glad_glUniform2f = proc;
+	proc(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	PFNGLUNIFORM3FPROC proc = (PFNGLUNIFORM3FPROC)glad_lazy_load("glUniform3f");
+	if(proc == NULL) return;
+	glad_glUniform3f = proc;
+	proc(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	PFNGLUNIFORM4FPROC proc = (PFNGLUNIFORM4FPROC)glad_lazy_load("glUniform4f");
+	if(proc == NULL) return;
+	glad_glUniform4f = proc;
+	proc(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+	PFNGLUNIFORM1IPROC proc = (PFNGLUNIFORM1IPROC)glad_lazy_load("glUniform1i");
+	if(proc == NULL) return;
+	glad_glUniform1i = proc;
+	proc(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	PFNGLUNIFORM2IPROC proc = (PFNGLUNIFORM2IPROC)glad_lazy_load("glUniform2i");
+	if(proc == NULL) return;
+	glad_glUniform2i = proc;
+	proc(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	PFNGLUNIFORM3IPROC proc = (PFNGLUNIFORM3IPROC)glad_lazy_load("glUniform3i");
+	if(proc == NULL) return;
+	glad_glUniform3i = proc;
+	proc(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	PFNGLUNIFORM4IPROC proc = (PFNGLUNIFORM4IPROC)glad_lazy_load("glUniform4i");
+	if(proc == NULL) return;
+	glad_glUniform4i = proc;
+	proc(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLUNIFORM1FVPROC proc = (PFNGLUNIFORM1FVPROC)glad_lazy_load("glUniform1fv");
+	if(proc == NULL) return;
+	glad_glUniform1fv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLUNIFORM2FVPROC proc = (PFNGLUNIFORM2FVPROC)glad_lazy_load("glUniform2fv");
+	if(proc == NULL) return;
+	glad_glUniform2fv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLUNIFORM3FVPROC proc = (PFNGLUNIFORM3FVPROC)glad_lazy_load("glUniform3fv");
+	if(proc == NULL) return;
+	glad_glUniform3fv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLUNIFORM4FVPROC proc = (PFNGLUNIFORM4FVPROC)glad_lazy_load("glUniform4fv");
+	if(proc == NULL) return;
+	glad_glUniform4fv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	PFNGLUNIFORM1IVPROC proc = (PFNGLUNIFORM1IVPROC)glad_lazy_load("glUniform1iv");
+	if(proc == NULL) return;
+	glad_glUniform1iv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	PFNGLUNIFORM2IVPROC proc = (PFNGLUNIFORM2IVPROC)glad_lazy_load("glUniform2iv");
+	if(proc == NULL) return;
+	glad_glUniform2iv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	PFNGLUNIFORM3IVPROC proc = (PFNGLUNIFORM3IVPROC)glad_lazy_load("glUniform3iv");
+	if(proc == NULL) return;
+	glad_glUniform3iv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	PFNGLUNIFORM4IVPROC proc = (PFNGLUNIFORM4IVPROC)glad_lazy_load("glUniform4iv");
+	if(proc == NULL) return;
+	glad_glUniform4iv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX2FVPROC proc = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_load("glUniformMatrix2fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix2fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX3FVPROC proc = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_load("glUniformMatrix3fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix3fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX4FVPROC proc = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_load("glUniformMatrix4fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix4fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+	PFNGLVALIDATEPROGRAMPROC proc = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_load("glValidateProgram");
+	if(proc == NULL) return;
+	glad_glValidateProgram = proc;
+	proc(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	PFNGLVERTEXATTRIB1DPROC proc = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_load("glVertexAttrib1d");
+	if(proc == NULL) return;
+	glad_glVertexAttrib1d = proc;
+	proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIB1DVPROC proc = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_load("glVertexAttrib1dv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib1dv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	PFNGLVERTEXATTRIB1FPROC proc = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_load("glVertexAttrib1f");
+	if(proc == NULL) return;
+	glad_glVertexAttrib1f = proc;
+	proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	PFNGLVERTEXATTRIB1FVPROC proc = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_load("glVertexAttrib1fv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib1fv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	PFNGLVERTEXATTRIB1SPROC proc = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_load("glVertexAttrib1s");
+	if(proc == NULL) return;
+	glad_glVertexAttrib1s = proc;
+	proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB1SVPROC proc = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_load("glVertexAttrib1sv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib1sv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	PFNGLVERTEXATTRIB2DPROC proc = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_load("glVertexAttrib2d");
+	if(proc == NULL) return;
+	glad_glVertexAttrib2d = proc;
+	proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIB2DVPROC proc = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_load("glVertexAttrib2dv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib2dv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	PFNGLVERTEXATTRIB2FPROC proc = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_load("glVertexAttrib2f");
+	if(proc == NULL) return;
+	glad_glVertexAttrib2f = proc;
+	proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	PFNGLVERTEXATTRIB2FVPROC proc = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_load("glVertexAttrib2fv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib2fv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	PFNGLVERTEXATTRIB2SPROC proc = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_load("glVertexAttrib2s");
+	if(proc == NULL) return;
+	glad_glVertexAttrib2s = proc;
+	proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB2SVPROC proc = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_load("glVertexAttrib2sv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib2sv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	PFNGLVERTEXATTRIB3DPROC proc = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_load("glVertexAttrib3d");
+	if(proc == NULL) return;
+	glad_glVertexAttrib3d = proc;
+	proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIB3DVPROC proc = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_load("glVertexAttrib3dv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib3dv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	PFNGLVERTEXATTRIB3FPROC proc = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_load("glVertexAttrib3f");
+	if(proc == NULL) return;
+	glad_glVertexAttrib3f = proc;
+	proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	PFNGLVERTEXATTRIB3FVPROC proc = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_load("glVertexAttrib3fv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib3fv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	PFNGLVERTEXATTRIB3SPROC proc = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_load("glVertexAttrib3s");
+	if(proc == NULL) return;
+	glad_glVertexAttrib3s = proc;
+	proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB3SVPROC proc = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_load("glVertexAttrib3sv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib3sv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	PFNGLVERTEXATTRIB4NBVPROC proc = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_load("glVertexAttrib4Nbv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4Nbv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIB4NIVPROC proc = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_load("glVertexAttrib4Niv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4Niv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB4NSVPROC proc = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_load("glVertexAttrib4Nsv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4Nsv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	PFNGLVERTEXATTRIB4NUBPROC proc = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_load("glVertexAttrib4Nub");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4Nub = proc;
+	proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	PFNGLVERTEXATTRIB4NUBVPROC proc = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_load("glVertexAttrib4Nubv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4Nubv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIB4NUIVPROC proc = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_load("glVertexAttrib4Nuiv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4Nuiv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	PFNGLVERTEXATTRIB4NUSVPROC proc = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_load("glVertexAttrib4Nusv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4Nusv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	PFNGLVERTEXATTRIB4BVPROC proc = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_load("glVertexAttrib4bv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4bv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	PFNGLVERTEXATTRIB4DPROC proc = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_load("glVertexAttrib4d");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4d = proc;
+	proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIB4DVPROC proc = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_load("glVertexAttrib4dv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4dv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	PFNGLVERTEXATTRIB4FPROC proc = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_load("glVertexAttrib4f");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4f = proc;
+	proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	PFNGLVERTEXATTRIB4FVPROC proc = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_load("glVertexAttrib4fv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4fv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIB4IVPROC proc = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_load("glVertexAttrib4iv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4iv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	PFNGLVERTEXATTRIB4SPROC proc = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_load("glVertexAttrib4s");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4s = proc;
+	proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIB4SVPROC proc = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_load("glVertexAttrib4sv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4sv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	PFNGLVERTEXATTRIB4UBVPROC proc = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_load("glVertexAttrib4ubv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4ubv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIB4UIVPROC proc = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_load("glVertexAttrib4uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4uiv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	PFNGLVERTEXATTRIB4USVPROC proc = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_load("glVertexAttrib4usv");
+	if(proc == NULL) return;
+	glad_glVertexAttrib4usv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	PFNGLVERTEXATTRIBPOINTERPROC proc = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_load("glVertexAttribPointer");
+	if(proc == NULL) return;
+	glad_glVertexAttribPointer = proc;
+	proc(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX2X3FVPROC proc = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_load("glUniformMatrix2x3fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix2x3fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX3X2FVPROC proc = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_load("glUniformMatrix3x2fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix3x2fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX2X4FVPROC proc = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_load("glUniformMatrix2x4fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix2x4fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX4X2FVPROC proc = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_load("glUniformMatrix4x2fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix4x2fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX3X4FVPROC proc = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_load("glUniformMatrix3x4fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix3x4fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLUNIFORMMATRIX4X3FVPROC proc = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_load("glUniformMatrix4x3fv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix4x3fv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	PFNGLCOLORMASKIPROC proc = (PFNGLCOLORMASKIPROC)glad_lazy_load("glColorMaski");
+	if(proc == NULL) return;
+	glad_glColorMaski = proc;
+	proc(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	PFNGLGETBOOLEANI_VPROC proc = (PFNGLGETBOOLEANI_VPROC)glad_lazy_load("glGetBooleani_v");
+	if(proc == NULL) return;
+	glad_glGetBooleani_v = proc;
+	proc(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	PFNGLGETINTEGERI_VPROC proc = (PFNGLGETINTEGERI_VPROC)glad_lazy_load("glGetIntegeri_v");
+	if(proc == NULL) return;
+	glad_glGetIntegeri_v = proc;
+	proc(target, index, data);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+	PFNGLENABLEIPROC proc = (PFNGLENABLEIPROC)glad_lazy_load("glEnablei");
+	if(proc == NULL) return;
+	glad_glEnablei = proc;
+	proc(target, index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+	PFNGLDISABLEIPROC proc = (PFNGLDISABLEIPROC)glad_lazy_load("glDisablei");
+	if(proc == NULL) return;
+	glad_glDisablei = proc;
+	proc(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+	PFNGLISENABLEDIPROC proc = (PFNGLISENABLEDIPROC)glad_lazy_load("glIsEnabledi");
+	if(proc == NULL) return 0;
+	glad_glIsEnabledi = proc;
+	return proc(target, index);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	PFNGLBEGINTRANSFORMFEEDBACKPROC proc = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_load("glBeginTransformFeedback");
+	if(proc == NULL) return;
+	glad_glBeginTransformFeedback = proc;
+	proc(primitiveMode);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+	PFNGLENDTRANSFORMFEEDBACKPROC proc = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_load("glEndTransformFeedback");
+	if(proc == NULL) return;
+	glad_glEndTransformFeedback = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	PFNGLBINDBUFFERRANGEPROC proc = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_load("glBindBufferRange");
+	if(proc == NULL) return;
+	glad_glBindBufferRange = proc;
+	proc(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	PFNGLBINDBUFFERBASEPROC proc = (PFNGLBINDBUFFERBASEPROC)glad_lazy_load("glBindBufferBase");
+	if(proc == NULL) return;
+	glad_glBindBufferBase = proc;
+	proc(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	PFNGLTRANSFORMFEEDBACKVARYINGSPROC proc = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_load("glTransformFeedbackVaryings");
+	if(proc == NULL) return;
+	glad_glTransformFeedbackVaryings = proc;
+	proc(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	PFNGLGETTRANSFORMFEEDBACKVARYINGPROC proc = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_load("glGetTransformFeedbackVarying");
+	if(proc == NULL) return;
+	glad_glGetTransformFeedbackVarying = proc;
+	proc(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+	PFNGLCLAMPCOLORPROC proc = (PFNGLCLAMPCOLORPROC)glad_lazy_load("glClampColor");
+	if(proc == NULL) return;
+	glad_glClampColor = proc;
+	proc(target, clamp);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	PFNGLBEGINCONDITIONALRENDERPROC proc = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_load("glBeginConditionalRender");
+	if(proc == NULL) return;
+	glad_glBeginConditionalRender = proc;
+	proc(id, mode);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+	PFNGLENDCONDITIONALRENDERPROC proc = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_load("glEndConditionalRender");
+	if(proc == NULL) return;
+	glad_glEndConditionalRender = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	PFNGLVERTEXATTRIBIPOINTERPROC proc = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_load("glVertexAttribIPointer");
+	if(proc == NULL) return;
+	glad_glVertexAttribIPointer = proc;
+	proc(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	PFNGLGETVERTEXATTRIBIIVPROC proc = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_load("glGetVertexAttribIiv");
+	if(proc == NULL) return;
+	glad_glGetVertexAttribIiv = proc;
+	proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	PFNGLGETVERTEXATTRIBIUIVPROC proc = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_load("glGetVertexAttribIuiv");
+	if(proc == NULL) return;
+	glad_glGetVertexAttribIuiv = proc;
+	proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	PFNGLVERTEXATTRIBI1IPROC proc = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_load("glVertexAttribI1i");
+	if(proc == NULL) return;
+	glad_glVertexAttribI1i = proc;
+	proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	PFNGLVERTEXATTRIBI2IPROC proc = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_load("glVertexAttribI2i");
+	if(proc == NULL) return;
+	glad_glVertexAttribI2i = proc;
+	proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	PFNGLVERTEXATTRIBI3IPROC proc = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_load("glVertexAttribI3i");
+	if(proc == NULL) return;
+	glad_glVertexAttribI3i = proc;
+	proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	PFNGLVERTEXATTRIBI4IPROC proc = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_load("glVertexAttribI4i");
+	if(proc == NULL) return;
+	glad_glVertexAttribI4i = proc;
+	proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	PFNGLVERTEXATTRIBI1UIPROC proc = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_load("glVertexAttribI1ui");
+	if(proc == NULL) return;
+	glad_glVertexAttribI1ui = proc;
+	proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	PFNGLVERTEXATTRIBI2UIPROC proc = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_load("glVertexAttribI2ui");
+	if(proc == NULL) return;
+	glad_glVertexAttribI2ui = proc;
+	proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	PFNGLVERTEXATTRIBI3UIPROC proc = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_load("glVertexAttribI3ui");
+	if(proc == NULL) return;
+	glad_glVertexAttribI3ui = proc;
+	proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	PFNGLVERTEXATTRIBI4UIPROC proc = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_load("glVertexAttribI4ui");
+	if(proc == NULL) return;
+	glad_glVertexAttribI4ui = proc;
+	proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIBI1IVPROC proc = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_load("glVertexAttribI1iv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI1iv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIBI2IVPROC proc = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_load("glVertexAttribI2iv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI2iv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIBI3IVPROC proc = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_load("glVertexAttribI3iv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI3iv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	PFNGLVERTEXATTRIBI4IVPROC proc = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_load("glVertexAttribI4iv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI4iv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIBI1UIVPROC proc = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_load("glVertexAttribI1uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI1uiv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIBI2UIVPROC proc = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_load("glVertexAttribI2uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI2uiv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIBI3UIVPROC proc = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_load("glVertexAttribI3uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI3uiv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	PFNGLVERTEXATTRIBI4UIVPROC proc = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_load("glVertexAttribI4uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI4uiv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	PFNGLVERTEXATTRIBI4BVPROC proc = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_load("glVertexAttribI4bv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI4bv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	PFNGLVERTEXATTRIBI4SVPROC proc = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_load("glVertexAttribI4sv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI4sv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	PFNGLVERTEXATTRIBI4UBVPROC proc = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_load("glVertexAttribI4ubv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI4ubv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	PFNGLVERTEXATTRIBI4USVPROC proc = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_load("glVertexAttribI4usv");
+	if(proc == NULL) return;
+	glad_glVertexAttribI4usv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	PFNGLGETUNIFORMUIVPROC proc = (PFNGLGETUNIFORMUIVPROC)glad_lazy_load("glGetUniformuiv");
+	if(proc == NULL) return;
+	glad_glGetUniformuiv = proc;
+	proc(program, location, params);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	PFNGLBINDFRAGDATALOCATIONPROC proc = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_load("glBindFragDataLocation");
+	if(proc == NULL) return;
+	glad_glBindFragDataLocation = proc;
+	proc(program, color, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	PFNGLGETFRAGDATALOCATIONPROC proc = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_load("glGetFragDataLocation");
+	if(proc == NULL) return 0;
+	glad_glGetFragDataLocation = proc;
+	return proc(program, name);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+	PFNGLUNIFORM1UIPROC proc = (PFNGLUNIFORM1UIPROC)glad_lazy_load("glUniform1ui");
+	if(proc == NULL) return;
+	glad_glUniform1ui = proc;
+	proc(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	PFNGLUNIFORM2UIPROC proc = (PFNGLUNIFORM2UIPROC)glad_lazy_load("glUniform2ui");
+	if(proc == NULL) return;
+	glad_glUniform2ui = proc;
+	proc(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	PFNGLUNIFORM3UIPROC proc = (PFNGLUNIFORM3UIPROC)glad_lazy_load("glUniform3ui");
+	if(proc == NULL) return;
+	glad_glUniform3ui = proc;
+	proc(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	PFNGLUNIFORM4UIPROC proc = (PFNGLUNIFORM4UIPROC)glad_lazy_load("glUniform4ui");
+	if(proc == NULL) return;
+	glad_glUniform4ui = proc;
+	proc(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	PFNGLUNIFORM1UIVPROC proc = (PFNGLUNIFORM1UIVPROC)glad_lazy_load("glUniform1uiv");
+	if(proc == NULL) return;
+	glad_glUniform1uiv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	PFNGLUNIFORM2UIVPROC proc = (PFNGLUNIFORM2UIVPROC)glad_lazy_load("glUniform2uiv");
+	if(proc == NULL) return;
+	glad_glUniform2uiv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	PFNGLUNIFORM3UIVPROC proc = (PFNGLUNIFORM3UIVPROC)glad_lazy_load("glUniform3uiv");
+	if(proc == NULL) return;
+	glad_glUniform3uiv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	PFNGLUNIFORM4UIVPROC proc = (PFNGLUNIFORM4UIVPROC)glad_lazy_load("glUniform4uiv");
+	if(proc == NULL) return;
+	glad_glUniform4uiv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	PFNGLTEXPARAMETERIIVPROC proc = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_load("glTexParameterIiv");
+	if(proc == NULL) return;
+	glad_glTexParameterIiv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	PFNGLTEXPARAMETERIUIVPROC proc = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_load("glTexParameterIuiv");
+	if(proc == NULL) return;
+	glad_glTexParameterIuiv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETTEXPARAMETERIIVPROC proc = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_load("glGetTexParameterIiv");
+	if(proc == NULL) return;
+	glad_glGetTexParameterIiv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	PFNGLGETTEXPARAMETERIUIVPROC proc = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_load("glGetTexParameterIuiv");
+	if(proc == NULL) return;
+	glad_glGetTexParameterIuiv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	PFNGLCLEARBUFFERIVPROC proc = (PFNGLCLEARBUFFERIVPROC)glad_lazy_load("glClearBufferiv");
+	if(proc == NULL) return;
+	glad_glClearBufferiv = proc;
+	proc(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	PFNGLCLEARBUFFERUIVPROC proc = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_load("glClearBufferuiv");
+	if(proc == NULL) return;
+	glad_glClearBufferuiv = proc;
+	proc(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	PFNGLCLEARBUFFERFVPROC proc = (PFNGLCLEARBUFFERFVPROC)glad_lazy_load("glClearBufferfv");
+	if(proc == NULL) return;
+	glad_glClearBufferfv = proc;
+	proc(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	PFNGLCLEARBUFFERFIPROC proc = (PFNGLCLEARBUFFERFIPROC)glad_lazy_load("glClearBufferfi");
+	if(proc == NULL) return;
+	glad_glClearBufferfi = proc;
+	proc(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+	PFNGLGETSTRINGIPROC proc = (PFNGLGETSTRINGIPROC)glad_lazy_load("glGetStringi");
+	if(proc == NULL) return 0;
+	glad_glGetStringi = proc;
+	return proc(name, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	PFNGLISRENDERBUFFERPROC proc = (PFNGLISRENDERBUFFERPROC)glad_lazy_load("glIsRenderbuffer");
+	if(proc == NULL) return 0;
+	glad_glIsRenderbuffer = proc;
+	return proc(renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	PFNGLBINDRENDERBUFFERPROC proc = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_load("glBindRenderbuffer");
+	if(proc == NULL) return;
+	glad_glBindRenderbuffer = proc;
+	proc(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	PFNGLDELETERENDERBUFFERSPROC proc = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_load("glDeleteRenderbuffers");
+	if(proc == NULL) return;
+	glad_glDeleteRenderbuffers = proc;
+	proc(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	PFNGLGENRENDERBUFFERSPROC proc = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_load("glGenRenderbuffers");
+	if(proc == NULL) return;
+	glad_glGenRenderbuffers = proc;
+	proc(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLRENDERBUFFERSTORAGEPROC proc = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_load("glRenderbufferStorage");
+	if(proc == NULL) return;
+	glad_glRenderbufferStorage = proc;
+	proc(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETRENDERBUFFERPARAMETERIVPROC proc = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_load("glGetRenderbufferParameteriv");
+	if(proc == NULL) return;
+	glad_glGetRenderbufferParameteriv = proc;
+	proc(target, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+	PFNGLISFRAMEBUFFERPROC proc = (PFNGLISFRAMEBUFFERPROC)glad_lazy_load("glIsFramebuffer");
+	if(proc == NULL) return 0;
+	glad_glIsFramebuffer = proc;
+	return proc(framebuffer);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	PFNGLBINDFRAMEBUFFERPROC proc = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_load("glBindFramebuffer");
+	if(proc == NULL) return;
+	glad_glBindFramebuffer = proc;
+	proc(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	PFNGLDELETEFRAMEBUFFERSPROC proc = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_load("glDeleteFramebuffers");
+	if(proc == NULL) return;
+	glad_glDeleteFramebuffers = proc;
+	proc(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	PFNGLGENFRAMEBUFFERSPROC proc = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_load("glGenFramebuffers");
+	if(proc == NULL) return;
+	glad_glGenFramebuffers = proc;
+	proc(n, framebuffers);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+	PFNGLCHECKFRAMEBUFFERSTATUSPROC proc = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_load("glCheckFramebufferStatus");
+	if(proc == NULL) return 0;
+	glad_glCheckFramebufferStatus = proc;
+	return proc(target);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	PFNGLFRAMEBUFFERTEXTURE1DPROC proc = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_load("glFramebufferTexture1D");
+	if(proc == NULL) return;
+	glad_glFramebufferTexture1D = proc;
+	proc(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	PFNGLFRAMEBUFFERTEXTURE2DPROC proc = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_load("glFramebufferTexture2D");
+	if(proc == NULL) return;
+	glad_glFramebufferTexture2D = proc;
+	proc(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	PFNGLFRAMEBUFFERTEXTURE3DPROC proc = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_load("glFramebufferTexture3D");
+	if(proc == NULL) return;
+	glad_glFramebufferTexture3D = proc;
+	proc(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	PFNGLFRAMEBUFFERRENDERBUFFERPROC proc = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_load("glFramebufferRenderbuffer");
+	if(proc == NULL) return;
+	glad_glFramebufferRenderbuffer = proc;
+	proc(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC proc = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_load("glGetFramebufferAttachmentParameteriv");
+	if(proc == NULL) return;
+	glad_glGetFramebufferAttachmentParameteriv = proc;
+	proc(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+	PFNGLGENERATEMIPMAPPROC proc = (PFNGLGENERATEMIPMAPPROC)glad_lazy_load("glGenerateMipmap");
+	if(proc == NULL) return;
+	glad_glGenerateMipmap = proc;
+	proc(target);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	PFNGLBLITFRAMEBUFFERPROC proc = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_load("glBlitFramebuffer");
+	if(proc == NULL) return;
+	glad_glBlitFramebuffer = proc;
+	proc(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC proc = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_load("glRenderbufferStorageMultisample");
+	if(proc == NULL) return;
+	glad_glRenderbufferStorageMultisample = proc;
+	proc(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	PFNGLFRAMEBUFFERTEXTURELAYERPROC proc = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_load("glFramebufferTextureLayer");
+	if(proc == NULL) return;
+	glad_glFramebufferTextureLayer = proc;
+	proc(target, attachment, texture, level, layer);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	PFNGLMAPBUFFERRANGEPROC proc = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_load("glMapBufferRange");
+	if(proc == NULL) return 0;
+	glad_glMapBufferRange = proc;
+	return proc(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	PFNGLFLUSHMAPPEDBUFFERRANGEPROC proc = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_load("glFlushMappedBufferRange");
+	if(proc == NULL) return;
+	glad_glFlushMappedBufferRange = proc;
+	proc(target, offset, length);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+	PFNGLBINDVERTEXARRAYPROC proc = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_load("glBindVertexArray");
+	if(proc == NULL) return;
+	glad_glBindVertexArray = proc;
+	proc(array);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	PFNGLDELETEVERTEXARRAYSPROC proc = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_load("glDeleteVertexArrays");
+	if(proc == NULL) return;
+	glad_glDeleteVertexArrays = proc;
+	proc(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	PFNGLGENVERTEXARRAYSPROC proc = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_load("glGenVertexArrays");
+	if(proc == NULL) return;
+	glad_glGenVertexArrays = proc;
+	proc(n, arrays);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+	PFNGLISVERTEXARRAYPROC proc = (PFNGLISVERTEXARRAYPROC)glad_lazy_load("glIsVertexArray");
+	if(proc == NULL) return 0;
+	glad_glIsVertexArray = proc;
+	return proc(array);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	PFNGLDRAWARRAYSINSTANCEDPROC proc = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_load("glDrawArraysInstanced");
+	if(proc == NULL) return;
+	glad_glDrawArraysInstanced = proc;
+	proc(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	PFNGLDRAWELEMENTSINSTANCEDPROC proc = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_load("glDrawElementsInstanced");
+	if(proc == NULL) return;
+	glad_glDrawElementsInstanced = proc;
+	proc(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	PFNGLTEXBUFFERPROC proc = (PFNGLTEXBUFFERPROC)glad_lazy_load("glTexBuffer");
+	if(proc == NULL) return;
+	glad_glTexBuffer = proc;
+	proc(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+	PFNGLPRIMITIVERESTARTINDEXPROC proc = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_load("glPrimitiveRestartIndex");
+	if(proc == NULL) return;
+	glad_glPrimitiveRestartIndex = proc;
+	proc(index);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	PFNGLCOPYBUFFERSUBDATAPROC proc = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_load("glCopyBufferSubData");
+	if(proc == NULL) return;
+	glad_glCopyBufferSubData = proc;
+	proc(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	PFNGLGETUNIFORMINDICESPROC proc = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_load("glGetUniformIndices");
+	if(proc == NULL) return;
+	glad_glGetUniformIndices = proc;
+	proc(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	PFNGLGETACTIVEUNIFORMSIVPROC proc = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_load("glGetActiveUniformsiv");
+	if(proc == NULL) return;
+	glad_glGetActiveUniformsiv = proc;
+	proc(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	PFNGLGETACTIVEUNIFORMNAMEPROC proc = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_load("glGetActiveUniformName");
+	if(proc == NULL) return;
+	glad_glGetActiveUniformName = proc;
+	proc(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	PFNGLGETUNIFORMBLOCKINDEXPROC proc = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_load("glGetUniformBlockIndex");
+	if(proc == NULL) return 0;
+	glad_glGetUniformBlockIndex = proc;
+	return proc(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	PFNGLGETACTIVEUNIFORMBLOCKIVPROC proc = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_load("glGetActiveUniformBlockiv");
+	if(proc == NULL) return;
+	glad_glGetActiveUniformBlockiv = proc;
+	proc(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC proc = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_load("glGetActiveUniformBlockName");
+	if(proc == NULL) return;
+	glad_glGetActiveUniformBlockName = proc;
+	proc(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	PFNGLUNIFORMBLOCKBINDINGPROC proc = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_load("glUniformBlockBinding");
+	if(proc == NULL) return;
+	glad_glUniformBlockBinding = proc;
+	proc(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	PFNGLDRAWELEMENTSBASEVERTEXPROC proc = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_load("glDrawElementsBaseVertex");
+	if(proc == NULL) return;
+	glad_glDrawElementsBaseVertex = proc;
+	proc(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC proc = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_load("glDrawRangeElementsBaseVertex");
+	if(proc == NULL) return;
+	glad_glDrawRangeElementsBaseVertex = proc;
+	proc(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC proc = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_load("glDrawElementsInstancedBaseVertex");
+	if(proc == NULL) return;
+	glad_glDrawElementsInstancedBaseVertex = proc;
+	proc(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC proc = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_load("glMultiDrawElementsBaseVertex");
+	if(proc == NULL) return;
+	glad_glMultiDrawElementsBaseVertex = proc;
+	proc(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+	PFNGLPROVOKINGVERTEXPROC proc = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_load("glProvokingVertex");
+	if(proc == NULL) return;
+	glad_glProvokingVertex = proc;
+	proc(mode);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	PFNGLFENCESYNCPROC proc = (PFNGLFENCESYNCPROC)glad_lazy_load("glFenceSync");
+	if(proc == NULL) return 0;
+	glad_glFenceSync = proc;
+	return proc(condition, flags);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+	PFNGLISSYNCPROC proc = (PFNGLISSYNCPROC)glad_lazy_load("glIsSync");
+	if(proc == NULL) return 0;
+	glad_glIsSync = proc;
+	return proc(sync);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+	PFNGLDELETESYNCPROC proc = (PFNGLDELETESYNCPROC)glad_lazy_load("glDeleteSync");
+	if(proc == NULL) return;
+	glad_glDeleteSync = proc;
+	proc(sync);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	PFNGLCLIENTWAITSYNCPROC proc = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_load("glClientWaitSync");
+	if(proc == NULL) return 0;
+	glad_glClientWaitSync = proc;
+	return proc(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	PFNGLWAITSYNCPROC proc = (PFNGLWAITSYNCPROC)glad_lazy_load("glWaitSync");
+	if(proc == NULL) return;
+	glad_glWaitSync = proc;
+	proc(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	PFNGLGETINTEGER64VPROC proc = (PFNGLGETINTEGER64VPROC)glad_lazy_load("glGetInteger64v");
+	if(proc == NULL) return;
+	glad_glGetInteger64v = proc;
+	proc(pname, data);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	PFNGLGETSYNCIVPROC proc = (PFNGLGETSYNCIVPROC)glad_lazy_load("glGetSynciv");
+	if(proc == NULL) return;
+	glad_glGetSynciv = proc;
+	proc(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	PFNGLGETINTEGER64I_VPROC proc = (PFNGLGETINTEGER64I_VPROC)glad_lazy_load("glGetInteger64i_v");
+	if(proc == NULL) return;
+	glad_glGetInteger64i_v = proc;
+	proc(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	PFNGLGETBUFFERPARAMETERI64VPROC proc = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_load("glGetBufferParameteri64v");
+	if(proc == NULL) return;
+	glad_glGetBufferParameteri64v = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	PFNGLFRAMEBUFFERTEXTUREPROC proc = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_load("glFramebufferTexture");
+	if(proc == NULL) return;
+	glad_glFramebufferTexture = proc;
+	proc(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	PFNGLTEXIMAGE2DMULTISAMPLEPROC proc = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_load("glTexImage2DMultisample");
+	if(proc == NULL) return;
+	glad_glTexImage2DMultisample = proc;
+	proc(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	PFNGLTEXIMAGE3DMULTISAMPLEPROC proc = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_load("glTexImage3DMultisample");
+	if(proc == NULL) return;
+	glad_glTexImage3DMultisample = proc;
+	proc(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	PFNGLGETMULTISAMPLEFVPROC proc = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_load("glGetMultisamplefv");
+	if(proc == NULL) return;
+	glad_glGetMultisamplefv = proc;
+	proc(pname, index, val);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	PFNGLSAMPLEMASKIPROC proc = (PFNGLSAMPLEMASKIPROC)glad_lazy_load("glSampleMaski");
+	if(proc == NULL) return;
+	glad_glSampleMaski = proc;
+	proc(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	PFNGLBINDFRAGDATALOCATIONINDEXEDPROC proc = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_load("glBindFragDataLocationIndexed");
+	if(proc == NULL) return;
+	glad_glBindFragDataLocationIndexed = proc;
+	proc(program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	PFNGLGETFRAGDATAINDEXPROC proc = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_load("glGetFragDataIndex");
+	if(proc == NULL) return 0;
+	glad_glGetFragDataIndex = proc;
+	return proc(program, name);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	PFNGLGENSAMPLERSPROC proc = (PFNGLGENSAMPLERSPROC)glad_lazy_load("glGenSamplers");
+	if(proc == NULL) return;
+	glad_glGenSamplers = proc;
+	proc(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	PFNGLDELETESAMPLERSPROC proc = (PFNGLDELETESAMPLERSPROC)glad_lazy_load("glDeleteSamplers");
+	if(proc == NULL) return;
+	glad_glDeleteSamplers = proc;
+	proc(count, samplers);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+	PFNGLISSAMPLERPROC proc = (PFNGLISSAMPLERPROC)glad_lazy_load("glIsSampler");
+	if(proc == NULL) return 0;
+	glad_glIsSampler = proc;
+	return proc(sampler);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	PFNGLBINDSAMPLERPROC proc = (PFNGLBINDSAMPLERPROC)glad_lazy_load("glBindSampler");
+	if(proc == NULL) return;
+	glad_glBindSampler = proc;
+	proc(unit, sampler);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	PFNGLSAMPLERPARAMETERIPROC proc = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_load("glSamplerParameteri");
+	if(proc == NULL) return;
+	glad_glSamplerParameteri = proc;
+	proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	PFNGLSAMPLERPARAMETERIVPROC proc = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_load("glSamplerParameteriv");
+	if(proc == NULL) return;
+	glad_glSamplerParameteriv = proc;
+	proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	PFNGLSAMPLERPARAMETERFPROC proc = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_load("glSamplerParameterf");
+	if(proc == NULL) return;
+	glad_glSamplerParameterf = proc;
+	proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	PFNGLSAMPLERPARAMETERFVPROC proc = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_load("glSamplerParameterfv");
+	if(proc == NULL) return;
+	glad_glSamplerParameterfv = proc;
+	proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	PFNGLSAMPLERPARAMETERIIVPROC proc = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_load("glSamplerParameterIiv");
+	if(proc == NULL) return;
+	glad_glSamplerParameterIiv = proc;
+	proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	PFNGLSAMPLERPARAMETERIUIVPROC proc = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_load("glSamplerParameterIuiv");
+	if(proc == NULL) return;
+	glad_glSamplerParameterIuiv = proc;
+	proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	PFNGLGETSAMPLERPARAMETERIVPROC proc = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_load("glGetSamplerParameteriv");
+	if(proc == NULL) return;
+	glad_glGetSamplerParameteriv = proc;
+	proc(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	PFNGLGETSAMPLERPARAMETERIIVPROC proc = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_load("glGetSamplerParameterIiv");
+	if(proc == NULL) return;
+	glad_glGetSamplerParameterIiv = proc;
+	proc(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	PFNGLGETSAMPLERPARAMETERFVPROC proc = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_load("glGetSamplerParameterfv");
+	if(proc == NULL) return;
+	glad_glGetSamplerParameterfv = proc;
+	proc(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	PFNGLGETSAMPLERPARAMETERIUIVPROC proc = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_load("glGetSamplerParameterIuiv");
+	if(proc == NULL) return;
+	glad_glGetSamplerParameterIuiv = proc;
+	proc(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+	PFNGLQUERYCOUNTERPROC proc = (PFNGLQUERYCOUNTERPROC)glad_lazy_load("glQueryCounter");
+	if(proc == NULL) return;
+	glad_glQueryCounter = proc;
+	proc(id, target);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	PFNGLGETQUERYOBJECTI64VPROC proc = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_load("glGetQueryObjecti64v");
+	if(proc == NULL) return;
+	glad_glGetQueryObjecti64v = proc;
+	proc(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	PFNGLGETQUERYOBJECTUI64VPROC proc = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_load("glGetQueryObjectui64v");
+	if(proc == NULL) return;
+	glad_glGetQueryObjectui64v = proc;
+	proc(id, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	PFNGLVERTEXATTRIBDIVISORPROC proc = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_load("glVertexAttribDivisor");
+	if(proc == NULL) return;
+	glad_glVertexAttribDivisor = proc;
+	proc(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	PFNGLVERTEXATTRIBP1UIPROC proc = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_load("glVertexAttribP1ui");
+	if(proc == NULL) return;
+	glad_glVertexAttribP1ui = proc;
+	proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	PFNGLVERTEXATTRIBP1UIVPROC proc = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_load("glVertexAttribP1uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttribP1uiv = proc;
+	proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	PFNGLVERTEXATTRIBP2UIPROC proc = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_load("glVertexAttribP2ui");
+	if(proc == NULL) return;
+	glad_glVertexAttribP2ui = proc;
+	proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	PFNGLVERTEXATTRIBP2UIVPROC proc = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_load("glVertexAttribP2uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttribP2uiv = proc;
+	proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	PFNGLVERTEXATTRIBP3UIPROC proc = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_load("glVertexAttribP3ui");
+	if(proc == NULL) return;
+	glad_glVertexAttribP3ui = proc;
+	proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	PFNGLVERTEXATTRIBP3UIVPROC proc = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_load("glVertexAttribP3uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttribP3uiv = proc;
+	proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	PFNGLVERTEXATTRIBP4UIPROC proc = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_load("glVertexAttribP4ui");
+	if(proc == NULL) return;
+	glad_glVertexAttribP4ui = proc;
+	proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	PFNGLVERTEXATTRIBP4UIVPROC proc = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_load("glVertexAttribP4uiv");
+	if(proc == NULL) return;
+	glad_glVertexAttribP4uiv = proc;
+	proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+	PFNGLVERTEXP2UIPROC proc = (PFNGLVERTEXP2UIPROC)glad_lazy_load("glVertexP2ui");
+	if(proc == NULL) return;
+	glad_glVertexP2ui = proc;
+	proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	PFNGLVERTEXP2UIVPROC proc = (PFNGLVERTEXP2UIVPROC)glad_lazy_load("glVertexP2uiv");
+	if(proc == NULL) return;
+	glad_glVertexP2uiv = proc;
+	proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+	PFNGLVERTEXP3UIPROC proc = (PFNGLVERTEXP3UIPROC)glad_lazy_load("glVertexP3ui");
+	if(proc == NULL) return;
+	glad_glVertexP3ui = proc;
+	proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	PFNGLVERTEXP3UIVPROC proc = (PFNGLVERTEXP3UIVPROC)glad_lazy_load("glVertexP3uiv");
+	if(proc == NULL) return;
+	glad_glVertexP3uiv = proc;
+	proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+	PFNGLVERTEXP4UIPROC proc = (PFNGLVERTEXP4UIPROC)glad_lazy_load("glVertexP4ui");
+	if(proc == NULL) return;
+	glad_glVertexP4ui = proc;
+	proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	PFNGLVERTEXP4UIVPROC proc = (PFNGLVERTEXP4UIVPROC)glad_lazy_load("glVertexP4uiv");
+	if(proc == NULL) return;
+	glad_glVertexP4uiv = proc;
+	proc(type, value);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	PFNGLTEXCOORDP1UIPROC proc = (PFNGLTEXCOORDP1UIPROC)glad_lazy_load("glTexCoordP1ui");
+	if(proc == NULL) return;
+	glad_glTexCoordP1ui = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	PFNGLTEXCOORDP1UIVPROC proc = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_load("glTexCoordP1uiv");
+	if(proc == NULL) return;
+	glad_glTexCoordP1uiv = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	PFNGLTEXCOORDP2UIPROC proc = (PFNGLTEXCOORDP2UIPROC)glad_lazy_load("glTexCoordP2ui");
+	if(proc == NULL) return;
+	glad_glTexCoordP2ui = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	PFNGLTEXCOORDP2UIVPROC proc = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_load("glTexCoordP2uiv");
+	if(proc == NULL) return;
+	glad_glTexCoordP2uiv = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	PFNGLTEXCOORDP3UIPROC proc = (PFNGLTEXCOORDP3UIPROC)glad_lazy_load("glTexCoordP3ui");
+	if(proc == NULL) return;
+	glad_glTexCoordP3ui = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	PFNGLTEXCOORDP3UIVPROC proc = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_load("glTexCoordP3uiv");
+	if(proc == NULL) return;
+	glad_glTexCoordP3uiv = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	PFNGLTEXCOORDP4UIPROC proc = (PFNGLTEXCOORDP4UIPROC)glad_lazy_load("glTexCoordP4ui");
+	if(proc == NULL) return;
+	glad_glTexCoordP4ui = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	PFNGLTEXCOORDP4UIVPROC proc = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_load("glTexCoordP4uiv");
+	if(proc == NULL) return;
+	glad_glTexCoordP4uiv = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	PFNGLMULTITEXCOORDP1UIPROC proc = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_load("glMultiTexCoordP1ui");
+	if(proc == NULL) return;
+	glad_glMultiTexCoordP1ui = proc;
+	proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	PFNGLMULTITEXCOORDP1UIVPROC proc = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_load("glMultiTexCoordP1uiv");
+	if(proc == NULL) return;
+	glad_glMultiTexCoordP1uiv = proc;
+	proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	PFNGLMULTITEXCOORDP2UIPROC proc = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_load("glMultiTexCoordP2ui");
+	if(proc == NULL) return;
+	glad_glMultiTexCoordP2ui = proc;
+	proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	PFNGLMULTITEXCOORDP2UIVPROC proc = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_load("glMultiTexCoordP2uiv");
+	if(proc == NULL) return;
+	glad_glMultiTexCoordP2uiv = proc;
+	proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	PFNGLMULTITEXCOORDP3UIPROC proc = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_load("glMultiTexCoordP3ui");
+	if(proc == NULL) return;
+	glad_glMultiTexCoordP3ui = proc;
+	proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	PFNGLMULTITEXCOORDP3UIVPROC proc = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_load("glMultiTexCoordP3uiv");
+	if(proc == NULL) return;
+	glad_glMultiTexCoordP3uiv = proc;
+	proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	PFNGLMULTITEXCOORDP4UIPROC proc = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_load("glMultiTexCoordP4ui");
+	if(proc == NULL) return;
+	glad_glMultiTexCoordP4ui = proc;
+	proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	PFNGLMULTITEXCOORDP4UIVPROC proc = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_load("glMultiTexCoordP4uiv");
+	if(proc == NULL) return;
+	glad_glMultiTexCoordP4uiv = proc;
+	proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	PFNGLNORMALP3UIPROC proc = (PFNGLNORMALP3UIPROC)glad_lazy_load("glNormalP3ui");
+	if(proc == NULL) return;
+	glad_glNormalP3ui = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	PFNGLNORMALP3UIVPROC proc = (PFNGLNORMALP3UIVPROC)glad_lazy_load("glNormalP3uiv");
+	if(proc == NULL) return;
+	glad_glNormalP3uiv = proc;
+	proc(type, coords);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+	PFNGLCOLORP3UIPROC proc = (PFNGLCOLORP3UIPROC)glad_lazy_load("glColorP3ui");
+	if(proc == NULL) return;
+	glad_glColorP3ui = proc;
+	proc(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	PFNGLCOLORP3UIVPROC proc = (PFNGLCOLORP3UIVPROC)glad_lazy_load("glColorP3uiv");
+	if(proc == NULL) return;
+	glad_glColorP3uiv = proc;
+	proc(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+	PFNGLCOLORP4UIPROC proc = (PFNGLCOLORP4UIPROC)glad_lazy_load("glColorP4ui");
+	if(proc == NULL) return;
+	glad_glColorP4ui = proc;
+	proc(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	PFNGLCOLORP4UIVPROC proc = (PFNGLCOLORP4UIVPROC)glad_lazy_load("glColorP4uiv");
+	if(proc == NULL) return;
+	glad_glColorP4uiv = proc;
+	proc(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	PFNGLSECONDARYCOLORP3UIPROC proc = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_load("glSecondaryColorP3ui");
+	if(proc == NULL) return;
+	glad_glSecondaryColorP3ui = proc;
+	proc(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	PFNGLSECONDARYCOLORP3UIVPROC proc = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_load("glSecondaryColorP3uiv");
+	if(proc == NULL) return;
+	glad_glSecondaryColorP3uiv = proc;
+	proc(type, color);
+}
+static void APIENTRY glad_lazy_glMinSampleShading(GLfloat value) {
+	PFNGLMINSAMPLESHADINGPROC proc = (PFNGLMINSAMPLESHADINGPROC)glad_lazy_load("glMinSampleShading");
+	if(proc == NULL) return;
+	glad_glMinSampleShading = proc;
+	proc(value);
+}
+static void APIENTRY glad_lazy_glBlendEquationi(GLuint buf, GLenum mode) {
+	PFNGLBLENDEQUATIONIPROC proc = (PFNGLBLENDEQUATIONIPROC)glad_lazy_load("glBlendEquationi");
+	if(proc == NULL) return;
+	glad_glBlendEquationi = proc;
+	proc(buf, mode);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	PFNGLBLENDEQUATIONSEPARATEIPROC proc = (PFNGLBLENDEQUATIONSEPARATEIPROC)glad_lazy_load("glBlendEquationSeparatei");
+	if(proc == NULL) return;
+	glad_glBlendEquationSeparatei = proc;
+	proc(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	PFNGLBLENDFUNCIPROC proc = (PFNGLBLENDFUNCIPROC)glad_lazy_load("glBlendFunci");
+	if(proc == NULL) return;
+	glad_glBlendFunci = proc;
+	proc(buf, src, dst);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	PFNGLBLENDFUNCSEPARATEIPROC proc = (PFNGLBLENDFUNCSEPARATEIPROC)glad_lazy_load("glBlendFuncSeparatei");
+	if(proc == NULL) return;
+	glad_glBlendFuncSeparatei = proc;
+	proc(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	PFNGLDRAWARRAYSINDIRECTPROC proc = (PFNGLDRAWARRAYSINDIRECTPROC)glad_lazy_load("glDrawArraysIndirect");
+	if(proc == NULL) return;
+	glad_glDrawArraysIndirect = proc;
+	proc(mode, indirect);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	PFNGLDRAWELEMENTSINDIRECTPROC proc = (PFNGLDRAWELEMENTSINDIRECTPROC)glad_lazy_load("glDrawElementsIndirect");
+	if(proc == NULL) return;
+	glad_glDrawElementsIndirect = proc;
+	proc(mode, type, indirect);
+}
+static void APIENTRY glad_lazy_glUniform1d(GLint location, GLdouble x) {
+	PFNGLUNIFORM1DPROC proc = (PFNGLUNIFORM1DPROC)glad_lazy_load("glUniform1d");
+	if(proc == NULL) return;
+	glad_glUniform1d = proc;
+	proc(location, x);
+}
+static void APIENTRY glad_lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	PFNGLUNIFORM2DPROC proc = (PFNGLUNIFORM2DPROC)glad_lazy_load("glUniform2d");
+	if(proc == NULL) return;
+	glad_glUniform2d = proc;
+	proc(location, x, y);
+}
+static void APIENTRY glad_lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	PFNGLUNIFORM3DPROC proc = (PFNGLUNIFORM3DPROC)glad_lazy_load("glUniform3d");
+	if(proc == NULL) return;
+	glad_glUniform3d = proc;
+	proc(location, x, y, z);
+}
+static void APIENTRY glad_lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	PFNGLUNIFORM4DPROC proc = (PFNGLUNIFORM4DPROC)glad_lazy_load("glUniform4d");
+	if(proc == NULL) return;
+	glad_glUniform4d = proc;
+	proc(location, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	PFNGLUNIFORM1DVPROC proc = (PFNGLUNIFORM1DVPROC)glad_lazy_load("glUniform1dv");
+	if(proc == NULL) return;
+	glad_glUniform1dv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	PFNGLUNIFORM2DVPROC proc = (PFNGLUNIFORM2DVPROC)glad_lazy_load("glUniform2dv");
+	if(proc == NULL) return;
+	glad_glUniform2dv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	PFNGLUNIFORM3DVPROC proc = (PFNGLUNIFORM3DVPROC)glad_lazy_load("glUniform3dv");
+	if(proc == NULL) return;
+	glad_glUniform3dv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	PFNGLUNIFORM4DVPROC proc = (PFNGLUNIFORM4DVPROC)glad_lazy_load("glUniform4dv");
+	if(proc == NULL) return;
+	glad_glUniform4dv = proc;
+	proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX2DVPROC proc = (PFNGLUNIFORMMATRIX2DVPROC)glad_lazy_load("glUniformMatrix2dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix2dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX3DVPROC proc = (PFNGLUNIFORMMATRIX3DVPROC)glad_lazy_load("glUniformMatrix3dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix3dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX4DVPROC proc = (PFNGLUNIFORMMATRIX4DVPROC)glad_lazy_load("glUniformMatrix4dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix4dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX2X3DVPROC proc = (PFNGLUNIFORMMATRIX2X3DVPROC)glad_lazy_load("glUniformMatrix2x3dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix2x3dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX2X4DVPROC proc = (PFNGLUNIFORMMATRIX2X4DVPROC)glad_lazy_load("glUniformMatrix2x4dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix2x4dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX3X2DVPROC proc = (PFNGLUNIFORMMATRIX3X2DVPROC)glad_lazy_load("glUniformMatrix3x2dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix3x2dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX3X4DVPROC proc = (PFNGLUNIFORMMATRIX3X4DVPROC)glad_lazy_load("glUniformMatrix3x4dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix3x4dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX4X2DVPROC proc = (PFNGLUNIFORMMATRIX4X2DVPROC)glad_lazy_load("glUniformMatrix4x2dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix4x2dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLUNIFORMMATRIX4X3DVPROC proc = (PFNGLUNIFORMMATRIX4X3DVPROC)glad_lazy_load("glUniformMatrix4x3dv");
+	if(proc == NULL) return;
+	glad_glUniformMatrix4x3dv = proc;
+	proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+	PFNGLGETUNIFORMDVPROC proc = (PFNGLGETUNIFORMDVPROC)glad_lazy_load("glGetUniformdv");
+	if(proc == NULL) return;
+	glad_glGetUniformdv = proc;
+	proc(program, location, params);
+}
+static GLint APIENTRY glad_lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+	PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC proc = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glad_lazy_load("glGetSubroutineUniformLocation");
+	if(proc == NULL) return 0;
+	glad_glGetSubroutineUniformLocation = proc;
+	return proc(program, shadertype, name);
+}
+static GLuint APIENTRY glad_lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+	PFNGLGETSUBROUTINEINDEXPROC proc = (PFNGLGETSUBROUTINEINDEXPROC)glad_lazy_load("glGetSubroutineIndex");
+	if(proc == NULL) return 0;
+	glad_glGetSubroutineIndex = proc;
+	return proc(program, shadertype, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+	PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC proc = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glad_lazy_load("glGetActiveSubroutineUniformiv");
+	if(proc == NULL) return;
+	glad_glGetActiveSubroutineUniformiv = proc;
+	proc(program, shadertype, index, pname, values);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC proc = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glad_lazy_load("glGetActiveSubroutineUniformName");
+	if(proc == NULL) return;
+	glad_glGetActiveSubroutineUniformName = proc;
+	proc(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	PFNGLGETACTIVESUBROUTINENAMEPROC proc = (PFNGLGETACTIVESUBROUTINENAMEPROC)glad_lazy_load("glGetActiveSubroutineName");
+	if(proc == NULL) return;
+	glad_glGetActiveSubroutineName = proc;
+	proc(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	PFNGLUNIFORMSUBROUTINESUIVPROC proc = (PFNGLUNIFORMSUBROUTINESUIVPROC)glad_lazy_load("glUniformSubroutinesuiv");
+	if(proc == NULL) return;
+	glad_glUniformSubroutinesuiv = proc;
+	proc(shadertype, count, indices);
+}
+static void APIENTRY glad_lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+	PFNGLGETUNIFORMSUBROUTINEUIVPROC proc = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)glad_lazy_load("glGetUniformSubroutineuiv");
+	if(proc == NULL) return;
+	glad_glGetUniformSubroutineuiv = proc;
+	proc(shadertype, location, params);
+}
+static void APIENTRY glad_lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+	PFNGLGETPROGRAMSTAGEIVPROC proc = (PFNGLGETPROGRAMSTAGEIVPROC)glad_lazy_load("glGetProgramStageiv");
+	if(proc == NULL) return;
+	glad_glGetProgramStageiv = proc;
+	proc(program, shadertype, pname, values);
+}
+static void APIENTRY glad_lazy_glPatchParameteri(GLenum pname, GLint value) {
+	PFNGLPATCHPARAMETERIPROC proc = (PFNGLPATCHPARAMETERIPROC)glad_lazy_load("glPatchParameteri");
+	if(proc == NULL) return;
+	glad_glPatchParameteri = proc;
+	proc(pname, value);
+}
+static void APIENTRY glad_lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	PFNGLPATCHPARAMETERFVPROC proc = (PFNGLPATCHPARAMETERFVPROC)glad_lazy_load("glPatchParameterfv");
+	if(proc == NULL) return;
+	glad_glPatchParameterfv = proc;
+	proc(pname, values);
+}
+static void APIENTRY glad_lazy_glBindTransformFeedback(GLenum target, GLuint id) {
+	PFNGLBINDTRANSFORMFEEDBACKPROC proc = (PFNGLBINDTRANSFORMFEEDBACKPROC)glad_lazy_load("glBindTransformFeedback");
+	if(proc == NULL) return;
+	glad_glBindTransformFeedback = proc;
+	proc(target, id);
+}
+static void APIENTRY glad_lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	PFNGLDELETETRANSFORMFEEDBACKSPROC proc = (PFNGLDELETETRANSFORMFEEDBACKSPROC)glad_lazy_load("glDeleteTransformFeedbacks");
+	if(proc == NULL) return;
+	glad_glDeleteTransformFeedbacks = proc;
+	proc(n, ids);
+}
+static void APIENTRY glad_lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	PFNGLGENTRANSFORMFEEDBACKSPROC proc = (PFNGLGENTRANSFORMFEEDBACKSPROC)glad_lazy_load("glGenTransformFeedbacks");
+	if(proc == NULL) return;
+	glad_glGenTransformFeedbacks = proc;
+	proc(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsTransformFeedback(GLuint id) {
+	PFNGLISTRANSFORMFEEDBACKPROC proc = (PFNGLISTRANSFORMFEEDBACKPROC)glad_lazy_load("glIsTransformFeedback");
+	if(proc == NULL) return 0;
+	glad_glIsTransformFeedback = proc;
+	return proc(id);
+}
+static void APIENTRY glad_lazy_glPauseTransformFeedback(void) {
+	PFNGLPAUSETRANSFORMFEEDBACKPROC proc = (PFNGLPAUSETRANSFORMFEEDBACKPROC)glad_lazy_load("glPauseTransformFeedback");
+	if(proc == NULL) return;
+	glad_glPauseTransformFeedback = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glResumeTransformFeedback(void) {
+	PFNGLRESUMETRANSFORMFEEDBACKPROC proc = (PFNGLRESUMETRANSFORMFEEDBACKPROC)glad_lazy_load("glResumeTransformFeedback");
+	if(proc == NULL) return;
+	glad_glResumeTransformFeedback = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	PFNGLDRAWTRANSFORMFEEDBACKPROC proc = (PFNGLDRAWTRANSFORMFEEDBACKPROC)glad_lazy_load("glDrawTransformFeedback");
+	if(proc == NULL) return;
+	glad_glDrawTransformFeedback = proc;
+	proc(mode, id);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC proc = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glad_lazy_load("glDrawTransformFeedbackStream");
+	if(proc == NULL) return;
+	glad_glDrawTransformFeedbackStream = proc;
+	proc(mode, id, stream);
+}
+static void APIENTRY glad_lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	PFNGLBEGINQUERYINDEXEDPROC proc = (PFNGLBEGINQUERYINDEXEDPROC)glad_lazy_load("glBeginQueryIndexed");
+	if(proc == NULL) return;
+	glad_glBeginQueryIndexed = proc;
+	proc(target, index, id);
+}
+static void APIENTRY glad_lazy_glEndQueryIndexed(GLenum target, GLuint index) {
+	PFNGLENDQUERYINDEXEDPROC proc = (PFNGLENDQUERYINDEXEDPROC)glad_lazy_load("glEndQueryIndexed");
+	if(proc == NULL) return;
+	glad_glEndQueryIndexed = proc;
+	proc(target, index);
+}
+static void APIENTRY glad_lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	PFNGLGETQUERYINDEXEDIVPROC proc = (PFNGLGETQUERYINDEXEDIVPROC)glad_lazy_load("glGetQueryIndexediv");
+	if(proc == NULL) return;
+	glad_glGetQueryIndexediv = proc;
+	proc(target, index, pname, params);
+}
+static void APIENTRY glad_lazy_glReleaseShaderCompiler(void) {
+	PFNGLRELEASESHADERCOMPILERPROC proc = (PFNGLRELEASESHADERCOMPILERPROC)glad_lazy_load("glReleaseShaderCompiler");
+	if(proc == NULL) return;
+	glad_glReleaseShaderCompiler = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+	PFNGLSHADERBINARYPROC proc = (PFNGLSHADERBINARYPROC)glad_lazy_load("glShaderBinary");
+	if(proc == NULL) return;
+	glad_glShaderBinary = proc;
+	proc(count, shaders, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+	PFNGLGETSHADERPRECISIONFORMATPROC proc = (PFNGLGETSHADERPRECISIONFORMATPROC)glad_lazy_load("glGetShaderPrecisionFormat");
+	if(proc == NULL) return;
+	glad_glGetShaderPrecisionFormat = proc;
+	proc(shadertype, precisiontype, range, precision);
+}
+static void APIENTRY glad_lazy_glDepthRangef(GLfloat n, GLfloat f) {
+	PFNGLDEPTHRANGEFPROC proc = (PFNGLDEPTHRANGEFPROC)glad_lazy_load("glDepthRangef");
+	if(proc == NULL) return;
+	glad_glDepthRangef = proc;
+	proc(n, f);
+}
+static void APIENTRY glad_lazy_glClearDepthf(GLfloat d) {
+	PFNGLCLEARDEPTHFPROC proc = (PFNGLCLEARDEPTHFPROC)glad_lazy_load("glClearDepthf");
+	if(proc == NULL) return;
+	glad_glClearDepthf = proc;
+	proc(d);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	PFNGLGETPROGRAMBINARYPROC proc = (PFNGLGETPROGRAMBINARYPROC)glad_lazy_load("glGetProgramBinary");
+	if(proc == NULL) return;
+	glad_glGetProgramBinary = proc;
+	proc(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	PFNGLPROGRAMBINARYPROC proc = (PFNGLPROGRAMBINARYPROC)glad_lazy_load("glProgramBinary");
+	if(proc == NULL) return;
+	glad_glProgramBinary = proc;
+	proc(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	PFNGLPROGRAMPARAMETERIPROC proc = (PFNGLPROGRAMPARAMETERIPROC)glad_lazy_load("glProgramParameteri");
+	if(proc == NULL) return;
+	glad_glProgramParameteri = proc;
+	proc(program, pname, value);
+}
+static void APIENTRY glad_lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	PFNGLUSEPROGRAMSTAGESPROC proc = (PFNGLUSEPROGRAMSTAGESPROC)glad_lazy_load("glUseProgramStages");
+	if(proc == NULL) return;
+	glad_glUseProgramStages = proc;
+	proc(pipeline, stages, program);
+}
+static void APIENTRY glad_lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	PFNGLACTIVESHADERPROGRAMPROC proc = (PFNGLACTIVESHADERPROGRAMPROC)glad_lazy_load("glActiveShaderProgram");
+	if(proc == NULL) return;
+	glad_glActiveShaderProgram = proc;
+	proc(pipeline, program);
+}
+static GLuint APIENTRY glad_lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	PFNGLCREATESHADERPROGRAMVPROC proc = (PFNGLCREATESHADERPROGRAMVPROC)glad_lazy_load("glCreateShaderProgramv");
+	if(proc == NULL) return 0;
+	glad_glCreateShaderProgramv = proc;
+	return proc(type, count, strings);
+}
+static void APIENTRY glad_lazy_glBindProgramPipeline(GLuint pipeline) {
+	PFNGLBINDPROGRAMPIPELINEPROC proc = (PFNGLBINDPROGRAMPIPELINEPROC)glad_lazy_load("glBindProgramPipeline");
+	if(proc == NULL) return;
+	glad_glBindProgramPipeline = proc;
+	proc(pipeline);
+}
+static void APIENTRY glad_lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	PFNGLDELETEPROGRAMPIPELINESPROC proc = (PFNGLDELETEPROGRAMPIPELINESPROC)glad_lazy_load("glDeleteProgramPipelines");
+	if(proc == NULL) return;
+	glad_glDeleteProgramPipelines = proc;
+	proc(n, pipelines);
+}
+static void APIENTRY glad_lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	PFNGLGENPROGRAMPIPELINESPROC proc = (PFNGLGENPROGRAMPIPELINESPROC)glad_lazy_load("glGenProgramPipelines");
+	if(proc == NULL) return;
+	glad_glGenProgramPipelines = proc;
+	proc(n, pipelines);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgramPipeline(GLuint pipeline) {
+	PFNGLISPROGRAMPIPELINEPROC proc = (PFNGLISPROGRAMPIPELINEPROC)glad_lazy_load("glIsProgramPipeline");
+	if(proc == NULL) return 0;
+	glad_glIsProgramPipeline = proc;
+	return proc(pipeline);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+	PFNGLGETPROGRAMPIPELINEIVPROC proc = (PFNGLGETPROGRAMPIPELINEIVPROC)glad_lazy_load("glGetProgramPipelineiv");
+	if(proc == NULL) return;
+	glad_glGetProgramPipelineiv = proc;
+	proc(pipeline, pname, params);
+}
+static void APIENTRY glad_lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	PFNGLPROGRAMUNIFORM1IPROC proc = (PFNGLPROGRAMUNIFORM1IPROC)glad_lazy_load("glProgramUniform1i");
+	if(proc == NULL) return;
+	glad_glProgramUniform1i = proc;
+	proc(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	PFNGLPROGRAMUNIFORM1IVPROC proc = (PFNGLPROGRAMUNIFORM1IVPROC)glad_lazy_load("glProgramUniform1iv");
+	if(proc == NULL) return;
+	glad_glProgramUniform1iv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	PFNGLPROGRAMUNIFORM1FPROC proc = (PFNGLPROGRAMUNIFORM1FPROC)glad_lazy_load("glProgramUniform1f");
+	if(proc == NULL) return;
+	glad_glProgramUniform1f = proc;
+	proc(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORM1FVPROC proc = (PFNGLPROGRAMUNIFORM1FVPROC)glad_lazy_load("glProgramUniform1fv");
+	if(proc == NULL) return;
+	glad_glProgramUniform1fv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	PFNGLPROGRAMUNIFORM1DPROC proc = (PFNGLPROGRAMUNIFORM1DPROC)glad_lazy_load("glProgramUniform1d");
+	if(proc == NULL) return;
+	glad_glProgramUniform1d = proc;
+	proc(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORM1DVPROC proc = (PFNGLPROGRAMUNIFORM1DVPROC)glad_lazy_load("glProgramUniform1dv");
+	if(proc == NULL) return;
+	glad_glProgramUniform1dv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	PFNGLPROGRAMUNIFORM1UIPROC proc = (PFNGLPROGRAMUNIFORM1UIPROC)glad_lazy_load("glProgramUniform1ui");
+	if(proc == NULL) return;
+	glad_glProgramUniform1ui = proc;
+	proc(program, location, v0);
+}
+static void APIENTRY glad_lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	PFNGLPROGRAMUNIFORM1UIVPROC proc = (PFNGLPROGRAMUNIFORM1UIVPROC)glad_lazy_load("glProgramUniform1uiv");
+	if(proc == NULL) return;
+	glad_glProgramUniform1uiv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	PFNGLPROGRAMUNIFORM2IPROC proc = (PFNGLPROGRAMUNIFORM2IPROC)glad_lazy_load("glProgramUniform2i");
+	if(proc == NULL) return;
+	glad_glProgramUniform2i = proc;
+	proc(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	PFNGLPROGRAMUNIFORM2IVPROC proc = (PFNGLPROGRAMUNIFORM2IVPROC)glad_lazy_load("glProgramUniform2iv");
+	if(proc == NULL) return;
+	glad_glProgramUniform2iv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	PFNGLPROGRAMUNIFORM2FPROC proc = (PFNGLPROGRAMUNIFORM2FPROC)glad_lazy_load("glProgramUniform2f");
+	if(proc == NULL) return;
+	glad_glProgramUniform2f = proc;
+	proc(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORM2FVPROC proc = (PFNGLPROGRAMUNIFORM2FVPROC)glad_lazy_load("glProgramUniform2fv");
+	if(proc == NULL) return;
+	glad_glProgramUniform2fv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	PFNGLPROGRAMUNIFORM2DPROC proc = (PFNGLPROGRAMUNIFORM2DPROC)glad_lazy_load("glProgramUniform2d");
+	if(proc == NULL) return;
+	glad_glProgramUniform2d = proc;
+	proc(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORM2DVPROC proc = (PFNGLPROGRAMUNIFORM2DVPROC)glad_lazy_load("glProgramUniform2dv");
+	if(proc == NULL) return;
+	glad_glProgramUniform2dv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	PFNGLPROGRAMUNIFORM2UIPROC proc = (PFNGLPROGRAMUNIFORM2UIPROC)glad_lazy_load("glProgramUniform2ui");
+	if(proc == NULL) return;
+	glad_glProgramUniform2ui = proc;
+	proc(program, location, v0, v1);
+}
+static void APIENTRY glad_lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	PFNGLPROGRAMUNIFORM2UIVPROC proc = (PFNGLPROGRAMUNIFORM2UIVPROC)glad_lazy_load("glProgramUniform2uiv");
+	if(proc == NULL) return;
+	glad_glProgramUniform2uiv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	PFNGLPROGRAMUNIFORM3IPROC proc = (PFNGLPROGRAMUNIFORM3IPROC)glad_lazy_load("glProgramUniform3i");
+	if(proc == NULL) return;
+	glad_glProgramUniform3i = proc;
+	proc(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	PFNGLPROGRAMUNIFORM3IVPROC proc = (PFNGLPROGRAMUNIFORM3IVPROC)glad_lazy_load("glProgramUniform3iv");
+	if(proc == NULL) return;
+	glad_glProgramUniform3iv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	PFNGLPROGRAMUNIFORM3FPROC proc = (PFNGLPROGRAMUNIFORM3FPROC)glad_lazy_load("glProgramUniform3f");
+	if(proc == NULL) return;
+	glad_glProgramUniform3f = proc;
+	proc(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORM3FVPROC proc = (PFNGLPROGRAMUNIFORM3FVPROC)glad_lazy_load("glProgramUniform3fv");
+	if(proc == NULL) return;
+	glad_glProgramUniform3fv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	PFNGLPROGRAMUNIFORM3DPROC proc = (PFNGLPROGRAMUNIFORM3DPROC)glad_lazy_load("glProgramUniform3d");
+	if(proc == NULL) return;
+	glad_glProgramUniform3d = proc;
+	proc(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORM3DVPROC proc = (PFNGLPROGRAMUNIFORM3DVPROC)glad_lazy_load("glProgramUniform3dv");
+	if(proc == NULL) return;
+	glad_glProgramUniform3dv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	PFNGLPROGRAMUNIFORM3UIPROC proc = (PFNGLPROGRAMUNIFORM3UIPROC)glad_lazy_load("glProgramUniform3ui");
+	if(proc == NULL) return;
+	glad_glProgramUniform3ui = proc;
+	proc(program, location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	PFNGLPROGRAMUNIFORM3UIVPROC proc = (PFNGLPROGRAMUNIFORM3UIVPROC)glad_lazy_load("glProgramUniform3uiv");
+	if(proc == NULL) return;
+	glad_glProgramUniform3uiv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	PFNGLPROGRAMUNIFORM4IPROC proc = (PFNGLPROGRAMUNIFORM4IPROC)glad_lazy_load("glProgramUniform4i");
+	if(proc == NULL) return;
+	glad_glProgramUniform4i = proc;
+	proc(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	PFNGLPROGRAMUNIFORM4IVPROC proc = (PFNGLPROGRAMUNIFORM4IVPROC)glad_lazy_load("glProgramUniform4iv");
+	if(proc == NULL) return;
+	glad_glProgramUniform4iv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	PFNGLPROGRAMUNIFORM4FPROC proc = (PFNGLPROGRAMUNIFORM4FPROC)glad_lazy_load("glProgramUniform4f");
+	if(proc == NULL) return;
+	glad_glProgramUniform4f = proc;
+	proc(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORM4FVPROC proc = (PFNGLPROGRAMUNIFORM4FVPROC)glad_lazy_load("glProgramUniform4fv");
+	if(proc == NULL) return;
+	glad_glProgramUniform4fv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	PFNGLPROGRAMUNIFORM4DPROC proc = (PFNGLPROGRAMUNIFORM4DPROC)glad_lazy_load("glProgramUniform4d");
+	if(proc == NULL) return;
+	glad_glProgramUniform4d = proc;
+	proc(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORM4DVPROC proc = (PFNGLPROGRAMUNIFORM4DVPROC)glad_lazy_load("glProgramUniform4dv");
+	if(proc == NULL) return;
+	glad_glProgramUniform4dv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	PFNGLPROGRAMUNIFORM4UIPROC proc = (PFNGLPROGRAMUNIFORM4UIPROC)glad_lazy_load("glProgramUniform4ui");
+	if(proc == NULL) return;
+	glad_glProgramUniform4ui = proc;
+	proc(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	PFNGLPROGRAMUNIFORM4UIVPROC proc = (PFNGLPROGRAMUNIFORM4UIVPROC)glad_lazy_load("glProgramUniform4uiv");
+	if(proc == NULL) return;
+	glad_glProgramUniform4uiv = proc;
+	proc(program, location, count, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX2FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glad_lazy_load("glProgramUniformMatrix2fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix2fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX3FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glad_lazy_load("glProgramUniformMatrix3fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix3fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX4FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glad_lazy_load("glProgramUniformMatrix4fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix4fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX2DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glad_lazy_load("glProgramUniformMatrix2dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix2dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX3DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glad_lazy_load("glProgramUniformMatrix3dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix3dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX4DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glad_lazy_load("glProgramUniformMatrix4dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix4dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glad_lazy_load("glProgramUniformMatrix2x3fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix2x3fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glad_lazy_load("glProgramUniformMatrix3x2fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix3x2fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glad_lazy_load("glProgramUniformMatrix2x4fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix2x4fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glad_lazy_load("glProgramUniformMatrix4x2fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix4x2fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glad_lazy_load("glProgramUniformMatrix3x4fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix3x4fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glad_lazy_load("glProgramUniformMatrix4x3fv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix4x3fv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glad_lazy_load("glProgramUniformMatrix2x3dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix2x3dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glad_lazy_load("glProgramUniformMatrix3x2dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix3x2dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glad_lazy_load("glProgramUniformMatrix2x4dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix2x4dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glad_lazy_load("glProgramUniformMatrix4x2dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix4x2dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glad_lazy_load("glProgramUniformMatrix3x4dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix3x4dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC proc = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glad_lazy_load("glProgramUniformMatrix4x3dv");
+	if(proc == NULL) return;
+	glad_glProgramUniformMatrix4x3dv = proc;
+	proc(program, location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgramPipeline(GLuint pipeline) {
+	PFNGLVALIDATEPROGRAMPIPELINEPROC proc = (PFNGLVALIDATEPROGRAMPIPELINEPROC)glad_lazy_load("glValidateProgramPipeline");
+	if(proc == NULL) return;
+	glad_glValidateProgramPipeline = proc;
+	proc(pipeline);
+}
+static void APIENTRY glad_lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	PFNGLGETPROGRAMPIPELINEINFOLOGPROC proc = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glad_lazy_load("glGetProgramPipelineInfoLog");
+	if(proc == NULL) return;
+	glad_glGetProgramPipelineInfoLog = proc;
+	proc(pipeline, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1d(GLuint index, GLdouble x) {
+	PFNGLVERTEXATTRIBL1DPROC proc = (PFNGLVERTEXATTRIBL1DPROC)glad_lazy_load("glVertexAttribL1d");
+	if(proc == NULL) return;
+	glad_glVertexAttribL1d = proc;
+	proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	PFNGLVERTEXATTRIBL2DPROC proc = (PFNGLVERTEXATTRIBL2DPROC)glad_lazy_load("glVertexAttribL2d");
+	if(proc == NULL) return;
+	glad_glVertexAttribL2d = proc;
+	proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	PFNGLVERTEXATTRIBL3DPROC proc = (PFNGLVERTEXATTRIBL3DPROC)glad_lazy_load("glVertexAttribL3d");
+	if(proc == NULL) return;
+	glad_glVertexAttribL3d = proc;
+	proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	PFNGLVERTEXATTRIBL4DPROC proc = (PFNGLVERTEXATTRIBL4DPROC)glad_lazy_load("glVertexAttribL4d");
+	if(proc == NULL) return;
+	glad_glVertexAttribL4d = proc;
+	proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIBL1DVPROC proc = (PFNGLVERTEXATTRIBL1DVPROC)glad_lazy_load("glVertexAttribL1dv");
+	if(proc == NULL) return;
+	glad_glVertexAttribL1dv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIBL2DVPROC proc = (PFNGLVERTEXATTRIBL2DVPROC)glad_lazy_load("glVertexAttribL2dv");
+	if(proc == NULL) return;
+	glad_glVertexAttribL2dv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIBL3DVPROC proc = (PFNGLVERTEXATTRIBL3DVPROC)glad_lazy_load("glVertexAttribL3dv");
+	if(proc == NULL) return;
+	glad_glVertexAttribL3dv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	PFNGLVERTEXATTRIBL4DVPROC proc = (PFNGLVERTEXATTRIBL4DVPROC)glad_lazy_load("glVertexAttribL4dv");
+	if(proc == NULL) return;
+	glad_glVertexAttribL4dv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	PFNGLVERTEXATTRIBLPOINTERPROC proc = (PFNGLVERTEXATTRIBLPOINTERPROC)glad_lazy_load("glVertexAttribLPointer");
+	if(proc == NULL) return;
+	glad_glVertexAttribLPointer = proc;
+	proc(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+	PFNGLGETVERTEXATTRIBLDVPROC proc = (PFNGLGETVERTEXATTRIBLDVPROC)glad_lazy_load("glGetVertexAttribLdv");
+	if(proc == NULL) return;
+	glad_glGetVertexAttribLdv = proc;
+	proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	PFNGLVIEWPORTARRAYVPROC proc = (PFNGLVIEWPORTARRAYVPROC)glad_lazy_load("glViewportArrayv");
+	if(proc == NULL) return;
+	glad_glViewportArrayv = proc;
+	proc(first, count, v);
+}
+static void APIENTRY glad_lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	PFNGLVIEWPORTINDEXEDFPROC proc = (PFNGLVIEWPORTINDEXEDFPROC)glad_lazy_load("glViewportIndexedf");
+	if(proc == NULL) return;
+	glad_glViewportIndexedf = proc;
+	proc(index, x, y, w, h);
+}
+static void APIENTRY glad_lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	PFNGLVIEWPORTINDEXEDFVPROC proc = (PFNGLVIEWPORTINDEXEDFVPROC)glad_lazy_load("glViewportIndexedfv");
+	if(proc == NULL) return;
+	glad_glViewportIndexedfv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	PFNGLSCISSORARRAYVPROC proc = (PFNGLSCISSORARRAYVPROC)glad_lazy_load("glScissorArrayv");
+	if(proc == NULL) return;
+	glad_glScissorArrayv = proc;
+	proc(first, count, v);
+}
+static void APIENTRY glad_lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	PFNGLSCISSORINDEXEDPROC proc = (PFNGLSCISSORINDEXEDPROC)glad_lazy_load("glScissorIndexed");
+	if(proc == NULL) return;
+	glad_glScissorIndexed = proc;
+	proc(index, left, bottom, width, height);
+}
+static void APIENTRY glad_lazy_glScissorIndexedv(GLuint index, const GLint *v) {
+	PFNGLSCISSORINDEXEDVPROC proc = (PFNGLSCISSORINDEXEDVPROC)glad_lazy_load("glScissorIndexedv");
+	if(proc == NULL) return;
+	glad_glScissorIndexedv = proc;
+	proc(index, v);
+}
+static void APIENTRY glad_lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	PFNGLDEPTHRANGEARRAYVPROC proc = (PFNGLDEPTHRANGEARRAYVPROC)glad_lazy_load("glDepthRangeArrayv");
+	if(proc == NULL) return;
+	glad_glDepthRangeArrayv = proc;
+	proc(first, count, v);
+}
+static void APIENTRY glad_lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	PFNGLDEPTHRANGEINDEXEDPROC proc = (PFNGLDEPTHRANGEINDEXEDPROC)glad_lazy_load("glDepthRangeIndexed");
+	if(proc == NULL) return;
+	glad_glDepthRangeIndexed = proc;
+	proc(index, n, f);
+}
+static void APIENTRY glad_lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+	PFNGLGETFLOATI_VPROC proc = (PFNGLGETFLOATI_VPROC)glad_lazy_load("glGetFloati_v");
+	if(proc == NULL) return;
+	glad_glGetFloati_v = proc;
+	proc(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+	PFNGLGETDOUBLEI_VPROC proc = (PFNGLGETDOUBLEI_VPROC)glad_lazy_load("glGetDoublei_v");
+	if(proc == NULL) return;
+	glad_glGetDoublei_v = proc;
+	proc(target, index, data);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC proc = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_lazy_load("glDrawArraysInstancedBaseInstance");
+	if(proc == NULL) return;
+	glad_glDrawArraysInstancedBaseInstance = proc;
+	proc(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC proc = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_lazy_load("glDrawElementsInstancedBaseInstance");
+	if(proc == NULL) return;
+	glad_glDrawElementsInstancedBaseInstance = proc;
+	proc(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC proc = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_lazy_load("glDrawElementsInstancedBaseVertexBaseInstance");
+	if(proc == NULL) return;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = proc;
+	proc(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY glad_lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+	PFNGLGETINTERNALFORMATIVPROC proc = (PFNGLGETINTERNALFORMATIVPROC)glad_lazy_load("glGetInternalformativ");
+	if(proc == NULL) return;
+	glad_glGetInternalformativ = proc;
+	proc(target, internalformat, pname, count, params);
+}
+static void APIENTRY glad_lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+	PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC proc = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glad_lazy_load("glGetActiveAtomicCounterBufferiv");
+	if(proc == NULL) return;
+	glad_glGetActiveAtomicCounterBufferiv = proc;
+	proc(program, bufferIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	PFNGLBINDIMAGETEXTUREPROC proc = (PFNGLBINDIMAGETEXTUREPROC)glad_lazy_load("glBindImageTexture");
+	if(proc == NULL) return;
+	glad_glBindImageTexture = proc;
+	proc(unit, texture, level, layered, layer, access, format);
+}
+static void APIENTRY glad_lazy_glMemoryBarrier(GLbitfield barriers) {
+	PFNGLMEMORYBARRIERPROC proc = (PFNGLMEMORYBARRIERPROC)glad_lazy_load("glMemoryBarrier");
+	if(proc == NULL) return;
+	glad_glMemoryBarrier = proc;
+	proc(barriers);
+}
+static void APIENTRY glad_lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	PFNGLTEXSTORAGE1DPROC proc = (PFNGLTEXSTORAGE1DPROC)glad_lazy_load("glTexStorage1D");
+	if(proc == NULL) return;
+	glad_glTexStorage1D = proc;
+	proc(target, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLTEXSTORAGE2DPROC proc = (PFNGLTEXSTORAGE2DPROC)glad_lazy_load("glTexStorage2D");
+	if(proc == NULL) return;
+	glad_glTexStorage2D = proc;
+	proc(target, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	PFNGLTEXSTORAGE3DPROC proc = (PFNGLTEXSTORAGE3DPROC)glad_lazy_load("glTexStorage3D");
+	if(proc == NULL) return;
+	glad_glTexStorage3D = proc;
+	proc(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC proc = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glad_lazy_load("glDrawTransformFeedbackInstanced");
+	if(proc == NULL) return;
+	glad_glDrawTransformFeedbackInstanced = proc;
+	proc(mode, id, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC proc = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glad_lazy_load("glDrawTransformFeedbackStreamInstanced");
+	if(proc == NULL) return;
+	glad_glDrawTransformFeedbackStreamInstanced = proc;
+	proc(mode, id, stream, instancecount);
+}
+static void APIENTRY glad_lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	PFNGLCLEARBUFFERDATAPROC proc = (PFNGLCLEARBUFFERDATAPROC)glad_lazy_load("glClearBufferData");
+	if(proc == NULL) return;
+	glad_glClearBufferData = proc;
+	proc(target, internalformat, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	PFNGLCLEARBUFFERSUBDATAPROC proc = (PFNGLCLEARBUFFERSUBDATAPROC)glad_lazy_load("glClearBufferSubData");
+	if(proc == NULL) return;
+	glad_glClearBufferSubData = proc;
+	proc(target, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY glad_lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	PFNGLDISPATCHCOMPUTEPROC proc = (PFNGLDISPATCHCOMPUTEPROC)glad_lazy_load("glDispatchCompute");
+	if(proc == NULL) return;
+	glad_glDispatchCompute = proc;
+	proc(num_groups_x, num_groups_y, num_groups_z);
+}
+static void APIENTRY glad_lazy_glDispatchComputeIndirect(GLintptr indirect) {
+	PFNGLDISPATCHCOMPUTEINDIRECTPROC proc = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)glad_lazy_load("glDispatchComputeIndirect");
+	if(proc == NULL) return;
+	glad_glDispatchComputeIndirect = proc;
+	proc(indirect);
+}
+static void APIENTRY glad_lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	PFNGLCOPYIMAGESUBDATAPROC proc = (PFNGLCOPYIMAGESUBDATAPROC)glad_lazy_load("glCopyImageSubData");
+	if(proc == NULL) return;
+	glad_glCopyImageSubData = proc;
+	proc(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void APIENTRY glad_lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	PFNGLFRAMEBUFFERPARAMETERIPROC proc = (PFNGLFRAMEBUFFERPARAMETERIPROC)glad_lazy_load("glFramebufferParameteri");
+	if(proc == NULL) return;
+	glad_glFramebufferParameteri = proc;
+	proc(target, pname, param);
+}
+static void APIENTRY glad_lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	PFNGLGETFRAMEBUFFERPARAMETERIVPROC proc = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glad_lazy_load("glGetFramebufferParameteriv");
+	if(proc == NULL) return;
+	glad_glGetFramebufferParameteriv = proc;
+	proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+	PFNGLGETINTERNALFORMATI64VPROC proc = (PFNGLGETINTERNALFORMATI64VPROC)glad_lazy_load("glGetInternalformati64v");
+	if(proc == NULL) return;
+	glad_glGetInternalformati64v = proc;
+	proc(target, internalformat, pname, count, params);
+}
+static void APIENTRY glad_lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	PFNGLINVALIDATETEXSUBIMAGEPROC proc = (PFNGLINVALIDATETEXSUBIMAGEPROC)glad_lazy_load("glInvalidateTexSubImage");
+	if(proc == NULL) return;
+	glad_glInvalidateTexSubImage = proc;
+	proc(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static void APIENTRY glad_lazy_glInvalidateTexImage(GLuint texture, GLint level) {
+	PFNGLINVALIDATETEXIMAGEPROC proc = (PFNGLINVALIDATETEXIMAGEPROC)glad_lazy_load("glInvalidateTexImage");
+	if(proc == NULL) return;
+	glad_glInvalidateTexImage = proc;
+	proc(texture, level);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	PFNGLINVALIDATEBUFFERSUBDATAPROC proc = (PFNGLINVALIDATEBUFFERSUBDATAPROC)glad_lazy_load("glInvalidateBufferSubData");
+	if(proc == NULL) return;
+	glad_glInvalidateBufferSubData = proc;
+	proc(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glInvalidateBufferData(GLuint buffer) {
+	PFNGLINVALIDATEBUFFERDATAPROC proc = (PFNGLINVALIDATEBUFFERDATAPROC)glad_lazy_load("glInvalidateBufferData");
+	if(proc == NULL) return;
+	glad_glInvalidateBufferData = proc;
+	proc(buffer);
+}
+static void APIENTRY glad_lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	PFNGLINVALIDATEFRAMEBUFFERPROC proc = (PFNGLINVALIDATEFRAMEBUFFERPROC)glad_lazy_load("glInvalidateFramebuffer");
+	if(proc == NULL) return;
+	glad_glInvalidateFramebuffer = proc;
+	proc(target, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLINVALIDATESUBFRAMEBUFFERPROC proc = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)glad_lazy_load("glInvalidateSubFramebuffer");
+	if(proc == NULL) return;
+	glad_glInvalidateSubFramebuffer = proc;
+	proc(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	PFNGLMULTIDRAWARRAYSINDIRECTPROC proc = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_lazy_load("glMultiDrawArraysIndirect");
+	if(proc == NULL) return;
+	glad_glMultiDrawArraysIndirect = proc;
+	proc(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	PFNGLMULTIDRAWELEMENTSINDIRECTPROC proc = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_lazy_load("glMultiDrawElementsIndirect");
+	if(proc == NULL) return;
+	glad_glMultiDrawElementsIndirect = proc;
+	proc(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+	PFNGLGETPROGRAMINTERFACEIVPROC proc = (PFNGLGETPROGRAMINTERFACEIVPROC)glad_lazy_load("glGetProgramInterfaceiv");
+	if(proc == NULL) return;
+	glad_glGetProgramInterfaceiv = proc;
+	proc(program, programInterface, pname, params);
+}
+static GLuint APIENTRY glad_lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	PFNGLGETPROGRAMRESOURCEINDEXPROC proc = (PFNGLGETPROGRAMRESOURCEINDEXPROC)glad_lazy_load("glGetProgramResourceIndex");
+	if(proc == NULL) return 0;
+	glad_glGetProgramResourceIndex = proc;
+	return proc(program, programInterface, name);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	PFNGLGETPROGRAMRESOURCENAMEPROC proc = (PFNGLGETPROGRAMRESOURCENAMEPROC)glad_lazy_load("glGetProgramResourceName");
+	if(proc == NULL) return;
+	glad_glGetProgramResourceName = proc;
+	proc(program, programInterface, index, bufSize, length, name);
+}
+static void APIENTRY glad_lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+	PFNGLGETPROGRAMRESOURCEIVPROC proc = (PFNGLGETPROGRAMRESOURCEIVPROC)glad_lazy_load("glGetProgramResourceiv");
+	if(proc == NULL) return;
+	glad_glGetProgramResourceiv = proc;
+	proc(program, programInterface, index, propCount, props, count, length, params);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+	PFNGLGETPROGRAMRESOURCELOCATIONPROC proc = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)glad_lazy_load("glGetProgramResourceLocation");
+	if(proc == NULL) return 0;
+	glad_glGetProgramResourceLocation = proc;
+	return proc(program, programInterface, name);
+}
+static GLint APIENTRY glad_lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC proc = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glad_lazy_load("glGetProgramResourceLocationIndex");
+	if(proc == NULL) return 0;
+	glad_glGetProgramResourceLocationIndex = proc;
+	return proc(program, programInterface, name);
+}
+static void APIENTRY glad_lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	PFNGLSHADERSTORAGEBLOCKBINDINGPROC proc = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glad_lazy_load("glShaderStorageBlockBinding");
+	if(proc == NULL) return;
+	glad_glShaderStorageBlockBinding = proc;
+	proc(program, storageBlockIndex, storageBlockBinding);
+}
+static void APIENTRY glad_lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	PFNGLTEXBUFFERRANGEPROC proc = (PFNGLTEXBUFFERRANGEPROC)glad_lazy_load("glTexBufferRange");
+	if(proc == NULL) return;
+	glad_glTexBufferRange = proc;
+	proc(target, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	PFNGLTEXSTORAGE2DMULTISAMPLEPROC proc = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glad_lazy_load("glTexStorage2DMultisample");
+	if(proc == NULL) return;
+	glad_glTexStorage2DMultisample = proc;
+	proc(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	PFNGLTEXSTORAGE3DMULTISAMPLEPROC proc = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glad_lazy_load("glTexStorage3DMultisample");
+	if(proc == NULL) return;
+	glad_glTexStorage3DMultisample = proc;
+	proc(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	PFNGLTEXTUREVIEWPROC proc = (PFNGLTEXTUREVIEWPROC)glad_lazy_load("glTextureView");
+	if(proc == NULL) return;
+	glad_glTextureView = proc;
+	proc(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	PFNGLBINDVERTEXBUFFERPROC proc = (PFNGLBINDVERTEXBUFFERPROC)glad_lazy_load("glBindVertexBuffer");
+	if(proc == NULL) return;
+	glad_glBindVertexBuffer = proc;
+	proc(bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	PFNGLVERTEXATTRIBFORMATPROC proc = (PFNGLVERTEXATTRIBFORMATPROC)glad_lazy_load("glVertexAttribFormat");
+	if(proc == NULL) return;
+	glad_glVertexAttribFormat = proc;
+	proc(attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	PFNGLVERTEXATTRIBIFORMATPROC proc = (PFNGLVERTEXATTRIBIFORMATPROC)glad_lazy_load("glVertexAttribIFormat");
+	if(proc == NULL) return;
+	glad_glVertexAttribIFormat = proc;
+	proc(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	PFNGLVERTEXATTRIBLFORMATPROC proc = (PFNGLVERTEXATTRIBLFORMATPROC)glad_lazy_load("glVertexAttribLFormat");
+	if(proc == NULL) return;
+	glad_glVertexAttribLFormat = proc;
+	proc(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	PFNGLVERTEXATTRIBBINDINGPROC proc = (PFNGLVERTEXATTRIBBINDINGPROC)glad_lazy_load("glVertexAttribBinding");
+	if(proc == NULL) return;
+	glad_glVertexAttribBinding = proc;
+	proc(attribindex, bindingindex);
+}
+static void APIENTRY glad_lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	PFNGLVERTEXBINDINGDIVISORPROC proc = (PFNGLVERTEXBINDINGDIVISORPROC)glad_lazy_load("glVertexBindingDivisor");
+	if(proc == NULL) return;
+	glad_glVertexBindingDivisor = proc;
+	proc(bindingindex, divisor);
+}
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	PFNGLDEBUGMESSAGECONTROLPROC proc = (PFNGLDEBUGMESSAGECONTROLPROC)glad_lazy_load("glDebugMessageControl");
+	if(proc == NULL) return;
+	glad_glDebugMessageControl = proc;
+	proc(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	PFNGLDEBUGMESSAGEINSERTPROC proc = (PFNGLDEBUGMESSAGEINSERTPROC)glad_lazy_load("glDebugMessageInsert");
+	if(proc == NULL) return;
+	glad_glDebugMessageInsert = proc;
+	proc(source, type, id, severity, length, buf);
+}
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	PFNGLDEBUGMESSAGECALLBACKPROC proc = (PFNGLDEBUGMESSAGECALLBACKPROC)glad_lazy_load("glDebugMessageCallback");
+	if(proc == NULL) return;
+	glad_glDebugMessageCallback = proc;
+	proc(callback, userParam);
+}
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	PFNGLGETDEBUGMESSAGELOGPROC proc = (PFNGLGETDEBUGMESSAGELOGPROC)glad_lazy_load("glGetDebugMessageLog");
+	if(proc == NULL) return 0;
+	glad_glGetDebugMessageLog = proc;
+	return proc(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	PFNGLPUSHDEBUGGROUPPROC proc = (PFNGLPUSHDEBUGGROUPPROC)glad_lazy_load("glPushDebugGroup");
+	if(proc == NULL) return;
+	glad_glPushDebugGroup = proc;
+	proc(source, id, length, message);
+}
+static void APIENTRY glad_lazy_glPopDebugGroup(void) {
+	PFNGLPOPDEBUGGROUPPROC proc = (PFNGLPOPDEBUGGROUPPROC)glad_lazy_load("glPopDebugGroup");
+	if(proc == NULL) return;
+	glad_glPopDebugGroup = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	PFNGLOBJECTLABELPROC proc = (PFNGLOBJECTLABELPROC)glad_lazy_load("glObjectLabel");
+	if(proc == NULL) return;
+	glad_glObjectLabel = proc;
+	proc(identifier, name, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	PFNGLGETOBJECTLABELPROC proc = (PFNGLGETOBJECTLABELPROC)glad_lazy_load("glGetObjectLabel");
+	if(proc == NULL) return;
+	glad_glGetObjectLabel = proc;
+	proc(identifier, name, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	PFNGLOBJECTPTRLABELPROC proc = (PFNGLOBJECTPTRLABELPROC)glad_lazy_load("glObjectPtrLabel");
+	if(proc == NULL) return;
+	glad_glObjectPtrLabel = proc;
+	proc(ptr, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	PFNGLGETOBJECTPTRLABELPROC proc = (PFNGLGETOBJECTPTRLABELPROC)glad_lazy_load("glGetObjectPtrLabel");
+	if(proc == NULL) return;
+	glad_glGetObjectPtrLabel = proc;
+	proc(ptr, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) {
+	PFNGLGETPOINTERVPROC proc = (PFNGLGETPOINTERVPROC)glad_lazy_load("glGetPointerv");
+	if(proc == NULL) return;
+	glad_glGetPointerv = proc;
+	proc(pname, params);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	PFNGLBUFFERSTORAGEPROC proc = (PFNGLBUFFERSTORAGEPROC)glad_lazy_load("glBufferStorage");
+	if(proc == NULL) return;
+	glad_glBufferStorage = proc;
+	proc(target, size, data, flags);
+}
+static void APIENTRY glad_lazy_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	PFNGLCLEARTEXIMAGEPROC proc = (PFNGLCLEARTEXIMAGEPROC)glad_lazy_load("glClearTexImage");
+	if(proc == NULL) return;
+	glad_glClearTexImage = proc;
+	proc(texture, level, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	PFNGLCLEARTEXSUBIMAGEPROC proc = (PFNGLCLEARTEXSUBIMAGEPROC)glad_lazy_load("glClearTexSubImage");
+	if(proc == NULL) return;
+	glad_glClearTexSubImage = proc;
+	proc(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+static void APIENTRY glad_lazy_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	PFNGLBINDBUFFERSBASEPROC proc = (PFNGLBINDBUFFERSBASEPROC)glad_lazy_load("glBindBuffersBase");
+	if(proc == NULL) return;
+	glad_glBindBuffersBase = proc;
+	proc(target, first, count, buffers);
+}
+static void APIENTRY glad_lazy_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	PFNGLBINDBUFFERSRANGEPROC proc = (PFNGLBINDBUFFERSRANGEPROC)glad_lazy_load("glBindBuffersRange");
+	if(proc == NULL) return;
+	glad_glBindBuffersRange = proc;
+	proc(target, first, count, buffers, offsets, sizes);
+}
+static void APIENTRY glad_lazy_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	PFNGLBINDTEXTURESPROC proc = (PFNGLBINDTEXTURESPROC)glad_lazy_load("glBindTextures");
+	if(proc == NULL) return;
+	glad_glBindTextures = proc;
+	proc(first, count, textures);
+}
+static void APIENTRY glad_lazy_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	PFNGLBINDSAMPLERSPROC proc = (PFNGLBINDSAMPLERSPROC)glad_lazy_load("glBindSamplers");
+	if(proc == NULL) return;
+	glad_glBindSamplers = proc;
+	proc(first, count, samplers);
+}
+static void APIENTRY glad_lazy_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	PFNGLBINDIMAGETEXTURESPROC proc = (PFNGLBINDIMAGETEXTURESPROC)glad_lazy_load("glBindImageTextures");
+	if(proc == NULL) return;
+	glad_glBindImageTextures = proc;
+	proc(first, count, textures);
+}
+static void APIENTRY glad_lazy_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	PFNGLBINDVERTEXBUFFERSPROC proc = (PFNGLBINDVERTEXBUFFERSPROC)glad_lazy_load("glBindVertexBuffers");
+	if(proc == NULL) return;
+	glad_glBindVertexBuffers = proc;
+	proc(first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_lazy_glClipControl(GLenum origin, GLenum depth) {
+	PFNGLCLIPCONTROLPROC proc = (PFNGLCLIPCONTROLPROC)glad_lazy_load("glClipControl");
+	if(proc == NULL) return;
+	glad_glClipControl = proc;
+	proc(origin, depth);
+}
+static void APIENTRY glad_lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	PFNGLCREATETRANSFORMFEEDBACKSPROC proc = (PFNGLCREATETRANSFORMFEEDBACKSPROC)glad_lazy_load("glCreateTransformFeedbacks");
+	if(proc == NULL) return;
+	glad_glCreateTransformFeedbacks = proc;
+	proc(n, ids);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC proc = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glad_lazy_load("glTransformFeedbackBufferBase");
+	if(proc == NULL) return;
+	glad_glTransformFeedbackBufferBase = proc;
+	proc(xfb, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC proc = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glad_lazy_load("glTransformFeedbackBufferRange");
+	if(proc == NULL) return;
+	glad_glTransformFeedbackBufferRange = proc;
+	proc(xfb, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	PFNGLGETTRANSFORMFEEDBACKIVPROC proc = (PFNGLGETTRANSFORMFEEDBACKIVPROC)glad_lazy_load("glGetTransformFeedbackiv");
+	if(proc == NULL) return;
+	glad_glGetTransformFeedbackiv = proc;
+	proc(xfb, pname, param);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+	PFNGLGETTRANSFORMFEEDBACKI_VPROC proc = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)glad_lazy_load("glGetTransformFeedbacki_v");
+	if(proc == NULL) return;
+	glad_glGetTransformFeedbacki_v = proc;
+	proc(xfb, pname, index, param);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+	PFNGLGETTRANSFORMFEEDBACKI64_VPROC proc = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)glad_lazy_load("glGetTransformFeedbacki64_v");
+	if(proc == NULL) return;
+	glad_glGetTransformFeedbacki64_v = proc;
+	proc(xfb, pname, index, param);
+}
+static void APIENTRY glad_lazy_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	PFNGLCREATEBUFFERSPROC proc = (PFNGLCREATEBUFFERSPROC)glad_lazy_load("glCreateBuffers");
+	if(proc == NULL) return;
+	glad_glCreateBuffers = proc;
+	proc(n, buffers);
+}
+static void APIENTRY glad_lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	PFNGLNAMEDBUFFERSTORAGEPROC proc = (PFNGLNAMEDBUFFERSTORAGEPROC)glad_lazy_load("glNamedBufferStorage");
+	if(proc == NULL) return;
+	glad_glNamedBufferStorage = proc;
+	proc(buffer, size, data, flags);
+}
+static void APIENTRY glad_lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	PFNGLNAMEDBUFFERDATAPROC proc = (PFNGLNAMEDBUFFERDATAPROC)glad_lazy_load("glNamedBufferData");
+	if(proc == NULL) return;
+	glad_glNamedBufferData = proc;
+	proc(buffer, size, data, usage);
+}
+static void APIENTRY glad_lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	PFNGLNAMEDBUFFERSUBDATAPROC proc = (PFNGLNAMEDBUFFERSUBDATAPROC)glad_lazy_load("glNamedBufferSubData");
+	if(proc == NULL) return;
+	glad_glNamedBufferSubData = proc;
+	proc(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	PFNGLCOPYNAMEDBUFFERSUBDATAPROC proc = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glad_lazy_load("glCopyNamedBufferSubData");
+	if(proc == NULL) return;
+	glad_glCopyNamedBufferSubData = proc;
+	proc(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	PFNGLCLEARNAMEDBUFFERDATAPROC proc = (PFNGLCLEARNAMEDBUFFERDATAPROC)glad_lazy_load("glClearNamedBufferData");
+	if(proc == NULL) return;
+	glad_glClearNamedBufferData = proc;
+	proc(buffer, internalformat, format, type, data);
+}
+static void APIENTRY glad_lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	PFNGLCLEARNAMEDBUFFERSUBDATAPROC proc = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glad_lazy_load("glClearNamedBufferSubData");
+	if(proc == NULL) return;
+	glad_glClearNamedBufferSubData = proc;
+	proc(buffer, internalformat, offset, size, format, type, data);
+}
+static void * APIENTRY glad_lazy_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	PFNGLMAPNAMEDBUFFERPROC proc = (PFNGLMAPNAMEDBUFFERPROC)glad_lazy_load("glMapNamedBuffer");
+	if(proc == NULL) return 0;
+	glad_glMapNamedBuffer = proc;
+	return proc(buffer, access);
+}
+static void * APIENTRY glad_lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	PFNGLMAPNAMEDBUFFERRANGEPROC proc = (PFNGLMAPNAMEDBUFFERRANGEPROC)glad_lazy_load("glMapNamedBufferRange");
+	if(proc == NULL) return 0;
+	glad_glMapNamedBufferRange = proc;
+	return proc(buffer, offset, length, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapNamedBuffer(GLuint buffer) {
+	PFNGLUNMAPNAMEDBUFFERPROC proc = (PFNGLUNMAPNAMEDBUFFERPROC)glad_lazy_load("glUnmapNamedBuffer");
+	if(proc == NULL) return 0;
+	glad_glUnmapNamedBuffer = proc;
+	return proc(buffer);
+}
+static void APIENTRY glad_lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC proc = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glad_lazy_load("glFlushMappedNamedBufferRange");
+	if(proc == NULL) return;
+	glad_glFlushMappedNamedBufferRange = proc;
+	proc(buffer, offset, length);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	PFNGLGETNAMEDBUFFERPARAMETERIVPROC proc = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glad_lazy_load("glGetNamedBufferParameteriv");
+	if(proc == NULL) return;
+	glad_glGetNamedBufferParameteriv = proc;
+	proc(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	PFNGLGETNAMEDBUFFERPARAMETERI64VPROC proc = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glad_lazy_load("glGetNamedBufferParameteri64v");
+	if(proc == NULL) return;
+	glad_glGetNamedBufferParameteri64v = proc;
+	proc(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	PFNGLGETNAMEDBUFFERPOINTERVPROC proc = (PFNGLGETNAMEDBUFFERPOINTERVPROC)glad_lazy_load("glGetNamedBufferPointerv");
+	if(proc == NULL) return;
+	glad_glGetNamedBufferPointerv = proc;
+	proc(buffer, pname, params);
+}
+static void APIENTRY glad_lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	PFNGLGETNAMEDBUFFERSUBDATAPROC proc = (PFNGLGETNAMEDBUFFERSUBDATAPROC)glad_lazy_load("glGetNamedBufferSubData");
+	if(proc == NULL) return;
+	glad_glGetNamedBufferSubData = proc;
+	proc(buffer, offset, size, data);
+}
+static void APIENTRY glad_lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	PFNGLCREATEFRAMEBUFFERSPROC proc = (PFNGLCREATEFRAMEBUFFERSPROC)glad_lazy_load("glCreateFramebuffers");
+	if(proc == NULL) return;
+	glad_glCreateFramebuffers = proc;
+	proc(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC proc = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_load("glNamedFramebufferRenderbuffer");
+	if(proc == NULL) return;
+	glad_glNamedFramebufferRenderbuffer = proc;
+	proc(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC proc = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glad_lazy_load("glNamedFramebufferParameteri");
+	if(proc == NULL) return;
+	glad_glNamedFramebufferParameteri = proc;
+	proc(framebuffer, pname, param);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	PFNGLNAMEDFRAMEBUFFERTEXTUREPROC proc = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glad_lazy_load("glNamedFramebufferTexture");
+	if(proc == NULL) return;
+	glad_glNamedFramebufferTexture = proc;
+	proc(framebuffer, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC proc = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_load("glNamedFramebufferTextureLayer");
+	if(proc == NULL) return;
+	glad_glNamedFramebufferTextureLayer = proc;
+	proc(framebuffer, attachment, texture, level, layer);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC proc = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glad_lazy_load("glNamedFramebufferDrawBuffer");
+	if(proc == NULL) return;
+	glad_glNamedFramebufferDrawBuffer = proc;
+	proc(framebuffer, buf);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC proc = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glad_lazy_load("glNamedFramebufferDrawBuffers");
+	if(proc == NULL) return;
+	glad_glNamedFramebufferDrawBuffers = proc;
+	proc(framebuffer, n, bufs);
+}
+static void APIENTRY glad_lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC proc = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glad_lazy_load("glNamedFramebufferReadBuffer");
+	if(proc == NULL) return;
+	glad_glNamedFramebufferReadBuffer = proc;
+	proc(framebuffer, src);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC proc = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glad_lazy_load("glInvalidateNamedFramebufferData");
+	if(proc == NULL) return;
+	glad_glInvalidateNamedFramebufferData = proc;
+	proc(framebuffer, numAttachments, attachments);
+}
+static void APIENTRY glad_lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC proc = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glad_lazy_load("glInvalidateNamedFramebufferSubData");
+	if(proc == NULL) return;
+	glad_glInvalidateNamedFramebufferSubData = proc;
+	proc(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	PFNGLCLEARNAMEDFRAMEBUFFERIVPROC proc = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glad_lazy_load("glClearNamedFramebufferiv");
+	if(proc == NULL) return;
+	glad_glClearNamedFramebufferiv = proc;
+	proc(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC proc = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glad_lazy_load("glClearNamedFramebufferuiv");
+	if(proc == NULL) return;
+	glad_glClearNamedFramebufferuiv = proc;
+	proc(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	PFNGLCLEARNAMEDFRAMEBUFFERFVPROC proc = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glad_lazy_load("glClearNamedFramebufferfv");
+	if(proc == NULL) return;
+	glad_glClearNamedFramebufferfv = proc;
+	proc(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	PFNGLCLEARNAMEDFRAMEBUFFERFIPROC proc = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glad_lazy_load("glClearNamedFramebufferfi");
+	if(proc == NULL) return;
+	glad_glClearNamedFramebufferfi = proc;
+	proc(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY glad_lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	PFNGLBLITNAMEDFRAMEBUFFERPROC proc = (PFNGLBLITNAMEDFRAMEBUFFERPROC)glad_lazy_load("glBlitNamedFramebuffer");
+	if(proc == NULL) return;
+	glad_glBlitNamedFramebuffer = proc;
+	proc(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static GLenum APIENTRY glad_lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC proc = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glad_lazy_load("glCheckNamedFramebufferStatus");
+	if(proc == NULL) return 0;
+	glad_glCheckNamedFramebufferStatus = proc;
+	return proc(framebuffer, target);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC proc = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glad_lazy_load("glGetNamedFramebufferParameteriv");
+	if(proc == NULL) return;
+	glad_glGetNamedFramebufferParameteriv = proc;
+	proc(framebuffer, pname, param);
+}
+static void APIENTRY glad_lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC proc = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_load("glGetNamedFramebufferAttachmentParameteriv");
+	if(proc == NULL) return;
+	glad_glGetNamedFramebufferAttachmentParameteriv = proc;
+	proc(framebuffer, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	PFNGLCREATERENDERBUFFERSPROC proc = (PFNGLCREATERENDERBUFFERSPROC)glad_lazy_load("glCreateRenderbuffers");
+	if(proc == NULL) return;
+	glad_glCreateRenderbuffers = proc;
+	proc(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLNAMEDRENDERBUFFERSTORAGEPROC proc = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glad_lazy_load("glNamedRenderbufferStorage");
+	if(proc == NULL) return;
+	glad_glNamedRenderbufferStorage = proc;
+	proc(renderbuffer, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC proc = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_load("glNamedRenderbufferStorageMultisample");
+	if(proc == NULL) return;
+	glad_glNamedRenderbufferStorageMultisample = proc;
+	proc(renderbuffer, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC proc = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glad_lazy_load("glGetNamedRenderbufferParameteriv");
+	if(proc == NULL) return;
+	glad_glGetNamedRenderbufferParameteriv = proc;
+	proc(renderbuffer, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	PFNGLCREATETEXTURESPROC proc = (PFNGLCREATETEXTURESPROC)glad_lazy_load("glCreateTextures");
+	if(proc == NULL) return;
+	glad_glCreateTextures = proc;
+	proc(target, n, textures);
+}
+static void APIENTRY glad_lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	PFNGLTEXTUREBUFFERPROC proc = (PFNGLTEXTUREBUFFERPROC)glad_lazy_load("glTextureBuffer");
+	if(proc == NULL) return;
+	glad_glTextureBuffer = proc;
+	proc(texture, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	PFNGLTEXTUREBUFFERRANGEPROC proc = (PFNGLTEXTUREBUFFERRANGEPROC)glad_lazy_load("glTextureBufferRange");
+	if(proc == NULL) return;
+	glad_glTextureBufferRange = proc;
+	proc(texture, internalformat, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	PFNGLTEXTURESTORAGE1DPROC proc = (PFNGLTEXTURESTORAGE1DPROC)glad_lazy_load("glTextureStorage1D");
+	if(proc == NULL) return;
+	glad_glTextureStorage1D = proc;
+	proc(texture, levels, internalformat, width);
+}
+static void APIENTRY glad_lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	PFNGLTEXTURESTORAGE2DPROC proc = (PFNGLTEXTURESTORAGE2DPROC)glad_lazy_load("glTextureStorage2D");
+	if(proc == NULL) return;
+	glad_glTextureStorage2D = proc;
+	proc(texture, levels, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	PFNGLTEXTURESTORAGE3DPROC proc = (PFNGLTEXTURESTORAGE3DPROC)glad_lazy_load("glTextureStorage3D");
+	if(proc == NULL) return;
+	glad_glTextureStorage3D = proc;
+	proc(texture, levels, internalformat, width, height, depth);
+}
+static void APIENTRY glad_lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC proc = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glad_lazy_load("glTextureStorage2DMultisample");
+	if(proc == NULL) return;
+	glad_glTextureStorage2DMultisample = proc;
+	proc(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC proc = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glad_lazy_load("glTextureStorage3DMultisample");
+	if(proc == NULL) return;
+	glad_glTextureStorage3DMultisample = proc;
+	proc(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXTURESUBIMAGE1DPROC proc = (PFNGLTEXTURESUBIMAGE1DPROC)glad_lazy_load("glTextureSubImage1D");
+	if(proc == NULL) return;
+	glad_glTextureSubImage1D = proc;
+	proc(texture, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXTURESUBIMAGE2DPROC proc = (PFNGLTEXTURESUBIMAGE2DPROC)glad_lazy_load("glTextureSubImage2D");
+	if(proc == NULL) return;
+	glad_glTextureSubImage2D = proc;
+	proc(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	PFNGLTEXTURESUBIMAGE3DPROC proc = (PFNGLTEXTURESUBIMAGE3DPROC)glad_lazy_load("glTextureSubImage3D");
+	if(proc == NULL) return;
+	glad_glTextureSubImage3D = proc;
+	proc(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC proc = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glad_lazy_load("glCompressedTextureSubImage1D");
+	if(proc == NULL) return;
+	glad_glCompressedTextureSubImage1D = proc;
+	proc(texture, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC proc = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glad_lazy_load("glCompressedTextureSubImage2D");
+	if(proc == NULL) return;
+	glad_glCompressedTextureSubImage2D = proc;
+	proc(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC proc = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glad_lazy_load("glCompressedTextureSubImage3D");
+	if(proc == NULL) return;
+	glad_glCompressedTextureSubImage3D = proc;
+	proc(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	PFNGLCOPYTEXTURESUBIMAGE1DPROC proc = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)glad_lazy_load("glCopyTextureSubImage1D");
+	if(proc == NULL) return;
+	glad_glCopyTextureSubImage1D = proc;
+	proc(texture, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLCOPYTEXTURESUBIMAGE2DPROC proc = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)glad_lazy_load("glCopyTextureSubImage2D");
+	if(proc == NULL) return;
+	glad_glCopyTextureSubImage2D = proc;
+	proc(texture, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	PFNGLCOPYTEXTURESUBIMAGE3DPROC proc = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)glad_lazy_load("glCopyTextureSubImage3D");
+	if(proc == NULL) return;
+	glad_glCopyTextureSubImage3D = proc;
+	proc(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	PFNGLTEXTUREPARAMETERFPROC proc = (PFNGLTEXTUREPARAMETERFPROC)glad_lazy_load("glTextureParameterf");
+	if(proc == NULL) return;
+	glad_glTextureParameterf = proc;
+	proc(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	PFNGLTEXTUREPARAMETERFVPROC proc = (PFNGLTEXTUREPARAMETERFVPROC)glad_lazy_load("glTextureParameterfv");
+	if(proc == NULL) return;
+	glad_glTextureParameterfv = proc;
+	proc(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	PFNGLTEXTUREPARAMETERIPROC proc = (PFNGLTEXTUREPARAMETERIPROC)glad_lazy_load("glTextureParameteri");
+	if(proc == NULL) return;
+	glad_glTextureParameteri = proc;
+	proc(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	PFNGLTEXTUREPARAMETERIIVPROC proc = (PFNGLTEXTUREPARAMETERIIVPROC)glad_lazy_load("glTextureParameterIiv");
+	if(proc == NULL) return;
+	glad_glTextureParameterIiv = proc;
+	proc(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	PFNGLTEXTUREPARAMETERIUIVPROC proc = (PFNGLTEXTUREPARAMETERIUIVPROC)glad_lazy_load("glTextureParameterIuiv");
+	if(proc == NULL) return;
+	glad_glTextureParameterIuiv = proc;
+	proc(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	PFNGLTEXTUREPARAMETERIVPROC proc = (PFNGLTEXTUREPARAMETERIVPROC)glad_lazy_load("glTextureParameteriv");
+	if(proc == NULL) return;
+	glad_glTextureParameteriv = proc;
+	proc(texture, pname, param);
+}
+static void APIENTRY glad_lazy_glGenerateTextureMipmap(GLuint texture) {
+	PFNGLGENERATETEXTUREMIPMAPPROC proc = (PFNGLGENERATETEXTUREMIPMAPPROC)glad_lazy_load("glGenerateTextureMipmap");
+	if(proc == NULL) return;
+	glad_glGenerateTextureMipmap = proc;
+	proc(texture);
+}
+static void APIENTRY glad_lazy_glBindTextureUnit(GLuint unit, GLuint texture) {
+	PFNGLBINDTEXTUREUNITPROC proc = (PFNGLBINDTEXTUREUNITPROC)glad_lazy_load("glBindTextureUnit");
+	if(proc == NULL) return;
+	glad_glBindTextureUnit = proc;
+	proc(unit, texture);
+}
+static void APIENTRY glad_lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	PFNGLGETTEXTUREIMAGEPROC proc = (PFNGLGETTEXTUREIMAGEPROC)glad_lazy_load("glGetTextureImage");
+	if(proc == NULL) return;
+	glad_glGetTextureImage = proc;
+	proc(texture, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC proc = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glad_lazy_load("glGetCompressedTextureImage");
+	if(proc == NULL) return;
+	glad_glGetCompressedTextureImage = proc;
+	proc(texture, level, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	PFNGLGETTEXTURELEVELPARAMETERFVPROC proc = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)glad_lazy_load("glGetTextureLevelParameterfv");
+	if(proc == NULL) return;
+	glad_glGetTextureLevelParameterfv = proc;
+	proc(texture, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	PFNGLGETTEXTURELEVELPARAMETERIVPROC proc = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)glad_lazy_load("glGetTextureLevelParameteriv");
+	if(proc == NULL) return;
+	glad_glGetTextureLevelParameteriv = proc;
+	proc(texture, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	PFNGLGETTEXTUREPARAMETERFVPROC proc = (PFNGLGETTEXTUREPARAMETERFVPROC)glad_lazy_load("glGetTextureParameterfv");
+	if(proc == NULL) return;
+	glad_glGetTextureParameterfv = proc;
+	proc(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	PFNGLGETTEXTUREPARAMETERIIVPROC proc = (PFNGLGETTEXTUREPARAMETERIIVPROC)glad_lazy_load("glGetTextureParameterIiv");
+	if(proc == NULL) return;
+	glad_glGetTextureParameterIiv = proc;
+	proc(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	PFNGLGETTEXTUREPARAMETERIUIVPROC proc = (PFNGLGETTEXTUREPARAMETERIUIVPROC)glad_lazy_load("glGetTextureParameterIuiv");
+	if(proc == NULL) return;
+	glad_glGetTextureParameterIuiv = proc;
+	proc(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	PFNGLGETTEXTUREPARAMETERIVPROC proc = (PFNGLGETTEXTUREPARAMETERIVPROC)glad_lazy_load("glGetTextureParameteriv");
+	if(proc == NULL) return;
+	glad_glGetTextureParameteriv = proc;
+	proc(texture, pname, params);
+}
+static void APIENTRY glad_lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	PFNGLCREATEVERTEXARRAYSPROC proc = (PFNGLCREATEVERTEXARRAYSPROC)glad_lazy_load("glCreateVertexArrays");
+	if(proc == NULL) return;
+	glad_glCreateVertexArrays = proc;
+	proc(n, arrays);
+}
+static void APIENTRY glad_lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	PFNGLDISABLEVERTEXARRAYATTRIBPROC proc = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)glad_lazy_load("glDisableVertexArrayAttrib");
+	if(proc == NULL) return;
+	glad_glDisableVertexArrayAttrib = proc;
+	proc(vaobj, index);
+}
+static void APIENTRY glad_lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	PFNGLENABLEVERTEXARRAYATTRIBPROC proc = (PFNGLENABLEVERTEXARRAYATTRIBPROC)glad_lazy_load("glEnableVertexArrayAttrib");
+	if(proc == NULL) return;
+	glad_glEnableVertexArrayAttrib = proc;
+	proc(vaobj, index);
+}
+static void APIENTRY glad_lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	PFNGLVERTEXARRAYELEMENTBUFFERPROC proc = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)glad_lazy_load("glVertexArrayElementBuffer");
+	if(proc == NULL) return;
+	glad_glVertexArrayElementBuffer = proc;
+	proc(vaobj, buffer);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	PFNGLVERTEXARRAYVERTEXBUFFERPROC proc = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)glad_lazy_load("glVertexArrayVertexBuffer");
+	if(proc == NULL) return;
+	glad_glVertexArrayVertexBuffer = proc;
+	proc(vaobj, bindingindex, buffer, offset, stride);
+}
+static void APIENTRY glad_lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	PFNGLVERTEXARRAYVERTEXBUFFERSPROC proc = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glad_lazy_load("glVertexArrayVertexBuffers");
+	if(proc == NULL) return;
+	glad_glVertexArrayVertexBuffers = proc;
+	proc(vaobj, first, count, buffers, offsets, strides);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	PFNGLVERTEXARRAYATTRIBBINDINGPROC proc = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)glad_lazy_load("glVertexArrayAttribBinding");
+	if(proc == NULL) return;
+	glad_glVertexArrayAttribBinding = proc;
+	proc(vaobj, attribindex, bindingindex);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	PFNGLVERTEXARRAYATTRIBFORMATPROC proc = (PFNGLVERTEXARRAYATTRIBFORMATPROC)glad_lazy_load("glVertexArrayAttribFormat");
+	if(proc == NULL) return;
+	glad_glVertexArrayAttribFormat = proc;
+	proc(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	PFNGLVERTEXARRAYATTRIBIFORMATPROC proc = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)glad_lazy_load("glVertexArrayAttribIFormat");
+	if(proc == NULL) return;
+	glad_glVertexArrayAttribIFormat = proc;
+	proc(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	PFNGLVERTEXARRAYATTRIBLFORMATPROC proc = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)glad_lazy_load("glVertexArrayAttribLFormat");
+	if(proc == NULL) return;
+	glad_glVertexArrayAttribLFormat = proc;
+	proc(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY glad_lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	PFNGLVERTEXARRAYBINDINGDIVISORPROC proc = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)glad_lazy_load("glVertexArrayBindingDivisor");
+	if(proc == NULL) return;
+	glad_glVertexArrayBindingDivisor = proc;
+	proc(vaobj, bindingindex, divisor);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	PFNGLGETVERTEXARRAYIVPROC proc = (PFNGLGETVERTEXARRAYIVPROC)glad_lazy_load("glGetVertexArrayiv");
+	if(proc == NULL) return;
+	glad_glGetVertexArrayiv = proc;
+	proc(vaobj, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	PFNGLGETVERTEXARRAYINDEXEDIVPROC proc = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)glad_lazy_load("glGetVertexArrayIndexediv");
+	if(proc == NULL) return;
+	glad_glGetVertexArrayIndexediv = proc;
+	proc(vaobj, index, pname, param);
+}
+static void APIENTRY glad_lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	PFNGLGETVERTEXARRAYINDEXED64IVPROC proc = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)glad_lazy_load("glGetVertexArrayIndexed64iv");
+	if(proc == NULL) return;
+	glad_glGetVertexArrayIndexed64iv = proc;
+	proc(vaobj, index, pname, param);
+}
+static void APIENTRY glad_lazy_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	PFNGLCREATESAMPLERSPROC proc = (PFNGLCREATESAMPLERSPROC)glad_lazy_load("glCreateSamplers");
+	if(proc == NULL) return;
+	glad_glCreateSamplers = proc;
+	proc(n, samplers);
+}
+static void APIENTRY glad_lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	PFNGLCREATEPROGRAMPIPELINESPROC proc = (PFNGLCREATEPROGRAMPIPELINESPROC)glad_lazy_load("glCreateProgramPipelines");
+	if(proc == NULL) return;
+	glad_glCreateProgramPipelines = proc;
+	proc(n, pipelines);
+}
+static void APIENTRY glad_lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	PFNGLCREATEQUERIESPROC proc = (PFNGLCREATEQUERIESPROC)glad_lazy_load("glCreateQueries");
+	if(proc == NULL) return;
+	glad_glCreateQueries = proc;
+	proc(target, n, ids);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	PFNGLGETQUERYBUFFEROBJECTI64VPROC proc = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)glad_lazy_load("glGetQueryBufferObjecti64v");
+	if(proc == NULL) return;
+	glad_glGetQueryBufferObjecti64v = proc;
+	proc(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	PFNGLGETQUERYBUFFEROBJECTIVPROC proc = (PFNGLGETQUERYBUFFEROBJECTIVPROC)glad_lazy_load("glGetQueryBufferObjectiv");
+	if(proc == NULL) return;
+	glad_glGetQueryBufferObjectiv = proc;
+	proc(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	PFNGLGETQUERYBUFFEROBJECTUI64VPROC proc = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glad_lazy_load("glGetQueryBufferObjectui64v");
+	if(proc == NULL) return;
+	glad_glGetQueryBufferObjectui64v = proc;
+	proc(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	PFNGLGETQUERYBUFFEROBJECTUIVPROC proc = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)glad_lazy_load("glGetQueryBufferObjectuiv");
+	if(proc == NULL) return;
+	glad_glGetQueryBufferObjectuiv = proc;
+	proc(id, buffer, pname, offset);
+}
+static void APIENTRY glad_lazy_glMemoryBarrierByRegion(GLbitfield barriers) {
+	PFNGLMEMORYBARRIERBYREGIONPROC proc = (PFNGLMEMORYBARRIERBYREGIONPROC)glad_lazy_load("glMemoryBarrierByRegion");
+	if(proc == NULL) return;
+	glad_glMemoryBarrierByRegion = proc;
+	proc(barriers);
+}
+static void APIENTRY glad_lazy_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	PFNGLGETTEXTURESUBIMAGEPROC proc = (PFNGLGETTEXTURESUBIMAGEPROC)glad_lazy_load("glGetTextureSubImage");
+	if(proc == NULL) return;
+	glad_glGetTextureSubImage = proc;
+	proc(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+	PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC proc = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)glad_lazy_load("glGetCompressedTextureSubImage");
+	if(proc == NULL) return;
+	glad_glGetCompressedTextureSubImage = proc;
+	proc(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+static GLenum APIENTRY glad_lazy_glGetGraphicsResetStatus(void) {
+	PFNGLGETGRAPHICSRESETSTATUSPROC proc = (PFNGLGETGRAPHICSRESETSTATUSPROC)glad_lazy_load("glGetGraphicsResetStatus");
+	if(proc == NULL) return 0;
+	glad_glGetGraphicsResetStatus = proc;
+	return proc();
+}
+static void APIENTRY glad_lazy_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+	PFNGLGETNCOMPRESSEDTEXIMAGEPROC proc = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)glad_lazy_load("glGetnCompressedTexImage");
+	if(proc == NULL) return;
+	glad_glGetnCompressedTexImage = proc;
+	proc(target, lod, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	PFNGLGETNTEXIMAGEPROC proc = (PFNGLGETNTEXIMAGEPROC)glad_lazy_load("glGetnTexImage");
+	if(proc == NULL) return;
+	glad_glGetnTexImage = proc;
+	proc(target, level, format, type, bufSize, pixels);
+}
+static void APIENTRY glad_lazy_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	PFNGLGETNUNIFORMDVPROC proc = (PFNGLGETNUNIFORMDVPROC)glad_lazy_load("glGetnUniformdv");
+	if(proc == NULL) return;
+	glad_glGetnUniformdv = proc;
+	proc(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	PFNGLGETNUNIFORMFVPROC proc = (PFNGLGETNUNIFORMFVPROC)glad_lazy_load("glGetnUniformfv");
+	if(proc == NULL) return;
+	glad_glGetnUniformfv = proc;
+	proc(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	PFNGLGETNUNIFORMIVPROC proc = (PFNGLGETNUNIFORMIVPROC)glad_lazy_load("glGetnUniformiv");
+	if(proc == NULL) return;
+	glad_glGetnUniformiv = proc;
+	proc(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	PFNGLGETNUNIFORMUIVPROC proc = (PFNGLGETNUNIFORMUIVPROC)glad_lazy_load("glGetnUniformuiv");
+	if(proc == NULL) return;
+	glad_glGetnUniformuiv = proc;
+	proc(program, location, bufSize, params);
+}
+static void APIENTRY glad_lazy_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	PFNGLREADNPIXELSPROC proc = (PFNGLREADNPIXELSPROC)glad_lazy_load("glReadnPixels");
+	if(proc == NULL) return;
+	glad_glReadnPixels = proc;
+	proc(x, y, width, height, format, type, bufSize, data);
+}
+static void APIENTRY glad_lazy_glTextureBarrier(void) {
+	PFNGLTEXTUREBARRIERPROC proc = (PFNGLTEXTUREBARRIERPROC)glad_lazy_load("glTextureBarrier");
+	if(proc == NULL) return;
+	glad_glTextureBarrier = proc;
+	proc();
+}
+static void APIENTRY glad_lazy_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC proc = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glad_lazy_load("glMaxShaderCompilerThreadsKHR");
+	if(proc == NULL) return;
+	glad_glMaxShaderCompilerThreadsKHR = proc;
+	proc(count);
+}
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_VERSION_4_0(void) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = glad_lazy_glMinSampleShading;
+	glad_glBlendEquationi = glad_lazy_glBlendEquationi;
+	glad_glBlendEquationSeparatei = glad_lazy_glBlendEquationSeparatei;
+	glad_glBlendFunci = glad_lazy_glBlendFunci;
+	glad_glBlendFuncSeparatei = glad_lazy_glBlendFuncSeparatei;
+	glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+	glad_glUniform1d = glad_lazy_glUniform1d;
+	glad_glUniform2d = glad_lazy_glUniform2d;
+	glad_glUniform3d = glad_lazy_glUniform3d;
+	glad_glUniform4d = glad_lazy_glUniform4d;
+	glad_glUniform1dv = glad_lazy_glUniform1dv;
+	glad_glUniform2dv = glad_lazy_glUniform2dv;
+	glad_glUniform3dv = glad_lazy_glUniform3dv;
+	glad_glUniform4dv = glad_lazy_glUniform4dv;
+	glad_glUniformMatrix2dv = glad_lazy_glUniformMatrix2dv;
+	glad_glUniformMatrix3dv = glad_lazy_glUniformMatrix3dv;
+	glad_glUniformMatrix4dv = glad_lazy_glUniformMatrix4dv;
+	glad_glUniformMatrix2x3dv = glad_lazy_glUniformMatrix2x3dv;
+	glad_glUniformMatrix2x4dv = glad_lazy_glUniformMatrix2x4dv;
+	glad_glUniformMatrix3x2dv = glad_lazy_glUniformMatrix3x2dv;
+	glad_glUniformMatrix3x4dv = glad_lazy_glUniformMatrix3x4dv;
+	glad_glUniformMatrix4x2dv = glad_lazy_glUniformMatrix4x2dv;
+	glad_glUniformMatrix4x3dv = glad_lazy_glUniformMatrix4x3dv;
+	glad_glGetUniformdv = glad_lazy_glGetUniformdv;
+	glad_glGetSubroutineUniformLocation = glad_lazy_glGetSubroutineUniformLocation;
+	glad_glGetSubroutineIndex = glad_lazy_glGetSubroutineIndex;
+	glad_glGetActiveSubroutineUniformiv = glad_lazy_glGetActiveSubroutineUniformiv;
+	glad_glGetActiveSubroutineUniformName = glad_lazy_glGetActiveSubroutineUniformName;
+	glad_glGetActiveSubroutineName = glad_lazy_glGetActiveSubroutineName;
+	glad_glUniformSubroutinesuiv = glad_lazy_glUniformSubroutinesuiv;
+	glad_glGetUniformSubroutineuiv = glad_lazy_glGetUniformSubroutineuiv;
+	glad_glGetProgramStageiv = glad_lazy_glGetProgramStageiv;
+	glad_glPatchParameteri = glad_lazy_glPatchParameteri;
+	glad_glPatchParameterfv = glad_lazy_glPatchParameterfv;
+	glad_glBindTransformFeedback = glad_lazy_glBindTransformFeedback;
+	glad_glDeleteTransformFeedbacks = glad_lazy_glDeleteTransformFeedbacks;
+	glad_glGenTransformFeedbacks = glad_lazy_glGenTransformFeedbacks;
+	glad_glIsTransformFeedback = glad_lazy_glIsTransformFeedback;
+	glad_glPauseTransformFeedback = glad_lazy_glPauseTransformFeedback;
+	glad_glResumeTransformFeedback = glad_lazy_glResumeTransformFeedback;
+	glad_glDrawTransformFeedback = glad_lazy_glDrawTransformFeedback;
+	glad_glDrawTransformFeedbackStream = glad_lazy_glDrawTransformFeedbackStream;
+	glad_glBeginQueryIndexed = glad_lazy_glBeginQueryIndexed;
+	glad_glEndQueryIndexed = glad_lazy_glEndQueryIndexed;
+	glad_glGetQueryIndexediv = glad_lazy_glGetQueryIndexediv;
+}
+static void lazy_GL_VERSION_4_1(void) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = glad_lazy_glReleaseShaderCompiler;
+	glad_glShaderBinary = glad_lazy_glShaderBinary;
+	glad_glGetShaderPrecisionFormat = glad_lazy_glGetShaderPrecisionFormat;
+	glad_glDepthRangef = glad_lazy_glDepthRangef;
+	glad_glClearDepthf = glad_lazy_glClearDepthf;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+	glad_glUseProgramStages = glad_lazy_glUseProgramStages;
+	glad_glActiveShaderProgram = glad_lazy_glActiveShaderProgram;
+	glad_glCreateShaderProgramv = glad_lazy_glCreateShaderProgramv;
+	glad_glBindProgramPipeline = glad_lazy_glBindProgramPipeline;
+	glad_glDeleteProgramPipelines = glad_lazy_glDeleteProgramPipelines;
+	glad_glGenProgramPipelines = glad_lazy_glGenProgramPipelines;
+	glad_glIsProgramPipeline = glad_lazy_glIsProgramPipeline;
+	glad_glGetProgramPipelineiv = glad_lazy_glGetProgramPipelineiv;
+	glad_glProgramUniform1i = glad_lazy_glProgramUniform1i;
+	glad_glProgramUniform1iv = glad_lazy_glProgramUniform1iv;
+	glad_glProgramUniform1f = glad_lazy_glProgramUniform1f;
+	glad_glProgramUniform1fv = glad_lazy_glProgramUniform1fv;
+	glad_glProgramUniform1d = glad_lazy_glProgramUniform1d;
+	glad_glProgramUniform1dv = glad_lazy_glProgramUniform1dv;
+	glad_glProgramUniform1ui = glad_lazy_glProgramUniform1ui;
+	glad_glProgramUniform1uiv = glad_lazy_glProgramUniform1uiv;
+	glad_glProgramUniform2i = glad_lazy_glProgramUniform2i;
+	glad_glProgramUniform2iv = glad_lazy_glProgramUniform2iv;
+	glad_glProgramUniform2f = glad_lazy_glProgramUniform2f;
+	glad_glProgramUniform2fv = glad_lazy_glProgramUniform2fv;
+	glad_glProgramUniform2d = glad_lazy_glProgramUniform2d;
+	glad_glProgramUniform2dv = glad_lazy_glProgramUniform2dv;
+	glad_glProgramUniform2ui = glad_lazy_glProgramUniform2ui;
+	glad_glProgramUniform2uiv = glad_lazy_glProgramUniform2uiv;
+	glad_glProgramUniform3i = glad_lazy_glProgramUniform3i;
+	glad_glProgramUniform3iv = glad_lazy_glProgramUniform3iv;
+	glad_glProgramUniform3f = glad_lazy_glProgramUniform3f;
+	glad_glProgramUniform3fv = glad_lazy_glProgramUniform3fv;
+	glad_glProgramUniform3d = glad_lazy_glProgramUniform3d;
+	glad_glProgramUniform3dv = glad_lazy_glProgramUniform3dv;
+	glad_glProgramUniform3ui = glad_lazy_glProgramUniform3ui;
+	glad_glProgramUniform3uiv = glad_lazy_glProgramUniform3uiv;
+	glad_glProgramUniform4i = glad_lazy_glProgramUniform4i;
+	glad_glProgramUniform4iv = glad_lazy_glProgramUniform4iv;
+	glad_glProgramUniform4f = glad_lazy_glProgramUniform4f;
+	glad_glProgramUniform4fv = glad_lazy_glProgramUniform4fv;
+	glad_glProgramUniform4d = glad_lazy_glProgramUniform4d;
+	glad_glProgramUniform4dv = glad_lazy_glProgramUniform4dv;
+	glad_glProgramUniform4ui = glad_lazy_glProgramUniform4ui;
+	glad_glProgramUniform4uiv = glad_lazy_glProgramUniform4uiv;
+	glad_glProgramUniformMatrix2fv = glad_lazy_glProgramUniformMatrix2fv;
+	glad_glProgramUniformMatrix3fv = glad_lazy_glProgramUniformMatrix3fv;
+	glad_glProgramUniformMatrix4fv = glad_lazy_glProgramUniformMatrix4fv;
+	glad_glProgramUniformMatrix2dv = glad_lazy_glProgramUniformMatrix2dv;
+	glad_glProgramUniformMatrix3dv = glad_lazy_glProgramUniformMatrix3dv;
+	glad_glProgramUniformMatrix4dv = glad_lazy_glProgramUniformMatrix4dv;
+	glad_glProgramUniformMatrix2x3fv = glad_lazy_glProgramUniformMatrix2x3fv;
+	glad_glProgramUniformMatrix3x2fv = glad_lazy_glProgramUniformMatrix3x2fv;
+	glad_glProgramUniformMatrix2x4fv = glad_lazy_glProgramUniformMatrix2x4fv;
+	glad_glProgramUniformMatrix4x2fv = glad_lazy_glProgramUniformMatrix4x2fv;
+	glad_glProgramUniformMatrix3x4fv = glad_lazy_glProgramUniformMatrix3x4fv;
+	glad_glProgramUniformMatrix4x3fv = glad_lazy_glProgramUniformMatrix4x3fv;
+	glad_glProgramUniformMatrix2x3dv = glad_lazy_glProgramUniformMatrix2x3dv;
+	glad_glProgramUniformMatrix3x2dv = glad_lazy_glProgramUniformMatrix3x2dv;
+	glad_glProgramUniformMatrix2x4dv = glad_lazy_glProgramUniformMatrix2x4dv;
+	glad_glProgramUniformMatrix4x2dv = glad_lazy_glProgramUniformMatrix4x2dv;
+	glad_glProgramUniformMatrix3x4dv = glad_lazy_glProgramUniformMatrix3x4dv;
+	glad_glProgramUniformMatrix4x3dv = glad_lazy_glProgramUniformMatrix4x3dv;
+	glad_glValidateProgramPipeline = glad_lazy_glValidateProgramPipeline;
+	glad_glGetProgramPipelineInfoLog = glad_lazy_glGetProgramPipelineInfoLog;
+	glad_glVertexAttribL1d = glad_lazy_glVertexAttribL1d;
+	glad_glVertexAttribL2d = glad_lazy_glVertexAttribL2d;
+	glad_glVertexAttribL3d = glad_lazy_glVertexAttribL3d;
+	glad_glVertexAttribL4d = glad_lazy_glVertexAttribL4d;
+	glad_glVertexAttribL1dv = glad_lazy_glVertexAttribL1dv;
+	glad_glVertexAttribL2dv = glad_lazy_glVertexAttribL2dv;
+	glad_glVertexAttribL3dv = glad_lazy_glVertexAttribL3dv;
+	glad_glVertexAttribL4dv = glad_lazy_glVertexAttribL4dv;
+	glad_glVertexAttribLPointer = glad_lazy_glVertexAttribLPointer;
+	glad_glGetVertexAttribLdv = glad_lazy_glGetVertexAttribLdv;
+	glad_glViewportArrayv = glad_lazy_glViewportArrayv;
+	glad_glViewportIndexedf = glad_lazy_glViewportIndexedf;
+	glad_glViewportIndexedfv = glad_lazy_glViewportIndexedfv;
+	glad_glScissorArrayv = glad_lazy_glScissorArrayv;
+	glad_glScissorIndexed = glad_lazy_glScissorIndexed;
+	glad_glScissorIndexedv = glad_lazy_glScissorIndexedv;
+	glad_glDepthRangeArrayv = glad_lazy_glDepthRangeArrayv;
+	glad_glDepthRangeIndexed = glad_lazy_glDepthRangeIndexed;
+	glad_glGetFloati_v = glad_lazy_glGetFloati_v;
+	glad_glGetDoublei_v = glad_lazy_glGetDoublei_v;
+}
+static void lazy_GL_VERSION_4_2(void) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = glad_lazy_glDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseInstance = glad_lazy_glDrawElementsInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+	glad_glGetInternalformativ = glad_lazy_glGetInternalformativ;
+	glad_glGetActiveAtomicCounterBufferiv = glad_lazy_glGetActiveAtomicCounterBufferiv;
+	glad_glBindImageTexture = glad_lazy_glBindImageTexture;
+	glad_glMemoryBarrier = glad_lazy_glMemoryBarrier;
+	glad_glTexStorage1D = glad_lazy_glTexStorage1D;
+	glad_glTexStorage2D = glad_lazy_glTexStorage2D;
+	glad_glTexStorage3D = glad_lazy_glTexStorage3D;
+	glad_glDrawTransformFeedbackInstanced = glad_lazy_glDrawTransformFeedbackInstanced;
+	glad_glDrawTransformFeedbackStreamInstanced = glad_lazy_glDrawTransformFeedbackStreamInstanced;
+}
+static void lazy_GL_VERSION_4_3(void) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = glad_lazy_glClearBufferData;
+	glad_glClearBufferSubData = glad_lazy_glClearBufferSubData;
+	glad_glDispatchCompute = glad_lazy_glDispatchCompute;
+	glad_glDispatchComputeIndirect = glad_lazy_glDispatchComputeIndirect;
+	glad_glCopyImageSubData = glad_lazy_glCopyImageSubData;
+	glad_glFramebufferParameteri = glad_lazy_glFramebufferParameteri;
+	glad_glGetFramebufferParameteriv = glad_lazy_glGetFramebufferParameteriv;
+	glad_glGetInternalformati64v = glad_lazy_glGetInternalformati64v;
+	glad_glInvalidateTexSubImage = glad_lazy_glInvalidateTexSubImage;
+	glad_glInvalidateTexImage = glad_lazy_glInvalidateTexImage;
+	glad_glInvalidateBufferSubData = glad_lazy_glInvalidateBufferSubData;
+	glad_glInvalidateBufferData = glad_lazy_glInvalidateBufferData;
+	glad_glInvalidateFramebuffer = glad_lazy_glInvalidateFramebuffer;
+	glad_glInvalidateSubFramebuffer = glad_lazy_glInvalidateSubFramebuffer;
+	glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+	glad_glGetProgramInterfaceiv = glad_lazy_glGetProgramInterfaceiv;
+	glad_glGetProgramResourceIndex = glad_lazy_glGetProgramResourceIndex;
+	glad_glGetProgramResourceName = glad_lazy_glGetProgramResourceName;
+	glad_glGetProgramResourceiv = glad_lazy_glGetProgramResourceiv;
+	glad_glGetProgramResourceLocation = glad_lazy_glGetProgramResourceLocation;
+	glad_glGetProgramResourceLocationIndex = glad_lazy_glGetProgramResourceLocationIndex;
+	glad_glShaderStorageBlockBinding = glad_lazy_glShaderStorageBlockBinding;
+	glad_glTexBufferRange = glad_lazy_glTexBufferRange;
+	glad_glTexStorage2DMultisample = glad_lazy_glTexStorage2DMultisample;
+	glad_glTexStorage3DMultisample = glad_lazy_glTexStorage3DMultisample;
+	glad_glTextureView = glad_lazy_glTextureView;
+	glad_glBindVertexBuffer = glad_lazy_glBindVertexBuffer;
+	glad_glVertexAttribFormat = glad_lazy_glVertexAttribFormat;
+	glad_glVertexAttribIFormat = glad_lazy_glVertexAttribIFormat;
+	glad_glVertexAttribLFormat = glad_lazy_glVertexAttribLFormat;
+	glad_glVertexAttribBinding = glad_lazy_glVertexAttribBinding;
+	glad_glVertexBindingDivisor = glad_lazy_glVertexBindingDivisor;
+	glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+	glad_glObjectLabel = glad_lazy_glObjectLabel;
+	glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+}
+static void lazy_GL_VERSION_4_4(void) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+	glad_glClearTexImage = glad_lazy_glClearTexImage;
+	glad_glClearTexSubImage = glad_lazy_glClearTexSubImage;
+	glad_glBindBuffersBase = glad_lazy_glBindBuffersBase;
+	glad_glBindBuffersRange = glad_lazy_glBindBuffersRange;
+	glad_glBindTextures = glad_lazy_glBindTextures;
+	glad_glBindSamplers = glad_lazy_glBindSamplers;
+	glad_glBindImageTextures = glad_lazy_glBindImageTextures;
+	glad_glBindVertexBuffers = glad_lazy_glBindVertexBuffers;
+}
+static void lazy_GL_VERSION_4_5(void) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = glad_lazy_glClipControl;
+	glad_glCreateTransformFeedbacks = glad_lazy_glCreateTransformFeedbacks;
+	glad_glTransformFeedbackBufferBase = glad_lazy_glTransformFeedbackBufferBase;
+	glad_glTransformFeedbackBufferRange = glad_lazy_glTransformFeedbackBufferRange;
+	glad_glGetTransformFeedbackiv = glad_lazy_glGetTransformFeedbackiv;
+	glad_glGetTransformFeedbacki_v = glad_lazy_glGetTransformFeedbacki_v;
+	glad_glGetTransformFeedbacki64_v = glad_lazy_glGetTransformFeedbacki64_v;
+	glad_glCreateBuffers = glad_lazy_glCreateBuffers;
+	glad_glNamedBufferStorage = glad_lazy_glNamedBufferStorage;
+	glad_glNamedBufferData = glad_lazy_glNamedBufferData;
+	glad_glNamedBufferSubData = glad_lazy_glNamedBufferSubData;
+	glad_glCopyNamedBufferSubData = glad_lazy_glCopyNamedBufferSubData;
+	glad_glClearNamedBufferData = glad_lazy_glClearNamedBufferData;
+	glad_glClearNamedBufferSubData = glad_lazy_glClearNamedBufferSubData;
+	glad_glMapNamedBuffer = glad_lazy_glMapNamedBuffer;
+	glad_glMapNamedBufferRange = glad_lazy_glMapNamedBufferRange;
+	glad_glUnmapNamedBuffer = glad_lazy_glUnmapNamedBuffer;
+	glad_glFlushMappedNamedBufferRange = glad_lazy_glFlushMappedNamedBufferRange;
+	glad_glGetNamedBufferParameteriv = glad_lazy_glGetNamedBufferParameteriv;
+	glad_glGetNamedBufferParameteri64v = glad_lazy_glGetNamedBufferParameteri64v;
+	glad_glGetNamedBufferPointerv = glad_lazy_glGetNamedBufferPointerv;
+	glad_glGetNamedBufferSubData = glad_lazy_glGetNamedBufferSubData;
+	glad_glCreateFramebuffers = glad_lazy_glCreateFramebuffers;
+	glad_glNamedFramebufferRenderbuffer = glad_lazy_glNamedFramebufferRenderbuffer;
+	glad_glNamedFramebufferParameteri = glad_lazy_glNamedFramebufferParameteri;
+	glad_glNamedFramebufferTexture = glad_lazy_glNamedFramebufferTexture;
+	glad_glNamedFramebufferTextureLayer = glad_lazy_glNamedFramebufferTextureLayer;
+	glad_glNamedFramebufferDrawBuffer = glad_lazy_glNamedFramebufferDrawBuffer;
+	glad_glNamedFramebufferDrawBuffers = glad_lazy_glNamedFramebufferDrawBuffers;
+	glad_glNamedFramebufferReadBuffer = glad_lazy_glNamedFramebufferReadBuffer;
+	glad_glInvalidateNamedFramebufferData = glad_lazy_glInvalidateNamedFramebufferData;
+	glad_glInvalidateNamedFramebufferSubData = glad_lazy_glInvalidateNamedFramebufferSubData;
+	glad_glClearNamedFramebufferiv = glad_lazy_glClearNamedFramebufferiv;
+	glad_glClearNamedFramebufferuiv = glad_lazy_glClearNamedFramebufferuiv;
+	glad_glClearNamedFramebufferfv = glad_lazy_glClearNamedFramebufferfv;
+	glad_glClearNamedFramebufferfi = glad_lazy_glClearNamedFramebufferfi;
+	glad_glBlitNamedFramebuffer = glad_lazy_glBlitNamedFramebuffer;
+	glad_glCheckNamedFramebufferStatus = glad_lazy_glCheckNamedFramebufferStatus;
+	glad_glGetNamedFramebufferParameteriv = glad_lazy_glGetNamedFramebufferParameteriv;
+	glad_glGetNamedFramebufferAttachmentParameteriv = glad_lazy_glGetNamedFramebufferAttachmentParameteriv;
+	glad_glCreateRenderbuffers = glad_lazy_glCreateRenderbuffers;
+	glad_glNamedRenderbufferStorage = glad_lazy_glNamedRenderbufferStorage;
+	glad_glNamedRenderbufferStorageMultisample = glad_lazy_glNamedRenderbufferStorageMultisample;
+	glad_glGetNamedRenderbufferParameteriv = glad_lazy_glGetNamedRenderbufferParameteriv;
+	glad_glCreateTextures = glad_lazy_glCreateTextures;
+	glad_glTextureBuffer = glad_lazy_glTextureBuffer;
+	glad_glTextureBufferRange = glad_lazy_glTextureBufferRange;
+	glad_glTextureStorage1D = glad_lazy_glTextureStorage1D;
+	glad_glTextureStorage2D = glad_lazy_glTextureStorage2D;
+	glad_glTextureStorage3D = glad_lazy_glTextureStorage3D;
+	glad_glTextureStorage2DMultisample = glad_lazy_glTextureStorage2DMultisample;
+	glad_glTextureStorage3DMultisample = glad_lazy_glTextureStorage3DMultisample;
+	glad_glTextureSubImage1D = glad_lazy_glTextureSubImage1D;
+	glad_glTextureSubImage2D = glad_lazy_glTextureSubImage2D;
+	glad_glTextureSubImage3D = glad_lazy_glTextureSubImage3D;
+	glad_glCompressedTextureSubImage1D = glad_lazy_glCompressedTextureSubImage1D;
+	glad_glCompressedTextureSubImage2D = glad_lazy_glCompressedTextureSubImage2D;
+	glad_glCompressedTextureSubImage3D = glad_lazy_glCompressedTextureSubImage3D;
+	glad_glCopyTextureSubImage1D = glad_lazy_glCopyTextureSubImage1D;
+	glad_glCopyTextureSubImage2D = glad_lazy_glCopyTextureSubImage2D;
+	glad_glCopyTextureSubImage3D = glad_lazy_glCopyTextureSubImage3D;
+	glad_glTextureParameterf = glad_lazy_glTextureParameterf;
+	glad_glTextureParameterfv = glad_lazy_glTextureParameterfv;
+	glad_glTextureParameteri = glad_lazy_glTextureParameteri;
+	glad_glTextureParameterIiv = glad_lazy_glTextureParameterIiv;
+	glad_glTextureParameterIuiv = glad_lazy_glTextureParameterIuiv;
+	glad_glTextureParameteriv = glad_lazy_glTextureParameteriv;
+	glad_glGenerateTextureMipmap = glad_lazy_glGenerateTextureMipmap;
+	glad_glBindTextureUnit = glad_lazy_glBindTextureUnit;
+	glad_glGetTextureImage = glad_lazy_glGetTextureImage;
+	glad_glGetCompressedTextureImage = glad_lazy_glGetCompressedTextureImage;
+	glad_glGetTextureLevelParameterfv = glad_lazy_glGetTextureLevelParameterfv;
+	glad_glGetTextureLevelParameteriv = glad_lazy_glGetTextureLevelParameteriv;
+	glad_glGetTextureParameterfv = glad_lazy_glGetTextureParameterfv;
+	glad_glGetTextureParameterIiv = glad_lazy_glGetTextureParameterIiv;
+	glad_glGetTextureParameterIuiv = glad_lazy_glGetTextureParameterIuiv;
+	glad_glGetTextureParameteriv = glad_lazy_glGetTextureParameteriv;
+	glad_glCreateVertexArrays = glad_lazy_glCreateVertexArrays;
+	glad_glDisableVertexArrayAttrib = glad_lazy_glDisableVertexArrayAttrib;
+	glad_glEnableVertexArrayAttrib = glad_lazy_glEnableVertexArrayAttrib;
+	glad_glVertexArrayElementBuffer = glad_lazy_glVertexArrayElementBuffer;
+	glad_glVertexArrayVertexBuffer = glad_lazy_glVertexArrayVertexBuffer;
+	glad_glVertexArrayVertexBuffers = glad_lazy_glVertexArrayVertexBuffers;
+	glad_glVertexArrayAttribBinding = glad_lazy_glVertexArrayAttribBinding;
+	glad_glVertexArrayAttribFormat = glad_lazy_glVertexArrayAttribFormat;
+	glad_glVertexArrayAttribIFormat = glad_lazy_glVertexArrayAttribIFormat;
+	glad_glVertexArrayAttribLFormat = glad_lazy_glVertexArrayAttribLFormat;
+	glad_glVertexArrayBindingDivisor = glad_lazy_glVertexArrayBindingDivisor;
+	glad_glGetVertexArrayiv = glad_lazy_glGetVertexArrayiv;
+	glad_glGetVertexArrayIndexediv = glad_lazy_glGetVertexArrayIndexediv;
+	glad_glGetVertexArrayIndexed64iv = glad_lazy_glGetVertexArrayIndexed64iv;
+	glad_glCreateSamplers = glad_lazy_glCreateSamplers;
+	glad_glCreateProgramPipelines = glad_lazy_glCreateProgramPipelines;
+	glad_glCreateQueries = glad_lazy_glCreateQueries;
+	glad_glGetQueryBufferObjecti64v = glad_lazy_glGetQueryBufferObjecti64v;
+	glad_glGetQueryBufferObjectiv = glad_lazy_glGetQueryBufferObjectiv;
+	glad_glGetQueryBufferObjectui64v = glad_lazy_glGetQueryBufferObjectui64v;
+	glad_glGetQueryBufferObjectuiv = glad_lazy_glGetQueryBufferObjectuiv;
+	glad_glMemoryBarrierByRegion = glad_lazy_glMemoryBarrierByRegion;
+	glad_glGetTextureSubImage = glad_lazy_glGetTextureSubImage;
+	glad_glGetCompressedTextureSubImage = glad_lazy_glGetCompressedTextureSubImage;
+	glad_glGetGraphicsResetStatus = glad_lazy_glGetGraphicsResetStatus;
+	glad_glGetnCompressedTexImage = glad_lazy_glGetnCompressedTexImage;
+	glad_glGetnTexImage = glad_lazy_glGetnTexImage;
+	glad_glGetnUniformdv = glad_lazy_glGetnUniformdv;
+	glad_glGetnUniformfv = glad_lazy_glGetnUniformfv;
+	glad_glGetnUniformiv = glad_lazy_glGetnUniformiv;
+	glad_glGetnUniformuiv = glad_lazy_glGetnUniformuiv;
+	glad_glReadnPixels = glad_lazy_glReadnPixels;
+	glad_glTextureBarrier = glad_lazy_glTextureBarrier;
+}
+static void lazy_GL_ARB_buffer_storage(void) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+}
+static void lazy_GL_ARB_direct_state_access(void) {
+	if(!GLAD_GL_ARB_direct_state_access) return;
+	glad_glCreateTransformFeedbacks = glad_lazy_glCreateTransformFeedbacks;
+	glad_glTransformFeedbackBufferBase = glad_lazy_glTransformFeedbackBufferBase;
+	glad_glTransformFeedbackBufferRange = glad_lazy_glTransformFeedbackBufferRange;
+	glad_glGetTransformFeedbackiv = glad_lazy_glGetTransformFeedbackiv;
+	glad_glGetTransformFeedbacki_v = glad_lazy_glGetTransformFeedbacki_v;
+	glad_glGetTransformFeedbacki64_v = glad_lazy_glGetTransformFeedbacki64_v;
+	glad_glCreateBuffers = glad_lazy_glCreateBuffers;
+	glad_glNamedBufferStorage = glad_lazy_glNamedBufferStorage;
+	glad_glNamedBufferData = glad_lazy_glNamedBufferData;
+	glad_glNamedBufferSubData = glad_lazy_glNamedBufferSubData;
+	glad_glCopyNamedBufferSubData = glad_lazy_glCopyNamedBufferSubData;
+	glad_glClearNamedBufferData = glad_lazy_glClearNamedBufferData;
+	glad_glClearNamedBufferSubData = glad_lazy_glClearNamedBufferSubData;
+	glad_glMapNamedBuffer = glad_lazy_glMapNamedBuffer;
+	glad_glMapNamedBufferRange = glad_lazy_glMapNamedBufferRange;
+	glad_glUnmapNamedBuffer = glad_lazy_glUnmapNamedBuffer;
+	glad_glFlushMappedNamedBufferRange = glad_lazy_glFlushMappedNamedBufferRange;
+	glad_glGetNamedBufferParameteriv = glad_lazy_glGetNamedBufferParameteriv;
+	glad_glGetNamedBufferParameteri64v = glad_lazy_glGetNamedBufferParameteri64v;
+	glad_glGetNamedBufferPointerv = glad_lazy_glGetNamedBufferPointerv;
+	glad_glGetNamedBufferSubData = glad_lazy_glGetNamedBufferSubData;
+	glad_glCreateFramebuffers = glad_lazy_glCreateFramebuffers;
+	glad_glNamedFramebufferRenderbuffer = glad_lazy_glNamedFramebufferRenderbuffer;
+	glad_glNamedFramebufferParameteri = glad_lazy_glNamedFramebufferParameteri;
+	glad_glNamedFramebufferTexture = glad_lazy_glNamedFramebufferTexture;
+	glad_glNamedFramebufferTextureLayer = glad_lazy_glNamedFramebufferTextureLayer;
+	glad_glNamedFramebufferDrawBuffer = glad_lazy_glNamedFramebufferDrawBuffer;
+	glad_glNamedFramebufferDrawBuffers = glad_lazy_glNamedFramebufferDrawBuffers;
+	glad_glNamedFramebufferReadBuffer = glad_lazy_glNamedFramebufferReadBuffer;
+	glad_glInvalidateNamedFramebufferData = glad_lazy_glInvalidateNamedFramebufferData;
+	glad_glInvalidateNamedFramebufferSubData = glad_lazy_glInvalidateNamedFramebufferSubData;
+	glad_glClearNamedFramebufferiv = glad_lazy_glClearNamedFramebufferiv;
+	glad_glClearNamedFramebufferuiv = glad_lazy_glClearNamedFramebufferuiv;
+	glad_glClearNamedFramebufferfv = glad_lazy_glClearNamedFramebufferfv;
+	glad_glClearNamedFramebufferfi = glad_lazy_glClearNamedFramebufferfi;
+	glad_glBlitNamedFramebuffer = glad_lazy_glBlitNamedFramebuffer;
+	glad_glCheckNamedFramebufferStatus = glad_lazy_glCheckNamedFramebufferStatus;
+	glad_glGetNamedFramebufferParameteriv = glad_lazy_glGetNamedFramebufferParameteriv;
+	glad_glGetNamedFramebufferAttachmentParameteriv = glad_lazy_glGetNamedFramebufferAttachmentParameteriv;
+	glad_glCreateRenderbuffers = glad_lazy_glCreateRenderbuffers;
+	glad_glNamedRenderbufferStorage = glad_lazy_glNamedRenderbufferStorage;
+	glad_glNamedRenderbufferStorageMultisample = glad_lazy_glNamedRenderbufferStorageMultisample;
+	glad_glGetNamedRenderbufferParameteriv = glad_lazy_glGetNamedRenderbufferParameteriv;
+	glad_glCreateTextures = glad_lazy_glCreateTextures;
+	glad_glTextureBuffer = glad_lazy_glTextureBuffer;
+	glad_glTextureBufferRange = glad_lazy_glTextureBufferRange;
+	glad_glTextureStorage1D = glad_lazy_glTextureStorage1D;
+	glad_glTextureStorage2D = glad_lazy_glTextureStorage2D;
+	glad_glTextureStorage3D = glad_lazy_glTextureStorage3D;
+	glad_glTextureStorage2DMultisample = glad_lazy_glTextureStorage2DMultisample;
+	glad_glTextureStorage3DMultisample = glad_lazy_glTextureStorage3DMultisample;
+	glad_glTextureSubImage1D = glad_lazy_glTextureSubImage1D;
+	glad_glTextureSubImage2D = glad_lazy_glTextureSubImage2D;
+	glad_glTextureSubImage3D = glad_lazy_glTextureSubImage3D;
+	glad_glCompressedTextureSubImage1D = glad_lazy_glCompressedTextureSubImage1D;
+	glad_glCompressedTextureSubImage2D = glad_lazy_glCompressedTextureSubImage2D;
+	glad_glCompressedTextureSubImage3D = glad_lazy_glCompressedTextureSubImage3D;
+	glad_glCopyTextureSubImage1D = glad_lazy_glCopyTextureSubImage1D;
+	glad_glCopyTextureSubImage2D = glad_lazy_glCopyTextureSubImage2D;
+	glad_glCopyTextureSubImage3D = glad_lazy_glCopyTextureSubImage3D;
+	glad_glTextureParameterf = glad_lazy_glTextureParameterf;
+	glad_glTextureParameterfv = glad_lazy_glTextureParameterfv;
+	glad_glTextureParameteri = glad_lazy_glTextureParameteri;
+	glad_glTextureParameterIiv = glad_lazy_glTextureParameterIiv;
+	glad_glTextureParameterIuiv = glad_lazy_glTextureParameterIuiv;
+	glad_glTextureParameteriv = glad_lazy_glTextureParameteriv;
+	glad_glGenerateTextureMipmap = glad_lazy_glGenerateTextureMipmap;
+	glad_glBindTextureUnit = glad_lazy_glBindTextureUnit;
+	glad_glGetTextureImage = glad_lazy_glGetTextureImage;
+	glad_glGetCompressedTextureImage = glad_lazy_glGetCompressedTextureImage;
+	glad_glGetTextureLevelParameterfv = glad_lazy_glGetTextureLevelParameterfv;
+	glad_glGetTextureLevelParameteriv = glad_lazy_glGetTextureLevelParameteriv;
+	glad_glGetTextureParameterfv = glad_lazy_glGetTextureParameterfv;
+	glad_glGetTextureParameterIiv = glad_lazy_glGetTextureParameterIiv;
+	glad_glGetTextureParameterIuiv = glad_lazy_glGetTextureParameterIuiv;
+	glad_glGetTextureParameteriv = glad_lazy_glGetTextureParameteriv;
+	glad_glCreateVertexArrays = glad_lazy_glCreateVertexArrays;
+	glad_glDisableVertexArrayAttrib = glad_lazy_glDisableVertexArrayAttrib;
+	glad_glEnableVertexArrayAttrib = glad_lazy_glEnableVertexArrayAttrib;
+	glad_glVertexArrayElementBuffer = glad_lazy_glVertexArrayElementBuffer;
+	glad_glVertexArrayVertexBuffer = glad_lazy_glVertexArrayVertexBuffer;
+	glad_glVertexArrayVertexBuffers = glad_lazy_glVertexArrayVertexBuffers;
+	glad_glVertexArrayAttribBinding = glad_lazy_glVertexArrayAttribBinding;
+	glad_glVertexArrayAttribFormat = glad_lazy_glVertexArrayAttribFormat;
+	glad_glVertexArrayAttribIFormat = glad_lazy_glVertexArrayAttribIFormat;
+	glad_glVertexArrayAttribLFormat = glad_lazy_glVertexArrayAttribLFormat;
+	glad_glVertexArrayBindingDivisor = glad_lazy_glVertexArrayBindingDivisor;
+	glad_glGetVertexArrayiv = glad_lazy_glGetVertexArrayiv;
+	glad_glGetVertexArrayIndexediv = glad_lazy_glGetVertexArrayIndexediv;
+	glad_glGetVertexArrayIndexed64iv = glad_lazy_glGetVertexArrayIndexed64iv;
+	glad_glCreateSamplers = glad_lazy_glCreateSamplers;
+	glad_glCreateProgramPipelines = glad_lazy_glCreateProgramPipelines;
+	glad_glCreateQueries = glad_lazy_glCreateQueries;
+	glad_glGetQueryBufferObjecti64v = glad_lazy_glGetQueryBufferObjecti64v;
+	glad_glGetQueryBufferObjectiv = glad_lazy_glGetQueryBufferObjectiv;
+	glad_glGetQueryBufferObjectui64v = glad_lazy_glGetQueryBufferObjectui64v;
+	glad_glGetQueryBufferObjectuiv = glad_lazy_glGetQueryBufferObjectuiv;
+}
+static void lazy_GL_ARB_multi_draw_indirect(void) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+}
+static void lazy_GL_KHR_debug(void) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+	glad_glObjectLabel = glad_lazy_glObjectLabel;
+	glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+}
+static void lazy_GL_KHR_parallel_shader_compile(void) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = glad_lazy_glMaxShaderCompilerThreadsKHR;
+}
+#endif
+static void load_GL_VERSION_1_0_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_0) return;
+	context->CullFace = (PFNGLCULLFACEPROC)load("glCullFace");
+	context->FrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
+	context->Hint = (PFNGLHINTPROC)load("glHint");
+	context->LineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
+	context->PointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
+	context->PolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
+	context->Scissor = (PFNGLSCISSORPROC)load("glScissor");
+	context->TexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
+	context->TexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
+	context->TexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
+	context->TexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
+	context->TexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
+	context->TexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
+	context->DrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
+	context->Clear = (PFNGLCLEARPROC)load("glClear");
+	context->ClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
+	context->ClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
+	context->ClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
+	context->StencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
+	context->ColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
+	context->DepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
+	context->Disable = (PFNGLDISABLEPROC)load("glDisable");
+	context->Enable = (PFNGLENABLEPROC)load("glEnable");
+	context->Finish = (PFNGLFINISHPROC)load("glFinish");
+	context->Flush = (PFNGLFLUSHPROC)load("glFlush");
+	context->BlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
+	context->LogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
+	context->StencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
+	context->StencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
+	context->DepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
+	context->PixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
+	context->PixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
+	context->ReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
+	context->ReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
+	context->GetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
+	context->GetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
+	context->GetError = (PFNGLGETERRORPROC)load("glGetError");
+	context->GetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
+	context->GetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	context->GetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
+	context->GetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
+	context->GetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
+	context->GetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
+	context->GetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
+	context->IsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
+	context->DepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
+	context->Viewport = (PFNGLVIEWPORTPROC)load("glViewport");
+}
+static void load_GL_VERSION_1_1_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_1) return;
+	context->DrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
+	context->DrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
+	context->PolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
+	context->CopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
+	context->CopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
+	context->CopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
+	context->CopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
+	context->TexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
+	context->TexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
+	context->BindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
+	context->DeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
+	context->GenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
+	context->IsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+}
+static void load_GL_VERSION_1_2_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_2) return;
+	context->DrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
+	context->TexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
+	context->TexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
+	context->CopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
+}
+static void load_GL_VERSION_1_3_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_3) return;
+	context->ActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
+	context->SampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
+	context->CompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
+	context->CompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
+	context->CompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
+	context->CompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
+	context->CompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
+	context->CompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
+	context->GetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+}
+static void load_GL_VERSION_1_4_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_4) return;
+	context->BlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
+	context->MultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
+	context->MultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
+	context->PointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
+	context->PointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
+	context->PointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
+	context->PointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
+	context->BlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
+	context->BlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
+}
+static void load_GL_VERSION_1_5_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_5) return;
+	context->GenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
+	context->DeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
+	context->IsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
+	context->BeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
+	context->EndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
+	context->GetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
+	context->GetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
+	context->GetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
+	context->BindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
+	context->DeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
+	context->GenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
+	context->IsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
+	context->BufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
+	context->BufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+	context->GetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
+	context->MapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
+	context->UnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
+	context->GetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
+	context->GetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
+}
+static void load_GL_VERSION_2_0_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_2_0) return;
+	context->BlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
+	context->DrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
+	context->StencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
+	context->StencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
+	context->StencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
+	context->AttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
+	context->BindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
+	context->CompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
+	context->CreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
+	context->CreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
+	context->DeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
+	context->DeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
+	context->DetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
+	context->DisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
+	context->EnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
+	context->GetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
+	context->GetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
+	context->GetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
+	context->GetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
+	context->GetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
+	context->GetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
+	context->GetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
+	context->GetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
+	context->GetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
+	context->GetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
+	context->GetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
+	context->GetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
+	context->GetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
+	context->GetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
+	context->GetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
+	context->GetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
+	context->IsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
+	context->IsShader = (PFNGLISSHADERPROC)load("glIsShader");
+	context->LinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
+	context->ShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
+	context->UseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
+	context->Uniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
+	context->Uniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
+	context->Uniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
+	context->Uniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
+	context->Uniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
+	context->Uniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
+	context->Uniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
+	context->Uniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
+	context->Uniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
+	context->Uniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
+	context->Uniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
+	context->Uniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
+	context->Uniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
+	context->Uniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
+	context->Uniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
+	context->Uniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
+	context->UniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
+	context->UniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
+	context->UniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
+	context->ValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
+	context->VertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
+	context->VertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
+	context->VertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
+	context->VertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
+	context->VertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
+	context->VertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
+	context->VertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
+	context->VertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
+	context->VertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
+	context->VertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
+	context->VertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
+	context->VertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
+	context->VertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
+	context->VertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
+	context->VertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
+	context->VertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
+	context->VertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
+	context->VertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
+	context->VertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
+	context->VertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
+	context->VertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
+	context->VertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
+	context->VertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
+	context->VertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
+	context->VertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
+	context->VertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
+	context->VertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
+	context->VertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
+	context->VertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
+	context->VertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
+	context->VertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
+	context->VertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
+	context->VertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
+	context->VertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
+	context->VertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
+	context->VertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
+	context->VertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
+}
+static void load_GL_VERSION_2_1_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_2_1) return;
+	context->UniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
+	context->UniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
+	context->UniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
+	context->UniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
+	context->UniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
+	context->UniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
+}
+static void load_GL_VERSION_3_0_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_3_0) return;
+	context->ColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
+	context->GetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
+	context->GetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+	context->Enablei = (PFNGLENABLEIPROC)load("glEnablei");
+	context->Disablei = (PFNGLDISABLEIPROC)load("glDisablei");
+	context->IsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
+	context->BeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
+	context->EndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
+	context->BindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	context->BindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	context->TransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
+	context->GetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
+	context->ClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
+	context->BeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
+	context->EndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
+	context->VertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
+	context->GetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
+	context->GetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
+	context->VertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
+	context->VertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
+	context->VertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
+	context->VertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
+	context->VertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
+	context->VertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
+	context->VertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
+	context->VertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
+	context->VertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
+	context->VertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
+	context->VertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
+	context->VertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
+	context->VertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
+	context->VertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
+	context->VertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
+	context->VertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
+	context->VertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
+	context->VertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
+	context->VertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
+	context->VertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
+	context->GetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
+	context->BindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
+	context->GetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
+	context->Uniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
+	context->Uniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
+	context->Uniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
+	context->Uniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
+	context->Uniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
+	context->Uniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
+	context->Uniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
+	context->Uniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
+	context->TexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
+	context->TexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
+	context->GetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
+	context->GetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
+	context->ClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
+	context->ClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
+	context->ClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
+	context->ClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
+	context->GetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+	context->IsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
+	context->BindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
+	context->DeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
+	context->GenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
+	context->RenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
+	context->GetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
+	context->IsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
+	context->BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
+	context->DeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
+	context->GenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
+	context->CheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
+	context->FramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
+	context->FramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
+	context->FramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
+	context->FramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
+	context->GetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
+	context->GenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
+	context->BlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
+	context->RenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
+	context->FramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
+	context->MapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+	context->FlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
+	context->BindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
+	context->DeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
+	context->GenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
+	context->IsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
+}
+static void load_GL_VERSION_3_1_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_3_1) return;
+	context->DrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
+	context->DrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
+	context->TexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
+	context->PrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
+	context->CopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
+	context->GetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
+	context->GetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
+	context->GetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
+	context->GetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
+	context->GetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
+	context->GetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
+	context->UniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
+	context->BindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	context->BindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	context->GetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+}
+static void load_GL_VERSION_3_2_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_3_2) return;
+	context->DrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
+	context->DrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
+	context->DrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
+	context->MultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
+	context->ProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
+	context->FenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
+	context->IsSync = (PFNGLISSYNCPROC)load("glIsSync");
+	context->DeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
+	context->ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
+	context->WaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
+	context->GetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
+	context->GetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
+	context->GetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
+	context->GetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
+	context->FramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
+	context->TexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
+	context->TexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
+	context->GetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
+	context->SampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
+}
+static void load_GL_VERSION_3_3_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_3_3) return;
+	context->BindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
+	context->GetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
+	context->GenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
+	context->DeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
+	context->IsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
+	context->BindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
+	context->SamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
+	context->SamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
+	context->SamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
+	context->SamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
+	context->SamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
+	context->SamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
+	context->GetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
+	context->GetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
+	context->GetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
+	context->GetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
+	context->QueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+	context->GetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+	context->GetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+	context->VertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
+	context->VertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
+	context->VertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
+	context->VertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
+	context->VertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
+	context->VertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
+	context->VertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
+	context->VertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
+	context->VertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
+	context->VertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
+	context->VertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
+	context->VertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
+	context->VertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
+	context->VertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
+	context->VertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
+	context->TexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
+	context->TexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
+	context->TexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
+	context->TexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
+	context->TexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
+	context->TexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
+	context->TexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
+	context->TexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
+	context->MultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
+	context->MultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
+	context->MultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
+	context->MultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
+	context->MultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
+	context->MultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
+	context->MultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
+	context->MultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
+	context->NormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
+	context->NormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
+	context->ColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
+	context->ColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
+	context->ColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
+	context->ColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
+	context->SecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
+	context->SecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+}
+static void load_GL_VERSION_4_0_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_4_0) return;
+	context->MinSampleShading = (PFNGLMINSAMPLESHADINGPROC)load("glMinSampleShading");
+	context->BlendEquationi = (PFNGLBLENDEQUATIONIPROC)load("glBlendEquationi");
+	context->BlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)load("glBlendEquationSeparatei");
+	context->BlendFunci = (PFNGLBLENDFUNCIPROC)load("glBlendFunci");
+	context->BlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)load("glBlendFuncSeparatei");
+	context->DrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	context->DrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+	context->Uniform1d = (PFNGLUNIFORM1DPROC)load("glUniform1d");
+	context->Uniform2d = (PFNGLUNIFORM2DPROC)load("glUniform2d");
+	context->Uniform3d = (PFNGLUNIFORM3DPROC)load("glUniform3d");
+	context->Uniform4d = (PFNGLUNIFORM4DPROC)load("glUniform4d");
+	context->Uniform1dv = (PFNGLUNIFORM1DVPROC)load("glUniform1dv");
+	context->Uniform2dv = (PFNGLUNIFORM2DVPROC)load("glUniform2dv");
+	context->Uniform3dv = (PFNGLUNIFORM3DVPROC)load("glUniform3dv");
+	context->Uniform4dv = (PFNGLUNIFORM4DVPROC)load("glUniform4dv");
+	context->UniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)load("glUniformMatrix2dv");
+	context->UniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)load("glUniformMatrix3dv");
+	context->UniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)load("glUniformMatrix4dv");
+	context->UniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)load("glUniformMatrix2x3dv");
+	context->UniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)load("glUniformMatrix2x4dv");
+	context->UniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)load("glUniformMatrix3x2dv");
+	context->UniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)load("glUniformMatrix3x4dv");
+	context->UniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)load("glUniformMatrix4x2dv");
+	context->UniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)load("glUniformMatrix4x3dv");
+	context->GetUniformdv = (PFNGLGETUNIFORMDVPROC)load("glGetUniformdv");
+	context->GetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)load("glGetSubroutineUniformLocation");
+	context->GetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)load("glGetSubroutineIndex");
+	context->GetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)load("glGetActiveSubroutineUniformiv");
+	context->GetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)load("glGetActiveSubroutineUniformName");
+	context->GetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)load("glGetActiveSubroutineName");
+	context->UniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)load("glUniformSubroutinesuiv");
+	context->GetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)load("glGetUniformSubroutineuiv");
+	context->GetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)load("glGetProgramStageiv");
+	context->PatchParameteri = (PFNGLPATCHPARAMETERIPROC)load("glPatchParameteri");
+	context->PatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)load("glPatchParameterfv");
+	context->BindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)load("glBindTransformFeedback");
+	context->DeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)load("glDeleteTransformFeedbacks");
+	context->GenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)load("glGenTransformFeedbacks");
+	context->IsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)load("glIsTransformFeedback");
+	context->PauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)load("glPauseTransformFeedback");
+	context->ResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)load("glResumeTransformFeedback");
+	context->DrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)load("glDrawTransformFeedback");
+	context->DrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)load("glDrawTransformFeedbackStream");
+	context->BeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)load("glBeginQueryIndexed");
+	context->EndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)load("glEndQueryIndexed");
+	context->GetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)load("glGetQueryIndexediv");
+}
+static void load_GL_VERSION_4_1_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_4_1) return;
+	context->ReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)load("glReleaseShaderCompiler");
+	context->ShaderBinary = (PFNGLSHADERBINARYPROC)load("glShaderBinary");
+	context->GetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)load("glGetShaderPrecisionFormat");
+	context->DepthRangef = (PFNGLDEPTHRANGEFPROC)load("glDepthRangef");
+	context->ClearDepthf = (PFNGLCLEARDEPTHFPROC)load("glClearDepthf");
+	context->GetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	context->ProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	context->ProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+	context->UseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)load("glUseProgramStages");
+	context->ActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)load("glActiveShaderProgram");
+	context->CreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)load("glCreateShaderProgramv");
+	context->BindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)load("glBindProgramPipeline");
+	context->DeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)load("glDeleteProgramPipelines");
+	context->GenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)load("glGenProgramPipelines");
+	context->IsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)load("glIsProgramPipeline");
+	context->GetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)load("glGetProgramPipelineiv");
+	context->ProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)load("glProgramUniform1i");
+	context->ProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)load("glProgramUniform1iv");
+	context->ProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)load("glProgramUniform1f");
+	context->ProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)load("glProgramUniform1fv");
+	context->ProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)load("glProgramUniform1d");
+	context->ProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)load("glProgramUniform1dv");
+	context->ProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)load("glProgramUniform1ui");
+	context->ProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)load("glProgramUniform1uiv");
+	context->ProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)load("glProgramUniform2i");
+	context->ProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)load("glProgramUniform2iv");
+	context->ProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)load("glProgramUniform2f");
+	context->ProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)load("glProgramUniform2fv");
+	context->ProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)load("glProgramUniform2d");
+	context->ProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)load("glProgramUniform2dv");
+	context->ProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)load("glProgramUniform2ui");
+	context->ProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)load("glProgramUniform2uiv");
+	context->ProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)load("glProgramUniform3i");
+	context->ProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)load("glProgramUniform3iv");
+	context->ProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)load("glProgramUniform3f");
+	context->ProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)load("glProgramUniform3fv");
+	context->ProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)load("glProgramUniform3d");
+	context->ProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)load("glProgramUniform3dv");
+	context->ProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)load("glProgramUniform3ui");
+	context->ProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)load("glProgramUniform3uiv");
+	context->ProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)load("glProgramUniform4i");
+	context->ProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)load("glProgramUniform4iv");
+	context->ProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)load("glProgramUniform4f");
+	context->ProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)load("glProgramUniform4fv");
+	context->ProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)load("glProgramUniform4d");
+	context->ProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)load("glProgramUniform4dv");
+	context->ProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)load("glProgramUniform4ui");
+	context->ProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)load("glProgramUniform4uiv");
+	context->ProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)load("glProgramUniformMatrix2fv");
+	context->ProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)load("glProgramUniformMatrix3fv");
+	context->ProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)load("glProgramUniformMatrix4fv");
+	context->ProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)load("glProgramUniformMatrix2dv");
+	context->ProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)load("glProgramUniformMatrix3dv");
+	context->ProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)load("glProgramUniformMatrix4dv");
+	context->ProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)load("glProgramUniformMatrix2x3fv");
+	context->ProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)load("glProgramUniformMatrix3x2fv");
+	context->ProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)load("glProgramUniformMatrix2x4fv");
+	context->ProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)load("glProgramUniformMatrix4x2fv");
+	context->ProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)load("glProgramUniformMatrix3x4fv");
+	context->ProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)load("glProgramUniformMatrix4x3fv");
+	context->ProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)load("glProgramUniformMatrix2x3dv");
+	context->ProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)load("glProgramUniformMatrix3x2dv");
+	context->ProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)load("glProgramUniformMatrix2x4dv");
+	context->ProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)load("glProgramUniformMatrix4x2dv");
+	context->ProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)load("glProgramUniformMatrix3x4dv");
+	context->ProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)load("glProgramUniformMatrix4x3dv");
+	context->ValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)load("glValidateProgramPipeline");
+	context->GetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)load("glGetProgramPipelineInfoLog");
+	context->VertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)load("glVertexAttribL1d");
+	context->VertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)load("glVertexAttribL2d");
+	context->VertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)load("glVertexAttribL3d");
+	context->VertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)load("glVertexAttribL4d");
+	context->VertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)load("glVertexAttribL1dv");
+	context->VertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)load("glVertexAttribL2dv");
+	context->VertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)load("glVertexAttribL3dv");
+	context->VertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)load("glVertexAttribL4dv");
+	context->VertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)load("glVertexAttribLPointer");
+	context->GetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)load("glGetVertexAttribLdv");
+	context->ViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)load("glViewportArrayv");
+	context->ViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)load("glViewportIndexedf");
+	context->ViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)load("glViewportIndexedfv");
+	context->ScissorArrayv = (PFNGLSCISSORARRAYVPROC)load("glScissorArrayv");
+	context->ScissorIndexed = (PFNGLSCISSORINDEXEDPROC)load("glScissorIndexed");
+	context->ScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)load("glScissorIndexedv");
+	context->DepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)load("glDepthRangeArrayv");
+	context->DepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)load("glDepthRangeIndexed");
+	context->GetFloati_v = (PFNGLGETFLOATI_VPROC)load("glGetFloati_v");
+	context->GetDoublei_v = (PFNGLGETDOUBLEI_VPROC)load("glGetDoublei_v");
+}
+static void load_GL_VERSION_4_2_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_4_2) return;
+	context->DrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
+	context->DrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
+	context->DrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
+	context->GetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)load("glGetInternalformativ");
+	context->GetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)load("glGetActiveAtomicCounterBufferiv");
+	context->BindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)load("glBindImageTexture");
+	context->MemoryBarrier = (PFNGLMEMORYBARRIERPROC)load("glMemoryBarrier");
+	context->TexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
+	context->TexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
+	context->TexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
+	context->DrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)load("glDrawTransformFeedbackInstanced");
+	context->DrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)load("glDrawTransformFeedbackStreamInstanced");
+}
+static void load_GL_VERSION_4_3_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_4_3) return;
+	context->ClearBufferData = (PFNGLCLEARBUFFERDATAPROC)load("glClearBufferData");
+	context->ClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)load("glClearBufferSubData");
+	context->DispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)load("glDispatchCompute");
+	context->DispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)load("glDispatchComputeIndirect");
+	context->CopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)load("glCopyImageSubData");
+	context->FramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)load("glFramebufferParameteri");
+	context->GetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)load("glGetFramebufferParameteriv");
+	context->GetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)load("glGetInternalformati64v");
+	context->InvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
+	context->InvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
+	context->InvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
+	context->InvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
+	context->InvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
+	context->InvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
+	context->MultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	context->MultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+	context->GetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)load("glGetProgramInterfaceiv");
+	context->GetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)load("glGetProgramResourceIndex");
+	context->GetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)load("glGetProgramResourceName");
+	context->GetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)load("glGetProgramResourceiv");
+	context->GetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)load("glGetProgramResourceLocation");
+	context->GetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)load("glGetProgramResourceLocationIndex");
+	context->ShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)load("glShaderStorageBlockBinding");
+	context->TexBufferRange = (PFNGLTEXBUFFERRANGEPROC)load("glTexBufferRange");
+	context->TexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)load("glTexStorage2DMultisample");
+	context->TexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)load("glTexStorage3DMultisample");
+	context->TextureView = (PFNGLTEXTUREVIEWPROC)load("glTextureView");
+	context->BindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)load("glBindVertexBuffer");
+	context->VertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)load("glVertexAttribFormat");
+	context->VertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)load("glVertexAttribIFormat");
+	context->VertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)load("glVertexAttribLFormat");
+	context->VertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)load("glVertexAttribBinding");
+	context->VertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)load("glVertexBindingDivisor");
+	context->DebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	context->DebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	context->DebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	context->GetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	context->PushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	context->PopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	context->ObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	context->GetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	context->ObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	context->GetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+	context->GetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+}
+static void load_GL_VERSION_4_4_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_4_4) return;
+	context->BufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+	context->ClearTexImage = (PFNGLCLEARTEXIMAGEPROC)load("glClearTexImage");
+	context->ClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)load("glClearTexSubImage");
+	context->BindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)load("glBindBuffersBase");
+	context->BindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)load("glBindBuffersRange");
+	context->BindTextures = (PFNGLBINDTEXTURESPROC)load("glBindTextures");
+	context->BindSamplers = (PFNGLBINDSAMPLERSPROC)load("glBindSamplers");
+	context->BindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)load("glBindImageTextures");
+	context->BindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)load("glBindVertexBuffers");
+}
+static void load_GL_VERSION_4_5_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_4_5) return;
+	context->ClipControl = (PFNGLCLIPCONTROLPROC)load("glClipControl");
+	context->CreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	context->TransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	context->TransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	context->GetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	context->GetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	context->GetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	context->CreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	context->NamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	context->NamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	context->NamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	context->CopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	context->ClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	context->ClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	context->MapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	context->MapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	context->UnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	context->FlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	context->GetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	context->GetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	context->GetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	context->GetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	context->CreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	context->NamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	context->NamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	context->NamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	context->NamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	context->NamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	context->NamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	context->NamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	context->InvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	context->InvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	context->ClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	context->ClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	context->ClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	context->ClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	context->BlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	context->CheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	context->GetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	context->GetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	context->CreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	context->NamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	context->NamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	context->GetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	context->CreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	context->TextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	context->TextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	context->TextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	context->TextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	context->TextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	context->TextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	context->TextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	context->TextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	context->TextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	context->TextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	context->CompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	context->CompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	context->CompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	context->CopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	context->CopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	context->CopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	context->TextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	context->TextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	context->TextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	context->TextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	context->TextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	context->TextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	context->GenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	context->BindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	context->GetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	context->GetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	context->GetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	context->GetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	context->GetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	context->GetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	context->GetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	context->GetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	context->CreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	context->DisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	context->EnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	context->VertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	context->VertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	context->VertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	context->VertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	context->VertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	context->VertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	context->VertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	context->VertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	context->GetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	context->GetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	context->GetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	context->CreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	context->CreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	context->CreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	context->GetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	context->GetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	context->GetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	context->GetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+	context->MemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)load("glMemoryBarrierByRegion");
+	context->GetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)load("glGetTextureSubImage");
+	context->GetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)load("glGetCompressedTextureSubImage");
+	context->GetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)load("glGetGraphicsResetStatus");
+	context->GetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)load("glGetnCompressedTexImage");
+	context->GetnTexImage = (PFNGLGETNTEXIMAGEPROC)load("glGetnTexImage");
+	context->GetnUniformdv = (PFNGLGETNUNIFORMDVPROC)load("glGetnUniformdv");
+	context->GetnUniformfv = (PFNGLGETNUNIFORMFVPROC)load("glGetnUniformfv");
+	context->GetnUniformiv = (PFNGLGETNUNIFORMIVPROC)load("glGetnUniformiv");
+	context->GetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)load("glGetnUniformuiv");
+	context->ReadnPixels = (PFNGLREADNPIXELSPROC)load("glReadnPixels");
+	context->TextureBarrier = (PFNGLTEXTUREBARRIERPROC)load("glTextureBarrier");
+}
+static void load_GL_ARB_buffer_storage_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->ARB_buffer_storage) return;
+	context->BufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_direct_state_access_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->ARB_direct_state_access) return;
+	context->CreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	context->TransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	context->TransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	context->GetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	context->GetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	context->GetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	context->CreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	context->NamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	context->NamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	context->NamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	context->CopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	context->ClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	context->ClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	context->MapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	context->MapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	context->UnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	context->FlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	context->GetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	context->GetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	context->GetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	context->GetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	context->CreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	context->NamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	context->NamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	context->NamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	context->NamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	context->NamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	context->NamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	context->NamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	context->InvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	context->InvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	context->ClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	context->ClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	context->ClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	context->ClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	context->BlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	context->CheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	context->GetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	context->GetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	context->CreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	context->NamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	context->NamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	context->GetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	context->CreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	context->TextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	context->TextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	context->TextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	context->TextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	context->TextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	context->TextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	context->TextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	context->TextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	context->TextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	context->TextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	context->CompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	context->CompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	context->CompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	context->CopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	context->CopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	context->CopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	context->TextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	context->TextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	context->TextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	context->TextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	context->TextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	context->TextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	context->GenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	context->BindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	context->GetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	context->GetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	context->GetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	context->GetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	context->GetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	context->GetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	context->GetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	context->GetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	context->CreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	context->DisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	context->EnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	context->VertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	context->VertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	context->VertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	context->VertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	context->VertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	context->VertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	context->VertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	context->VertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	context->GetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	context->GetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	context->GetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	context->CreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	context->CreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	context->CreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	context->GetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	context->GetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	context->GetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	context->GetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+}
+static void load_GL_ARB_multi_draw_indirect_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->ARB_multi_draw_indirect) return;
+	context->MultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	context->MultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+}
+static void load_GL_KHR_debug_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->KHR_debug) return;
+	context->DebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	context->DebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	context->DebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	context->GetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	context->PushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	context->PopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	context->ObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	context->GetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	context->ObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	context->GetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+	context->GetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+}
+static void load_GL_KHR_parallel_shader_compile_context(GladGLContext *context, GLADloadproc load) {
+	if(!context->KHR_parallel_shader_compile) return;
+	context->MaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+#ifdef GLAD_PROFILE
+/* Profiling: every loaded glad_gl* pointer is swapped for a shim that times
+ * the real call. Each thread counts into a table of its own, which is pushed
+ * onto a lock-free list the first time the thread calls GL; the report sums
+ * all tables at exit. Tables of finished threads are kept for the report. */
+static const char *profile_names[] = {
+    "glCullFace",
+    "glFrontFace",
+    "glHint",
+    "glLineWidth",
+    "glPointSize",
+    "glPolygonMode",
+    "glScissor",
+    "glTexParameterf",
+    "glTexParameterfv",
+    "glTexParameteri",
+    "glTexParameteriv",
+    "glTexImage1D",
+    "glTexImage2D",
+    "glDrawBuffer",
+    "glClear",
+    "glClearColor",
+    "glClearStencil",
+    "glClearDepth",
+    "glStencilMask",
+    "glColorMask",
+    "glDepthMask",
+    "glDisable",
+    "glEnable",
+    "glFinish",
+    "glFlush",
+    "glBlendFunc",
+    "glLogicOp",
+    "glStencilFunc",
+    "glStencilOp",
+    "glDepthFunc",
+    "glPixelStoref",
+    "glPixelStorei",
+    "glReadBuffer",
+    "glReadPixels",
+    "glGetBooleanv",
+    "glGetDoublev",
+    "glGetError",
+    "glGetFloatv",
+    "glGetIntegerv",
+    "glGetString",
+    "glGetTexImage",
+    "glGetTexParameterfv",
+    "glGetTexParameteriv",
+    "glGetTexLevelParameterfv",
+    "glGetTexLevelParameteriv",
+    "glIsEnabled",
+    "glDepthRange",
+    "glViewport",
+    "glDrawArrays",
+    "glDrawElements",
+    "glPolygonOffset",
+    "glCopyTexImage1D",
+    "glCopyTexImage2D",
+    "glCopyTexSubImage1D",
+    "glCopyTexSubImage2D",
+    "glTexSubImage1D",
+    "glTexSubImage2D",
+    "glBindTexture",
+    "glDeleteTextures",
+    "glGenTextures",
+    "glIsTexture",
+    "glDrawRangeElements",
+    "glTexImage3D",
+    "glTexSubImage3D",
+    "glCopyTexSubImage3D",
+    "glActiveTexture",
+    "glSampleCoverage",
+    "glCompressedTexImage3D",
+    "glCompressedTexImage2D",
+    "glCompressedTexImage1D",
+    "glCompressedTexSubImage3D",
+    "glCompressedTexSubImage2D",
+    "glCompressedTexSubImage1D",
+    "glGetCompressedTexImage",
+    "glBlendFuncSeparate",
+    "glMultiDrawArrays",
+    "glMultiDrawElements",
+    "glPointParameterf",
+    "glPointParameterfv",
+    "glPointParameteri",
+    "glPointParameteriv",
+    "glBlendColor",
+    "glBlendEquation",
+    "glGenQueries",
+    "glDeleteQueries",
+    "glIsQuery",
+    "glBeginQuery",
+    "glEndQuery",
+    "glGetQueryiv",
+    "glGetQueryObjectiv",
+    "glGetQueryObjectuiv",
+    "glBindBuffer",
+    "glDeleteBuffers",
+    "glGenBuffers",
+    "glIsBuffer",
+    "glBufferData",
+    "glBufferSubData",
+    "glGetBufferSubData",
+    "glMapBuffer",
+    "glUnmapBuffer",
+    "glGetBufferParameteriv",
+    "glGetBufferPointerv",
+    "glBlendEquationSeparate",
+    "glDrawBuffers",
+    "glStencilOpSeparate",
+    "glStencilFuncSeparate",
+    "glStencilMaskSeparate",
+    "glAttachShader",
+    "glBindAttribLocation",
+    "glCompileShader",
+    "glCreateProgram",
+    "glCreateShader",
+    "glDeleteProgram",
+    "glDeleteShader",
+    "glDetachShader",
+    "glDisableVertexAttribArray",
+    "glEnableVertexAttribArray",
+    "glGetActiveAttrib",
+    "glGetActiveUniform",
+    "glGetAttachedShaders",
+    "glGetAttribLocation",
+    "glGetProgramiv",
+    "glGetProgramInfoLog",
+    "glGetShaderiv",
+    "glGetShaderInfoLog",
+    "glGetShaderSource",
+    "glGetUniformLocation",
+    "glGetUniformfv",
+    "glGetUniformiv",
+    "glGetVertexAttribdv",
+    "glGetVertexAttribfv",
+    "glGetVertexAttribiv",
+    "glGetVertexAttribPointerv",
+    "glIsProgram",
+    "glIsShader",
+    "glLinkProgram",
+    "glShaderSource",
+    "glUseProgram",
+    "glUniform1f",
+    "glUniform2f",
+    "glUniform3f",
+    "glUniform4f",
+    "glUniform1i",
+    "glUniform2i",
+    "glUniform3i",
+    "glUniform4i",
+    "glUniform1fv",
+    "glUniform2fv",
+    "glUniform3fv",
+    "glUniform4fv",
+    "glUniform1iv",
+    "glUniform2iv",
+    "glUniform3iv",
+    "glUniform4iv",
+    "glUniformMatrix2fv",
+    "glUniformMatrix3fv",
+    "glUniformMatrix4fv",
+    "glValidateProgram",
+    "glVertexAttrib1d",
+    "glVertexAttrib1dv",
+    "glVertexAttrib1f",
+    "glVertexAttrib1fv",
+    "glVertexAttrib1s",
+    "glVertexAttrib1sv",
+    "glVertexAttrib2d",
+    "glVertexAttrib2dv",
+    "glVertexAttrib2f",
+    "glVertexAttrib2fv",
+    "glVertexAttrib2s",
+    "glVertexAttrib2sv",
+    "glVertexAttrib3d",
+    "glVertexAttrib3dv",
+    "glVertexAttrib3f",
+    "glVertexAttrib3fv",
+    "glVertexAttrib3s",
+    "glVertexAttrib3sv",
+    "glVertexAttrib4Nbv",
+    "glVertexAttrib4Niv",
+    "glVertexAttrib4Nsv",
+    "glVertexAttrib4Nub",
+    "glVertexAttrib4Nubv",
+    "glVertexAttrib4Nuiv",
+    "glVertexAttrib4Nusv",
+    "glVertexAttrib4bv",
+    "glVertexAttrib4d",
+    "glVertexAttrib4dv",
+    "glVertexAttrib4f",
+    "glVertexAttrib4fv",
+    "glVertexAttrib4iv",
+    "glVertexAttrib4s",
+    "glVertexAttrib4sv",
+    "glVertexAttrib4ubv",
+    "glVertexAttrib4uiv",
+    "glVertexAttrib4usv",
+    "glVertexAttribPointer",
+    "glUniformMatrix2x3fv",
+    "glUniformMatrix3x2fv",
+    "glUniformMatrix2x4fv",
+    "glUniformMatrix4x2fv",
+    "glUniformMatrix3x4fv",
+    "glUniformMatrix4x3fv",
+    "glColorMaski",
+    "glGetBooleani_v",
+    "glGetIntegeri_v",
+    "glEnablei",
+    "glDisablei",
+    "glIsEnabledi",
+    "glBeginTransformFeedback",
+    "glEndTransformFeedback",
+    "glBindBufferRange",
+    "glBindBufferBase",
+    "glTransformFeedbackVaryings",
+    "glGetTransformFeedbackVarying",
+    "glClampColor",
+    "glBeginConditionalRender",
+    "glEndConditionalRender",
+    "glVertexAttribIPointer",
+    "glGetVertexAttribIiv",
+    "glGetVertexAttribIuiv",
+    "glVertexAttribI1i",
+    "glVertexAttribI2i",
+    "glVertexAttribI3i",
+    "glVertexAttribI4i",
+    "glVertexAttribI1ui",
+    "glVertexAttribI2ui",
+    "glVertexAttribI3ui",
+    "glVertexAttribI4ui",
+    "glVertexAttribI1iv",
+    "glVertexAttribI2iv",
+    "glVertexAttribI3iv",
+    "glVertexAttribI4iv",
+    "glVertexAttribI1uiv",
+    "glVertexAttribI2uiv",
+    "glVertexAttribI3uiv",
+    "glVertexAttribI4uiv",
+    "glVertexAttribI4bv",
+    "glVertexAttribI4sv",
+    "glVertexAttribI4ubv",
+    "glVertexAttribI4usv",
+    "glGetUniformuiv",
+    "glBindFragDataLocation",
+    "glGetFragDataLocation",
+    "glUniform1ui",
+    "glUniform2ui",
+    "glUniform3ui",
+    "glUniform4ui",
+    "glUniform1uiv",
+    "glUniform2uiv",
+    "glUniform3uiv",
+    "glUniform4uiv",
+    "glTexParameterIiv",
+    "glTexParameterIuiv",
+    "glGetTexParameterIiv",
+    "glGetTexParameterIuiv",
+    "glClearBufferiv",
+    "glClearBufferuiv",
+    "glClearBufferfv",
+    "glClearBufferfi",
+    "glGetStringi",
+    "glIsRenderbuffer",
+    "glBindRenderbuffer",
+    "glDeleteRenderbuffers",
+    "glGenRenderbuffers",
+    "glRenderbufferStorage",
+    "glGetRenderbufferParameteriv",
+    "glIsFramebuffer",
+    "glBindFramebuffer",
+    "glDeleteFramebuffers",
+    "glGenFramebuffers",
+    "glCheckFramebufferStatus",
+    "glFramebufferTexture1D",
+    "glFramebufferTexture2D",
+    "glFramebufferTexture3D",
+    "glFramebufferRenderbuffer",
+    "glGetFramebufferAttachmentParameteriv",
+    "glGenerateMipmap",
+    "glBlitFramebuffer",
+    "glRenderbufferStorageMultisample",
+    "glFramebufferTextureLayer",
+    "glMapBufferRange",
+    "glFlushMappedBufferRange",
+    "glBindVertexArray",
+    "glDeleteVertexArrays",
+    "glGenVertexArrays",
+    "glIsVertexArray",
+    "glDrawArraysInstanced",
+    "glDrawElementsInstanced",
+    "glTexBuffer",
+    "glPrimitiveRestartIndex",
+    "glCopyBufferSubData",
+    "glGetUniformIndices",
+    "glGetActiveUniformsiv",
+    "glGetActiveUniformName",
+    "glGetUniformBlockIndex",
+    "glGetActiveUniformBlockiv",
+    "glGetActiveUniformBlockName",
+    "glUniformBlockBinding",
+    "glDrawElementsBaseVertex",
+    "glDrawRangeElementsBaseVertex",
+    "glDrawElementsInstancedBaseVertex",
+    "glMultiDrawElementsBaseVertex",
+    "glProvokingVertex",
+    "glFenceSync",
+    "glIsSync",
+    "glDeleteSync",
+    "glClientWaitSync",
+    "glWaitSync",
+    "glGetInteger64v",
+    "glGetSynciv",
+    "glGetInteger64i_v",
+    "glGetBufferParameteri64v",
+    "glFramebufferTexture",
+    "glTexImage2DMultisample",
+    "glTexImage3DMultisample",
+    "glGetMultisamplefv",
+    "glSampleMaski",
+    "glBindFragDataLocationIndexed",
+    "glGetFragDataIndex",
+    "glGenSamplers",
+    "glDeleteSamplers",
+    "glIsSampler",
+    "glBindSampler",
+    "glSamplerParameteri",
+    "glSamplerParameteriv",
+    "glSamplerParameterf",
+    "glSamplerParameterfv",
+    "glSamplerParameterIiv",
+    "glSamplerParameterIuiv",
+    "glGetSamplerParameteriv",
+    "glGetSamplerParameterIiv",
+    "glGetSamplerParameterfv",
+    "glGetSamplerParameterIuiv",
+    "glQueryCounter",
+    "glGetQueryObjecti64v",
+    "glGetQueryObjectui64v",
+    "glVertexAttribDivisor",
+    "glVertexAttribP1ui",
+    "glVertexAttribP1uiv",
+    "glVertexAttribP2ui",
+    "glVertexAttribP2uiv",
+    "glVertexAttribP3ui",
+    "glVertexAttribP3uiv",
+    "glVertexAttribP4ui",
+    "glVertexAttribP4uiv",
+    "glVertexP2ui",
+    "glVertexP2uiv",
+    "glVertexP3ui",
+    "glVertexP3uiv",
+    "glVertexP4ui",
+    "glVertexP4uiv",
+    "glTexCoordP1ui",
+    "glTexCoordP1uiv",
+    "glTexCoordP2ui",
+    "glTexCoordP2uiv",
+    "glTexCoordP3ui",
+    "glTexCoordP3uiv",
+    "glTexCoordP4ui",
+    "glTexCoordP4uiv",
+    "glMultiTexCoordP1ui",
+    "glMultiTexCoordP1uiv",
+    "glMultiTexCoordP2ui",
+    "glMultiTexCoordP2uiv",
+    "glMultiTexCoordP3ui",
+    "glMultiTexCoordP3uiv",
+    "glMultiTexCoordP4ui",
+    "glMultiTexCoordP4uiv",
+    "glNormalP3ui",
+    "glNormalP3uiv",
+    "glColorP3ui",
+    "glColorP3uiv",
+    "glColorP4ui",
+    "glColorP4uiv",
+    "glSecondaryColorP3ui",
+    "glSecondaryColorP3uiv",
+    "glMinSampleShading",
+    "glBlendEquationi",
+    "glBlendEquationSeparatei",
+    "glBlendFunci",
+    "glBlendFuncSeparatei",
+    "glDrawArraysIndirect",
+    "glDrawElementsIndirect",
+    "glUniform1d",
+    "glUniform2d",
+    "glUniform3d",
+    "glUniform4d",
+    "glUniform1dv",
+    "glUniform2dv",
+    "glUniform3dv",
+    "glUniform4dv",
+    "glUniformMatrix2dv",
+    "glUniformMatrix3dv",
+    "glUniformMatrix4dv",
+    "glUniformMatrix2x3dv",
+    "glUniformMatrix2x4dv",
+    "glUniformMatrix3x2dv",
+    "glUniformMatrix3x4dv",
+    "glUniformMatrix4x2dv",
+    "glUniformMatrix4x3dv",
+    "glGetUniformdv",
+    "glGetSubroutineUniformLocation",
+    "glGetSubroutineIndex",
+    "glGetActiveSubroutineUniformiv",
+    "glGetActiveSubroutineUniformName",
+    "glGetActiveSubroutineName",
+    "glUniformSubroutinesuiv",
+    "glGetUniformSubroutineuiv",
+    "glGetProgramStageiv",
+    "glPatchParameteri",
+    "glPatchParameterfv",
+    "glBindTransformFeedback",
+    "glDeleteTransformFeedbacks",
+    "glGenTransformFeedbacks",
+    "glIsTransformFeedback",
+    "glPauseTransformFeedback",
+    "glResumeTransformFeedback",
+    "glDrawTransformFeedback",
+    "glDrawTransformFeedbackStream",
+    "glBeginQueryIndexed",
+    "glEndQueryIndexed",
+    "glGetQueryIndexediv",
+    "glReleaseShaderCompiler",
+    "glShaderBinary",
+    "glGetShaderPrecisionFormat",
+    "glDepthRangef",
+    "glClearDepthf",
+    "glGetProgramBinary",
+    "glProgramBinary",
+    "glProgramParameteri",
+    "glUseProgramStages",
+    "glActiveShaderProgram",
+    "glCreateShaderProgramv",
+    "glBindProgramPipeline",
+    "glDeleteProgramPipelines",
+    "glGenProgramPipelines",
+    "glIsProgramPipeline",
+    "glGetProgramPipelineiv",
+    "glProgramUniform1i",
+    "glProgramUniform1iv",
+    "glProgramUniform1f",
+    "glProgramUniform1fv",
+    "glProgramUniform1d",
+    "glProgramUniform1dv",
+    "glProgramUniform1ui",
+    "glProgramUniform1uiv",
+    "glProgramUniform2i",
+    "glProgramUniform2iv",
+    "glProgramUniform2f",
+    "glProgramUniform2fv",
+    "glProgramUniform2d",
+    "glProgramUniform2dv",
+    "glProgramUniform2ui",
+    "glProgramUniform2uiv",
+    "glProgramUniform3i",
+    "glProgramUniform3iv",
+    "glProgramUniform3f",
+    "glProgramUniform3fv",
+    "glProgramUniform3d",
+    "glProgramUniform3dv",
+    "glProgramUniform3ui",
+    "glProgramUniform3uiv",
+    "glProgramUniform4i",
+    "glProgramUniform4iv",
+    "glProgramUniform4f",
+    "glProgramUniform4fv",
+    "glProgramUniform4d",
+    "glProgramUniform4dv",
+    "glProgramUniform4ui",
+    "glProgramUniform4uiv",
+    "glProgramUniformMatrix2fv",
+    "glProgramUniformMatrix3fv",
+    "glProgramUniformMatrix4fv",
+    "glProgramUniformMatrix2dv",
+    "glProgramUniformMatrix3dv",
+    "glProgramUniformMatrix4dv",
+    "glProgramUniformMatrix2x3fv",
+    "glProgramUniformMatrix3x2fv",
+    "glProgramUniformMatrix2x4fv",
+    "glProgramUniformMatrix4x2fv",
+    "glProgramUniformMatrix3x4fv",
+    "glProgramUniformMatrix4x3fv",
+    "glProgramUniformMatrix2x3dv",
+    "glProgramUniformMatrix3x2dv",
+    "glProgramUniformMatrix2x4dv",
+    "glProgramUniformMatrix4x2dv",
+    "glProgramUniformMatrix3x4dv",
+    "glProgramUniformMatrix4x3dv",
+    "glValidateProgramPipeline",
+    "glGetProgramPipelineInfoLog",
+    "glVertexAttribL1d",
+    "glVertexAttribL2d",
+    "glVertexAttribL3d",
+    "glVertexAttribL4d",
+    "glVertexAttribL1dv",
+    "glVertexAttribL2dv",
+    "glVertexAttribL3dv",
+    "glVertexAttribL4dv",
+    "glVertexAttribLPointer",
+    "glGetVertexAttribLdv",
+    "glViewportArrayv",
+    "glViewportIndexedf",
+    "glViewportIndexedfv",
+    "glScissorArrayv",
+    "glScissorIndexed",
+    "glScissorIndexedv",
+    "glDepthRangeArrayv",
+    "glDepthRangeIndexed",
+    "glGetFloati_v",
+    "glGetDoublei_v",
+    "glDrawArraysInstancedBaseInstance",
+    "glDrawElementsInstancedBaseInstance",
+    "glDrawElementsInstancedBaseVertexBaseInstance",
+    "glGetInternalformativ",
+    "glGetActiveAtomicCounterBufferiv",
+    "glBindImageTexture",
+    "glMemoryBarrier",
+    "glTexStorage1D",
+    "glTexStorage2D",
+    "glTexStorage3D",
+    "glDrawTransformFeedbackInstanced",
+    "glDrawTransformFeedbackStreamInstanced",
+    "glClearBufferData",
+    "glClearBufferSubData",
+    "glDispatchCompute",
+    "glDispatchComputeIndirect",
+    "glCopyImageSubData",
+    "glFramebufferParameteri",
+    "glGetFramebufferParameteriv",
+    "glGetInternalformati64v",
+    "glInvalidateTexSubImage",
+    "glInvalidateTexImage",
+    "glInvalidateBufferSubData",
+    "glInvalidateBufferData",
+    "glInvalidateFramebuffer",
+    "glInvalidateSubFramebuffer",
+    "glMultiDrawArraysIndirect",
+    "glMultiDrawElementsIndirect",
+    "glGetProgramInterfaceiv",
+    "glGetProgramResourceIndex",
+    "glGetProgramResourceName",
+    "glGetProgramResourceiv",
+    "glGetProgramResourceLocation",
+    "glGetProgramResourceLocationIndex",
+    "glShaderStorageBlockBinding",
+    "glTexBufferRange",
+    "glTexStorage2DMultisample",
+    "glTexStorage3DMultisample",
+    "glTextureView",
+    "glBindVertexBuffer",
+    "glVertexAttribFormat",
+    "glVertexAttribIFormat",
+    "glVertexAttribLFormat",
+    "glVertexAttribBinding",
+    "glVertexBindingDivisor",
+    "glDebugMessageControl",
+    "glDebugMessageInsert",
+    "glDebugMessageCallback",
+    "glGetDebugMessageLog",
+    "glPushDebugGroup",
+    "glPopDebugGroup",
+    "glObjectLabel",
+    "glGetObjectLabel",
+    "glObjectPtrLabel",
+    "glGetObjectPtrLabel",
+    "glGetPointerv",
+    "glBufferStorage",
+    "glClearTexImage",
+    "glClearTexSubImage",
+    "glBindBuffersBase",
+    "glBindBuffersRange",
+    "glBindTextures",
+    "glBindSamplers",
+    "glBindImageTextures",
+    "glBindVertexBuffers",
+    "glClipControl",
+    "glCreateTransformFeedbacks",
+    "glTransformFeedbackBufferBase",
+    "glTransformFeedbackBufferRange",
+    "glGetTransformFeedbackiv",
+    "glGetTransformFeedbacki_v",
+    "glGetTransformFeedbacki64_v",
+    "glCreateBuffers",
+    "glNamedBufferStorage",
+    "glNamedBufferData",
+    "glNamedBufferSubData",
+    "glCopyNamedBufferSubData",
+    "glClearNamedBufferData",
+    "glClearNamedBufferSubData",
+    "glMapNamedBuffer",
+    "glMapNamedBufferRange",
+    "glUnmapNamedBuffer",
+    "glFlushMappedNamedBufferRange",
+    "glGetNamedBufferParameteriv",
+    "glGetNamedBufferParameteri64v",
+    "glGetNamedBufferPointerv",
+    "glGetNamedBufferSubData",
+    "glCreateFramebuffers",
+    "glNamedFramebufferRenderbuffer",
+    "glNamedFramebufferParameteri",
+    "glNamedFramebufferTexture",
+    "glNamedFramebufferTextureLayer",
+    "glNamedFramebufferDrawBuffer",
+    "glNamedFramebufferDrawBuffers",
+    "glNamedFramebufferReadBuffer",
+    "glInvalidateNamedFramebufferData",
+    "glInvalidateNamedFramebufferSubData",
+    "glClearNamedFramebufferiv",
+    "glClearNamedFramebufferuiv",
+    "glClearNamedFramebufferfv",
+    "glClearNamedFramebufferfi",
+    "glBlitNamedFramebuffer",
+    "glCheckNamedFramebufferStatus",
+    "glGetNamedFramebufferParameteriv",
+    "glGetNamedFramebufferAttachmentParameteriv",
+    "glCreateRenderbuffers",
+    "glNamedRenderbufferStorage",
+    "glNamedRenderbufferStorageMultisample",
+    "glGetNamedRenderbufferParameteriv",
+    "glCreateTextures",
+    "glTextureBuffer",
+    "glTextureBufferRange",
+    "glTextureStorage1D",
+    "glTextureStorage2D",
+    "glTextureStorage3D",
+    "glTextureStorage2DMultisample",
+    "glTextureStorage3DMultisample",
+    "glTextureSubImage1D",
+    "glTextureSubImage2D",
+    "glTextureSubImage3D",
+    "glCompressedTextureSubImage1D",
+    "glCompressedTextureSubImage2D",
+    "glCompressedTextureSubImage3D",
+    "glCopyTextureSubImage1D",
+    "glCopyTextureSubImage2D",
+    "glCopyTextureSubImage3D",
+    "glTextureParameterf",
+    "glTextureParameterfv",
+    "glTextureParameteri",
+    "glTextureParameterIiv",
+    "glTextureParameterIuiv",
+    "glTextureParameteriv",
+    "glGenerateTextureMipmap",
+    "glBindTextureUnit",
+    "glGetTextureImage",
+    "glGetCompressedTextureImage",
+    "glGetTextureLevelParameterfv",
+    "glGetTextureLevelParameteriv",
+    "glGetTextureParameterfv",
+    "glGetTextureParameterIiv",
+    "glGetTextureParameterIuiv",
+    "glGetTextureParameteriv",
+    "glCreateVertexArrays",
+    "glDisableVertexArrayAttrib",
+    "glEnableVertexArrayAttrib",
+    "glVertexArrayElementBuffer",
+    "glVertexArrayVertexBuffer",
+    "glVertexArrayVertexBuffers",
+    "glVertexArrayAttribBinding",
+    "glVertexArrayAttribFormat",
+    "glVertexArrayAttribIFormat",
+    "glVertexArrayAttribLFormat",
+    "glVertexArrayBindingDivisor",
+    "glGetVertexArrayiv",
+    "glGetVertexArrayIndexediv",
+    "glGetVertexArrayIndexed64iv",
+    "glCreateSamplers",
+    "glCreateProgramPipelines",
+    "glCreateQueries",
+    "glGetQueryBufferObjecti64v",
+    "glGetQueryBufferObjectiv",
+    "glGetQueryBufferObjectui64v",
+    "glGetQueryBufferObjectuiv",
+    "glMemoryBarrierByRegion",
+    "glGetTextureSubImage",
+    "glGetCompressedTextureSubImage",
+    "glGetGraphicsResetStatus",
+    "glGetnCompressedTexImage",
+    "glGetnTexImage",
+    "glGetnUniformdv",
+    "glGetnUniformfv",
+    "glGetnUniformiv",
+    "glGetnUniformuiv",
+    "glReadnPixels",
+    "glTextureBarrier",
+    "glMaxShaderCompilerThreadsKHR"
+};
+
+#define NUM_PROFILED (sizeof(profile_names) / sizeof(profile_names[0]))
+
+struct profile_entry {
+    unsigned long long calls;
+    unsigned long long ns;
+};
+
+struct profile_table {
+    struct profile_table *next;
+    struct profile_entry entries[NUM_PROFILED];
+};
+
+static struct profile_table *profile_tables = NULL;
+static GLAD_THREAD_LOCAL struct profile_table *profile_thread_table = NULL;
+
+static struct profile_table *profile_new_table(void) {
+    struct profile_table *table = (struct profile_table *)calloc(1, sizeof(struct profile_table));
+    if(table == NULL) {
+        return NULL;
+    }
+
+#if defined(_MSC_VER)
+    do {
+        table->next = profile_tables;
+    } while(InterlockedCompareExchangePointer((PVOID volatile *)&profile_tables,
+                table, table->next) != table->next);
+#else
+    table->next = __atomic_load_n(&profile_tables, __ATOMIC_ACQUIRE);
+    while(!__atomic_compare_exchange_n(&profile_tables, &table->next, table, 1,
+                __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) {
+    }
+#endif
+
+    profile_thread_table = table;
+    return table;
+}
+
+static void profile_record(int index, unsigned long long start) {
+    unsigned long long end = now_ns();
+    struct profile_table *table = profile_thread_table;
+
+    if(table == NULL && (table = profile_new_table()) == NULL) {
+        return;
+    }
+    table->entries[index].calls++;
+    table->entries[index].ns += end - start;
+}
+
+/* The real entry points, called by the shims below. */
+static GladGLContext profile_real;
+
+static void APIENTRY glad_profile_glCullFace(GLenum mode) {
+	unsigned long long called_at = now_ns();
+	profile_real.CullFace(mode);
+	profile_record(0, called_at);
+}
+static void APIENTRY glad_profile_glFrontFace(GLenum mode) {
+	unsigned long long called_at = now_ns();
+	profile_real.FrontFace(mode);
+	profile_record(1, called_at);
+}
+static void APIENTRY glad_profile_glHint(GLenum target, GLenum mode) {
+	unsigned long long called_at = now_ns();
+	profile_real.Hint(target, mode);
+	profile_record(2, called_at);
+}
+static void APIENTRY glad_profile_glLineWidth(GLfloat width) {
+	unsigned long long called_at = now_ns();
+	profile_real.LineWidth(width);
+	profile_record(3, called_at);
+}
+static void APIENTRY glad_profile_glPointSize(GLfloat size) {
+	unsigned long long called_at = now_ns();
+	profile_real.PointSize(size);
+	profile_record(4, called_at);
+}
+static void APIENTRY glad_profile_glPolygonMode(GLenum face, GLenum mode) {
+	unsigned long long called_at = now_ns();
+	profile_real.PolygonMode(face, mode);
+	profile_record(5, called_at);
+}
+static void APIENTRY glad_profile_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.Scissor(x, y, width, height);
+	profile_record(6, called_at);
+}
+static void APIENTRY glad_profile_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexParameterf(target, pname, param);
+	profile_record(7, called_at);
+}
+static void APIENTRY glad_profile_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexParameterfv(target, pname, params);
+	profile_record(8, called_at);
+}
+static void APIENTRY glad_profile_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexParameteri(target, pname, param);
+	profile_record(9, called_at);
+}
+static void APIENTRY glad_profile_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexParameteriv(target, pname, params);
+	profile_record(10, called_at);
+}
+static void APIENTRY glad_profile_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	profile_record(11, called_at);
+}
+static void APIENTRY glad_profile_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	profile_record(12, called_at);
+}
+static void APIENTRY glad_profile_glDrawBuffer(GLenum buf) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawBuffer(buf);
+	profile_record(13, called_at);
+}
+static void APIENTRY glad_profile_glClear(GLbitfield mask) {
+	unsigned long long called_at = now_ns();
+	profile_real.Clear(mask);
+	profile_record(14, called_at);
+}
+static void APIENTRY glad_profile_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearColor(red, green, blue, alpha);
+	profile_record(15, called_at);
+}
+static void APIENTRY glad_profile_glClearStencil(GLint s) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearStencil(s);
+	profile_record(16, called_at);
+}
+static void APIENTRY glad_profile_glClearDepth(GLdouble depth) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearDepth(depth);
+	profile_record(17, called_at);
+}
+static void APIENTRY glad_profile_glStencilMask(GLuint mask) {
+	unsigned long long called_at = now_ns();
+	profile_real.StencilMask(mask);
+	profile_record(18, called_at);
+}
+static void APIENTRY glad_profile_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	unsigned long long called_at = now_ns();
+	profile_real.ColorMask(red, green, blue, alpha);
+	profile_record(19, called_at);
+}
+static void APIENTRY glad_profile_glDepthMask(GLboolean flag) {
+	unsigned long long called_at = now_ns();
+	profile_real.DepthMask(flag);
+	profile_record(20, called_at);
+}
+static void APIENTRY glad_profile_glDisable(GLenum cap) {
+	unsigned long long called_at = now_ns();
+	profile_real.Disable(cap);
+	profile_record(21, called_at);
+}
+static void APIENTRY glad_profile_glEnable(GLenum cap) {
+	unsigned long long called_at = now_ns();
+	profile_real.Enable(cap);
+	profile_record(22, called_at);
+}
+static void APIENTRY glad_profile_glFinish(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.Finish();
+	profile_record(23, called_at);
+}
+static void APIENTRY glad_profile_glFlush(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.Flush();
+	profile_record(24, called_at);
+}
+static void APIENTRY glad_profile_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendFunc(sfactor, dfactor);
+	profile_record(25, called_at);
+}
+static void APIENTRY glad_profile_glLogicOp(GLenum opcode) {
+	unsigned long long called_at = now_ns();
+	profile_real.LogicOp(opcode);
+	profile_record(26, called_at);
+}
+static void APIENTRY glad_profile_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	unsigned long long called_at = now_ns();
+	profile_real.StencilFunc(func, ref, mask);
+	profile_record(27, called_at);
+}
+static void APIENTRY glad_profile_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	unsigned long long called_at = now_ns();
+	profile_real.StencilOp(fail, zfail, zpass);
+	profile_record(28, called_at);
+}
+static void APIENTRY glad_profile_glDepthFunc(GLenum func) {
+	unsigned long long called_at = now_ns();
+	profile_real.DepthFunc(func);
+	profile_record(29, called_at);
+}
+static void APIENTRY glad_profile_glPixelStoref(GLenum pname, GLfloat param) {
+	unsigned long long called_at = now_ns();
+	profile_real.PixelStoref(pname, param);
+	profile_record(30, called_at);
+}
+static void APIENTRY glad_profile_glPixelStorei(GLenum pname, GLint param) {
+	unsigned long long called_at = now_ns();
+	profile_real.PixelStorei(pname, param);
+	profile_record(31, called_at);
+}
+static void APIENTRY glad_profile_glReadBuffer(GLenum src) {
+	unsigned long long called_at = now_ns();
+	profile_real.ReadBuffer(src);
+	profile_record(32, called_at);
+}
+static void APIENTRY glad_profile_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.ReadPixels(x, y, width, height, format, type, pixels);
+	profile_record(33, called_at);
+}
+static void APIENTRY glad_profile_glGetBooleanv(GLenum pname, GLboolean *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetBooleanv(pname, data);
+	profile_record(34, called_at);
+}
+static void APIENTRY glad_profile_glGetDoublev(GLenum pname, GLdouble *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetDoublev(pname, data);
+	profile_record(35, called_at);
+}
+static GLenum APIENTRY glad_profile_glGetError(void) {
+	GLenum result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetError();
+	profile_record(36, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetFloatv(GLenum pname, GLfloat *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetFloatv(pname, data);
+	profile_record(37, called_at);
+}
+static void APIENTRY glad_profile_glGetIntegerv(GLenum pname, GLint *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetIntegerv(pname, data);
+	profile_record(38, called_at);
+}
+static const GLubyte * APIENTRY glad_profile_glGetString(GLenum name) {
+	const GLubyte * result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetString(name);
+	profile_record(39, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTexImage(target, level, format, type, pixels);
+	profile_record(40, called_at);
+}
+static void APIENTRY glad_profile_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTexParameterfv(target, pname, params);
+	profile_record(41, called_at);
+}
+static void APIENTRY glad_profile_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTexParameteriv(target, pname, params);
+	profile_record(42, called_at);
+}
+static void APIENTRY glad_profile_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTexLevelParameterfv(target, level, pname, params);
+	profile_record(43, called_at);
+}
+static void APIENTRY glad_profile_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTexLevelParameteriv(target, level, pname, params);
+	profile_record(44, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsEnabled(GLenum cap) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsEnabled(cap);
+	profile_record(45, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glDepthRange(GLdouble n, GLdouble f) {
+	unsigned long long called_at = now_ns();
+	profile_real.DepthRange(n, f);
+	profile_record(46, called_at);
+}
+static void APIENTRY glad_profile_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.Viewport(x, y, width, height);
+	profile_record(47, called_at);
+}
+static void APIENTRY glad_profile_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawArrays(mode, first, count);
+	profile_record(48, called_at);
+}
+static void APIENTRY glad_profile_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawElements(mode, count, type, indices);
+	profile_record(49, called_at);
+}
+static void APIENTRY glad_profile_glPolygonOffset(GLfloat factor, GLfloat units) {
+	unsigned long long called_at = now_ns();
+	profile_real.PolygonOffset(factor, units);
+	profile_record(50, called_at);
+}
+static void APIENTRY glad_profile_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyTexImage1D(target, level, internalformat, x, y, width, border);
+	profile_record(51, called_at);
+}
+static void APIENTRY glad_profile_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	profile_record(52, called_at);
+}
+static void APIENTRY glad_profile_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyTexSubImage1D(target, level, xoffset, x, y, width);
+	profile_record(53, called_at);
+}
+static void APIENTRY glad_profile_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	profile_record(54, called_at);
+}
+static void APIENTRY glad_profile_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	profile_record(55, called_at);
+}
+static void APIENTRY glad_profile_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	profile_record(56, called_at);
+}
+static void APIENTRY glad_profile_glBindTexture(GLenum target, GLuint texture) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindTexture(target, texture);
+	profile_record(57, called_at);
+}
+static void APIENTRY glad_profile_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteTextures(n, textures);
+	profile_record(58, called_at);
+}
+static void APIENTRY glad_profile_glGenTextures(GLsizei n, GLuint *textures) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenTextures(n, textures);
+	profile_record(59, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsTexture(GLuint texture) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsTexture(texture);
+	profile_record(60, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawRangeElements(mode, start, end, count, type, indices);
+	profile_record(61, called_at);
+}
+static void APIENTRY glad_profile_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	profile_record(62, called_at);
+}
+static void APIENTRY glad_profile_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	profile_record(63, called_at);
+}
+static void APIENTRY glad_profile_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	profile_record(64, called_at);
+}
+static void APIENTRY glad_profile_glActiveTexture(GLenum texture) {
+	unsigned long long called_at = now_ns();
+	profile_real.ActiveTexture(texture);
+	profile_record(65, called_at);
+}
+static void APIENTRY glad_profile_glSampleCoverage(GLfloat value, GLboolean invert) {
+	unsigned long long called_at = now_ns();
+	profile_real.SampleCoverage(value, invert);
+	profile_record(66, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	profile_record(67, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	profile_record(68, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	profile_record(69, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	profile_record(70, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	profile_record(71, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	profile_record(72, called_at);
+}
+static void APIENTRY glad_profile_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetCompressedTexImage(target, level, img);
+	profile_record(73, called_at);
+}
+static void APIENTRY glad_profile_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	profile_record(74, called_at);
+}
+static void APIENTRY glad_profile_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiDrawArrays(mode, first, count, drawcount);
+	profile_record(75, called_at);
+}
+static void APIENTRY glad_profile_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiDrawElements(mode, count, type, indices, drawcount);
+	profile_record(76, called_at);
+}
+static void APIENTRY glad_profile_glPointParameterf(GLenum pname, GLfloat param) {
+	unsigned long long called_at = now_ns();
+	profile_real.PointParameterf(pname, param);
+	profile_record(77, called_at);
+}
+static void APIENTRY glad_profile_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.PointParameterfv(pname, params);
+	profile_record(78, called_at);
+}
+static void APIENTRY glad_profile_glPointParameteri(GLenum pname, GLint param) {
+	unsigned long long called_at = now_ns();
+	profile_real.PointParameteri(pname, param);
+	profile_record(79, called_at);
+}
+static void APIENTRY glad_profile_glPointParameteriv(GLenum pname, const GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.PointParameteriv(pname, params);
+	profile_record(80, called_at);
+}
+static void APIENTRY glad_profile_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendColor(red, green, blue, alpha);
+	profile_record(81, called_at);
+}
+static void APIENTRY glad_profile_glBlendEquation(GLenum mode) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendEquation(mode);
+	profile_record(82, called_at);
+}
+static void APIENTRY glad_profile_glGenQueries(GLsizei n, GLuint *ids) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenQueries(n, ids);
+	profile_record(83, called_at);
+}
+static void APIENTRY glad_profile_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteQueries(n, ids);
+	profile_record(84, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsQuery(GLuint id) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsQuery(id);
+	profile_record(85, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glBeginQuery(GLenum target, GLuint id) {
+	unsigned long long called_at = now_ns();
+	profile_real.BeginQuery(target, id);
+	profile_record(86, called_at);
+}
+static void APIENTRY glad_profile_glEndQuery(GLenum target) {
+	unsigned long long called_at = now_ns();
+	profile_real.EndQuery(target);
+	profile_record(87, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryiv(target, pname, params);
+	profile_record(88, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryObjectiv(id, pname, params);
+	profile_record(89, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryObjectuiv(id, pname, params);
+	profile_record(90, called_at);
+}
+static void APIENTRY glad_profile_glBindBuffer(GLenum target, GLuint buffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindBuffer(target, buffer);
+	profile_record(91, called_at);
+}
+static void APIENTRY glad_profile_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteBuffers(n, buffers);
+	profile_record(92, called_at);
+}
+static void APIENTRY glad_profile_glGenBuffers(GLsizei n, GLuint *buffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenBuffers(n, buffers);
+	profile_record(93, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsBuffer(GLuint buffer) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsBuffer(buffer);
+	profile_record(94, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	unsigned long long called_at = now_ns();
+	profile_real.BufferData(target, size, data, usage);
+	profile_record(95, called_at);
+}
+static void APIENTRY glad_profile_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.BufferSubData(target, offset, size, data);
+	profile_record(96, called_at);
+}
+static void APIENTRY glad_profile_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetBufferSubData(target, offset, size, data);
+	profile_record(97, called_at);
+}
+static void * APIENTRY glad_profile_glMapBuffer(GLenum target, GLenum access) {
+	void * result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.MapBuffer(target, access);
+	profile_record(98, called_at);
+	return result;
+}
+static GLboolean APIENTRY glad_profile_glUnmapBuffer(GLenum target) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.UnmapBuffer(target);
+	profile_record(99, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetBufferParameteriv(target, pname, params);
+	profile_record(100, called_at);
+}
+static void APIENTRY glad_profile_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetBufferPointerv(target, pname, params);
+	profile_record(101, called_at);
+}
+static void APIENTRY glad_profile_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendEquationSeparate(modeRGB, modeAlpha);
+	profile_record(102, called_at);
+}
+static void APIENTRY glad_profile_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawBuffers(n, bufs);
+	profile_record(103, called_at);
+}
+static void APIENTRY glad_profile_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	unsigned long long called_at = now_ns();
+	profile_real.StencilOpSeparate(face, sfail, dpfail, dppass);
+	profile_record(104, called_at);
+}
+static void APIENTRY glad_profile_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	unsigned long long called_at = now_ns();
+	profile_real.StencilFuncSeparate(face, func, ref, mask);
+	profile_record(105, called_at);
+}
+static void APIENTRY glad_profile_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	unsigned long long called_at = now_ns();
+	profile_real.StencilMaskSeparate(face, mask);
+	profile_record(106, called_at);
+}
+static void APIENTRY glad_profile_glAttachShader(GLuint program, GLuint shader) {
+	unsigned long long called_at = now_ns();
+	profile_real.AttachShader(program, shader);
+	profile_record(107, called_at);
+}
+static void APIENTRY glad_profile_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindAttribLocation(program, index, name);
+	profile_record(108, called_at);
+}
+static void APIENTRY glad_profile_glCompileShader(GLuint shader) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompileShader(shader);
+	profile_record(109, called_at);
+}
+static GLuint APIENTRY glad_profile_glCreateProgram(void) {
+	GLuint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.CreateProgram();
+	profile_record(110, called_at);
+	return result;
+}
+static GLuint APIENTRY glad_profile_glCreateShader(GLenum type) {
+	GLuint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.CreateShader(type);
+	profile_record(111, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glDeleteProgram(GLuint program) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteProgram(program);
+	profile_record(112, called_at);
+}
+static void APIENTRY glad_profile_glDeleteShader(GLuint shader) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteShader(shader);
+	profile_record(113, called_at);
+}
+static void APIENTRY glad_profile_glDetachShader(GLuint program, GLuint shader) {
+	unsigned long long called_at = now_ns();
+	profile_real.DetachShader(program, shader);
+	profile_record(114, called_at);
+}
+static void APIENTRY glad_profile_glDisableVertexAttribArray(GLuint index) {
+	unsigned long long called_at = now_ns();
+	profile_real.DisableVertexAttribArray(index);
+	profile_record(115, called_at);
+}
+static void APIENTRY glad_profile_glEnableVertexAttribArray(GLuint index) {
+	unsigned long long called_at = now_ns();
+	profile_real.EnableVertexAttribArray(index);
+	profile_record(116, called_at);
+}
+static void APIENTRY glad_profile_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveAttrib(program, index, bufSize, length, size, type, name);
+	profile_record(117, called_at);
+}
+static void APIENTRY glad_profile_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveUniform(program, index, bufSize, length, size, type, name);
+	profile_record(118, called_at);
+}
+static void APIENTRY glad_profile_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetAttachedShaders(program, maxCount, count, shaders);
+	profile_record(119, called_at);
+}
+static GLint APIENTRY glad_profile_glGetAttribLocation(GLuint program, const GLchar *name) {
+	GLint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetAttribLocation(program, name);
+	profile_record(120, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramiv(program, pname, params);
+	profile_record(121, called_at);
+}
+static void APIENTRY glad_profile_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramInfoLog(program, bufSize, length, infoLog);
+	profile_record(122, called_at);
+}
+static void APIENTRY glad_profile_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetShaderiv(shader, pname, params);
+	profile_record(123, called_at);
+}
+static void APIENTRY glad_profile_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetShaderInfoLog(shader, bufSize, length, infoLog);
+	profile_record(124, called_at);
+}
+static void APIENTRY glad_profile_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetShaderSource(shader, bufSize, length, source);
+	profile_record(125, called_at);
+}
+static GLint APIENTRY glad_profile_glGetUniformLocation(GLuint program, const GLchar *name) {
+	GLint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetUniformLocation(program, name);
+	profile_record(126, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetUniformfv(program, location, params);
+	profile_record(127, called_at);
+}
+static void APIENTRY glad_profile_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetUniformiv(program, location, params);
+	profile_record(128, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexAttribdv(index, pname, params);
+	profile_record(129, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexAttribfv(index, pname, params);
+	profile_record(130, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexAttribiv(index, pname, params);
+	profile_record(131, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexAttribPointerv(index, pname, pointer);
+	profile_record(132, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsProgram(GLuint program) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsProgram(program);
+	profile_record(133, called_at);
+	return result;
+}
+static GLboolean APIENTRY glad_profile_glIsShader(GLuint shader) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsShader(shader);
+	profile_record(134, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glLinkProgram(GLuint program) {
+	unsigned long long called_at = now_ns();
+	profile_real.LinkProgram(program);
+	profile_record(135, called_at);
+}
+static void APIENTRY glad_profile_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	unsigned long long called_at = now_ns();
+	profile_real.ShaderSource(shader, count, string, length);
+	profile_record(136, called_at);
+}
+static void APIENTRY glad_profile_glUseProgram(GLuint program) {
+	unsigned long long called_at = now_ns();
+	profile_real.UseProgram(program);
+	profile_record(137, called_at);
+}
+static void APIENTRY glad_profile_glUniform1f(GLint location, GLfloat v0) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform1f(location, v0);
+	profile_record(138, called_at);
+}
+static void APIENTRY glad_profile_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform2f(location, v0, v1);
+	profile_record(139, called_at);
+}
+static void APIENTRY glad_profile_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform3f(location, v0, v1, v2);
+	profile_record(140, called_at);
+}
+static void APIENTRY glad_profile_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform4f(location, v0, v1, v2, v3);
+	profile_record(141, called_at);
+}
+static void APIENTRY glad_profile_glUniform1i(GLint location, GLint v0) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform1i(location, v0);
+	profile_record(142, called_at);
+}
+static void APIENTRY glad_profile_glUniform2i(GLint location, GLint v0, GLint v1) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform2i(location, v0, v1);
+	profile_record(143, called_at);
+}
+static void APIENTRY glad_profile_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform3i(location, v0, v1, v2);
+	profile_record(144, called_at);
+}
+static void APIENTRY glad_profile_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform4i(location, v0, v1, v2, v3);
+	profile_record(145, called_at);
+}
+static void APIENTRY glad_profile_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform1fv(location, count, value);
+	profile_record(146, called_at);
+}
+static void APIENTRY glad_profile_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform2fv(location, count, value);
+	profile_record(147, called_at);
+}
+static void APIENTRY glad_profile_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform3fv(location, count, value);
+	profile_record(148, called_at);
+}
+static void APIENTRY glad_profile_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform4fv(location, count, value);
+	profile_record(149, called_at);
+}
+static void APIENTRY glad_profile_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform1iv(location, count, value);
+	profile_record(150, called_at);
+}
+static void APIENTRY glad_profile_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform2iv(location, count, value);
+	profile_record(151, called_at);
+}
+static void APIENTRY glad_profile_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform3iv(location, count, value);
+	profile_record(152, called_at);
+}
+static void APIENTRY glad_profile_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform4iv(location, count, value);
+	profile_record(153, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix2fv(location, count, transpose, value);
+	profile_record(154, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix3fv(location, count, transpose, value);
+	profile_record(155, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix4fv(location, count, transpose, value);
+	profile_record(156, called_at);
+}
+static void APIENTRY glad_profile_glValidateProgram(GLuint program) {
+	unsigned long long called_at = now_ns();
+	profile_real.ValidateProgram(program);
+	profile_record(157, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib1d(GLuint index, GLdouble x) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib1d(index, x);
+	profile_record(158, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib1dv(index, v);
+	profile_record(159, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib1f(GLuint index, GLfloat x) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib1f(index, x);
+	profile_record(160, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib1fv(index, v);
+	profile_record(161, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib1s(GLuint index, GLshort x) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib1s(index, x);
+	profile_record(162, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib1sv(index, v);
+	profile_record(163, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib2d(index, x, y);
+	profile_record(164, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib2dv(index, v);
+	profile_record(165, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib2f(index, x, y);
+	profile_record(166, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib2fv(index, v);
+	profile_record(167, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib2s(index, x, y);
+	profile_record(168, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib2sv(index, v);
+	profile_record(169, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib3d(index, x, y, z);
+	profile_record(170, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib3dv(index, v);
+	profile_record(171, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib3f(index, x, y, z);
+	profile_record(172, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib3fv(index, v);
+	profile_record(173, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib3s(index, x, y, z);
+	profile_record(174, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib3sv(index, v);
+	profile_record(175, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4Nbv(index, v);
+	profile_record(176, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4Niv(index, v);
+	profile_record(177, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4Nsv(index, v);
+	profile_record(178, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4Nub(index, x, y, z, w);
+	profile_record(179, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4Nubv(index, v);
+	profile_record(180, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4Nuiv(index, v);
+	profile_record(181, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4Nusv(index, v);
+	profile_record(182, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4bv(index, v);
+	profile_record(183, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4d(index, x, y, z, w);
+	profile_record(184, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4dv(index, v);
+	profile_record(185, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4f(index, x, y, z, w);
+	profile_record(186, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4fv(index, v);
+	profile_record(187, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4iv(index, v);
+	profile_record(188, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4s(index, x, y, z, w);
+	profile_record(189, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4sv(index, v);
+	profile_record(190, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4ubv(index, v);
+	profile_record(191, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4uiv(index, v);
+	profile_record(192, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttrib4usv(index, v);
+	profile_record(193, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribPointer(index, size, type, normalized, stride, pointer);
+	profile_record(194, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix2x3fv(location, count, transpose, value);
+	profile_record(195, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix3x2fv(location, count, transpose, value);
+	profile_record(196, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix2x4fv(location, count, transpose, value);
+	profile_record(197, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix4x2fv(location, count, transpose, value);
+	profile_record(198, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix3x4fv(location, count, transpose, value);
+	profile_record(199, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix4x3fv(location, count, transpose, value);
+	profile_record(200, called_at);
+}
+static void APIENTRY glad_profile_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	unsigned long long called_at = now_ns();
+	profile_real.ColorMaski(index, r, g, b, a);
+	profile_record(201, called_at);
+}
+static void APIENTRY glad_profile_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetBooleani_v(target, index, data);
+	profile_record(202, called_at);
+}
+static void APIENTRY glad_profile_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetIntegeri_v(target, index, data);
+	profile_record(203, called_at);
+}
+static void APIENTRY glad_profile_glEnablei(GLenum target, GLuint index) {
+	unsigned long long called_at = now_ns();
+	profile_real.Enablei(target, index);
+	profile_record(204, called_at);
+}
+static void APIENTRY glad_profile_glDisablei(GLenum target, GLuint index) {
+	unsigned long long called_at = now_ns();
+	profile_real.Disablei(target, index);
+	profile_record(205, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsEnabledi(GLenum target, GLuint index) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsEnabledi(target, index);
+	profile_record(206, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glBeginTransformFeedback(GLenum primitiveMode) {
+	unsigned long long called_at = now_ns();
+	profile_real.BeginTransformFeedback(primitiveMode);
+	profile_record(207, called_at);
+}
+static void APIENTRY glad_profile_glEndTransformFeedback(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.EndTransformFeedback();
+	profile_record(208, called_at);
+}
+static void APIENTRY glad_profile_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindBufferRange(target, index, buffer, offset, size);
+	profile_record(209, called_at);
+}
+static void APIENTRY glad_profile_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindBufferBase(target, index, buffer);
+	profile_record(210, called_at);
+}
+static void APIENTRY glad_profile_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	unsigned long long called_at = now_ns();
+	profile_real.TransformFeedbackVaryings(program, count, varyings, bufferMode);
+	profile_record(211, called_at);
+}
+static void APIENTRY glad_profile_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	profile_record(212, called_at);
+}
+static void APIENTRY glad_profile_glClampColor(GLenum target, GLenum clamp) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClampColor(target, clamp);
+	profile_record(213, called_at);
+}
+static void APIENTRY glad_profile_glBeginConditionalRender(GLuint id, GLenum mode) {
+	unsigned long long called_at = now_ns();
+	profile_real.BeginConditionalRender(id, mode);
+	profile_record(214, called_at);
+}
+static void APIENTRY glad_profile_glEndConditionalRender(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.EndConditionalRender();
+	profile_record(215, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribIPointer(index, size, type, stride, pointer);
+	profile_record(216, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexAttribIiv(index, pname, params);
+	profile_record(217, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexAttribIuiv(index, pname, params);
+	profile_record(218, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI1i(GLuint index, GLint x) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI1i(index, x);
+	profile_record(219, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI2i(index, x, y);
+	profile_record(220, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI3i(index, x, y, z);
+	profile_record(221, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI4i(index, x, y, z, w);
+	profile_record(222, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI1ui(GLuint index, GLuint x) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI1ui(index, x);
+	profile_record(223, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI2ui(index, x, y);
+	profile_record(224, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI3ui(index, x, y, z);
+	profile_record(225, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI4ui(index, x, y, z, w);
+	profile_record(226, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI1iv(index, v);
+	profile_record(227, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI2iv(index, v);
+	profile_record(228, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI3iv(index, v);
+	profile_record(229, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI4iv(index, v);
+	profile_record(230, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI1uiv(index, v);
+	profile_record(231, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI2uiv(index, v);
+	profile_record(232, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI3uiv(index, v);
+	profile_record(233, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI4uiv(index, v);
+	profile_record(234, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI4bv(index, v);
+	profile_record(235, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI4sv(index, v);
+	profile_record(236, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI4ubv(index, v);
+	profile_record(237, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribI4usv(index, v);
+	profile_record(238, called_at);
+}
+static void APIENTRY glad_profile_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetUniformuiv(program, location, params);
+	profile_record(239, called_at);
+}
+static void APIENTRY glad_profile_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindFragDataLocation(program, color, name);
+	profile_record(240, called_at);
+}
+static GLint APIENTRY glad_profile_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	GLint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetFragDataLocation(program, name);
+	profile_record(241, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glUniform1ui(GLint location, GLuint v0) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform1ui(location, v0);
+	profile_record(242, called_at);
+}
+static void APIENTRY glad_profile_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform2ui(location, v0, v1);
+	profile_record(243, called_at);
+}
+static void APIENTRY glad_profile_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform3ui(location, v0, v1, v2);
+	profile_record(244, called_at);
+}
+static void APIENTRY glad_profile_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform4ui(location, v0, v1, v2, v3);
+	profile_record(245, called_at);
+}
+static void APIENTRY glad_profile_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform1uiv(location, count, value);
+	profile_record(246, called_at);
+}
+static void APIENTRY glad_profile_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform2uiv(location, count, value);
+	profile_record(247, called_at);
+}
+static void APIENTRY glad_profile_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform3uiv(location, count, value);
+	profile_record(248, called_at);
+}
+static void APIENTRY glad_profile_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform4uiv(location, count, value);
+	profile_record(249, called_at);
+}
+static void APIENTRY glad_profile_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexParameterIiv(target, pname, params);
+	profile_record(250, called_at);
+}
+static void APIENTRY glad_profile_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexParameterIuiv(target, pname, params);
+	profile_record(251, called_at);
+}
+static void APIENTRY glad_profile_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTexParameterIiv(target, pname, params);
+	profile_record(252, called_at);
+}
+static void APIENTRY glad_profile_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTexParameterIuiv(target, pname, params);
+	profile_record(253, called_at);
+}
+static void APIENTRY glad_profile_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearBufferiv(buffer, drawbuffer, value);
+	profile_record(254, called_at);
+}
+static void APIENTRY glad_profile_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearBufferuiv(buffer, drawbuffer, value);
+	profile_record(255, called_at);
+}
+static void APIENTRY glad_profile_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearBufferfv(buffer, drawbuffer, value);
+	profile_record(256, called_at);
+}
+static void APIENTRY glad_profile_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearBufferfi(buffer, drawbuffer, depth, stencil);
+	profile_record(257, called_at);
+}
+static const GLubyte * APIENTRY glad_profile_glGetStringi(GLenum name, GLuint index) {
+	const GLubyte * result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetStringi(name, index);
+	profile_record(258, called_at);
+	return result;
+}
+static GLboolean APIENTRY glad_profile_glIsRenderbuffer(GLuint renderbuffer) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsRenderbuffer(renderbuffer);
+	profile_record(259, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindRenderbuffer(target, renderbuffer);
+	profile_record(260, called_at);
+}
+static void APIENTRY glad_profile_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteRenderbuffers(n, renderbuffers);
+	profile_record(261, called_at);
+}
+static void APIENTRY glad_profile_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenRenderbuffers(n, renderbuffers);
+	profile_record(262, called_at);
+}
+static void APIENTRY glad_profile_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.RenderbufferStorage(target, internalformat, width, height);
+	profile_record(263, called_at);
+}
+static void APIENTRY glad_profile_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetRenderbufferParameteriv(target, pname, params);
+	profile_record(264, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsFramebuffer(GLuint framebuffer) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsFramebuffer(framebuffer);
+	profile_record(265, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindFramebuffer(target, framebuffer);
+	profile_record(266, called_at);
+}
+static void APIENTRY glad_profile_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteFramebuffers(n, framebuffers);
+	profile_record(267, called_at);
+}
+static void APIENTRY glad_profile_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenFramebuffers(n, framebuffers);
+	profile_record(268, called_at);
+}
+static GLenum APIENTRY glad_profile_glCheckFramebufferStatus(GLenum target) {
+	GLenum result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.CheckFramebufferStatus(target);
+	profile_record(269, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	unsigned long long called_at = now_ns();
+	profile_real.FramebufferTexture1D(target, attachment, textarget, texture, level);
+	profile_record(270, called_at);
+}
+static void APIENTRY glad_profile_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	unsigned long long called_at = now_ns();
+	profile_real.FramebufferTexture2D(target, attachment, textarget, texture, level);
+	profile_record(271, called_at);
+}
+static void APIENTRY glad_profile_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	unsigned long long called_at = now_ns();
+	profile_real.FramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	profile_record(272, called_at);
+}
+static void APIENTRY glad_profile_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.FramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	profile_record(273, called_at);
+}
+static void APIENTRY glad_profile_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	profile_record(274, called_at);
+}
+static void APIENTRY glad_profile_glGenerateMipmap(GLenum target) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenerateMipmap(target);
+	profile_record(275, called_at);
+}
+static void APIENTRY glad_profile_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	profile_record(276, called_at);
+}
+static void APIENTRY glad_profile_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.RenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	profile_record(277, called_at);
+}
+static void APIENTRY glad_profile_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	unsigned long long called_at = now_ns();
+	profile_real.FramebufferTextureLayer(target, attachment, texture, level, layer);
+	profile_record(278, called_at);
+}
+static void * APIENTRY glad_profile_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void * result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.MapBufferRange(target, offset, length, access);
+	profile_record(279, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	unsigned long long called_at = now_ns();
+	profile_real.FlushMappedBufferRange(target, offset, length);
+	profile_record(280, called_at);
+}
+static void APIENTRY glad_profile_glBindVertexArray(GLuint array) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindVertexArray(array);
+	profile_record(281, called_at);
+}
+static void APIENTRY glad_profile_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteVertexArrays(n, arrays);
+	profile_record(282, called_at);
+}
+static void APIENTRY glad_profile_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenVertexArrays(n, arrays);
+	profile_record(283, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsVertexArray(GLuint array) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsVertexArray(array);
+	profile_record(284, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawArraysInstanced(mode, first, count, instancecount);
+	profile_record(285, called_at);
+}
+static void APIENTRY glad_profile_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawElementsInstanced(mode, count, type, indices, instancecount);
+	profile_record(286, called_at);
+}
+static void APIENTRY glad_profile_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexBuffer(target, internalformat, buffer);
+	profile_record(287, called_at);
+}
+static void APIENTRY glad_profile_glPrimitiveRestartIndex(GLuint index) {
+	unsigned long long called_at = now_ns();
+	profile_real.PrimitiveRestartIndex(index);
+	profile_record(288, called_at);
+}
+static void APIENTRY glad_profile_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	profile_record(289, called_at);
+}
+static void APIENTRY glad_profile_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	profile_record(290, called_at);
+}
+static void APIENTRY glad_profile_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	profile_record(291, called_at);
+}
+static void APIENTRY glad_profile_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	profile_record(292, called_at);
+}
+static GLuint APIENTRY glad_profile_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	GLuint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetUniformBlockIndex(program, uniformBlockName);
+	profile_record(293, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	profile_record(294, called_at);
+}
+static void APIENTRY glad_profile_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	profile_record(295, called_at);
+}
+static void APIENTRY glad_profile_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	profile_record(296, called_at);
+}
+static void APIENTRY glad_profile_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	profile_record(297, called_at);
+}
+static void APIENTRY glad_profile_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	profile_record(298, called_at);
+}
+static void APIENTRY glad_profile_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	profile_record(299, called_at);
+}
+static void APIENTRY glad_profile_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	profile_record(300, called_at);
+}
+static void APIENTRY glad_profile_glProvokingVertex(GLenum mode) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProvokingVertex(mode);
+	profile_record(301, called_at);
+}
+static GLsync APIENTRY glad_profile_glFenceSync(GLenum condition, GLbitfield flags) {
+	GLsync result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.FenceSync(condition, flags);
+	profile_record(302, called_at);
+	return result;
+}
+static GLboolean APIENTRY glad_profile_glIsSync(GLsync sync) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsSync(sync);
+	profile_record(303, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glDeleteSync(GLsync sync) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteSync(sync);
+	profile_record(304, called_at);
+}
+static GLenum APIENTRY glad_profile_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLenum result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.ClientWaitSync(sync, flags, timeout);
+	profile_record(305, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	unsigned long long called_at = now_ns();
+	profile_real.WaitSync(sync, flags, timeout);
+	profile_record(306, called_at);
+}
+static void APIENTRY glad_profile_glGetInteger64v(GLenum pname, GLint64 *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetInteger64v(pname, data);
+	profile_record(307, called_at);
+}
+static void APIENTRY glad_profile_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetSynciv(sync, pname, count, length, values);
+	profile_record(308, called_at);
+}
+static void APIENTRY glad_profile_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetInteger64i_v(target, index, data);
+	profile_record(309, called_at);
+}
+static void APIENTRY glad_profile_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetBufferParameteri64v(target, pname, params);
+	profile_record(310, called_at);
+}
+static void APIENTRY glad_profile_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	unsigned long long called_at = now_ns();
+	profile_real.FramebufferTexture(target, attachment, texture, level);
+	profile_record(311, called_at);
+}
+static void APIENTRY glad_profile_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	profile_record(312, called_at);
+}
+static void APIENTRY glad_profile_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	profile_record(313, called_at);
+}
+static void APIENTRY glad_profile_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetMultisamplefv(pname, index, val);
+	profile_record(314, called_at);
+}
+static void APIENTRY glad_profile_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	unsigned long long called_at = now_ns();
+	profile_real.SampleMaski(maskNumber, mask);
+	profile_record(315, called_at);
+}
+static void APIENTRY glad_profile_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindFragDataLocationIndexed(program, colorNumber, index, name);
+	profile_record(316, called_at);
+}
+static GLint APIENTRY glad_profile_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	GLint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetFragDataIndex(program, name);
+	profile_record(317, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGenSamplers(GLsizei count, GLuint *samplers) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenSamplers(count, samplers);
+	profile_record(318, called_at);
+}
+static void APIENTRY glad_profile_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteSamplers(count, samplers);
+	profile_record(319, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsSampler(GLuint sampler) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsSampler(sampler);
+	profile_record(320, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glBindSampler(GLuint unit, GLuint sampler) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindSampler(unit, sampler);
+	profile_record(321, called_at);
+}
+static void APIENTRY glad_profile_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	unsigned long long called_at = now_ns();
+	profile_real.SamplerParameteri(sampler, pname, param);
+	profile_record(322, called_at);
+}
+static void APIENTRY glad_profile_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.SamplerParameteriv(sampler, pname, param);
+	profile_record(323, called_at);
+}
+static void APIENTRY glad_profile_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	unsigned long long called_at = now_ns();
+	profile_real.SamplerParameterf(sampler, pname, param);
+	profile_record(324, called_at);
+}
+static void APIENTRY glad_profile_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.SamplerParameterfv(sampler, pname, param);
+	profile_record(325, called_at);
+}
+static void APIENTRY glad_profile_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.SamplerParameterIiv(sampler, pname, param);
+	profile_record(326, called_at);
+}
+static void APIENTRY glad_profile_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.SamplerParameterIuiv(sampler, pname, param);
+	profile_record(327, called_at);
+}
+static void APIENTRY glad_profile_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetSamplerParameteriv(sampler, pname, params);
+	profile_record(328, called_at);
+}
+static void APIENTRY glad_profile_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetSamplerParameterIiv(sampler, pname, params);
+	profile_record(329, called_at);
+}
+static void APIENTRY glad_profile_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetSamplerParameterfv(sampler, pname, params);
+	profile_record(330, called_at);
+}
+static void APIENTRY glad_profile_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetSamplerParameterIuiv(sampler, pname, params);
+	profile_record(331, called_at);
+}
+static void APIENTRY glad_profile_glQueryCounter(GLuint id, GLenum target) {
+	unsigned long long called_at = now_ns();
+	profile_real.QueryCounter(id, target);
+	profile_record(332, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryObjecti64v(id, pname, params);
+	profile_record(333, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryObjectui64v(id, pname, params);
+	profile_record(334, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribDivisor(index, divisor);
+	profile_record(335, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribP1ui(index, type, normalized, value);
+	profile_record(336, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribP1uiv(index, type, normalized, value);
+	profile_record(337, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribP2ui(index, type, normalized, value);
+	profile_record(338, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribP2uiv(index, type, normalized, value);
+	profile_record(339, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribP3ui(index, type, normalized, value);
+	profile_record(340, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribP3uiv(index, type, normalized, value);
+	profile_record(341, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribP4ui(index, type, normalized, value);
+	profile_record(342, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribP4uiv(index, type, normalized, value);
+	profile_record(343, called_at);
+}
+static void APIENTRY glad_profile_glVertexP2ui(GLenum type, GLuint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexP2ui(type, value);
+	profile_record(344, called_at);
+}
+static void APIENTRY glad_profile_glVertexP2uiv(GLenum type, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexP2uiv(type, value);
+	profile_record(345, called_at);
+}
+static void APIENTRY glad_profile_glVertexP3ui(GLenum type, GLuint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexP3ui(type, value);
+	profile_record(346, called_at);
+}
+static void APIENTRY glad_profile_glVertexP3uiv(GLenum type, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexP3uiv(type, value);
+	profile_record(347, called_at);
+}
+static void APIENTRY glad_profile_glVertexP4ui(GLenum type, GLuint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexP4ui(type, value);
+	profile_record(348, called_at);
+}
+static void APIENTRY glad_profile_glVertexP4uiv(GLenum type, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexP4uiv(type, value);
+	profile_record(349, called_at);
+}
+static void APIENTRY glad_profile_glTexCoordP1ui(GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexCoordP1ui(type, coords);
+	profile_record(350, called_at);
+}
+static void APIENTRY glad_profile_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexCoordP1uiv(type, coords);
+	profile_record(351, called_at);
+}
+static void APIENTRY glad_profile_glTexCoordP2ui(GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexCoordP2ui(type, coords);
+	profile_record(352, called_at);
+}
+static void APIENTRY glad_profile_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexCoordP2uiv(type, coords);
+	profile_record(353, called_at);
+}
+static void APIENTRY glad_profile_glTexCoordP3ui(GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexCoordP3ui(type, coords);
+	profile_record(354, called_at);
+}
+static void APIENTRY glad_profile_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexCoordP3uiv(type, coords);
+	profile_record(355, called_at);
+}
+static void APIENTRY glad_profile_glTexCoordP4ui(GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexCoordP4ui(type, coords);
+	profile_record(356, called_at);
+}
+static void APIENTRY glad_profile_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexCoordP4uiv(type, coords);
+	profile_record(357, called_at);
+}
+static void APIENTRY glad_profile_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiTexCoordP1ui(texture, type, coords);
+	profile_record(358, called_at);
+}
+static void APIENTRY glad_profile_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiTexCoordP1uiv(texture, type, coords);
+	profile_record(359, called_at);
+}
+static void APIENTRY glad_profile_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiTexCoordP2ui(texture, type, coords);
+	profile_record(360, called_at);
+}
+static void APIENTRY glad_profile_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiTexCoordP2uiv(texture, type, coords);
+	profile_record(361, called_at);
+}
+static void APIENTRY glad_profile_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiTexCoordP3ui(texture, type, coords);
+	profile_record(362, called_at);
+}
+static void APIENTRY glad_profile_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiTexCoordP3uiv(texture, type, coords);
+	profile_record(363, called_at);
+}
+static void APIENTRY glad_profile_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiTexCoordP4ui(texture, type, coords);
+	profile_record(364, called_at);
+}
+static void APIENTRY glad_profile_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiTexCoordP4uiv(texture, type, coords);
+	profile_record(365, called_at);
+}
+static void APIENTRY glad_profile_glNormalP3ui(GLenum type, GLuint coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.NormalP3ui(type, coords);
+	profile_record(366, called_at);
+}
+static void APIENTRY glad_profile_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	unsigned long long called_at = now_ns();
+	profile_real.NormalP3uiv(type, coords);
+	profile_record(367, called_at);
+}
+static void APIENTRY glad_profile_glColorP3ui(GLenum type, GLuint color) {
+	unsigned long long called_at = now_ns();
+	profile_real.ColorP3ui(type, color);
+	profile_record(368, called_at);
+}
+static void APIENTRY glad_profile_glColorP3uiv(GLenum type, const GLuint *color) {
+	unsigned long long called_at = now_ns();
+	profile_real.ColorP3uiv(type, color);
+	profile_record(369, called_at);
+}
+static void APIENTRY glad_profile_glColorP4ui(GLenum type, GLuint color) {
+	unsigned long long called_at = now_ns();
+	profile_real.ColorP4ui(type, color);
+	profile_record(370, called_at);
+}
+static void APIENTRY glad_profile_glColorP4uiv(GLenum type, const GLuint *color) {
+	unsigned long long called_at = now_ns();
+	profile_real.ColorP4uiv(type, color);
+	profile_record(371, called_at);
+}
+static void APIENTRY glad_profile_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	unsigned long long called_at = now_ns();
+	profile_real.SecondaryColorP3ui(type, color);
+	profile_record(372, called_at);
+}
+static void APIENTRY glad_profile_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	unsigned long long called_at = now_ns();
+	profile_real.SecondaryColorP3uiv(type, color);
+	profile_record(373, called_at);
+}
+static void APIENTRY glad_profile_glMinSampleShading(GLfloat value) {
+	unsigned long long called_at = now_ns();
+	profile_real.MinSampleShading(value);
+	profile_record(374, called_at);
+}
+static void APIENTRY glad_profile_glBlendEquationi(GLuint buf, GLenum mode) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendEquationi(buf, mode);
+	profile_record(375, called_at);
+}
+static void APIENTRY glad_profile_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendEquationSeparatei(buf, modeRGB, modeAlpha);
+	profile_record(376, called_at);
+}
+static void APIENTRY glad_profile_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendFunci(buf, src, dst);
+	profile_record(377, called_at);
+}
+static void APIENTRY glad_profile_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+	profile_record(378, called_at);
+}
+static void APIENTRY glad_profile_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawArraysIndirect(mode, indirect);
+	profile_record(379, called_at);
+}
+static void APIENTRY glad_profile_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawElementsIndirect(mode, type, indirect);
+	profile_record(380, called_at);
+}
+static void APIENTRY glad_profile_glUniform1d(GLint location, GLdouble x) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform1d(location, x);
+	profile_record(381, called_at);
+}
+static void APIENTRY glad_profile_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform2d(location, x, y);
+	profile_record(382, called_at);
+}
+static void APIENTRY glad_profile_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform3d(location, x, y, z);
+	profile_record(383, called_at);
+}
+static void APIENTRY glad_profile_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform4d(location, x, y, z, w);
+	profile_record(384, called_at);
+}
+static void APIENTRY glad_profile_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform1dv(location, count, value);
+	profile_record(385, called_at);
+}
+static void APIENTRY glad_profile_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform2dv(location, count, value);
+	profile_record(386, called_at);
+}
+static void APIENTRY glad_profile_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform3dv(location, count, value);
+	profile_record(387, called_at);
+}
+static void APIENTRY glad_profile_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.Uniform4dv(location, count, value);
+	profile_record(388, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix2dv(location, count, transpose, value);
+	profile_record(389, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix3dv(location, count, transpose, value);
+	profile_record(390, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix4dv(location, count, transpose, value);
+	profile_record(391, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix2x3dv(location, count, transpose, value);
+	profile_record(392, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix2x4dv(location, count, transpose, value);
+	profile_record(393, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix3x2dv(location, count, transpose, value);
+	profile_record(394, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix3x4dv(location, count, transpose, value);
+	profile_record(395, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix4x2dv(location, count, transpose, value);
+	profile_record(396, called_at);
+}
+static void APIENTRY glad_profile_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformMatrix4x3dv(location, count, transpose, value);
+	profile_record(397, called_at);
+}
+static void APIENTRY glad_profile_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetUniformdv(program, location, params);
+	profile_record(398, called_at);
+}
+static GLint APIENTRY glad_profile_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+	GLint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetSubroutineUniformLocation(program, shadertype, name);
+	profile_record(399, called_at);
+	return result;
+}
+static GLuint APIENTRY glad_profile_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+	GLuint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetSubroutineIndex(program, shadertype, name);
+	profile_record(400, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+	profile_record(401, called_at);
+}
+static void APIENTRY glad_profile_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+	profile_record(402, called_at);
+}
+static void APIENTRY glad_profile_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+	profile_record(403, called_at);
+}
+static void APIENTRY glad_profile_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	unsigned long long called_at = now_ns();
+	profile_real.UniformSubroutinesuiv(shadertype, count, indices);
+	profile_record(404, called_at);
+}
+static void APIENTRY glad_profile_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetUniformSubroutineuiv(shadertype, location, params);
+	profile_record(405, called_at);
+}
+static void APIENTRY glad_profile_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramStageiv(program, shadertype, pname, values);
+	profile_record(406, called_at);
+}
+static void APIENTRY glad_profile_glPatchParameteri(GLenum pname, GLint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.PatchParameteri(pname, value);
+	profile_record(407, called_at);
+}
+static void APIENTRY glad_profile_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	unsigned long long called_at = now_ns();
+	profile_real.PatchParameterfv(pname, values);
+	profile_record(408, called_at);
+}
+static void APIENTRY glad_profile_glBindTransformFeedback(GLenum target, GLuint id) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindTransformFeedback(target, id);
+	profile_record(409, called_at);
+}
+static void APIENTRY glad_profile_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteTransformFeedbacks(n, ids);
+	profile_record(410, called_at);
+}
+static void APIENTRY glad_profile_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenTransformFeedbacks(n, ids);
+	profile_record(411, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsTransformFeedback(GLuint id) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsTransformFeedback(id);
+	profile_record(412, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glPauseTransformFeedback(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.PauseTransformFeedback();
+	profile_record(413, called_at);
+}
+static void APIENTRY glad_profile_glResumeTransformFeedback(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.ResumeTransformFeedback();
+	profile_record(414, called_at);
+}
+static void APIENTRY glad_profile_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawTransformFeedback(mode, id);
+	profile_record(415, called_at);
+}
+static void APIENTRY glad_profile_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawTransformFeedbackStream(mode, id, stream);
+	profile_record(416, called_at);
+}
+static void APIENTRY glad_profile_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	unsigned long long called_at = now_ns();
+	profile_real.BeginQueryIndexed(target, index, id);
+	profile_record(417, called_at);
+}
+static void APIENTRY glad_profile_glEndQueryIndexed(GLenum target, GLuint index) {
+	unsigned long long called_at = now_ns();
+	profile_real.EndQueryIndexed(target, index);
+	profile_record(418, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryIndexediv(target, index, pname, params);
+	profile_record(419, called_at);
+}
+static void APIENTRY glad_profile_glReleaseShaderCompiler(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.ReleaseShaderCompiler();
+	profile_record(420, called_at);
+}
+static void APIENTRY glad_profile_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+	unsigned long long called_at = now_ns();
+	profile_real.ShaderBinary(count, shaders, binaryFormat, binary, length);
+	profile_record(421, called_at);
+}
+static void APIENTRY glad_profile_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+	profile_record(422, called_at);
+}
+static void APIENTRY glad_profile_glDepthRangef(GLfloat n, GLfloat f) {
+	unsigned long long called_at = now_ns();
+	profile_real.DepthRangef(n, f);
+	profile_record(423, called_at);
+}
+static void APIENTRY glad_profile_glClearDepthf(GLfloat d) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearDepthf(d);
+	profile_record(424, called_at);
+}
+static void APIENTRY glad_profile_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramBinary(program, bufSize, length, binaryFormat, binary);
+	profile_record(425, called_at);
+}
+static void APIENTRY glad_profile_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramBinary(program, binaryFormat, binary, length);
+	profile_record(426, called_at);
+}
+static void APIENTRY glad_profile_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramParameteri(program, pname, value);
+	profile_record(427, called_at);
+}
+static void APIENTRY glad_profile_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	unsigned long long called_at = now_ns();
+	profile_real.UseProgramStages(pipeline, stages, program);
+	profile_record(428, called_at);
+}
+static void APIENTRY glad_profile_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	unsigned long long called_at = now_ns();
+	profile_real.ActiveShaderProgram(pipeline, program);
+	profile_record(429, called_at);
+}
+static GLuint APIENTRY glad_profile_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	GLuint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.CreateShaderProgramv(type, count, strings);
+	profile_record(430, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glBindProgramPipeline(GLuint pipeline) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindProgramPipeline(pipeline);
+	profile_record(431, called_at);
+}
+static void APIENTRY glad_profile_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	unsigned long long called_at = now_ns();
+	profile_real.DeleteProgramPipelines(n, pipelines);
+	profile_record(432, called_at);
+}
+static void APIENTRY glad_profile_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenProgramPipelines(n, pipelines);
+	profile_record(433, called_at);
+}
+static GLboolean APIENTRY glad_profile_glIsProgramPipeline(GLuint pipeline) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.IsProgramPipeline(pipeline);
+	profile_record(434, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramPipelineiv(pipeline, pname, params);
+	profile_record(435, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform1i(program, location, v0);
+	profile_record(436, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform1iv(program, location, count, value);
+	profile_record(437, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform1f(program, location, v0);
+	profile_record(438, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform1fv(program, location, count, value);
+	profile_record(439, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform1d(program, location, v0);
+	profile_record(440, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform1dv(program, location, count, value);
+	profile_record(441, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform1ui(program, location, v0);
+	profile_record(442, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform1uiv(program, location, count, value);
+	profile_record(443, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform2i(program, location, v0, v1);
+	profile_record(444, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform2iv(program, location, count, value);
+	profile_record(445, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform2f(program, location, v0, v1);
+	profile_record(446, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform2fv(program, location, count, value);
+	profile_record(447, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform2d(program, location, v0, v1);
+	profile_record(448, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform2dv(program, location, count, value);
+	profile_record(449, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform2ui(program, location, v0, v1);
+	profile_record(450, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform2uiv(program, location, count, value);
+	profile_record(451, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform3i(program, location, v0, v1, v2);
+	profile_record(452, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform3iv(program, location, count, value);
+	profile_record(453, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform3f(program, location, v0, v1, v2);
+	profile_record(454, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform3fv(program, location, count, value);
+	profile_record(455, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform3d(program, location, v0, v1, v2);
+	profile_record(456, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform3dv(program, location, count, value);
+	profile_record(457, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform3ui(program, location, v0, v1, v2);
+	profile_record(458, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform3uiv(program, location, count, value);
+	profile_record(459, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform4i(program, location, v0, v1, v2, v3);
+	profile_record(460, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform4iv(program, location, count, value);
+	profile_record(461, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform4f(program, location, v0, v1, v2, v3);
+	profile_record(462, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform4fv(program, location, count, value);
+	profile_record(463, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform4d(program, location, v0, v1, v2, v3);
+	profile_record(464, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform4dv(program, location, count, value);
+	profile_record(465, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform4ui(program, location, v0, v1, v2, v3);
+	profile_record(466, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniform4uiv(program, location, count, value);
+	profile_record(467, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix2fv(program, location, count, transpose, value);
+	profile_record(468, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix3fv(program, location, count, transpose, value);
+	profile_record(469, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix4fv(program, location, count, transpose, value);
+	profile_record(470, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix2dv(program, location, count, transpose, value);
+	profile_record(471, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix3dv(program, location, count, transpose, value);
+	profile_record(472, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix4dv(program, location, count, transpose, value);
+	profile_record(473, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+	profile_record(474, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+	profile_record(475, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+	profile_record(476, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+	profile_record(477, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+	profile_record(478, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+	profile_record(479, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+	profile_record(480, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+	profile_record(481, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+	profile_record(482, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+	profile_record(483, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+	profile_record(484, called_at);
+}
+static void APIENTRY glad_profile_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+	profile_record(485, called_at);
+}
+static void APIENTRY glad_profile_glValidateProgramPipeline(GLuint pipeline) {
+	unsigned long long called_at = now_ns();
+	profile_real.ValidateProgramPipeline(pipeline);
+	profile_record(486, called_at);
+}
+static void APIENTRY glad_profile_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+	profile_record(487, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribL1d(GLuint index, GLdouble x) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribL1d(index, x);
+	profile_record(488, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribL2d(index, x, y);
+	profile_record(489, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribL3d(index, x, y, z);
+	profile_record(490, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribL4d(index, x, y, z, w);
+	profile_record(491, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribL1dv(index, v);
+	profile_record(492, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribL2dv(index, v);
+	profile_record(493, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribL3dv(index, v);
+	profile_record(494, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribL4dv(index, v);
+	profile_record(495, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribLPointer(index, size, type, stride, pointer);
+	profile_record(496, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexAttribLdv(index, pname, params);
+	profile_record(497, called_at);
+}
+static void APIENTRY glad_profile_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.ViewportArrayv(first, count, v);
+	profile_record(498, called_at);
+}
+static void APIENTRY glad_profile_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	unsigned long long called_at = now_ns();
+	profile_real.ViewportIndexedf(index, x, y, w, h);
+	profile_record(499, called_at);
+}
+static void APIENTRY glad_profile_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.ViewportIndexedfv(index, v);
+	profile_record(500, called_at);
+}
+static void APIENTRY glad_profile_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.ScissorArrayv(first, count, v);
+	profile_record(501, called_at);
+}
+static void APIENTRY glad_profile_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.ScissorIndexed(index, left, bottom, width, height);
+	profile_record(502, called_at);
+}
+static void APIENTRY glad_profile_glScissorIndexedv(GLuint index, const GLint *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.ScissorIndexedv(index, v);
+	profile_record(503, called_at);
+}
+static void APIENTRY glad_profile_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	unsigned long long called_at = now_ns();
+	profile_real.DepthRangeArrayv(first, count, v);
+	profile_record(504, called_at);
+}
+static void APIENTRY glad_profile_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	unsigned long long called_at = now_ns();
+	profile_real.DepthRangeIndexed(index, n, f);
+	profile_record(505, called_at);
+}
+static void APIENTRY glad_profile_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetFloati_v(target, index, data);
+	profile_record(506, called_at);
+}
+static void APIENTRY glad_profile_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetDoublei_v(target, index, data);
+	profile_record(507, called_at);
+}
+static void APIENTRY glad_profile_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+	profile_record(508, called_at);
+}
+static void APIENTRY glad_profile_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+	profile_record(509, called_at);
+}
+static void APIENTRY glad_profile_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+	profile_record(510, called_at);
+}
+static void APIENTRY glad_profile_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetInternalformativ(target, internalformat, pname, count, params);
+	profile_record(511, called_at);
+}
+static void APIENTRY glad_profile_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+	profile_record(512, called_at);
+}
+static void APIENTRY glad_profile_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindImageTexture(unit, texture, level, layered, layer, access, format);
+	profile_record(513, called_at);
+}
+static void APIENTRY glad_profile_glMemoryBarrier(GLbitfield barriers) {
+	unsigned long long called_at = now_ns();
+	profile_real.MemoryBarrier(barriers);
+	profile_record(514, called_at);
+}
+static void APIENTRY glad_profile_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexStorage1D(target, levels, internalformat, width);
+	profile_record(515, called_at);
+}
+static void APIENTRY glad_profile_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexStorage2D(target, levels, internalformat, width, height);
+	profile_record(516, called_at);
+}
+static void APIENTRY glad_profile_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexStorage3D(target, levels, internalformat, width, height, depth);
+	profile_record(517, called_at);
+}
+static void APIENTRY glad_profile_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawTransformFeedbackInstanced(mode, id, instancecount);
+	profile_record(518, called_at);
+}
+static void APIENTRY glad_profile_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	unsigned long long called_at = now_ns();
+	profile_real.DrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+	profile_record(519, called_at);
+}
+static void APIENTRY glad_profile_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearBufferData(target, internalformat, format, type, data);
+	profile_record(520, called_at);
+}
+static void APIENTRY glad_profile_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearBufferSubData(target, internalformat, offset, size, format, type, data);
+	profile_record(521, called_at);
+}
+static void APIENTRY glad_profile_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	unsigned long long called_at = now_ns();
+	profile_real.DispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+	profile_record(522, called_at);
+}
+static void APIENTRY glad_profile_glDispatchComputeIndirect(GLintptr indirect) {
+	unsigned long long called_at = now_ns();
+	profile_real.DispatchComputeIndirect(indirect);
+	profile_record(523, called_at);
+}
+static void APIENTRY glad_profile_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+	profile_record(524, called_at);
+}
+static void APIENTRY glad_profile_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	unsigned long long called_at = now_ns();
+	profile_real.FramebufferParameteri(target, pname, param);
+	profile_record(525, called_at);
+}
+static void APIENTRY glad_profile_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetFramebufferParameteriv(target, pname, params);
+	profile_record(526, called_at);
+}
+static void APIENTRY glad_profile_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetInternalformati64v(target, internalformat, pname, count, params);
+	profile_record(527, called_at);
+}
+static void APIENTRY glad_profile_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	unsigned long long called_at = now_ns();
+	profile_real.InvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+	profile_record(528, called_at);
+}
+static void APIENTRY glad_profile_glInvalidateTexImage(GLuint texture, GLint level) {
+	unsigned long long called_at = now_ns();
+	profile_real.InvalidateTexImage(texture, level);
+	profile_record(529, called_at);
+}
+static void APIENTRY glad_profile_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	unsigned long long called_at = now_ns();
+	profile_real.InvalidateBufferSubData(buffer, offset, length);
+	profile_record(530, called_at);
+}
+static void APIENTRY glad_profile_glInvalidateBufferData(GLuint buffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.InvalidateBufferData(buffer);
+	profile_record(531, called_at);
+}
+static void APIENTRY glad_profile_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	unsigned long long called_at = now_ns();
+	profile_real.InvalidateFramebuffer(target, numAttachments, attachments);
+	profile_record(532, called_at);
+}
+static void APIENTRY glad_profile_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.InvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+	profile_record(533, called_at);
+}
+static void APIENTRY glad_profile_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+	profile_record(534, called_at);
+}
+static void APIENTRY glad_profile_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	unsigned long long called_at = now_ns();
+	profile_real.MultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+	profile_record(535, called_at);
+}
+static void APIENTRY glad_profile_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramInterfaceiv(program, programInterface, pname, params);
+	profile_record(536, called_at);
+}
+static GLuint APIENTRY glad_profile_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	GLuint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetProgramResourceIndex(program, programInterface, name);
+	profile_record(537, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramResourceName(program, programInterface, index, bufSize, length, name);
+	profile_record(538, called_at);
+}
+static void APIENTRY glad_profile_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+	profile_record(539, called_at);
+}
+static GLint APIENTRY glad_profile_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+	GLint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetProgramResourceLocation(program, programInterface, name);
+	profile_record(540, called_at);
+	return result;
+}
+static GLint APIENTRY glad_profile_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	GLint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetProgramResourceLocationIndex(program, programInterface, name);
+	profile_record(541, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	unsigned long long called_at = now_ns();
+	profile_real.ShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+	profile_record(542, called_at);
+}
+static void APIENTRY glad_profile_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexBufferRange(target, internalformat, buffer, offset, size);
+	profile_record(543, called_at);
+}
+static void APIENTRY glad_profile_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	profile_record(544, called_at);
+}
+static void APIENTRY glad_profile_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	unsigned long long called_at = now_ns();
+	profile_real.TexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	profile_record(545, called_at);
+}
+static void APIENTRY glad_profile_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+	profile_record(546, called_at);
+}
+static void APIENTRY glad_profile_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindVertexBuffer(bindingindex, buffer, offset, stride);
+	profile_record(547, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+	profile_record(548, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribIFormat(attribindex, size, type, relativeoffset);
+	profile_record(549, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribLFormat(attribindex, size, type, relativeoffset);
+	profile_record(550, called_at);
+}
+static void APIENTRY glad_profile_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexAttribBinding(attribindex, bindingindex);
+	profile_record(551, called_at);
+}
+static void APIENTRY glad_profile_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexBindingDivisor(bindingindex, divisor);
+	profile_record(552, called_at);
+}
+static void APIENTRY glad_profile_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	unsigned long long called_at = now_ns();
+	profile_real.DebugMessageControl(source, type, severity, count, ids, enabled);
+	profile_record(553, called_at);
+}
+static void APIENTRY glad_profile_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	unsigned long long called_at = now_ns();
+	profile_real.DebugMessageInsert(source, type, id, severity, length, buf);
+	profile_record(554, called_at);
+}
+static void APIENTRY glad_profile_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	unsigned long long called_at = now_ns();
+	profile_real.DebugMessageCallback(callback, userParam);
+	profile_record(555, called_at);
+}
+static GLuint APIENTRY glad_profile_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	GLuint result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+	profile_record(556, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	unsigned long long called_at = now_ns();
+	profile_real.PushDebugGroup(source, id, length, message);
+	profile_record(557, called_at);
+}
+static void APIENTRY glad_profile_glPopDebugGroup(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.PopDebugGroup();
+	profile_record(558, called_at);
+}
+static void APIENTRY glad_profile_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	unsigned long long called_at = now_ns();
+	profile_real.ObjectLabel(identifier, name, length, label);
+	profile_record(559, called_at);
+}
+static void APIENTRY glad_profile_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetObjectLabel(identifier, name, bufSize, length, label);
+	profile_record(560, called_at);
+}
+static void APIENTRY glad_profile_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	unsigned long long called_at = now_ns();
+	profile_real.ObjectPtrLabel(ptr, length, label);
+	profile_record(561, called_at);
+}
+static void APIENTRY glad_profile_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetObjectPtrLabel(ptr, bufSize, length, label);
+	profile_record(562, called_at);
+}
+static void APIENTRY glad_profile_glGetPointerv(GLenum pname, void **params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetPointerv(pname, params);
+	profile_record(563, called_at);
+}
+static void APIENTRY glad_profile_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	unsigned long long called_at = now_ns();
+	profile_real.BufferStorage(target, size, data, flags);
+	profile_record(564, called_at);
+}
+static void APIENTRY glad_profile_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearTexImage(texture, level, format, type, data);
+	profile_record(565, called_at);
+}
+static void APIENTRY glad_profile_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+	profile_record(566, called_at);
+}
+static void APIENTRY glad_profile_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindBuffersBase(target, first, count, buffers);
+	profile_record(567, called_at);
+}
+static void APIENTRY glad_profile_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindBuffersRange(target, first, count, buffers, offsets, sizes);
+	profile_record(568, called_at);
+}
+static void APIENTRY glad_profile_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindTextures(first, count, textures);
+	profile_record(569, called_at);
+}
+static void APIENTRY glad_profile_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindSamplers(first, count, samplers);
+	profile_record(570, called_at);
+}
+static void APIENTRY glad_profile_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindImageTextures(first, count, textures);
+	profile_record(571, called_at);
+}
+static void APIENTRY glad_profile_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindVertexBuffers(first, count, buffers, offsets, strides);
+	profile_record(572, called_at);
+}
+static void APIENTRY glad_profile_glClipControl(GLenum origin, GLenum depth) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClipControl(origin, depth);
+	profile_record(573, called_at);
+}
+static void APIENTRY glad_profile_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateTransformFeedbacks(n, ids);
+	profile_record(574, called_at);
+}
+static void APIENTRY glad_profile_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.TransformFeedbackBufferBase(xfb, index, buffer);
+	profile_record(575, called_at);
+}
+static void APIENTRY glad_profile_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	unsigned long long called_at = now_ns();
+	profile_real.TransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+	profile_record(576, called_at);
+}
+static void APIENTRY glad_profile_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTransformFeedbackiv(xfb, pname, param);
+	profile_record(577, called_at);
+}
+static void APIENTRY glad_profile_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTransformFeedbacki_v(xfb, pname, index, param);
+	profile_record(578, called_at);
+}
+static void APIENTRY glad_profile_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTransformFeedbacki64_v(xfb, pname, index, param);
+	profile_record(579, called_at);
+}
+static void APIENTRY glad_profile_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateBuffers(n, buffers);
+	profile_record(580, called_at);
+}
+static void APIENTRY glad_profile_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedBufferStorage(buffer, size, data, flags);
+	profile_record(581, called_at);
+}
+static void APIENTRY glad_profile_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedBufferData(buffer, size, data, usage);
+	profile_record(582, called_at);
+}
+static void APIENTRY glad_profile_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedBufferSubData(buffer, offset, size, data);
+	profile_record(583, called_at);
+}
+static void APIENTRY glad_profile_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+	profile_record(584, called_at);
+}
+static void APIENTRY glad_profile_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearNamedBufferData(buffer, internalformat, format, type, data);
+	profile_record(585, called_at);
+}
+static void APIENTRY glad_profile_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+	profile_record(586, called_at);
+}
+static void * APIENTRY glad_profile_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	void * result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.MapNamedBuffer(buffer, access);
+	profile_record(587, called_at);
+	return result;
+}
+static void * APIENTRY glad_profile_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void * result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.MapNamedBufferRange(buffer, offset, length, access);
+	profile_record(588, called_at);
+	return result;
+}
+static GLboolean APIENTRY glad_profile_glUnmapNamedBuffer(GLuint buffer) {
+	GLboolean result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.UnmapNamedBuffer(buffer);
+	profile_record(589, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	unsigned long long called_at = now_ns();
+	profile_real.FlushMappedNamedBufferRange(buffer, offset, length);
+	profile_record(590, called_at);
+}
+static void APIENTRY glad_profile_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetNamedBufferParameteriv(buffer, pname, params);
+	profile_record(591, called_at);
+}
+static void APIENTRY glad_profile_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetNamedBufferParameteri64v(buffer, pname, params);
+	profile_record(592, called_at);
+}
+static void APIENTRY glad_profile_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetNamedBufferPointerv(buffer, pname, params);
+	profile_record(593, called_at);
+}
+static void APIENTRY glad_profile_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetNamedBufferSubData(buffer, offset, size, data);
+	profile_record(594, called_at);
+}
+static void APIENTRY glad_profile_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateFramebuffers(n, framebuffers);
+	profile_record(595, called_at);
+}
+static void APIENTRY glad_profile_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+	profile_record(596, called_at);
+}
+static void APIENTRY glad_profile_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedFramebufferParameteri(framebuffer, pname, param);
+	profile_record(597, called_at);
+}
+static void APIENTRY glad_profile_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedFramebufferTexture(framebuffer, attachment, texture, level);
+	profile_record(598, called_at);
+}
+static void APIENTRY glad_profile_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+	profile_record(599, called_at);
+}
+static void APIENTRY glad_profile_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedFramebufferDrawBuffer(framebuffer, buf);
+	profile_record(600, called_at);
+}
+static void APIENTRY glad_profile_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedFramebufferDrawBuffers(framebuffer, n, bufs);
+	profile_record(601, called_at);
+}
+static void APIENTRY glad_profile_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedFramebufferReadBuffer(framebuffer, src);
+	profile_record(602, called_at);
+}
+static void APIENTRY glad_profile_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	unsigned long long called_at = now_ns();
+	profile_real.InvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+	profile_record(603, called_at);
+}
+static void APIENTRY glad_profile_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.InvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+	profile_record(604, called_at);
+}
+static void APIENTRY glad_profile_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+	profile_record(605, called_at);
+}
+static void APIENTRY glad_profile_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+	profile_record(606, called_at);
+}
+static void APIENTRY glad_profile_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+	profile_record(607, called_at);
+}
+static void APIENTRY glad_profile_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	unsigned long long called_at = now_ns();
+	profile_real.ClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+	profile_record(608, called_at);
+}
+static void APIENTRY glad_profile_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	unsigned long long called_at = now_ns();
+	profile_real.BlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	profile_record(609, called_at);
+}
+static GLenum APIENTRY glad_profile_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	GLenum result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.CheckNamedFramebufferStatus(framebuffer, target);
+	profile_record(610, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetNamedFramebufferParameteriv(framebuffer, pname, param);
+	profile_record(611, called_at);
+}
+static void APIENTRY glad_profile_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+	profile_record(612, called_at);
+}
+static void APIENTRY glad_profile_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateRenderbuffers(n, renderbuffers);
+	profile_record(613, called_at);
+}
+static void APIENTRY glad_profile_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+	profile_record(614, called_at);
+}
+static void APIENTRY glad_profile_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.NamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+	profile_record(615, called_at);
+}
+static void APIENTRY glad_profile_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+	profile_record(616, called_at);
+}
+static void APIENTRY glad_profile_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateTextures(target, n, textures);
+	profile_record(617, called_at);
+}
+static void APIENTRY glad_profile_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureBuffer(texture, internalformat, buffer);
+	profile_record(618, called_at);
+}
+static void APIENTRY glad_profile_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureBufferRange(texture, internalformat, buffer, offset, size);
+	profile_record(619, called_at);
+}
+static void APIENTRY glad_profile_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureStorage1D(texture, levels, internalformat, width);
+	profile_record(620, called_at);
+}
+static void APIENTRY glad_profile_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureStorage2D(texture, levels, internalformat, width, height);
+	profile_record(621, called_at);
+}
+static void APIENTRY glad_profile_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureStorage3D(texture, levels, internalformat, width, height, depth);
+	profile_record(622, called_at);
+}
+static void APIENTRY glad_profile_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+	profile_record(623, called_at);
+}
+static void APIENTRY glad_profile_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+	profile_record(624, called_at);
+}
+static void APIENTRY glad_profile_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+	profile_record(625, called_at);
+}
+static void APIENTRY glad_profile_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+	profile_record(626, called_at);
+}
+static void APIENTRY glad_profile_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	profile_record(627, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+	profile_record(628, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+	profile_record(629, called_at);
+}
+static void APIENTRY glad_profile_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.CompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	profile_record(630, called_at);
+}
+static void APIENTRY glad_profile_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+	profile_record(631, called_at);
+}
+static void APIENTRY glad_profile_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+	profile_record(632, called_at);
+}
+static void APIENTRY glad_profile_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	unsigned long long called_at = now_ns();
+	profile_real.CopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+	profile_record(633, called_at);
+}
+static void APIENTRY glad_profile_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureParameterf(texture, pname, param);
+	profile_record(634, called_at);
+}
+static void APIENTRY glad_profile_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureParameterfv(texture, pname, param);
+	profile_record(635, called_at);
+}
+static void APIENTRY glad_profile_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureParameteri(texture, pname, param);
+	profile_record(636, called_at);
+}
+static void APIENTRY glad_profile_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureParameterIiv(texture, pname, params);
+	profile_record(637, called_at);
+}
+static void APIENTRY glad_profile_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureParameterIuiv(texture, pname, params);
+	profile_record(638, called_at);
+}
+static void APIENTRY glad_profile_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureParameteriv(texture, pname, param);
+	profile_record(639, called_at);
+}
+static void APIENTRY glad_profile_glGenerateTextureMipmap(GLuint texture) {
+	unsigned long long called_at = now_ns();
+	profile_real.GenerateTextureMipmap(texture);
+	profile_record(640, called_at);
+}
+static void APIENTRY glad_profile_glBindTextureUnit(GLuint unit, GLuint texture) {
+	unsigned long long called_at = now_ns();
+	profile_real.BindTextureUnit(unit, texture);
+	profile_record(641, called_at);
+}
+static void APIENTRY glad_profile_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTextureImage(texture, level, format, type, bufSize, pixels);
+	profile_record(642, called_at);
+}
+static void APIENTRY glad_profile_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetCompressedTextureImage(texture, level, bufSize, pixels);
+	profile_record(643, called_at);
+}
+static void APIENTRY glad_profile_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTextureLevelParameterfv(texture, level, pname, params);
+	profile_record(644, called_at);
+}
+static void APIENTRY glad_profile_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTextureLevelParameteriv(texture, level, pname, params);
+	profile_record(645, called_at);
+}
+static void APIENTRY glad_profile_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTextureParameterfv(texture, pname, params);
+	profile_record(646, called_at);
+}
+static void APIENTRY glad_profile_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTextureParameterIiv(texture, pname, params);
+	profile_record(647, called_at);
+}
+static void APIENTRY glad_profile_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTextureParameterIuiv(texture, pname, params);
+	profile_record(648, called_at);
+}
+static void APIENTRY glad_profile_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTextureParameteriv(texture, pname, params);
+	profile_record(649, called_at);
+}
+static void APIENTRY glad_profile_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateVertexArrays(n, arrays);
+	profile_record(650, called_at);
+}
+static void APIENTRY glad_profile_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	unsigned long long called_at = now_ns();
+	profile_real.DisableVertexArrayAttrib(vaobj, index);
+	profile_record(651, called_at);
+}
+static void APIENTRY glad_profile_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	unsigned long long called_at = now_ns();
+	profile_real.EnableVertexArrayAttrib(vaobj, index);
+	profile_record(652, called_at);
+}
+static void APIENTRY glad_profile_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexArrayElementBuffer(vaobj, buffer);
+	profile_record(653, called_at);
+}
+static void APIENTRY glad_profile_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+	profile_record(654, called_at);
+}
+static void APIENTRY glad_profile_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+	profile_record(655, called_at);
+}
+static void APIENTRY glad_profile_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+	profile_record(656, called_at);
+}
+static void APIENTRY glad_profile_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+	profile_record(657, called_at);
+}
+static void APIENTRY glad_profile_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+	profile_record(658, called_at);
+}
+static void APIENTRY glad_profile_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+	profile_record(659, called_at);
+}
+static void APIENTRY glad_profile_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	unsigned long long called_at = now_ns();
+	profile_real.VertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+	profile_record(660, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexArrayiv(vaobj, pname, param);
+	profile_record(661, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexArrayIndexediv(vaobj, index, pname, param);
+	profile_record(662, called_at);
+}
+static void APIENTRY glad_profile_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetVertexArrayIndexed64iv(vaobj, index, pname, param);
+	profile_record(663, called_at);
+}
+static void APIENTRY glad_profile_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateSamplers(n, samplers);
+	profile_record(664, called_at);
+}
+static void APIENTRY glad_profile_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateProgramPipelines(n, pipelines);
+	profile_record(665, called_at);
+}
+static void APIENTRY glad_profile_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	unsigned long long called_at = now_ns();
+	profile_real.CreateQueries(target, n, ids);
+	profile_record(666, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryBufferObjecti64v(id, buffer, pname, offset);
+	profile_record(667, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryBufferObjectiv(id, buffer, pname, offset);
+	profile_record(668, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryBufferObjectui64v(id, buffer, pname, offset);
+	profile_record(669, called_at);
+}
+static void APIENTRY glad_profile_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetQueryBufferObjectuiv(id, buffer, pname, offset);
+	profile_record(670, called_at);
+}
+static void APIENTRY glad_profile_glMemoryBarrierByRegion(GLbitfield barriers) {
+	unsigned long long called_at = now_ns();
+	profile_real.MemoryBarrierByRegion(barriers);
+	profile_record(671, called_at);
+}
+static void APIENTRY glad_profile_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+	profile_record(672, called_at);
+}
+static void APIENTRY glad_profile_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+	profile_record(673, called_at);
+}
+static GLenum APIENTRY glad_profile_glGetGraphicsResetStatus(void) {
+	GLenum result;
+	unsigned long long called_at = now_ns();
+	result = profile_real.GetGraphicsResetStatus();
+	profile_record(674, called_at);
+	return result;
+}
+static void APIENTRY glad_profile_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetnCompressedTexImage(target, lod, bufSize, pixels);
+	profile_record(675, called_at);
+}
+static void APIENTRY glad_profile_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetnTexImage(target, level, format, type, bufSize, pixels);
+	profile_record(676, called_at);
+}
+static void APIENTRY glad_profile_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetnUniformdv(program, location, bufSize, params);
+	profile_record(677, called_at);
+}
+static void APIENTRY glad_profile_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetnUniformfv(program, location, bufSize, params);
+	profile_record(678, called_at);
+}
+static void APIENTRY glad_profile_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetnUniformiv(program, location, bufSize, params);
+	profile_record(679, called_at);
+}
+static void APIENTRY glad_profile_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	unsigned long long called_at = now_ns();
+	profile_real.GetnUniformuiv(program, location, bufSize, params);
+	profile_record(680, called_at);
+}
+static void APIENTRY glad_profile_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	unsigned long long called_at = now_ns();
+	profile_real.ReadnPixels(x, y, width, height, format, type, bufSize, data);
+	profile_record(681, called_at);
+}
+static void APIENTRY glad_profile_glTextureBarrier(void) {
+	unsigned long long called_at = now_ns();
+	profile_real.TextureBarrier();
+	profile_record(682, called_at);
+}
+static void APIENTRY glad_profile_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	unsigned long long called_at = now_ns();
+	profile_real.MaxShaderCompilerThreadsKHR(count);
+	profile_record(683, called_at);
+}
+static void profile_install(void) {
+	if(glad_glCullFace != NULL && glad_glCullFace != glad_profile_glCullFace) {
+		profile_real.CullFace = glad_glCullFace;
+		glad_glCullFace = glad_profile_glCullFace;
+	}
+	if(glad_glFrontFace != NULL && glad_glFrontFace != glad_profile_glFrontFace) {
+		profile_real.FrontFace = glad_glFrontFace;
+		glad_glFrontFace = glad_profile_glFrontFace;
+	}
+	if(glad_glHint != NULL && glad_glHint != glad_profile_glHint) {
+		profile_real.Hint = glad_glHint;
+		glad_glHint = glad_profile_glHint;
+	}
+	if(glad_glLineWidth != NULL && glad_glLineWidth != glad_profile_glLineWidth) {
+		profile_real.LineWidth = glad_glLineWidth;
+		glad_glLineWidth = glad_profile_glLineWidth;
+	}
+	if(glad_glPointSize != NULL && glad_glPointSize != glad_profile_glPointSize) {
+		profile_real.PointSize = glad_glPointSize;
+		glad_glPointSize = glad_profile_glPointSize;
+	}
+	if(glad_glPolygonMode != NULL && glad_glPolygonMode != glad_profile_glPolygonMode) {
+		profile_real.PolygonMode = glad_glPolygonMode;
+		glad_glPolygonMode = glad_profile_glPolygonMode;
+	}
+	if(glad_glScissor != NULL && glad_glScissor != glad_profile_glScissor) {
+		profile_real.Scissor = glad_glScissor;
+		glad_glScissor = glad_profile_glScissor;
+	}
+	if(glad_glTexParameterf != NULL && glad_glTexParameterf != glad_profile_glTexParameterf) {
+		profile_real.TexParameterf = glad_glTexParameterf;
+		glad_glTexParameterf = glad_profile_glTexParameterf;
+	}
+	if(glad_glTexParameterfv != NULL && glad_glTexParameterfv != glad_profile_glTexParameterfv) {
+		profile_real.TexParameterfv = glad_glTexParameterfv;
+		glad_glTexParameterfv = glad_profile_glTexParameterfv;
+	}
+	if(glad_glTexParameteri != NULL && glad_glTexParameteri != glad_profile_glTexParameteri) {
+		profile_real.TexParameteri = glad_glTexParameteri;
+		glad_glTexParameteri = glad_profile_glTexParameteri;
+	}
+	if(glad_glTexParameteriv != NULL && glad_glTexParameteriv != glad_profile_glTexParameteriv) {
+		profile_real.TexParameteriv = glad_glTexParameteriv;
+		glad_glTexParameteriv = glad_profile_glTexParameteriv;
+	}
+	if(glad_glTexImage1D != NULL && glad_glTexImage1D != glad_profile_glTexImage1D) {
+		profile_real.TexImage1D = glad_glTexImage1D;
+		glad_glTexImage1D = glad_profile_glTexImage1D;
+	}
+	if(glad_glTexImage2D != NULL && glad_glTexImage2D != glad_profile_glTexImage2D) {
+		profile_real.TexImage2D = glad_glTexImage2D;
+		glad_glTexImage2D = glad_profile_glTexImage2D;
+	}
+	if(glad_glDrawBuffer != NULL && glad_glDrawBuffer != glad_profile_glDrawBuffer) {
+		profile_real.DrawBuffer = glad_glDrawBuffer;
+		glad_glDrawBuffer = glad_profile_glDrawBuffer;
+	}
+	if(glad_glClear != NULL && glad_glClear != glad_profile_glClear) {
+		profile_real.Clear = glad_glClear;
+		glad_glClear = glad_profile_glClear;
+	}
+	if(glad_glClearColor != NULL && glad_glClearColor != glad_profile_glClearColor) {
+		profile_real.ClearColor = glad_glClearColor;
+		glad_glClearColor = glad_profile_glClearColor;
+	}
+	if(glad_glClearStencil != NULL && glad_glClearStencil != glad_profile_glClearStencil) {
+		profile_real.ClearStencil = glad_glClearStencil;
+		glad_glClearStencil = glad_profile_glClearStencil;
+	}
+	if(glad_glClearDepth != NULL && glad_glClearDepth != glad_profile_glClearDepth) {
+		profile_real.ClearDepth = glad_glClearDepth;
+		glad_glClearDepth = glad_profile_glClearDepth;
+	}
+	if(glad_glStencilMask != NULL && glad_glStencilMask != glad_profile_glStencilMask) {
+		profile_real.StencilMask = glad_glStencilMask;
+		glad_glStencilMask = glad_profile_glStencilMask;
+	}
+	if(glad_glColorMask != NULL && glad_glColorMask != glad_profile_glColorMask) {
+		profile_real.ColorMask = glad_glColorMask;
+		glad_glColorMask = glad_profile_glColorMask;
+	}
+	if(glad_glDepthMask != NULL && glad_glDepthMask != glad_profile_glDepthMask) {
+		profile_real.DepthMask = glad_glDepthMask;
+		glad_glDepthMask = glad_profile_glDepthMask;
+	}
+	if(glad_glDisable != NULL && glad_glDisable != glad_profile_glDisable) {
+		profile_real.Disable = glad_glDisable;
+		glad_glDisable = glad_profile_glDisable;
+	}
+	if(glad_glEnable != NULL && glad_glEnable != glad_profile_glEnable) {
+		profile_real.Enable = glad_glEnable;
+		glad_glEnable = glad_profile_glEnable;
+	}
+	if(glad_glFinish != NULL && glad_glFinish != glad_profile_glFinish) {
+		profile_real.Finish = glad_glFinish;
+		glad_glFinish = glad_profile_glFinish;
+	}
+	if(glad_glFlush != NULL && glad_glFlush != glad_profile_glFlush) {
+		profile_real.Flush = glad_glFlush;
+		glad_glFlush = glad_profile_glFlush;
+	}
+	if(glad_glBlendFunc != NULL && glad_glBlendFunc != glad_profile_glBlendFunc) {
+		profile_real.BlendFunc = glad_glBlendFunc;
+		glad_glBlendFunc = glad_profile_glBlendFunc;
+	}
+	if(glad_glLogicOp != NULL && glad_glLogicOp != glad_profile_glLogicOp) {
+		profile_real.LogicOp = glad_glLogicOp;
+		glad_glLogicOp = glad_profile_glLogicOp;
+	}
+	if(glad_glStencilFunc != NULL && glad_glStencilFunc != glad_profile_glStencilFunc) {
+		profile_real.StencilFunc = glad_glStencilFunc;
+		glad_glStencilFunc = glad_profile_glStencilFunc;
+	}
+	if(glad_glStencilOp != NULL && glad_glStencilOp != glad_profile_glStencilOp) {
+		profile_real.StencilOp = glad_glStencilOp;
+		glad_glStencilOp = glad_profile_glStencilOp;
+	}
+	if(glad_glDepthFunc != NULL && glad_glDepthFunc != glad_profile_glDepthFunc) {
+		profile_real.DepthFunc = glad_glDepthFunc;
+		glad_glDepthFunc = glad_profile_glDepthFunc;
+	}
+	if(glad_glPixelStoref != NULL && glad_glPixelStoref != glad_profile_glPixelStoref) {
+		profile_real.PixelStoref = glad_glPixelStoref;
+		glad_glPixelStoref = glad_profile_glPixelStoref;
+	}
+	if(glad_glPixelStorei != NULL && glad_glPixelStorei != glad_profile_glPixelStorei) {
+		profile_real.PixelStorei = glad_glPixelStorei;
+		glad_glPixelStorei = glad_profile_glPixelStorei;
+	}
+	if(glad_glReadBuffer != NULL && glad_glReadBuffer != glad_profile_glReadBuffer) {
+		profile_real.ReadBuffer = glad_glReadBuffer;
+		glad_glReadBuffer = glad_profile_glReadBuffer;
+	}
+	if(glad_glReadPixels != NULL && glad_glReadPixels != glad_profile_glReadPixels) {
+		profile_real.ReadPixels = glad_glReadPixels;
+		glad_glReadPixels = glad_profile_glReadPixels;
+	}
+	if(glad_glGetBooleanv != NULL && glad_glGetBooleanv != glad_profile_glGetBooleanv) {
+		profile_real.GetBooleanv = glad_glGetBooleanv;
+		glad_glGetBooleanv = glad_profile_glGetBooleanv;
+	}
+	if(glad_glGetDoublev != NULL && glad_glGetDoublev != glad_profile_glGetDoublev) {
+		profile_real.GetDoublev = glad_glGetDoublev;
+		glad_glGetDoublev = glad_profile_glGetDoublev;
+	}
+	if(glad_glGetError != NULL && glad_glGetError != glad_profile_glGetError) {
+		profile_real.GetError = glad_glGetError;
+		glad_glGetError = glad_profile_glGetError;
+	}
+	if(glad_glGetFloatv != NULL && glad_glGetFloatv != glad_profile_glGetFloatv) {
+		profile_real.GetFloatv = glad_glGetFloatv;
+		glad_glGetFloatv = glad_profile_glGetFloatv;
+	}
+	if(glad_glGetIntegerv != NULL && glad_glGetIntegerv != glad_profile_glGetIntegerv) {
+		profile_real.GetIntegerv = glad_glGetIntegerv;
+		glad_glGetIntegerv = glad_profile_glGetIntegerv;
+	}
+	if(glad_glGetString != NULL && glad_glGetString != glad_profile_glGetString) {
+		profile_real.GetString = glad_glGetString;
+		glad_glGetString = glad_profile_glGetString;
+	}
+	if(glad_glGetTexImage != NULL && glad_glGetTexImage != glad_profile_glGetTexImage) {
+		profile_real.GetTexImage = glad_glGetTexImage;
+		glad_glGetTexImage = glad_profile_glGetTexImage;
+	}
+	if(glad_glGetTexParameterfv != NULL && glad_glGetTexParameterfv != glad_profile_glGetTexParameterfv) {
+		profile_real.GetTexParameterfv = glad_glGetTexParameterfv;
+		glad_glGetTexParameterfv = glad_profile_glGetTexParameterfv;
+	}
+	if(glad_glGetTexParameteriv != NULL && glad_glGetTexParameteriv != glad_profile_glGetTexParameteriv) {
+		profile_real.GetTexParameteriv = glad_glGetTexParameteriv;
+		glad_glGetTexParameteriv = glad_profile_glGetTexParameteriv;
+	}
+	if(glad_glGetTexLevelParameterfv != NULL && glad_glGetTexLevelParameterfv != glad_profile_glGetTexLevelParameterfv) {
+		profile_real.GetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+		glad_glGetTexLevelParameterfv = glad_profile_glGetTexLevelParameterfv;
+	}
+	if(glad_glGetTexLevelParameteriv != NULL && glad_glGetTexLevelParameteriv != glad_profile_glGetTexLevelParameteriv) {
+		profile_real.GetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+		glad_glGetTexLevelParameteriv = glad_profile_glGetTexLevelParameteriv;
+	}
+	if(glad_glIsEnabled != NULL && glad_glIsEnabled != glad_profile_glIsEnabled) {
+		profile_real.IsEnabled = glad_glIsEnabled;
+		glad_glIsEnabled = glad_profile_glIsEnabled;
+	}
+	if(glad_glDepthRange != NULL && glad_glDepthRange != glad_profile_glDepthRange) {
+		profile_real.DepthRange = glad_glDepthRange;
+		glad_glDepthRange = glad_profile_glDepthRange;
+	}
+	if(glad_glViewport != NULL && glad_glViewport != glad_profile_glViewport) {
+		profile_real.Viewport = glad_glViewport;
+		glad_glViewport = glad_profile_glViewport;
+	}
+	if(glad_glDrawArrays != NULL && glad_glDrawArrays != glad_profile_glDrawArrays) {
+		profile_real.DrawArrays = glad_glDrawArrays;
+		glad_glDrawArrays = glad_profile_glDrawArrays;
+	}
+	if(glad_glDrawElements != NULL && glad_glDrawElements != glad_profile_glDrawElements) {
+		profile_real.DrawElements = glad_glDrawElements;
+		glad_glDrawElements = glad_profile_glDrawElements;
+	}
+	if(glad_glPolygonOffset != NULL && glad_glPolygonOffset != glad_profile_glPolygonOffset) {
+		profile_real.PolygonOffset = glad_glPolygonOffset;
+		glad_glPolygonOffset = glad_profile_glPolygonOffset;
+	}
+	if(glad_glCopyTexImage1D != NULL && glad_glCopyTexImage1D != glad_profile_glCopyTexImage1D) {
+		profile_real.CopyTexImage1D = glad_glCopyTexImage1D;
+		glad_glCopyTexImage1D = glad_profile_glCopyTexImage1D;
+	}
+	if(glad_glCopyTexImage2D != NULL && glad_glCopyTexImage2D != glad_profile_glCopyTexImage2D) {
+		profile_real.CopyTexImage2D = glad_glCopyTexImage2D;
+		glad_glCopyTexImage2D = glad_profile_glCopyTexImage2D;
+	}
+	if(glad_glCopyTexSubImage1D != NULL && glad_glCopyTexSubImage1D != glad_profile_glCopyTexSubImage1D) {
+		profile_real.CopyTexSubImage1D = glad_glCopyTexSubImage1D;
+		glad_glCopyTexSubImage1D = glad_profile_glCopyTexSubImage1D;
+	}
+	if(glad_glCopyTexSubImage2D != NULL && glad_glCopyTexSubImage2D != glad_profile_glCopyTexSubImage2D) {
+		profile_real.CopyTexSubImage2D = glad_glCopyTexSubImage2D;
+		glad_glCopyTexSubImage2D = glad_profile_glCopyTexSubImage2D;
+	}
+	if(glad_glTexSubImage1D != NULL && glad_glTexSubImage1D != glad_profile_glTexSubImage1D) {
+		profile_real.TexSubImage1D = glad_glTexSubImage1D;
+		glad_glTexSubImage1D = glad_profile_glTexSubImage1D;
+	}
+	if(glad_glTexSubImage2D != NULL && glad_glTexSubImage2D != glad_profile_glTexSubImage2D) {
+		profile_real.TexSubImage2D = glad_glTexSubImage2D;
+		glad_glTexSubImage2D = glad_profile_glTexSubImage2D;
+	}
+	if(glad_glBindTexture != NULL && glad_glBindTexture != glad_profile_glBindTexture) {
+		profile_real.BindTexture = glad_glBindTexture;
+		glad_glBindTexture = glad_profile_glBindTexture;
+	}
+	if(glad_glDeleteTextures != NULL && glad_glDeleteTextures != glad_profile_glDeleteTextures) {
+		profile_real.DeleteTextures = glad_glDeleteTextures;
+		glad_glDeleteTextures = glad_profile_glDeleteTextures;
+	}
+	if(glad_glGenTextures != NULL && glad_glGenTextures != glad_profile_glGenTextures) {
+		profile_real.GenTextures = glad_glGenTextures;
+		glad_glGenTextures = glad_profile_glGenTextures;
+	}
+	if(glad_glIsTexture != NULL && glad_glIsTexture != glad_profile_glIsTexture) {
+		profile_real.IsTexture = glad_glIsTexture;
+		glad_glIsTexture = glad_profile_glIsTexture;
+	}
+	if(glad_glDrawRangeElements != NULL && glad_glDrawRangeElements != glad_profile_glDrawRangeElements) {
+		profile_real.DrawRangeElements = glad_glDrawRangeElements;
+		glad_glDrawRangeElements = glad_profile_glDrawRangeElements;
+	}
+	if(glad_glTexImage3D != NULL && glad_glTexImage3D != glad_profile_glTexImage3D) {
+		profile_real.TexImage3D = glad_glTexImage3D;
+		glad_glTexImage3D = glad_profile_glTexImage3D;
+	}
+	if(glad_glTexSubImage3D != NULL && glad_glTexSubImage3D != glad_profile_glTexSubImage3D) {
+		profile_real.TexSubImage3D = glad_glTexSubImage3D;
+		glad_glTexSubImage3D = glad_profile_glTexSubImage3D;
+	}
+	if(glad_glCopyTexSubImage3D != NULL && glad_glCopyTexSubImage3D != glad_profile_glCopyTexSubImage3D) {
+		profile_real.CopyTexSubImage3D = glad_glCopyTexSubImage3D;
+		glad_glCopyTexSubImage3D = glad_profile_glCopyTexSubImage3D;
+	}
+	if(glad_glActiveTexture != NULL && glad_glActiveTexture != glad_profile_glActiveTexture) {
+		profile_real.ActiveTexture = glad_glActiveTexture;
+		glad_glActiveTexture = glad_profile_glActiveTexture;
+	}
+	if(glad_glSampleCoverage != NULL && glad_glSampleCoverage != glad_profile_glSampleCoverage) {
+		profile_real.SampleCoverage = glad_glSampleCoverage;
+		glad_glSampleCoverage = glad_profile_glSampleCoverage;
+	}
+	if(glad_glCompressedTexImage3D != NULL && glad_glCompressedTexImage3D != glad_profile_glCompressedTexImage3D) {
+		profile_real.CompressedTexImage3D = glad_glCompressedTexImage3D;
+		glad_glCompressedTexImage3D = glad_profile_glCompressedTexImage3D;
+	}
+	if(glad_glCompressedTexImage2D != NULL && glad_glCompressedTexImage2D != glad_profile_glCompressedTexImage2D) {
+		profile_real.CompressedTexImage2D = glad_glCompressedTexImage2D;
+		glad_glCompressedTexImage2D = glad_profile_glCompressedTexImage2D;
+	}
+	if(glad_glCompressedTexImage1D != NULL && glad_glCompressedTexImage1D != glad_profile_glCompressedTexImage1D) {
+		profile_real.CompressedTexImage1D = glad_glCompressedTexImage1D;
+		glad_glCompressedTexImage1D = glad_profile_glCompressedTexImage1D;
+	}
+	if(glad_glCompressedTexSubImage3D != NULL && glad_glCompressedTexSubImage3D != glad_profile_glCompressedTexSubImage3D) {
+		profile_real.CompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+		glad_glCompressedTexSubImage3D = glad_profile_glCompressedTexSubImage3D;
+	}
+	if(glad_glCompressedTexSubImage2D != NULL && glad_glCompressedTexSubImage2D != glad_profile_glCompressedTexSubImage2D) {
+		profile_real.CompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+		glad_glCompressedTexSubImage2D = glad_profile_glCompressedTexSubImage2D;
+	}
+	if(glad_glCompressedTexSubImage1D != NULL && glad_glCompressedTexSubImage1D != glad_profile_glCompressedTexSubImage1D) {
+		profile_real.CompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+		glad_glCompressedTexSubImage1D = glad_profile_glCompressedTexSubImage1D;
+	}
+	if(glad_glGetCompressedTexImage != NULL && glad_glGetCompressedTexImage != glad_profile_glGetCompressedTexImage) {
+		profile_real.GetCompressedTexImage = glad_glGetCompressedTexImage;
+		glad_glGetCompressedTexImage = glad_profile_glGetCompressedTexImage;
+	}
+	if(glad_glBlendFuncSeparate != NULL && glad_glBlendFuncSeparate != glad_profile_glBlendFuncSeparate) {
+		profile_real.BlendFuncSeparate = glad_glBlendFuncSeparate;
+		glad_glBlendFuncSeparate = glad_profile_glBlendFuncSeparate;
+	}
+	if(glad_glMultiDrawArrays != NULL && glad_glMultiDrawArrays != glad_profile_glMultiDrawArrays) {
+		profile_real.MultiDrawArrays = glad_glMultiDrawArrays;
+		glad_glMultiDrawArrays = glad_profile_glMultiDrawArrays;
+	}
+	if(glad_glMultiDrawElements != NULL && glad_glMultiDrawElements != glad_profile_glMultiDrawElements) {
+		profile_real.MultiDrawElements = glad_glMultiDrawElements;
+		glad_glMultiDrawElements = glad_profile_glMultiDrawElements;
+	}
+	if(glad_glPointParameterf != NULL && glad_glPointParameterf != glad_profile_glPointParameterf) {
+		profile_real.PointParameterf = glad_glPointParameterf;
+		glad_glPointParameterf = glad_profile_glPointParameterf;
+	}
+	if(glad_glPointParameterfv != NULL && glad_glPointParameterfv != glad_profile_glPointParameterfv) {
+		profile_real.PointParameterfv = glad_glPointParameterfv;
+		glad_glPointParameterfv = glad_profile_glPointParameterfv;
+	}
+	if(glad_glPointParameteri != NULL && glad_glPointParameteri != glad_profile_glPointParameteri) {
+		profile_real.PointParameteri = glad_glPointParameteri;
+		glad_glPointParameteri = glad_profile_glPointParameteri;
+	}
+	if(glad_glPointParameteriv != NULL && glad_glPointParameteriv != glad_profile_glPointParameteriv) {
+		profile_real.PointParameteriv = glad_glPointParameteriv;
+		glad_glPointParameteriv = glad_profile_glPointParameteriv;
+	}
+	if(glad_glBlendColor != NULL && glad_glBlendColor != glad_profile_glBlendColor) {
+		profile_real.BlendColor = glad_glBlendColor;
+		glad_glBlendColor = glad_profile_glBlendColor;
+	}
+	if(glad_glBlendEquation != NULL && glad_glBlendEquation != glad_profile_glBlendEquation) {
+		profile_real.BlendEquation = glad_glBlendEquation;
+		glad_glBlendEquation = glad_profile_glBlendEquation;
+	}
+	if(glad_glGenQueries != NULL && glad_glGenQueries != glad_profile_glGenQueries) {
+		profile_real.GenQueries = glad_glGenQueries;
+		glad_glGenQueries = glad_profile_glGenQueries;
+	}
+	if(glad_glDeleteQueries != NULL && glad_glDeleteQueries != glad_profile_glDeleteQueries) {
+		profile_real.DeleteQueries = glad_glDeleteQueries;
+		glad_glDeleteQueries = glad_profile_glDeleteQueries;
+	}
+	if(glad_glIsQuery != NULL && glad_glIsQuery != glad_profile_glIsQuery) {
+		profile_real.IsQuery = glad_glIsQuery;
+		glad_glIsQuery = glad_profile_glIsQuery;
+	}
+	if(glad_glBeginQuery != NULL && glad_glBeginQuery != glad_profile_glBeginQuery) {
+		profile_real.BeginQuery = glad_glBeginQuery;
+		glad_glBeginQuery = glad_profile_glBeginQuery;
+	}
+	if(glad_glEndQuery != NULL && glad_glEndQuery != glad_profile_glEndQuery) {
+		profile_real.EndQuery = glad_glEndQuery;
+		glad_glEndQuery = glad_profile_glEndQuery;
+	}
+	if(glad_glGetQueryiv != NULL && glad_glGetQueryiv != glad_profile_glGetQueryiv) {
+		profile_real.GetQueryiv = glad_glGetQueryiv;
+		glad_glGetQueryiv = glad_profile_glGetQueryiv;
+	}
+	if(glad_glGetQueryObjectiv != NULL && glad_glGetQueryObjectiv != glad_profile_glGetQueryObjectiv) {
+		profile_real.GetQueryObjectiv = glad_glGetQueryObjectiv;
+		glad_glGetQueryObjectiv = glad_profile_glGetQueryObjectiv;
+	}
+	if(glad_glGetQueryObjectuiv != NULL && glad_glGetQueryObjectuiv != glad_profile_glGetQueryObjectuiv) {
+		profile_real.GetQueryObjectuiv = glad_glGetQueryObjectuiv;
+		glad_glGetQueryObjectuiv = glad_profile_glGetQueryObjectuiv;
+	}
+	if(glad_glBindBuffer != NULL && glad_glBindBuffer != glad_profile_glBindBuffer) {
+		profile_real.BindBuffer = glad_glBindBuffer;
+		glad_glBindBuffer = glad_profile_glBindBuffer;
+	}
+	if(glad_glDeleteBuffers != NULL && glad_glDeleteBuffers != glad_profile_glDeleteBuffers) {
+		profile_real.DeleteBuffers = glad_glDeleteBuffers;
+		glad_glDeleteBuffers = glad_profile_glDeleteBuffers;
+	}
+	if(glad_glGenBuffers != NULL && glad_glGenBuffers != glad_profile_glGenBuffers) {
+		profile_real.GenBuffers = glad_glGenBuffers;
+		glad_glGenBuffers = glad_profile_glGenBuffers;
+	}
+	if(glad_glIsBuffer != NULL && glad_glIsBuffer != glad_profile_glIsBuffer) {
+		profile_real.IsBuffer = glad_glIsBuffer;
+		glad_glIsBuffer = glad_profile_glIsBuffer;
+	}
+	if(glad_glBufferData != NULL && glad_glBufferData != glad_profile_glBufferData) {
+		profile_real.BufferData = glad_glBufferData;
+		glad_glBufferData = glad_profile_glBufferData;
+	}
+	if(glad_glBufferSubData != NULL && glad_glBufferSubData != glad_profile_glBufferSubData) {
+		profile_real.BufferSubData = glad_glBufferSubData;
+		glad_glBufferSubData = glad_profile_glBufferSubData;
+	}
+	if(glad_glGetBufferSubData != NULL && glad_glGetBufferSubData != glad_profile_glGetBufferSubData) {
+		profile_real.GetBufferSubData = glad_glGetBufferSubData;
+		glad_glGetBufferSubData = glad_profile_glGetBufferSubData;
+	}
+	if(glad_glMapBuffer != NULL && glad_glMapBuffer != glad_profile_glMapBuffer) {
+		profile_real.MapBuffer = glad_glMapBuffer;
+		glad_glMapBuffer = glad_profile_glMapBuffer;
+	}
+	if(glad_glUnmapBuffer != NULL && glad_glUnmapBuffer != glad_profile_glUnmapBuffer) {
+		profile_real.UnmapBuffer = glad_glUnmapBuffer;
+		glad_glUnmapBuffer = glad_profile_glUnmapBuffer;
+	}
+	if(glad_glGetBufferParameteriv != NULL && glad_glGetBufferParameteriv != glad_profile_glGetBufferParameteriv) {
+		profile_real.GetBufferParameteriv = glad_glGetBufferParameteriv;
+		glad_glGetBufferParameteriv = glad_profile_glGetBufferParameteriv;
+	}
+	if(glad_glGetBufferPointerv != NULL && glad_glGetBufferPointerv != glad_profile_glGetBufferPointerv) {
+		profile_real.GetBufferPointerv = glad_glGetBufferPointerv;
+		glad_glGetBufferPointerv = glad_profile_glGetBufferPointerv;
+	}
+	if(glad_glBlendEquationSeparate != NULL && glad_glBlendEquationSeparate != glad_profile_glBlendEquationSeparate) {
+		profile_real.BlendEquationSeparate = glad_glBlendEquationSeparate;
+		glad_glBlendEquationSeparate = glad_profile_glBlendEquationSeparate;
+	}
+	if(glad_glDrawBuffers != NULL && glad_glDrawBuffers != glad_profile_glDrawBuffers) {
+		profile_real.DrawBuffers = glad_glDrawBuffers;
+		glad_glDrawBuffers = glad_profile_glDrawBuffers;
+	}
+	if(glad_glStencilOpSeparate != NULL && glad_glStencilOpSeparate != glad_profile_glStencilOpSeparate) {
+		profile_real.StencilOpSeparate = glad_glStencilOpSeparate;
+		glad_glStencilOpSeparate = glad_profile_glStencilOpSeparate;
+	}
+	if(glad_glStencilFuncSeparate != NULL && glad_glStencilFuncSeparate != glad_profile_glStencilFuncSeparate) {
+		profile_real.StencilFuncSeparate = glad_glStencilFuncSeparate;
+		glad_glStencilFuncSeparate = glad_profile_glStencilFuncSeparate;
+	}
+	if(glad_glStencilMaskSeparate != NULL && glad_glStencilMaskSeparate != glad_profile_glStencilMaskSeparate) {
+		profile_real.StencilMaskSeparate = glad_glStencilMaskSeparate;
+		glad_glStencilMaskSeparate = glad_profile_glStencilMaskSeparate;
+	}
+	if(glad_glAttachShader != NULL && glad_glAttachShader != glad_profile_glAttachShader) {
+		profile_real.AttachShader = glad_glAttachShader;
+		glad_glAttachShader = glad_profile_glAttachShader;
+	}
+	if(glad_glBindAttribLocation != NULL && glad_glBindAttribLocation != glad_profile_glBindAttribLocation) {
+		profile_real.BindAttribLocation = glad_glBindAttribLocation;
+		glad_glBindAttribLocation = glad_profile_glBindAttribLocation;
+	}
+	if(glad_glCompileShader != NULL && glad_glCompileShader != glad_profile_glCompileShader) {
+		profile_real.CompileShader = glad_glCompileShader;
+		glad_glCompileShader = glad_profile_glCompileShader;
+	}
+	if(glad_glCreateProgram != NULL && glad_glCreateProgram != glad_profile_glCreateProgram) {
+		profile_real.CreateProgram = glad_glCreateProgram;
+		glad_glCreateProgram = glad_profile_glCreateProgram;
+	}
+	if(glad_glCreateShader != NULL && glad_glCreateShader != glad_profile_glCreateShader) {
+		profile_real.CreateShader = glad_glCreateShader;
+		glad_glCreateShader = glad_profile_glCreateShader;
+	}
+	if(glad_glDeleteProgram != NULL && glad_glDeleteProgram != glad_profile_glDeleteProgram) {
+		profile_real.DeleteProgram = glad_glDeleteProgram;
+		glad_glDeleteProgram = glad_profile_glDeleteProgram;
+	}
+	if(glad_glDeleteShader != NULL && glad_glDeleteShader != glad_profile_glDeleteShader) {
+		profile_real.DeleteShader = glad_glDeleteShader;
+		glad_glDeleteShader = glad_profile_glDeleteShader;
+	}
+	if(glad_glDetachShader != NULL && glad_glDetachShader != glad_profile_glDetachShader) {
+		profile_real.DetachShader = glad_glDetachShader;
+		glad_glDetachShader = glad_profile_glDetachShader;
+	}
+	if(glad_glDisableVertexAttribArray != NULL && glad_glDisableVertexAttribArray != glad_profile_glDisableVertexAttribArray) {
+		profile_real.DisableVertexAttribArray = glad_glDisableVertexAttribArray;
+		glad_glDisableVertexAttribArray = glad_profile_glDisableVertexAttribArray;
+	}
+	if(glad_glEnableVertexAttribArray != NULL && glad_glEnableVertexAttribArray != glad_profile_glEnableVertexAttribArray) {
+		profile_real.EnableVertexAttribArray = glad_glEnableVertexAttribArray;
+		glad_glEnableVertexAttribArray = glad_profile_glEnableVertexAttribArray;
+	}
+	if(glad_glGetActiveAttrib != NULL && glad_glGetActiveAttrib != glad_profile_glGetActiveAttrib) {
+		profile_real.GetActiveAttrib = glad_glGetActiveAttrib;
+		glad_glGetActiveAttrib = glad_profile_glGetActiveAttrib;
+	}
+	if(glad_glGetActiveUniform != NULL && glad_glGetActiveUniform != glad_profile_glGetActiveUniform) {
+		profile_real.GetActiveUniform = glad_glGetActiveUniform;
+		glad_glGetActiveUniform = glad_profile_glGetActiveUniform;
+	}
+	if(glad_glGetAttachedShaders != NULL && glad_glGetAttachedShaders != glad_profile_glGetAttachedShaders) {
+		profile_real.GetAttachedShaders = glad_glGetAttachedShaders;
+		glad_glGetAttachedShaders = glad_profile_glGetAttachedShaders;
+	}
+	if(glad_glGetAttribLocation != NULL && glad_glGetAttribLocation != glad_profile_glGetAttribLocation) {
+		profile_real.GetAttribLocation = glad_glGetAttribLocation;
+		glad_glGetAttribLocation = glad_profile_glGetAttribLocation;
+	}
+	if(glad_glGetProgramiv != NULL && glad_glGetProgramiv != glad_profile_glGetProgramiv) {
+		profile_real.GetProgramiv = glad_glGetProgramiv;
+		glad_glGetProgramiv = glad_profile_glGetProgramiv;
+	}
+	if(glad_glGetProgramInfoLog != NULL && glad_glGetProgramInfoLog != glad_profile_glGetProgramInfoLog) {
+		profile_real.GetProgramInfoLog = glad_glGetProgramInfoLog;
+		glad_glGetProgramInfoLog = glad_profile_glGetProgramInfoLog;
+	}
+	if(glad_glGetShaderiv != NULL && glad_glGetShaderiv != glad_profile_glGetShaderiv) {
+		profile_real.GetShaderiv = glad_glGetShaderiv;
+		glad_glGetShaderiv = glad_profile_glGetShaderiv;
+	}
+	if(glad_glGetShaderInfoLog != NULL && glad_glGetShaderInfoLog != glad_profile_glGetShaderInfoLog) {
+		profile_real.GetShaderInfoLog = glad_glGetShaderInfoLog;
+		glad_glGetShaderInfoLog = glad_profile_glGetShaderInfoLog;
+	}
+	if(glad_glGetShaderSource != NULL && glad_glGetShaderSource != glad_profile_glGetShaderSource) {
+		profile_real.GetShaderSource = glad_glGetShaderSource;
+		glad_glGetShaderSource = glad_profile_glGetShaderSource;
+	}
+	if(glad_glGetUniformLocation != NULL && glad_glGetUniformLocation != glad_profile_glGetUniformLocation) {
+		profile_real.GetUniformLocation = glad_glGetUniformLocation;
+		glad_glGetUniformLocation = glad_profile_glGetUniformLocation;
+	}
+	if(glad_glGetUniformfv != NULL && glad_glGetUniformfv != glad_profile_glGetUniformfv) {
+		profile_real.GetUniformfv = glad_glGetUniformfv;
+		glad_glGetUniformfv = glad_profile_glGetUniformfv;
+	}
+	if(glad_glGetUniformiv != NULL && glad_glGetUniformiv != glad_profile_glGetUniformiv) {
+		profile_real.GetUniformiv = glad_glGetUniformiv;
+		glad_glGetUniformiv = glad_profile_glGetUniformiv;
+	}
+	if(glad_glGetVertexAttribdv != NULL && glad_glGetVertexAttribdv != glad_profile_glGetVertexAttribdv) {
+		profile_real.GetVertexAttribdv = glad_glGetVertexAttribdv;
+		glad_glGetVertexAttribdv = glad_profile_glGetVertexAttribdv;
+	}
+	if(glad_glGetVertexAttribfv != NULL && glad_glGetVertexAttribfv != glad_profile_glGetVertexAttribfv) {
+		profile_real.GetVertexAttribfv = glad_glGetVertexAttribfv;
+		glad_glGetVertexAttribfv = glad_profile_glGetVertexAttribfv;
+	}
+	if(glad_glGetVertexAttribiv != NULL && glad_glGetVertexAttribiv != glad_profile_glGetVertexAttribiv) {
+		profile_real.GetVertexAttribiv = glad_glGetVertexAttribiv;
+		glad_glGetVertexAttribiv = glad_profile_glGetVertexAttribiv;
+	}
+	if(glad_glGetVertexAttribPointerv != NULL && glad_glGetVertexAttribPointerv != glad_profile_glGetVertexAttribPointerv) {
+		profile_real.GetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+		glad_glGetVertexAttribPointerv = glad_profile_glGetVertexAttribPointerv;
+	}
+	if(glad_glIsProgram != NULL && glad_glIsProgram != glad_profile_glIsProgram) {
+		profile_real.IsProgram = glad_glIsProgram;
+		glad_glIsProgram = glad_profile_glIsProgram;
+	}
+	if(glad_glIsShader != NULL && glad_glIsShader != glad_profile_glIsShader) {
+		profile_real.IsShader = glad_glIsShader;
+		glad_glIsShader = glad_profile_glIsShader;
+	}
+	if(glad_glLinkProgram != NULL && glad_glLinkProgram != glad_profile_glLinkProgram) {
+		profile_real.LinkProgram = glad_glLinkProgram;
+		glad_glLinkProgram = glad_profile_glLinkProgram;
+	}
+	if(glad_glShaderSource != NULL && glad_glShaderSource != glad_profile_glShaderSource) {
+		profile_real.ShaderSource = glad_glShaderSource;
+		glad_glShaderSource = glad_profile_glShaderSource;
+	}
+	if(glad_glUseProgram != NULL && glad_glUseProgram != glad_profile_glUseProgram) {
+		profile_real.UseProgram = glad_glUseProgram;
+		glad_glUseProgram = glad_profile_glUseProgram;
+	}
+	if(glad_glUniform1f != NULL && glad_glUniform1f != glad_profile_glUniform1f) {
+		profile_real.Uniform1f = glad_glUniform1f;
+		glad_glUniform1f = glad_profile_glUniform1f;
+	}
+	if(glad_glUniform2f != NULL && glad_glUniform2f != glad_profile_glUniform2f) {
+		profile_real.Uniform2f = glad_glUniform2f;
+		glad_glUniform2f = glad_profile_glUniform2f;
+	}
+	if(glad_glUniform3f != NULL && glad_glUniform3f != glad_profile_glUniform3f) {
+		profile_real.Uniform3f = glad_glUniform3f;
+		glad_glUniform3f = glad_profile_glUniform3f;
+	}
+	if(glad_glUniform4f != NULL && glad_glUniform4f != glad_profile_glUniform4f) {
+		profile_real.Uniform4f = glad_glUniform4f;
+		glad_glUniform4f = glad_profile_glUniform4f;
+	}
+	if(glad_glUniform1i != NULL && glad_glUniform1i != glad_profile_glUniform1i) {
+		profile_real.Uniform1i = glad_glUniform1i;
+		glad_glUniform1i = glad_profile_glUniform1i;
+	}
+	if(glad_glUniform2i != NULL && glad_glUniform2i != glad_profile_glUniform2i) {
+		profile_real.Uniform2i = glad_glUniform2i;
+		glad_glUniform2i = glad_profile_glUniform2i;
+	}
+	if(glad_glUniform3i != NULL && glad_glUniform3i != glad_profile_glUniform3i) {
+		profile_real.Uniform3i = glad_glUniform3i;
+		glad_glUniform3i = glad_profile_glUniform3i;
+	}
+	if(glad_glUniform4i != NULL && glad_glUniform4i != glad_profile_glUniform4i) {
+		profile_real.Uniform4i = glad_glUniform4i;
+		glad_glUniform4i = glad_profile_glUniform4i;
+	}
+	if(glad_glUniform1fv != NULL && glad_glUniform1fv != glad_profile_glUniform1fv) {
+		profile_real.Uniform1fv = glad_glUniform1fv;
+		glad_glUniform1fv = glad_profile_glUniform1fv;
+	}
+	if(glad_glUniform2fv != NULL && glad_glUniform2fv != glad_profile_glUniform2fv) {
+		profile_real.Uniform2fv = glad_glUniform2fv;
+		glad_glUniform2fv = glad_profile_glUniform2fv;
+	}
+	if(glad_glUniform3fv != NULL && glad_glUniform3fv != glad_profile_glUniform3fv) {
+		profile_real.Uniform3fv = glad_glUniform3fv;
+		glad_glUniform3fv = glad_profile_glUniform3fv;
+	}
+	if(glad_glUniform4fv != NULL && glad_glUniform4fv != glad_profile_glUniform4fv) {
+		profile_real.Uniform4fv = glad_glUniform4fv;
+		glad_glUniform4fv = glad_profile_glUniform4fv;
+	}
+	if(glad_glUniform1iv != NULL && glad_glUniform1iv != glad_profile_glUniform1iv) {
+		profile_real.Uniform1iv = glad_glUniform1iv;
+		glad_glUniform1iv = glad_profile_glUniform1iv;
+	}
+	if(glad_glUniform2iv != NULL && glad_glUniform2iv != glad_profile_glUniform2iv) {
+		profile_real.Uniform2iv = glad_glUniform2iv;
+		glad_glUniform2iv = glad_profile_glUniform2iv;
+	}
+	if(glad_glUniform3iv != NULL && glad_glUniform3iv != glad_profile_glUniform3iv) {
+		profile_real.Uniform3iv = glad_glUniform3iv;
+		glad_glUniform3iv = glad_profile_glUniform3iv;
+	}
+	if(glad_glUniform4iv != NULL && glad_glUniform4iv != glad_profile_glUniform4iv) {
+		profile_real.Uniform4iv = glad_glUniform4iv;
+		glad_glUniform4iv = glad_profile_glUniform4iv;
+	}
+	if(glad_glUniformMatrix2fv != NULL && glad_glUniformMatrix2fv != glad_profile_glUniformMatrix2fv) {
+		profile_real.UniformMatrix2fv = glad_glUniformMatrix2fv;
+		glad_glUniformMatrix2fv = glad_profile_glUniformMatrix2fv;
+	}
+	if(glad_glUniformMatrix3fv != NULL && glad_glUniformMatrix3fv != glad_profile_glUniformMatrix3fv) {
+		profile_real.UniformMatrix3fv = glad_glUniformMatrix3fv;
+		glad_glUniformMatrix3fv = glad_profile_glUniformMatrix3fv;
+	}
+	if(glad_glUniformMatrix4fv != NULL && glad_glUniformMatrix4fv != glad_profile_glUniformMatrix4fv) {
+		profile_real.UniformMatrix4fv = glad_glUniformMatrix4fv;
+		glad_glUniformMatrix4fv = glad_profile_glUniformMatrix4fv;
+	}
+	if(glad_glValidateProgram != NULL && glad_glValidateProgram != glad_profile_glValidateProgram) {
+		profile_real.ValidateProgram = glad_glValidateProgram;
+		glad_glValidateProgram = glad_profile_glValidateProgram;
+	}
+	if(glad_glVertexAttrib1d != NULL && glad_glVertexAttrib1d != glad_profile_glVertexAttrib1d) {
+		profile_real.VertexAttrib1d = glad_glVertexAttrib1d;
+		glad_glVertexAttrib1d = glad_profile_glVertexAttrib1d;
+	}
+	if(glad_glVertexAttrib1dv != NULL && glad_glVertexAttrib1dv != glad_profile_glVertexAttrib1dv) {
+		profile_real.VertexAttrib1dv = glad_glVertexAttrib1dv;
+		glad_glVertexAttrib1dv = glad_profile_glVertexAttrib1dv;
+	}
+	if(glad_glVertexAttrib1f != NULL && glad_glVertexAttrib1f != glad_profile_glVertexAttrib1f) {
+		profile_real.VertexAttrib1f = glad_glVertexAttrib1f;
+		glad_glVertexAttrib1f = glad_profile_glVertexAttrib1f;
+	}
+	if(glad_glVertexAttrib1fv != NULL && glad_glVertexAttrib1fv != glad_profile_glVertexAttrib1fv) {
+		profile_real.VertexAttrib1fv = glad_glVertexAttrib1fv;
+		glad_glVertexAttrib1fv = glad_profile_glVertexAttrib1fv;
+	}
+	if(glad_glVertexAttrib1s != NULL && glad_glVertexAttrib1s != glad_profile_glVertexAttrib1s) {
+		profile_real.VertexAttrib1s = glad_glVertexAttrib1s;
+		glad_glVertexAttrib1s = glad_profile_glVertexAttrib1s;
+	}
+	if(glad_glVertexAttrib1sv != NULL && glad_glVertexAttrib1sv != glad_profile_glVertexAttrib1sv) {
+		profile_real.VertexAttrib1sv = glad_glVertexAttrib1sv;
+		glad_glVertexAttrib1sv = glad_profile_glVertexAttrib1sv;
+	}
+	if(glad_glVertexAttrib2d != NULL && glad_glVertexAttrib2d != glad_profile_glVertexAttrib2d) {
+		profile_real.VertexAttrib2d = glad_glVertexAttrib2d;
+		glad_glVertexAttrib2d = glad_profile_glVertexAttrib2d;
+	}
+	if(glad_glVertexAttrib2dv != NULL && glad_glVertexAttrib2dv != glad_profile_glVertexAttrib2dv) {
+		profile_real.VertexAttrib2dv = glad_glVertexAttrib2dv;
+		glad_glVertexAttrib2dv = glad_profile_glVertexAttrib2dv;
+	}
+	if(glad_glVertexAttrib2f != NULL && glad_glVertexAttrib2f != glad_profile_glVertexAttrib2f) {
+		profile_real.VertexAttrib2f = glad_glVertexAttrib2f;
+		glad_glVertexAttrib2f = glad_profile_glVertexAttrib2f;
+	}
+	if(glad_glVertexAttrib2fv != NULL && glad_glVertexAttrib2fv != glad_profile_glVertexAttrib2fv) {
+		profile_real.VertexAttrib2fv = glad_glVertexAttrib2fv;
+		glad_glVertexAttrib2fv = glad_profile_glVertexAttrib2fv;
+	}
+	if(glad_glVertexAttrib2s != NULL && glad_glVertexAttrib2s != glad_profile_glVertexAttrib2s) {
+		profile_real.VertexAttrib2s = glad_glVertexAttrib2s;
+		glad_glVertexAttrib2s = glad_profile_glVertexAttrib2s;
+	}
+	if(glad_glVertexAttrib2sv != NULL && glad_glVertexAttrib2sv != glad_profile_glVertexAttrib2sv) {
+		profile_real.VertexAttrib2sv = glad_glVertexAttrib2sv;
+		glad_glVertexAttrib2sv = glad_profile_glVertexAttrib2sv;
+	}
+	if(glad_glVertexAttrib3d != NULL && glad_glVertexAttrib3d != glad_profile_glVertexAttrib3d) {
+		profile_real.VertexAttrib3d = glad_glVertexAttrib3d;
+		glad_glVertexAttrib3d = glad_profile_glVertexAttrib3d;
+	}
+	if(glad_glVertexAttrib3dv != NULL && glad_glVertexAttrib3dv != glad_profile_glVertexAttrib3dv) {
+		profile_real.VertexAttrib3dv = glad_glVertexAttrib3dv;
+		glad_glVertexAttrib3dv = glad_profile_glVertexAttrib3dv;
+	}
+	if(glad_glVertexAttrib3f != NULL && glad_glVertexAttrib3f != glad_profile_glVertexAttrib3f) {
+		profile_real.VertexAttrib3f = glad_glVertexAttrib3f;
+		glad_glVertexAttrib3f = glad_profile_glVertexAttrib3f;
+	}
+	if(glad_glVertexAttrib3fv != NULL && glad_glVertexAttrib3fv != glad_profile_glVertexAttrib3fv) {
+		profile_real.VertexAttrib3fv = glad_glVertexAttrib3fv;
+		glad_glVertexAttrib3fv = glad_profile_glVertexAttrib3fv;
+	}
+	if(glad_glVertexAttrib3s != NULL && glad_glVertexAttrib3s != glad_profile_glVertexAttrib3s) {
+		profile_real.VertexAttrib3s = glad_glVertexAttrib3s;
+		glad_glVertexAttrib3s = glad_profile_glVertexAttrib3s;
+	}
+	if(glad_glVertexAttrib3sv != NULL && glad_glVertexAttrib3sv != glad_profile_glVertexAttrib3sv) {
+		profile_real.VertexAttrib3sv = glad_glVertexAttrib3sv;
+		glad_glVertexAttrib3sv = glad_profile_glVertexAttrib3sv;
+	}
+	if(glad_glVertexAttrib4Nbv != NULL && glad_glVertexAttrib4Nbv != glad_profile_glVertexAttrib4Nbv) {
+		profile_real.VertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+		glad_glVertexAttrib4Nbv = glad_profile_glVertexAttrib4Nbv;
+	}
+	if(glad_glVertexAttrib4Niv != NULL && glad_glVertexAttrib4Niv != glad_profile_glVertexAttrib4Niv) {
+		profile_real.VertexAttrib4Niv = glad_glVertexAttrib4Niv;
+		glad_glVertexAttrib4Niv = glad_profile_glVertexAttrib4Niv;
+	}
+	if(glad_glVertexAttrib4Nsv != NULL && glad_glVertexAttrib4Nsv != glad_profile_glVertexAttrib4Nsv) {
+		profile_real.VertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+		glad_glVertexAttrib4Nsv = glad_profile_glVertexAttrib4Nsv;
+	}
+	if(glad_glVertexAttrib4Nub != NULL && glad_glVertexAttrib4Nub != glad_profile_glVertexAttrib4Nub) {
+		profile_real.VertexAttrib4Nub = glad_glVertexAttrib4Nub;
+		glad_glVertexAttrib4Nub = glad_profile_glVertexAttrib4Nub;
+	}
+	if(glad_glVertexAttrib4Nubv != NULL && glad_glVertexAttrib4Nubv != glad_profile_glVertexAttrib4Nubv) {
+		profile_real.VertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+		glad_glVertexAttrib4Nubv = glad_profile_glVertexAttrib4Nubv;
+	}
+	if(glad_glVertexAttrib4Nuiv != NULL && glad_glVertexAttrib4Nuiv != glad_profile_glVertexAttrib4Nuiv) {
+		profile_real.VertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+		glad_glVertexAttrib4Nuiv = glad_profile_glVertexAttrib4Nuiv;
+	}
+	if(glad_glVertexAttrib4Nusv != NULL && glad_glVertexAttrib4Nusv != glad_profile_glVertexAttrib4Nusv) {
+		profile_real.VertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+		glad_glVertexAttrib4Nusv = glad_profile_glVertexAttrib4Nusv;
+	}
+	if(glad_glVertexAttrib4bv != NULL && glad_glVertexAttrib4bv != glad_profile_glVertexAttrib4bv) {
+		profile_real.VertexAttrib4bv = glad_glVertexAttrib4bv;
+		glad_glVertexAttrib4bv = glad_profile_glVertexAttrib4bv;
+	}
+	if(glad_glVertexAttrib4d != NULL && glad_glVertexAttrib4d != glad_profile_glVertexAttrib4d) {
+		profile_real.VertexAttrib4d = glad_glVertexAttrib4d;
+		glad_glVertexAttrib4d = glad_profile_glVertexAttrib4d;
+	}
+	if(glad_glVertexAttrib4dv != NULL && glad_glVertexAttrib4dv != glad_profile_glVertexAttrib4dv) {
+		profile_real.VertexAttrib4dv = glad_glVertexAttrib4dv;
+		glad_glVertexAttrib4dv = glad_profile_glVertexAttrib4dv;
+	}
+	if(glad_glVertexAttrib4f != NULL && glad_glVertexAttrib4f != glad_profile_glVertexAttrib4f) {
+		profile_real.VertexAttrib4f = glad_glVertexAttrib4f;
+		glad_glVertexAttrib4f = glad_profile_glVertexAttrib4f;
+	}
+	if(glad_glVertexAttrib4fv != NULL && glad_glVertexAttrib4fv != glad_profile_glVertexAttrib4fv) {
+		profile_real.VertexAttrib4fv = glad_glVertexAttrib4fv;
+		glad_glVertexAttrib4fv = glad_profile_glVertexAttrib4fv;
+	}
+	if(glad_glVertexAttrib4iv != NULL && glad_glVertexAttrib4iv != glad_profile_glVertexAttrib4iv) {
+		profile_real.VertexAttrib4iv = glad_glVertexAttrib4iv;
+		glad_glVertexAttrib4iv = glad_profile_glVertexAttrib4iv;
+	}
+	if(glad_glVertexAttrib4s != NULL && glad_glVertexAttrib4s != glad_profile_glVertexAttrib4s) {
+		profile_real.VertexAttrib4s = glad_glVertexAttrib4s;
+		glad_glVertexAttrib4s = glad_profile_glVertexAttrib4s;
+	}
+	if(glad_glVertexAttrib4sv != NULL && glad_glVertexAttrib4sv != glad_profile_glVertexAttrib4sv) {
+		profile_real.VertexAttrib4sv = glad_glVertexAttrib4sv;
+		glad_glVertexAttrib4sv = glad_profile_glVertexAttrib4sv;
+	}
+	if(glad_glVertexAttrib4ubv != NULL && glad_glVertexAttrib4ubv != glad_profile_glVertexAttrib4ubv) {
+		profile_real.VertexAttrib4ubv = glad_glVertexAttrib4ubv;
+		glad_glVertexAttrib4ubv = glad_profile_glVertexAttrib4ubv;
+	}
+	if(glad_glVertexAttrib4uiv != NULL && glad_glVertexAttrib4uiv != glad_profile_glVertexAttrib4uiv) {
+		profile_real.VertexAttrib4uiv = glad_glVertexAttrib4uiv;
+		glad_glVertexAttrib4uiv = glad_profile_glVertexAttrib4uiv;
+	}
+	if(glad_glVertexAttrib4usv != NULL && glad_glVertexAttrib4usv != glad_profile_glVertexAttrib4usv) {
+		profile_real.VertexAttrib4usv = glad_glVertexAttrib4usv;
+		glad_glVertexAttrib4usv = glad_profile_glVertexAttrib4usv;
+	}
+	if(glad_glVertexAttribPointer != NULL && glad_glVertexAttribPointer != glad_profile_glVertexAttribPointer) {
+		profile_real.VertexAttribPointer = glad_glVertexAttribPointer;
+		glad_glVertexAttribPointer = glad_profile_glVertexAttribPointer;
+	}
+	if(glad_glUniformMatrix2x3fv != NULL && glad_glUniformMatrix2x3fv != glad_profile_glUniformMatrix2x3fv) {
+		profile_real.UniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+		glad_glUniformMatrix2x3fv = glad_profile_glUniformMatrix2x3fv;
+	}
+	if(glad_glUniformMatrix3x2fv != NULL && glad_glUniformMatrix3x2fv != glad_profile_glUniformMatrix3x2fv) {
+		profile_real.UniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+		glad_glUniformMatrix3x2fv = glad_profile_glUniformMatrix3x2fv;
+	}
+	if(glad_glUniformMatrix2x4fv != NULL && glad_glUniformMatrix2x4fv != glad_profile_glUniformMatrix2x4fv) {
+		profile_real.UniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+		glad_glUniformMatrix2x4fv = glad_profile_glUniformMatrix2x4fv;
+	}
+	if(glad_glUniformMatrix4x2fv != NULL && glad_glUniformMatrix4x2fv != glad_profile_glUniformMatrix4x2fv) {
+		profile_real.UniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+		glad_glUniformMatrix4x2fv = glad_profile_glUniformMatrix4x2fv;
+	}
+	if(glad_glUniformMatrix3x4fv != NULL && glad_glUniformMatrix3x4fv != glad_profile_glUniformMatrix3x4fv) {
+		profile_real.UniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+		glad_glUniformMatrix3x4fv = glad_profile_glUniformMatrix3x4fv;
+	}
+	if(glad_glUniformMatrix4x3fv != NULL && glad_glUniformMatrix4x3fv != glad_profile_glUniformMatrix4x3fv) {
+		profile_real.UniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+		glad_glUniformMatrix4x3fv = glad_profile_glUniformMatrix4x3fv;
+	}
+	if(glad_glColorMaski != NULL && glad_glColorMaski != glad_profile_glColorMaski) {
+		profile_real.ColorMaski = glad_glColorMaski;
+		glad_glColorMaski = glad_profile_glColorMaski;
+	}
+	if(glad_glGetBooleani_v != NULL && glad_glGetBooleani_v != glad_profile_glGetBooleani_v) {
+		profile_real.GetBooleani_v = glad_glGetBooleani_v;
+		glad_glGetBooleani_v = glad_profile_glGetBooleani_v;
+	}
+	if(glad_glGetIntegeri_v != NULL && glad_glGetIntegeri_v != glad_profile_glGetIntegeri_v) {
+		profile_real.GetIntegeri_v = glad_glGetIntegeri_v;
+		glad_glGetIntegeri_v = glad_profile_glGetIntegeri_v;
+	}
+	if(glad_glEnablei != NULL && glad_glEnablei != glad_profile_glEnablei) {
+		profile_real.Enablei = glad_glEnablei;
+		glad_glEnablei = glad_profile_glEnablei;
+	}
+	if(glad_glDisablei != NULL && glad_glDisablei != glad_profile_glDisablei) {
+		profile_real.Disablei = glad_glDisablei;
+		glad_glDisablei = glad_profile_glDisablei;
+	}
+	if(glad_glIsEnabledi != NULL && glad_glIsEnabledi != glad_profile_glIsEnabledi) {
+		profile_real.IsEnabledi = glad_glIsEnabledi;
+		glad_glIsEnabledi = glad_profile_glIsEnabledi;
+	}
+	if(glad_glBeginTransformFeedback != NULL && glad_glBeginTransformFeedback != glad_profile_glBeginTransformFeedback) {
+		profile_real.BeginTransformFeedback = glad_glBeginTransformFeedback;
+		glad_glBeginTransformFeedback = glad_profile_glBeginTransformFeedback;
+	}
+	if(glad_glEndTransformFeedback != NULL && glad_glEndTransformFeedback != glad_profile_glEndTransformFeedback) {
+		profile_real.EndTransformFeedback = glad_glEndTransformFeedback;
+		glad_glEndTransformFeedback = glad_profile_glEndTransformFeedback;
+	}
+	if(glad_glBindBufferRange != NULL && glad_glBindBufferRange != glad_profile_glBindBufferRange) {
+		profile_real.BindBufferRange = glad_glBindBufferRange;
+		glad_glBindBufferRange = glad_profile_glBindBufferRange;
+	}
+	if(glad_glBindBufferBase != NULL && glad_glBindBufferBase != glad_profile_glBindBufferBase) {
+		profile_real.BindBufferBase = glad_glBindBufferBase;
+		glad_glBindBufferBase = glad_profile_glBindBufferBase;
+	}
+	if(glad_glTransformFeedbackVaryings != NULL && glad_glTransformFeedbackVaryings != glad_profile_glTransformFeedbackVaryings) {
+		profile_real.TransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+		glad_glTransformFeedbackVaryings = glad_profile_glTransformFeedbackVaryings;
+	}
+	if(glad_glGetTransformFeedbackVarying != NULL && glad_glGetTransformFeedbackVarying != glad_profile_glGetTransformFeedbackVarying) {
+		profile_real.GetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+		glad_glGetTransformFeedbackVarying = glad_profile_glGetTransformFeedbackVarying;
+	}
+	if(glad_glClampColor != NULL && glad_glClampColor != glad_profile_glClampColor) {
+		profile_real.ClampColor = glad_glClampColor;
+		glad_glClampColor = glad_profile_glClampColor;
+	}
+	if(glad_glBeginConditionalRender != NULL && glad_glBeginConditionalRender != glad_profile_glBeginConditionalRender) {
+		profile_real.BeginConditionalRender = glad_glBeginConditionalRender;
+		glad_glBeginConditionalRender = glad_profile_glBeginConditionalRender;
+	}
+	if(glad_glEndConditionalRender != NULL && glad_glEndConditionalRender != glad_profile_glEndConditionalRender) {
+		profile_real.EndConditionalRender = glad_glEndConditionalRender;
+		glad_glEndConditionalRender = glad_profile_glEndConditionalRender;
+	}
+	if(glad_glVertexAttribIPointer != NULL && glad_glVertexAttribIPointer != glad_profile_glVertexAttribIPointer) {
+		profile_real.VertexAttribIPointer = glad_glVertexAttribIPointer;
+		glad_glVertexAttribIPointer = glad_profile_glVertexAttribIPointer;
+	}
+	if(glad_glGetVertexAttribIiv != NULL && glad_glGetVertexAttribIiv != glad_profile_glGetVertexAttribIiv) {
+		profile_real.GetVertexAttribIiv = glad_glGetVertexAttribIiv;
+		glad_glGetVertexAttribIiv = glad_profile_glGetVertexAttribIiv;
+	}
+	if(glad_glGetVertexAttribIuiv != NULL && glad_glGetVertexAttribIuiv != glad_profile_glGetVertexAttribIuiv) {
+		profile_real.GetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+		glad_glGetVertexAttribIuiv = glad_profile_glGetVertexAttribIuiv;
+	}
+	if(glad_glVertexAttribI1i != NULL && glad_glVertexAttribI1i != glad_profile_glVertexAttribI1i) {
+		profile_real.VertexAttribI1i = glad_glVertexAttribI1i;
+		glad_glVertexAttribI1i = glad_profile_glVertexAttribI1i;
+	}
+	if(glad_glVertexAttribI2i != NULL && glad_glVertexAttribI2i != glad_profile_glVertexAttribI2i) {
+		profile_real.VertexAttribI2i = glad_glVertexAttribI2i;
+		glad_glVertexAttribI2i = glad_profile_glVertexAttribI2i;
+	}
+	if(glad_glVertexAttribI3i != NULL && glad_glVertexAttribI3i != glad_profile_glVertexAttribI3i) {
+		profile_real.VertexAttribI3i = glad_glVertexAttribI3i;
+		glad_glVertexAttribI3i = glad_profile_glVertexAttribI3i;
+	}
+	if(glad_glVertexAttribI4i != NULL && glad_glVertexAttribI4i != glad_profile_glVertexAttribI4i) {
+		profile_real.VertexAttribI4i = glad_glVertexAttribI4i;
+		glad_glVertexAttribI4i = glad_profile_glVertexAttribI4i;
+	}
+	if(glad_glVertexAttribI1ui != NULL && glad_glVertexAttribI1ui != glad_profile_glVertexAttribI1ui) {
+		profile_real.VertexAttribI1ui = glad_glVertexAttribI1ui;
+		glad_glVertexAttribI1ui = glad_profile_glVertexAttribI1ui;
+	}
+	if(glad_glVertexAttribI2ui != NULL && glad_glVertexAttribI2ui != glad_profile_glVertexAttribI2ui) {
+		profile_real.VertexAttribI2ui = glad_glVertexAttribI2ui;
+		glad_glVertexAttribI2ui = glad_profile_glVertexAttribI2ui;
+	}
+	if(glad_glVertexAttribI3ui != NULL && glad_glVertexAttribI3ui != glad_profile_glVertexAttribI3ui) {
+		profile_real.VertexAttribI3ui = glad_glVertexAttribI3ui;
+		glad_glVertexAttribI3ui = glad_profile_glVertexAttribI3ui;
+	}
+	if(glad_glVertexAttribI4ui != NULL && glad_glVertexAttribI4ui != glad_profile_glVertexAttribI4ui) {
+		profile_real.VertexAttribI4ui = glad_glVertexAttribI4ui;
+		glad_glVertexAttribI4ui = glad_profile_glVertexAttribI4ui;
+	}
+	if(glad_glVertexAttribI1iv != NULL && glad_glVertexAttribI1iv != glad_profile_glVertexAttribI1iv) {
+		profile_real.VertexAttribI1iv = glad_glVertexAttribI1iv;
+		glad_glVertexAttribI1iv = glad_profile_glVertexAttribI1iv;
+	}
+	if(glad_glVertexAttribI2iv != NULL && glad_glVertexAttribI2iv != glad_profile_glVertexAttribI2iv) {
+		profile_real.VertexAttribI2iv = glad_glVertexAttribI2iv;
+		glad_glVertexAttribI2iv = glad_profile_glVertexAttribI2iv;
+	}
+	if(glad_glVertexAttribI3iv != NULL && glad_glVertexAttribI3iv != glad_profile_glVertexAttribI3iv) {
+		profile_real.VertexAttribI3iv = glad_glVertexAttribI3iv;
+		glad_glVertexAttribI3iv = glad_profile_glVertexAttribI3iv;
+	}
+	if(glad_glVertexAttribI4iv != NULL && glad_glVertexAttribI4iv != glad_profile_glVertexAttribI4iv) {
+		profile_real.VertexAttribI4iv = glad_glVertexAttribI4iv;
+		glad_glVertexAttribI4iv = glad_profile_glVertexAttribI4iv;
+	}
+	if(glad_glVertexAttribI1uiv != NULL && glad_glVertexAttribI1uiv != glad_profile_glVertexAttribI1uiv) {
+		profile_real.VertexAttribI1uiv = glad_glVertexAttribI1uiv;
+		glad_glVertexAttribI1uiv = glad_profile_glVertexAttribI1uiv;
+	}
+	if(glad_glVertexAttribI2uiv != NULL && glad_glVertexAttribI2uiv != glad_profile_glVertexAttribI2uiv) {
+		profile_real.VertexAttribI2uiv = glad_glVertexAttribI2uiv;
+		glad_glVertexAttribI2uiv = glad_profile_glVertexAttribI2uiv;
+	}
+	if(glad_glVertexAttribI3uiv != NULL && glad_glVertexAttribI3uiv != glad_profile_glVertexAttribI3uiv) {
+		profile_real.VertexAttribI3uiv = glad_glVertexAttribI3uiv;
+		glad_glVertexAttribI3uiv = glad_profile_glVertexAttribI3uiv;
+	}
+	if(glad_glVertexAttribI4uiv != NULL && glad_glVertexAttribI4uiv != glad_profile_glVertexAttribI4uiv) {
+		profile_real.VertexAttribI4uiv = glad_glVertexAttribI4uiv;
+		glad_glVertexAttribI4uiv = glad_profile_glVertexAttribI4uiv;
+	}
+	if(glad_glVertexAttribI4bv != NULL && glad_glVertexAttribI4bv != glad_profile_glVertexAttribI4bv) {
+		profile_real.VertexAttribI4bv = glad_glVertexAttribI4bv;
+		glad_glVertexAttribI4bv = glad_profile_glVertexAttribI4bv;
+	}
+	if(glad_glVertexAttribI4sv != NULL && glad_glVertexAttribI4sv != glad_profile_glVertexAttribI4sv) {
+		profile_real.VertexAttribI4sv = glad_glVertexAttribI4sv;
+		glad_glVertexAttribI4sv = glad_profile_glVertexAttribI4sv;
+	}
+	if(glad_glVertexAttribI4ubv != NULL && glad_glVertexAttribI4ubv != glad_profile_glVertexAttribI4ubv) {
+		profile_real.VertexAttribI4ubv = glad_glVertexAttribI4ubv;
+		glad_glVertexAttribI4ubv = glad_profile_glVertexAttribI4ubv;
+	}
+	if(glad_glVertexAttribI4usv != NULL && glad_glVertexAttribI4usv != glad_profile_glVertexAttribI4usv) {
+		profile_real.VertexAttribI4usv = glad_glVertexAttribI4usv;
+		glad_glVertexAttribI4usv = glad_profile_glVertexAttribI4usv;
+	}
+	if(glad_glGetUniformuiv != NULL && glad_glGetUniformuiv != glad_profile_glGetUniformuiv) {
+		profile_real.GetUniformuiv = glad_glGetUniformuiv;
+		glad_glGetUniformuiv = glad_profile_glGetUniformuiv;
+	}
+	if(glad_glBindFragDataLocation != NULL && glad_glBindFragDataLocation != glad_profile_glBindFragDataLocation) {
+		profile_real.BindFragDataLocation = glad_glBindFragDataLocation;
+		glad_glBindFragDataLocation = glad_profile_glBindFragDataLocation;
+	}
+	if(glad_glGetFragDataLocation != NULL && glad_glGetFragDataLocation != glad_profile_glGetFragDataLocation) {
+		profile_real.GetFragDataLocation = glad_glGetFragDataLocation;
+		glad_glGetFragDataLocation = glad_profile_glGetFragDataLocation;
+	}
+	if(glad_glUniform1ui != NULL && glad_glUniform1ui != glad_profile_glUniform1ui) {
+		profile_real.Uniform1ui = glad_glUniform1ui;
+		glad_glUniform1ui = glad_profile_glUniform1ui;
+	}
+	if(glad_glUniform2ui != NULL && glad_glUniform2ui != glad_profile_glUniform2ui) {
+		profile_real.Uniform2ui = glad_glUniform2ui;
+		glad_glUniform2ui = glad_profile_glUniform2ui;
+	}
+	if(glad_glUniform3ui != NULL && glad_glUniform3ui != glad_profile_glUniform3ui) {
+		profile_real.Uniform3ui = glad_glUniform3ui;
+		glad_glUniform3ui = glad_profile_glUniform3ui;
+	}
+	if(glad_glUniform4ui != NULL && glad_glUniform4ui != glad_profile_glUniform4ui) {
+		profile_real.Uniform4ui = glad_glUniform4ui;
+		glad_glUniform4ui = glad_profile_glUniform4ui;
+	}
+	if(glad_glUniform1uiv != NULL && glad_glUniform1uiv != glad_profile_glUniform1uiv) {
+		profile_real.Uniform1uiv = glad_glUniform1uiv;
+		glad_glUniform1uiv = glad_profile_glUniform1uiv;
+	}
+	if(glad_glUniform2uiv != NULL && glad_glUniform2uiv != glad_profile_glUniform2uiv) {
+		profile_real.Uniform2uiv = glad_glUniform2uiv;
+		glad_glUniform2uiv = glad_profile_glUniform2uiv;
+	}
+	if(glad_glUniform3uiv != NULL && glad_glUniform3uiv != glad_profile_glUniform3uiv) {
+		profile_real.Uniform3uiv = glad_glUniform3uiv;
+		glad_glUniform3uiv = glad_profile_glUniform3uiv;
+	}
+	if(glad_glUniform4uiv != NULL && glad_glUniform4uiv != glad_profile_glUniform4uiv) {
+		profile_real.Uniform4uiv = glad_glUniform4uiv;
+		glad_glUniform4uiv = glad_profile_glUniform4uiv;
+	}
+	if(glad_glTexParameterIiv != NULL && glad_glTexParameterIiv != glad_profile_glTexParameterIiv) {
+		profile_real.TexParameterIiv = glad_glTexParameterIiv;
+		glad_glTexParameterIiv = glad_profile_glTexParameterIiv;
+	}
+	if(glad_glTexParameterIuiv != NULL && glad_glTexParameterIuiv != glad_profile_glTexParameterIuiv) {
+		profile_real.TexParameterIuiv = glad_glTexParameterIuiv;
+		glad_glTexParameterIuiv = glad_profile_glTexParameterIuiv;
+	}
+	if(glad_glGetTexParameterIiv != NULL && glad_glGetTexParameterIiv != glad_profile_glGetTexParameterIiv) {
+		profile_real.GetTexParameterIiv = glad_glGetTexParameterIiv;
+		glad_glGetTexParameterIiv = glad_profile_glGetTexParameterIiv;
+	}
+	if(glad_glGetTexParameterIuiv != NULL && glad_glGetTexParameterIuiv != glad_profile_glGetTexParameterIuiv) {
+		profile_real.GetTexParameterIuiv = glad_glGetTexParameterIuiv;
+		glad_glGetTexParameterIuiv = glad_profile_glGetTexParameterIuiv;
+	}
+	if(glad_glClearBufferiv != NULL && glad_glClearBufferiv != glad_profile_glClearBufferiv) {
+		profile_real.ClearBufferiv = glad_glClearBufferiv;
+		glad_glClearBufferiv = glad_profile_glClearBufferiv;
+	}
+	if(glad_glClearBufferuiv != NULL && glad_glClearBufferuiv != glad_profile_glClearBufferuiv) {
+		profile_real.ClearBufferuiv = glad_glClearBufferuiv;
+		glad_glClearBufferuiv = glad_profile_glClearBufferuiv;
+	}
+	if(glad_glClearBufferfv != NULL && glad_glClearBufferfv != glad_profile_glClearBufferfv) {
+		profile_real.ClearBufferfv = glad_glClearBufferfv;
+		glad_glClearBufferfv = glad_profile_glClearBufferfv;
+	}
+	if(glad_glClearBufferfi != NULL && glad_glClearBufferfi != glad_profile_glClearBufferfi) {
+		profile_real.ClearBufferfi = glad_glClearBufferfi;
+		glad_glClearBufferfi = glad_profile_glClearBufferfi;
+	}
+	if(glad_glGetStringi != NULL && glad_glGetStringi != glad_profile_glGetStringi) {
+		profile_real.GetStringi = glad_glGetStringi;
+		glad_glGetStringi = glad_profile_glGetStringi;
+	}
+	if(glad_glIsRenderbuffer != NULL && glad_glIsRenderbuffer != glad_profile_glIsRenderbuffer) {
+		profile_real.IsRenderbuffer = glad_glIsRenderbuffer;
+		glad_glIsRenderbuffer = glad_profile_glIsRenderbuffer;
+	}
+	if(glad_glBindRenderbuffer != NULL && glad_glBindRenderbuffer != glad_profile_glBindRenderbuffer) {
+		profile_real.BindRenderbuffer = glad_glBindRenderbuffer;
+		glad_glBindRenderbuffer = glad_profile_glBindRenderbuffer;
+	}
+	if(glad_glDeleteRenderbuffers != NULL && glad_glDeleteRenderbuffers != glad_profile_glDeleteRenderbuffers) {
+		profile_real.DeleteRenderbuffers = glad_glDeleteRenderbuffers;
+		glad_glDeleteRenderbuffers = glad_profile_glDeleteRenderbuffers;
+	}
+	if(glad_glGenRenderbuffers != NULL && glad_glGenRenderbuffers != glad_profile_glGenRenderbuffers) {
+		profile_real.GenRenderbuffers = glad_glGenRenderbuffers;
+		glad_glGenRenderbuffers = glad_profile_glGenRenderbuffers;
+	}
+	if(glad_glRenderbufferStorage != NULL && glad_glRenderbufferStorage != glad_profile_glRenderbufferStorage) {
+		profile_real.RenderbufferStorage = glad_glRenderbufferStorage;
+		glad_glRenderbufferStorage = glad_profile_glRenderbufferStorage;
+	}
+	if(glad_glGetRenderbufferParameteriv != NULL && glad_glGetRenderbufferParameteriv != glad_profile_glGetRenderbufferParameteriv) {
+		profile_real.GetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+		glad_glGetRenderbufferParameteriv = glad_profile_glGetRenderbufferParameteriv;
+	}
+	if(glad_glIsFramebuffer != NULL && glad_glIsFramebuffer != glad_profile_glIsFramebuffer) {
+		profile_real.IsFramebuffer = glad_glIsFramebuffer;
+		glad_glIsFramebuffer = glad_profile_glIsFramebuffer;
+	}
+	if(glad_glBindFramebuffer != NULL && glad_glBindFramebuffer != glad_profile_glBindFramebuffer) {
+		profile_real.BindFramebuffer = glad_glBindFramebuffer;
+		glad_glBindFramebuffer = glad_profile_glBindFramebuffer;
+	}
+	if(glad_glDeleteFramebuffers != NULL && glad_glDeleteFramebuffers != glad_profile_glDeleteFramebuffers) {
+		profile_real.DeleteFramebuffers = glad_glDeleteFramebuffers;
+		glad_glDeleteFramebuffers = glad_profile_glDeleteFramebuffers;
+	}
+	if(glad_glGenFramebuffers != NULL && glad_glGenFramebuffers != glad_profile_glGenFramebuffers) {
+		profile_real.GenFramebuffers = glad_glGenFramebuffers;
+		glad_glGenFramebuffers = glad_profile_glGenFramebuffers;
+	}
+	if(glad_glCheckFramebufferStatus != NULL && glad_glCheckFramebufferStatus != glad_profile_glCheckFramebufferStatus) {
+		profile_real.CheckFramebufferStatus = glad_glCheckFramebufferStatus;
+		glad_glCheckFramebufferStatus = glad_profile_glCheckFramebufferStatus;
+	}
+	if(glad_glFramebufferTexture1D != NULL && glad_glFramebufferTexture1D != glad_profile_glFramebufferTexture1D) {
+		profile_real.FramebufferTexture1D = glad_glFramebufferTexture1D;
+		glad_glFramebufferTexture1D = glad_profile_glFramebufferTexture1D;
+	}
+	if(glad_glFramebufferTexture2D != NULL && glad_glFramebufferTexture2D != glad_profile_glFramebufferTexture2D) {
+		profile_real.FramebufferTexture2D = glad_glFramebufferTexture2D;
+		glad_glFramebufferTexture2D = glad_profile_glFramebufferTexture2D;
+	}
+	if(glad_glFramebufferTexture3D != NULL && glad_glFramebufferTexture3D != glad_profile_glFramebufferTexture3D) {
+		profile_real.FramebufferTexture3D = glad_glFramebufferTexture3D;
+		glad_glFramebufferTexture3D = glad_profile_glFramebufferTexture3D;
+	}
+	if(glad_glFramebufferRenderbuffer != NULL && glad_glFramebufferRenderbuffer != glad_profile_glFramebufferRenderbuffer) {
+		profile_real.FramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+		glad_glFramebufferRenderbuffer = glad_profile_glFramebufferRenderbuffer;
+	}
+	if(glad_glGetFramebufferAttachmentParameteriv != NULL && glad_glGetFramebufferAttachmentParameteriv != glad_profile_glGetFramebufferAttachmentParameteriv) {
+		profile_real.GetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+		glad_glGetFramebufferAttachmentParameteriv = glad_profile_glGetFramebufferAttachmentParameteriv;
+	}
+	if(glad_glGenerateMipmap != NULL && glad_glGenerateMipmap != glad_profile_glGenerateMipmap) {
+		profile_real.GenerateMipmap = glad_glGenerateMipmap;
+		glad_glGenerateMipmap = glad_profile_glGenerateMipmap;
+	}
+	if(glad_glBlitFramebuffer != NULL && glad_glBlitFramebuffer != glad_profile_glBlitFramebuffer) {
+		profile_real.BlitFramebuffer = glad_glBlitFramebuffer;
+		glad_glBlitFramebuffer = glad_profile_glBlitFramebuffer;
+	}
+	if(glad_glRenderbufferStorageMultisample != NULL && glad_glRenderbufferStorageMultisample != glad_profile_glRenderbufferStorageMultisample) {
+		profile_real.RenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+		glad_glRenderbufferStorageMultisample = glad_profile_glRenderbufferStorageMultisample;
+	}
+	if(glad_glFramebufferTextureLayer != NULL && glad_glFramebufferTextureLayer != glad_profile_glFramebufferTextureLayer) {
+		profile_real.FramebufferTextureLayer = glad_glFramebufferTextureLayer;
+		glad_glFramebufferTextureLayer = glad_profile_glFramebufferTextureLayer;
+	}
+	if(glad_glMapBufferRange != NULL && glad_glMapBufferRange != glad_profile_glMapBufferRange) {
+		profile_real.MapBufferRange = glad_glMapBufferRange;
+		glad_glMapBufferRange = glad_profile_glMapBufferRange;
+	}
+	if(glad_glFlushMappedBufferRange != NULL && glad_glFlushMappedBufferRange != glad_profile_glFlushMappedBufferRange) {
+		profile_real.FlushMappedBufferRange = glad_glFlushMappedBufferRange;
+		glad_glFlushMappedBufferRange = glad_profile_glFlushMappedBufferRange;
+	}
+	if(glad_glBindVertexArray != NULL && glad_glBindVertexArray != glad_profile_glBindVertexArray) {
+		profile_real.BindVertexArray = glad_glBindVertexArray;
+		glad_glBindVertexArray = glad_profile_glBindVertexArray;
+	}
+	if(glad_glDeleteVertexArrays != NULL && glad_glDeleteVertexArrays != glad_profile_glDeleteVertexArrays) {
+		profile_real.DeleteVertexArrays = glad_glDeleteVertexArrays;
+		glad_glDeleteVertexArrays = glad_profile_glDeleteVertexArrays;
+	}
+	if(glad_glGenVertexArrays != NULL && glad_glGenVertexArrays != glad_profile_glGenVertexArrays) {
+		profile_real.GenVertexArrays = glad_glGenVertexArrays;
+		glad_glGenVertexArrays = glad_profile_glGenVertexArrays;
+	}
+	if(glad_glIsVertexArray != NULL && glad_glIsVertexArray != glad_profile_glIsVertexArray) {
+		profile_real.IsVertexArray = glad_glIsVertexArray;
+		glad_glIsVertexArray = glad_profile_glIsVertexArray;
+	}
+	if(glad_glDrawArraysInstanced != NULL && glad_glDrawArraysInstanced != glad_profile_glDrawArraysInstanced) {
+		profile_real.DrawArraysInstanced = glad_glDrawArraysInstanced;
+		glad_glDrawArraysInstanced = glad_profile_glDrawArraysInstanced;
+	}
+	if(glad_glDrawElementsInstanced != NULL && glad_glDrawElementsInstanced != glad_profile_glDrawElementsInstanced) {
+		profile_real.DrawElementsInstanced = glad_glDrawElementsInstanced;
+		glad_glDrawElementsInstanced = glad_profile_glDrawElementsInstanced;
+	}
+	if(glad_glTexBuffer != NULL && glad_glTexBuffer != glad_profile_glTexBuffer) {
+		profile_real.TexBuffer = glad_glTexBuffer;
+		glad_glTexBuffer = glad_profile_glTexBuffer;
+	}
+	if(glad_glPrimitiveRestartIndex != NULL && glad_glPrimitiveRestartIndex != glad_profile_glPrimitiveRestartIndex) {
+		profile_real.PrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+		glad_glPrimitiveRestartIndex = glad_profile_glPrimitiveRestartIndex;
+	}
+	if(glad_glCopyBufferSubData != NULL && glad_glCopyBufferSubData != glad_profile_glCopyBufferSubData) {
+		profile_real.CopyBufferSubData = glad_glCopyBufferSubData;
+		glad_glCopyBufferSubData = glad_profile_glCopyBufferSubData;
+	}
+	if(glad_glGetUniformIndices != NULL && glad_glGetUniformIndices != glad_profile_glGetUniformIndices) {
+		profile_real.GetUniformIndices = glad_glGetUniformIndices;
+		glad_glGetUniformIndices = glad_profile_glGetUniformIndices;
+	}
+	if(glad_glGetActiveUniformsiv != NULL && glad_glGetActiveUniformsiv != glad_profile_glGetActiveUniformsiv) {
+		profile_real.GetActiveUniformsiv = glad_glGetActiveUniformsiv;
+		glad_glGetActiveUniformsiv = glad_profile_glGetActiveUniformsiv;
+	}
+	if(glad_glGetActiveUniformName != NULL && glad_glGetActiveUniformName != glad_profile_glGetActiveUniformName) {
+		profile_real.GetActiveUniformName = glad_glGetActiveUniformName;
+		glad_glGetActiveUniformName = glad_profile_glGetActiveUniformName;
+	}
+	if(glad_glGetUniformBlockIndex != NULL && glad_glGetUniformBlockIndex != glad_profile_glGetUniformBlockIndex) {
+		profile_real.GetUniformBlockIndex = glad_glGetUniformBlockIndex;
+		glad_glGetUniformBlockIndex = glad_profile_glGetUniformBlockIndex;
+	}
+	if(glad_glGetActiveUniformBlockiv != NULL && glad_glGetActiveUniformBlockiv != glad_profile_glGetActiveUniformBlockiv) {
+		profile_real.GetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+		glad_glGetActiveUniformBlockiv = glad_profile_glGetActiveUniformBlockiv;
+	}
+	if(glad_glGetActiveUniformBlockName != NULL && glad_glGetActiveUniformBlockName != glad_profile_glGetActiveUniformBlockName) {
+		profile_real.GetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+		glad_glGetActiveUniformBlockName = glad_profile_glGetActiveUniformBlockName;
+	}
+	if(glad_glUniformBlockBinding != NULL && glad_glUniformBlockBinding != glad_profile_glUniformBlockBinding) {
+		profile_real.UniformBlockBinding = glad_glUniformBlockBinding;
+		glad_glUniformBlockBinding = glad_profile_glUniformBlockBinding;
+	}
+	if(glad_glDrawElementsBaseVertex != NULL && glad_glDrawElementsBaseVertex != glad_profile_glDrawElementsBaseVertex) {
+		profile_real.DrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+		glad_glDrawElementsBaseVertex = glad_profile_glDrawElementsBaseVertex;
+	}
+	if(glad_glDrawRangeElementsBaseVertex != NULL && glad_glDrawRangeElementsBaseVertex != glad_profile_glDrawRangeElementsBaseVertex) {
+		profile_real.DrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+		glad_glDrawRangeElementsBaseVertex = glad_profile_glDrawRangeElementsBaseVertex;
+	}
+	if(glad_glDrawElementsInstancedBaseVertex != NULL && glad_glDrawElementsInstancedBaseVertex != glad_profile_glDrawElementsInstancedBaseVertex) {
+		profile_real.DrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+		glad_glDrawElementsInstancedBaseVertex = glad_profile_glDrawElementsInstancedBaseVertex;
+	}
+	if(glad_glMultiDrawElementsBaseVertex != NULL && glad_glMultiDrawElementsBaseVertex != glad_profile_glMultiDrawElementsBaseVertex) {
+		profile_real.MultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+		glad_glMultiDrawElementsBaseVertex = glad_profile_glMultiDrawElementsBaseVertex;
+	}
+	if(glad_glProvokingVertex != NULL && glad_glProvokingVertex != glad_profile_glProvokingVertex) {
+		profile_real.ProvokingVertex = glad_glProvokingVertex;
+		glad_glProvokingVertex = glad_profile_glProvokingVertex;
+	}
+	if(glad_glFenceSync != NULL && glad_glFenceSync != glad_profile_glFenceSync) {
+		profile_real.FenceSync = glad_glFenceSync;
+		glad_glFenceSync = glad_profile_glFenceSync;
+	}
+	if(glad_glIsSync != NULL && glad_glIsSync != glad_profile_glIsSync) {
+		profile_real.IsSync = glad_glIsSync;
+		glad_glIsSync = glad_profile_glIsSync;
+	}
+	if(glad_glDeleteSync != NULL && glad_glDeleteSync != glad_profile_glDeleteSync) {
+		profile_real.DeleteSync = glad_glDeleteSync;
+		glad_glDeleteSync = glad_profile_glDeleteSync;
+	}
+	if(glad_glClientWaitSync != NULL && glad_glClientWaitSync != glad_profile_glClientWaitSync) {
+		profile_real.ClientWaitSync = glad_glClientWaitSync;
+		glad_glClientWaitSync = glad_profile_glClientWaitSync;
+	}
+	if(glad_glWaitSync != NULL && glad_glWaitSync != glad_profile_glWaitSync) {
+		profile_real.WaitSync = glad_glWaitSync;
+		glad_glWaitSync = glad_profile_glWaitSync;
+	}
+	if(glad_glGetInteger64v != NULL && glad_glGetInteger64v != glad_profile_glGetInteger64v) {
+		profile_real.GetInteger64v = glad_glGetInteger64v;
+		glad_glGetInteger64v = glad_profile_glGetInteger64v;
+	}
+	if(glad_glGetSynciv != NULL && glad_glGetSynciv != glad_profile_glGetSynciv) {
+		profile_real.GetSynciv = glad_glGetSynciv;
+		glad_glGetSynciv = glad_profile_glGetSynciv;
+	}
+	if(glad_glGetInteger64i_v != NULL && glad_glGetInteger64i_v != glad_profile_glGetInteger64i_v) {
+		profile_real.GetInteger64i_v = glad_glGetInteger64i_v;
+		glad_glGetInteger64i_v = glad_profile_glGetInteger64i_v;
+	}
+	if(glad_glGetBufferParameteri64v != NULL && glad_glGetBufferParameteri64v != glad_profile_glGetBufferParameteri64v) {
+		profile_real.GetBufferParameteri64v = glad_glGetBufferParameteri64v;
+		glad_glGetBufferParameteri64v = glad_profile_glGetBufferParameteri64v;
+	}
+	if(glad_glFramebufferTexture != NULL && glad_glFramebufferTexture != glad_profile_glFramebufferTexture) {
+		profile_real.FramebufferTexture = glad_glFramebufferTexture;
+		glad_glFramebufferTexture = glad_profile_glFramebufferTexture;
+	}
+	if(glad_glTexImage2DMultisample != NULL && glad_glTexImage2DMultisample != glad_profile_glTexImage2DMultisample) {
+		profile_real.TexImage2DMultisample = glad_glTexImage2DMultisample;
+		glad_glTexImage2DMultisample = glad_profile_glTexImage2DMultisample;
+	}
+	if(glad_glTexImage3DMultisample != NULL && glad_glTexImage3DMultisample != glad_profile_glTexImage3DMultisample) {
+		profile_real.TexImage3DMultisample = glad_glTexImage3DMultisample;
+		glad_glTexImage3DMultisample = glad_profile_glTexImage3DMultisample;
+	}
+	if(glad_glGetMultisamplefv != NULL && glad_glGetMultisamplefv != glad_profile_glGetMultisamplefv) {
+		profile_real.GetMultisamplefv = glad_glGetMultisamplefv;
+		glad_glGetMultisamplefv = glad_profile_glGetMultisamplefv;
+	}
+	if(glad_glSampleMaski != NULL && glad_glSampleMaski != glad_profile_glSampleMaski) {
+		profile_real.SampleMaski = glad_glSampleMaski;
+		glad_glSampleMaski = glad_profile_glSampleMaski;
+	}
+	if(glad_glBindFragDataLocationIndexed != NULL && glad_glBindFragDataLocationIndexed != glad_profile_glBindFragDataLocationIndexed) {
+		profile_real.BindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+		glad_glBindFragDataLocationIndexed = glad_profile_glBindFragDataLocationIndexed;
+	}
+	if(glad_glGetFragDataIndex != NULL && glad_glGetFragDataIndex != glad_profile_glGetFragDataIndex) {
+		profile_real.GetFragDataIndex = glad_glGetFragDataIndex;
+		glad_glGetFragDataIndex = glad_profile_glGetFragDataIndex;
+	}
+	if(glad_glGenSamplers != NULL && glad_glGenSamplers != glad_profile_glGenSamplers) {
+		profile_real.GenSamplers = glad_glGenSamplers;
+		glad_glGenSamplers = glad_profile_glGenSamplers;
+	}
+	if(glad_glDeleteSamplers != NULL && glad_glDeleteSamplers != glad_profile_glDeleteSamplers) {
+		profile_real.DeleteSamplers = glad_glDeleteSamplers;
+		glad_glDeleteSamplers = glad_profile_glDeleteSamplers;
+	}
+	if(glad_glIsSampler != NULL && glad_glIsSampler != glad_profile_glIsSampler) {
+		profile_real.IsSampler = glad_glIsSampler;
+		glad_glIsSampler = glad_profile_glIsSampler;
+	}
+	if(glad_glBindSampler != NULL && glad_glBindSampler != glad_profile_glBindSampler) {
+		profile_real.BindSampler = glad_glBindSampler;
+		glad_glBindSampler = glad_profile_glBindSampler;
+	}
+	if(glad_glSamplerParameteri != NULL && glad_glSamplerParameteri != glad_profile_glSamplerParameteri) {
+		profile_real.SamplerParameteri = glad_glSamplerParameteri;
+		glad_glSamplerParameteri = glad_profile_glSamplerParameteri;
+	}
+	if(glad_glSamplerParameteriv != NULL && glad_glSamplerParameteriv != glad_profile_glSamplerParameteriv) {
+		profile_real.SamplerParameteriv = glad_glSamplerParameteriv;
+		glad_glSamplerParameteriv = glad_profile_glSamplerParameteriv;
+	}
+	if(glad_glSamplerParameterf != NULL && glad_glSamplerParameterf != glad_profile_glSamplerParameterf) {
+		profile_real.SamplerParameterf = glad_glSamplerParameterf;
+		glad_glSamplerParameterf = glad_profile_glSamplerParameterf;
+	}
+	if(glad_glSamplerParameterfv != NULL && glad_glSamplerParameterfv != glad_profile_glSamplerParameterfv) {
+		profile_real.SamplerParameterfv = glad_glSamplerParameterfv;
+		glad_glSamplerParameterfv = glad_profile_glSamplerParameterfv;
+	}
+	if(glad_glSamplerParameterIiv != NULL && glad_glSamplerParameterIiv != glad_profile_glSamplerParameterIiv) {
+		profile_real.SamplerParameterIiv = glad_glSamplerParameterIiv;
+		glad_glSamplerParameterIiv = glad_profile_glSamplerParameterIiv;
+	}
+	if(glad_glSamplerParameterIuiv != NULL && glad_glSamplerParameterIuiv != glad_profile_glSamplerParameterIuiv) {
+		profile_real.SamplerParameterIuiv = glad_glSamplerParameterIuiv;
+		glad_glSamplerParameterIuiv = glad_profile_glSamplerParameterIuiv;
+	}
+	if(glad_glGetSamplerParameteriv != NULL && glad_glGetSamplerParameteriv != glad_profile_glGetSamplerParameteriv) {
+		profile_real.GetSamplerParameteriv = glad_glGetSamplerParameteriv;
+		glad_glGetSamplerParameteriv = glad_profile_glGetSamplerParameteriv;
+	}
+	if(glad_glGetSamplerParameterIiv != NULL && glad_glGetSamplerParameterIiv != glad_profile_glGetSamplerParameterIiv) {
+		profile_real.GetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+		glad_glGetSamplerParameterIiv = glad_profile_glGetSamplerParameterIiv;
+	}
+	if(glad_glGetSamplerParameterfv != NULL && glad_glGetSamplerParameterfv != glad_profile_glGetSamplerParameterfv) {
+		profile_real.GetSamplerParameterfv = glad_glGetSamplerParameterfv;
+		glad_glGetSamplerParameterfv = glad_profile_glGetSamplerParameterfv;
+	}
+	if(glad_glGetSamplerParameterIuiv != NULL && glad_glGetSamplerParameterIuiv != glad_profile_glGetSamplerParameterIuiv) {
+		profile_real.GetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+		glad_glGetSamplerParameterIuiv = glad_profile_glGetSamplerParameterIuiv;
+	}
+	if(glad_glQueryCounter != NULL && glad_glQueryCounter != glad_profile_glQueryCounter) {
+		profile_real.QueryCounter = glad_glQueryCounter;
+		glad_glQueryCounter = glad_profile_glQueryCounter;
+	}
+	if(glad_glGetQueryObjecti64v != NULL && glad_glGetQueryObjecti64v != glad_profile_glGetQueryObjecti64v) {
+		profile_real.GetQueryObjecti64v = glad_glGetQueryObjecti64v;
+		glad_glGetQueryObjecti64v = glad_profile_glGetQueryObjecti64v;
+	}
+	if(glad_glGetQueryObjectui64v != NULL && glad_glGetQueryObjectui64v != glad_profile_glGetQueryObjectui64v) {
+		profile_real.GetQueryObjectui64v = glad_glGetQueryObjectui64v;
+		glad_glGetQueryObjectui64v = glad_profile_glGetQueryObjectui64v;
+	}
+	if(glad_glVertexAttribDivisor != NULL && glad_glVertexAttribDivisor != glad_profile_glVertexAttribDivisor) {
+		profile_real.VertexAttribDivisor = glad_glVertexAttribDivisor;
+		glad_glVertexAttribDivisor = glad_profile_glVertexAttribDivisor;
+	}
+	if(glad_glVertexAttribP1ui != NULL && glad_glVertexAttribP1ui != glad_profile_glVertexAttribP1ui) {
+		profile_real.VertexAttribP1ui = glad_glVertexAttribP1ui;
+		glad_glVertexAttribP1ui = glad_profile_glVertexAttribP1ui;
+	}
+	if(glad_glVertexAttribP1uiv != NULL && glad_glVertexAttribP1uiv != glad_profile_glVertexAttribP1uiv) {
+		profile_real.VertexAttribP1uiv = glad_glVertexAttribP1uiv;
+		glad_glVertexAttribP1uiv = glad_profile_glVertexAttribP1uiv;
+	}
+	if(glad_glVertexAttribP2ui != NULL && glad_glVertexAttribP2ui != glad_profile_glVertexAttribP2ui) {
+		profile_real.VertexAttribP2ui = glad_glVertexAttribP2ui;
+		glad_glVertexAttribP2ui = glad_profile_glVertexAttribP2ui;
+	}
+	if(glad_glVertexAttribP2uiv != NULL && glad_glVertexAttribP2uiv != glad_profile_glVertexAttribP2uiv) {
+		profile_real.VertexAttribP2uiv = glad_glVertexAttribP2uiv;
+		glad_glVertexAttribP2uiv = glad_profile_glVertexAttribP2uiv;
+	}
+	if(glad_glVertexAttribP3ui != NULL && glad_glVertexAttribP3ui != glad_profile_glVertexAttribP3ui) {
+		profile_real.VertexAttribP3ui = glad_glVertexAttribP3ui;
+		glad_glVertexAttribP3ui = glad_profile_glVertexAttribP3ui;
+	}
+	if(glad_glVertexAttribP3uiv != NULL && glad_glVertexAttribP3uiv != glad_profile_glVertexAttribP3uiv) {
+		profile_real.VertexAttribP3uiv = glad_glVertexAttribP3uiv;
+		glad_glVertexAttribP3uiv = glad_profile_glVertexAttribP3uiv;
+	}
+	if(glad_glVertexAttribP4ui != NULL && glad_glVertexAttribP4ui != glad_profile_glVertexAttribP4ui) {
+		profile_real.VertexAttribP4ui = glad_glVertexAttribP4ui;
+		glad_glVertexAttribP4ui = glad_profile_glVertexAttribP4ui;
+	}
+	if(glad_glVertexAttribP4uiv != NULL && glad_glVertexAttribP4uiv != glad_profile_glVertexAttribP4uiv) {
+		profile_real.VertexAttribP4uiv = glad_glVertexAttribP4uiv;
+		glad_glVertexAttribP4uiv = glad_profile_glVertexAttribP4uiv;
+	}
+	if(glad_glVertexP2ui != NULL && glad_glVertexP2ui != glad_profile_glVertexP2ui) {
+		profile_real.VertexP2ui = glad_glVertexP2ui;
+		glad_glVertexP2ui = glad_profile_glVertexP2ui;
+	}
+	if(glad_glVertexP2uiv != NULL && glad_glVertexP2uiv != glad_profile_glVertexP2uiv) {
+		profile_real.VertexP2uiv = glad_glVertexP2uiv;
+		glad_glVertexP2uiv = glad_profile_glVertexP2uiv;
+	}
+	if(glad_glVertexP3ui != NULL && glad_glVertexP3ui != glad_profile_glVertexP3ui) {
+		profile_real.VertexP3ui = glad_glVertexP3ui;
+		glad_glVertexP3ui = glad_profile_glVertexP3ui;
+	}
+	if(glad_glVertexP3uiv != NULL && glad_glVertexP3uiv != glad_profile_glVertexP3uiv) {
+		profile_real.VertexP3uiv = glad_glVertexP3uiv;
+		glad_glVertexP3uiv = glad_profile_glVertexP3uiv;
+	}
+	if(glad_glVertexP4ui != NULL && glad_glVertexP4ui != glad_profile_glVertexP4ui) {
+		profile_real.VertexP4ui = glad_glVertexP4ui;
+		glad_glVertexP4ui = glad_profile_glVertexP4ui;
+	}
+	if(glad_glVertexP4uiv != NULL && glad_glVertexP4uiv != glad_profile_glVertexP4uiv) {
+		profile_real.VertexP4uiv = glad_glVertexP4uiv;
+		glad_glVertexP4uiv = glad_profile_glVertexP4uiv;
+	}
+	if(glad_glTexCoordP1ui != NULL && glad_glTexCoordP1ui != glad_profile_glTexCoordP1ui) {
+		profile_real.TexCoordP1ui = glad_glTexCoordP1ui;
+		glad_glTexCoordP1ui = glad_profile_glTexCoordP1ui;
+	}
+	if(glad_glTexCoordP1uiv != NULL && glad_glTexCoordP1uiv != glad_profile_glTexCoordP1uiv) {
+		profile_real.TexCoordP1uiv = glad_glTexCoordP1uiv;
+		glad_glTexCoordP1uiv = glad_profile_glTexCoordP1uiv;
+	}
+	if(glad_glTexCoordP2ui != NULL && glad_glTexCoordP2ui != glad_profile_glTexCoordP2ui) {
+		profile_real.TexCoordP2ui = glad_glTexCoordP2ui;
+		glad_glTexCoordP2ui = glad_profile_glTexCoordP2ui;
+	}
+	if(glad_glTexCoordP2uiv != NULL && glad_glTexCoordP2uiv != glad_profile_glTexCoordP2uiv) {
+		profile_real.TexCoordP2uiv = glad_glTexCoordP2uiv;
+		glad_glTexCoordP2uiv = glad_profile_glTexCoordP2uiv;
+	}
+	if(glad_glTexCoordP3ui != NULL && glad_glTexCoordP3ui != glad_profile_glTexCoordP3ui) {
+		profile_real.TexCoordP3ui = glad_glTexCoordP3ui;
+		glad_glTexCoordP3ui = glad_profile_glTexCoordP3ui;
+	}
+	if(glad_glTexCoordP3uiv != NULL && glad_glTexCoordP3uiv != glad_profile_glTexCoordP3uiv) {
+		profile_real.TexCoordP3uiv = glad_glTexCoordP3uiv;
+		glad_glTexCoordP3uiv = glad_profile_glTexCoordP3uiv;
+	}
+	if(glad_glTexCoordP4ui != NULL && glad_glTexCoordP4ui != glad_profile_glTexCoordP4ui) {
+		profile_real.TexCoordP4ui = glad_glTexCoordP4ui;
+		glad_glTexCoordP4ui = glad_profile_glTexCoordP4ui;
+	}
+	if(glad_glTexCoordP4uiv != NULL && glad_glTexCoordP4uiv != glad_profile_glTexCoordP4uiv) {
+		profile_real.TexCoordP4uiv = glad_glTexCoordP4uiv;
+		glad_glTexCoordP4uiv = glad_profile_glTexCoordP4uiv;
+	}
+	if(glad_glMultiTexCoordP1ui != NULL && glad_glMultiTexCoordP1ui != glad_profile_glMultiTexCoordP1ui) {
+		profile_real.MultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+		glad_glMultiTexCoordP1ui = glad_profile_glMultiTexCoordP1ui;
+	}
+	if(glad_glMultiTexCoordP1uiv != NULL && glad_glMultiTexCoordP1uiv != glad_profile_glMultiTexCoordP1uiv) {
+		profile_real.MultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+		glad_glMultiTexCoordP1uiv = glad_profile_glMultiTexCoordP1uiv;
+	}
+	if(glad_glMultiTexCoordP2ui != NULL && glad_glMultiTexCoordP2ui != glad_profile_glMultiTexCoordP2ui) {
+		profile_real.MultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+		glad_glMultiTexCoordP2ui = glad_profile_glMultiTexCoordP2ui;
+	}
+	if(glad_glMultiTexCoordP2uiv != NULL && glad_glMultiTexCoordP2uiv != glad_profile_glMultiTexCoordP2uiv) {
+		profile_real.MultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+		glad_glMultiTexCoordP2uiv = glad_profile_glMultiTexCoordP2uiv;
+	}
+	if(glad_glMultiTexCoordP3ui != NULL && glad_glMultiTexCoordP3ui != glad_profile_glMultiTexCoordP3ui) {
+		profile_real.MultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+		glad_glMultiTexCoordP3ui = glad_profile_glMultiTexCoordP3ui;
+	}
+	if(glad_glMultiTexCoordP3uiv != NULL && glad_glMultiTexCoordP3uiv != glad_profile_glMultiTexCoordP3uiv) {
+		profile_real.MultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+		glad_glMultiTexCoordP3uiv = glad_profile_glMultiTexCoordP3uiv;
+	}
+	if(glad_glMultiTexCoordP4ui != NULL && glad_glMultiTexCoordP4ui != glad_profile_glMultiTexCoordP4ui) {
+		profile_real.MultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+		glad_glMultiTexCoordP4ui = glad_profile_glMultiTexCoordP4ui;
+	}
+	if(glad_glMultiTexCoordP4uiv != NULL && glad_glMultiTexCoordP4uiv != glad_profile_glMultiTexCoordP4uiv) {
+		profile_real.MultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+		glad_glMultiTexCoordP4uiv = glad_profile_glMultiTexCoordP4uiv;
+	}
+	if(glad_glNormalP3ui != NULL && glad_glNormalP3ui != glad_profile_glNormalP3ui) {
+		profile_real.NormalP3ui = glad_glNormalP3ui;
+		glad_glNormalP3ui = glad_profile_glNormalP3ui;
+	}
+	if(glad_glNormalP3uiv != NULL && glad_glNormalP3uiv != glad_profile_glNormalP3uiv) {
+		profile_real.NormalP3uiv = glad_glNormalP3uiv;
+		glad_glNormalP3uiv = glad_profile_glNormalP3uiv;
+	}
+	if(glad_glColorP3ui != NULL && glad_glColorP3ui != glad_profile_glColorP3ui) {
+		profile_real.ColorP3ui = glad_glColorP3ui;
+		glad_glColorP3ui = glad_profile_glColorP3ui;
+	}
+	if(glad_glColorP3uiv != NULL && glad_glColorP3uiv != glad_profile_glColorP3uiv) {
+		profile_real.ColorP3uiv = glad_glColorP3uiv;
+		glad_glColorP3uiv = glad_profile_glColorP3uiv;
+	}
+	if(glad_glColorP4ui != NULL && glad_glColorP4ui != glad_profile_glColorP4ui) {
+		profile_real.ColorP4ui = glad_glColorP4ui;
+		glad_glColorP4ui = glad_profile_glColorP4ui;
+	}
+	if(glad_glColorP4uiv != NULL && glad_glColorP4uiv != glad_profile_glColorP4uiv) {
+		profile_real.ColorP4uiv = glad_glColorP4uiv;
+		glad_glColorP4uiv = glad_profile_glColorP4uiv;
+	}
+	if(glad_glSecondaryColorP3ui != NULL && glad_glSecondaryColorP3ui != glad_profile_glSecondaryColorP3ui) {
+		profile_real.SecondaryColorP3ui = glad_glSecondaryColorP3ui;
+		glad_glSecondaryColorP3ui = glad_profile_glSecondaryColorP3ui;
+	}
+	if(glad_glSecondaryColorP3uiv != NULL && glad_glSecondaryColorP3uiv != glad_profile_glSecondaryColorP3uiv) {
+		profile_real.SecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+		glad_glSecondaryColorP3uiv = glad_profile_glSecondaryColorP3uiv;
+	}
+	if(glad_glMinSampleShading != NULL && glad_glMinSampleShading != glad_profile_glMinSampleShading) {
+		profile_real.MinSampleShading = glad_glMinSampleShading;
+		glad_glMinSampleShading = glad_profile_glMinSampleShading;
+	}
+	if(glad_glBlendEquationi != NULL && glad_glBlendEquationi != glad_profile_glBlendEquationi) {
+		profile_real.BlendEquationi = glad_glBlendEquationi;
+		glad_glBlendEquationi = glad_profile_glBlendEquationi;
+	}
+	if(glad_glBlendEquationSeparatei != NULL && glad_glBlendEquationSeparatei != glad_profile_glBlendEquationSeparatei) {
+		profile_real.BlendEquationSeparatei = glad_glBlendEquationSeparatei;
+		glad_glBlendEquationSeparatei = glad_profile_glBlendEquationSeparatei;
+	}
+	if(glad_glBlendFunci != NULL && glad_glBlendFunci != glad_profile_glBlendFunci) {
+		profile_real.BlendFunci = glad_glBlendFunci;
+		glad_glBlendFunci = glad_profile_glBlendFunci;
+	}
+	if(glad_glBlendFuncSeparatei != NULL && glad_glBlendFuncSeparatei != glad_profile_glBlendFuncSeparatei) {
+		profile_real.BlendFuncSeparatei = glad_glBlendFuncSeparatei;
+		glad_glBlendFuncSeparatei = glad_profile_glBlendFuncSeparatei;
+	}
+	if(glad_glDrawArraysIndirect != NULL && glad_glDrawArraysIndirect != glad_profile_glDrawArraysIndirect) {
+		profile_real.DrawArraysIndirect = glad_glDrawArraysIndirect;
+		glad_glDrawArraysIndirect = glad_profile_glDrawArraysIndirect;
+	}
+	if(glad_glDrawElementsIndirect != NULL && glad_glDrawElementsIndirect != glad_profile_glDrawElementsIndirect) {
+		profile_real.DrawElementsIndirect = glad_glDrawElementsIndirect;
+		glad_glDrawElementsIndirect = glad_profile_glDrawElementsIndirect;
+	}
+	if(glad_glUniform1d != NULL && glad_glUniform1d != glad_profile_glUniform1d) {
+		profile_real.Uniform1d = glad_glUniform1d;
+		glad_glUniform1d = glad_profile_glUniform1d;
+	}
+	if(glad_glUniform2d != NULL && glad_glUniform2d != glad_profile_glUniform2d) {
+		profile_real.Uniform2d = glad_glUniform2d;
+		glad_glUniform2d = glad_profile_glUniform2d;
+	}
+	if(glad_glUniform3d != NULL && glad_glUniform3d != glad_profile_glUniform3d) {
+		profile_real.Uniform3d = glad_glUniform3d;
+		glad_glUniform3d = glad_profile_glUniform3d;
+	}
+	if(glad_glUniform4d != NULL && glad_glUniform4d != glad_profile_glUniform4d) {
+		profile_real.Uniform4d = glad_glUniform4d;
+		glad_glUniform4d = glad_profile_glUniform4d;
+	}
+	if(glad_glUniform1dv != NULL && glad_glUniform1dv != glad_profile_glUniform1dv) {
+		profile_real.Uniform1dv = glad_glUniform1dv;
+		glad_glUniform1dv = glad_profile_glUniform1dv;
+	}
+	if(glad_glUniform2dv != NULL && glad_glUniform2dv != glad_profile_glUniform2dv) {
+		profile_real.Uniform2dv = glad_glUniform2dv;
+		glad_glUniform2dv = glad_profile_glUniform2dv;
+	}
+	if(glad_glUniform3dv != NULL && glad_glUniform3dv != glad_profile_glUniform3dv) {
+		profile_real.Uniform3dv = glad_glUniform3dv;
+		glad_glUniform3dv = glad_profile_glUniform3dv;
+	}
+	if(glad_glUniform4dv != NULL && glad_glUniform4dv != glad_profile_glUniform4dv) {
+		profile_real.Uniform4dv = glad_glUniform4dv;
+		glad_glUniform4dv = glad_profile_glUniform4dv;
+	}
+	if(glad_glUniformMatrix2dv != NULL && glad_glUniformMatrix2dv != glad_profile_glUniformMatrix2dv) {
+		profile_real.UniformMatrix2dv = glad_glUniformMatrix2dv;
+		glad_glUniformMatrix2dv = glad_profile_glUniformMatrix2dv;
+	}
+	if(glad_glUniformMatrix3dv != NULL && glad_glUniformMatrix3dv != glad_profile_glUniformMatrix3dv) {
+		profile_real.UniformMatrix3dv = glad_glUniformMatrix3dv;
+		glad_glUniformMatrix3dv = glad_profile_glUniformMatrix3dv;
+	}
+	if(glad_glUniformMatrix4dv != NULL && glad_glUniformMatrix4dv != glad_profile_glUniformMatrix4dv) {
+		profile_real.UniformMatrix4dv = glad_glUniformMatrix4dv;
+		glad_glUniformMatrix4dv = glad_profile_glUniformMatrix4dv;
+	}
+	if(glad_glUniformMatrix2x3dv != NULL && glad_glUniformMatrix2x3dv != glad_profile_glUniformMatrix2x3dv) {
+		profile_real.UniformMatrix2x3dv = glad_glUniformMatrix2x3dv;
+		glad_glUniformMatrix2x3dv = glad_profile_glUniformMatrix2x3dv;
+	}
+	if(glad_glUniformMatrix2x4dv != NULL && glad_glUniformMatrix2x4dv != glad_profile_glUniformMatrix2x4dv) {
+		profile_real.UniformMatrix2x4dv = glad_glUniformMatrix2x4dv;
+		glad_glUniformMatrix2x4dv = glad_profile_glUniformMatrix2x4dv;
+	}
+	if(glad_glUniformMatrix3x2dv != NULL && glad_glUniformMatrix3x2dv != glad_profile_glUniformMatrix3x2dv) {
+		profile_real.UniformMatrix3x2dv = glad_glUniformMatrix3x2dv;
+		glad_glUniformMatrix3x2dv = glad_profile_glUniformMatrix3x2dv;
+	}
+	if(glad_glUniformMatrix3x4dv != NULL && glad_glUniformMatrix3x4dv != glad_profile_glUniformMatrix3x4dv) {
+		profile_real.UniformMatrix3x4dv = glad_glUniformMatrix3x4dv;
+		glad_glUniformMatrix3x4dv = glad_profile_glUniformMatrix3x4dv;
+	}
+	if(glad_glUniformMatrix4x2dv != NULL && glad_glUniformMatrix4x2dv != glad_profile_glUniformMatrix4x2dv) {
+		profile_real.UniformMatrix4x2dv = glad_glUniformMatrix4x2dv;
+		glad_glUniformMatrix4x2dv = glad_profile_glUniformMatrix4x2dv;
+	}
+	if(glad_glUniformMatrix4x3dv != NULL && glad_glUniformMatrix4x3dv != glad_profile_glUniformMatrix4x3dv) {
+		profile_real.UniformMatrix4x3dv = glad_glUniformMatrix4x3dv;
+		glad_glUniformMatrix4x3dv = glad_profile_glUniformMatrix4x3dv;
+	}
+	if(glad_glGetUniformdv != NULL && glad_glGetUniformdv != glad_profile_glGetUniformdv) {
+		profile_real.GetUniformdv = glad_glGetUniformdv;
+		glad_glGetUniformdv = glad_profile_glGetUniformdv;
+	}
+	if(glad_glGetSubroutineUniformLocation != NULL && glad_glGetSubroutineUniformLocation != glad_profile_glGetSubroutineUniformLocation) {
+		profile_real.GetSubroutineUniformLocation = glad_glGetSubroutineUniformLocation;
+		glad_glGetSubroutineUniformLocation = glad_profile_glGetSubroutineUniformLocation;
+	}
+	if(glad_glGetSubroutineIndex != NULL && glad_glGetSubroutineIndex != glad_profile_glGetSubroutineIndex) {
+		profile_real.GetSubroutineIndex = glad_glGetSubroutineIndex;
+		glad_glGetSubroutineIndex = glad_profile_glGetSubroutineIndex;
+	}
+	if(glad_glGetActiveSubroutineUniformiv != NULL && glad_glGetActiveSubroutineUniformiv != glad_profile_glGetActiveSubroutineUniformiv) {
+		profile_real.GetActiveSubroutineUniformiv = glad_glGetActiveSubroutineUniformiv;
+		glad_glGetActiveSubroutineUniformiv = glad_profile_glGetActiveSubroutineUniformiv;
+	}
+	if(glad_glGetActiveSubroutineUniformName != NULL && glad_glGetActiveSubroutineUniformName != glad_profile_glGetActiveSubroutineUniformName) {
+		profile_real.GetActiveSubroutineUniformName = glad_glGetActiveSubroutineUniformName;
+		glad_glGetActiveSubroutineUniformName = glad_profile_glGetActiveSubroutineUniformName;
+	}
+	if(glad_glGetActiveSubroutineName != NULL && glad_glGetActiveSubroutineName != glad_profile_glGetActiveSubroutineName) {
+		profile_real.GetActiveSubroutineName = glad_glGetActiveSubroutineName;
+		glad_glGetActiveSubroutineName = glad_profile_glGetActiveSubroutineName;
+	}
+	if(glad_glUniformSubroutinesuiv != NULL && glad_glUniformSubroutinesuiv != glad_profile_glUniformSubroutinesuiv) {
+		profile_real.UniformSubroutinesuiv = glad_glUniformSubroutinesuiv;
+		glad_glUniformSubroutinesuiv = glad_profile_glUniformSubroutinesuiv;
+	}
+	if(glad_glGetUniformSubroutineuiv != NULL && glad_glGetUniformSubroutineuiv != glad_profile_glGetUniformSubroutineuiv) {
+		profile_real.GetUniformSubroutineuiv = glad_glGetUniformSubroutineuiv;
+		glad_glGetUniformSubroutineuiv = glad_profile_glGetUniformSubroutineuiv;
+	}
+	if(glad_glGetProgramStageiv != NULL && glad_glGetProgramStageiv != glad_profile_glGetProgramStageiv) {
+		profile_real.GetProgramStageiv = glad_glGetProgramStageiv;
+		glad_glGetProgramStageiv = glad_profile_glGetProgramStageiv;
+	}
+	if(glad_glPatchParameteri != NULL && glad_glPatchParameteri != glad_profile_glPatchParameteri) {
+		profile_real.PatchParameteri = glad_glPatchParameteri;
+		glad_glPatchParameteri = glad_profile_glPatchParameteri;
+	}
+	if(glad_glPatchParameterfv != NULL && glad_glPatchParameterfv != glad_profile_glPatchParameterfv) {
+		profile_real.PatchParameterfv = glad_glPatchParameterfv;
+		glad_glPatchParameterfv = glad_profile_glPatchParameterfv;
+	}
+	if(glad_glBindTransformFeedback != NULL && glad_glBindTransformFeedback != glad_profile_glBindTransformFeedback) {
+		profile_real.BindTransformFeedback = glad_glBindTransformFeedback;
+		glad_glBindTransformFeedback = glad_profile_glBindTransformFeedback;
+	}
+	if(glad_glDeleteTransformFeedbacks != NULL && glad_glDeleteTransformFeedbacks != glad_profile_glDeleteTransformFeedbacks) {
+		profile_real.DeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks;
+		glad_glDeleteTransformFeedbacks = glad_profile_glDeleteTransformFeedbacks;
+	}
+	if(glad_glGenTransformFeedbacks != NULL && glad_glGenTransformFeedbacks != glad_profile_glGenTransformFeedbacks) {
+		profile_real.GenTransformFeedbacks = glad_glGenTransformFeedbacks;
+		glad_glGenTransformFeedbacks = glad_profile_glGenTransformFeedbacks;
+	}
+	if(glad_glIsTransformFeedback != NULL && glad_glIsTransformFeedback != glad_profile_glIsTransformFeedback) {
+		profile_real.IsTransformFeedback = glad_glIsTransformFeedback;
+		glad_glIsTransformFeedback = glad_profile_glIsTransformFeedback;
+	}
+	if(glad_glPauseTransformFeedback != NULL && glad_glPauseTransformFeedback != glad_profile_glPauseTransformFeedback) {
+		profile_real.PauseTransformFeedback = glad_glPauseTransformFeedback;
+		glad_glPauseTransformFeedback = glad_profile_glPauseTransformFeedback;
+	}
+	if(glad_glResumeTransformFeedback != NULL && glad_glResumeTransformFeedback != glad_profile_glResumeTransformFeedback) {
+		profile_real.ResumeTransformFeedback = glad_glResumeTransformFeedback;
+		glad_glResumeTransformFeedback = glad_profile_glResumeTransformFeedback;
+	}
+	if(glad_glDrawTransformFeedback != NULL && glad_glDrawTransformFeedback != glad_profile_glDrawTransformFeedback) {
+		profile_real.DrawTransformFeedback = glad_glDrawTransformFeedback;
+		glad_glDrawTransformFeedback = glad_profile_glDrawTransformFeedback;
+	}
+	if(glad_glDrawTransformFeedbackStream != NULL && glad_glDrawTransformFeedbackStream != glad_profile_glDrawTransformFeedbackStream) {
+		profile_real.DrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream;
+		glad_glDrawTransformFeedbackStream = glad_profile_glDrawTransformFeedbackStream;
+	}
+	if(glad_glBeginQueryIndexed != NULL && glad_glBeginQueryIndexed != glad_profile_glBeginQueryIndexed) {
+		profile_real.BeginQueryIndexed = glad_glBeginQueryIndexed;
+		glad_glBeginQueryIndexed = glad_profile_glBeginQueryIndexed;
+	}
+	if(glad_glEndQueryIndexed != NULL && glad_glEndQueryIndexed != glad_profile_glEndQueryIndexed) {
+		profile_real.EndQueryIndexed = glad_glEndQueryIndexed;
+		glad_glEndQueryIndexed = glad_profile_glEndQueryIndexed;
+	}
+	if(glad_glGetQueryIndexediv != NULL && glad_glGetQueryIndexediv != glad_profile_glGetQueryIndexediv) {
+		profile_real.GetQueryIndexediv = glad_glGetQueryIndexediv;
+		glad_glGetQueryIndexediv = glad_profile_glGetQueryIndexediv;
+	}
+	if(glad_glReleaseShaderCompiler != NULL && glad_glReleaseShaderCompiler != glad_profile_glReleaseShaderCompiler) {
+		profile_real.ReleaseShaderCompiler = glad_glReleaseShaderCompiler;
+		glad_glReleaseShaderCompiler = glad_profile_glReleaseShaderCompiler;
+	}
+	if(glad_glShaderBinary != NULL && glad_glShaderBinary != glad_profile_glShaderBinary) {
+		profile_real.ShaderBinary = glad_glShaderBinary;
+		glad_glShaderBinary = glad_profile_glShaderBinary;
+	}
+	if(glad_glGetShaderPrecisionFormat != NULL && glad_glGetShaderPrecisionFormat != glad_profile_glGetShaderPrecisionFormat) {
+		profile_real.GetShaderPrecisionFormat = glad_glGetShaderPrecisionFormat;
+		glad_glGetShaderPrecisionFormat = glad_profile_glGetShaderPrecisionFormat;
+	}
+	if(glad_glDepthRangef != NULL && glad_glDepthRangef != glad_profile_glDepthRangef) {
+		profile_real.DepthRangef = glad_glDepthRangef;
+		glad_glDepthRangef = glad_profile_glDepthRangef;
+	}
+	if(glad_glClearDepthf != NULL && glad_glClearDepthf != glad_profile_glClearDepthf) {
+		profile_real.ClearDepthf = glad_glClearDepthf;
+		glad_glClearDepthf = glad_profile_glClearDepthf;
+	}
+	if(glad_glGetProgramBinary != NULL && glad_glGetProgramBinary != glad_profile_glGetProgramBinary) {
+		profile_real.GetProgramBinary = glad_glGetProgramBinary;
+		glad_glGetProgramBinary = glad_profile_glGetProgramBinary;
+	}
+	if(glad_glProgramBinary != NULL && glad_glProgramBinary != glad_profile_glProgramBinary) {
+		profile_real.ProgramBinary = glad_glProgramBinary;
+		glad_glProgramBinary = glad_profile_glProgramBinary;
+	}
+	if(glad_glProgramParameteri != NULL && glad_glProgramParameteri != glad_profile_glProgramParameteri) {
+		profile_real.ProgramParameteri = glad_glProgramParameteri;
+		glad_glProgramParameteri = glad_profile_glProgramParameteri;
+	}
+	if(glad_glUseProgramStages != NULL && glad_glUseProgramStages != glad_profile_glUseProgramStages) {
+		profile_real.UseProgramStages = glad_glUseProgramStages;
+		glad_glUseProgramStages = glad_profile_glUseProgramStages;
+	}
+	if(glad_glActiveShaderProgram != NULL && glad_glActiveShaderProgram != glad_profile_glActiveShaderProgram) {
+		profile_real.ActiveShaderProgram = glad_glActiveShaderProgram;
+		glad_glActiveShaderProgram = glad_profile_glActiveShaderProgram;
+	}
+	if(glad_glCreateShaderProgramv != NULL && glad_glCreateShaderProgramv != glad_profile_glCreateShaderProgramv) {
+		profile_real.CreateShaderProgramv = glad_glCreateShaderProgramv;
+		glad_glCreateShaderProgramv = glad_profile_glCreateShaderProgramv;
+	}
+	if(glad_glBindProgramPipeline != NULL && glad_glBindProgramPipeline != glad_profile_glBindProgramPipeline) {
+		profile_real.BindProgramPipeline = glad_glBindProgramPipeline;
+		glad_glBindProgramPipeline = glad_profile_glBindProgramPipeline;
+	}
+	if(glad_glDeleteProgramPipelines != NULL && glad_glDeleteProgramPipelines != glad_profile_glDeleteProgramPipelines) {
+		profile_real.DeleteProgramPipelines = glad_glDeleteProgramPipelines;
+		glad_glDeleteProgramPipelines = glad_profile_glDeleteProgramPipelines;
+	}
+	if(glad_glGenProgramPipelines != NULL && glad_glGenProgramPipelines != glad_profile_glGenProgramPipelines) {
+		profile_real.GenProgramPipelines = glad_glGenProgramPipelines;
+		glad_glGenProgramPipelines = glad_profile_glGenProgramPipelines;
+	}
+	if(glad_glIsProgramPipeline != NULL && glad_glIsProgramPipeline != glad_profile_glIsProgramPipeline) {
+		profile_real.IsProgramPipeline = glad_glIsProgramPipeline;
+		glad_glIsProgramPipeline = glad_profile_glIsProgramPipeline;
+	}
+	if(glad_glGetProgramPipelineiv != NULL && glad_glGetProgramPipelineiv != glad_profile_glGetProgramPipelineiv) {
+		profile_real.GetProgramPipelineiv = glad_glGetProgramPipelineiv;
+		glad_glGetProgramPipelineiv = glad_profile_glGetProgramPipelineiv;
+	}
+	if(glad_glProgramUniform1i != NULL && glad_glProgramUniform1i != glad_profile_glProgramUniform1i) {
+		profile_real.ProgramUniform1i = glad_glProgramUniform1i;
+		glad_glProgramUniform1i = glad_profile_glProgramUniform1i;
+	}
+	if(glad_glProgramUniform1iv != NULL && glad_glProgramUniform1iv != glad_profile_glProgramUniform1iv) {
+		profile_real.ProgramUniform1iv = glad_glProgramUniform1iv;
+		glad_glProgramUniform1iv = glad_profile_glProgramUniform1iv;
+	}
+	if(glad_glProgramUniform1f != NULL && glad_glProgramUniform1f != glad_profile_glProgramUniform1f) {
+		profile_real.ProgramUniform1f = glad_glProgramUniform1f;
+		glad_glProgramUniform1f = glad_profile_glProgramUniform1f;
+	}
+	if(glad_glProgramUniform1fv != NULL && glad_glProgramUniform1fv != glad_profile_glProgramUniform1fv) {
+		profile_real.ProgramUniform1fv = glad_glProgramUniform1fv;
+		glad_glProgramUniform1fv = glad_profile_glProgramUniform1fv;
+	}
+	if(glad_glProgramUniform1d != NULL && glad_glProgramUniform1d != glad_profile_glProgramUniform1d) {
+		profile_real.ProgramUniform1d = glad_glProgramUniform1d;
+		glad_glProgramUniform1d = glad_profile_glProgramUniform1d;
+	}
+	if(glad_glProgramUniform1dv != NULL && glad_glProgramUniform1dv != glad_profile_glProgramUniform1dv) {
+		profile_real.ProgramUniform1dv = glad_glProgramUniform1dv;
+		glad_glProgramUniform1dv = glad_profile_glProgramUniform1dv;
+	}
+	if(glad_glProgramUniform1ui != NULL && glad_glProgramUniform1ui != glad_profile_glProgramUniform1ui) {
+		profile_real.ProgramUniform1ui = glad_glProgramUniform1ui;
+		glad_glProgramUniform1ui = glad_profile_glProgramUniform1ui;
+	}
+	if(glad_glProgramUniform1uiv != NULL && glad_glProgramUniform1uiv != glad_profile_glProgramUniform1uiv) {
+		profile_real.ProgramUniform1uiv = glad_glProgramUniform1uiv;
+		glad_glProgramUniform1uiv = glad_profile_glProgramUniform1uiv;
+	}
+	if(glad_glProgramUniform2i != NULL && glad_glProgramUniform2i != glad_profile_glProgramUniform2i) {
+		profile_real.ProgramUniform2i = glad_glProgramUniform2i;
+		glad_glProgramUniform2i = glad_profile_glProgramUniform2i;
+	}
+	if(glad_glProgramUniform2iv != NULL && glad_glProgramUniform2iv != glad_profile_glProgramUniform2iv) {
+		profile_real.ProgramUniform2iv = glad_glProgramUniform2iv;
+		glad_glProgramUniform2iv = glad_profile_glProgramUniform2iv;
+	}
+	if(glad_glProgramUniform2f != NULL && glad_glProgramUniform2f != glad_profile_glProgramUniform2f) {
+		profile_real.ProgramUniform2f = glad_glProgramUniform2f;
+		glad_glProgramUniform2f = glad_profile_glProgramUniform2f;
+	}
+	if(glad_glProgramUniform2fv != NULL && glad_glProgramUniform2fv != glad_profile_glProgramUniform2fv) {
+		profile_real.ProgramUniform2fv = glad_glProgramUniform2fv;
+		glad_glProgramUniform2fv = glad_profile_glProgramUniform2fv;
+	}
+	if(glad_glProgramUniform2d != NULL && glad_glProgramUniform2d != glad_profile_glProgramUniform2d) {
+		profile_real.ProgramUniform2d = glad_glProgramUniform2d;
+		glad_glProgramUniform2d = glad_profile_glProgramUniform2d;
+	}
+	if(glad_glProgramUniform2dv != NULL && glad_glProgramUniform2dv != glad_profile_glProgramUniform2dv) {
+		profile_real.ProgramUniform2dv = glad_glProgramUniform2dv;
+		glad_glProgramUniform2dv = glad_profile_glProgramUniform2dv;
+	}
+	if(glad_glProgramUniform2ui != NULL && glad_glProgramUniform2ui != glad_profile_glProgramUniform2ui) {
+		profile_real.ProgramUniform2ui = glad_glProgramUniform2ui;
+		glad_glProgramUniform2ui = glad_profile_glProgramUniform2ui;
+	}
+	if(glad_glProgramUniform2uiv != NULL && glad_glProgramUniform2uiv != glad_profile_glProgramUniform2uiv) {
+		profile_real.ProgramUniform2uiv = glad_glProgramUniform2uiv;
+		glad_glProgramUniform2uiv = glad_profile_glProgramUniform2uiv;
+	}
+	if(glad_glProgramUniform3i != NULL && glad_glProgramUniform3i != glad_profile_glProgramUniform3i) {
+		profile_real.ProgramUniform3i = glad_glProgramUniform3i;
+		glad_glProgramUniform3i = glad_profile_glProgramUniform3i;
+	}
+	if(glad_glProgramUniform3iv != NULL && glad_glProgramUniform3iv != glad_profile_glProgramUniform3iv) {
+		profile_real.ProgramUniform3iv = glad_glProgramUniform3iv;
+		glad_glProgramUniform3iv = glad_profile_glProgramUniform3iv;
+	}
+	if(glad_glProgramUniform3f != NULL && glad_glProgramUniform3f != glad_profile_glProgramUniform3f) {
+		profile_real.ProgramUniform3f = glad_glProgramUniform3f;
+		glad_glProgramUniform3f = glad_profile_glProgramUniform3f;
+	}
+	if(glad_glProgramUniform3fv != NULL && glad_glProgramUniform3fv != glad_profile_glProgramUniform3fv) {
+		profile_real.ProgramUniform3fv = glad_glProgramUniform3fv;
+		glad_glProgramUniform3fv = glad_profile_glProgramUniform3fv;
+	}
+	if(glad_glProgramUniform3d != NULL && glad_glProgramUniform3d != glad_profile_glProgramUniform3d) {
+		profile_real.ProgramUniform3d = glad_glProgramUniform3d;
+		glad_glProgramUniform3d = glad_profile_glProgramUniform3d;
+	}
+	if(glad_glProgramUniform3dv != NULL && glad_glProgramUniform3dv != glad_profile_glProgramUniform3dv) {
+		profile_real.ProgramUniform3dv = glad_glProgramUniform3dv;
+		glad_glProgramUniform3dv = glad_profile_glProgramUniform3dv;
+	}
+	if(glad_glProgramUniform3ui != NULL && glad_glProgramUniform3ui != glad_profile_glProgramUniform3ui) {
+		profile_real.ProgramUniform3ui = glad_glProgramUniform3ui;
+		glad_glProgramUniform3ui = glad_profile_glProgramUniform3ui;
+	}
+	if(glad_glProgramUniform3uiv != NULL && glad_glProgramUniform3uiv != glad_profile_glProgramUniform3uiv) {
+		profile_real.ProgramUniform3uiv = glad_glProgramUniform3uiv;
+		glad_glProgramUniform3uiv = glad_profile_glProgramUniform3uiv;
+	}
+	if(glad_glProgramUniform4i != NULL && glad_glProgramUniform4i != glad_profile_glProgramUniform4i) {
+		profile_real.ProgramUniform4i = glad_glProgramUniform4i;
+		glad_glProgramUniform4i = glad_profile_glProgramUniform4i;
+	}
+	if(glad_glProgramUniform4iv != NULL && glad_glProgramUniform4iv != glad_profile_glProgramUniform4iv) {
+		profile_real.ProgramUniform4iv = glad_glProgramUniform4iv;
+		glad_glProgramUniform4iv = glad_profile_glProgramUniform4iv;
+	}
+	if(glad_glProgramUniform4f != NULL && glad_glProgramUniform4f != glad_profile_glProgramUniform4f) {
+		profile_real.ProgramUniform4f = glad_glProgramUniform4f;
+		glad_glProgramUniform4f = glad_profile_glProgramUniform4f;
+	}
+	if(glad_glProgramUniform4fv != NULL && glad_glProgramUniform4fv != glad_profile_glProgramUniform4fv) {
+		profile_real.ProgramUniform4fv = glad_glProgramUniform4fv;
+		glad_glProgramUniform4fv = glad_profile_glProgramUniform4fv;
+	}
+	if(glad_glProgramUniform4d != NULL && glad_glProgramUniform4d != glad_profile_glProgramUniform4d) {
+		profile_real.ProgramUniform4d = glad_glProgramUniform4d;
+		glad_glProgramUniform4d = glad_profile_glProgramUniform4d;
+	}
+	if(glad_glProgramUniform4dv != NULL && glad_glProgramUniform4dv != glad_profile_glProgramUniform4dv) {
+		profile_real.ProgramUniform4dv = glad_glProgramUniform4dv;
+		glad_glProgramUniform4dv = glad_profile_glProgramUniform4dv;
+	}
+	if(glad_glProgramUniform4ui != NULL && glad_glProgramUniform4ui != glad_profile_glProgramUniform4ui) {
+		profile_real.ProgramUniform4ui = glad_glProgramUniform4ui;
+		glad_glProgramUniform4ui = glad_profile_glProgramUniform4ui;
+	}
+	if(glad_glProgramUniform4uiv != NULL && glad_glProgramUniform4uiv != glad_profile_glProgramUniform4uiv) {
+		profile_real.ProgramUniform4uiv = glad_glProgramUniform4uiv;
+		glad_glProgramUniform4uiv = glad_profile_glProgramUniform4uiv;
+	}
+	if(glad_glProgramUniformMatrix2fv != NULL && glad_glProgramUniformMatrix2fv != glad_profile_glProgramUniformMatrix2fv) {
+		profile_real.ProgramUniformMatrix2fv = glad_glProgramUniformMatrix2fv;
+		glad_glProgramUniformMatrix2fv = glad_profile_glProgramUniformMatrix2fv;
+	}
+	if(glad_glProgramUniformMatrix3fv != NULL && glad_glProgramUniformMatrix3fv != glad_profile_glProgramUniformMatrix3fv) {
+		profile_real.ProgramUniformMatrix3fv = glad_glProgramUniformMatrix3fv;
+		glad_glProgramUniformMatrix3fv = glad_profile_glProgramUniformMatrix3fv;
+	}
+	if(glad_glProgramUniformMatrix4fv != NULL && glad_glProgramUniformMatrix4fv != glad_profile_glProgramUniformMatrix4fv) {
+		profile_real.ProgramUniformMatrix4fv = glad_glProgramUniformMatrix4fv;
+		glad_glProgramUniformMatrix4fv = glad_profile_glProgramUniformMatrix4fv;
+	}
+	if(glad_glProgramUniformMatrix2dv != NULL && glad_glProgramUniformMatrix2dv != glad_profile_glProgramUniformMatrix2dv) {
+		profile_real.ProgramUniformMatrix2dv = glad_glProgramUniformMatrix2dv;
+		glad_glProgramUniformMatrix2dv = glad_profile_glProgramUniformMatrix2dv;
+	}
+	if(glad_glProgramUniformMatrix3dv != NULL && glad_glProgramUniformMatrix3dv != glad_profile_glProgramUniformMatrix3dv) {
+		profile_real.ProgramUniformMatrix3dv = glad_glProgramUniformMatrix3dv;
+		glad_glProgramUniformMatrix3dv = glad_profile_glProgramUniformMatrix3dv;
+	}
+	if(glad_glProgramUniformMatrix4dv != NULL && glad_glProgramUniformMatrix4dv != glad_profile_glProgramUniformMatrix4dv) {
+		profile_real.ProgramUniformMatrix4dv = glad_glProgramUniformMatrix4dv;
+		glad_glProgramUniformMatrix4dv = glad_profile_glProgramUniformMatrix4dv;
+	}
+	if(glad_glProgramUniformMatrix2x3fv != NULL && glad_glProgramUniformMatrix2x3fv != glad_profile_glProgramUniformMatrix2x3fv) {
+		profile_real.ProgramUniformMatrix2x3fv = glad_glProgramUniformMatrix2x3fv;
+		glad_glProgramUniformMatrix2x3fv = glad_profile_glProgramUniformMatrix2x3fv;
+	}
+	if(glad_glProgramUniformMatrix3x2fv != NULL && glad_glProgramUniformMatrix3x2fv != glad_profile_glProgramUniformMatrix3x2fv) {
+		profile_real.ProgramUniformMatrix3x2fv = glad_glProgramUniformMatrix3x2fv;
+		glad_glProgramUniformMatrix3x2fv = glad_profile_glProgramUniformMatrix3x2fv;
+	}
+	if(glad_glProgramUniformMatrix2x4fv != NULL && glad_glProgramUniformMatrix2x4fv != glad_profile_glProgramUniformMatrix2x4fv) {
+		profile_real.ProgramUniformMatrix2x4fv = glad_glProgramUniformMatrix2x4fv;
+		glad_glProgramUniformMatrix2x4fv = glad_profile_glProgramUniformMatrix2x4fv;
+	}
+	if(glad_glProgramUniformMatrix4x2fv != NULL && glad_glProgramUniformMatrix4x2fv != glad_profile_glProgramUniformMatrix4x2fv) {
+		profile_real.ProgramUniformMatrix4x2fv = glad_glProgramUniformMatrix4x2fv;
+		glad_glProgramUniformMatrix4x2fv = glad_profile_glProgramUniformMatrix4x2fv;
+	}
+	if(glad_glProgramUniformMatrix3x4fv != NULL && glad_glProgramUniformMatrix3x4fv != glad_profile_glProgramUniformMatrix3x4fv) {
+		profile_real.ProgramUniformMatrix3x4fv = glad_glProgramUniformMatrix3x4fv;
+		glad_glProgramUniformMatrix3x4fv = glad_profile_glProgramUniformMatrix3x4fv;
+	}
+	if(glad_glProgramUniformMatrix4x3fv != NULL && glad_glProgramUniformMatrix4x3fv != glad_profile_glProgramUniformMatrix4x3fv) {
+		profile_real.ProgramUniformMatrix4x3fv = glad_glProgramUniformMatrix4x3fv;
+		glad_glProgramUniformMatrix4x3fv = glad_profile_glProgramUniformMatrix4x3fv;
+	}
+	if(glad_glProgramUniformMatrix2x3dv != NULL && glad_glProgramUniformMatrix2x3dv != glad_profile_glProgramUniformMatrix2x3dv) {
+		profile_real.ProgramUniformMatrix2x3dv = glad_glProgramUniformMatrix2x3dv;
+		glad_glProgramUniformMatrix2x3dv = glad_profile_glProgramUniformMatrix2x3dv;
+	}
+	if(glad_glProgramUniformMatrix3x2dv != NULL && glad_glProgramUniformMatrix3x2dv != glad_profile_glProgramUniformMatrix3x2dv) {
+		profile_real.ProgramUniformMatrix3x2dv = glad_glProgramUniformMatrix3x2dv;
+		glad_glProgramUniformMatrix3x2dv = glad_profile_glProgramUniformMatrix3x2dv;
+	}
+	if(glad_glProgramUniformMatrix2x4dv != NULL && glad_glProgramUniformMatrix2x4dv != glad_profile_glProgramUniformMatrix2x4dv) {
+		profile_real.ProgramUniformMatrix2x4dv = glad_glProgramUniformMatrix2x4dv;
+		glad_glProgramUniformMatrix2x4dv = glad_profile_glProgramUniformMatrix2x4dv;
+	}
+	if(glad_glProgramUniformMatrix4x2dv != NULL && glad_glProgramUniformMatrix4x2dv != glad_profile_glProgramUniformMatrix4x2dv) {
+		profile_real.ProgramUniformMatrix4x2dv = glad_glProgramUniformMatrix4x2dv;
+		glad_glProgramUniformMatrix4x2dv = glad_profile_glProgramUniformMatrix4x2dv;
+	}
+	if(glad_glProgramUniformMatrix3x4dv != NULL && glad_glProgramUniformMatrix3x4dv != glad_profile_glProgramUniformMatrix3x4dv) {
+		profile_real.ProgramUniformMatrix3x4dv = glad_glProgramUniformMatrix3x4dv;
+		glad_glProgramUniformMatrix3x4dv = glad_profile_glProgramUniformMatrix3x4dv;
+	}
+	if(glad_glProgramUniformMatrix4x3dv != NULL && glad_glProgramUniformMatrix4x3dv != glad_profile_glProgramUniformMatrix4x3dv) {
+		profile_real.ProgramUniformMatrix4x3dv = glad_glProgramUniformMatrix4x3dv;
+		glad_glProgramUniformMatrix4x3dv = glad_profile_glProgramUniformMatrix4x3dv;
+	}
+	if(glad_glValidateProgramPipeline != NULL && glad_glValidateProgramPipeline != glad_profile_glValidateProgramPipeline) {
+		profile_real.ValidateProgramPipeline = glad_glValidateProgramPipeline;
+		glad_glValidateProgramPipeline = glad_profile_glValidateProgramPipeline;
+	}
+	if(glad_glGetProgramPipelineInfoLog != NULL && glad_glGetProgramPipelineInfoLog != glad_profile_glGetProgramPipelineInfoLog) {
+		profile_real.GetProgramPipelineInfoLog = glad_glGetProgramPipelineInfoLog;
+		glad_glGetProgramPipelineInfoLog = glad_profile_glGetProgramPipelineInfoLog;
+	}
+	if(glad_glVertexAttribL1d != NULL && glad_glVertexAttribL1d != glad_profile_glVertexAttribL1d) {
+		profile_real.VertexAttribL1d = glad_glVertexAttribL1d;
+		glad_glVertexAttribL1d = glad_profile_glVertexAttribL1d;
+	}
+	if(glad_glVertexAttribL2d != NULL && glad_glVertexAttribL2d != glad_profile_glVertexAttribL2d) {
+		profile_real.VertexAttribL2d = glad_glVertexAttribL2d;
+		glad_glVertexAttribL2d = glad_profile_glVertexAttribL2d;
+	}
+	if(glad_glVertexAttribL3d != NULL && glad_glVertexAttribL3d != glad_profile_glVertexAttribL3d) {
+		profile_real.VertexAttribL3d = glad_glVertexAttribL3d;
+		glad_glVertexAttribL3d = glad_profile_glVertexAttribL3d;
+	}
+	if(glad_glVertexAttribL4d != NULL && glad_glVertexAttribL4d != glad_profile_glVertexAttribL4d) {
+		profile_real.VertexAttribL4d = glad_glVertexAttribL4d;
+		glad_glVertexAttribL4d = glad_profile_glVertexAttribL4d;
+	}
+	if(glad_glVertexAttribL1dv != NULL && glad_glVertexAttribL1dv != glad_profile_glVertexAttribL1dv) {
+		profile_real.VertexAttribL1dv = glad_glVertexAttribL1dv;
+		glad_glVertexAttribL1dv = glad_profile_glVertexAttribL1dv;
+	}
+	if(glad_glVertexAttribL2dv != NULL && glad_glVertexAttribL2dv != glad_profile_glVertexAttribL2dv) {
+		profile_real.VertexAttribL2dv = glad_glVertexAttribL2dv;
+		glad_glVertexAttribL2dv = glad_profile_glVertexAttribL2dv;
+	}
+	if(glad_glVertexAttribL3dv != NULL && glad_glVertexAttribL3dv != glad_profile_glVertexAttribL3dv) {
+		profile_real.VertexAttribL3dv = glad_glVertexAttribL3dv;
+		glad_glVertexAttribL3dv = glad_profile_glVertexAttribL3dv;
+	}
+	if(glad_glVertexAttribL4dv != NULL && glad_glVertexAttribL4dv != glad_profile_glVertexAttribL4dv) {
+		profile_real.VertexAttribL4dv = glad_glVertexAttribL4dv;
+		glad_glVertexAttribL4dv = glad_profile_glVertexAttribL4dv;
+	}
+	if(glad_glVertexAttribLPointer != NULL && glad_glVertexAttribLPointer != glad_profile_glVertexAttribLPointer) {
+		profile_real.VertexAttribLPointer = glad_glVertexAttribLPointer;
+		glad_glVertexAttribLPointer = glad_profile_glVertexAttribLPointer;
+	}
+	if(glad_glGetVertexAttribLdv != NULL && glad_glGetVertexAttribLdv != glad_profile_glGetVertexAttribLdv) {
+		profile_real.GetVertexAttribLdv = glad_glGetVertexAttribLdv;
+		glad_glGetVertexAttribLdv = glad_profile_glGetVertexAttribLdv;
+	}
+	if(glad_glViewportArrayv != NULL && glad_glViewportArrayv != glad_profile_glViewportArrayv) {
+		profile_real.ViewportArrayv = glad_glViewportArrayv;
+		glad_glViewportArrayv = glad_profile_glViewportArrayv;
+	}
+	if(glad_glViewportIndexedf != NULL && glad_glViewportIndexedf != glad_profile_glViewportIndexedf) {
+		profile_real.ViewportIndexedf = glad_glViewportIndexedf;
+		glad_glViewportIndexedf = glad_profile_glViewportIndexedf;
+	}
+	if(glad_glViewportIndexedfv != NULL && glad_glViewportIndexedfv != glad_profile_glViewportIndexedfv) {
+		profile_real.ViewportIndexedfv = glad_glViewportIndexedfv;
+		glad_glViewportIndexedfv = glad_profile_glViewportIndexedfv;
+	}
+	if(glad_glScissorArrayv != NULL && glad_glScissorArrayv != glad_profile_glScissorArrayv) {
+		profile_real.ScissorArrayv = glad_glScissorArrayv;
+		glad_glScissorArrayv = glad_profile_glScissorArrayv;
+	}
+	if(glad_glScissorIndexed != NULL && glad_glScissorIndexed != glad_profile_glScissorIndexed) {
+		profile_real.ScissorIndexed = glad_glScissorIndexed;
+		glad_glScissorIndexed = glad_profile_glScissorIndexed;
+	}
+	if(glad_glScissorIndexedv != NULL && glad_glScissorIndexedv != glad_profile_glScissorIndexedv) {
+		profile_real.ScissorIndexedv = glad_glScissorIndexedv;
+		glad_glScissorIndexedv = glad_profile_glScissorIndexedv;
+	}
+	if(glad_glDepthRangeArrayv != NULL && glad_glDepthRangeArrayv != glad_profile_glDepthRangeArrayv) {
+		profile_real.DepthRangeArrayv = glad_glDepthRangeArrayv;
+		glad_glDepthRangeArrayv = glad_profile_glDepthRangeArrayv;
+	}
+	if(glad_glDepthRangeIndexed != NULL && glad_glDepthRangeIndexed != glad_profile_glDepthRangeIndexed) {
+		profile_real.DepthRangeIndexed = glad_glDepthRangeIndexed;
+		glad_glDepthRangeIndexed = glad_profile_glDepthRangeIndexed;
+	}
+	if(glad_glGetFloati_v != NULL && glad_glGetFloati_v != glad_profile_glGetFloati_v) {
+		profile_real.GetFloati_v = glad_glGetFloati_v;
+		glad_glGetFloati_v = glad_profile_glGetFloati_v;
+	}
+	if(glad_glGetDoublei_v != NULL && glad_glGetDoublei_v != glad_profile_glGetDoublei_v) {
+		profile_real.GetDoublei_v = glad_glGetDoublei_v;
+		glad_glGetDoublei_v = glad_profile_glGetDoublei_v;
+	}
+	if(glad_glDrawArraysInstancedBaseInstance != NULL && glad_glDrawArraysInstancedBaseInstance != glad_profile_glDrawArraysInstancedBaseInstance) {
+		profile_real.DrawArraysInstancedBaseInstance = glad_glDrawArraysInstancedBaseInstance;
+		glad_glDrawArraysInstancedBaseInstance = glad_profile_glDrawArraysInstancedBaseInstance;
+	}
+	if(glad_glDrawElementsInstancedBaseInstance != NULL && glad_glDrawElementsInstancedBaseInstance != glad_profile_glDrawElementsInstancedBaseInstance) {
+		profile_real.DrawElementsInstancedBaseInstance = glad_glDrawElementsInstancedBaseInstance;
+		glad_glDrawElementsInstancedBaseInstance = glad_profile_glDrawElementsInstancedBaseInstance;
+	}
+	if(glad_glDrawElementsInstancedBaseVertexBaseInstance != NULL && glad_glDrawElementsInstancedBaseVertexBaseInstance != glad_profile_glDrawElementsInstancedBaseVertexBaseInstance) {
+		profile_real.DrawElementsInstancedBaseVertexBaseInstance = glad_glDrawElementsInstancedBaseVertexBaseInstance;
+		glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_profile_glDrawElementsInstancedBaseVertexBaseInstance;
+	}
+	if(glad_glGetInternalformativ != NULL && glad_glGetInternalformativ != glad_profile_glGetInternalformativ) {
+		profile_real.GetInternalformativ = glad_glGetInternalformativ;
+		glad_glGetInternalformativ = glad_profile_glGetInternalformativ;
+	}
+	if(glad_glGetActiveAtomicCounterBufferiv != NULL && glad_glGetActiveAtomicCounterBufferiv != glad_profile_glGetActiveAtomicCounterBufferiv) {
+		profile_real.GetActiveAtomicCounterBufferiv = glad_glGetActiveAtomicCounterBufferiv;
+		glad_glGetActiveAtomicCounterBufferiv = glad_profile_glGetActiveAtomicCounterBufferiv;
+	}
+	if(glad_glBindImageTexture != NULL && glad_glBindImageTexture != glad_profile_glBindImageTexture) {
+		profile_real.BindImageTexture = glad_glBindImageTexture;
+		glad_glBindImageTexture = glad_profile_glBindImageTexture;
+	}
+	if(glad_glMemoryBarrier != NULL && glad_glMemoryBarrier != glad_profile_glMemoryBarrier) {
+		profile_real.MemoryBarrier = glad_glMemoryBarrier;
+		glad_glMemoryBarrier = glad_profile_glMemoryBarrier;
+	}
+	if(glad_glTexStorage1D != NULL && glad_glTexStorage1D != glad_profile_glTexStorage1D) {
+		profile_real.TexStorage1D = glad_glTexStorage1D;
+		glad_glTexStorage1D = glad_profile_glTexStorage1D;
+	}
+	if(glad_glTexStorage2D != NULL && glad_glTexStorage2D != glad_profile_glTexStorage2D) {
+		profile_real.TexStorage2D = glad_glTexStorage2D;
+		glad_glTexStorage2D = glad_profile_glTexStorage2D;
+	}
+	if(glad_glTexStorage3D != NULL && glad_glTexStorage3D != glad_profile_glTexStorage3D) {
+		profile_real.TexStorage3D = glad_glTexStorage3D;
+		glad_glTexStorage3D = glad_profile_glTexStorage3D;
+	}
+	if(glad_glDrawTransformFeedbackInstanced != NULL && glad_glDrawTransformFeedbackInstanced != glad_profile_glDrawTransformFeedbackInstanced) {
+		profile_real.DrawTransformFeedbackInstanced = glad_glDrawTransformFeedbackInstanced;
+		glad_glDrawTransformFeedbackInstanced = glad_profile_glDrawTransformFeedbackInstanced;
+	}
+	if(glad_glDrawTransformFeedbackStreamInstanced != NULL && glad_glDrawTransformFeedbackStreamInstanced != glad_profile_glDrawTransformFeedbackStreamInstanced) {
+		profile_real.DrawTransformFeedbackStreamInstanced = glad_glDrawTransformFeedbackStreamInstanced;
+		glad_glDrawTransformFeedbackStreamInstanced = glad_profile_glDrawTransformFeedbackStreamInstanced;
+	}
+	if(glad_glClearBufferData != NULL && glad_glClearBufferData != glad_profile_glClearBufferData) {
+		profile_real.ClearBufferData = glad_glClearBufferData;
+		glad_glClearBufferData = glad_profile_glClearBufferData;
+	}
+	if(glad_glClearBufferSubData != NULL && glad_glClearBufferSubData != glad_profile_glClearBufferSubData) {
+		profile_real.ClearBufferSubData = glad_glClearBufferSubData;
+		glad_glClearBufferSubData = glad_profile_glClearBufferSubData;
+	}
+	if(glad_glDispatchCompute != NULL && glad_glDispatchCompute != glad_profile_glDispatchCompute) {
+		profile_real.DispatchCompute = glad_glDispatchCompute;
+		glad_glDispatchCompute = glad_profile_glDispatchCompute;
+	}
+	if(glad_glDispatchComputeIndirect != NULL && glad_glDispatchComputeIndirect != glad_profile_glDispatchComputeIndirect) {
+		profile_real.DispatchComputeIndirect = glad_glDispatchComputeIndirect;
+		glad_glDispatchComputeIndirect = glad_profile_glDispatchComputeIndirect;
+	}
+	if(glad_glCopyImageSubData != NULL && glad_glCopyImageSubData != glad_profile_glCopyImageSubData) {
+		profile_real.CopyImageSubData = glad_glCopyImageSubData;
+		glad_glCopyImageSubData = glad_profile_glCopyImageSubData;
+	}
+	if(glad_glFramebufferParameteri != NULL && glad_glFramebufferParameteri != glad_profile_glFramebufferParameteri) {
+		profile_real.FramebufferParameteri = glad_glFramebufferParameteri;
+		glad_glFramebufferParameteri = glad_profile_glFramebufferParameteri;
+	}
+	if(glad_glGetFramebufferParameteriv != NULL && glad_glGetFramebufferParameteriv != glad_profile_glGetFramebufferParameteriv) {
+		profile_real.GetFramebufferParameteriv = glad_glGetFramebufferParameteriv;
+		glad_glGetFramebufferParameteriv = glad_profile_glGetFramebufferParameteriv;
+	}
+	if(glad_glGetInternalformati64v != NULL && glad_glGetInternalformati64v != glad_profile_glGetInternalformati64v) {
+		profile_real.GetInternalformati64v = glad_glGetInternalformati64v;
+		glad_glGetInternalformati64v = glad_profile_glGetInternalformati64v;
+	}
+	if(glad_glInvalidateTexSubImage != NULL && glad_glInvalidateTexSubImage != glad_profile_glInvalidateTexSubImage) {
+		profile_real.InvalidateTexSubImage = glad_glInvalidateTexSubImage;
+		glad_glInvalidateTexSubImage = glad_profile_glInvalidateTexSubImage;
+	}
+	if(glad_glInvalidateTexImage != NULL && glad_glInvalidateTexImage != glad_profile_glInvalidateTexImage) {
+		profile_real.InvalidateTexImage = glad_glInvalidateTexImage;
+		glad_glInvalidateTexImage = glad_profile_glInvalidateTexImage;
+	}
+	if(glad_glInvalidateBufferSubData != NULL && glad_glInvalidateBufferSubData != glad_profile_glInvalidateBufferSubData) {
+		profile_real.InvalidateBufferSubData = glad_glInvalidateBufferSubData;
+		glad_glInvalidateBufferSubData = glad_profile_glInvalidateBufferSubData;
+	}
+	if(glad_glInvalidateBufferData != NULL && glad_glInvalidateBufferData != glad_profile_glInvalidateBufferData) {
+		profile_real.InvalidateBufferData = glad_glInvalidateBufferData;
+		glad_glInvalidateBufferData = glad_profile_glInvalidateBufferData;
+	}
+	if(glad_glInvalidateFramebuffer != NULL && glad_glInvalidateFramebuffer != glad_profile_glInvalidateFramebuffer) {
+		profile_real.InvalidateFramebuffer = glad_glInvalidateFramebuffer;
+		glad_glInvalidateFramebuffer = glad_profile_glInvalidateFramebuffer;
+	}
+	if(glad_glInvalidateSubFramebuffer != NULL && glad_glInvalidateSubFramebuffer != glad_profile_glInvalidateSubFramebuffer) {
+		profile_real.InvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer;
+		glad_glInvalidateSubFramebuffer = glad_profile_glInvalidateSubFramebuffer;
+	}
+	if(glad_glMultiDrawArraysIndirect != NULL && glad_glMultiDrawArraysIndirect != glad_profile_glMultiDrawArraysIndirect) {
+		profile_real.MultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect;
+		glad_glMultiDrawArraysIndirect = glad_profile_glMultiDrawArraysIndirect;
+	}
+	if(glad_glMultiDrawElementsIndirect != NULL && glad_glMultiDrawElementsIndirect != glad_profile_glMultiDrawElementsIndirect) {
+		profile_real.MultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect;
+		glad_glMultiDrawElementsIndirect = glad_profile_glMultiDrawElementsIndirect;
+	}
+	if(glad_glGetProgramInterfaceiv != NULL && glad_glGetProgramInterfaceiv != glad_profile_glGetProgramInterfaceiv) {
+		profile_real.GetProgramInterfaceiv = glad_glGetProgramInterfaceiv;
+		glad_glGetProgramInterfaceiv = glad_profile_glGetProgramInterfaceiv;
+	}
+	if(glad_glGetProgramResourceIndex != NULL && glad_glGetProgramResourceIndex != glad_profile_glGetProgramResourceIndex) {
+		profile_real.GetProgramResourceIndex = glad_glGetProgramResourceIndex;
+		glad_glGetProgramResourceIndex = glad_profile_glGetProgramResourceIndex;
+	}
+	if(glad_glGetProgramResourceName != NULL && glad_glGetProgramResourceName != glad_profile_glGetProgramResourceName) {
+		profile_real.GetProgramResourceName = glad_glGetProgramResourceName;
+		glad_glGetProgramResourceName = glad_profile_glGetProgramResourceName;
+	}
+	if(glad_glGetProgramResourceiv != NULL && glad_glGetProgramResourceiv != glad_profile_glGetProgramResourceiv) {
+		profile_real.GetProgramResourceiv = glad_glGetProgramResourceiv;
+		glad_glGetProgramResourceiv = glad_profile_glGetProgramResourceiv;
+	}
+	if(glad_glGetProgramResourceLocation != NULL && glad_glGetProgramResourceLocation != glad_profile_glGetProgramResourceLocation) {
+		profile_real.GetProgramResourceLocation = glad_glGetProgramResourceLocation;
+		glad_glGetProgramResourceLocation = glad_profile_glGetProgramResourceLocation;
+	}
+	if(glad_glGetProgramResourceLocationIndex != NULL && glad_glGetProgramResourceLocationIndex != glad_profile_glGetProgramResourceLocationIndex) {
+		profile_real.GetProgramResourceLocationIndex = glad_glGetProgramResourceLocationIndex;
+		glad_glGetProgramResourceLocationIndex = glad_profile_glGetProgramResourceLocationIndex;
+	}
+	if(glad_glShaderStorageBlockBinding != NULL && glad_glShaderStorageBlockBinding != glad_profile_glShaderStorageBlockBinding) {
+		profile_real.ShaderStorageBlockBinding = glad_glShaderStorageBlockBinding;
+		glad_glShaderStorageBlockBinding = glad_profile_glShaderStorageBlockBinding;
+	}
+	if(glad_glTexBufferRange != NULL && glad_glTexBufferRange != glad_profile_glTexBufferRange) {
+		profile_real.TexBufferRange = glad_glTexBufferRange;
+		glad_glTexBufferRange = glad_profile_glTexBufferRange;
+	}
+	if(glad_glTexStorage2DMultisample != NULL && glad_glTexStorage2DMultisample != glad_profile_glTexStorage2DMultisample) {
+		profile_real.TexStorage2DMultisample = glad_glTexStorage2DMultisample;
+		glad_glTexStorage2DMultisample = glad_profile_glTexStorage2DMultisample;
+	}
+	if(glad_glTexStorage3DMultisample != NULL && glad_glTexStorage3DMultisample != glad_profile_glTexStorage3DMultisample) {
+		profile_real.TexStorage3DMultisample = glad_glTexStorage3DMultisample;
+		glad_glTexStorage3DMultisample = glad_profile_glTexStorage3DMultisample;
+	}
+	if(glad_glTextureView != NULL && glad_glTextureView != glad_profile_glTextureView) {
+		profile_real.TextureView = glad_glTextureView;
+		glad_glTextureView = glad_profile_glTextureView;
+	}
+	if(glad_glBindVertexBuffer != NULL && glad_glBindVertexBuffer != glad_profile_glBindVertexBuffer) {
+		profile_real.BindVertexBuffer = glad_glBindVertexBuffer;
+		glad_glBindVertexBuffer = glad_profile_glBindVertexBuffer;
+	}
+	if(glad_glVertexAttribFormat != NULL && glad_glVertexAttribFormat != glad_profile_glVertexAttribFormat) {
+		profile_real.VertexAttribFormat = glad_glVertexAttribFormat;
+		glad_glVertexAttribFormat = glad_profile_glVertexAttribFormat;
+	}
+	if(glad_glVertexAttribIFormat != NULL && glad_glVertexAttribIFormat != glad_profile_glVertexAttribIFormat) {
+		profile_real.VertexAttribIFormat = glad_glVertexAttribIFormat;
+		glad_glVertexAttribIFormat = glad_profile_glVertexAttribIFormat;
+	}
+	if(glad_glVertexAttribLFormat != NULL && glad_glVertexAttribLFormat != glad_profile_glVertexAttribLFormat) {
+		profile_real.VertexAttribLFormat = glad_glVertexAttribLFormat;
+		glad_glVertexAttribLFormat = glad_profile_glVertexAttribLFormat;
+	}
+	if(glad_glVertexAttribBinding != NULL && glad_glVertexAttribBinding != glad_profile_glVertexAttribBinding) {
+		profile_real.VertexAttribBinding = glad_glVertexAttribBinding;
+		glad_glVertexAttribBinding = glad_profile_glVertexAttribBinding;
+	}
+	if(glad_glVertexBindingDivisor != NULL && glad_glVertexBindingDivisor != glad_profile_glVertexBindingDivisor) {
+		profile_real.VertexBindingDivisor = glad_glVertexBindingDivisor;
+		glad_glVertexBindingDivisor = glad_profile_glVertexBindingDivisor;
+	}
+	if(glad_glDebugMessageControl != NULL && glad_glDebugMessageControl != glad_profile_glDebugMessageControl) {
+		profile_real.DebugMessageControl = glad_glDebugMessageControl;
+		glad_glDebugMessageControl = glad_profile_glDebugMessageControl;
+	}
+	if(glad_glDebugMessageInsert != NULL && glad_glDebugMessageInsert != glad_profile_glDebugMessageInsert) {
+		profile_real.DebugMessageInsert = glad_glDebugMessageInsert;
+		glad_glDebugMessageInsert = glad_profile_glDebugMessageInsert;
+	}
+	if(glad_glDebugMessageCallback != NULL && glad_glDebugMessageCallback != glad_profile_glDebugMessageCallback) {
+		profile_real.DebugMessageCallback = glad_glDebugMessageCallback;
+		glad_glDebugMessageCallback = glad_profile_glDebugMessageCallback;
+	}
+	if(glad_glGetDebugMessageLog != NULL && glad_glGetDebugMessageLog != glad_profile_glGetDebugMessageLog) {
+		profile_real.GetDebugMessageLog = glad_glGetDebugMessageLog;
+		glad_glGetDebugMessageLog = glad_profile_glGetDebugMessageLog;
+	}
+	if(glad_glPushDebugGroup != NULL && glad_glPushDebugGroup != glad_profile_glPushDebugGroup) {
+		profile_real.PushDebugGroup = glad_glPushDebugGroup;
+		glad_glPushDebugGroup = glad_profile_glPushDebugGroup;
+	}
+	if(glad_glPopDebugGroup != NULL && glad_glPopDebugGroup != glad_profile_glPopDebugGroup) {
+		profile_real.PopDebugGroup = glad_glPopDebugGroup;
+		glad_glPopDebugGroup = glad_profile_glPopDebugGroup;
+	}
+	if(glad_glObjectLabel != NULL && glad_glObjectLabel != glad_profile_glObjectLabel) {
+		profile_real.ObjectLabel = glad_glObjectLabel;
+		glad_glObjectLabel = glad_profile_glObjectLabel;
+	}
+	if(glad_glGetObjectLabel != NULL && glad_glGetObjectLabel != glad_profile_glGetObjectLabel) {
+		profile_real.GetObjectLabel = glad_glGetObjectLabel;
+		glad_glGetObjectLabel = glad_profile_glGetObjectLabel;
+	}
+	if(glad_glObjectPtrLabel != NULL && glad_glObjectPtrLabel != glad_profile_glObjectPtrLabel) {
+		profile_real.ObjectPtrLabel = glad_glObjectPtrLabel;
+		glad_glObjectPtrLabel = glad_profile_glObjectPtrLabel;
+	}
+	if(glad_glGetObjectPtrLabel != NULL && glad_glGetObjectPtrLabel != glad_profile_glGetObjectPtrLabel) {
+		profile_real.GetObjectPtrLabel = glad_glGetObjectPtrLabel;
+		glad_glGetObjectPtrLabel = glad_profile_glGetObjectPtrLabel;
+	}
+	if(glad_glGetPointerv != NULL && glad_glGetPointerv != glad_profile_glGetPointerv) {
+		profile_real.GetPointerv = glad_glGetPointerv;
+		glad_glGetPointerv = glad_profile_glGetPointerv;
+	}
+	if(glad_glBufferStorage != NULL && glad_glBufferStorage != glad_profile_glBufferStorage) {
+		profile_real.BufferStorage = glad_glBufferStorage;
+		glad_glBufferStorage = glad_profile_glBufferStorage;
+	}
+	if(glad_glClearTexImage != NULL && glad_glClearTexImage != glad_profile_glClearTexImage) {
+		profile_real.ClearTexImage = glad_glClearTexImage;
+		glad_glClearTexImage = glad_profile_glClearTexImage;
+	}
+	if(glad_glClearTexSubImage != NULL && glad_glClearTexSubImage != glad_profile_glClearTexSubImage) {
+		profile_real.ClearTexSubImage = glad_glClearTexSubImage;
+		glad_glClearTexSubImage = glad_profile_glClearTexSubImage;
+	}
+	if(glad_glBindBuffersBase != NULL && glad_glBindBuffersBase != glad_profile_glBindBuffersBase) {
+		profile_real.BindBuffersBase = glad_glBindBuffersBase;
+		glad_glBindBuffersBase = glad_profile_glBindBuffersBase;
+	}
+	if(glad_glBindBuffersRange != NULL && glad_glBindBuffersRange != glad_profile_glBindBuffersRange) {
+		profile_real.BindBuffersRange = glad_glBindBuffersRange;
+		glad_glBindBuffersRange = glad_profile_glBindBuffersRange;
+	}
+	if(glad_glBindTextures != NULL && glad_glBindTextures != glad_profile_glBindTextures) {
+		profile_real.BindTextures = glad_glBindTextures;
+		glad_glBindTextures = glad_profile_glBindTextures;
+	}
+	if(glad_glBindSamplers != NULL && glad_glBindSamplers != glad_profile_glBindSamplers) {
+		profile_real.BindSamplers = glad_glBindSamplers;
+		glad_glBindSamplers = glad_profile_glBindSamplers;
+	}
+	if(glad_glBindImageTextures != NULL && glad_glBindImageTextures != glad_profile_glBindImageTextures) {
+		profile_real.BindImageTextures = glad_glBindImageTextures;
+		glad_glBindImageTextures = glad_profile_glBindImageTextures;
+	}
+	if(glad_glBindVertexBuffers != NULL && glad_glBindVertexBuffers != glad_profile_glBindVertexBuffers) {
+		profile_real.BindVertexBuffers = glad_glBindVertexBuffers;
+		glad_glBindVertexBuffers = glad_profile_glBindVertexBuffers;
+	}
+	if(glad_glClipControl != NULL && glad_glClipControl != glad_profile_glClipControl) {
+		profile_real.ClipControl = glad_glClipControl;
+		glad_glClipControl = glad_profile_glClipControl;
+	}
+	if(glad_glCreateTransformFeedbacks != NULL && glad_glCreateTransformFeedbacks != glad_profile_glCreateTransformFeedbacks) {
+		profile_real.CreateTransformFeedbacks = glad_glCreateTransformFeedbacks;
+		glad_glCreateTransformFeedbacks = glad_profile_glCreateTransformFeedbacks;
+	}
+	if(glad_glTransformFeedbackBufferBase != NULL && glad_glTransformFeedbackBufferBase != glad_profile_glTransformFeedbackBufferBase) {
+		profile_real.TransformFeedbackBufferBase = glad_glTransformFeedbackBufferBase;
+		glad_glTransformFeedbackBufferBase = glad_profile_glTransformFeedbackBufferBase;
+	}
+	if(glad_glTransformFeedbackBufferRange != NULL && glad_glTransformFeedbackBufferRange != glad_profile_glTransformFeedbackBufferRange) {
+		profile_real.TransformFeedbackBufferRange = glad_glTransformFeedbackBufferRange;
+		glad_glTransformFeedbackBufferRange = glad_profile_glTransformFeedbackBufferRange;
+	}
+	if(glad_glGetTransformFeedbackiv != NULL && glad_glGetTransformFeedbackiv != glad_profile_glGetTransformFeedbackiv) {
+		profile_real.GetTransformFeedbackiv = glad_glGetTransformFeedbackiv;
+		glad_glGetTransformFeedbackiv = glad_profile_glGetTransformFeedbackiv;
+	}
+	if(glad_glGetTransformFeedbacki_v != NULL && glad_glGetTransformFeedbacki_v != glad_profile_glGetTransformFeedbacki_v) {
+		profile_real.GetTransformFeedbacki_v = glad_glGetTransformFeedbacki_v;
+		glad_glGetTransformFeedbacki_v = glad_profile_glGetTransformFeedbacki_v;
+	}
+	if(glad_glGetTransformFeedbacki64_v != NULL && glad_glGetTransformFeedbacki64_v != glad_profile_glGetTransformFeedbacki64_v) {
+		profile_real.GetTransformFeedbacki64_v = glad_glGetTransformFeedbacki64_v;
+		glad_glGetTransformFeedbacki64_v = glad_profile_glGetTransformFeedbacki64_v;
+	}
+	if(glad_glCreateBuffers != NULL && glad_glCreateBuffers != glad_profile_glCreateBuffers) {
+		profile_real.CreateBuffers = glad_glCreateBuffers;
+		glad_glCreateBuffers = glad_profile_glCreateBuffers;
+	}
+	if(glad_glNamedBufferStorage != NULL && glad_glNamedBufferStorage != glad_profile_glNamedBufferStorage) {
+		profile_real.NamedBufferStorage = glad_glNamedBufferStorage;
+		glad_glNamedBufferStorage = glad_profile_glNamedBufferStorage;
+	}
+	if(glad_glNamedBufferData != NULL && glad_glNamedBufferData != glad_profile_glNamedBufferData) {
+		profile_real.NamedBufferData = glad_glNamedBufferData;
+		glad_glNamedBufferData = glad_profile_glNamedBufferData;
+	}
+	if(glad_glNamedBufferSubData != NULL && glad_glNamedBufferSubData != glad_profile_glNamedBufferSubData) {
+		profile_real.NamedBufferSubData = glad_glNamedBufferSubData;
+		glad_glNamedBufferSubData = glad_profile_glNamedBufferSubData;
+	}
+	if(glad_glCopyNamedBufferSubData != NULL && glad_glCopyNamedBufferSubData != glad_profile_glCopyNamedBufferSubData) {
+		profile_real.CopyNamedBufferSubData = glad_glCopyNamedBufferSubData;
+		glad_glCopyNamedBufferSubData = glad_profile_glCopyNamedBufferSubData;
+	}
+	if(glad_glClearNamedBufferData != NULL && glad_glClearNamedBufferData != glad_profile_glClearNamedBufferData) {
+		profile_real.ClearNamedBufferData = glad_glClearNamedBufferData;
+		glad_glClearNamedBufferData = glad_profile_glClearNamedBufferData;
+	}
+	if(glad_glClearNamedBufferSubData != NULL && glad_glClearNamedBufferSubData != glad_profile_glClearNamedBufferSubData) {
+		profile_real.ClearNamedBufferSubData = glad_glClearNamedBufferSubData;
+		glad_glClearNamedBufferSubData = glad_profile_glClearNamedBufferSubData;
+	}
+	if(glad_glMapNamedBuffer != NULL && glad_glMapNamedBuffer != glad_profile_glMapNamedBuffer) {
+		profile_real.MapNamedBuffer = glad_glMapNamedBuffer;
+		glad_glMapNamedBuffer = glad_profile_glMapNamedBuffer;
+	}
+	if(glad_glMapNamedBufferRange != NULL && glad_glMapNamedBufferRange != glad_profile_glMapNamedBufferRange) {
+		profile_real.MapNamedBufferRange = glad_glMapNamedBufferRange;
+		glad_glMapNamedBufferRange = glad_profile_glMapNamedBufferRange;
+	}
+	if(glad_glUnmapNamedBuffer != NULL && glad_glUnmapNamedBuffer != glad_profile_glUnmapNamedBuffer) {
+		profile_real.UnmapNamedBuffer = glad_glUnmapNamedBuffer;
+		glad_glUnmapNamedBuffer = glad_profile_glUnmapNamedBuffer;
+	}
+	if(glad_glFlushMappedNamedBufferRange != NULL && glad_glFlushMappedNamedBufferRange != glad_profile_glFlushMappedNamedBufferRange) {
+		profile_real.FlushMappedNamedBufferRange = glad_glFlushMappedNamedBufferRange;
+		glad_glFlushMappedNamedBufferRange = glad_profile_glFlushMappedNamedBufferRange;
+	}
+	if(glad_glGetNamedBufferParameteriv != NULL && glad_glGetNamedBufferParameteriv != glad_profile_glGetNamedBufferParameteriv) {
+		profile_real.GetNamedBufferParameteriv = glad_glGetNamedBufferParameteriv;
+		glad_glGetNamedBufferParameteriv = glad_profile_glGetNamedBufferParameteriv;
+	}
+	if(glad_glGetNamedBufferParameteri64v != NULL && glad_glGetNamedBufferParameteri64v != glad_profile_glGetNamedBufferParameteri64v) {
+		profile_real.GetNamedBufferParameteri64v = glad_glGetNamedBufferParameteri64v;
+		glad_glGetNamedBufferParameteri64v = glad_profile_glGetNamedBufferParameteri64v;
+	}
+	if(glad_glGetNamedBufferPointerv != NULL && glad_glGetNamedBufferPointerv != glad_profile_glGetNamedBufferPointerv) {
+		profile_real.GetNamedBufferPointerv = glad_glGetNamedBufferPointerv;
+		glad_glGetNamedBufferPointerv = glad_profile_glGetNamedBufferPointerv;
+	}
+	if(glad_glGetNamedBufferSubData != NULL && glad_glGetNamedBufferSubData != glad_profile_glGetNamedBufferSubData) {
+		profile_real.GetNamedBufferSubData = glad_glGetNamedBufferSubData;
+		glad_glGetNamedBufferSubData = glad_profile_glGetNamedBufferSubData;
+	}
+	if(glad_glCreateFramebuffers != NULL && glad_glCreateFramebuffers != glad_profile_glCreateFramebuffers) {
+		profile_real.CreateFramebuffers = glad_glCreateFramebuffers;
+		glad_glCreateFramebuffers = glad_profile_glCreateFramebuffers;
+	}
+	if(glad_glNamedFramebufferRenderbuffer != NULL && glad_glNamedFramebufferRenderbuffer != glad_profile_glNamedFramebufferRenderbuffer) {
+		profile_real.NamedFramebufferRenderbuffer = glad_glNamedFramebufferRenderbuffer;
+		glad_glNamedFramebufferRenderbuffer = glad_profile_glNamedFramebufferRenderbuffer;
+	}
+	if(glad_glNamedFramebufferParameteri != NULL && glad_glNamedFramebufferParameteri != glad_profile_glNamedFramebufferParameteri) {
+		profile_real.NamedFramebufferParameteri = glad_glNamedFramebufferParameteri;
+		glad_glNamedFramebufferParameteri = glad_profile_glNamedFramebufferParameteri;
+	}
+	if(glad_glNamedFramebufferTexture != NULL && glad_glNamedFramebufferTexture != glad_profile_glNamedFramebufferTexture) {
+		profile_real.NamedFramebufferTexture = glad_glNamedFramebufferTexture;
+		glad_glNamedFramebufferTexture = glad_profile_glNamedFramebufferTexture;
+	}
+	if(glad_glNamedFramebufferTextureLayer != NULL && glad_glNamedFramebufferTextureLayer != glad_profile_glNamedFramebufferTextureLayer) {
+		profile_real.NamedFramebufferTextureLayer = glad_glNamedFramebufferTextureLayer;
+		glad_glNamedFramebufferTextureLayer = glad_profile_glNamedFramebufferTextureLayer;
+	}
+	if(glad_glNamedFramebufferDrawBuffer != NULL && glad_glNamedFramebufferDrawBuffer != glad_profile_glNamedFramebufferDrawBuffer) {
+		profile_real.NamedFramebufferDrawBuffer = glad_glNamedFramebufferDrawBuffer;
+		glad_glNamedFramebufferDrawBuffer = glad_profile_glNamedFramebufferDrawBuffer;
+	}
+	if(glad_glNamedFramebufferDrawBuffers != NULL && glad_glNamedFramebufferDrawBuffers != glad_profile_glNamedFramebufferDrawBuffers) {
+		profile_real.NamedFramebufferDrawBuffers = glad_glNamedFramebufferDrawBuffers;
+		glad_glNamedFramebufferDrawBuffers = glad_profile_glNamedFramebufferDrawBuffers;
+	}
+	if(glad_glNamedFramebufferReadBuffer != NULL && glad_glNamedFramebufferReadBuffer != glad_profile_glNamedFramebufferReadBuffer) {
+		profile_real.NamedFramebufferReadBuffer = glad_glNamedFramebufferReadBuffer;
+		glad_glNamedFramebufferReadBuffer = glad_profile_glNamedFramebufferReadBuffer;
+	}
+	if(glad_glInvalidateNamedFramebufferData != NULL && glad_glInvalidateNamedFramebufferData != glad_profile_glInvalidateNamedFramebufferData) {
+		profile_real.InvalidateNamedFramebufferData = glad_glInvalidateNamedFramebufferData;
+		glad_glInvalidateNamedFramebufferData = glad_profile_glInvalidateNamedFramebufferData;
+	}
+	if(glad_glInvalidateNamedFramebufferSubData != NULL && glad_glInvalidateNamedFramebufferSubData != glad_profile_glInvalidateNamedFramebufferSubData) {
+		profile_real.InvalidateNamedFramebufferSubData = glad_glInvalidateNamedFramebufferSubData;
+		glad_glInvalidateNamedFramebufferSubData = glad_profile_glInvalidateNamedFramebufferSubData;
+	}
+	if(glad_glClearNamedFramebufferiv != NULL && glad_glClearNamedFramebufferiv != glad_profile_glClearNamedFramebufferiv) {
+		profile_real.ClearNamedFramebufferiv = glad_glClearNamedFramebufferiv;
+		glad_glClearNamedFramebufferiv = glad_profile_glClearNamedFramebufferiv;
+	}
+	if(glad_glClearNamedFramebufferuiv != NULL && glad_glClearNamedFramebufferuiv != glad_profile_glClearNamedFramebufferuiv) {
+		profile_real.ClearNamedFramebufferuiv = glad_glClearNamedFramebufferuiv;
+		glad_glClearNamedFramebufferuiv = glad_profile_glClearNamedFramebufferuiv;
+	}
+	if(glad_glClearNamedFramebufferfv != NULL && glad_glClearNamedFramebufferfv != glad_profile_glClearNamedFramebufferfv) {
+		profile_real.ClearNamedFramebufferfv = glad_glClearNamedFramebufferfv;
+		glad_glClearNamedFramebufferfv = glad_profile_glClearNamedFramebufferfv;
+	}
+	if(glad_glClearNamedFramebufferfi != NULL && glad_glClearNamedFramebufferfi != glad_profile_glClearNamedFramebufferfi) {
+		profile_real.ClearNamedFramebufferfi = glad_glClearNamedFramebufferfi;
+		glad_glClearNamedFramebufferfi = glad_profile_glClearNamedFramebufferfi;
+	}
+	if(glad_glBlitNamedFramebuffer != NULL && glad_glBlitNamedFramebuffer != glad_profile_glBlitNamedFramebuffer) {
+		profile_real.BlitNamedFramebuffer = glad_glBlitNamedFramebuffer;
+		glad_glBlitNamedFramebuffer = glad_profile_glBlitNamedFramebuffer;
+	}
+	if(glad_glCheckNamedFramebufferStatus != NULL && glad_glCheckNamedFramebufferStatus != glad_profile_glCheckNamedFramebufferStatus) {
+		profile_real.CheckNamedFramebufferStatus = glad_glCheckNamedFramebufferStatus;
+		glad_glCheckNamedFramebufferStatus = glad_profile_glCheckNamedFramebufferStatus;
+	}
+	if(glad_glGetNamedFramebufferParameteriv != NULL && glad_glGetNamedFramebufferParameteriv != glad_profile_glGetNamedFramebufferParameteriv) {
+		profile_real.GetNamedFramebufferParameteriv = glad_glGetNamedFramebufferParameteriv;
+		glad_glGetNamedFramebufferParameteriv = glad_profile_glGetNamedFramebufferParameteriv;
+	}
+	if(glad_glGetNamedFramebufferAttachmentParameteriv != NULL && glad_glGetNamedFramebufferAttachmentParameteriv != glad_profile_glGetNamedFramebufferAttachmentParameteriv) {
+		profile_real.GetNamedFramebufferAttachmentParameteriv = glad_glGetNamedFramebufferAttachmentParameteriv;
+		glad_glGetNamedFramebufferAttachmentParameteriv = glad_profile_glGetNamedFramebufferAttachmentParameteriv;
+	}
+	if(glad_glCreateRenderbuffers != NULL && glad_glCreateRenderbuffers != glad_profile_glCreateRenderbuffers) {
+		profile_real.CreateRenderbuffers = glad_glCreateRenderbuffers;
+		glad_glCreateRenderbuffers = glad_profile_glCreateRenderbuffers;
+	}
+	if(glad_glNamedRenderbufferStorage != NULL && glad_glNamedRenderbufferStorage != glad_profile_glNamedRenderbufferStorage) {
+		profile_real.NamedRenderbufferStorage = glad_glNamedRenderbufferStorage;
+		glad_glNamedRenderbufferStorage = glad_profile_glNamedRenderbufferStorage;
+	}
+	if(glad_glNamedRenderbufferStorageMultisample != NULL && glad_glNamedRenderbufferStorageMultisample != glad_profile_glNamedRenderbufferStorageMultisample) {
+		profile_real.NamedRenderbufferStorageMultisample = glad_glNamedRenderbufferStorageMultisample;
+		glad_glNamedRenderbufferStorageMultisample = glad_profile_glNamedRenderbufferStorageMultisample;
+	}
+	if(glad_glGetNamedRenderbufferParameteriv != NULL && glad_glGetNamedRenderbufferParameteriv != glad_profile_glGetNamedRenderbufferParameteriv) {
+		profile_real.GetNamedRenderbufferParameteriv = glad_glGetNamedRenderbufferParameteriv;
+		glad_glGetNamedRenderbufferParameteriv = glad_profile_glGetNamedRenderbufferParameteriv;
+	}
+	if(glad_glCreateTextures != NULL && glad_glCreateTextures != glad_profile_glCreateTextures) {
+		profile_real.CreateTextures = glad_glCreateTextures;
+		glad_glCreateTextures = glad_profile_glCreateTextures;
+	}
+	if(glad_glTextureBuffer != NULL && glad_glTextureBuffer != glad_profile_glTextureBuffer) {
+		profile_real.TextureBuffer = glad_glTextureBuffer;
+		glad_glTextureBuffer = glad_profile_glTextureBuffer;
+	}
+	if(glad_glTextureBufferRange != NULL && glad_glTextureBufferRange != glad_profile_glTextureBufferRange) {
+		profile_real.TextureBufferRange = glad_glTextureBufferRange;
+		glad_glTextureBufferRange = glad_profile_glTextureBufferRange;
+	}
+	if(glad_glTextureStorage1D != NULL && glad_glTextureStorage1D != glad_profile_glTextureStorage1D) {
+		profile_real.TextureStorage1D = glad_glTextureStorage1D;
+		glad_glTextureStorage1D = glad_profile_glTextureStorage1D;
+	}
+	if(glad_glTextureStorage2D != NULL && glad_glTextureStorage2D != glad_profile_glTextureStorage2D) {
+		profile_real.TextureStorage2D = glad_glTextureStorage2D;
+		glad_glTextureStorage2D = glad_profile_glTextureStorage2D;
+	}
+	if(glad_glTextureStorage3D != NULL && glad_glTextureStorage3D != glad_profile_glTextureStorage3D) {
+		profile_real.TextureStorage3D = glad_glTextureStorage3D;
+		glad_glTextureStorage3D = glad_profile_glTextureStorage3D;
+	}
+	if(glad_glTextureStorage2DMultisample != NULL && glad_glTextureStorage2DMultisample != glad_profile_glTextureStorage2DMultisample) {
+		profile_real.TextureStorage2DMultisample = glad_glTextureStorage2DMultisample;
+		glad_glTextureStorage2DMultisample = glad_profile_glTextureStorage2DMultisample;
+	}
+	if(glad_glTextureStorage3DMultisample != NULL && glad_glTextureStorage3DMultisample != glad_profile_glTextureStorage3DMultisample) {
+		profile_real.TextureStorage3DMultisample = glad_glTextureStorage3DMultisample;
+		glad_glTextureStorage3DMultisample = glad_profile_glTextureStorage3DMultisample;
+	}
+	if(glad_glTextureSubImage1D != NULL && glad_glTextureSubImage1D != glad_profile_glTextureSubImage1D) {
+		profile_real.TextureSubImage1D = glad_glTextureSubImage1D;
+		glad_glTextureSubImage1D = glad_profile_glTextureSubImage1D;
+	}
+	if(glad_glTextureSubImage2D != NULL && glad_glTextureSubImage2D != glad_profile_glTextureSubImage2D) {
+		profile_real.TextureSubImage2D = glad_glTextureSubImage2D;
+		glad_glTextureSubImage2D = glad_profile_glTextureSubImage2D;
+	}
+	if(glad_glTextureSubImage3D != NULL && glad_glTextureSubImage3D != glad_profile_glTextureSubImage3D) {
+		profile_real.TextureSubImage3D = glad_glTextureSubImage3D;
+		glad_glTextureSubImage3D = glad_profile_glTextureSubImage3D;
+	}
+	if(glad_glCompressedTextureSubImage1D != NULL && glad_glCompressedTextureSubImage1D != glad_profile_glCompressedTextureSubImage1D) {
+		profile_real.CompressedTextureSubImage1D = glad_glCompressedTextureSubImage1D;
+		glad_glCompressedTextureSubImage1D = glad_profile_glCompressedTextureSubImage1D;
+	}
+	if(glad_glCompressedTextureSubImage2D != NULL && glad_glCompressedTextureSubImage2D != glad_profile_glCompressedTextureSubImage2D) {
+		profile_real.CompressedTextureSubImage2D = glad_glCompressedTextureSubImage2D;
+		glad_glCompressedTextureSubImage2D = glad_profile_glCompressedTextureSubImage2D;
+	}
+	if(glad_glCompressedTextureSubImage3D != NULL && glad_glCompressedTextureSubImage3D != glad_profile_glCompressedTextureSubImage3D) {
+		profile_real.CompressedTextureSubImage3D = glad_glCompressedTextureSubImage3D;
+		glad_glCompressedTextureSubImage3D = glad_profile_glCompressedTextureSubImage3D;
+	}
+	if(glad_glCopyTextureSubImage1D != NULL && glad_glCopyTextureSubImage1D != glad_profile_glCopyTextureSubImage1D) {
+		profile_real.CopyTextureSubImage1D = glad_glCopyTextureSubImage1D;
+		glad_glCopyTextureSubImage1D = glad_profile_glCopyTextureSubImage1D;
+	}
+	if(glad_glCopyTextureSubImage2D != NULL && glad_glCopyTextureSubImage2D != glad_profile_glCopyTextureSubImage2D) {
+		profile_real.CopyTextureSubImage2D = glad_glCopyTextureSubImage2D;
+		glad_glCopyTextureSubImage2D = glad_profile_glCopyTextureSubImage2D;
+	}
+	if(glad_glCopyTextureSubImage3D != NULL && glad_glCopyTextureSubImage3D != glad_profile_glCopyTextureSubImage3D) {
+		profile_real.CopyTextureSubImage3D = glad_glCopyTextureSubImage3D;
+		glad_glCopyTextureSubImage3D = glad_profile_glCopyTextureSubImage3D;
+	}
+	if(glad_glTextureParameterf != NULL && glad_glTextureParameterf != glad_profile_glTextureParameterf) {
+		profile_real.TextureParameterf = glad_glTextureParameterf;
+		glad_glTextureParameterf = glad_profile_glTextureParameterf;
+	}
+	if(glad_glTextureParameterfv != NULL && glad_glTextureParameterfv != glad_profile_glTextureParameterfv) {
+		profile_real.TextureParameterfv = glad_glTextureParameterfv;
+		glad_glTextureParameterfv = glad_profile_glTextureParameterfv;
+	}
+	if(glad_glTextureParameteri != NULL && glad_glTextureParameteri != glad_profile_glTextureParameteri) {
+		profile_real.TextureParameteri = glad_glTextureParameteri;
+		glad_glTextureParameteri = glad_profile_glTextureParameteri;
+	}
+	if(glad_glTextureParameterIiv != NULL && glad_glTextureParameterIiv != glad_profile_glTextureParameterIiv) {
+		profile_real.TextureParameterIiv = glad_glTextureParameterIiv;
+		glad_glTextureParameterIiv = glad_profile_glTextureParameterIiv;
+	}
+	if(glad_glTextureParameterIuiv != NULL && glad_glTextureParameterIuiv != glad_profile_glTextureParameterIuiv) {
+		profile_real.TextureParameterIuiv = glad_glTextureParameterIuiv;
+		glad_glTextureParameterIuiv = glad_profile_glTextureParameterIuiv;
+	}
+	if(glad_glTextureParameteriv != NULL && glad_glTextureParameteriv != glad_profile_glTextureParameteriv) {
+		profile_real.TextureParameteriv = glad_glTextureParameteriv;
+		glad_glTextureParameteriv = glad_profile_glTextureParameteriv;
+	}
+	if(glad_glGenerateTextureMipmap != NULL && glad_glGenerateTextureMipmap != glad_profile_glGenerateTextureMipmap) {
+		profile_real.GenerateTextureMipmap = glad_glGenerateTextureMipmap;
+		glad_glGenerateTextureMipmap = glad_profile_glGenerateTextureMipmap;
+	}
+	if(glad_glBindTextureUnit != NULL && glad_glBindTextureUnit != glad_profile_glBindTextureUnit) {
+		profile_real.BindTextureUnit = glad_glBindTextureUnit;
+		glad_glBindTextureUnit = glad_profile_glBindTextureUnit;
+	}
+	if(glad_glGetTextureImage != NULL && glad_glGetTextureImage != glad_profile_glGetTextureImage) {
+		profile_real.GetTextureImage = glad_glGetTextureImage;
+		glad_glGetTextureImage = glad_profile_glGetTextureImage;
+	}
+	if(glad_glGetCompressedTextureImage != NULL && glad_glGetCompressedTextureImage != glad_profile_glGetCompressedTextureImage) {
+		profile_real.GetCompressedTextureImage = glad_glGetCompressedTextureImage;
+		glad_glGetCompressedTextureImage = glad_profile_glGetCompressedTextureImage;
+	}
+	if(glad_glGetTextureLevelParameterfv != NULL && glad_glGetTextureLevelParameterfv != glad_profile_glGetTextureLevelParameterfv) {
+		profile_real.GetTextureLevelParameterfv = glad_glGetTextureLevelParameterfv;
+		glad_glGetTextureLevelParameterfv = glad_profile_glGetTextureLevelParameterfv;
+	}
+	if(glad_glGetTextureLevelParameteriv != NULL && glad_glGetTextureLevelParameteriv != glad_profile_glGetTextureLevelParameteriv) {
+		profile_real.GetTextureLevelParameteriv = glad_glGetTextureLevelParameteriv;
+		glad_glGetTextureLevelParameteriv = glad_profile_glGetTextureLevelParameteriv;
+	}
+	if(glad_glGetTextureParameterfv != NULL && glad_glGetTextureParameterfv != glad_profile_glGetTextureParameterfv) {
+		profile_real.GetTextureParameterfv = glad_glGetTextureParameterfv;
+		glad_glGetTextureParameterfv = glad_profile_glGetTextureParameterfv;
+	}
+	if(glad_glGetTextureParameterIiv != NULL && glad_glGetTextureParameterIiv != glad_profile_glGetTextureParameterIiv) {
+		profile_real.GetTextureParameterIiv = glad_glGetTextureParameterIiv;
+		glad_glGetTextureParameterIiv = glad_profile_glGetTextureParameterIiv;
+	}
+	if(glad_glGetTextureParameterIuiv != NULL && glad_glGetTextureParameterIuiv != glad_profile_glGetTextureParameterIuiv) {
+		profile_real.GetTextureParameterIuiv = glad_glGetTextureParameterIuiv;
+		glad_glGetTextureParameterIuiv = glad_profile_glGetTextureParameterIuiv;
+	}
+	if(glad_glGetTextureParameteriv != NULL && glad_glGetTextureParameteriv != glad_profile_glGetTextureParameteriv) {
+		profile_real.GetTextureParameteriv = glad_glGetTextureParameteriv;
+		glad_glGetTextureParameteriv = glad_profile_glGetTextureParameteriv;
+	}
+	if(glad_glCreateVertexArrays != NULL && glad_glCreateVertexArrays != glad_profile_glCreateVertexArrays) {
+		profile_real.CreateVertexArrays = glad_glCreateVertexArrays;
+		glad_glCreateVertexArrays = glad_profile_glCreateVertexArrays;
+	}
+	if(glad_glDisableVertexArrayAttrib != NULL && glad_glDisableVertexArrayAttrib != glad_profile_glDisableVertexArrayAttrib) {
+		profile_real.DisableVertexArrayAttrib = glad_glDisableVertexArrayAttrib;
+		glad_glDisableVertexArrayAttrib = glad_profile_glDisableVertexArrayAttrib;
+	}
+	if(glad_glEnableVertexArrayAttrib != NULL && glad_glEnableVertexArrayAttrib != glad_profile_glEnableVertexArrayAttrib) {
+		profile_real.EnableVertexArrayAttrib = glad_glEnableVertexArrayAttrib;
+		glad_glEnableVertexArrayAttrib = glad_profile_glEnableVertexArrayAttrib;
+	}
+	if(glad_glVertexArrayElementBuffer != NULL && glad_glVertexArrayElementBuffer != glad_profile_glVertexArrayElementBuffer) {
+		profile_real.VertexArrayElementBuffer = glad_glVertexArrayElementBuffer;
+		glad_glVertexArrayElementBuffer = glad_profile_glVertexArrayElementBuffer;
+	}
+	if(glad_glVertexArrayVertexBuffer != NULL && glad_glVertexArrayVertexBuffer != glad_profile_glVertexArrayVertexBuffer) {
+		profile_real.VertexArrayVertexBuffer = glad_glVertexArrayVertexBuffer;
+		glad_glVertexArrayVertexBuffer = glad_profile_glVertexArrayVertexBuffer;
+	}
+	if(glad_glVertexArrayVertexBuffers != NULL && glad_glVertexArrayVertexBuffers != glad_profile_glVertexArrayVertexBuffers) {
+		profile_real.VertexArrayVertexBuffers = glad_glVertexArrayVertexBuffers;
+		glad_glVertexArrayVertexBuffers = glad_profile_glVertexArrayVertexBuffers;
+	}
+	if(glad_glVertexArrayAttribBinding != NULL && glad_glVertexArrayAttribBinding != glad_profile_glVertexArrayAttribBinding) {
+		profile_real.VertexArrayAttribBinding = glad_glVertexArrayAttribBinding;
+		glad_glVertexArrayAttribBinding = glad_profile_glVertexArrayAttribBinding;
+	}
+	if(glad_glVertexArrayAttribFormat != NULL && glad_glVertexArrayAttribFormat != glad_profile_glVertexArrayAttribFormat) {
+		profile_real.VertexArrayAttribFormat = glad_glVertexArrayAttribFormat;
+		glad_glVertexArrayAttribFormat = glad_profile_glVertexArrayAttribFormat;
+	}
+	if(glad_glVertexArrayAttribIFormat != NULL && glad_glVertexArrayAttribIFormat != glad_profile_glVertexArrayAttribIFormat) {
+		profile_real.VertexArrayAttribIFormat = glad_glVertexArrayAttribIFormat;
+		glad_glVertexArrayAttribIFormat = glad_profile_glVertexArrayAttribIFormat;
+	}
+	if(glad_glVertexArrayAttribLFormat != NULL && glad_glVertexArrayAttribLFormat != glad_profile_glVertexArrayAttribLFormat) {
+		profile_real.VertexArrayAttribLFormat = glad_glVertexArrayAttribLFormat;
+		glad_glVertexArrayAttribLFormat = glad_profile_glVertexArrayAttribLFormat;
+	}
+	if(glad_glVertexArrayBindingDivisor != NULL && glad_glVertexArrayBindingDivisor != glad_profile_glVertexArrayBindingDivisor) {
+		profile_real.VertexArrayBindingDivisor = glad_glVertexArrayBindingDivisor;
+		glad_glVertexArrayBindingDivisor = glad_profile_glVertexArrayBindingDivisor;
+	}
+	if(glad_glGetVertexArrayiv != NULL && glad_glGetVertexArrayiv != glad_profile_glGetVertexArrayiv) {
+		profile_real.GetVertexArrayiv = glad_glGetVertexArrayiv;
+		glad_glGetVertexArrayiv = glad_profile_glGetVertexArrayiv;
+	}
+	if(glad_glGetVertexArrayIndexediv != NULL && glad_glGetVertexArrayIndexediv != glad_profile_glGetVertexArrayIndexediv) {
+		profile_real.GetVertexArrayIndexediv = glad_glGetVertexArrayIndexediv;
+		glad_glGetVertexArrayIndexediv = glad_profile_glGetVertexArrayIndexediv;
+	}
+	if(glad_glGetVertexArrayIndexed64iv != NULL && glad_glGetVertexArrayIndexed64iv != glad_profile_glGetVertexArrayIndexed64iv) {
+		profile_real.GetVertexArrayIndexed64iv = glad_glGetVertexArrayIndexed64iv;
+		glad_glGetVertexArrayIndexed64iv = glad_profile_glGetVertexArrayIndexed64iv;
+	}
+	if(glad_glCreateSamplers != NULL && glad_glCreateSamplers != glad_profile_glCreateSamplers) {
+		profile_real.CreateSamplers = glad_glCreateSamplers;
+		glad_glCreateSamplers = glad_profile_glCreateSamplers;
+	}
+	if(glad_glCreateProgramPipelines != NULL && glad_glCreateProgramPipelines != glad_profile_glCreateProgramPipelines) {
+		profile_real.CreateProgramPipelines = glad_glCreateProgramPipelines;
+		glad_glCreateProgramPipelines = glad_profile_glCreateProgramPipelines;
+	}
+	if(glad_glCreateQueries != NULL && glad_glCreateQueries != glad_profile_glCreateQueries) {
+		profile_real.CreateQueries = glad_glCreateQueries;
+		glad_glCreateQueries = glad_profile_glCreateQueries;
+	}
+	if(glad_glGetQueryBufferObjecti64v != NULL && glad_glGetQueryBufferObjecti64v != glad_profile_glGetQueryBufferObjecti64v) {
+		profile_real.GetQueryBufferObjecti64v = glad_glGetQueryBufferObjecti64v;
+		glad_glGetQueryBufferObjecti64v = glad_profile_glGetQueryBufferObjecti64v;
+	}
+	if(glad_glGetQueryBufferObjectiv != NULL && glad_glGetQueryBufferObjectiv != glad_profile_glGetQueryBufferObjectiv) {
+		profile_real.GetQueryBufferObjectiv = glad_glGetQueryBufferObjectiv;
+		glad_glGetQueryBufferObjectiv = glad_profile_glGetQueryBufferObjectiv;
+	}
+	if(glad_glGetQueryBufferObjectui64v != NULL && glad_glGetQueryBufferObjectui64v != glad_profile_glGetQueryBufferObjectui64v) {
+		profile_real.GetQueryBufferObjectui64v = glad_glGetQueryBufferObjectui64v;
+		glad_glGetQueryBufferObjectui64v = glad_profile_glGetQueryBufferObjectui64v;
+	}
+	if(glad_glGetQueryBufferObjectuiv != NULL && glad_glGetQueryBufferObjectuiv != glad_profile_glGetQueryBufferObjectuiv) {
+		profile_real.GetQueryBufferObjectuiv = glad_glGetQueryBufferObjectuiv;
+		glad_glGetQueryBufferObjectuiv = glad_profile_glGetQueryBufferObjectuiv;
+	}
+	if(glad_glMemoryBarrierByRegion != NULL && glad_glMemoryBarrierByRegion != glad_profile_glMemoryBarrierByRegion) {
+		profile_real.MemoryBarrierByRegion = glad_glMemoryBarrierByRegion;
+		glad_glMemoryBarrierByRegion = glad_profile_glMemoryBarrierByRegion;
+	}
+	if(glad_glGetTextureSubImage != NULL && glad_glGetTextureSubImage != glad_profile_glGetTextureSubImage) {
+		profile_real.GetTextureSubImage = glad_glGetTextureSubImage;
+		glad_glGetTextureSubImage = glad_profile_glGetTextureSubImage;
+	}
+	if(glad_glGetCompressedTextureSubImage != NULL && glad_glGetCompressedTextureSubImage != glad_profile_glGetCompressedTextureSubImage) {
+		profile_real.GetCompressedTextureSubImage = glad_glGetCompressedTextureSubImage;
+		glad_glGetCompressedTextureSubImage = glad_profile_glGetCompressedTextureSubImage;
+	}
+	if(glad_glGetGraphicsResetStatus != NULL && glad_glGetGraphicsResetStatus != glad_profile_glGetGraphicsResetStatus) {
+		profile_real.GetGraphicsResetStatus = glad_glGetGraphicsResetStatus;
+		glad_glGetGraphicsResetStatus = glad_profile_glGetGraphicsResetStatus;
+	}
+	if(glad_glGetnCompressedTexImage != NULL && glad_glGetnCompressedTexImage != glad_profile_glGetnCompressedTexImage) {
+		profile_real.GetnCompressedTexImage = glad_glGetnCompressedTexImage;
+		glad_glGetnCompressedTexImage = glad_profile_glGetnCompressedTexImage;
+	}
+	if(glad_glGetnTexImage != NULL && glad_glGetnTexImage != glad_profile_glGetnTexImage) {
+		profile_real.GetnTexImage = glad_glGetnTexImage;
+		glad_glGetnTexImage = glad_profile_glGetnTexImage;
+	}
+	if(glad_glGetnUniformdv != NULL && glad_glGetnUniformdv != glad_profile_glGetnUniformdv) {
+		profile_real.GetnUniformdv = glad_glGetnUniformdv;
+		glad_glGetnUniformdv = glad_profile_glGetnUniformdv;
+	}
+	if(glad_glGetnUniformfv != NULL && glad_glGetnUniformfv != glad_profile_glGetnUniformfv) {
+		profile_real.GetnUniformfv = glad_glGetnUniformfv;
+		glad_glGetnUniformfv = glad_profile_glGetnUniformfv;
+	}
+	if(glad_glGetnUniformiv != NULL && glad_glGetnUniformiv != glad_profile_glGetnUniformiv) {
+		profile_real.GetnUniformiv = glad_glGetnUniformiv;
+		glad_glGetnUniformiv = glad_profile_glGetnUniformiv;
+	}
+	if(glad_glGetnUniformuiv != NULL && glad_glGetnUniformuiv != glad_profile_glGetnUniformuiv) {
+		profile_real.GetnUniformuiv = glad_glGetnUniformuiv;
+		glad_glGetnUniformuiv = glad_profile_glGetnUniformuiv;
+	}
+	if(glad_glReadnPixels != NULL && glad_glReadnPixels != glad_profile_glReadnPixels) {
+		profile_real.ReadnPixels = glad_glReadnPixels;
+		glad_glReadnPixels = glad_profile_glReadnPixels;
+	}
+	if(glad_glTextureBarrier != NULL && glad_glTextureBarrier != glad_profile_glTextureBarrier) {
+		profile_real.TextureBarrier = glad_glTextureBarrier;
+		glad_glTextureBarrier = glad_profile_glTextureBarrier;
+	}
+	if(glad_glMaxShaderCompilerThreadsKHR != NULL && glad_glMaxShaderCompilerThreadsKHR != glad_profile_glMaxShaderCompilerThreadsKHR) {
+		profile_real.MaxShaderCompilerThreadsKHR = glad_glMaxShaderCompilerThreadsKHR;
+		glad_glMaxShaderCompilerThreadsKHR = glad_profile_glMaxShaderCompilerThreadsKHR;
+	}
+}
+
+struct profile_total {
+    const char *name;
+    unsigned long long calls;
+    unsigned long long ns;
+};
+
+static int compare_profile_totals(const void *a, const void *b) {
+    const struct profile_total *left = (const struct profile_total *)a;
+    const struct profile_total *right = (const struct profile_total *)b;
+    if(left->ns != right->ns) {
+        return left->ns < right->ns ? 1 : -1;
+    }
+    return strcmp(left->name, right->name);
+}
+
+/* Sums all thread tables into totals, most expensive first, and returns how
+ * many entry points were called. Threads still calling GL while this runs
+ * may be counted partially. */
+static int profile_totals(struct profile_total *totals) {
+    struct profile_table *table;
+    unsigned int index;
+    int count = 0;
+
+    for(index = 0; index < NUM_PROFILED; index++) {
+        totals[index].name = profile_names[index];
+        totals[index].calls = 0;
+        totals[index].ns = 0;
+    }
+#if defined(_MSC_VER)
+    table = profile_tables;
+#else
+    table = __atomic_load_n(&profile_tables, __ATOMIC_ACQUIRE);
+#endif
+    for(; table != NULL; table = table->next) {
+        for(index = 0; index < NUM_PROFILED; index++) {
+            totals[index].calls += table->entries[index].calls;
+            totals[index].ns += table->entries[index].ns;
+        }
+    }
+
+    qsort(totals, NUM_PROFILED, sizeof(totals[0]), compare_profile_totals);
+    while(count < (int)NUM_PROFILED && totals[count].calls > 0) {
+        count++;
+    }
+    return count;
+}
+
+void gladProfileReport(void) {
+    static struct profile_total totals[NUM_PROFILED];
+    unsigned long long total_ns = 0;
+    int count = profile_totals(totals);
+    int index;
+
+    for(index = 0; index < count; index++) {
+        total_ns += totals[index].ns;
+    }
+
+    fprintf(stderr, "%-32s %12s %14s %10s %7s\n", "function", "calls", "total us", "ns/call", "share");
+    for(index = 0; index < count; index++) {
+        fprintf(stderr, "%-32s %12llu %14.1f %10.1f %6.1f%%\n",
+            totals[index].name, totals[index].calls, (double)totals[index].ns / 1e3,
+            (double)totals[index].ns / (double)totals[index].calls,
+            total_ns > 0 ? 100.0 * (double)totals[index].ns / (double)total_ns : 0.0);
+    }
+}
+
+int gladProfileWriteCSV(const char *path) {
+    static struct profile_total totals[NUM_PROFILED];
+    int count = profile_totals(totals);
+    int index;
+    FILE *file = fopen(path, "w");
+
+    if(file == NULL) {
+        return 0;
+    }
+
+    fprintf(file, "function,calls,total_ns\n");
+    for(index = 0; index < count; index++) {
+        fprintf(file, "%s,%llu,%llu\n", totals[index].name, totals[index].calls, totals[index].ns);
+    }
+    return fclose(file) == 0;
+}
+
+static void profile_at_exit(void) {
+    const char *csv = getenv("GLAD_PROFILE_CSV");
+
+    gladProfileReport();
+    if(csv != NULL && !gladProfileWriteCSV(csv)) {
+        fprintf(stderr, "glad: could not write %s\n", csv);
+    }
+}
+
+static void profile_start(void) {
+    static int registered = 0;
+
+    profile_install();
+    if(!registered) {
+        registered = 1;
+        atexit(profile_at_exit);
+    }
+}
+#endif
+
+static int find_extensionsGL(void) {
+	free_exts(&exts_gl);
+	if (!get_exts(&exts_gl, max_loaded_major, glGetString, glGetIntegerv, glGetStringi)) return 0;
+	GLAD_GL_ARB_buffer_storage = has_ext(&exts_gl, "GL_ARB_buffer_storage");
+	GLAD_GL_ARB_direct_state_access = has_ext(&exts_gl, "GL_ARB_direct_state_access");
+	GLAD_GL_ARB_multi_draw_indirect = has_ext(&exts_gl, "GL_ARB_multi_draw_indirect");
+	GLAD_GL_KHR_debug = has_ext(&exts_gl, "GL_KHR_debug");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext(&exts_gl, "GL_KHR_parallel_shader_compile");
+	return 1;
+}
+
+static int parse_version(const char *version, int *major, int *minor) {
+
+    /* Thank you @elmindreda
+     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
+     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
+     */
+    int i;
+
+    const char* prefixes[] = {
+        "OpenGL ES-CM ",
+        "OpenGL ES-CL ",
+        "OpenGL ES ",
+        NULL
+    };
+
+    *major = 0; *minor = 0;
+    if (!version) return 0;
+
+    for (i = 0;  prefixes[i];  i++) {
+        const size_t length = strlen(prefixes[i]);
+        if (strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+
+/* PR #18 */
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", major, minor);
+#else
+    sscanf(version, "%d.%d", major, minor);
+#endif
+    return 1;
+}
+
+/* The features the core version brings on its own. The extensions can add
+ * to them once they are loaded, see finish_capabilities. */
+static void version_capabilities(struct gladGLCapabilities *caps, int major, int minor) {
+    int version = major * 10 + minor;
+
+    caps->tier = version >= 33 ? GLAD_GL_TIER_33 : GLAD_GL_TIER_NONE;
+    caps->buffer_storage = version >= 44;
+    caps->direct_state_access = version >= 45;
+    caps->multi_draw_indirect = version >= 43;
+    caps->debug_output = version >= 43;
+}
+
+/* Each argument says whether the feature's extension was found and its
+ * entry points loaded. Core features whose entry points are missing (a
+ * driver advertising a version it does not fully export) are dropped. */
+static void finish_capabilities(struct gladGLCapabilities *caps, int buffer_storage,
+                                int direct_state_access, int multi_draw_indirect, int debug_output) {
+    caps->buffer_storage = buffer_storage;
+    caps->direct_state_access = direct_state_access;
+    caps->multi_draw_indirect = multi_draw_indirect;
+    caps->debug_output = debug_output;
+    if (caps->tier == GLAD_GL_TIER_33 && buffer_storage && direct_state_access && multi_draw_indirect) {
+        caps->tier = GLAD_GL_TIER_45;
+    }
+}
+
+#ifndef GLAD_PROFILE
+/* Resolves what find_capabilitiesGL looks at, so after a lazy load it sees
+ * the real entry points (or NULL) rather than trampolines that are never
+ * NULL. Pointers without a trampoline were not loaded and are left alone. */
+static void resolve_capabilitiesGL(GLADloadproc load) {
+	if(glad_glBufferStorage == glad_lazy_glBufferStorage)
+		glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+	if(glad_glCreateBuffers == glad_lazy_glCreateBuffers)
+		glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	if(glad_glNamedBufferStorage == glad_lazy_glNamedBufferStorage)
+		glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	if(glad_glCreateVertexArrays == glad_lazy_glCreateVertexArrays)
+		glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	if(glad_glMultiDrawElementsIndirect == glad_lazy_glMultiDrawElementsIndirect)
+		glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+	if(glad_glDebugMessageCallback == glad_lazy_glDebugMessageCallback)
+		glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+}
+#endif
+
+static void find_capabilitiesGL(void) {
+    struct gladGLCapabilities *caps = &GLCapabilities;
+
+    finish_capabilities(caps,
+        (caps->buffer_storage || GLAD_GL_ARB_buffer_storage) && glad_glBufferStorage != NULL,
+        (caps->direct_state_access || GLAD_GL_ARB_direct_state_access) && glad_glCreateBuffers != NULL &&
+            glad_glNamedBufferStorage != NULL && glad_glCreateVertexArrays != NULL,
+        (caps->multi_draw_indirect || GLAD_GL_ARB_multi_draw_indirect) && glad_glMultiDrawElementsIndirect != NULL,
+        (caps->debug_output || GLAD_GL_KHR_debug) && glad_glDebugMessageCallback != NULL);
+}
+
+static void find_coreGL(void) {
+    int major, minor;
+
+    if (!parse_version((const char*) glGetString(GL_VERSION), &major, &minor)) return;
+
+    GLVersion.major = major; GLVersion.minor = minor;
+    version_capabilities(&GLCapabilities, major, minor);
+    max_loaded_major = major; max_loaded_minor = minor;
+	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+	GLAD_GL_VERSION_4_0 = (major == 4 && minor >= 0) || major > 4;
+	GLAD_GL_VERSION_4_1 = (major == 4 && minor >= 1) || major > 4;
+	GLAD_GL_VERSION_4_2 = (major == 4 && minor >= 2) || major > 4;
+	GLAD_GL_VERSION_4_3 = (major == 4 && minor >= 3) || major > 4;
+	GLAD_GL_VERSION_4_4 = (major == 4 && minor >= 4) || major > 4;
+	GLAD_GL_VERSION_4_5 = (major == 4 && minor >= 5) || major > 4;
+	if (GLVersion.major > 4 || (GLVersion.major >= 4 && GLVersion.minor >= 5)) {
+		max_loaded_major = 4;
+		max_loaded_minor = 5;
+	}
+}
+
+int gladLoadGLLoader(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	memset(&GLCapabilities, 0, sizeof(GLCapabilities));
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	load_GL_VERSION_1_0(load);
+	load_GL_VERSION_1_1(load);
+	load_GL_VERSION_1_2(load);
+	load_GL_VERSION_1_3(load);
+	load_GL_VERSION_1_4(load);
+	load_GL_VERSION_1_5(load);
+	load_GL_VERSION_2_0(load);
+	load_GL_VERSION_2_1(load);
+	load_GL_VERSION_3_0(load);
+	load_GL_VERSION_3_1(load);
+	load_GL_VERSION_3_2(load);
+	load_GL_VERSION_3_3(load);
+	load_GL_VERSION_4_0(load);
+	load_GL_VERSION_4_1(load);
+	load_GL_VERSION_4_2(load);
+	load_GL_VERSION_4_3(load);
+	load_GL_VERSION_4_4(load);
+	load_GL_VERSION_4_5(load);
+
+	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_buffer_storage(load);
+	load_GL_ARB_direct_state_access(load);
+	load_GL_ARB_multi_draw_indirect(load);
+	load_GL_KHR_debug(load);
+	load_GL_KHR_parallel_shader_compile(load);
+	find_capabilitiesGL();
+#ifdef GLAD_PROFILE
+	profile_start();
+#endif
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+#ifdef GLAD_PROFILE
+	/* The trampolines would patch the shims away again. */
+	return gladLoadGLLoader(load);
+#else
+	GLVersion.major = 0; GLVersion.minor = 0;
+	memset(&GLCapabilities, 0, sizeof(GLCapabilities));
+	glad_lazy_load = load;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+	lazy_GL_VERSION_4_0();
+	lazy_GL_VERSION_4_1();
+	lazy_GL_VERSION_4_2();
+	lazy_GL_VERSION_4_3();
+	lazy_GL_VERSION_4_4();
+	lazy_GL_VERSION_4_5();
+
+	/* get_exts keeps calling through the pointers it is handed, which must
+	 * not be trampolines that only ever patch the globals. */
+	glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	if(GLAD_GL_VERSION_3_0) glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+
+	if (!find_extensionsGL()) return 0;
+	lazy_GL_ARB_buffer_storage();
+	lazy_GL_ARB_direct_state_access();
+	lazy_GL_ARB_multi_draw_indirect();
+	lazy_GL_KHR_debug();
+	lazy_GL_KHR_parallel_shader_compile();
+	resolve_capabilitiesGL(load);
+	find_capabilitiesGL();
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+#endif
+}
+
+int gladHasExtension(const char *name) {
+    return has_ext(&exts_gl, name);
+}
+
+static void find_coreGLContext(GladGLContext *context) {
+    int major, minor;
+
+    if (!parse_version((const char*) context->GetString(GL_VERSION), &major, &minor)) return;
+
+    context->version.major = major; context->version.minor = minor;
+    version_capabilities(&context->capabilities, major, minor);
+	context->VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	context->VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	context->VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	context->VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	context->VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	context->VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	context->VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	context->VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	context->VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	context->VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	context->VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	context->VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+	context->VERSION_4_0 = (major == 4 && minor >= 0) || major > 4;
+	context->VERSION_4_1 = (major == 4 && minor >= 1) || major > 4;
+	context->VERSION_4_2 = (major == 4 && minor >= 2) || major > 4;
+	context->VERSION_4_3 = (major == 4 && minor >= 3) || major > 4;
+	context->VERSION_4_4 = (major == 4 && minor >= 4) || major > 4;
+	context->VERSION_4_5 = (major == 4 && minor >= 5) || major > 4;
+}
+
+static void find_capabilitiesGLContext(GladGLContext *context) {
+    struct gladGLCapabilities *caps = &context->capabilities;
+
+    finish_capabilities(caps,
+        (caps->buffer_storage || context->ARB_buffer_storage) && context->BufferStorage != NULL,
+        (caps->direct_state_access || context->ARB_direct_state_access) && context->CreateBuffers != NULL &&
+            context->NamedBufferStorage != NULL && context->CreateVertexArrays != NULL,
+        (caps->multi_draw_indirect || context->ARB_multi_draw_indirect) && context->MultiDrawElementsIndirect != NULL,
+        (caps->debug_output || context->KHR_debug) && context->DebugMessageCallback != NULL);
+}
+
+int gladLoadGLContext(GladGLContext *context, GLADloadproc load) {
+	context->version.major = 0; context->version.minor = 0;
+	memset(&context->capabilities, 0, sizeof(context->capabilities));
+	context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(context->GetString == NULL) return 0;
+	if(context->GetString(GL_VERSION) == NULL) return 0;
+	find_coreGLContext(context);
+	load_GL_VERSION_1_0_context(context, load);
+	load_GL_VERSION_1_1_context(context, load);
+	load_GL_VERSION_1_2_context(context, load);
+	load_GL_VERSION_1_3_context(context, load);
+	load_GL_VERSION_1_4_context(context, load);
+	load_GL_VERSION_1_5_context(context, load);
+	load_GL_VERSION_2_0_context(context, load);
+	load_GL_VERSION_2_1_context(context, load);
+	load_GL_VERSION_3_0_context(context, load);
+	load_GL_VERSION_3_1_context(context, load);
+	load_GL_VERSION_3_2_context(context, load);
+	load_GL_VERSION_3_3_context(context, load);
+	load_GL_VERSION_4_0_context(context, load);
+	load_GL_VERSION_4_1_context(context, load);
+	load_GL_VERSION_4_2_context(context, load);
+	load_GL_VERSION_4_3_context(context, load);
+	load_GL_VERSION_4_4_context(context, load);
+	load_GL_VERSION_4_5_context(context, load);
+
+	free_exts(&context->extensions);
+	if (!get_exts(&context->extensions, context->version.major,
+	              context->GetString, context->GetIntegerv, context->GetStringi)) return 0;
+	context->ARB_buffer_storage = has_ext(&context->extensions, "GL_ARB_buffer_storage");
+	context->ARB_direct_state_access = has_ext(&context->extensions, "GL_ARB_direct_state_access");
+	context->ARB_multi_draw_indirect = has_ext(&context->extensions, "GL_ARB_multi_draw_indirect");
+	context->KHR_debug = has_ext(&context->extensions, "GL_KHR_debug");
+	context->KHR_parallel_shader_compile = has_ext(&context->extensions, "GL_KHR_parallel_shader_compile");
+	load_GL_ARB_buffer_storage_context(context, load);
+	load_GL_ARB_direct_state_access_context(context, load);
+	load_GL_ARB_multi_draw_indirect_context(context, load);
+	load_GL_KHR_debug_context(context, load);
+	load_GL_KHR_parallel_shader_compile_context(context, load);
+	find_capabilitiesGLContext(context);
+	return context->version.major != 0 || context->version.minor != 0;
+}
+
+int gladContextHasExtension(const GladGLContext *context, const char *name) {
+    return has_ext(&context->extensions, name);
+}
+
+void gladUnloadGLContext(GladGLContext *context) {
+    free_exts(&context->extensions);
+}
+
+GLAD_THREAD_LOCAL GladGLContext *glad_gl_current_context = NULL;
+
+void gladSetGLContext(GladGLContext *context) {
+    glad_gl_current_context = context;
+}
+
+GladGLContext *gladGetGLContext(void) {
+    return glad_gl_current_context;
 }
 
@@ -0,0 +1,259 @@
+#include "headless_context.h"
+
+#include <glad/gl_backends.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <dlfcn.h>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+EGLDisplay display = EGL_NO_DISPLAY;
+EGLContext context = EGL_NO_CONTEXT;
+EGLContext sharedContext = EGL_NO_CONTEXT;
+
+// OSMesa is loaded with dlopen so the binaries do not depend on it. The
+// declarations follow GL/osmesa.h.
+typedef struct osmesa_context *OSMesaContext;
+typedef void (*OSMesaProc)();
+
+const int OSMESA_RGBA = 0x1908;
+const int OSMESA_FORMAT = 0x22;
+const int OSMESA_DEPTH_BITS = 0x30;
+const int OSMESA_PROFILE = 0x33;
+const int OSMESA_CORE_PROFILE = 0x34;
+const int OSMESA_CONTEXT_MAJOR_VERSION = 0x36;
+const int OSMESA_CONTEXT_MINOR_VERSION = 0x37;
+const unsigned int GL_UNSIGNED_BYTE_TYPE = 0x1401;
+
+struct OSMesa {
+    void *library = nullptr;
+    OSMesaContext (*createContextAttribs)(const int *attribs, OSMesaContext share) = nullptr;
+    unsigned char (*makeCurrent)(OSMesaContext context, void *buffer, unsigned int type,
+                                 int width, int height) = nullptr;
+    void (*destroyContext)(OSMesaContext context) = nullptr;
+    OSMesaProc (*getProcAddress)(const char *name) = nullptr;
+
+    OSMesaContext context = nullptr;
+    OSMesaContext sharedContext = nullptr;
+    // The default framebuffers OSMesa insists on; rendering goes to FBOs.
+    std::vector<unsigned char> buffer;
+    std::vector<unsigned char> sharedBuffer;
+};
+
+OSMesa osmesa;
+
+const char *backend = nullptr;
+
+const EGLint eglContextAttribs[] = {
+    EGL_CONTEXT_MAJOR_VERSION, 3,
+    EGL_CONTEXT_MINOR_VERSION, 3,
+    EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+    EGL_NONE
+};
+
+const int osmesaContextAttribs[] = {
+    OSMESA_FORMAT, OSMESA_RGBA,
+    OSMESA_DEPTH_BITS, 24,
+    OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+    OSMESA_CONTEXT_MAJOR_VERSION, 3,
+    OSMESA_CONTEXT_MINOR_VERSION, 3,
+    0
+};
+
+bool createEGLContext() {
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+        eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay == nullptr) {
+        std::cerr << "EGL_EXT_platform_base is not available" << std::endl;
+        return false;
+    }
+
+    display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+        std::cerr << "Failed to initialize the surfaceless EGL display" << std::endl;
+        display = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    eglBindAPI(EGL_OPENGL_API);
+    context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, eglContextAttribs);
+    if (context == EGL_NO_CONTEXT ||
+        !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        std::cerr << "Failed to create a GL 3.3 core context" << std::endl;
+        destroyHeadlessContext();
+        return false;
+    }
+
+    return true;
+}
+
+void destroyEGLContext() {
+    if (display == EGL_NO_DISPLAY) {
+        return;
+    }
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (context != EGL_NO_CONTEXT) {
+        eglDestroyContext(display, context);
+        context = EGL_NO_CONTEXT;
+    }
+    eglTerminate(display);
+    display = EGL_NO_DISPLAY;
+}
+
+void closeOSMesa() {
+    if (osmesa.library != nullptr) {
+        dlclose(osmesa.library);
+    }
+    osmesa = OSMesa();
+}
+
+// The backend of that name in glad's table.
+const gladGLBackend *gladBackend(const char *name) {
+    for (const gladGLBackend &backend : GLAD_GL_BACKENDS) {
+        if (strcmp(backend.name, name) == 0) {
+            return &backend;
+        }
+    }
+    return nullptr;
+}
+
+bool createOSMesaContext() {
+    // The libraries glad's loader opens for "osmesa", so it finds the same
+    // one when asked to load from it.
+    const gladGLBackend *backend = gladBackend("osmesa");
+    for (int i = 0; backend->libraries[i] != nullptr && osmesa.library == nullptr; i++) {
+        osmesa.library = dlopen(backend->libraries[i], RTLD_NOW | RTLD_LOCAL);
+    }
+    if (osmesa.library == nullptr) {
+        std::cerr << "libOSMesa is not installed" << std::endl;
+        return false;
+    }
+
+    osmesa.createContextAttribs = (decltype(osmesa.createContextAttribs))
+        dlsym(osmesa.library, "OSMesaCreateContextAttribs");
+    osmesa.makeCurrent = (decltype(osmesa.makeCurrent))dlsym(osmesa.library, "OSMesaMakeCurrent");
+    osmesa.destroyContext = (decltype(osmesa.destroyContext))dlsym(osmesa.library, "OSMesaDestroyContext");
+    osmesa.getProcAddress = (decltype(osmesa.getProcAddress))dlsym(osmesa.library, backend->getProcAddress);
+    if (osmesa.createContextAttribs == nullptr || osmesa.makeCurrent == nullptr ||
+        osmesa.destroyContext == nullptr || osmesa.getProcAddress == nullptr) {
+        std::cerr << "libOSMesa is too old to create core contexts" << std::endl;
+        closeOSMesa();
+        return false;
+    }
+
+    osmesa.context = osmesa.createContextAttribs(osmesaContextAttribs, nullptr);
+    osmesa.buffer.resize(16 * 16 * 4);
+    if (osmesa.context == nullptr ||
+        !osmesa.makeCurrent(osmesa.context, osmesa.buffer.data(), GL_UNSIGNED_BYTE_TYPE, 16, 16)) {
+        std::cerr << "Failed to create a GL 3.3 core context with OSMesa" << std::endl;
+        if (osmesa.context != nullptr) {
+            osmesa.destroyContext(osmesa.context);
+        }
+        closeOSMesa();
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+bool createHeadlessContext(const char *backends) {
+    std::string order = backends != nullptr ? backends : "";
+    size_t start = 0;
+    while (start <= order.size()) {
+        size_t end = order.find(',', start);
+        if (end == std::string::npos) {
+            end = order.size();
+        }
+        std::string name = order.substr(start, end - start);
+        if (name == "egl" && createEGLContext()) {
+            backend = "egl";
+            return true;
+        }
+        if (name == "osmesa" && createOSMesaContext()) {
+            backend = "osmesa";
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+void destroyHeadlessContext() {
+    destroySharedHeadlessContext();
+    destroyEGLContext();
+    if (osmesa.context != nullptr) {
+        osmesa.makeCurrent(nullptr, nullptr, 0, 0, 0);
+        osmesa.destroyContext(osmesa.context);
+    }
+    closeOSMesa();
+    backend = nullptr;
+}
+
+bool makeHeadlessContextCurrent(bool current) {
+    if (osmesa.context != nullptr) {
+        if (!current) {
+            return osmesa.makeCurrent(nullptr, nullptr, 0, 0, 0) != 0;
+        }
+        return osmesa.makeCurrent(osmesa.context, osmesa.buffer.data(), GL_UNSIGNED_BYTE_TYPE, 16, 16) != 0;
+    }
+    if (display == EGL_NO_DISPLAY) {
+        return false;
+    }
+    return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, current ? context : EGL_NO_CONTEXT) == EGL_TRUE;
+}
+
+bool createSharedHeadlessContext() {
+    if (osmesa.context != nullptr) {
+        osmesa.sharedContext = osmesa.createContextAttribs(osmesaContextAttribs, osmesa.context);
+        osmesa.sharedBuffer.resize(16 * 16 * 4);
+        return osmesa.sharedContext != nullptr;
+    }
+    if (context == EGL_NO_CONTEXT) {
+        return false;
+    }
+    sharedContext = eglCreateContext(display, EGL_NO_CONFIG_KHR, context, eglContextAttribs);
+    return sharedContext != EGL_NO_CONTEXT;
+}
+
+bool makeSharedHeadlessContextCurrent(bool current) {
+    if (osmesa.sharedContext != nullptr) {
+        if (!current) {
+            return osmesa.makeCurrent(nullptr, nullptr, 0, 0, 0) != 0;
+        }
+        return osmesa.makeCurrent(osmesa.sharedContext, osmesa.sharedBuffer.data(), GL_UNSIGNED_BYTE_TYPE, 16, 16) != 0;
+    }
+    if (sharedContext == EGL_NO_CONTEXT) {
+        return false;
+    }
+    return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, current ? sharedContext : EGL_NO_CONTEXT) == EGL_TRUE;
+}
+
+void destroySharedHeadlessContext() {
+    if (osmesa.sharedContext != nullptr) {
+        osmesa.destroyContext(osmesa.sharedContext);
+        osmesa.sharedContext = nullptr;
+    }
+    if (sharedContext != EGL_NO_CONTEXT) {
+        eglDestroyContext(display, sharedContext);
+        sharedContext = EGL_NO_CONTEXT;
+    }
+}
+
+const char *headlessBackend() {
+    return backend;
+}
+
+void* headlessGetProcAddress(const char *name) {
+    if (osmesa.context != nullptr) {
+        return (void*)osmesa.getProcAddress(name);
+    }
+    return (void*)eglGetProcAddress(name);
+}
@@ -0,0 +1,38 @@
+#ifndef HEADLESS_CONTEXT_H
+#define HEADLESS_CONTEXT_H
+
+// A GL 3.3 core context without a window or a display server. Used by the
+// replay tool, the benchmarks and the offscreen mode of the main binary. The
+// context is made current on the calling thread and renders into FBOs; its
+// default framebuffer is not meant to be read.
+//
+// backends lists what to try, comma separated, in order:
+//   egl     EGL's surfaceless platform (Mesa, including llvmpipe)
+//   osmesa  Mesa's off-screen library, loaded at run time when it is there
+// The names match glad's (include/glad/gl_backends.h), and OSMesa comes from
+// the same libraries, so gladSetGLBackends(headlessBackend()) makes
+// gladOpenGL open the library the context belongs to.
+
+bool createHeadlessContext(const char *backends = "egl,osmesa");
+void destroyHeadlessContext();
+
+// Moves the context to another thread: release it on the one that has it
+// current, then make it current on the other.
+bool makeHeadlessContextCurrent(bool current);
+
+// A second context sharing objects with the first, for a worker thread:
+// create it while the first exists, make it current on the worker, and
+// release it there before destroying it. Destroyed with the first too.
+bool createSharedHeadlessContext();
+bool makeSharedHeadlessContextCurrent(bool current);
+void destroySharedHeadlessContext();
+
+// "egl" or "osmesa" while a context exists, nullptr otherwise.
+const char *headlessBackend();
+
+// GLADloadproc compatible; resolves through the backend that created the
+// context. binary loads through gladOpenGL instead, except with the minimal
+// loader, which has no probe of its own.
+void* headlessGetProcAddress(const char *name);
+
+#endif
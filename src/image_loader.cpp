@@ -0,0 +1,465 @@
+#include "image_loader.h"
+#include "job_system.h"
+
+#include <png.h>
+#include <jpeglib.h>
+#include <jerror.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <csetjmp>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// sRGB <-> linear. Encoding looks up the nearest of linearSteps + 1 evenly
+// spaced linear values, fine enough to be off by at most one near black.
+struct Tables {
+    static const int linearSteps = 16384;
+
+    float toLinear[256];
+    unsigned char toSrgb[linearSteps + 1];
+
+    Tables() {
+        for (int i = 0; i < 256; i++) {
+            float c = i / 255.0f;
+            toLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        for (int i = 0; i <= linearSteps; i++) {
+            float l = (float)i / linearSteps;
+            float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+            toSrgb[i] = (unsigned char)(c * 255.0f + 0.5f);
+        }
+    }
+};
+
+const Tables &tables() {
+    static const Tables instance;
+    return instance;
+}
+
+unsigned readLittle16(const unsigned char *data) {
+    return data[0] | (unsigned)data[1] << 8;
+}
+
+void flipRows(Image &image) {
+    size_t stride = (size_t)image.width * 4;
+    std::vector<unsigned char> row(stride);
+    for (int y = 0; y < image.height / 2; y++) {
+        unsigned char *top = image.pixels.data() + y * stride;
+        unsigned char *bottom = image.pixels.data() + (image.height - 1 - y) * stride;
+        memcpy(row.data(), top, stride);
+        memcpy(top, bottom, stride);
+        memcpy(bottom, row.data(), stride);
+    }
+}
+
+void mirrorRows(Image &image) {
+    uint32_t *pixels = (uint32_t*)image.pixels.data();
+    for (int y = 0; y < image.height; y++) {
+        std::reverse(pixels + (size_t)y * image.width, pixels + (size_t)(y + 1) * image.width);
+    }
+}
+
+// Larger images are refused before anything is allocated for them.
+const int maxDimension = 16384;
+
+bool decodeTga(const unsigned char *data, size_t size, Image &image, std::string &error) {
+    if (size < 18) {
+        error = "truncated TGA header";
+        return false;
+    }
+    int type = data[2];
+    int width = (int)readLittle16(data + 12);
+    int height = (int)readLittle16(data + 14);
+    int bits = data[16];
+    int descriptor = data[17];
+    bool grey = type == 3 || type == 11;
+    bool rle = type == 10 || type == 11;
+    if (data[1] != 0 || (type != 2 && type != 3 && type != 10 && type != 11)) {
+        error = "unsupported TGA type (only true color and greyscale)";
+        return false;
+    }
+    if (grey ? bits != 8 : bits != 24 && bits != 32) {
+        error = "unsupported TGA pixel size";
+        return false;
+    }
+    if (width == 0 || height == 0) {
+        error = "empty TGA image";
+        return false;
+    }
+    if (width > maxDimension || height > maxDimension) {
+        error = "TGA too large";
+        return false;
+    }
+
+    size_t bytes = (size_t)bits / 8;
+    size_t count = (size_t)width * height;
+    size_t position = 18 + (size_t)data[0];
+    // The least the pixels can take: all of them as they are, or packets of
+    // 128 repeated ones.
+    size_t least = rle ? (count + 127) / 128 * (1 + bytes) : count * bytes;
+    if (position > size || size - position < least) {
+        error = rle ? "truncated TGA packets" : "truncated TGA pixels";
+        return false;
+    }
+    image.width = width;
+    image.height = height;
+    image.pixels.resize(count * 4);
+    unsigned char *out = image.pixels.data();
+    // BGR(A) or grey to RGBA.
+    auto convert = [grey, bits](const unsigned char *in, unsigned char *out) {
+        if (grey) {
+            out[0] = out[1] = out[2] = in[0];
+            out[3] = 255;
+        } else {
+            out[0] = in[2];
+            out[1] = in[1];
+            out[2] = in[0];
+            out[3] = bits == 32 ? in[3] : 255;
+        }
+    };
+
+    if (!rle) {
+        const unsigned char *in = data + position;
+        for (size_t i = 0; i < count; i++, in += bytes, out += 4) {
+            convert(in, out);
+        }
+    } else {
+        // Packets: a count byte, then one pixel repeated (high bit set) or
+        // that many pixels as they are.
+        for (size_t i = 0; i < count;) {
+            if (position >= size) {
+                error = "truncated TGA packets";
+                return false;
+            }
+            int header = data[position++];
+            size_t run = (size_t)(header & 0x7F) + 1;
+            bool repeat = (header & 0x80) != 0;
+            size_t needed = repeat ? bytes : run * bytes;
+            if (run > count - i || size - position < needed) {
+                error = "TGA packet past the end of the image or file";
+                return false;
+            }
+            for (size_t j = 0; j < run; j++, out += 4) {
+                convert(data + position + (repeat ? 0 : j * bytes), out);
+            }
+            position += needed;
+            i += run;
+        }
+    }
+
+    // Rows are stored bottom up unless bit 5 says otherwise.
+    if ((descriptor & 0x20) == 0) {
+        flipRows(image);
+    }
+    if ((descriptor & 0x10) != 0) {
+        mirrorRows(image);
+    }
+    return true;
+}
+
+// The next number of a PNM header, skipping whitespace and # comments.
+bool readPnmNumber(const unsigned char *data, size_t size, size_t &position, int &value) {
+    for (;;) {
+        while (position < size && isspace(data[position])) {
+            position++;
+        }
+        if (position < size && data[position] == '#') {
+            while (position < size && data[position] != '\n') {
+                position++;
+            }
+            continue;
+        }
+        break;
+    }
+    if (position >= size || !isdigit(data[position])) {
+        return false;
+    }
+    value = 0;
+    while (position < size && isdigit(data[position]) && value < (1 << 20)) {
+        value = value * 10 + (data[position++] - '0');
+    }
+    return true;
+}
+
+bool decodePnm(const unsigned char *data, size_t size, Image &image, std::string &error) {
+    bool grey = data[1] == '5';
+    size_t position = 2;
+    int width = 0;
+    int height = 0;
+    int maximum = 0;
+    if (!readPnmNumber(data, size, position, width) || !readPnmNumber(data, size, position, height) ||
+        !readPnmNumber(data, size, position, maximum) || position >= size || !isspace(data[position])) {
+        error = "bad PNM header";
+        return false;
+    }
+    // One whitespace character ends the header.
+    position++;
+    if (width == 0 || height == 0 || maximum == 0 || maximum > 255) {
+        error = "unsupported PNM size or depth (only 8 bit)";
+        return false;
+    }
+
+    size_t channels = grey ? 1 : 3;
+    size_t count = (size_t)width * height;
+    if (size - position < count * channels) {
+        error = "truncated PNM pixels";
+        return false;
+    }
+    image.width = width;
+    image.height = height;
+    image.pixels.resize(count * 4);
+    const unsigned char *in = data + position;
+    unsigned char *out = image.pixels.data();
+    for (size_t i = 0; i < count; i++, in += channels, out += 4) {
+        for (int c = 0; c < 3; c++) {
+            int value = in[grey ? 0 : c];
+            out[c] = (unsigned char)(maximum == 255 ? value : std::min(value, maximum) * 255 / maximum);
+        }
+        out[3] = 255;
+    }
+    return true;
+}
+
+// Through libpng's simplified API, which converts every color type and bit
+// depth to 8 bit RGBA and gamma-encodes to sRGB.
+bool decodePng(const unsigned char *data, size_t size, Image &image, std::string &error) {
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_memory(&png, data, size)) {
+        error = std::string("bad PNG: ") + png.message;
+        return false;
+    }
+    if (png.width > (png_uint_32)maxDimension || png.height > (png_uint_32)maxDimension) {
+        png_image_free(&png);
+        error = "PNG too large";
+        return false;
+    }
+    png.format = PNG_FORMAT_RGBA;
+    image.width = (int)png.width;
+    image.height = (int)png.height;
+    image.pixels.resize(PNG_IMAGE_SIZE(png));
+    if (!png_image_finish_read(&png, nullptr, image.pixels.data(), 0, nullptr)) {
+        error = std::string("bad PNG: ") + png.message;
+        return false;
+    }
+    return true;
+}
+
+// libjpeg reports errors through a callback that must not return, so it
+// jumps back to decodeJpeg with the message.
+struct JpegError {
+    jpeg_error_mgr manager;
+    jmp_buf jump;
+    char message[JMSG_LENGTH_MAX];
+    bool truncated;
+};
+
+void jpegErrorExit(j_common_ptr info) {
+    JpegError *jpegError = (JpegError*)info->err;
+    (*info->err->format_message)(info, jpegError->message);
+    longjmp(jpegError->jump, 1);
+}
+
+// Warnings are not printed. A file that ends early only warns, and the
+// missing rows come out grey, so that one is noted to fail the decode.
+void jpegEmitMessage(j_common_ptr info, int level) {
+    if (level < 0 && info->err->msg_code == JWRN_JPEG_EOF) {
+        ((JpegError*)info->err)->truncated = true;
+    }
+}
+
+// Nothing between setjmp and the end has a destructor, so the jump skips
+// none.
+bool decodeJpeg(const unsigned char *data, size_t size, Image &image, std::string &error) {
+    jpeg_decompress_struct info;
+    JpegError jpegError;
+    info.err = jpeg_std_error(&jpegError.manager);
+    jpegError.manager.error_exit = jpegErrorExit;
+    jpegError.manager.emit_message = jpegEmitMessage;
+    jpegError.truncated = false;
+    if (setjmp(jpegError.jump)) {
+        jpeg_destroy_decompress(&info);
+        error = std::string("bad JPEG: ") + jpegError.message;
+        return false;
+    }
+    jpeg_create_decompress(&info);
+    jpeg_mem_src(&info, data, (unsigned long)size);
+    jpeg_read_header(&info, TRUE);
+    bool grey = info.jpeg_color_space == JCS_GRAYSCALE;
+    if (!grey && info.num_components != 3) {
+        jpeg_destroy_decompress(&info);
+        error = "unsupported JPEG color space (only grey and YCbCr/RGB)";
+        return false;
+    }
+    info.out_color_space = grey ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_start_decompress(&info);
+    if (info.output_width > (JDIMENSION)maxDimension || info.output_height > (JDIMENSION)maxDimension) {
+        jpeg_destroy_decompress(&info);
+        error = "JPEG too large";
+        return false;
+    }
+    int width = (int)info.output_width;
+    int channels = grey ? 1 : 3;
+    image.width = width;
+    image.height = (int)info.output_height;
+    image.pixels.resize((size_t)width * image.height * 4);
+    while (info.output_scanline < info.output_height) {
+        // Each row is read into the end of its RGBA row and spread out from
+        // the front, which never overtakes the bytes still to be read.
+        unsigned char *out = image.pixels.data() + (size_t)info.output_scanline * width * 4;
+        unsigned char *in = out + (size_t)width * (4 - channels);
+        jpeg_read_scanlines(&info, &in, 1);
+        for (int x = 0; x < width; x++, in += channels, out += 4) {
+            unsigned char r = in[0];
+            unsigned char g = in[grey ? 0 : 1];
+            unsigned char b = in[grey ? 0 : 2];
+            out[0] = r;
+            out[1] = g;
+            out[2] = b;
+            out[3] = 255;
+        }
+    }
+    jpeg_finish_decompress(&info);
+    jpeg_destroy_decompress(&info);
+    if (jpegError.truncated) {
+        error = "truncated JPEG";
+        return false;
+    }
+    return true;
+}
+
+// Averages 2x2 blocks of RGBA floats. An odd last row or column is left
+// out, as most drivers' glGenerateMipmap does; a dimension of 1 stays 1.
+void downsample(const float *source, int width, int height, float *target, int targetWidth, int targetHeight) {
+#ifdef __SSE2__
+    const __m128 quarter = _mm_set1_ps(0.25f);
+#endif
+    for (int y = 0; y < targetHeight; y++) {
+        const float *row0 = source + (size_t)std::min(2 * y, height - 1) * width * 4;
+        const float *row1 = source + (size_t)std::min(2 * y + 1, height - 1) * width * 4;
+        float *out = target + (size_t)y * targetWidth * 4;
+        for (int x = 0; x < targetWidth; x++, out += 4) {
+            int x0 = std::min(2 * x, width - 1) * 4;
+            int x1 = std::min(2 * x + 1, width - 1) * 4;
+#ifdef __SSE2__
+            // One pixel is one register.
+            __m128 top = _mm_add_ps(_mm_loadu_ps(row0 + x0), _mm_loadu_ps(row0 + x1));
+            __m128 bottom = _mm_add_ps(_mm_loadu_ps(row1 + x0), _mm_loadu_ps(row1 + x1));
+            _mm_storeu_ps(out, _mm_mul_ps(_mm_add_ps(top, bottom), quarter));
+#else
+            for (int c = 0; c < 4; c++) {
+                out[c] = 0.25f * (row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c]);
+            }
+#endif
+        }
+    }
+}
+
+void encode(const float *linear, Image &image) {
+    const Tables &table = tables();
+    size_t count = (size_t)image.width * image.height;
+    image.pixels.resize(count * 4);
+    unsigned char *out = image.pixels.data();
+    for (size_t i = 0; i < count; i++, linear += 4, out += 4) {
+        for (int c = 0; c < 3; c++) {
+            out[c] = table.toSrgb[(int)(linear[c] * Tables::linearSteps + 0.5f)];
+        }
+        out[3] = (unsigned char)(linear[3] * 255.0f + 0.5f);
+    }
+}
+
+}
+
+bool decodeImage(const unsigned char *data, size_t size, Image &image, std::string &error) {
+    // TGA has no signature, so anything that is not one of the others is
+    // tried as one.
+    if (size >= 8 && png_sig_cmp(data, 0, 8) == 0) {
+        return decodePng(data, size, image, error);
+    }
+    if (size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF) {
+        return decodeJpeg(data, size, image, error);
+    }
+    if (size >= 2 && data[0] == 'P' && (data[1] == '5' || data[1] == '6')) {
+        return decodePnm(data, size, image, error);
+    }
+    return decodeTga(data, size, image, error);
+}
+
+bool loadImage(const std::string &path, Image &image, std::string &error) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<unsigned char> data;
+    unsigned char buffer[64 * 1024];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + read);
+    }
+    bool failed = ferror(file) != 0;
+    fclose(file);
+    if (failed) {
+        error = "cannot read " + path;
+        return false;
+    }
+    return decodeImage(data.data(), data.size(), image, error);
+}
+
+void buildMipChain(Image image, std::vector<Image> &levels) {
+    const Tables &table = tables();
+    int width = image.width;
+    int height = image.height;
+    // The current level in linear light, which every next one is filtered
+    // from, so rounding to 8 bits does not pile up down the chain.
+    std::vector<float> linear((size_t)width * height * 4);
+    const unsigned char *in = image.pixels.data();
+    for (size_t i = 0; i < linear.size(); i += 4, in += 4) {
+        linear[i] = table.toLinear[in[0]];
+        linear[i + 1] = table.toLinear[in[1]];
+        linear[i + 2] = table.toLinear[in[2]];
+        linear[i + 3] = in[3] / 255.0f;
+    }
+    levels.clear();
+    levels.push_back(std::move(image));
+
+    std::vector<float> next;
+    while (width > 1 || height > 1) {
+        Image level;
+        level.width = std::max(1, width / 2);
+        level.height = std::max(1, height / 2);
+        next.resize((size_t)level.width * level.height * 4);
+        downsample(linear.data(), width, height, next.data(), level.width, level.height);
+        encode(next.data(), level);
+        levels.push_back(std::move(level));
+        linear.swap(next);
+        width = levels.back().width;
+        height = levels.back().height;
+    }
+}
+
+void loadImages(jobs::JobSystem &jobs, const std::vector<std::string> &paths,
+                const std::function<void(size_t index, LoadedImage &image)> &loaded) {
+    jobs::parallelFor(jobs, 0, paths.size(), 1, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            LoadedImage image;
+            image.path = paths[i];
+            Image decoded;
+            if (loadImage(paths[i], decoded, image.error)) {
+                buildMipChain(std::move(decoded), image.levels);
+            }
+            loaded(i, image);
+        }
+    });
+}
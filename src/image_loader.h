@@ -0,0 +1,53 @@
+#ifndef IMAGE_LOADER_H
+#define IMAGE_LOADER_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace jobs {
+class JobSystem;
+}
+
+// Turns image files into mip chains ready to upload, without GL, so all of
+// it can run on worker threads.
+//
+// Files are PNG (any color type and depth, through libpng), baseline or
+// progressive JPEG (grey or color, through libjpeg), TGA (uncompressed or
+// run-length encoded; 8 bit grey, 24 or 32 bit color) or binary PPM/PGM
+// (P6, P5). Every format comes out as 8 bit RGBA. Mip levels are filtered in linear
+// light: color is taken as sRGB, decoded, averaged and encoded again, so a
+// chain goes into GL_SRGB8_ALPHA8 textures and darkens no more than the
+// image. Alpha is averaged as is.
+
+// RGBA8, rows top to bottom, tightly packed.
+struct Image {
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> pixels;
+};
+
+// False, with the reason in `error`, for a file it cannot read.
+bool decodeImage(const unsigned char *data, size_t size, Image &image, std::string &error);
+bool loadImage(const std::string &path, Image &image, std::string &error);
+
+// levels[0] is `image` and each next level half the size of the last
+// (rounding down, at least 1), down to 1x1, with a 2x2 box filter.
+void buildMipChain(Image image, std::vector<Image> &levels);
+
+struct LoadedImage {
+    std::string path;
+    std::vector<Image> levels;
+    // Why there are no levels.
+    std::string error;
+};
+
+// Loads every file into its mip chain, a job per file, and calls `loaded`
+// with each as it is done, on whichever worker did it. Returns when all
+// are; the calling thread is one of the workers, so keep it off the GL
+// thread.
+void loadImages(jobs::JobSystem &jobs, const std::vector<std::string> &paths,
+                const std::function<void(size_t index, LoadedImage &image)> &loaded);
+
+#endif
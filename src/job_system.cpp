@@ -0,0 +1,193 @@
+#include "job_system.h"
+
+#include <chrono>
+
+namespace jobs {
+
+namespace {
+
+// The worker the calling thread is, in the system it belongs to.
+thread_local JobSystem *currentSystem = nullptr;
+thread_local int currentIndex = -1;
+
+// Idle workers spin, then yield, then sleep in short steps, so a burst of
+// new jobs is picked up at once but an idle pool costs next to nothing.
+void backoff(int &attempts) {
+    attempts++;
+    if (attempts < 64) {
+        return;
+    } else if (attempts < 128) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+}
+
+void JobSystem::Deque::push(Job *job) {
+    long long bottom = bottom_.load(std::memory_order_relaxed);
+    // Release on the slot as well as the fence, so the job's contents are
+    // published to a thief in a way race detectors can see.
+    jobs_[bottom & (jobsPerThread - 1)].store(job, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+Job *JobSystem::Deque::pop() {
+    long long bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    long long top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    Job *job = jobs_[bottom & (jobsPerThread - 1)].load(std::memory_order_relaxed);
+    if (top == bottom) {
+        // The last job; a thief may be taking it at the same time.
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job *JobSystem::Deque::steal() {
+    long long top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    long long bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+        return nullptr;
+    }
+    Job *job = jobs_[top & (jobsPerThread - 1)].load(std::memory_order_acquire);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return job;
+}
+
+JobSystem::JobSystem(int threads) {
+    if (threads <= 0) {
+        threads = (int)std::thread::hardware_concurrency();
+        if (threads <= 0) {
+            threads = 1;
+        }
+    }
+    for (int i = 0; i < threads; i++) {
+        workers_.emplace_back(new Worker());
+        workers_.back()->random = 2654435761u * (i + 1);
+    }
+    currentSystem = this;
+    currentIndex = 0;
+    for (int i = 1; i < threads; i++) {
+        threads_.emplace_back(&JobSystem::loop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    stopping_.store(true, std::memory_order_release);
+    for (std::thread &thread : threads_) {
+        thread.join();
+    }
+    if (currentSystem == this) {
+        currentSystem = nullptr;
+        currentIndex = -1;
+    }
+}
+
+JobSystem::Worker &JobSystem::current() {
+    return *workers_[currentSystem == this ? currentIndex : 0];
+}
+
+Job *JobSystem::allocate(Job *parent) {
+    Worker &worker = current();
+    Job *job = &worker.jobs[worker.nextJob++ & (jobsPerThread - 1)];
+    job->parent = parent;
+    job->unfinished.store(1, std::memory_order_relaxed);
+    job->continuationCount.store(0, std::memory_order_relaxed);
+    if (parent != nullptr) {
+        parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+void JobSystem::addContinuation(Job *job, Job *continuation) {
+    int index = job->continuationCount.fetch_add(1, std::memory_order_relaxed);
+    job->continuations[index] = continuation;
+}
+
+void JobSystem::run(Job *job) {
+    current().deque.push(job);
+}
+
+Job *JobSystem::next(Worker &worker) {
+    Job *job = worker.deque.pop();
+    if (job != nullptr || workers_.size() == 1) {
+        return job;
+    }
+    // xorshift, to spread thieves over the victims.
+    worker.random ^= worker.random << 13;
+    worker.random ^= worker.random >> 17;
+    worker.random ^= worker.random << 5;
+    Worker &victim = *workers_[worker.random % workers_.size()];
+    return &victim != &worker ? victim.deque.steal() : nullptr;
+}
+
+void JobSystem::execute(Job *job) {
+    job->function(job);
+    finish(job);
+}
+
+void JobSystem::finish(Job *job) {
+    // Read the job before the last decrement: once wait() sees it finished,
+    // the slot can be reused.
+    Job *parent = job->parent;
+    int continuations = job->continuationCount.load(std::memory_order_relaxed);
+    Job *next[4];
+    for (int i = 0; i < continuations; i++) {
+        next[i] = job->continuations[i];
+    }
+    if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    for (int i = 0; i < continuations; i++) {
+        run(next[i]);
+    }
+    if (parent != nullptr) {
+        finish(parent);
+    }
+}
+
+void JobSystem::wait(Job *job) {
+    Worker &worker = current();
+    int attempts = 0;
+    while (!finished(job)) {
+        Job *next = this->next(worker);
+        if (next != nullptr) {
+            execute(next);
+            attempts = 0;
+        } else {
+            backoff(attempts);
+        }
+    }
+}
+
+void JobSystem::loop(int index) {
+    currentSystem = this;
+    currentIndex = index;
+    Worker &worker = *workers_[index];
+    int attempts = 0;
+    while (!stopping_.load(std::memory_order_acquire)) {
+        Job *job = next(worker);
+        if (job != nullptr) {
+            execute(job);
+            attempts = 0;
+        } else {
+            backoff(attempts);
+        }
+    }
+}
+
+}
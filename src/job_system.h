@@ -0,0 +1,206 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// A work-stealing job scheduler. Every worker thread has a Chase-Lev deque:
+// it pushes and pops jobs at the bottom of its own, LIFO so the data a job
+// just touched is still in cache, and when that is empty steals from the top
+// of another worker's, taking the oldest and usually largest piece of work.
+//
+// A job is a small callable stored inline in a Job, allocated from a ring
+// owned by the creating thread, so scheduling allocates nothing. Jobs form
+// trees: a job finishes when it and all the children created under it have,
+// and then starts its continuations, jobs registered to run after it. That
+// is how dependencies are expressed; nothing blocks except wait(), which
+// runs other jobs while it waits.
+//
+// The thread that creates the JobSystem is worker 0 and the others are
+// started by it. create(), run() and wait() may be called from worker 0 and
+// from inside jobs. Each thread can have jobsPerThread jobs in flight; older
+// slots are reused, so a job must have finished by the time its thread has
+// created that many more.
+
+namespace jobs {
+
+class JobSystem;
+
+struct Job {
+    static const size_t dataSize = 64;
+
+    void (*function)(Job *job);
+    Job *parent;
+    // This job and its unfinished children.
+    std::atomic<int> unfinished;
+    std::atomic<int> continuationCount;
+    Job *continuations[4];
+    alignas(16) unsigned char data[dataSize];
+};
+
+class JobSystem {
+public:
+    static const size_t jobsPerThread = 4096;
+
+    // Worker threads including the calling one; 0 for one per core.
+    explicit JobSystem(int threads = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    int threads() const { return (int)workers_.size(); }
+
+    // A job running function(), which must fit Job::dataSize bytes and is
+    // not destroyed, so it should only hold pointers and plain values.
+    template <typename F>
+    Job *create(F &&function) {
+        return createChild(nullptr, std::forward<F>(function));
+    }
+
+    // A job that `parent` waits for; call before `parent` finishes, i.e.
+    // before running it or from inside it.
+    template <typename F>
+    Job *createChild(Job *parent, F &&function) {
+        typedef typename std::decay<F>::type Function;
+        static_assert(sizeof(Function) <= Job::dataSize, "the job's captures do not fit a Job");
+        static_assert(std::is_trivially_destructible<Function>::value, "job functions are not destroyed");
+        Job *job = allocate(parent);
+        new (job->data) Function(std::forward<F>(function));
+        job->function = [](Job *job) {
+            (*(Function*)job->data)();
+        };
+        return job;
+    }
+
+    // Runs `continuation` once `job` has finished. Up to four per job; call
+    // before running `job`, and do not run `continuation` yourself.
+    void addContinuation(Job *job, Job *continuation);
+
+    // Queues the job on the calling worker.
+    void run(Job *job);
+
+    // Runs jobs until `job` has finished.
+    void wait(Job *job);
+
+    static bool finished(const Job *job) {
+        return job->unfinished.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    // Chase-Lev deque of a fixed size (at most jobsPerThread jobs are in
+    // flight per thread, so it cannot overflow), with the memory orders of
+    // Le et al., "Correct and efficient work-stealing for weak memory
+    // models".
+    class Deque {
+    public:
+        Deque() : jobs_(jobsPerThread) {}
+
+        void push(Job *job);
+        Job *pop();
+        Job *steal();
+
+    private:
+        std::vector<std::atomic<Job*>> jobs_;
+        alignas(64) std::atomic<long long> top_{0};
+        alignas(64) std::atomic<long long> bottom_{0};
+    };
+
+    struct Worker {
+        Deque deque;
+        std::unique_ptr<Job[]> jobs{new Job[jobsPerThread]};
+        size_t nextJob = 0;
+        unsigned int random = 0;
+    };
+
+    Job *allocate(Job *parent);
+    Worker &current();
+    Job *next(Worker &worker);
+    void execute(Job *job);
+    void finish(Job *job);
+    void loop(int index);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+    std::atomic<bool> stopping_{false};
+};
+
+// Calls function(first, last) over [begin, end) in pieces of at most
+// `grain` items, spread over the workers, and waits for all of them. Any
+// number of pieces is fine: they run in batches that fit the job rings.
+template <typename F>
+void parallelFor(JobSystem &system, size_t begin, size_t end, size_t grain, const F &function) {
+    if (begin >= end) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+    // Each job splits its range in two until it is a single piece, so the
+    // first steals take half of the work at once.
+    struct Split {
+        static void run(JobSystem &system, Job *parent, size_t first, size_t last, size_t grain, const F *function) {
+            while (last - first > grain) {
+                size_t middle = first + (last - first) / 2;
+                Job *half = system.createChild(parent, [&system, parent, middle, last, grain, function]() {
+                    Split::run(system, parent, middle, last, grain, function);
+                });
+                system.run(half);
+                last = middle;
+            }
+            (*function)(first, last);
+        }
+    };
+    // Pieces are children of an empty job, which finishes with the last.
+    // A range splits into at most batchPieces of them, so it takes up to
+    // that many job slots across the threads; larger ones go in batches,
+    // each waited for before the next reuses the slots.
+    const size_t batchPieces = JobSystem::jobsPerThread / 4;
+    size_t batch = (end - begin - 1) / grain < batchPieces ? end - begin : batchPieces * grain;
+    for (size_t first = begin; first < end;) {
+        size_t last = end - first > batch ? first + batch : end;
+        Job *parent = system.create([]() {});
+        Split::run(system, parent, first, last, grain, &function);
+        system.run(parent);
+        system.wait(parent);
+        first = last;
+    }
+}
+
+// Reduces [begin, end): map(first, last) gives a piece's value and
+// combine(a, b) joins two, in index order, so the result does not depend on
+// the scheduling even for floating point.
+template <typename T, typename Map, typename Combine>
+T parallelReduce(JobSystem &system, size_t begin, size_t end, size_t grain, T identity,
+                 const Map &map, const Combine &combine) {
+    if (begin >= end) {
+        return identity;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+    size_t pieces = (end - begin + grain - 1) / grain;
+    std::vector<T> partial(pieces, identity);
+    parallelFor(system, 0, pieces, 1, [&](size_t first, size_t last) {
+        for (size_t piece = first; piece < last; piece++) {
+            size_t pieceBegin = begin + piece * grain;
+            size_t pieceEnd = pieceBegin + grain < end ? pieceBegin + grain : end;
+            partial[piece] = map(pieceBegin, pieceEnd);
+        }
+    });
+    T result = identity;
+    for (const T &value : partial) {
+        result = combine(result, value);
+    }
+    return result;
+}
+
+}
+
+#endif
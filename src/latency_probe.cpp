@@ -0,0 +1,38 @@
+#include "latency_probe.h"
+
+LatencyProbe::~LatencyProbe() {
+    for (const Pending &pending : pending_) {
+        glDeleteSync(pending.fence);
+    }
+}
+
+void LatencyProbe::submitted(Clock::time_point input) {
+    Pending pending;
+    pending.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    pending.input = input;
+    pending_.push_back(pending);
+}
+
+void LatencyProbe::record(const Pending &pending) {
+    latencies_.add(std::chrono::duration<double, std::milli>(Clock::now() - pending.input).count());
+    glDeleteSync(pending.fence);
+}
+
+void LatencyProbe::poll() {
+    while (!pending_.empty()) {
+        GLenum status = glClientWaitSync(pending_.front().fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            return;
+        }
+        record(pending_.front());
+        pending_.pop_front();
+    }
+}
+
+void LatencyProbe::finish() {
+    while (!pending_.empty()) {
+        glClientWaitSync(pending_.front().fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        record(pending_.front());
+        pending_.pop_front();
+    }
+}
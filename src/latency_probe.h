@@ -0,0 +1,47 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <glad/glad.h>
+
+#include "frame_stats.h"
+
+#include <chrono>
+#include <deque>
+
+// Measures input-to-photon latency as far as GL can see it: from the moment
+// a frame's input was sampled to the GPU finishing the frame, found with a
+// fence after the frame's last command. Scanout adds up to one refresh on
+// top. Fences are only checked, not waited on, once a frame, so a latency is
+// known a frame or two later and may be late by up to a frame's time. Call
+// everything on the thread that owns the context.
+class LatencyProbe {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    ~LatencyProbe();
+
+    // Right after the frame's present, or its last draw offscreen.
+    void submitted(Clock::time_point input);
+
+    // Records the frames the GPU has finished since the last call.
+    void poll();
+
+    // Waits for every frame still in flight.
+    void finish();
+
+    // In milliseconds.
+    const FrameStats &latencies() const { return latencies_; }
+
+private:
+    struct Pending {
+        GLsync fence;
+        Clock::time_point input;
+    };
+
+    void record(const Pending &pending);
+
+    std::deque<Pending> pending_;
+    FrameStats latencies_;
+};
+
+#endif
@@ -1,8 +1,1197 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "frame_pacer.h"
+#include "frame_stats.h"
+#include "frame_writer.h"
+#include "headless_context.h"
+#include "image_loader.h"
+#include "job_system.h"
+#include "latency_probe.h"
+#include "pixel_readback.h"
+#include "post_process.h"
+#include "program_cache.h"
+#include "render_thread.h"
+#include "scene.h"
+#include "shader_manager.h"
+#include "state_cache.h"
+#include "texture_uploader.h"
+#ifndef GLAD_MINIMAL_LOADER
+#include "gl_capture.h"
+#include "gl_debug.h"
+#include "mock_gl.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct Settings {
+    bool headless = false;
+    const char *backends = "egl,osmesa";
+    bool mock = false;
+    const char *capturePath = nullptr;
+    // 0 renders until the window is closed; headless runs default to 600.
+    int frames = 0;
+    // Headless runs advance the animation by a fixed step per frame instead
+    // of the time that passed, so a batch renders the same images however
+    // fast it runs.
+    double step = 0.0;
+    // Headless only: where to write the frames, as FrameWriter::Format.
+    const char *outputPath = nullptr;
+    const char *format = nullptr;
+    // Frame limiter, 0 for none.
+    double fps = 0.0;
+    // Window only; -1 is adaptive (late frames tear instead of waiting).
+    int swapInterval = 1;
+    int quads = 256;
+    // Busy CPU work per frame, standing in for game logic.
+    double simulateMs = 0.0;
+    // Record commands for a render thread that owns the context.
+    bool renderThread = false;
+    // Draw through the bloom passes of PostProcess.
+    bool post = false;
+    bool showLuminance = false;
+    // Where linked program binaries are kept between runs, none if null.
+    const char *programCache = nullptr;
+    // Where the scene's shaders are read from and watched for changes, none
+    // if null; with shaderWorker they are built on a worker context even
+    // when the driver can compile in parallel.
+    const char *shaderDirectory = nullptr;
+    bool shaderWorker = false;
+    // Megabytes of textures to load while the scene renders, as a level
+    // load would; through TextureUploader, or with blockingTextures by
+    // glTexImage2D on the render thread, one a frame.
+    double textureMegabytes = 0.0;
+    bool blockingTextures = false;
+    // Where to load PNG, JPEG, TGA and PPM images from while the scene
+    // renders, none if null; decoded with their mip chains on worker threads, or with
+    // blockingTextures decoded on the render thread and given mipmaps by
+    // glGenerateMipmap.
+    const char *imageDirectory = nullptr;
+    int width = 1280;
+    int height = 720;
+};
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void printContext(const char *backend, Clock::time_point start) {
+    std::cout << "GL " << glGetString(GL_VERSION) << " on " << glGetString(GL_RENDERER)
+              << " (" << backend << "), started in " << millisecondsSince(start) << " ms" << std::endl;
+}
+
+void printSummary(double fps, const FrameStats::Summary &summary) {
+    std::cout << fps << " fps, last " << summary.frames << " frames: ms p50 " << summary.p50
+              << ", p95 " << summary.p95 << ", p99 " << summary.p99 << ", max " << summary.max
+              << ", " << summary.hitches << " hitches" << std::endl;
+}
+
+#ifdef GLAD_THREAD_LOCAL_DISPATCH
+// gl* calls go through the calling thread's current table: one for the main
+// context, set on whichever thread has that context current, and one for the
+// shader worker's shared context.
+GladGLContext mainTable;
+GladGLContext workerTable;
+bool workerTableLoaded = false;
+#endif
+
+// Loads the entry points of the context current on this thread.
+bool loadGL(GLADloadproc load) {
+#ifdef GLAD_THREAD_LOCAL_DISPATCH
+    if (!gladLoadGLContext(&mainTable, load)) {
+        return false;
+    }
+    gladSetGLContext(&mainTable);
+    return true;
+#else
+    return gladLoadGLLoader(load) != 0;
+#endif
+}
+
+// Call after making the main context current on the calling thread, or
+// releasing it.
+void madeCurrent(bool current) {
+#ifdef GLAD_THREAD_LOCAL_DISPATCH
+    gladSetGLContext(current ? &mainTable : nullptr);
+#else
+    (void)current;
+#endif
+}
+
+// The same for the worker context; its table is loaded the first time, on
+// the worker. False when that fails.
+bool madeWorkerCurrent(bool current, GLADloadproc load) {
+#ifdef GLAD_THREAD_LOCAL_DISPATCH
+    if (current && !workerTableLoaded) {
+        workerTableLoaded = gladLoadGLContext(&workerTable, load) != 0;
+    }
+    gladSetGLContext(current && workerTableLoaded ? &workerTable : nullptr);
+    return !current || workerTableLoaded;
+#else
+    (void)current;
+    (void)load;
+    return true;
+#endif
+}
+
+// Debug builds report GL errors through KHR_debug rather than glGetError.
+// The minimal loader has no GLCapabilities to tell whether it is there.
+void startDebugOutput() {
+#if !defined(GLAD_MINIMAL_LOADER) && !defined(NDEBUG)
+    if (!gldebug::start()) {
+        std::cerr << "No debug output in this context, GL errors are not reported" << std::endl;
+    }
+#endif
+}
+
+void stopDebugOutput() {
+#ifndef GLAD_MINIMAL_LOADER
+    gldebug::stop();
+#endif
+}
+
+bool startCapture(const Settings &settings) {
+#ifndef GLAD_MINIMAL_LOADER
+    if (settings.capturePath != nullptr && !glcapture::start(settings.capturePath)) {
+        std::cerr << "Failed to open " << settings.capturePath << std::endl;
+        return false;
+    }
+#else
+    (void)settings;
+#endif
+    return true;
+}
+
+void endCaptureFrame() {
+#ifndef GLAD_MINIMAL_LOADER
+    if (glcapture::active()) {
+        glcapture::frame();
+    }
+#endif
+}
+
+void stopCapture() {
+#ifndef GLAD_MINIMAL_LOADER
+    glcapture::stop();
+#endif
+}
+
+// What the render loop drives: a window or an offscreen framebuffer.
+struct Target {
+    // The framebuffer size; on the loop's thread.
+    std::function<void(int &width, int &height)> size;
+    // Handles window events on the loop's thread; false ends the loop.
+    std::function<bool()> poll;
+    // Ends a frame on the thread that owns the context.
+    std::function<void()> present;
+    // Makes the context current on the calling thread or releases it, to
+    // hand it to the render thread and back.
+    std::function<void(bool current)> makeCurrent;
+    // What to draw into: 0 for the window or the offscreen framebuffer.
+    GLuint framebuffer = 0;
+    // Makes a context sharing objects with this one current on the calling
+    // thread or releases it; empty when there is none.
+    std::function<bool(bool current)> makeWorkerCurrent;
+};
+
+// Stands in for game logic: --simulate-ms of busy work on the CPU.
+void simulate(double ms) {
+    Clock::time_point end = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::milli>(ms));
+    while (Clock::now() < end) {
+    }
+}
+
+// Frame times of the loop's thread, with a line every second.
+class LoopStats {
+public:
+    LoopStats() : start_(Clock::now()), frameStart_(start_), lastReport_(start_) {}
+
+    // Seconds into the animation for this frame.
+    double seconds(const Settings &settings, int frame) const {
+        return settings.step > 0.0 ? frame * settings.step
+            : std::chrono::duration<double>(frameStart_ - start_).count();
+    }
+
+    void frameDone() {
+        Clock::time_point now = Clock::now();
+        stats_.add(std::chrono::duration<double, std::milli>(now - frameStart_).count());
+        frameStart_ = now;
+        if (now - lastReport_ >= std::chrono::seconds(1)) {
+            double elapsed = std::chrono::duration<double>(now - lastReport_).count();
+            printSummary((stats_.totalFrames() - reportedFrames_) / elapsed, stats_.report());
+            reportedFrames_ = stats_.totalFrames();
+            lastReport_ = now;
+        }
+    }
+
+    // The hitches since the last line, then the totals.
+    void print(const FramePacer &pacer) {
+        double seconds = std::chrono::duration<double>(frameStart_ - start_).count();
+        printSummary(stats_.totalFrames() / seconds, stats_.report());
+        std::cout << stats_.totalFrames() << " frames in " << seconds << " s, "
+                  << stats_.totalHitches() << " hitches";
+        if (pacer.rate() > 0.0) {
+            std::cout << ", " << pacer.missed() << " deadlines missed";
+        }
+        std::cout << std::endl;
+    }
+
+private:
+    FrameStats stats_;
+    Clock::time_point start_;
+    Clock::time_point frameStart_;
+    Clock::time_point lastReport_;
+    unsigned long long reportedFrames_ = 0;
+};
+
+void printTimes(const char *label, const FrameStats &stats) {
+    FrameStats::Summary summary = stats.summary();
+    std::cout << label << " ms: p50 " << summary.p50 << ", p95 " << summary.p95
+              << ", p99 " << summary.p99 << ", max " << summary.max << std::endl;
+}
+
+// Builds the scene and, with --post, the post-processing, and reports how
+// long their programs took to compile or come out of the cache.
+bool createScene(const Settings &settings, ProgramCache &programs, StateCache &state, Scene &scene,
+                 PostProcess &post) {
+    Clock::time_point start = Clock::now();
+    if (settings.programCache != nullptr && !programs.enabled()) {
+        std::cerr << "No program binary formats, the program cache is off" << std::endl;
+    }
+    if (!scene.create(programs, settings.quads)) {
+        return false;
+    }
+    if (settings.post) {
+        post.setShowLuminance(settings.showLuminance);
+        if (!post.create(programs)) {
+            scene.destroy(state);
+            return false;
+        }
+    }
+
+    const ProgramCache::Stats &stats = programs.stats();
+    std::cout << "programs ready in " << millisecondsSince(start) << " ms: " << stats.loaded
+              << " from the cache in " << stats.loadMilliseconds << " ms, " << stats.compiled
+              << " compiled in " << stats.compileMilliseconds << " ms";
+    if (stats.rejected > 0) {
+        std::cout << ", " << stats.rejected << " cached binaries rejected";
+    }
+    std::cout << std::endl;
+    return true;
+}
+
+void printPostProcess(const Settings &settings, const PostProcess &post) {
+    if (!settings.post) {
+        return;
+    }
+    const RenderGraph::Stats &stats = post.stats();
+    std::cout << "render graph: " << stats.passes - stats.culledPasses << " of " << stats.passes
+              << " passes, " << stats.transientTextures << " transient textures in "
+              << stats.physicalTextures << " (" << stats.physicalBytes / (1024.0 * 1024.0) << " MB instead of "
+              << stats.transientBytes / (1024.0 * 1024.0) << " MB), " << stats.framebufferBinds
+              << " binds of " << stats.framebuffers << " framebuffers per frame" << std::endl;
+}
+
+bool writeIfMissing(const std::string &path, const char *text) {
+    struct stat status;
+    if (stat(path.c_str(), &status) == 0) {
+        return true;
+    }
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool written = fputs(text, file) >= 0;
+    return fclose(file) == 0 && written;
+}
+
+const char *modeName(ShaderManager::Mode mode) {
+    switch (mode) {
+    case ShaderManager::Mode::ParallelCompile: return "KHR_parallel_shader_compile";
+    case ShaderManager::Mode::WorkerThread:    return "a worker context";
+    default:                                   return "blocking builds";
+    }
+}
+
+// With --shaders the scene's program is built from scene.vert and
+// scene.frag in that directory, written out from the built-in sources when
+// they are not there, and rebuilt whenever they change.
+std::unique_ptr<ShaderManager> watchShaders(const Settings &settings, const Target &target, ProgramCache &programs,
+                                            Scene &scene, StateCache &state) {
+    if (settings.shaderDirectory == nullptr) {
+        return nullptr;
+    }
+    std::string directory = settings.shaderDirectory;
+    std::string vertexPath = directory + "/scene.vert";
+    std::string fragmentPath = directory + "/scene.frag";
+    mkdir(directory.c_str(), 0755);
+    if (!writeIfMissing(vertexPath, Scene::vertexSource()) || !writeIfMissing(fragmentPath, Scene::fragmentSource())) {
+        std::cerr << "Failed to write the shaders to " << directory << std::endl;
+        return nullptr;
+    }
+
+    std::unique_ptr<ShaderManager> shaders(new ShaderManager(programs, target.makeWorkerCurrent, !settings.shaderWorker));
+    if (!shaders->watch(vertexPath, fragmentPath, [&scene, &state](GLuint program) {
+        scene.setProgram(state, program);
+    })) {
+        return nullptr;
+    }
+    std::cout << "watching " << directory << " for shader changes, rebuilding with "
+              << modeName(shaders->mode()) << std::endl;
+    return shaders;
+}
+
+void printShaders(const ShaderManager *shaders) {
+    if (shaders == nullptr) {
+        return;
+    }
+    const ShaderManager::Stats &stats = shaders->stats();
+    std::cout << "shaders: " << stats.builds << " rebuilt, " << stats.failures << " failed; longest update "
+              << stats.longestUpdateMilliseconds << " ms, longest rebuild " << stats.longestBuildMilliseconds
+              << " ms" << std::endl;
+}
+
+// Stands in for decoding texture `index`: a pattern of its own, rows
+// firstRow to firstRow + rows.
+void fillPattern(int index, int size, int firstRow, int rows, unsigned char *pixels) {
+    for (int y = firstRow; y < firstRow + rows; y++) {
+        for (int x = 0; x < size; x++) {
+            pixels[0] = (unsigned char)((x ^ y) + index * 37);
+            pixels[1] = (unsigned char)(x * 255 / size);
+            pixels[2] = (unsigned char)(y * 255 / size);
+            pixels[3] = 255;
+            pixels += 4;
+        }
+    }
+}
+
+// --load-textures: 1024x1024 textures, loaded while the scene renders.
+class TextureLoad {
+public:
+    TextureLoad(const Settings &settings, StateCache &state)
+        : state_(state), start_(Clock::now()) {
+        textures_.resize((size_t)((settings.textureMegabytes * 1024 * 1024 + bytes - 1) / bytes));
+        glGenTextures((GLsizei)textures_.size(), textures_.data());
+        if (settings.blockingTextures) {
+            return;
+        }
+        uploader_.reset(new TextureUploader(state));
+        for (size_t i = 0; i < textures_.size(); i++) {
+            createTexture(textures_[i], nullptr);
+            uploader_->upload(textures_[i], 0, size, size, [i](int firstRow, int rows, unsigned char *pixels) {
+                fillPattern((int)i, size, firstRow, rows, pixels);
+            }, [this](GLuint) {
+                loaded();
+            });
+        }
+    }
+
+    ~TextureLoad() {
+        uploader_.reset();
+        for (GLuint texture : textures_) {
+            state_.deletedTexture(texture);
+        }
+        glDeleteTextures((GLsizei)textures_.size(), textures_.data());
+    }
+
+    // Once a frame, on the thread that has the context.
+    void update() {
+        frames_ += loaded_ < textures_.size() ? 1 : 0;
+        if (uploader_) {
+            uploader_->update();
+        } else if (loaded_ < textures_.size()) {
+            pixels_.resize((size_t)bytes);
+            fillPattern((int)loaded_, size, 0, size, pixels_.data());
+            createTexture(textures_[loaded_], pixels_.data());
+            loaded();
+        }
+    }
+
+    void print() const {
+        std::cout << "textures: " << loaded_ << " of " << textures_.size() << " loaded ("
+                  << loaded_ * bytes / (1024 * 1024) << " MB) in " << milliseconds_ << " ms over " << frames_
+                  << " frames, ";
+        if (uploader_) {
+            std::cout << "through pixel buffers; longest update " << uploader_->stats().longestUpdateMilliseconds
+                      << " ms" << std::endl;
+        } else {
+            std::cout << "blocking" << std::endl;
+        }
+    }
 
-int main() {
-    std::cout << "Hello world" << std::endl;
+private:
+    static const int size = 1024;
+    static const int bytes = size * size * 4;
+
+    void createTexture(GLuint texture, const unsigned char *pixels) {
+        state_.bindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    }
+
+    void loaded() {
+        if (++loaded_ == textures_.size()) {
+            milliseconds_ = millisecondsSince(start_);
+        }
+    }
+
+    StateCache &state_;
+    std::vector<GLuint> textures_;
+    std::unique_ptr<TextureUploader> uploader_;
+    std::vector<unsigned char> pixels_;
+    size_t loaded_ = 0;
+    int frames_ = 0;
+    Clock::time_point start_;
+    double milliseconds_ = 0.0;
+};
+
+// --load-images: every PNG, JPEG, TGA and PPM file in a directory, as sRGB
+// textures with all their mip levels, loaded while the scene renders. A
+// loader thread decodes the files and builds the mip chains on a job
+// system, and each level goes to the GPU through TextureUploader, so the GL
+// thread only creates the textures. With --blocking-textures the GL thread
+// decodes one file a frame instead and calls glGenerateMipmap.
+class ImageLoad {
+public:
+    ImageLoad(const Settings &settings, StateCache &state)
+        : state_(state), start_(Clock::now()) {
+        if (DIR *directory = opendir(settings.imageDirectory)) {
+            while (dirent *entry = readdir(directory)) {
+                std::string name = entry->d_name;
+                size_t dot = name.rfind('.');
+                std::string extension = dot == std::string::npos ? "" : name.substr(dot);
+                if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" ||
+                    extension == ".ppm" || extension == ".pgm") {
+                    paths_.push_back(std::string(settings.imageDirectory) + "/" + name);
+                }
+            }
+            closedir(directory);
+        } else {
+            std::cerr << "Cannot read " << settings.imageDirectory << std::endl;
+        }
+        std::sort(paths_.begin(), paths_.end());
+        textures_.resize(paths_.size());
+        glGenTextures((GLsizei)textures_.size(), textures_.data());
+        if (settings.blockingTextures) {
+            return;
+        }
+        uploader_.reset(new TextureUploader(state));
+        if (paths_.empty()) {
+            return;
+        }
+        loader_ = std::thread([this]() {
+            // Behind the render thread like the uploader's workers; the job
+            // system's threads inherit this.
+            setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), 10);
+            jobs::JobSystem system;
+            loadImages(system, paths_, [this](size_t index, LoadedImage &image) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ready_.push_back(std::make_pair(index, std::make_shared<LoadedImage>(std::move(image))));
+            });
+        });
+    }
+
+    ~ImageLoad() {
+        // The loader cannot be stopped early; it finishes its files first.
+        if (loader_.joinable()) {
+            loader_.join();
+        }
+        uploader_.reset();
+        for (GLuint texture : textures_) {
+            state_.deletedTexture(texture);
+        }
+        glDeleteTextures((GLsizei)textures_.size(), textures_.data());
+    }
+
+    // Once a frame, on the thread that has the context.
+    void update() {
+        frames_ += finished_ < textures_.size() ? 1 : 0;
+        if (uploader_) {
+            std::vector<std::pair<size_t, std::shared_ptr<LoadedImage>>> ready;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ready.swap(ready_);
+            }
+            for (auto &entry : ready) {
+                upload(textures_[entry.first], entry.second);
+            }
+            uploader_->update();
+        } else if (finished_ < textures_.size()) {
+            Image image;
+            std::string error;
+            if (!loadImage(paths_[finished_], image, error)) {
+                failed(paths_[finished_], error);
+                return;
+            }
+            createTexture(textures_[finished_], image.width, image.height, 1, image.pixels.data());
+            glGenerateMipmap(GL_TEXTURE_2D);
+            // What the mip chain takes, as the loader's chains are counted.
+            std::vector<Image> levels;
+            levels.push_back(std::move(image));
+            while (levels.back().width > 1 || levels.back().height > 1) {
+                Image level;
+                level.width = std::max(1, levels.back().width / 2);
+                level.height = std::max(1, levels.back().height / 2);
+                levels.push_back(level);
+            }
+            finish(levels);
+        }
+    }
+
+    void print() const {
+        std::cout << "images: " << loaded_ << " of " << textures_.size() << " loaded ("
+                  << bytes_ / (1024.0 * 1024.0) << " MB with mipmaps) in " << milliseconds_ << " ms over "
+                  << frames_ << " frames, ";
+        if (uploader_) {
+            std::cout << "mipmaps built off the GL thread; longest update "
+                      << uploader_->stats().longestUpdateMilliseconds << " ms" << std::endl;
+        } else {
+            std::cout << "blocking, glGenerateMipmap" << std::endl;
+        }
+    }
+
+private:
+    void upload(GLuint texture, const std::shared_ptr<LoadedImage> &image) {
+        if (!image->error.empty()) {
+            failed(image->path, image->error);
+            return;
+        }
+        const std::vector<Image> &levels = image->levels;
+        createTexture(texture, levels[0].width, levels[0].height, (int)levels.size(), nullptr);
+        std::shared_ptr<int> remaining = std::make_shared<int>((int)levels.size());
+        for (size_t i = 0; i < levels.size(); i++) {
+            const Image &level = levels[i];
+            // The fill holds on to the image until its band is written.
+            uploader_->upload(texture, (GLint)i, level.width, level.height,
+                [image, i](int firstRow, int rows, unsigned char *pixels) {
+                    const Image &level = image->levels[i];
+                    size_t rowBytes = (size_t)level.width * 4;
+                    memcpy(pixels, level.pixels.data() + firstRow * rowBytes, rows * rowBytes);
+                }, [this, image, remaining](GLuint) {
+                    if (--*remaining == 0) {
+                        finish(image->levels);
+                    }
+                });
+        }
+    }
+
+    // Storage for `levels` levels, filled from `pixels` at level 0 if given.
+    void createTexture(GLuint texture, int width, int height, int levels, const unsigned char *pixels) {
+        state_.bindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        if (pixels != nullptr) {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB8_ALPHA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+            return;
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+        for (int level = 0; level < levels; level++) {
+            glTexImage2D(GL_TEXTURE_2D, level, GL_SRGB8_ALPHA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                         nullptr);
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+    }
+
+    void failed(const std::string &path, const std::string &error) {
+        std::cerr << path << ": " << error << std::endl;
+        finished();
+    }
+
+    void finish(const std::vector<Image> &levels) {
+        for (const Image &level : levels) {
+            bytes_ += (double)level.width * level.height * 4;
+        }
+        loaded_++;
+        finished();
+    }
+
+    void finished() {
+        if (++finished_ == textures_.size()) {
+            milliseconds_ = millisecondsSince(start_);
+        }
+    }
+
+    StateCache &state_;
+    std::vector<std::string> paths_;
+    std::vector<GLuint> textures_;
+    std::unique_ptr<TextureUploader> uploader_;
+    std::thread loader_;
+    std::mutex mutex_;
+    // Decoded, not yet handed to the uploader: texture index and image.
+    std::vector<std::pair<size_t, std::shared_ptr<LoadedImage>>> ready_;
+    // Loaded or failed.
+    size_t finished_ = 0;
+    size_t loaded_ = 0;
+    double bytes_ = 0.0;
+    int frames_ = 0;
+    Clock::time_point start_;
+    double milliseconds_ = 0.0;
+};
+
+// Draws the scene until `frames` are done or poll() returns false, at most at
+// the limiter's rate, with a line of frame statistics every second. A frame's
+// time runs from the start of one frame to the start of the next, so it
+// includes presenting and waiting for the limiter.
+void renderLoop(const Settings &settings, const Target &target) {
+    Scene scene;
+    StateCache state;
+    PostProcess post(state);
+    ProgramCache programs(settings.programCache != nullptr ? settings.programCache : "");
+    if (!createScene(settings, programs, state, scene, post)) {
+        return;
+    }
+    std::unique_ptr<ShaderManager> shaders = watchShaders(settings, target, programs, scene, state);
+    std::unique_ptr<TextureLoad> textures;
+    if (settings.textureMegabytes > 0.0) {
+        textures.reset(new TextureLoad(settings, state));
+    }
+    std::unique_ptr<ImageLoad> images;
+    if (settings.imageDirectory != nullptr) {
+        images.reset(new ImageLoad(settings, state));
+    }
+
+    FramePacer pacer(settings.fps);
+    LatencyProbe probe;
+    LoopStats stats;
+    for (int frame = 0; settings.frames == 0 || frame < settings.frames; frame++) {
+        bool open = target.poll();
+        Clock::time_point input = Clock::now();
+        int width = 0;
+        int height = 0;
+        target.size(width, height);
+        simulate(settings.simulateMs);
+
+        if (shaders) {
+            shaders->update();
+        }
+        if (textures) {
+            textures->update();
+        }
+        if (images) {
+            images->update();
+        }
+        double seconds = stats.seconds(settings, frame);
+        if (settings.post) {
+            post.render(target.framebuffer, width, height, [&]() {
+                scene.draw(state, seconds, width, height);
+            });
+        } else {
+            scene.draw(state, seconds, width, height);
+        }
+        target.present();
+        probe.submitted(input);
+        endCaptureFrame();
+        probe.poll();
+
+        pacer.wait();
+        stats.frameDone();
+        if (!open) {
+            break;
+        }
+    }
+    probe.finish();
+
+    stats.print(pacer);
+    printTimes("input to GPU done", probe.latencies());
+    std::cout << "state cache: " << state.stats().issued << " calls issued, "
+              << state.stats().skipped << " skipped" << std::endl;
+    printPostProcess(settings, post);
+    printShaders(shaders.get());
+    if (textures) {
+        textures->print();
+    }
+    if (images) {
+        images->print();
+    }
+
+    images.reset();
+    textures.reset();
+    post.destroy();
+    scene.destroy(state);
+}
+
+// The same loop with the GL calls on a render thread: this thread polls,
+// simulates and records each frame as commands, and the render thread
+// submits them while the next frame is simulated.
+void renderThreaded(const Settings &settings, const Target &target) {
+    Scene scene;
+    StateCache state;
+    PostProcess post(state);
+    ProgramCache programs(settings.programCache != nullptr ? settings.programCache : "");
+    if (!createScene(settings, programs, state, scene, post)) {
+        return;
+    }
+    std::unique_ptr<ShaderManager> shaders = watchShaders(settings, target, programs, scene, state);
+    std::unique_ptr<TextureLoad> textures;
+    if (settings.textureMegabytes > 0.0) {
+        textures.reset(new TextureLoad(settings, state));
+    }
+    std::unique_ptr<ImageLoad> images;
+    if (settings.imageDirectory != nullptr) {
+        images.reset(new ImageLoad(settings, state));
+    }
+
+    RenderThread renderer(scene, state);
+    RenderThread::Callbacks callbacks;
+    callbacks.makeCurrent = target.makeCurrent;
+    callbacks.present = [&]() {
+        target.present();
+        endCaptureFrame();
+    };
+    if (settings.post || shaders || textures || images) {
+        callbacks.draw = [&](int width, int height, const std::function<void()> &drawQuads) {
+            if (shaders) {
+                shaders->update();
+            }
+            if (textures) {
+                textures->update();
+            }
+            if (images) {
+                images->update();
+            }
+            if (settings.post) {
+                post.render(target.framebuffer, width, height, drawQuads);
+            } else {
+                drawQuads();
+            }
+        };
+    }
+    target.makeCurrent(false);
+    renderer.start(callbacks);
+
+    FramePacer pacer(settings.fps);
+    LoopStats stats;
+    for (int frame = 0; settings.frames == 0 || frame < settings.frames; frame++) {
+        bool open = target.poll();
+        Clock::time_point input = Clock::now();
+        int width = 0;
+        int height = 0;
+        target.size(width, height);
+        simulate(settings.simulateMs);
+
+        render::CommandBuffer *commands = renderer.begin();
+        render::ViewportCommand viewport = {width, height};
+        commands->push(render::CommandType::Viewport, viewport);
+        double seconds = stats.seconds(settings, frame);
+        uint32_t quads = commands->allocate<Scene::Quad>(settings.quads);
+        Scene::animate(seconds, commands->payload<Scene::Quad>(quads), settings.quads);
+        render::DrawQuadsCommand draw = {quads, (uint32_t)settings.quads, seconds};
+        commands->push(render::CommandType::DrawQuads, draw);
+        render::EndFrameCommand end = {(uint64_t)frame, (int64_t)input.time_since_epoch().count()};
+        commands->push(render::CommandType::EndFrame, end);
+        renderer.submit(commands);
+
+        pacer.wait();
+        stats.frameDone();
+        if (!open) {
+            break;
+        }
+    }
+    renderer.stop();
+    target.makeCurrent(true);
+
+    stats.print(pacer);
+    printTimes("render thread per frame", renderer.executeTimes());
+    printTimes("input to GPU done", renderer.latencies());
+    std::cout << "waited " << renderer.waitMilliseconds() << " ms for the render thread" << std::endl;
+    printPostProcess(settings, post);
+    printShaders(shaders.get());
+    if (textures) {
+        textures->print();
+    }
+    if (images) {
+        images->print();
+    }
+
+    images.reset();
+    textures.reset();
+    post.destroy();
+    scene.destroy(state);
+}
+
+void runFrames(const Settings &settings, const Target &target) {
+    if (settings.renderThread) {
+        renderThreaded(settings, target);
+    } else {
+        renderLoop(settings, target);
+    }
+}
+
+bool parseFormat(const char *name, FrameWriter::Format &format) {
+    if (strcmp(name, "raw") == 0) {
+        format = FrameWriter::Format::Raw;
+    } else if (strcmp(name, "ppm") == 0) {
+        format = FrameWriter::Format::Ppm;
+    } else if (strcmp(name, "y4m") == 0) {
+        format = FrameWriter::Format::Y4m;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Renders into a framebuffer object, there being no window. A fence after
+// each frame stands in for the swap chain: a frame waits for the one two
+// frames back, so the CPU runs at most that far ahead of the GPU, as with
+// double buffering. With an output path every frame goes through a ring of
+// pixel buffer objects to a writer thread.
+void renderOffscreen(const Settings &settings, const std::function<void(bool)> &makeCurrent,
+                     const std::function<bool(bool)> &makeWorkerCurrent) {
+    GLuint framebuffer = 0;
+    GLuint renderbuffers[2] = {0, 0};
+    glGenFramebuffers(1, &framebuffer);
+    glGenRenderbuffers(2, renderbuffers);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, settings.width, settings.height);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, settings.width, settings.height);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1]);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "The offscreen framebuffer is incomplete" << std::endl;
+    } else {
+        FrameWriter writer;
+        std::unique_ptr<PixelReadback> readback;
+        if (settings.outputPath != nullptr) {
+            FrameWriter::Format format = FrameWriter::formatFor(settings.outputPath);
+            if (settings.format != nullptr) {
+                parseFormat(settings.format, format);
+            }
+            int fps = (int)(1.0 / settings.step + 0.5);
+            if (writer.open(settings.outputPath, format, settings.width, settings.height, fps)) {
+                readback.reset(new PixelReadback(settings.width, settings.height));
+            }
+        }
+        auto submit = [&](const PixelReadback::Frame &frame) {
+            writer.submit(frame.pixels);
+        };
+
+        GLsync fences[2] = {nullptr, nullptr};
+        int next = 0;
+        Clock::time_point start = Clock::now();
+        Target target;
+        target.size = [&](int &width, int &height) {
+            width = settings.width;
+            height = settings.height;
+        };
+        target.poll = []() {
+            return true;
+        };
+        target.present = [&]() {
+            if (readback) {
+                readback->read(submit);
+            }
+            if (fences[next] != nullptr) {
+                glClientWaitSync(fences[next], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+                glDeleteSync(fences[next]);
+            }
+            fences[next] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            next = (next + 1) % 2;
+        };
+        target.makeCurrent = makeCurrent;
+        target.framebuffer = framebuffer;
+        target.makeWorkerCurrent = makeWorkerCurrent;
+        runFrames(settings, target);
+        for (GLsync fence : fences) {
+            if (fence != nullptr) {
+                glDeleteSync(fence);
+            }
+        }
+
+        if (readback) {
+            readback->finish(submit);
+            bool written = writer.close();
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            FrameWriter::Stats stats = writer.stats();
+            std::cout << "wrote " << stats.frames << " frames, " << stats.bytes / (1024.0 * 1024.0) << " MB, "
+                      << stats.frames / seconds << " frames/s; waited " << readback->waitMilliseconds()
+                      << " ms for readbacks, " << stats.stallMilliseconds << " ms for the disk" << std::endl;
+            if (!written) {
+                std::cerr << "Some frames were not written" << std::endl;
+            }
+            readback.reset();
+        }
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteRenderbuffers(2, renderbuffers);
+}
+
+// Destroys the headless context and closes the library glad loaded it
+// from.
+void closeHeadlessGL() {
+    destroyHeadlessContext();
+#ifndef GLAD_MINIMAL_LOADER
+    gladCloseGL();
+#endif
+}
+
+// An offscreen context, without GLFW or a display server, or the mock
+// backend without any context.
+int runHeadless(const Settings &settings, Clock::time_point start) {
+#ifndef GLAD_MINIMAL_LOADER
+    if (settings.mock) {
+        if (!loadGL((GLADloadproc)mockgl::getProcAddress)) {
+            std::cerr << "Failed to load the mock backend" << std::endl;
+            return 1;
+        }
+        printContext("mock", start);
+        if (!startCapture(settings)) {
+            return 1;
+        }
+        renderOffscreen(settings, madeCurrent, nullptr);
+        stopCapture();
+        mockgl::Stats stats = mockgl::stats();
+        std::cout << "mock: " << stats.drawCalls << " draw calls, " << stats.calls << " calls" << std::endl;
+        return 0;
+    }
+#endif
+
+    if (!createHeadlessContext(settings.backends)) {
+        std::cerr << "No headless backend out of \"" << settings.backends << "\" worked" << std::endl;
+        return 1;
+    }
+    // Through glad's own probe, pointed at the library the context came
+    // from; it stays open for the worker context until the end.
+#ifdef GLAD_MINIMAL_LOADER
+    GLADloadproc load = (GLADloadproc)headlessGetProcAddress;
+#else
+    GLADloadproc load = (GLADloadproc)gladGetGLProcAddress;
+    gladSetGLBackends(headlessBackend());
+    if (!gladOpenGL()) {
+        std::cerr << "glad cannot open the " << headlessBackend() << " library" << std::endl;
+        destroyHeadlessContext();
+        return 1;
+    }
+#endif
+    if (!loadGL(load)) {
+        std::cerr << "Failed to load GL" << std::endl;
+        closeHeadlessGL();
+        return 1;
+    }
+    printContext(headlessBackend(), start);
+    if (!startCapture(settings)) {
+        closeHeadlessGL();
+        return 1;
+    }
+    startDebugOutput();
+
+    // A context for building shaders on a worker thread, when the driver
+    // cannot do it in parallel itself.
+    std::function<bool(bool)> makeWorkerCurrent;
+    if (settings.shaderDirectory != nullptr && createSharedHeadlessContext()) {
+        makeWorkerCurrent = [load](bool current) {
+            return makeSharedHeadlessContextCurrent(current) && madeWorkerCurrent(current, load);
+        };
+    }
+    renderOffscreen(settings, [](bool current) {
+        makeHeadlessContextCurrent(current);
+        madeCurrent(current);
+    }, makeWorkerCurrent);
+
+    stopDebugOutput();
+    stopCapture();
+    closeHeadlessGL();
     return 0;
 }
+
+int runWindow(const Settings &settings, Clock::time_point start) {
+    if (!glfwInit()) {
+        std::cerr << "Failed to initialize GLFW" << std::endl;
+        return 1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    GLFWwindow *window = glfwCreateWindow(settings.width, settings.height, "learnopengl", nullptr, nullptr);
+    if (window == nullptr) {
+        std::cerr << "Failed to create a window, try --headless" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+    glfwMakeContextCurrent(window);
+    if (!loadGL((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Failed to load GL" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+    printContext("glfw", start);
+    if (!startCapture(settings)) {
+        glfwTerminate();
+        return 1;
+    }
+    startDebugOutput();
+
+    int swapInterval = settings.swapInterval;
+    if (swapInterval < 0 && !glfwExtensionSupported("GLX_EXT_swap_control_tear") &&
+        !glfwExtensionSupported("WGL_EXT_swap_control_tear")) {
+        std::cerr << "No adaptive vsync, using a swap interval of 1" << std::endl;
+        swapInterval = 1;
+    }
+    glfwSwapInterval(swapInterval);
+
+    Target target;
+    target.size = [&](int &width, int &height) {
+        glfwGetFramebufferSize(window, &width, &height);
+    };
+    target.poll = [&]() {
+        glfwPollEvents();
+        if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+            glfwSetWindowShouldClose(window, GLFW_TRUE);
+        }
+        return !glfwWindowShouldClose(window);
+    };
+    target.present = [&]() {
+        glfwSwapBuffers(window);
+    };
+    target.makeCurrent = [&](bool current) {
+        glfwMakeContextCurrent(current ? window : nullptr);
+        madeCurrent(current);
+    };
+    GLFWwindow *worker = nullptr;
+    if (settings.shaderDirectory != nullptr) {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        worker = glfwCreateWindow(1, 1, "shader worker", nullptr, window);
+    }
+    if (worker != nullptr) {
+        target.makeWorkerCurrent = [worker](bool current) {
+            glfwMakeContextCurrent(current ? worker : nullptr);
+            return madeWorkerCurrent(current, (GLADloadproc)glfwGetProcAddress);
+        };
+    }
+    runFrames(settings, target);
+
+    stopDebugOutput();
+    stopCapture();
+    glfwTerminate();
+    return 0;
+}
+
+void usage(const char *program) {
+    std::cerr << "usage: " << program << " [options]\n"
+              << "  --headless             render offscreen, without a window\n"
+              << "  --backends egl,osmesa  headless backends to try, in order\n"
+#ifndef GLAD_MINIMAL_LOADER
+              << "  --mock                 render into the mock GL backend\n"
+              << "  --capture <file>       record the GL calls for the replay tool\n"
+#endif
+              << "  --output <path>        headless: write the frames (out.y4m, out/%05d.ppm)\n"
+              << "  --format raw|ppm|y4m   instead of the one the extension says\n"
+              << "  --frames <n>           stop after n frames\n"
+              << "  --fps <rate>           limit the frame rate\n"
+              << "  --swap-interval <n>    0 for no vsync, -1 for adaptive\n"
+              << "  --quads <n>            draw calls per frame\n"
+              << "  --simulate-ms <ms>     CPU work per frame, standing in for game logic\n"
+              << "  --render-thread        make the GL calls on a render thread\n"
+              << "  --post                 draw through bloom post-processing passes\n"
+              << "  --show-luminance       with --post: show the luminance pass in a corner\n"
+              << "  --program-cache <dir>  keep linked program binaries in dir\n"
+              << "  --shaders <dir>        read the scene's shaders from dir, rebuild them on changes\n"
+              << "  --shader-worker        build them on a worker context, not in the driver\n"
+              << "  --load-textures <MB>   load that many MB of textures while rendering\n"
+              << "  --load-images <dir>    load dir's PNG, JPEG, TGA and PPM images while rendering\n"
+              << "  --blocking-textures    load them with glTexImage2D, one a frame\n"
+              << "  --size <w>x<h>         framebuffer size" << std::endl;
+}
+
+}
+
+int main(int argc, char **argv) {
+    Clock::time_point start = Clock::now();
+
+    Settings settings;
+    for (int i = 1; i < argc; i++) {
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (strcmp(argv[i], "--headless") == 0) {
+            settings.headless = true;
+        } else if (strcmp(argv[i], "--backends") == 0 && value != nullptr) {
+            settings.headless = true;
+            settings.backends = argv[++i];
+#ifndef GLAD_MINIMAL_LOADER
+        } else if (strcmp(argv[i], "--mock") == 0) {
+            settings.headless = true;
+            settings.mock = true;
+        } else if (strcmp(argv[i], "--capture") == 0 && value != nullptr) {
+            settings.capturePath = argv[++i];
+#endif
+        } else if (strcmp(argv[i], "--output") == 0 && value != nullptr) {
+            settings.headless = true;
+            settings.outputPath = argv[++i];
+        } else if (strcmp(argv[i], "--format") == 0 && value != nullptr) {
+            FrameWriter::Format format;
+            if (!parseFormat(value, format)) {
+                usage(argv[0]);
+                return 1;
+            }
+            settings.format = argv[++i];
+        } else if (strcmp(argv[i], "--frames") == 0 && value != nullptr) {
+            settings.frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--fps") == 0 && value != nullptr) {
+            settings.fps = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--swap-interval") == 0 && value != nullptr) {
+            settings.swapInterval = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--quads") == 0 && value != nullptr) {
+            settings.quads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--simulate-ms") == 0 && value != nullptr) {
+            settings.simulateMs = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--render-thread") == 0) {
+            settings.renderThread = true;
+        } else if (strcmp(argv[i], "--post") == 0) {
+            settings.post = true;
+        } else if (strcmp(argv[i], "--shaders") == 0 && value != nullptr) {
+            settings.shaderDirectory = argv[++i];
+        } else if (strcmp(argv[i], "--shader-worker") == 0) {
+            settings.shaderWorker = true;
+        } else if (strcmp(argv[i], "--load-textures") == 0 && value != nullptr) {
+            settings.textureMegabytes = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--load-images") == 0 && value != nullptr) {
+            settings.imageDirectory = argv[++i];
+        } else if (strcmp(argv[i], "--blocking-textures") == 0) {
+            settings.blockingTextures = true;
+        } else if (strcmp(argv[i], "--program-cache") == 0 && value != nullptr) {
+            settings.programCache = argv[++i];
+        } else if (strcmp(argv[i], "--show-luminance") == 0) {
+            settings.post = true;
+            settings.showLuminance = true;
+        } else if (strcmp(argv[i], "--size") == 0 && value != nullptr &&
+                   sscanf(argv[i + 1], "%dx%d", &settings.width, &settings.height) == 2) {
+            i++;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (settings.headless) {
+        if (settings.frames == 0) {
+            settings.frames = 600;
+        }
+        settings.step = 1.0 / 30.0;
+    }
+
+    return settings.headless ? runHeadless(settings, start) : runWindow(settings, start);
+}
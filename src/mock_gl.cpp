@@ -0,0 +1,555 @@
+#include "mock_gl.h"
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace mockgl {
+
+namespace {
+
+const unsigned int logVersion = 1;
+const size_t logFlushSize = 64 * 1024;
+
+struct Buffer {
+    std::vector<unsigned char> data;
+    bool mapped = false;
+};
+
+// Hands out names in increasing order, like drivers usually do.
+struct Names {
+    GLuint next = 1;
+    std::unordered_set<GLuint> live;
+
+    GLuint create() {
+        live.insert(next);
+        return next++;
+    }
+
+    void generate(GLsizei n, GLuint *names) {
+        for (GLsizei i = 0; i < n; i++) {
+            names[i] = create();
+        }
+    }
+
+    void remove(GLsizei n, const GLuint *names) {
+        for (GLsizei i = 0; i < n; i++) {
+            live.erase(names[i]);
+        }
+    }
+
+    GLboolean contains(GLuint name) const {
+        return live.count(name) ? GL_TRUE : GL_FALSE;
+    }
+};
+
+struct State {
+    Stats stats;
+
+    Names buffers, textures, vertexArrays, framebuffers, renderbuffers;
+    Names samplers, queries, shaders, programs;
+    std::unordered_map<GLuint, Buffer> bufferData;
+    std::unordered_map<GLenum, GLuint> boundBuffers;
+    GLuint boundVertexArray = 0;
+    // The element array binding belongs to the vertex array object.
+    std::unordered_map<GLuint, GLuint> elementBuffers;
+
+    uintptr_t nextSync = 1;
+    std::unordered_set<uintptr_t> syncs;
+
+    // Locations are handed out per program in the order they are asked for.
+    std::map<std::pair<GLuint, std::string>, GLint> locations;
+    std::unordered_map<GLuint, GLint> nextLocation;
+
+    FILE *log = nullptr;
+    std::vector<unsigned char> logBuffer;
+};
+
+State mock;
+
+void flushLog() {
+    if (mock.log != nullptr && !mock.logBuffer.empty()) {
+        fwrite(mock.logBuffer.data(), 1, mock.logBuffer.size(), mock.log);
+        mock.stats.logBytes += mock.logBuffer.size();
+        mock.logBuffer.clear();
+    }
+}
+
+void appendLog(const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char*)data;
+    mock.logBuffer.insert(mock.logBuffer.end(), bytes, bytes + size);
+}
+
+// Counts one call and, while a log is open, writes its record.
+class Recorder {
+public:
+    explicit Recorder(unsigned short opcode) : start_(mock.logBuffer.size()) {
+        mock.stats.calls++;
+        if (mock.log != nullptr) {
+            unsigned short size = 0;
+            appendLog(&opcode, sizeof(opcode));
+            appendLog(&size, sizeof(size));
+        }
+    }
+
+    ~Recorder() {
+        if (mock.log != nullptr) {
+            unsigned short size = (unsigned short)(mock.logBuffer.size() - start_ - 4);
+            memcpy(&mock.logBuffer[start_ + 2], &size, sizeof(size));
+            if (mock.logBuffer.size() >= logFlushSize) {
+                flushLog();
+            }
+        }
+    }
+
+    template <typename T>
+    void put(T value) {
+        if (mock.log != nullptr) {
+            appendLog(&value, sizeof(value));
+        }
+    }
+
+    void putOffset(const void *pointer) {
+        put((unsigned long long)(uintptr_t)pointer);
+    }
+
+    void putPresence(const void *pointer) {
+        put((unsigned char)(pointer != nullptr));
+    }
+
+private:
+    size_t start_;
+};
+
+Buffer *boundBuffer(GLenum target) {
+    auto bound = mock.boundBuffers.find(target);
+    if (bound == mock.boundBuffers.end() || bound->second == 0) {
+        return nullptr;
+    }
+    return &mock.bufferData[bound->second];
+}
+
+GLint location(GLuint program, const GLchar *name, GLint limit) {
+    auto key = std::make_pair(program, std::string(name));
+    auto found = mock.locations.find(key);
+    if (found != mock.locations.end()) {
+        return found->second;
+    }
+    GLint next = mock.nextLocation[program]++;
+    GLint result = next < limit ? next : -1;
+    mock.locations[key] = result;
+    return result;
+}
+
+void countDraw(GLsizei count, GLsizei instances) {
+    mock.stats.drawCalls++;
+    mock.stats.vertices += (unsigned long long)count * (unsigned long long)instances;
+}
+
+// Hooks: the behaviour behind the recorders that need more than recording.
+
+void hook_glGenBuffers(GLsizei n, GLuint *buffers) {
+    mock.buffers.generate(n, buffers);
+}
+
+void hook_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    mock.buffers.remove(n, buffers);
+    for (GLsizei i = 0; i < n; i++) {
+        mock.bufferData.erase(buffers[i]);
+        for (auto &bound : mock.boundBuffers) {
+            if (bound.second == buffers[i]) {
+                bound.second = 0;
+            }
+        }
+    }
+}
+
+void hook_glGenTextures(GLsizei n, GLuint *textures) {
+    mock.textures.generate(n, textures);
+}
+
+void hook_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    mock.textures.remove(n, textures);
+}
+
+void hook_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    mock.vertexArrays.generate(n, arrays);
+}
+
+void hook_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    mock.vertexArrays.remove(n, arrays);
+    for (GLsizei i = 0; i < n; i++) {
+        mock.elementBuffers.erase(arrays[i]);
+        if (mock.boundVertexArray == arrays[i]) {
+            mock.boundVertexArray = 0;
+            mock.boundBuffers[GL_ELEMENT_ARRAY_BUFFER] = mock.elementBuffers[0];
+        }
+    }
+}
+
+void hook_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    mock.framebuffers.generate(n, framebuffers);
+}
+
+void hook_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    mock.framebuffers.remove(n, framebuffers);
+}
+
+void hook_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    mock.renderbuffers.generate(n, renderbuffers);
+}
+
+void hook_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    mock.renderbuffers.remove(n, renderbuffers);
+}
+
+void hook_glGenSamplers(GLsizei count, GLuint *samplers) {
+    mock.samplers.generate(count, samplers);
+}
+
+void hook_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    mock.samplers.remove(count, samplers);
+}
+
+void hook_glGenQueries(GLsizei n, GLuint *ids) {
+    mock.queries.generate(n, ids);
+}
+
+void hook_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    mock.queries.remove(n, ids);
+}
+
+GLuint hook_glCreateShader(GLenum) {
+    return mock.shaders.create();
+}
+
+void hook_glDeleteShader(GLuint shader) {
+    mock.shaders.remove(1, &shader);
+}
+
+GLuint hook_glCreateProgram() {
+    return mock.programs.create();
+}
+
+void hook_glDeleteProgram(GLuint program) {
+    mock.programs.remove(1, &program);
+}
+
+GLboolean hook_glIsBuffer(GLuint buffer) { return mock.buffers.contains(buffer); }
+GLboolean hook_glIsTexture(GLuint texture) { return mock.textures.contains(texture); }
+GLboolean hook_glIsVertexArray(GLuint array) { return mock.vertexArrays.contains(array); }
+GLboolean hook_glIsFramebuffer(GLuint framebuffer) { return mock.framebuffers.contains(framebuffer); }
+GLboolean hook_glIsRenderbuffer(GLuint renderbuffer) { return mock.renderbuffers.contains(renderbuffer); }
+GLboolean hook_glIsSampler(GLuint sampler) { return mock.samplers.contains(sampler); }
+GLboolean hook_glIsQuery(GLuint id) { return mock.queries.contains(id); }
+GLboolean hook_glIsShader(GLuint shader) { return mock.shaders.contains(shader); }
+GLboolean hook_glIsProgram(GLuint program) { return mock.programs.contains(program); }
+
+void hook_glBindBuffer(GLenum target, GLuint buffer) {
+    mock.boundBuffers[target] = buffer;
+}
+
+void hook_glBindVertexArray(GLuint array) {
+    mock.elementBuffers[mock.boundVertexArray] = mock.boundBuffers[GL_ELEMENT_ARRAY_BUFFER];
+    mock.boundVertexArray = array;
+    mock.boundBuffers[GL_ELEMENT_ARRAY_BUFFER] = mock.elementBuffers[array];
+}
+
+void hook_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum) {
+    Buffer *buffer = boundBuffer(target);
+    if (buffer == nullptr || size < 0) {
+        return;
+    }
+    buffer->data.assign((size_t)size, 0);
+    if (data != nullptr) {
+        memcpy(buffer->data.data(), data, (size_t)size);
+        mock.stats.bytesUploaded += (unsigned long long)size;
+    }
+}
+
+void hook_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    Buffer *buffer = boundBuffer(target);
+    if (buffer == nullptr || data == nullptr || offset < 0 || size < 0 ||
+        (size_t)(offset + size) > buffer->data.size()) {
+        return;
+    }
+    memcpy(buffer->data.data() + offset, data, (size_t)size);
+    mock.stats.bytesUploaded += (unsigned long long)size;
+}
+
+void* hook_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield) {
+    Buffer *buffer = boundBuffer(target);
+    if (buffer == nullptr || buffer->mapped || offset < 0 || length < 0 ||
+        (size_t)(offset + length) > buffer->data.size()) {
+        return nullptr;
+    }
+    buffer->mapped = true;
+    mock.stats.bytesUploaded += (unsigned long long)length;
+    return buffer->data.data() + offset;
+}
+
+void* hook_glMapBuffer(GLenum target, GLenum) {
+    Buffer *buffer = boundBuffer(target);
+    return buffer != nullptr ? hook_glMapBufferRange(target, 0, (GLsizeiptr)buffer->data.size(), 0) : nullptr;
+}
+
+GLboolean hook_glUnmapBuffer(GLenum target) {
+    Buffer *buffer = boundBuffer(target);
+    if (buffer == nullptr || !buffer->mapped) {
+        return GL_FALSE;
+    }
+    buffer->mapped = false;
+    return GL_TRUE;
+}
+
+void hook_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    Buffer *buffer = boundBuffer(target);
+    if (pname == GL_BUFFER_SIZE) {
+        *params = buffer != nullptr ? (GLint)buffer->data.size() : 0;
+    } else if (pname == GL_BUFFER_MAPPED) {
+        *params = buffer != nullptr && buffer->mapped ? GL_TRUE : GL_FALSE;
+    } else {
+        *params = 0;
+    }
+}
+
+const GLubyte* hook_glGetString(GLenum name) {
+    switch (name) {
+    case GL_VENDOR:                   return (const GLubyte*)"learnopengl";
+    case GL_RENDERER:                 return (const GLubyte*)"mock GL";
+    case GL_VERSION:                  return (const GLubyte*)"3.3.0 Mock";
+    case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte*)"3.30 Mock";
+    case GL_EXTENSIONS:               return (const GLubyte*)"";
+    default:                          return nullptr;
+    }
+}
+
+const GLubyte* hook_glGetStringi(GLenum, GLuint) {
+    // No extensions.
+    return nullptr;
+}
+
+void hook_glGetIntegerv(GLenum pname, GLint *data) {
+    switch (pname) {
+    case GL_MAJOR_VERSION:                    *data = 3; break;
+    case GL_MINOR_VERSION:                    *data = 3; break;
+    case GL_MAX_TEXTURE_SIZE:                 *data = 16384; break;
+    case GL_MAX_3D_TEXTURE_SIZE:              *data = 2048; break;
+    case GL_MAX_ARRAY_TEXTURE_LAYERS:         *data = 2048; break;
+    case GL_MAX_RENDERBUFFER_SIZE:            *data = 16384; break;
+    case GL_MAX_VERTEX_ATTRIBS:               *data = 16; break;
+    case GL_MAX_TEXTURE_IMAGE_UNITS:          *data = 16; break;
+    case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS: *data = 48; break;
+    case GL_MAX_DRAW_BUFFERS:                 *data = 8; break;
+    case GL_MAX_COLOR_ATTACHMENTS:            *data = 8; break;
+    case GL_MAX_SAMPLES:                      *data = 4; break;
+    case GL_MAX_UNIFORM_BUFFER_BINDINGS:      *data = 36; break;
+    case GL_MAX_UNIFORM_BLOCK_SIZE:           *data = 65536; break;
+    case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:  *data = 256; break;
+    case GL_VERTEX_ARRAY_BINDING:             *data = (GLint)mock.boundVertexArray; break;
+    case GL_ARRAY_BUFFER_BINDING:             *data = (GLint)mock.boundBuffers[GL_ARRAY_BUFFER]; break;
+    case GL_ELEMENT_ARRAY_BUFFER_BINDING:     *data = (GLint)mock.boundBuffers[GL_ELEMENT_ARRAY_BUFFER]; break;
+    case GL_VIEWPORT:
+        data[0] = data[1] = 0;
+        data[2] = data[3] = 1;
+        break;
+    default:                                  *data = 0; break;
+    }
+}
+
+void hook_glGetShaderiv(GLuint, GLenum pname, GLint *params) {
+    *params = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+}
+
+void hook_glGetProgramiv(GLuint, GLenum pname, GLint *params) {
+    *params = pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS ? GL_TRUE : 0;
+}
+
+void hook_glGetShaderInfoLog(GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    if (length != nullptr) {
+        *length = 0;
+    }
+    if (bufSize > 0 && infoLog != nullptr) {
+        infoLog[0] = '\0';
+    }
+}
+
+void hook_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    hook_glGetShaderInfoLog(program, bufSize, length, infoLog);
+}
+
+GLenum hook_glCheckFramebufferStatus(GLenum) {
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+GLint hook_glGetUniformLocation(GLuint program, const GLchar *name) {
+    return location(program, name, 1024);
+}
+
+GLint hook_glGetAttribLocation(GLuint program, const GLchar *name) {
+    return location(program, name, 16);
+}
+
+GLuint hook_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    GLint index = location(program, uniformBlockName, 36);
+    return index < 0 ? GL_INVALID_INDEX : (GLuint)index;
+}
+
+GLint hook_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    return location(program, name, 8);
+}
+
+GLsync hook_glFenceSync(GLenum, GLbitfield) {
+    uintptr_t sync = mock.nextSync++;
+    mock.syncs.insert(sync);
+    return (GLsync)sync;
+}
+
+GLenum hook_glClientWaitSync(GLsync, GLbitfield, GLuint64) {
+    // Everything has finished by the time it was submitted.
+    return GL_ALREADY_SIGNALED;
+}
+
+GLboolean hook_glIsSync(GLsync sync) {
+    return mock.syncs.count((uintptr_t)sync) ? GL_TRUE : GL_FALSE;
+}
+
+void hook_glDeleteSync(GLsync sync) {
+    mock.syncs.erase((uintptr_t)sync);
+}
+
+void hook_glDrawArrays(GLenum, GLint, GLsizei count) {
+    countDraw(count, 1);
+}
+
+void hook_glDrawArraysInstanced(GLenum, GLint, GLsizei count, GLsizei instancecount) {
+    countDraw(count, instancecount);
+}
+
+void hook_glDrawElements(GLenum, GLsizei count, GLenum, const void*) {
+    countDraw(count, 1);
+}
+
+void hook_glDrawElementsInstanced(GLenum, GLsizei count, GLenum, const void*, GLsizei instancecount) {
+    countDraw(count, instancecount);
+}
+
+void hook_glDrawRangeElements(GLenum, GLuint, GLuint, GLsizei count, GLenum, const void*) {
+    countDraw(count, 1);
+}
+
+void hook_glDrawElementsBaseVertex(GLenum, GLsizei count, GLenum, const void*, GLint) {
+    countDraw(count, 1);
+}
+
+void hook_glDrawRangeElementsBaseVertex(GLenum, GLuint, GLuint, GLsizei count, GLenum, const void*, GLint) {
+    countDraw(count, 1);
+}
+
+void hook_glDrawElementsInstancedBaseVertex(GLenum, GLsizei count, GLenum, const void*, GLsizei instancecount, GLint) {
+    countDraw(count, instancecount);
+}
+
+void hook_glMultiDrawArrays(GLenum, const GLint*, const GLsizei *count, GLsizei drawcount) {
+    for (GLsizei i = 0; i < drawcount; i++) {
+        countDraw(count[i], 1);
+    }
+}
+
+void hook_glMultiDrawElements(GLenum, const GLsizei *count, GLenum, const void *const*, GLsizei drawcount) {
+    for (GLsizei i = 0; i < drawcount; i++) {
+        countDraw(count[i], 1);
+    }
+}
+
+void hook_glMultiDrawElementsBaseVertex(GLenum, const GLsizei *count, GLenum, const void *const*, GLsizei drawcount, const GLint*) {
+    for (GLsizei i = 0; i < drawcount; i++) {
+        countDraw(count[i], 1);
+    }
+}
+
+struct MockEntryPoint {
+    const char *name;
+    void *function;
+};
+
+#include "mock_gl_entry_points.inc"
+
+const size_t opcodeCount = sizeof(opcodeNames) / sizeof(opcodeNames[0]);
+
+}
+
+void* getProcAddress(const char *name) {
+    const MockEntryPoint *begin = entryPoints;
+    const MockEntryPoint *end = entryPoints + sizeof(entryPoints) / sizeof(entryPoints[0]);
+    const MockEntryPoint *found = std::lower_bound(begin, end, name,
+        [](const MockEntryPoint &entry, const char *key) {
+            return strcmp(entry.name, key) < 0;
+        });
+    return found != end && strcmp(found->name, name) == 0 ? found->function : nullptr;
+}
+
+Stats stats() {
+    Stats result = mock.stats;
+    result.buffers = (int)mock.buffers.live.size();
+    result.textures = (int)mock.textures.live.size();
+    result.vertexArrays = (int)mock.vertexArrays.live.size();
+    result.framebuffers = (int)mock.framebuffers.live.size();
+    result.renderbuffers = (int)mock.renderbuffers.live.size();
+    result.samplers = (int)mock.samplers.live.size();
+    result.queries = (int)mock.queries.live.size();
+    result.shaders = (int)mock.shaders.live.size();
+    result.programs = (int)mock.programs.live.size();
+    result.syncs = (int)mock.syncs.size();
+    return result;
+}
+
+void reset() {
+    FILE *log = mock.log;
+    std::vector<unsigned char> logBuffer;
+    logBuffer.swap(mock.logBuffer);
+    unsigned long long logBytes = mock.stats.logBytes;
+
+    mock = State();
+    mock.log = log;
+    mock.logBuffer.swap(logBuffer);
+    mock.stats.logBytes = logBytes;
+}
+
+bool openLog(const char *path) {
+    closeLog();
+    mock.log = fopen(path, "wb");
+    if (mock.log == nullptr) {
+        return false;
+    }
+
+    unsigned int header[2] = {logVersion, (unsigned int)opcodeCount};
+    appendLog("GLMK", 4);
+    appendLog(header, sizeof(header));
+    for (size_t i = 0; i < opcodeCount; i++) {
+        appendLog(opcodeNames[i], strlen(opcodeNames[i]) + 1);
+    }
+    return true;
+}
+
+void closeLog() {
+    if (mock.log != nullptr) {
+        flushLog();
+        fclose(mock.log);
+        mock.log = nullptr;
+    }
+}
+
+const char *opcodeName(unsigned int opcode) {
+    return opcode < opcodeCount ? opcodeNames[opcode] : nullptr;
+}
+
+}
@@ -0,0 +1,60 @@
+#ifndef MOCK_GL_H
+#define MOCK_GL_H
+
+// A stand-in GL 3.3 core implementation for machines without a GPU or a
+// display. Handing mockgl::getProcAddress to gladLoadGLLoader makes every
+// entry point a recorder: objects get names and are tracked, buffers keep
+// their contents so they can be mapped, draws, vertices and state changes
+// are counted, and each call can be appended to a binary command log.
+//
+// Names and results only depend on the order of calls, so the same renderer
+// code produces the same log on every run. The mock is not thread safe,
+// same as a single GL context.
+//
+// Log layout (little endian): "GLMK", u32 version, u32 entry point count,
+// the entry point names as NUL terminated strings in opcode order, then one
+// record per call: u16 opcode, u16 payload size, payload. The payload holds
+// the scalar arguments as passed; pointers are stored as their value when
+// they are buffer offsets (vertex attrib pointers, indices, syncs) and as a
+// single null/non-null byte otherwise.
+
+namespace mockgl {
+
+struct Stats {
+    unsigned long long calls = 0;
+    unsigned long long drawCalls = 0;
+    unsigned long long vertices = 0;
+    unsigned long long stateChanges = 0;
+    unsigned long long bytesUploaded = 0;
+    unsigned long long logBytes = 0;
+
+    // Objects currently alive.
+    int buffers = 0;
+    int textures = 0;
+    int vertexArrays = 0;
+    int framebuffers = 0;
+    int renderbuffers = 0;
+    int samplers = 0;
+    int queries = 0;
+    int shaders = 0;
+    int programs = 0;
+    int syncs = 0;
+};
+
+// GLADloadproc compatible.
+void* getProcAddress(const char *name);
+
+Stats stats();
+
+// Deletes all objects and clears the counters; an open log stays open.
+void reset();
+
+bool openLog(const char *path);
+void closeLog();
+
+// Name of a log opcode, or nullptr when it is out of range.
+const char *opcodeName(unsigned int opcode);
+
+}
+
+#endif
@@ -0,0 +1,67 @@
+#include "pixel_readback.h"
+
+#include <chrono>
+
+PixelReadback::PixelReadback(int width, int height, int depth)
+    : width_(width), height_(height), slots_(depth > 0 ? depth : 1) {
+    GLint packBuffer = 0;
+    glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &packBuffer);
+    for (Slot &slot : slots_) {
+        glGenBuffers(1, &slot.buffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)frameSize(), nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, (GLuint)packBuffer);
+}
+
+PixelReadback::~PixelReadback() {
+    for (Slot &slot : slots_) {
+        if (slot.fence != nullptr) {
+            glDeleteSync(slot.fence);
+        }
+        glDeleteBuffers(1, &slot.buffer);
+    }
+}
+
+void PixelReadback::consume(Slot &slot, const Consumer &consumer) {
+    auto start = std::chrono::steady_clock::now();
+    glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    waitMilliseconds_ += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    void *pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)frameSize(), GL_MAP_READ_BIT);
+    if (pixels != nullptr) {
+        Frame frame;
+        frame.pixels = (const unsigned char*)pixels;
+        frame.index = slot.index;
+        consumer(frame);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+}
+
+void PixelReadback::read(const Consumer &consumer) {
+    Slot &slot = slots_[next_];
+    if (slot.fence != nullptr) {
+        consume(slot, consumer);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, width_, height_, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.index = frames_++;
+    next_ = (next_ + 1) % slots_.size();
+}
+
+void PixelReadback::finish(const Consumer &consumer) {
+    for (size_t i = 0; i < slots_.size(); i++) {
+        Slot &slot = slots_[(next_ + i) % slots_.size()];
+        if (slot.fence != nullptr) {
+            consume(slot, consumer);
+        }
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
@@ -0,0 +1,62 @@
+#ifndef PIXEL_READBACK_H
+#define PIXEL_READBACK_H
+
+#include <glad/glad.h>
+
+#include <functional>
+#include <vector>
+
+// Reads frames back from the bound read framebuffer without waiting for the
+// GPU. read() starts a glReadPixels into the next of `depth` pixel buffer
+// objects and fences it; the pixels are fetched only once the ring wraps
+// around, `depth` - 1 frames later, when the copy has long finished. With a
+// direct glReadPixels into client memory the CPU would wait for the frame to
+// be rendered and copied, every frame.
+class PixelReadback {
+public:
+    // Pixels in RGBA8, bottom row first as GL returns them.
+    struct Frame {
+        const unsigned char *pixels;
+        unsigned long long index;
+    };
+
+    // The callback of read() and finish(); the pixels are only valid during
+    // the call.
+    typedef std::function<void(const Frame &)> Consumer;
+
+    PixelReadback(int width, int height, int depth = 3);
+    ~PixelReadback();
+
+    PixelReadback(const PixelReadback &) = delete;
+    PixelReadback &operator=(const PixelReadback &) = delete;
+
+    // Queues the read framebuffer's pixels; hands the oldest frame to
+    // `consumer` first when the ring is full.
+    void read(const Consumer &consumer);
+
+    // Hands out every frame still in flight, oldest first.
+    void finish(const Consumer &consumer);
+
+    size_t frameSize() const { return (size_t)width_ * height_ * 4; }
+
+    // Time spent in glClientWaitSync, which should stay near zero.
+    double waitMilliseconds() const { return waitMilliseconds_; }
+
+private:
+    struct Slot {
+        GLuint buffer = 0;
+        GLsync fence = nullptr;
+        unsigned long long index = 0;
+    };
+
+    void consume(Slot &slot, const Consumer &consumer);
+
+    int width_;
+    int height_;
+    std::vector<Slot> slots_;
+    size_t next_ = 0;
+    unsigned long long frames_ = 0;
+    double waitMilliseconds_ = 0.0;
+};
+
+#endif
@@ -0,0 +1,202 @@
+#include "post_process.h"
+#include "program_cache.h"
+#include "state_cache.h"
+
+namespace {
+
+// One triangle covering the screen, from gl_VertexID alone.
+const char *fullscreenSource = R"(#version 330 core
+out vec2 uv;
+void main() {
+    uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+const char *brightSource = R"(#version 330 core
+uniform sampler2D scene;
+in vec2 uv;
+out vec4 fragColor;
+void main() {
+    vec3 color = texture(scene, uv).rgb;
+    fragColor = vec4(max(color - vec3(0.6), vec3(0.0)) * 2.5, 1.0);
+}
+)";
+
+// Separable Gaussian, 9 taps along `step`.
+const char *blurSource = R"(#version 330 core
+uniform sampler2D source;
+uniform vec2 step;
+in vec2 uv;
+out vec4 fragColor;
+void main() {
+    const float weights[5] = float[](0.227027, 0.1945946, 0.1216216, 0.054054, 0.016216);
+    vec3 sum = texture(source, uv).rgb * weights[0];
+    for (int i = 1; i < 5; i++) {
+        sum += texture(source, uv + step * float(i)).rgb * weights[i];
+        sum += texture(source, uv - step * float(i)).rgb * weights[i];
+    }
+    fragColor = vec4(sum, 1.0);
+}
+)";
+
+const char *luminanceSource = R"(#version 330 core
+uniform sampler2D scene;
+in vec2 uv;
+out vec4 fragColor;
+void main() {
+    float luminance = dot(texture(scene, uv).rgb, vec3(0.2126, 0.7152, 0.0722));
+    fragColor = vec4(vec3(luminance), 1.0);
+}
+)";
+
+const char *compositeSource = R"(#version 330 core
+uniform sampler2D scene;
+uniform sampler2D bloom;
+uniform sampler2D luminance;
+uniform bool showLuminance;
+in vec2 uv;
+out vec4 fragColor;
+void main() {
+    if (showLuminance && uv.x > 0.75 && uv.y > 0.75) {
+        fragColor = texture(luminance, (uv - 0.75) * 4.0);
+        return;
+    }
+    fragColor = vec4(texture(scene, uv).rgb + texture(bloom, uv).rgb, 1.0);
+}
+)";
+
+// A fullscreen program with its samplers bound to units 0, 1, ... in order.
+GLuint link(ProgramCache &programs, const char *fragmentSource,
+           const std::initializer_list<const char*> &samplers) {
+    GLuint program = programs.link(fullscreenSource, fragmentSource);
+    if (program == 0) {
+        return 0;
+    }
+    glUseProgram(program);
+    GLint unit = 0;
+    for (const char *sampler : samplers) {
+        glUniform1i(glGetUniformLocation(program, sampler), unit++);
+    }
+    return program;
+}
+
+}
+
+PostProcess::PostProcess(StateCache &state)
+    : state_(state), graph_(state) {
+}
+
+bool PostProcess::create(ProgramCache &programs) {
+    brightProgram_ = link(programs, brightSource, {"scene"});
+    blurProgram_ = link(programs, blurSource, {"source"});
+    luminanceProgram_ = link(programs, luminanceSource, {"scene"});
+    compositeProgram_ = link(programs, compositeSource, {"scene", "bloom", "luminance"});
+    // link() made its programs current behind the cache's back.
+    state_.invalidate();
+    if (brightProgram_ == 0 || blurProgram_ == 0 || luminanceProgram_ == 0 || compositeProgram_ == 0) {
+        destroy();
+        return false;
+    }
+    blurStepLocation_ = glGetUniformLocation(blurProgram_, "step");
+    showLuminanceLocation_ = glGetUniformLocation(compositeProgram_, "showLuminance");
+    // Core profiles draw nothing without a vertex array, even an empty one.
+    glGenVertexArrays(1, &vertexArray_);
+    return true;
+}
+
+void PostProcess::destroy() {
+    graph_.releaseMemory();
+    for (GLuint *program : {&brightProgram_, &blurProgram_, &luminanceProgram_, &compositeProgram_}) {
+        if (*program != 0) {
+            state_.deletedProgram(*program);
+            glDeleteProgram(*program);
+            *program = 0;
+        }
+    }
+    if (vertexArray_ != 0) {
+        state_.deletedVertexArray(vertexArray_);
+        glDeleteVertexArrays(1, &vertexArray_);
+        vertexArray_ = 0;
+    }
+}
+
+void PostProcess::drawFullscreen(GLuint program, const std::initializer_list<GLuint> &textures) {
+    state_.useProgram(program);
+    state_.bindVertexArray(vertexArray_);
+    GLenum unit = GL_TEXTURE0;
+    for (GLuint texture : textures) {
+        state_.activeTexture(unit++);
+        state_.bindTexture(GL_TEXTURE_2D, texture);
+    }
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+void PostProcess::render(GLuint target, int width, int height, const std::function<void()> &drawScene) {
+    typedef RenderGraph::Resource Resource;
+    const RenderGraph::TextureDesc full = {width, height, GL_RGBA8};
+    const RenderGraph::TextureDesc half = {(width + 1) / 2, (height + 1) / 2, GL_RGBA8};
+    const RenderGraph::TextureDesc eighth = {(width + 7) / 8, (height + 7) / 8, GL_RGBA8};
+
+    Resource output = graph_.importFramebuffer("output", target, width, height);
+    Resource scene = -1;
+    Resource bright = -1;
+    Resource blurredX = -1;
+    Resource blurred = -1;
+    Resource luminance = -1;
+
+    graph_.addPass("scene", [&](RenderGraph::Builder &builder) {
+        scene = builder.create("scene", full);
+    }, [&](const RenderGraph::Context &) {
+        drawScene();
+    });
+
+    graph_.addPass("bright", [&](RenderGraph::Builder &builder) {
+        builder.read(scene);
+        bright = builder.create("bright", half);
+    }, [&](const RenderGraph::Context &context) {
+        drawFullscreen(brightProgram_, {context.texture(scene)});
+    });
+
+    graph_.addPass("blur x", [&](RenderGraph::Builder &builder) {
+        builder.read(bright);
+        blurredX = builder.create("blurred x", half);
+    }, [&](const RenderGraph::Context &context) {
+        state_.useProgram(blurProgram_);
+        glUniform2f(blurStepLocation_, 1.0f / context.width(), 0.0f);
+        drawFullscreen(blurProgram_, {context.texture(bright)});
+    });
+
+    graph_.addPass("blur y", [&](RenderGraph::Builder &builder) {
+        builder.read(blurredX);
+        blurred = builder.create("blurred", half);
+    }, [&](const RenderGraph::Context &context) {
+        state_.useProgram(blurProgram_);
+        glUniform2f(blurStepLocation_, 0.0f, 1.0f / context.height());
+        drawFullscreen(blurProgram_, {context.texture(blurredX)});
+    });
+
+    graph_.addPass("luminance", [&](RenderGraph::Builder &builder) {
+        builder.read(scene);
+        luminance = builder.create("luminance", eighth);
+    }, [&](const RenderGraph::Context &context) {
+        drawFullscreen(luminanceProgram_, {context.texture(scene)});
+    });
+
+    graph_.addPass("composite", [&](RenderGraph::Builder &builder) {
+        builder.read(scene);
+        builder.read(blurred);
+        if (showLuminance_) {
+            builder.read(luminance);
+        }
+        builder.write(output);
+    }, [&](const RenderGraph::Context &context) {
+        state_.useProgram(compositeProgram_);
+        glUniform1i(showLuminanceLocation_, showLuminance_ ? 1 : 0);
+        drawFullscreen(compositeProgram_, {context.texture(scene), context.texture(blurred),
+                                     showLuminance_ ? context.texture(luminance) : 0});
+    });
+
+    graph_.compile();
+    graph_.execute();
+}
@@ -0,0 +1,52 @@
+#ifndef POST_PROCESS_H
+#define POST_PROCESS_H
+
+#include "render_graph.h"
+
+#include <glad/glad.h>
+
+#include <functional>
+#include <initializer_list>
+
+class ProgramCache;
+class StateCache;
+
+// Bloom over the scene, as a render graph: the scene is drawn into a
+// texture, its bright parts are blurred at half resolution in two passes and
+// added back on top while copying to the target framebuffer. The blur's
+// second pass reuses the texture of the bright pass, and the luminance pass
+// is only kept, and given a texture, when it is shown.
+class PostProcess {
+public:
+    explicit PostProcess(StateCache &state);
+
+    // Builds the programs; false (and a message on stderr) when they do not
+    // build.
+    bool create(ProgramCache &programs);
+    void destroy();
+
+    // Draws one frame into `target` (0 for the window) through the passes.
+    // drawScene() renders into the bound framebuffer at width x height.
+    void render(GLuint target, int width, int height, const std::function<void()> &drawScene);
+
+    // Shows the scene's luminance in the top right corner.
+    void setShowLuminance(bool show) { showLuminance_ = show; }
+
+    const RenderGraph::Stats &stats() const { return graph_.stats(); }
+
+private:
+    void drawFullscreen(GLuint program, const std::initializer_list<GLuint> &textures);
+
+    StateCache &state_;
+    RenderGraph graph_;
+    bool showLuminance_ = false;
+    GLuint vertexArray_ = 0;
+    GLuint brightProgram_ = 0;
+    GLuint blurProgram_ = 0;
+    GLuint luminanceProgram_ = 0;
+    GLuint compositeProgram_ = 0;
+    GLint blurStepLocation_ = -1;
+    GLint showLuminanceLocation_ = -1;
+};
+
+#endif
@@ -0,0 +1,207 @@
+#include "program_cache.h"
+
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// File header; the binary follows.
+struct Header {
+    char magic[8];
+    uint32_t format;
+    uint32_t length;
+};
+
+const char magic[8] = {'G', 'L', 'P', 'R', 'O', 'G', '0', '1'};
+
+double millisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// FNV-1a, 64 bits; a zero byte separates the parts.
+uint64_t hash(uint64_t value, const char *text) {
+    for (const char *c = text; *c != '\0'; c++) {
+        value = (value ^ (unsigned char)*c) * 1099511628211ull;
+    }
+    return value * 1099511628211ull;
+}
+
+const char *string(GLenum name) {
+    const GLubyte *value = glGetString(name);
+    return value != nullptr ? (const char*)value : "";
+}
+
+GLuint compileShader(GLenum type, const char *source, const char *defines) {
+    // The defines go after the #version line, which has to come first.
+    const char *versionEnd = strchr(source, '\n');
+    std::string version = versionEnd != nullptr && strncmp(source, "#version", 8) == 0
+        ? std::string(source, versionEnd + 1) : std::string();
+    const char *sources[3] = {version.c_str(), defines, source + version.size()};
+
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 3, sources, nullptr);
+    glCompileShader(shader);
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[1024] = "";
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        std::cerr << "Shader compilation failed: " << log << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+}
+
+ProgramCache::ProgramCache(const std::string &directory) {
+    GLint formats = 0;
+    if (!directory.empty() && glProgramBinary != nullptr && glGetProgramBinary != nullptr &&
+        glProgramParameteri != nullptr) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    }
+    if (formats <= 0) {
+        return;
+    }
+    mkdir(directory.c_str(), 0755);
+    directory_ = directory;
+    driver_ = std::string(string(GL_VENDOR)) + "\n" + string(GL_RENDERER) + "\n" + string(GL_VERSION);
+}
+
+GLuint ProgramCache::link(const char *vertexSource, const char *fragmentSource, const char *defines) {
+    std::string path;
+    if (enabled()) {
+        uint64_t key = 14695981039346656037ull;
+        key = hash(key, vertexSource);
+        key = hash(key, fragmentSource);
+        key = hash(key, defines);
+        key = hash(key, driver_.c_str());
+        char name[32];
+        snprintf(name, sizeof(name), "/%016llx.bin", (unsigned long long)key);
+        path = directory_ + name;
+
+        Clock::time_point start = Clock::now();
+        GLuint program = load(path);
+        if (program != 0) {
+            stats_.loaded++;
+            stats_.loadMilliseconds += millisecondsSince(start);
+            return program;
+        }
+    }
+
+    Clock::time_point start = Clock::now();
+    GLuint program = compile(vertexSource, fragmentSource, defines);
+    if (program == 0) {
+        return 0;
+    }
+    if (enabled()) {
+        store(path, program);
+    }
+    stats_.compiled++;
+    stats_.compileMilliseconds += millisecondsSince(start);
+    return program;
+}
+
+GLuint ProgramCache::load(const std::string &path) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return 0;
+    }
+    // The length comes from disk, so it has to match what the file holds
+    // before anything is allocated for it; a truncated or corrupt file is a
+    // miss.
+    struct stat info;
+    Header header;
+    std::vector<char> binary;
+    bool read = fstat(fileno(file), &info) == 0 && fread(&header, sizeof(header), 1, file) == 1 &&
+        memcmp(header.magic, magic, sizeof(magic)) == 0 && header.length != 0 &&
+        (uint64_t)info.st_size == sizeof(header) + (uint64_t)header.length;
+    if (read) {
+        binary.resize(header.length);
+        read = fread(binary.data(), 1, binary.size(), file) == binary.size();
+    }
+    fclose(file);
+    if (!read) {
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, header.format, binary.data(), (GLsizei)binary.size());
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        glDeleteProgram(program);
+        stats_.rejected++;
+        return 0;
+    }
+    return program;
+}
+
+GLuint ProgramCache::compile(const char *vertexSource, const char *fragmentSource, const char *defines) {
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource, defines);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource, defines);
+    if (vertexShader == 0 || fragmentShader == 0) {
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    if (enabled()) {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[1024] = "";
+        glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+        std::cerr << "Program link failed: " << log << std::endl;
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+void ProgramCache::store(const std::string &path, GLuint program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    Header header;
+    memcpy(header.magic, magic, sizeof(magic));
+    header.format = format;
+    header.length = (uint32_t)length;
+
+    // Written next to the final name and renamed, so a run that is killed
+    // halfway, or another instance reading it, never sees half a file.
+    std::string temporary = path + ".tmp";
+    FILE *file = fopen(temporary.c_str(), "wb");
+    if (file == nullptr) {
+        return;
+    }
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+        fwrite(binary.data(), 1, (size_t)length, file) == (size_t)length;
+    written = fclose(file) == 0 && written;
+    if (!written || rename(temporary.c_str(), path.c_str()) != 0) {
+        remove(temporary.c_str());
+    }
+}
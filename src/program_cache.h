@@ -0,0 +1,50 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include <glad/glad.h>
+
+#include <string>
+
+// Builds shader programs, keeping the linked binaries on disk so later runs
+// skip compiling and linking (ARB_get_program_binary, core in GL 4.1).
+//
+// A binary is only valid for the driver that made it, so the file name is a
+// hash of the sources, the defines and the GL vendor, renderer and version
+// strings. A driver may still refuse a binary, after an update that did not
+// change those strings; then the program is compiled and the file replaced.
+// Without a directory, or when the context offers no binary formats, every
+// program is compiled.
+class ProgramCache {
+public:
+    struct Stats {
+        int loaded = 0;
+        int compiled = 0;
+        // Binaries the driver did not take back.
+        int rejected = 0;
+        double loadMilliseconds = 0.0;
+        double compileMilliseconds = 0.0;
+    };
+
+    // Call with the context current; "" for no cache.
+    explicit ProgramCache(const std::string &directory);
+
+    // A linked program, or 0 (and a message on stderr) when the shaders do
+    // not build. `defines` (e.g. "#define BLOOM 1\n") go after each
+    // source's #version line.
+    GLuint link(const char *vertexSource, const char *fragmentSource, const char *defines = "");
+
+    bool enabled() const { return !directory_.empty(); }
+    const Stats &stats() const { return stats_; }
+
+private:
+    GLuint load(const std::string &path);
+    GLuint compile(const char *vertexSource, const char *fragmentSource, const char *defines);
+    void store(const std::string &path, GLuint program);
+
+    std::string directory_;
+    // GL_VENDOR, GL_RENDERER and GL_VERSION, part of every key.
+    std::string driver_;
+    Stats stats_;
+};
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef RENDER_COMMANDS_H
+#define RENDER_COMMANDS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// The commands the simulation thread records for the render thread, and the
+// queue they travel through. Commands are plain structs written back to back
+// into a CommandBuffer; anything variable sized (the quads of a draw) is
+// allocated from the same buffer and referred to by offset, so recording a
+// frame allocates nothing once the buffer has grown to fit.
+
+namespace render {
+
+enum class CommandType : uint32_t {
+    // Data for other commands, skipped when executing.
+    Payload,
+    Viewport,
+    DrawQuads,
+    EndFrame,
+};
+
+// Every command starts 8 byte aligned.
+struct CommandHeader {
+    CommandType type;
+    uint32_t size;          // of the command after this header, padded to 8
+};
+
+struct ViewportCommand {
+    int32_t width;
+    int32_t height;
+};
+
+// Scene::Quad payload at `quads` in the same buffer, animated for `seconds`,
+// which also places the camera.
+struct DrawQuadsCommand {
+    uint32_t quads;
+    uint32_t count;
+    double seconds;
+};
+
+struct EndFrameCommand {
+    uint64_t frame;
+    // steady_clock time of the input the frame was simulated from, in
+    // nanoseconds since its epoch.
+    int64_t inputTime;
+};
+
+class CommandBuffer {
+public:
+    explicit CommandBuffer(size_t capacity = 64 * 1024) {
+        bytes_.reserve(capacity);
+    }
+
+    void clear() {
+        bytes_.clear();
+    }
+
+    template <typename T>
+    void push(CommandType type, const T &command) {
+        static_assert(std::is_trivially_copyable<T>::value, "commands are copied as bytes");
+        size_t offset = reserve(type, sizeof(T));
+        memcpy(bytes_.data() + offset, &command, sizeof(command));
+    }
+
+    // Room for `count` T, 8 byte aligned, in a Payload command; returns the
+    // offset to keep in the command using it. Write it through payload(),
+    // the buffer may move until the frame is recorded.
+    template <typename T>
+    uint32_t allocate(size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "payloads are copied as bytes");
+        static_assert(alignof(T) <= 8, "payloads are 8 byte aligned");
+        return (uint32_t)reserve(CommandType::Payload, count * sizeof(T));
+    }
+
+    template <typename T>
+    T *payload(uint32_t offset) {
+        return (T*)(bytes_.data() + offset);
+    }
+
+    template <typename T>
+    const T *payload(uint32_t offset) const {
+        return (const T*)(bytes_.data() + offset);
+    }
+
+    const unsigned char *data() const { return bytes_.data(); }
+    size_t size() const { return bytes_.size(); }
+
+private:
+    // Appends a header and `size` bytes after it; returns their offset.
+    size_t reserve(CommandType type, size_t size) {
+        CommandHeader header;
+        header.type = type;
+        header.size = (uint32_t)((size + 7) & ~(size_t)7);
+        size_t offset = bytes_.size();
+        bytes_.resize(offset + sizeof(header) + header.size);
+        memcpy(bytes_.data() + offset, &header, sizeof(header));
+        return offset + sizeof(header);
+    }
+
+    std::vector<unsigned char> bytes_;
+};
+
+// Fixed size single-producer single-consumer queue. Each index is written by
+// one side only, so a push or pop is one acquire load and one release store.
+template <typename T, size_t capacity>
+class SpscQueue {
+public:
+    static_assert((capacity & (capacity - 1)) == 0, "capacity must be a power of two");
+
+    bool push(const T &value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == capacity) {
+            return false;
+        }
+        items_[tail & (capacity - 1)] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = items_[head & (capacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T items_[capacity];
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
+
+}
+
+#endif
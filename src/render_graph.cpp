@@ -0,0 +1,348 @@
+#include "render_graph.h"
+#include "state_cache.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+bool isDepth(GLenum format) {
+    return format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH_COMPONENT24;
+}
+
+size_t bytesPerPixel(GLenum format) {
+    switch (format) {
+    case GL_RGBA16F: return 8;
+    default:         return 4;
+    }
+}
+
+GLuint createTexture(const RenderGraph::TextureDesc &desc) {
+    GLenum format = GL_RGBA;
+    GLenum type = GL_UNSIGNED_BYTE;
+    switch (desc.format) {
+    case GL_RGBA16F:
+        type = GL_HALF_FLOAT;
+        break;
+    case GL_R11F_G11F_B10F:
+        format = GL_RGB;
+        type = GL_UNSIGNED_INT_10F_11F_11F_REV;
+        break;
+    case GL_DEPTH24_STENCIL8:
+        format = GL_DEPTH_STENCIL;
+        type = GL_UNSIGNED_INT_24_8;
+        break;
+    case GL_DEPTH_COMPONENT24:
+        format = GL_DEPTH_COMPONENT;
+        type = GL_UNSIGNED_INT;
+        break;
+    }
+
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, (GLint)desc.format, desc.width, desc.height, 0, format, type, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    return texture;
+}
+
+}
+
+RenderGraph::Resource RenderGraph::Builder::create(const char *name, const TextureDesc &desc) {
+    ResourceNode resource;
+    resource.name = name;
+    resource.imported = false;
+    resource.framebuffer = 0;
+    resource.desc = desc;
+    graph_.resources_.push_back(resource);
+    Resource handle = (Resource)graph_.resources_.size() - 1;
+    write(handle);
+    return handle;
+}
+
+void RenderGraph::Builder::read(Resource resource) {
+    graph_.passes_[pass_].reads.push_back(resource);
+}
+
+void RenderGraph::Builder::write(Resource resource) {
+    PassNode &pass = graph_.passes_[pass_];
+    for (Resource written : pass.writes) {
+        if (written == resource) {
+            return;
+        }
+    }
+    pass.writes.push_back(resource);
+    graph_.resources_[resource].writers.push_back(pass_);
+}
+
+void RenderGraph::Builder::sideEffects() {
+    graph_.passes_[pass_].sideEffects = true;
+}
+
+GLuint RenderGraph::Context::texture(Resource resource) const {
+    const ResourceNode &node = graph_.resources_[resource];
+    return node.physical >= 0 ? graph_.textures_[node.physical].texture : 0;
+}
+
+RenderGraph::RenderGraph(StateCache &state)
+    : state_(state) {
+}
+
+RenderGraph::~RenderGraph() {
+    releaseMemory();
+}
+
+RenderGraph::Resource RenderGraph::importFramebuffer(const char *name, GLuint framebuffer, int width, int height) {
+    ResourceNode resource;
+    resource.name = name;
+    resource.imported = true;
+    resource.framebuffer = framebuffer;
+    resource.desc.width = width;
+    resource.desc.height = height;
+    resource.desc.format = GL_NONE;
+    resources_.push_back(resource);
+    return (Resource)resources_.size() - 1;
+}
+
+void RenderGraph::addPass(const char *name, const std::function<void(Builder &)> &setup,
+                          const std::function<void(const Context &)> &execute) {
+    PassNode pass;
+    pass.name = name;
+    pass.execute = execute;
+    passes_.push_back(pass);
+    Builder builder(*this, (int)passes_.size() - 1);
+    setup(builder);
+}
+
+void RenderGraph::compile() {
+    stats_ = Stats();
+    stats_.passes = (int)passes_.size();
+
+    // Cull from the outputs back: a resource nobody reads lets its writers
+    // go, and a pass whose writes are all unneeded stops reading its inputs.
+    for (ResourceNode &resource : resources_) {
+        resource.readers = resource.imported ? 1 : 0;
+    }
+    for (PassNode &pass : passes_) {
+        pass.references = (int)pass.writes.size();
+        for (Resource read : pass.reads) {
+            resources_[read].readers++;
+        }
+    }
+    std::vector<Resource> unused;
+    for (size_t i = 0; i < resources_.size(); i++) {
+        if (resources_[i].readers == 0) {
+            unused.push_back((Resource)i);
+        }
+    }
+    while (!unused.empty()) {
+        Resource resource = unused.back();
+        unused.pop_back();
+        for (int writer : resources_[resource].writers) {
+            PassNode &pass = passes_[writer];
+            if (pass.culled || --pass.references > 0 || pass.sideEffects) {
+                continue;
+            }
+            pass.culled = true;
+            stats_.culledPasses++;
+            for (Resource read : pass.reads) {
+                if (--resources_[read].readers == 0) {
+                    unused.push_back(read);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < passes_.size(); i++) {
+        if (passes_[i].culled) {
+            continue;
+        }
+        for (const std::vector<Resource> *list : {&passes_[i].reads, &passes_[i].writes}) {
+            for (Resource resource : *list) {
+                ResourceNode &node = resources_[resource];
+                if (node.first < 0) {
+                    node.first = (int)i;
+                }
+                node.last = (int)i;
+            }
+        }
+    }
+
+    // Hand out textures in pass order; one whose last user has run is free
+    // for the next resource of its size and format.
+    for (PooledTexture &texture : textures_) {
+        texture.busyUntil = -1;
+    }
+    for (size_t i = 0; i < passes_.size(); i++) {
+        if (passes_[i].culled) {
+            continue;
+        }
+        for (Resource resource : passes_[i].writes) {
+            ResourceNode &node = resources_[resource];
+            if (!node.imported && node.physical < 0) {
+                node.physical = acquireTexture(node.desc, (int)i, node.last);
+                stats_.transientTextures++;
+                stats_.transientBytes += (size_t)node.desc.width * node.desc.height * bytesPerPixel(node.desc.format);
+            }
+        }
+    }
+    // Textures this frame did not use, such as those of the old size after a
+    // resize, are deleted rather than kept for a frame that may never come.
+    std::vector<int> remap(textures_.size(), -1);
+    size_t kept = 0;
+    for (size_t i = 0; i < textures_.size(); i++) {
+        PooledTexture &texture = textures_[i];
+        if (texture.busyUntil < 0) {
+            state_.deletedTexture(texture.texture);
+            glDeleteTextures(1, &texture.texture);
+            continue;
+        }
+        stats_.physicalTextures++;
+        stats_.physicalBytes += (size_t)texture.desc.width * texture.desc.height * bytesPerPixel(texture.desc.format);
+        remap[i] = (int)kept;
+        textures_[kept++] = texture;
+    }
+    textures_.resize(kept);
+    for (ResourceNode &node : resources_) {
+        if (node.physical >= 0) {
+            node.physical = remap[node.physical];
+        }
+    }
+
+    std::vector<GLuint> used;
+    for (PassNode &pass : passes_) {
+        if (!pass.culled && !pass.writes.empty()) {
+            pass.framebuffer = framebufferFor(pass);
+            if (std::find(used.begin(), used.end(), pass.framebuffer) == used.end()) {
+                used.push_back(pass.framebuffer);
+            }
+        }
+    }
+    stats_.framebuffers = (int)used.size();
+
+    // Likewise the framebuffers, which also covers every one with a texture
+    // deleted above.
+    for (auto entry = framebuffers_.begin(); entry != framebuffers_.end();) {
+        if (std::find(used.begin(), used.end(), entry->second) == used.end()) {
+            state_.deletedFramebuffer(entry->second);
+            glDeleteFramebuffers(1, &entry->second);
+            entry = framebuffers_.erase(entry);
+        } else {
+            ++entry;
+        }
+    }
+    stats_.pooledTextures = (int)textures_.size();
+    stats_.pooledFramebuffers = (int)framebuffers_.size();
+}
+
+int RenderGraph::acquireTexture(const TextureDesc &desc, int pass, int last) {
+    for (size_t i = 0; i < textures_.size(); i++) {
+        PooledTexture &texture = textures_[i];
+        if (texture.busyUntil < pass && texture.desc == desc) {
+            texture.busyUntil = last;
+            return (int)i;
+        }
+    }
+    PooledTexture texture;
+    texture.texture = createTexture(desc);
+    texture.desc = desc;
+    texture.busyUntil = last;
+    textures_.push_back(texture);
+    // createTexture() bound it behind the cache's back.
+    state_.invalidate();
+    return (int)textures_.size() - 1;
+}
+
+GLuint RenderGraph::framebufferFor(PassNode &pass) {
+    std::vector<GLuint> key;
+    GLuint depth = 0;
+    for (Resource resource : pass.writes) {
+        const ResourceNode &written = resources_[resource];
+        pass.width = written.desc.width;
+        pass.height = written.desc.height;
+        if (written.imported) {
+            return written.framebuffer;
+        }
+        GLuint texture = textures_[written.physical].texture;
+        if (isDepth(written.desc.format)) {
+            depth = texture;
+        } else {
+            key.push_back(texture);
+        }
+    }
+    if (key.empty() && depth == 0) {
+        return 0;
+    }
+    size_t colors = key.size();
+    key.push_back(depth);
+
+    auto found = framebuffers_.find(key);
+    if (found != framebuffers_.end()) {
+        return found->second;
+    }
+
+    GLuint framebuffer = 0;
+    glGenFramebuffers(1, &framebuffer);
+    state_.bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    std::vector<GLenum> drawBuffers;
+    for (size_t i = 0; i < colors; i++) {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + (GLenum)i, GL_TEXTURE_2D, key[i], 0);
+        drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + (GLenum)i);
+    }
+    if (depth != 0) {
+        for (Resource resource : pass.writes) {
+            if (isDepth(resources_[resource].desc.format)) {
+                GLenum attachment = resources_[resource].desc.format == GL_DEPTH24_STENCIL8
+                    ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+                glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, depth, 0);
+            }
+        }
+    }
+    glDrawBuffers((GLsizei)drawBuffers.size(), drawBuffers.empty() ? nullptr : drawBuffers.data());
+    if (drawBuffers.empty()) {
+        glReadBuffer(GL_NONE);
+    }
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "Render graph: the framebuffer of pass " << pass.name << " is incomplete" << std::endl;
+    }
+    framebuffers_[key] = framebuffer;
+    return framebuffer;
+}
+
+void RenderGraph::execute() {
+    GLuint bound = 0;
+    bool first = true;
+    for (const PassNode &pass : passes_) {
+        if (pass.culled) {
+            continue;
+        }
+        if (!pass.writes.empty()) {
+            if (first || pass.framebuffer != bound) {
+                stats_.framebufferBinds++;
+            }
+            state_.bindFramebuffer(GL_FRAMEBUFFER, pass.framebuffer);
+            state_.viewport(0, 0, pass.width, pass.height);
+            bound = pass.framebuffer;
+            first = false;
+        }
+        pass.execute(Context(*this, pass.width, pass.height));
+    }
+    passes_.clear();
+    resources_.clear();
+}
+
+void RenderGraph::releaseMemory() {
+    for (auto &entry : framebuffers_) {
+        state_.deletedFramebuffer(entry.second);
+        glDeleteFramebuffers(1, &entry.second);
+    }
+    framebuffers_.clear();
+    for (PooledTexture &texture : textures_) {
+        state_.deletedTexture(texture.texture);
+        glDeleteTextures(1, &texture.texture);
+    }
+    textures_.clear();
+}
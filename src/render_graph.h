@@ -0,0 +1,176 @@
+#ifndef RENDER_GRAPH_H
+#define RENDER_GRAPH_H
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+class StateCache;
+
+// A frame graph over GL 3.3 framebuffer objects. Each frame the passes are
+// declared with the textures they read and write, in an order where every
+// texture is written before it is read, and run in that order; compile()
+// then
+//
+//   - culls every pass whose results nothing needs: a pass is kept when it
+//     writes an imported framebuffer, is marked with sideEffects(), or
+//     writes a texture a kept pass reads;
+//   - gives each transient texture a GL texture from a pool, sharing one
+//     between textures of the same size and format whose lifetimes (first to
+//     last pass using them) do not overlap;
+//   - finds or makes a framebuffer object for each pass's set of outputs.
+//
+// execute() then binds each pass's framebuffer through the StateCache, which
+// drops the binds between passes drawing into the same one, sets the
+// viewport, and calls the pass. The pool and the framebuffers are kept from
+// frame to frame, so after the first frame nothing is allocated in GL; what
+// a frame's compile() leaves unused, such as the textures of the old size
+// after a resize, is deleted.
+class RenderGraph {
+public:
+    // Index of a texture or imported framebuffer in the current frame.
+    typedef int Resource;
+
+    struct TextureDesc {
+        int width;
+        int height;
+        // GL_RGBA8, GL_RGBA16F, GL_R11F_G11F_B10F, GL_DEPTH24_STENCIL8 or
+        // GL_DEPTH_COMPONENT24.
+        GLenum format;
+
+        bool operator==(const TextureDesc &other) const {
+            return width == other.width && height == other.height && format == other.format;
+        }
+    };
+
+    class Builder {
+    public:
+        // A transient texture this pass writes first.
+        Resource create(const char *name, const TextureDesc &desc);
+        // Sampled by the pass.
+        void read(Resource resource);
+        // Rendered to; color textures attach in the order written, a depth
+        // format as the depth attachment. An imported framebuffer is used as
+        // it is and cannot be combined with textures.
+        void write(Resource resource);
+        // Keeps the pass even when nothing reads what it writes.
+        void sideEffects();
+
+    private:
+        friend class RenderGraph;
+        Builder(RenderGraph &graph, int pass) : graph_(graph), pass_(pass) {}
+
+        RenderGraph &graph_;
+        int pass_;
+    };
+
+    class Context {
+    public:
+        // The GL texture behind a resource the pass reads.
+        GLuint texture(Resource resource) const;
+        int width() const { return width_; }
+        int height() const { return height_; }
+
+    private:
+        friend class RenderGraph;
+        Context(const RenderGraph &graph, int width, int height)
+            : graph_(graph), width_(width), height_(height) {}
+
+        const RenderGraph &graph_;
+        int width_;
+        int height_;
+    };
+
+    struct Stats {
+        int passes = 0;
+        int culledPasses = 0;
+        int transientTextures = 0;
+        // GL textures backing them after aliasing.
+        int physicalTextures = 0;
+        // Memory the transient textures would need each on its own, and what
+        // the shared ones take.
+        size_t transientBytes = 0;
+        size_t physicalBytes = 0;
+        // Framebuffer objects the kept passes draw into, and the binds
+        // execute() made: passes drawing into the one already bound need
+        // none.
+        int framebuffers = 0;
+        int framebufferBinds = 0;
+        // What the pool holds after compile(); no more than this frame uses.
+        int pooledTextures = 0;
+        int pooledFramebuffers = 0;
+    };
+
+    explicit RenderGraph(StateCache &state);
+    ~RenderGraph();
+
+    RenderGraph(const RenderGraph &) = delete;
+    RenderGraph &operator=(const RenderGraph &) = delete;
+
+    // A framebuffer the graph draws into but does not own: 0 for the window
+    // or an application FBO. Passes writing it are never culled.
+    Resource importFramebuffer(const char *name, GLuint framebuffer, int width, int height);
+
+    void addPass(const char *name, const std::function<void(Builder &)> &setup,
+                 const std::function<void(const Context &)> &execute);
+
+    void compile();
+
+    // Runs the kept passes and forgets this frame's passes and resources.
+    void execute();
+
+    // Of the last compile() and execute().
+    const Stats &stats() const { return stats_; }
+
+    // Deletes the pooled textures and framebuffers.
+    void releaseMemory();
+
+private:
+    struct ResourceNode {
+        std::string name;
+        bool imported;
+        GLuint framebuffer;         // imported
+        TextureDesc desc;
+        std::vector<int> writers;
+        int readers = 0;            // kept passes reading it, while culling
+        int first = -1;             // kept passes using it, in order
+        int last = -1;
+        int physical = -1;          // index into textures_
+    };
+
+    struct PassNode {
+        std::string name;
+        std::function<void(const Context &)> execute;
+        std::vector<Resource> reads;
+        std::vector<Resource> writes;
+        bool sideEffects = false;
+        bool culled = false;
+        int references = 0;         // written resources still needed
+        GLuint framebuffer = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    struct PooledTexture {
+        GLuint texture;
+        TextureDesc desc;
+        int busyUntil;              // last pass using it this frame
+    };
+
+    int acquireTexture(const TextureDesc &desc, int pass, int last);
+    GLuint framebufferFor(PassNode &pass);
+
+    StateCache &state_;
+    std::vector<ResourceNode> resources_;
+    std::vector<PassNode> passes_;
+    std::vector<PooledTexture> textures_;
+    // Keyed by the attached textures, colors first then depth (0 if none).
+    std::map<std::vector<GLuint>, GLuint> framebuffers_;
+    Stats stats_;
+};
+
+#endif
@@ -0,0 +1,141 @@
+#include "render_thread.h"
+#include "scene.h"
+
+#include <chrono>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// Spins first, as the other side usually answers within microseconds, then
+// yields, then sleeps so an idle thread does not hold a core the driver
+// could use (llvmpipe rasterizes on all of them).
+void backoff(int &attempts) {
+    attempts++;
+    if (attempts < 64) {
+        return;
+    } else if (attempts < 128) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
+}
+
+RenderThread::RenderThread(Scene &scene, StateCache &state, int buffers)
+    : scene_(scene), state_(state), buffers_(buffers > 0 && buffers <= 8 ? buffers : 2) {
+    for (render::CommandBuffer &buffer : buffers_) {
+        free_.push(&buffer);
+    }
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+void RenderThread::start(const Callbacks &callbacks) {
+    callbacks_ = callbacks;
+    stopping_.store(false, std::memory_order_relaxed);
+    thread_ = std::thread(&RenderThread::run, this);
+}
+
+render::CommandBuffer *RenderThread::begin() {
+    render::CommandBuffer *buffer = nullptr;
+    if (!free_.pop(buffer)) {
+        Clock::time_point start = Clock::now();
+        int attempts = 0;
+        while (!free_.pop(buffer)) {
+            backoff(attempts);
+        }
+        waitMilliseconds_ += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+    buffer->clear();
+    return buffer;
+}
+
+void RenderThread::submit(render::CommandBuffer *buffer) {
+    // There are never more buffers than the queue holds.
+    submitted_.push(buffer);
+}
+
+void RenderThread::stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    stopping_.store(true, std::memory_order_release);
+    thread_.join();
+}
+
+void RenderThread::run() {
+    callbacks_.makeCurrent(true);
+    int attempts = 0;
+    for (;;) {
+        // Read before popping: once stopping is set nothing more is pushed,
+        // so an empty queue after that means done.
+        bool stopping = stopping_.load(std::memory_order_acquire);
+        render::CommandBuffer *buffer = nullptr;
+        if (!submitted_.pop(buffer)) {
+            if (stopping) {
+                break;
+            }
+            backoff(attempts);
+            continue;
+        }
+        attempts = 0;
+
+        Clock::time_point start = Clock::now();
+        execute(*buffer);
+        executeTimes_.add(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        free_.push(buffer);
+        probe_.poll();
+    }
+    probe_.finish();
+    callbacks_.makeCurrent(false);
+}
+
+void RenderThread::execute(const render::CommandBuffer &buffer) {
+    int width = 0;
+    int height = 0;
+    size_t offset = 0;
+    while (offset < buffer.size()) {
+        render::CommandHeader header;
+        memcpy(&header, buffer.data() + offset, sizeof(header));
+        const unsigned char *command = buffer.data() + offset + sizeof(header);
+        offset += sizeof(header) + header.size;
+
+        switch (header.type) {
+        case render::CommandType::Payload:
+            break;
+
+        case render::CommandType::Viewport: {
+            const render::ViewportCommand *viewport = (const render::ViewportCommand*)command;
+            width = viewport->width;
+            height = viewport->height;
+            break;
+        }
+
+        case render::CommandType::DrawQuads: {
+            const render::DrawQuadsCommand *draw = (const render::DrawQuadsCommand*)command;
+            const Scene::Quad *quads = buffer.payload<Scene::Quad>(draw->quads);
+            auto drawQuads = [&]() {
+                scene_.drawQuads(state_, width, height, Scene::viewAt(draw->seconds, width, height),
+                                 quads, (int)draw->count);
+            };
+            if (callbacks_.draw) {
+                callbacks_.draw(width, height, drawQuads);
+            } else {
+                drawQuads();
+            }
+            break;
+        }
+
+        case render::CommandType::EndFrame: {
+            const render::EndFrameCommand *end = (const render::EndFrameCommand*)command;
+            callbacks_.present();
+            probe_.submitted(Clock::time_point(Clock::duration(end->inputTime)));
+            break;
+        }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include "frame_stats.h"
+#include "latency_probe.h"
+#include "render_commands.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+class Scene;
+class StateCache;
+
+// Executes recorded frames on a thread of its own that owns the GL context,
+// so the thread recording them (event handling, simulation) can go on with
+// the next frame while this one is submitted to the driver.
+//
+// Frames are recorded into a fixed set of CommandBuffers that cycle through
+// two single-producer single-consumer queues: begin() takes a free buffer,
+// submit() hands it to the render thread, and the render thread returns it
+// once executed. With the default two buffers the recording thread is at
+// most one frame ahead. Neither side takes a lock; an idle side spins
+// briefly, then sleeps in short steps.
+class RenderThread {
+public:
+    struct Callbacks {
+        // Makes the context current on the calling thread, or releases it.
+        std::function<void(bool current)> makeCurrent;
+        // After each frame's commands: swap buffers or its offscreen stand-in.
+        std::function<void()> present;
+        // Optional: draws a frame around drawQuads(), which draws the scene
+        // into the bound framebuffer, e.g. through post-processing passes.
+        std::function<void(int width, int height, const std::function<void()> &drawQuads)> draw;
+    };
+
+    // The scene's GL objects must live in the context handed over.
+    RenderThread(Scene &scene, StateCache &state, int buffers = 2);
+    ~RenderThread();
+
+    RenderThread(const RenderThread &) = delete;
+    RenderThread &operator=(const RenderThread &) = delete;
+
+    // The calling thread must have released the context; the render thread
+    // takes it over.
+    void start(const Callbacks &callbacks);
+
+    // A cleared buffer to record the next frame into; waits while all of
+    // them are queued or executing.
+    render::CommandBuffer *begin();
+    void submit(render::CommandBuffer *buffer);
+
+    // Executes what is queued and ends the thread, which releases the
+    // context again.
+    void stop();
+
+    // Milliseconds the render thread spent executing each frame.
+    const FrameStats &executeTimes() const { return executeTimes_; }
+    // From EndFrameCommand::inputTime to the GPU finishing the frame.
+    const FrameStats &latencies() const { return probe_.latencies(); }
+    // Time begin() waited for a free buffer, in milliseconds.
+    double waitMilliseconds() const { return waitMilliseconds_; }
+
+private:
+    void run();
+    void execute(const render::CommandBuffer &buffer);
+
+    Scene &scene_;
+    StateCache &state_;
+    Callbacks callbacks_;
+    std::vector<render::CommandBuffer> buffers_;
+    render::SpscQueue<render::CommandBuffer*, 8> free_;
+    render::SpscQueue<render::CommandBuffer*, 8> submitted_;
+    std::atomic<bool> stopping_{false};
+    std::thread thread_;
+
+    FrameStats executeTimes_;
+    LatencyProbe probe_;
+    double waitMilliseconds_ = 0.0;
+};
+
+#endif
@@ -0,0 +1,620 @@
+// Plays a stream recorded with glcapture back as fast as the driver takes it
+// and reports how long each frame took, against the headless EGL context or
+// the mock backend.
+//
+// usage: replay <capture> [--mock] [--no-finish] [--quiet]
+//
+//   --mock       replay into the mock GL backend instead of the driver
+//   --no-finish  do not glFinish at the end of each frame; times then only
+//                cover submission, not the driver's execution
+//   --quiet      only print the summary
+
+#include <glad/glad.h>
+#include "gl_capture_format.h"
+#include "headless_context.h"
+#include "mock_gl.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace glcapture;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Names recorded at capture time to the names the replaying context handed
+// out. Names that were never created in the stream pass through unchanged.
+struct NameMap {
+    std::unordered_map<GLuint, GLuint> names;
+    std::vector<GLuint> buffer;
+
+    GLuint get(GLuint captured) const {
+        auto found = names.find(captured);
+        return found != names.end() ? found->second : captured;
+    }
+
+    GLuint *scratch(GLsizei n) {
+        buffer.assign(n > 0 ? (size_t)n : 0, 0);
+        return buffer.data();
+    }
+
+    void bind(GLsizei n, const GLuint *captured, const GLuint *replayed) {
+        for (GLsizei i = 0; captured != nullptr && i < n; i++) {
+            names[captured[i]] = replayed[i];
+        }
+    }
+
+    const GLuint *map(GLsizei n, const GLuint *captured) {
+        GLuint *mapped = scratch(n);
+        for (GLsizei i = 0; captured != nullptr && i < n; i++) {
+            mapped[i] = get(captured[i]);
+        }
+        return mapped;
+    }
+};
+
+struct SyncMap {
+    std::unordered_map<GLsync, GLsync> syncs;
+
+    GLsync get(GLsync captured) const {
+        auto found = syncs.find(captured);
+        return found != syncs.end() ? found->second : nullptr;
+    }
+};
+
+struct Replay {
+    NameMap buffers, textures, framebuffers, renderbuffers, samplers;
+    NameMap vertexArrays, queries, transformFeedbacks, pipelines;
+    // Shaders and programs share one namespace.
+    NameMap programs;
+    SyncMap syncs;
+
+    // Uniform locations and block indices by replayed program.
+    GLuint currentProgram = 0;
+    std::map<std::pair<GLuint, GLint>, GLint> locations;
+    std::map<std::pair<GLuint, GLuint>, GLuint> blockIndices;
+
+    GLuint packBuffer = 0;
+    GLint packAlignment = 4;
+    GLint packRowLength = 0;
+    std::vector<unsigned char> readback;
+
+    // By target, and by replayed buffer for glMapNamedBuffer(Range).
+    std::unordered_map<GLenum, unsigned char*> mappings;
+    std::unordered_map<GLuint, unsigned char*> namedMappings;
+
+    unsigned long long calls = 0;
+    unsigned long long skipped = 0;
+    unsigned long long unknown = 0;
+    bool malformed = false;
+
+    GLint uniformLocation(GLint captured) const {
+        return uniformLocation(currentProgram, captured);
+    }
+
+    GLint uniformLocation(GLuint program, GLint captured) const {
+        auto found = locations.find(std::make_pair(program, captured));
+        return found != locations.end() ? found->second : captured;
+    }
+
+    GLuint uniformBlock(GLuint program, GLuint captured) const {
+        auto found = blockIndices.find(std::make_pair(program, captured));
+        return found != blockIndices.end() ? found->second : captured;
+    }
+};
+
+Replay replay;
+
+// Reads the slots and blobs of one record in order.
+class Call {
+public:
+    Call(const RecordHeader *header)
+        : slots_((const unsigned char*)(header + 1)),
+          slotCount_(header->slots),
+          blobs_(slots_ + slotCount_ * sizeof(uint64_t)),
+          end_((const unsigned char*)header + header->size) {}
+
+    template <typename T>
+    T arg() {
+        T value = T();
+        if (next_ < slotCount_) {
+            memcpy(&value, slots_ + next_ * sizeof(uint64_t), sizeof(value));
+        } else {
+            replay.malformed = true;
+        }
+        next_++;
+        return value;
+    }
+
+    // The captured bytes, or the pointer value when nothing was captured.
+    const void *pointer() {
+        uint64_t value = arg<uint64_t>();
+        size_ = 0;
+        uint64_t size;
+        if (end_ - blobs_ < (ptrdiff_t)sizeof(size)) {
+            replay.malformed = true;
+            return nullptr;
+        }
+        memcpy(&size, blobs_, sizeof(size));
+        const unsigned char *data = blobs_ + sizeof(size);
+        if (size > (uint64_t)(end_ - data)) {
+            replay.malformed = true;
+            return nullptr;
+        }
+        blobs_ = data + align8(size);
+        if (size == 0) {
+            return (const void*)(uintptr_t)value;
+        }
+        size_ = (size_t)size;
+        return data;
+    }
+
+    // Size of the blob read by the last pointer().
+    size_t size() const { return size_; }
+
+private:
+    const unsigned char *slots_;
+    unsigned int slotCount_;
+    unsigned int next_ = 0;
+    const unsigned char *blobs_;
+    const unsigned char *end_;
+    size_t size_ = 0;
+};
+
+// Splits count NUL terminated strings captured as one blob.
+std::vector<const GLchar*> splitStrings(GLsizei count, const void *blob, size_t size) {
+    std::vector<const GLchar*> strings;
+    const GLchar *next = (const GLchar*)blob;
+    const GLchar *end = next + size;
+    for (GLsizei i = 0; i < count && next < end; i++) {
+        strings.push_back(next);
+        next += strnlen(next, (size_t)(end - next)) + 1;
+    }
+    if ((GLsizei)strings.size() != count) {
+        replay.malformed = true;
+    }
+    return strings;
+}
+
+// Hand written decoders: the calls that create names or need replay state.
+
+void replay_glBindBuffer(Call &call) {
+    GLenum target = call.arg<GLenum>();
+    GLuint buffer = replay.buffers.get(call.arg<GLuint>());
+    glad_glBindBuffer(target, buffer);
+    if (target == GL_PIXEL_PACK_BUFFER) {
+        replay.packBuffer = buffer;
+    }
+}
+
+void replay_glPixelStorei(Call &call) {
+    GLenum pname = call.arg<GLenum>();
+    GLint param = call.arg<GLint>();
+    glad_glPixelStorei(pname, param);
+    if (pname == GL_PACK_ALIGNMENT) {
+        replay.packAlignment = param;
+    } else if (pname == GL_PACK_ROW_LENGTH) {
+        replay.packRowLength = param;
+    }
+}
+
+void replay_glMapBufferRange(Call &call) {
+    GLenum target = call.arg<GLenum>();
+    GLintptr offset = call.arg<GLintptr>();
+    GLsizeiptr length = call.arg<GLsizeiptr>();
+    GLbitfield access = call.arg<GLbitfield>();
+    replay.mappings[target] = (unsigned char*)glad_glMapBufferRange(target, offset, length, access);
+}
+
+void replay_glMapBuffer(Call &call) {
+    GLenum target = call.arg<GLenum>();
+    GLenum access = call.arg<GLenum>();
+    replay.mappings[target] = (unsigned char*)glad_glMapBuffer(target, access);
+}
+
+void replay_glFlushMappedBufferRange(Call &call) {
+    GLenum target = call.arg<GLenum>();
+    GLintptr offset = call.arg<GLintptr>();
+    GLsizeiptr length = call.arg<GLsizeiptr>();
+    glad_glFlushMappedBufferRange(target, offset, length);
+}
+
+void replay_glUnmapBuffer(Call &call) {
+    GLenum target = call.arg<GLenum>();
+    glad_glUnmapBuffer(target);
+    replay.mappings.erase(target);
+}
+
+void replay_glMapNamedBufferRange(Call &call) {
+    GLuint buffer = replay.buffers.get(call.arg<GLuint>());
+    GLintptr offset = call.arg<GLintptr>();
+    GLsizeiptr length = call.arg<GLsizeiptr>();
+    GLbitfield access = call.arg<GLbitfield>();
+    replay.namedMappings[buffer] = (unsigned char*)glad_glMapNamedBufferRange(buffer, offset, length, access);
+}
+
+void replay_glMapNamedBuffer(Call &call) {
+    GLuint buffer = replay.buffers.get(call.arg<GLuint>());
+    GLenum access = call.arg<GLenum>();
+    replay.namedMappings[buffer] = (unsigned char*)glad_glMapNamedBuffer(buffer, access);
+}
+
+void replay_glFlushMappedNamedBufferRange(Call &call) {
+    GLuint buffer = replay.buffers.get(call.arg<GLuint>());
+    GLintptr offset = call.arg<GLintptr>();
+    GLsizeiptr length = call.arg<GLsizeiptr>();
+    glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+
+void replay_glUnmapNamedBuffer(Call &call) {
+    GLuint buffer = replay.buffers.get(call.arg<GLuint>());
+    glad_glUnmapNamedBuffer(buffer);
+    replay.namedMappings.erase(buffer);
+}
+
+void replayMappedWrite(Call &call, bool named) {
+    GLuint key = call.arg<GLuint>();
+    GLintptr offset = call.arg<GLintptr>();
+    const void *data = call.pointer();
+    std::unordered_map<GLuint, unsigned char*> &mappings = named ? replay.namedMappings : replay.mappings;
+    auto found = mappings.find(named ? replay.buffers.get(key) : key);
+    if (found != mappings.end() && found->second != nullptr && call.size() != 0) {
+        memcpy(found->second + offset, data, call.size());
+    }
+}
+
+void replay_glShaderSource(Call &call) {
+    GLuint shader = replay.programs.get(call.arg<GLuint>());
+    GLsizei count = call.arg<GLsizei>();
+    const void *sources = call.pointer();
+    std::vector<const GLchar*> strings = splitStrings(count, sources, call.size());
+    call.pointer();
+    glad_glShaderSource(shader, (GLsizei)strings.size(), strings.data(), nullptr);
+}
+
+void replay_glTransformFeedbackVaryings(Call &call) {
+    GLuint program = replay.programs.get(call.arg<GLuint>());
+    GLsizei count = call.arg<GLsizei>();
+    const void *names = call.pointer();
+    std::vector<const GLchar*> varyings = splitStrings(count, names, call.size());
+    GLenum bufferMode = call.arg<GLenum>();
+    glad_glTransformFeedbackVaryings(program, (GLsizei)varyings.size(), varyings.data(), bufferMode);
+}
+
+// Scratch space for a readback into client memory, big enough for any
+// format, as the application's memory is not part of the capture.
+void *readbackMemory(GLsizei width, GLsizei height) {
+    size_t rowLength = std::max<size_t>(replay.packRowLength, width > 0 ? width : 0);
+    size_t rowStride = rowLength * 16 + replay.packAlignment;
+    replay.readback.resize(rowStride * (height > 0 ? height : 0));
+    return replay.readback.data();
+}
+
+void replay_glReadPixels(Call &call) {
+    GLint x = call.arg<GLint>();
+    GLint y = call.arg<GLint>();
+    GLsizei width = call.arg<GLsizei>();
+    GLsizei height = call.arg<GLsizei>();
+    GLenum format = call.arg<GLenum>();
+    GLenum type = call.arg<GLenum>();
+    const void *pixels = call.pointer();
+    if (replay.packBuffer == 0) {
+        pixels = readbackMemory(width, height);
+    }
+    glad_glReadPixels(x, y, width, height, format, type, (void*)pixels);
+}
+
+void replay_glReadnPixels(Call &call) {
+    GLint x = call.arg<GLint>();
+    GLint y = call.arg<GLint>();
+    GLsizei width = call.arg<GLsizei>();
+    GLsizei height = call.arg<GLsizei>();
+    GLenum format = call.arg<GLenum>();
+    GLenum type = call.arg<GLenum>();
+    GLsizei bufSize = call.arg<GLsizei>();
+    const void *data = call.pointer();
+    if (replay.packBuffer == 0) {
+        data = readbackMemory(width, height);
+        bufSize = (GLsizei)std::min<size_t>(replay.readback.size(), 0x7fffffff);
+    }
+    glad_glReadnPixels(x, y, width, height, format, type, bufSize, (void*)data);
+}
+
+// The names are textures or renderbuffers, depending on the target that
+// follows each of them.
+void replay_glCopyImageSubData(Call &call) {
+    GLuint srcName = call.arg<GLuint>();
+    GLenum srcTarget = call.arg<GLenum>();
+    GLint srcLevel = call.arg<GLint>();
+    GLint srcX = call.arg<GLint>();
+    GLint srcY = call.arg<GLint>();
+    GLint srcZ = call.arg<GLint>();
+    GLuint dstName = call.arg<GLuint>();
+    GLenum dstTarget = call.arg<GLenum>();
+    GLint dstLevel = call.arg<GLint>();
+    GLint dstX = call.arg<GLint>();
+    GLint dstY = call.arg<GLint>();
+    GLint dstZ = call.arg<GLint>();
+    GLsizei srcWidth = call.arg<GLsizei>();
+    GLsizei srcHeight = call.arg<GLsizei>();
+    GLsizei srcDepth = call.arg<GLsizei>();
+    srcName = (srcTarget == GL_RENDERBUFFER ? replay.renderbuffers : replay.textures).get(srcName);
+    dstName = (dstTarget == GL_RENDERBUFFER ? replay.renderbuffers : replay.textures).get(dstName);
+    glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ,
+                            dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+void replay_glUseProgram(Call &call) {
+    GLuint program = replay.programs.get(call.arg<GLuint>());
+    glad_glUseProgram(program);
+    replay.currentProgram = program;
+}
+
+void replay_glCreateShader(Call &call) {
+    GLenum type = call.arg<GLenum>();
+    GLuint captured = call.arg<GLuint>();
+    GLuint shader = glad_glCreateShader(type);
+    replay.programs.bind(1, &captured, &shader);
+}
+
+void replay_glCreateProgram(Call &call) {
+    GLuint captured = call.arg<GLuint>();
+    GLuint program = glad_glCreateProgram();
+    replay.programs.bind(1, &captured, &program);
+}
+
+void replay_glCreateShaderProgramv(Call &call) {
+    GLenum type = call.arg<GLenum>();
+    GLsizei count = call.arg<GLsizei>();
+    const void *sources = call.pointer();
+    std::vector<const GLchar*> strings = splitStrings(count, sources, call.size());
+    GLuint captured = call.arg<GLuint>();
+    GLuint program = glad_glCreateShaderProgramv(type, (GLsizei)strings.size(), strings.data());
+    replay.programs.bind(1, &captured, &program);
+}
+
+void replay_glFenceSync(Call &call) {
+    GLenum condition = call.arg<GLenum>();
+    GLbitfield flags = call.arg<GLbitfield>();
+    GLsync captured = call.arg<GLsync>();
+    replay.syncs.syncs[captured] = glad_glFenceSync(condition, flags);
+}
+
+void replay_glGetUniformLocation(Call &call) {
+    GLuint program = replay.programs.get(call.arg<GLuint>());
+    const GLchar *name = (const GLchar*)call.pointer();
+    GLint captured = call.arg<GLint>();
+    if (call.size() != 0) {
+        replay.locations[std::make_pair(program, captured)] = glad_glGetUniformLocation(program, name);
+    }
+}
+
+void replay_glGetUniformBlockIndex(Call &call) {
+    GLuint program = replay.programs.get(call.arg<GLuint>());
+    const GLchar *uniformBlockName = (const GLchar*)call.pointer();
+    GLuint captured = call.arg<GLuint>();
+    if (call.size() != 0) {
+        replay.blockIndices[std::make_pair(program, captured)] =
+            glad_glGetUniformBlockIndex(program, uniformBlockName);
+    }
+}
+
+struct ReplayEntryPoint {
+    const char *name;
+    unsigned int opcode;
+    void **pointer;
+};
+
+#include "replay_decoders.inc"
+
+const size_t entryPointCount = sizeof(entryPoints) / sizeof(entryPoints[0]);
+
+// This build's opcode for an entry point named in the capture, or -1 when
+// it does not know it or the replaying context did not load it.
+int findOpcode(const char *name) {
+    auto found = std::lower_bound(entryPoints, entryPoints + entryPointCount, name,
+        [](const ReplayEntryPoint &entry, const char *key) {
+            return strcmp(entry.name, key) < 0;
+        });
+    if (found == entryPoints + entryPointCount || strcmp(found->name, name) != 0 || *found->pointer == nullptr) {
+        return -1;
+    }
+    return (int)found->opcode;
+}
+
+struct Frame {
+    double ms;
+    double capturedMs;
+    unsigned long long calls;
+};
+
+double percentile(std::vector<double> sorted, double p) {
+    std::sort(sorted.begin(), sorted.end());
+    size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+}
+
+int main(int argc, char **argv) {
+    const char *path = nullptr;
+    bool mock = false;
+    bool finish = true;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--mock") {
+            mock = true;
+        } else if (arg == "--no-finish") {
+            finish = false;
+        } else if (arg == "--quiet") {
+            quiet = true;
+        } else if (path == nullptr) {
+            path = argv[i];
+        } else {
+            path = nullptr;
+            break;
+        }
+    }
+    if (path == nullptr) {
+        std::cerr << "usage: replay <capture> [--mock] [--no-finish] [--quiet]" << std::endl;
+        return 1;
+    }
+
+    int fd = open(path, O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        std::cerr << "Failed to open " << path << std::endl;
+        return 1;
+    }
+    size_t fileSize = (size_t)info.st_size;
+    void *mapped = fileSize != 0 ? mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "Failed to map " << path << std::endl;
+        return 1;
+    }
+    const unsigned char *begin = (const unsigned char*)mapped;
+    const unsigned char *end = begin + fileSize;
+
+    FileHeader header;
+    if (fileSize < sizeof(header)) {
+        std::cerr << path << " is not a GL capture" << std::endl;
+        return 1;
+    }
+    memcpy(&header, begin, sizeof(header));
+    if (memcmp(header.magic, fileMagic, sizeof(header.magic)) != 0 || header.version == 0 || header.version > fileVersion ||
+        header.namesSize % 8 != 0 || header.namesSize > fileSize - sizeof(header)) {
+        std::cerr << path << " is not a GL capture this build can read" << std::endl;
+        return 1;
+    }
+
+    if (mock) {
+        if (!gladLoadGLLoader((GLADloadproc)mockgl::getProcAddress)) {
+            std::cerr << "Failed to load the mock backend" << std::endl;
+            return 1;
+        }
+    } else if (!createHeadlessContext() || !gladLoadGLLoader((GLADloadproc)headlessGetProcAddress)) {
+        std::cerr << "Failed to create a GL context" << std::endl;
+        return 1;
+    }
+
+    // Opcodes are positions in the capturing build's entry point list.
+    std::vector<int> opcodes;
+    const char *name = (const char*)begin + sizeof(header);
+    const char *namesEnd = name + header.namesSize;
+    while (opcodes.size() < header.opcodeCount && name < namesEnd) {
+        opcodes.push_back(findOpcode(name));
+        name += strnlen(name, (size_t)(namesEnd - name)) + 1;
+    }
+
+    std::vector<Frame> frames;
+    unsigned long long frameCalls = 0;
+    auto replayStart = Clock::now();
+    auto frameStart = replayStart;
+    const unsigned char *next = begin + sizeof(header) + header.namesSize;
+    while (next + sizeof(RecordHeader) <= end) {
+        const RecordHeader *record = (const RecordHeader*)next;
+        if (record->size < sizeof(RecordHeader) || record->size % 8 != 0 ||
+            record->size > (size_t)(end - next) ||
+            record->slots * sizeof(uint64_t) > record->size - sizeof(RecordHeader)) {
+            // A capture cut short ends with a partial record.
+            break;
+        }
+        next += record->size;
+
+        Call call(record);
+        if (record->opcode == frameMarker) {
+            call.arg<uint64_t>();
+            uint64_t capturedNs = call.arg<uint64_t>();
+            if (finish) {
+                glad_glFinish();
+            }
+            auto now = Clock::now();
+            frames.push_back(Frame{std::chrono::duration<double, std::milli>(now - frameStart).count(),
+                                   capturedNs / 1e6, frameCalls});
+            frameStart = now;
+            frameCalls = 0;
+        } else if (record->opcode == mappedWrite || record->opcode == namedMappedWrite) {
+            replayMappedWrite(call, record->opcode == namedMappedWrite);
+        } else if (record->opcode < opcodes.size() && opcodes[record->opcode] >= 0) {
+            decode((unsigned int)opcodes[record->opcode], call);
+            replay.calls++;
+            frameCalls++;
+        } else {
+            replay.unknown++;
+        }
+    }
+    if (frameCalls != 0) {
+        // Calls after the last marker, e.g. teardown.
+        if (finish) {
+            glad_glFinish();
+        }
+        auto now = Clock::now();
+        frames.push_back(Frame{std::chrono::duration<double, std::milli>(now - frameStart).count(),
+                               0.0, frameCalls});
+    }
+    double totalMs = std::chrono::duration<double, std::milli>(Clock::now() - replayStart).count();
+
+    std::cout << std::fixed << std::setprecision(3);
+    if (!quiet) {
+        for (size_t i = 0; i < frames.size(); i++) {
+            std::cout << "frame " << i << ": " << frames[i].ms << " ms, "
+                      << frames[i].calls << " calls";
+            if (frames[i].capturedMs > 0.0) {
+                std::cout << " (captured " << frames[i].capturedMs << " ms)";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    std::cout << "replayed " << replay.calls << " calls in " << frames.size() << " frames, "
+              << totalMs << " ms";
+    if (replay.skipped != 0 || replay.unknown != 0) {
+        std::cout << " (" << replay.skipped << " queries skipped, "
+                  << replay.unknown << " unsupported calls)";
+    }
+    std::cout << std::endl;
+    if (!frames.empty()) {
+        std::vector<double> times;
+        double sum = 0.0;
+        for (const Frame &frame : frames) {
+            times.push_back(frame.ms);
+            sum += frame.ms;
+        }
+        std::cout << "frame ms: mean " << sum / frames.size()
+                  << ", p50 " << percentile(times, 0.50)
+                  << ", p95 " << percentile(times, 0.95)
+                  << ", p99 " << percentile(times, 0.99)
+                  << ", max " << *std::max_element(times.begin(), times.end()) << std::endl;
+    }
+    if (mock) {
+        mockgl::Stats stats = mockgl::stats();
+        std::cout << "mock: " << stats.drawCalls << " draw calls, " << stats.vertices
+                  << " vertices, " << stats.bytesUploaded << " bytes uploaded" << std::endl;
+    }
+    if (replay.malformed) {
+        std::cerr << "warning: some records did not match their entry point" << std::endl;
+    }
+
+    if (!mock) {
+        destroyHeadlessContext();
+    }
+    munmap(mapped, fileSize);
+    return 0;
+}
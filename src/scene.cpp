@@ -0,0 +1,203 @@
+#include "scene.h"
+#include "program_cache.h"
+#include "state_cache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+namespace {
+
+const char *vertexShader = R"(#version 330 core
+layout(location = 0) in vec2 position;
+layout(std140) uniform View {
+    vec2 cameraPosition;
+    vec2 cameraZoom;
+};
+layout(std140) uniform Object {
+    vec2 offset;
+    vec2 scale;
+    vec3 color;
+};
+void main() {
+    vec2 world = position * scale + offset;
+    gl_Position = vec4((world - cameraPosition) * cameraZoom, 0.0, 1.0);
+}
+)";
+
+const char *fragmentShader = R"(#version 330 core
+layout(std140) uniform Object {
+    vec2 offset;
+    vec2 scale;
+    vec3 color;
+};
+out vec4 fragColor;
+void main() {
+    fragColor = vec4(color, 1.0);
+}
+)";
+
+// The shaders' blocks.
+struct ViewBlock {
+    std140::vec2 cameraPosition;
+    std140::vec2 cameraZoom;
+};
+static_assert(offsetof(ViewBlock, cameraZoom) == 8, "View.cameraZoom");
+static_assert(sizeof(ViewBlock) == 16, "View");
+
+struct ObjectBlock {
+    std140::vec2 offset;
+    std140::vec2 scale;
+    std140::vec3 color;
+};
+static_assert(offsetof(ObjectBlock, scale) == 8, "Object.scale");
+static_assert(offsetof(ObjectBlock, color) == 16, "Object.color");
+static_assert(sizeof(ObjectBlock) == 32, "Object");
+
+// Programs built from other sources may leave a block out.
+void bindBlocks(GLuint program) {
+    const std::pair<const char*, GLuint> blocks[] = {{"View", ViewBinding}, {"Object", ObjectBinding}};
+    for (const auto &block : blocks) {
+        GLuint index = glGetUniformBlockIndex(program, block.first);
+        if (index != GL_INVALID_INDEX) {
+            glUniformBlockBinding(program, index, block.second);
+        }
+    }
+}
+
+}
+
+Scene::Camera Scene::cameraAt(double seconds) {
+    const double pi = 3.14159265358979323846;
+    double angle = 2.0 * pi * seconds / 8.0;
+    Camera camera;
+    camera.x = 0.3f * (float)std::cos(angle);
+    camera.y = 0.3f * (float)std::sin(angle);
+    camera.zoom = 1.5f + 0.5f * (float)std::sin(2.0 * angle);
+    return camera;
+}
+
+const char *Scene::vertexSource() {
+    return vertexShader;
+}
+
+const char *Scene::fragmentSource() {
+    return fragmentShader;
+}
+
+bool Scene::create(ProgramCache &programs, int quads) {
+    program_ = programs.link(vertexShader, fragmentShader);
+    if (program_ == 0) {
+        return false;
+    }
+    bindBlocks(program_);
+    uniforms_.create();
+
+    const float vertices[] = {
+        -1.0f, -1.0f,  1.0f, -1.0f,  -1.0f, 1.0f,
+        -1.0f,  1.0f,  1.0f, -1.0f,   1.0f, 1.0f,
+    };
+    glGenVertexArrays(1, &vertexArray_);
+    glGenBuffers(1, &vertexBuffer_);
+    glBindVertexArray(vertexArray_);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer_);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glBindVertexArray(0);
+
+    quads_ = quads;
+    animated_.resize(quads);
+    return true;
+}
+
+void Scene::destroy(StateCache &state) {
+    if (program_ != 0) {
+        state.deletedProgram(program_);
+        glDeleteProgram(program_);
+    }
+    if (vertexBuffer_ != 0) {
+        state.deletedBuffer(vertexBuffer_);
+        glDeleteBuffers(1, &vertexBuffer_);
+    }
+    if (vertexArray_ != 0) {
+        state.deletedVertexArray(vertexArray_);
+        glDeleteVertexArrays(1, &vertexArray_);
+    }
+    uniforms_.destroy(state);
+    *this = Scene();
+}
+
+void Scene::setProgram(StateCache &state, GLuint program) {
+    if (program_ != 0) {
+        state.deletedProgram(program_);
+        glDeleteProgram(program_);
+    }
+    program_ = program;
+    bindBlocks(program_);
+}
+
+Scene::View Scene::viewAt(double seconds, int width, int height) {
+    Camera camera = cameraAt(seconds);
+    float aspect = height > 0 ? (float)width / height : 1.0f;
+    View view;
+    view.position[0] = camera.x;
+    view.position[1] = camera.y;
+    view.zoom[0] = camera.zoom / std::max(aspect, 1.0f);
+    view.zoom[1] = camera.zoom * std::min(aspect, 1.0f);
+    return view;
+}
+
+void Scene::animate(double seconds, Quad *quads, int count) {
+    int columns = (int)std::ceil(std::sqrt((double)count));
+    float cell = 2.0f / columns;
+    for (int i = 0; i < count; i++) {
+        int row = i / columns;
+        int column = i % columns;
+        float phase = (float)seconds * 2.0f + 0.3f * (row + column);
+        float size = cell * (0.3f + 0.1f * std::sin(phase));
+        Quad &quad = quads[i];
+        quad.offset[0] = -1.0f + cell * (column + 0.5f);
+        quad.offset[1] = -1.0f + cell * (row + 0.5f);
+        quad.scale[0] = size;
+        quad.scale[1] = size;
+        quad.color[0] = 0.5f + 0.5f * std::sin(phase);
+        quad.color[1] = (float)column / columns;
+        quad.color[2] = (float)row / columns;
+    }
+}
+
+void Scene::drawQuads(StateCache &state, int width, int height, const View &view, const Quad *quads, int count) {
+    state.viewport(0, 0, width, height);
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Every block of the frame goes up in one upload before the first draw.
+    uniforms_.begin();
+    ViewBlock viewBlock = {{view.position[0], view.position[1]}, {view.zoom[0], view.zoom[1]}};
+    GLintptr viewOffset = uniforms_.append(viewBlock);
+    objectOffsets_.resize(count);
+    for (int i = 0; i < count; i++) {
+        const Quad &quad = quads[i];
+        ObjectBlock object = {{quad.offset[0], quad.offset[1]}, {quad.scale[0], quad.scale[1]},
+                              {quad.color[0], quad.color[1], quad.color[2]}};
+        objectOffsets_[i] = uniforms_.append(object);
+    }
+    uniforms_.upload(state);
+
+    state.useProgram(program_);
+    state.bindVertexArray(vertexArray_);
+    uniforms_.bind<ViewBlock>(state, ViewBinding, viewOffset);
+    for (int i = 0; i < count; i++) {
+        uniforms_.bind<ObjectBlock>(state, ObjectBinding, objectOffsets_[i]);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    uniforms_.end();
+}
+
+void Scene::draw(StateCache &state, double seconds, int width, int height) {
+    animated_.resize(quads_);
+    animate(seconds, animated_.data(), quads_);
+    drawQuads(state, width, height, viewAt(seconds, width, height), animated_.data(), quads_);
+}
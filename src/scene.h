@@ -0,0 +1,83 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include "uniform_buffer.h"
+
+#include <glad/glad.h>
+
+#include <vector>
+
+class ProgramCache;
+class StateCache;
+
+// The test load for the render loop: a grid of quads, one draw call each
+// with its own uniform block, swaying over time, seen through a camera that
+// follows a fixed path. Enough GL traffic to measure the loop and the driver
+// with, and the same image on every run for a given time.
+class Scene {
+public:
+    struct Camera {
+        float x;
+        float y;
+        float zoom;
+    };
+
+    // The camera in clip space terms, with the aspect ratio folded into the
+    // zoom: a point p of the grid lands at (p - position) * zoom.
+    struct View {
+        float position[2];
+        float zoom[2];
+    };
+
+    // What a quad's draw call needs, on the grid; the vertex shader applies
+    // the view.
+    struct Quad {
+        float offset[2];
+        float scale[2];
+        float color[3];
+    };
+
+    // Circles the grid while zooming in and out, one loop every 8 seconds.
+    static Camera cameraAt(double seconds);
+
+    // cameraAt(seconds) for a width x height viewport.
+    static View viewAt(double seconds, int width, int height);
+
+    // Fills the first `count` quads of the grid for `seconds` into the
+    // animation. Makes no GL calls, so it may run on any thread.
+    static void animate(double seconds, Quad *quads, int count);
+
+    // Builds the program and uploads the quad; false (and a message on
+    // stderr) when the shaders do not build.
+    bool create(ProgramCache &programs, int quads);
+    void destroy(StateCache &state);
+
+    // Swaps in a program built from other sources with the same uniform
+    // blocks, taking it over and deleting the old one.
+    void setProgram(StateCache &state, GLuint program);
+
+    // The built-in shader sources.
+    static const char *vertexSource();
+    static const char *fragmentSource();
+
+    // Clears the bound framebuffer and draws the quads, one call each. The
+    // view and every quad's block are uploaded first, in one buffer, and
+    // each draw binds its quad's range of it.
+    void drawQuads(StateCache &state, int width, int height, const View &view, const Quad *quads, int count);
+
+    // animate() and drawQuads() in one.
+    void draw(StateCache &state, double seconds, int width, int height);
+
+    int quads() const { return quads_; }
+
+private:
+    int quads_ = 0;
+    GLuint program_ = 0;
+    GLuint vertexArray_ = 0;
+    GLuint vertexBuffer_ = 0;
+    UniformBuffer uniforms_;
+    std::vector<GLintptr> objectOffsets_;
+    std::vector<Quad> animated_;
+};
+
+#endif
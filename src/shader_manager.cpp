@@ -0,0 +1,378 @@
+#include "shader_manager.h"
+#include "program_cache.h"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+bool readFile(const std::string &path, std::string &text) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    text.clear();
+    char buffer[4096];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, read);
+    }
+    bool failed = ferror(file) != 0;
+    fclose(file);
+    return !failed;
+}
+
+// "shaders/scene.vert" -> ("shaders", "scene.vert"), "scene.vert" -> (".", ...).
+std::pair<std::string, std::string> splitPath(const std::string &path) {
+    size_t slash = path.rfind('/');
+    if (slash == std::string::npos) {
+        return std::make_pair(std::string("."), path);
+    }
+    return std::make_pair(slash == 0 ? std::string("/") : path.substr(0, slash), path.substr(slash + 1));
+}
+
+GLuint createShader(GLenum type, const std::string &source) {
+    GLuint shader = glCreateShader(type);
+    const char *text = source.c_str();
+    glShaderSource(shader, 1, &text, nullptr);
+    glCompileShader(shader);
+    return shader;
+}
+
+// The compile log of a shader that failed, or "".
+std::string shaderLog(GLuint shader, const char *name) {
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_TRUE) {
+        return std::string();
+    }
+    char log[1024] = "";
+    glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+    return std::string(name) + ": " + log;
+}
+
+// Compile and link errors of a program that did not link, or "".
+std::string buildLog(GLuint program, GLuint vertexShader, GLuint fragmentShader) {
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_TRUE) {
+        return std::string();
+    }
+    std::string log = shaderLog(vertexShader, "vertex shader") + shaderLog(fragmentShader, "fragment shader");
+    if (log.empty()) {
+        char text[1024] = "";
+        glGetProgramInfoLog(program, sizeof(text), nullptr, text);
+        log = text;
+    }
+    return log;
+}
+
+// Asked of the context rather than the loader, which the minimal loader and
+// thread local dispatch both keep elsewhere.
+bool hasExtension(const char *name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++) {
+        const GLubyte *extension = glGetStringi(GL_EXTENSIONS, (GLuint)i);
+        if (extension != nullptr && strcmp((const char*)extension, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+ShaderManager::ShaderManager(ProgramCache &programs, const WorkerContext &workerContext, bool allowParallelCompile)
+    : programs_(programs), workerContext_(workerContext) {
+    if (allowParallelCompile && glMaxShaderCompilerThreadsKHR != nullptr &&
+        hasExtension("GL_KHR_parallel_shader_compile")) {
+        // As many threads as the driver likes.
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+        mode_ = Mode::ParallelCompile;
+    } else if (workerContext_) {
+        mode_ = Mode::WorkerThread;
+        worker_ = std::thread(&ShaderManager::work, this);
+    }
+    inotify_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_ < 0) {
+        std::cerr << "inotify is not available, shaders are not reloaded" << std::endl;
+    }
+}
+
+ShaderManager::~ShaderManager() {
+    if (worker_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        worker_.join();
+        for (Build &build : done_) {
+            building_.push_back(build);
+        }
+    }
+    // Programs still building are dropped.
+    for (Build &build : building_) {
+        if (build.fence != nullptr) {
+            glDeleteSync(build.fence);
+        }
+        glDeleteShader(build.vertexShader);
+        glDeleteShader(build.fragmentShader);
+        glDeleteProgram(build.program);
+    }
+    if (inotify_ >= 0) {
+        close(inotify_);
+    }
+}
+
+bool ShaderManager::watch(const std::string &vertexPath, const std::string &fragmentPath, const Listener &listener) {
+    std::string vertexSource;
+    std::string fragmentSource;
+    for (const std::string *path : {&vertexPath, &fragmentPath}) {
+        if (!readFile(*path, path == &vertexPath ? vertexSource : fragmentSource)) {
+            std::cerr << "Failed to read " << *path << std::endl;
+            return false;
+        }
+    }
+    GLuint program = programs_.link(vertexSource.c_str(), fragmentSource.c_str());
+    if (program == 0) {
+        return false;
+    }
+    listener(program);
+
+    Watched watched;
+    watched.vertexPath = vertexPath;
+    watched.fragmentPath = fragmentPath;
+    watched.listener = listener;
+    watched_.push_back(watched);
+
+    for (const std::string *path : {&vertexPath, &fragmentPath}) {
+        std::string directory = splitPath(*path).first;
+        bool known = false;
+        for (const auto &entry : directories_) {
+            known = known || entry.second == directory;
+        }
+        if (inotify_ >= 0 && !known) {
+            int descriptor = inotify_add_watch(inotify_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+            if (descriptor < 0) {
+                std::cerr << "Failed to watch " << directory << std::endl;
+            } else {
+                directories_.push_back(std::make_pair(descriptor, directory));
+            }
+        }
+    }
+    return true;
+}
+
+void ShaderManager::readEvents() {
+    if (inotify_ < 0) {
+        return;
+    }
+    alignas(inotify_event) char buffer[4096];
+    for (;;) {
+        ssize_t length = read(inotify_, buffer, sizeof(buffer));
+        if (length <= 0) {
+            if (length < 0 && errno != EAGAIN) {
+                std::cerr << "Reading inotify events failed" << std::endl;
+            }
+            return;
+        }
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event *event = (const inotify_event*)(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+            if (event->len == 0) {
+                continue;
+            }
+            std::string directory;
+            for (const auto &entry : directories_) {
+                if (entry.first == event->wd) {
+                    directory = entry.second;
+                }
+            }
+            for (Watched &watched : watched_) {
+                if (watched.changed) {
+                    continue;
+                }
+                for (const std::string *path : {&watched.vertexPath, &watched.fragmentPath}) {
+                    std::pair<std::string, std::string> split = splitPath(*path);
+                    if (split.first == directory && split.second == event->name) {
+                        watched.changed = true;
+                        watched.changedAt = Clock::now();
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ShaderManager::start(size_t index) {
+    Watched &watched = watched_[index];
+    Build build;
+    build.watched = index;
+    if (!readFile(watched.vertexPath, build.vertexSource) || !readFile(watched.fragmentPath, build.fragmentSource)) {
+        // Probably caught halfway through being replaced; the rename that
+        // finishes it brings another event.
+        watched.changed = false;
+        return;
+    }
+    watched.changed = false;
+    watched.building = true;
+
+    if (mode_ == Mode::WorkerThread) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queued_.push_back(build);
+        }
+        wake_.notify_one();
+        return;
+    }
+
+    // With parallel compile none of this waits, the driver queues the link
+    // behind the compiles.
+    build.vertexShader = createShader(GL_VERTEX_SHADER, build.vertexSource);
+    build.fragmentShader = createShader(GL_FRAGMENT_SHADER, build.fragmentSource);
+    build.program = glCreateProgram();
+    glAttachShader(build.program, build.vertexShader);
+    glAttachShader(build.program, build.fragmentShader);
+    glLinkProgram(build.program);
+    building_.push_back(build);
+}
+
+bool ShaderManager::finished(Build &build) {
+    switch (mode_) {
+    case Mode::ParallelCompile: {
+        GLint completed = GL_FALSE;
+        glGetProgramiv(build.program, GL_COMPLETION_STATUS_KHR, &completed);
+        return completed == GL_TRUE;
+    }
+    case Mode::WorkerThread: {
+        if (build.fence == nullptr) {
+            return true;
+        }
+        GLenum status = glClientWaitSync(build.fence, 0, 0);
+        return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+    }
+    case Mode::Blocking:
+        break;
+    }
+    return true;
+}
+
+void ShaderManager::finish(Build &build) {
+    Watched &watched = watched_[build.watched];
+    watched.building = false;
+    if (build.fence != nullptr) {
+        glDeleteSync(build.fence);
+    }
+
+    std::string error = build.error;
+    if (error.empty()) {
+        error = buildLog(build.program, build.vertexShader, build.fragmentShader);
+    }
+    glDeleteShader(build.vertexShader);
+    glDeleteShader(build.fragmentShader);
+    if (!error.empty()) {
+        std::cerr << "Rebuilding " << watched.vertexPath << " + " << watched.fragmentPath
+                  << " failed, keeping the old program: " << error << std::endl;
+        glDeleteProgram(build.program);
+        stats_.failures++;
+        return;
+    }
+
+    double milliseconds = millisecondsSince(watched.changedAt);
+    if (milliseconds > stats_.longestBuildMilliseconds) {
+        stats_.longestBuildMilliseconds = milliseconds;
+    }
+    stats_.builds++;
+    std::cout << "Rebuilt " << watched.vertexPath << " + " << watched.fragmentPath << " in "
+              << milliseconds << " ms" << std::endl;
+    watched.listener(build.program);
+}
+
+void ShaderManager::update() {
+    Clock::time_point began = Clock::now();
+    readEvents();
+    for (size_t i = 0; i < watched_.size(); i++) {
+        if (watched_[i].changed && !watched_[i].building) {
+            start(i);
+        }
+    }
+    if (mode_ == Mode::WorkerThread) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (!done_.empty()) {
+            building_.push_back(done_.front());
+            done_.pop_front();
+        }
+    }
+    for (size_t i = 0; i < building_.size();) {
+        if (finished(building_[i])) {
+            finish(building_[i]);
+            building_.erase(building_.begin() + i);
+        } else {
+            i++;
+        }
+    }
+
+    double milliseconds = millisecondsSince(began);
+    if (milliseconds > stats_.longestUpdateMilliseconds) {
+        stats_.longestUpdateMilliseconds = milliseconds;
+    }
+}
+
+void ShaderManager::work() {
+    bool current = workerContext_(true);
+    if (!current) {
+        std::cerr << "Failed to make the shader worker's context current" << std::endl;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this]() {
+            return stopping_ || !queued_.empty();
+        });
+        if (stopping_) {
+            break;
+        }
+        Build build = queued_.front();
+        queued_.pop_front();
+        if (!current) {
+            // No GL calls without a context; finish() reports it and keeps
+            // the old program.
+            build.error = "the shader worker has no GL context";
+            done_.push_back(build);
+            continue;
+        }
+        lock.unlock();
+
+        // Blocking here is the point: it is not the render thread.
+        build.vertexShader = createShader(GL_VERTEX_SHADER, build.vertexSource);
+        build.fragmentShader = createShader(GL_FRAGMENT_SHADER, build.fragmentSource);
+        build.program = glCreateProgram();
+        glAttachShader(build.program, build.vertexShader);
+        glAttachShader(build.program, build.fragmentShader);
+        glLinkProgram(build.program);
+        build.error = buildLog(build.program, build.vertexShader, build.fragmentShader);
+        if (build.error.empty()) {
+            // The render context may only use the program once the commands
+            // that built it have finished.
+            build.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+        glFlush();
+
+        lock.lock();
+        done_.push_back(build);
+    }
+    lock.unlock();
+    if (current) {
+        workerContext_(false);
+    }
+}
@@ -0,0 +1,129 @@
+#ifndef SHADER_MANAGER_H
+#define SHADER_MANAGER_H
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ProgramCache;
+
+// Rebuilds programs when their source files change on disk, without the
+// render loop ever waiting for the compiler.
+//
+// Files are watched with inotify, on their directories, since editors
+// usually save by writing a new file and renaming it over the old one.
+// update(), called once a frame on the thread that has the context, starts
+// the builds and hands out the ones that have finished:
+//
+//   - with KHR_parallel_shader_compile the driver compiles and links on its
+//     own threads, and GL_COMPLETION_STATUS_KHR says when a program is done,
+//     so its link status can be read without blocking;
+//   - otherwise, given a second context sharing objects with the render
+//     context, a worker thread compiles and links there and fences the
+//     result, and update() takes the program once the fence has signaled;
+//   - without either, update() builds the program itself, and stalls.
+//
+// A program that fails to build leaves the old one in place and logs why.
+class ShaderManager {
+public:
+    // Called on the render thread with each newly built program, which it
+    // then owns.
+    typedef std::function<void(GLuint program)> Listener;
+    // Makes the shared context current on the calling thread, or releases
+    // it; false when that failed.
+    typedef std::function<bool(bool current)> WorkerContext;
+
+    enum class Mode {
+        ParallelCompile,
+        WorkerThread,
+        Blocking,
+    };
+
+    struct Stats {
+        int builds = 0;
+        int failures = 0;
+        // The longest update(), which is what a frame waits for.
+        double longestUpdateMilliseconds = 0.0;
+        // The longest build, from the change being seen to the program being
+        // handed out.
+        double longestBuildMilliseconds = 0.0;
+    };
+
+    // Call with the render context current. Pass allowParallelCompile false
+    // to use the worker even when the extension is there.
+    explicit ShaderManager(ProgramCache &programs, const WorkerContext &workerContext = WorkerContext(),
+                           bool allowParallelCompile = true);
+    ~ShaderManager();
+
+    ShaderManager(const ShaderManager &) = delete;
+    ShaderManager &operator=(const ShaderManager &) = delete;
+
+    // Builds the program from the two files now, through the program cache,
+    // and again each time one of them changes. False (and a message on
+    // stderr) when a file cannot be read or the program does not build.
+    bool watch(const std::string &vertexPath, const std::string &fragmentPath, const Listener &listener);
+
+    void update();
+
+    Mode mode() const { return mode_; }
+    const Stats &stats() const { return stats_; }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Watched {
+        std::string vertexPath;
+        std::string fragmentPath;
+        Listener listener;
+        bool changed = false;
+        bool building = false;
+        Clock::time_point changedAt;
+    };
+
+    // A build in flight.
+    struct Build {
+        size_t watched;
+        GLuint program = 0;
+        GLuint vertexShader = 0;
+        GLuint fragmentShader = 0;
+        GLsync fence = nullptr;
+        std::string vertexSource;
+        std::string fragmentSource;
+        // Set by the worker when it gave up, with the reason.
+        std::string error;
+    };
+
+    void readEvents();
+    void start(size_t watched);
+    bool finished(Build &build);
+    void finish(Build &build);
+    void work();
+
+    ProgramCache &programs_;
+    WorkerContext workerContext_;
+    Mode mode_ = Mode::Blocking;
+    int inotify_ = -1;
+    // Watch descriptors and the directories they watch.
+    std::vector<std::pair<int, std::string>> directories_;
+    std::vector<Watched> watched_;
+    std::vector<Build> building_;
+
+    // Worker mode: builds go in through queued_, come back through done_.
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<Build> queued_;
+    std::deque<Build> done_;
+    bool stopping_ = false;
+
+    Stats stats_;
+};
+
+#endif
@@ -0,0 +1,283 @@
+#include "state_cache.h"
+
+namespace {
+
+int bufferIndex(GLenum target) {
+    switch (target) {
+    case GL_ARRAY_BUFFER:              return 0;
+    case GL_ELEMENT_ARRAY_BUFFER:      return 1;
+    case GL_COPY_READ_BUFFER:          return 2;
+    case GL_COPY_WRITE_BUFFER:         return 3;
+    case GL_PIXEL_PACK_BUFFER:         return 4;
+    case GL_PIXEL_UNPACK_BUFFER:       return 5;
+    case GL_TEXTURE_BUFFER:            return 6;
+    case GL_TRANSFORM_FEEDBACK_BUFFER: return 7;
+    case GL_UNIFORM_BUFFER:            return 8;
+    default:                           return -1;
+    }
+}
+
+int textureIndex(GLenum target) {
+    switch (target) {
+    case GL_TEXTURE_1D:                   return 0;
+    case GL_TEXTURE_2D:                   return 1;
+    case GL_TEXTURE_3D:                   return 2;
+    case GL_TEXTURE_1D_ARRAY:             return 3;
+    case GL_TEXTURE_2D_ARRAY:             return 4;
+    case GL_TEXTURE_RECTANGLE:            return 5;
+    case GL_TEXTURE_CUBE_MAP:             return 6;
+    case GL_TEXTURE_BUFFER:               return 7;
+    case GL_TEXTURE_2D_MULTISAMPLE:       return 8;
+    case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 9;
+    default:                              return -1;
+    }
+}
+
+int capIndex(GLenum cap) {
+    switch (cap) {
+    case GL_BLEND:                    return 0;
+    case GL_CULL_FACE:                return 1;
+    case GL_DEPTH_TEST:               return 2;
+    case GL_STENCIL_TEST:             return 3;
+    case GL_SCISSOR_TEST:             return 4;
+    case GL_POLYGON_OFFSET_FILL:      return 5;
+    case GL_MULTISAMPLE:              return 6;
+    case GL_FRAMEBUFFER_SRGB:         return 7;
+    case GL_PRIMITIVE_RESTART:        return 8;
+    case GL_PROGRAM_POINT_SIZE:       return 9;
+    case GL_RASTERIZER_DISCARD:       return 10;
+    case GL_DEPTH_CLAMP:              return 11;
+    case GL_TEXTURE_CUBE_MAP_SEAMLESS: return 12;
+    case GL_SAMPLE_ALPHA_TO_COVERAGE: return 13;
+    case GL_LINE_SMOOTH:              return 14;
+    case GL_POLYGON_SMOOTH:           return 15;
+    case GL_DITHER:                   return 16;
+    default:                          return -1;
+    }
+}
+
+}
+
+StateCache::StateCache() {
+    invalidate();
+}
+
+bool StateCache::changed(GLuint &cached, GLuint value) {
+    if (cached == value) {
+        stats_.skipped++;
+        return false;
+    }
+    cached = value;
+    stats_.issued++;
+    return true;
+}
+
+void StateCache::useProgram(GLuint program) {
+    if (changed(program_, program)) {
+        glUseProgram(program);
+    }
+}
+
+void StateCache::bindVertexArray(GLuint array) {
+    if (changed(vertexArray_, array)) {
+        glBindVertexArray(array);
+        // The element array binding is part of the vertex array object.
+        buffers_[bufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = unknown;
+    }
+}
+
+void StateCache::bindBuffer(GLenum target, GLuint buffer) {
+    int index = bufferIndex(target);
+    if (index < 0) {
+        stats_.issued++;
+        glBindBuffer(target, buffer);
+    } else if (changed(buffers_[index], buffer)) {
+        glBindBuffer(target, buffer);
+    }
+}
+
+void StateCache::bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    if (target == GL_UNIFORM_BUFFER && index < (GLuint)uniformBindings) {
+        Range &range = uniformRanges_[index];
+        if (range.buffer == buffer && range.offset == offset && range.size == size) {
+            stats_.skipped++;
+            return;
+        }
+        range.buffer = buffer;
+        range.offset = offset;
+        range.size = size;
+    }
+    stats_.issued++;
+    glBindBufferRange(target, index, buffer, offset, size);
+    int generic = bufferIndex(target);
+    if (generic >= 0) {
+        buffers_[generic] = buffer;
+    }
+}
+
+void StateCache::activeTexture(GLenum unit) {
+    if (changed(activeUnit_, unit)) {
+        glActiveTexture(unit);
+    }
+}
+
+void StateCache::bindTexture(GLenum target, GLuint texture) {
+    int index = textureIndex(target);
+    GLuint unit = activeUnit_ - GL_TEXTURE0;
+    if (index < 0 || activeUnit_ == unknown || unit >= (GLuint)textureUnits) {
+        stats_.issued++;
+        glBindTexture(target, texture);
+    } else if (changed(textures_[unit][index], texture)) {
+        glBindTexture(target, texture);
+    }
+}
+
+void StateCache::enable(GLenum cap) {
+    int index = capIndex(cap);
+    if (index < 0) {
+        stats_.issued++;
+        glEnable(cap);
+    } else if (changed(caps_[index], GL_TRUE)) {
+        glEnable(cap);
+    }
+}
+
+void StateCache::disable(GLenum cap) {
+    int index = capIndex(cap);
+    if (index < 0) {
+        stats_.issued++;
+        glDisable(cap);
+    } else if (changed(caps_[index], GL_FALSE)) {
+        glDisable(cap);
+    }
+}
+
+void StateCache::blendFunc(GLenum sfactor, GLenum dfactor) {
+    if (blendSrc_ == sfactor && blendDst_ == dfactor) {
+        stats_.skipped++;
+        return;
+    }
+    blendSrc_ = sfactor;
+    blendDst_ = dfactor;
+    stats_.issued++;
+    glBlendFunc(sfactor, dfactor);
+}
+
+void StateCache::depthMask(GLboolean flag) {
+    if (changed(depthMask_, flag ? GL_TRUE : GL_FALSE)) {
+        glDepthMask(flag);
+    }
+}
+
+void StateCache::viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (viewportKnown_ && viewport_[0] == x && viewport_[1] == y &&
+        viewport_[2] == width && viewport_[3] == height) {
+        stats_.skipped++;
+        return;
+    }
+    viewport_[0] = x;
+    viewport_[1] = y;
+    viewport_[2] = width;
+    viewport_[3] = height;
+    viewportKnown_ = true;
+    stats_.issued++;
+    glViewport(x, y, width, height);
+}
+
+void StateCache::bindFramebuffer(GLenum target, GLuint framebuffer) {
+    switch (target) {
+    case GL_FRAMEBUFFER:
+        if (drawFramebuffer_ == framebuffer && readFramebuffer_ == framebuffer) {
+            stats_.skipped++;
+            return;
+        }
+        drawFramebuffer_ = readFramebuffer_ = framebuffer;
+        stats_.issued++;
+        break;
+    case GL_DRAW_FRAMEBUFFER:
+        if (!changed(drawFramebuffer_, framebuffer)) {
+            return;
+        }
+        break;
+    case GL_READ_FRAMEBUFFER:
+        if (!changed(readFramebuffer_, framebuffer)) {
+            return;
+        }
+        break;
+    default:
+        stats_.issued++;
+        break;
+    }
+    glBindFramebuffer(target, framebuffer);
+}
+
+void StateCache::deletedProgram(GLuint program) {
+    // A deleted program stays in use until another one is installed, but
+    // its name may be handed out again.
+    if (program_ == program) {
+        program_ = unknown;
+    }
+}
+
+void StateCache::deletedVertexArray(GLuint array) {
+    if (vertexArray_ == array) {
+        vertexArray_ = 0;
+        buffers_[bufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = unknown;
+    }
+}
+
+void StateCache::deletedBuffer(GLuint buffer) {
+    for (GLuint &bound : buffers_) {
+        if (bound == buffer) {
+            bound = 0;
+        }
+    }
+    for (Range &range : uniformRanges_) {
+        if (range.buffer == buffer) {
+            range.buffer = 0;
+        }
+    }
+}
+
+void StateCache::deletedTexture(GLuint texture) {
+    for (auto &unit : textures_) {
+        for (GLuint &bound : unit) {
+            if (bound == texture) {
+                bound = 0;
+            }
+        }
+    }
+}
+
+void StateCache::deletedFramebuffer(GLuint framebuffer) {
+    if (drawFramebuffer_ == framebuffer) {
+        drawFramebuffer_ = 0;
+    }
+    if (readFramebuffer_ == framebuffer) {
+        readFramebuffer_ = 0;
+    }
+}
+
+void StateCache::invalidate() {
+    program_ = unknown;
+    vertexArray_ = unknown;
+    for (GLuint &bound : buffers_) {
+        bound = unknown;
+    }
+    for (Range &range : uniformRanges_) {
+        range.buffer = unknown;
+    }
+    activeUnit_ = unknown;
+    for (auto &unit : textures_) {
+        for (GLuint &bound : unit) {
+            bound = unknown;
+        }
+    }
+    for (GLuint &state : caps_) {
+        state = unknown;
+    }
+    blendSrc_ = blendDst_ = unknown;
+    depthMask_ = unknown;
+    viewportKnown_ = false;
+    drawFramebuffer_ = readFramebuffer_ = unknown;
+}
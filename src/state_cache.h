@@ -0,0 +1,83 @@
+#ifndef STATE_CACHE_H
+#define STATE_CACHE_H
+
+#include <glad/glad.h>
+
+// Shadows the most frequently changed bits of GL state and drops calls that
+// would set what is already set, so the driver does not validate them again.
+//
+// Everything starts out unknown, so the first call of each kind always goes
+// through. Code that changes state behind the cache's back (including
+// glBindBufferBase, and glBindBufferRange other than through
+// bindBufferRange(), which also replace the generic binding) has to call
+// invalidate() afterwards. Deleting a bound object resets the binding in GL,
+// so deletions must be reported through the deleted*() functions.
+class StateCache {
+public:
+    struct Stats {
+        unsigned long long issued = 0;
+        unsigned long long skipped = 0;
+    };
+
+    StateCache();
+
+    void useProgram(GLuint program);
+    void bindVertexArray(GLuint array);
+    void bindBuffer(GLenum target, GLuint buffer);
+    // Shadowed for the first uniformBindings uniform buffer binding points.
+    void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+    void activeTexture(GLenum unit);
+    void bindTexture(GLenum target, GLuint texture);
+    void enable(GLenum cap);
+    void disable(GLenum cap);
+    void blendFunc(GLenum sfactor, GLenum dfactor);
+    void depthMask(GLboolean flag);
+    void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+    void bindFramebuffer(GLenum target, GLuint framebuffer);
+
+    void deletedProgram(GLuint program);
+    void deletedVertexArray(GLuint array);
+    void deletedBuffer(GLuint buffer);
+    void deletedTexture(GLuint texture);
+    void deletedFramebuffer(GLuint framebuffer);
+
+    // Forgets all shadowed state; the next call of every kind goes through.
+    void invalidate();
+
+    const Stats &stats() const { return stats_; }
+    void resetStats() { stats_ = Stats(); }
+
+private:
+    static const int bufferTargets = 9;
+    static const int textureUnits = 32;
+    static const int textureTargets = 10;
+    static const int caps = 17;
+    static const int uniformBindings = 16;
+
+    // Unknown state; no valid GL name or value uses it.
+    static const GLuint unknown = 0xFFFFFFFFu;
+
+    bool changed(GLuint &cached, GLuint value);
+
+    GLuint program_;
+    GLuint vertexArray_;
+    GLuint buffers_[bufferTargets];
+    struct Range {
+        GLuint buffer;
+        GLintptr offset;
+        GLsizeiptr size;
+    };
+    Range uniformRanges_[uniformBindings];
+    GLuint activeUnit_;
+    GLuint textures_[textureUnits][textureTargets];
+    GLuint caps_[caps];
+    GLuint blendSrc_, blendDst_;
+    GLuint depthMask_;
+    GLint viewport_[4];
+    bool viewportKnown_;
+    GLuint drawFramebuffer_, readFramebuffer_;
+
+    Stats stats_;
+};
+
+#endif
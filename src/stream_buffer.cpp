@@ -0,0 +1,151 @@
+#include "stream_buffer.h"
+#include "state_cache.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+#ifdef GLAD_MINIMAL_LOADER
+bool hasExtension(const char *name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++) {
+        const GLubyte *extension = glGetStringi(GL_EXTENSIONS, (GLuint)i);
+        if (extension != nullptr && strcmp((const char*)extension, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+// GLCapabilities.buffer_storage (the current table's with thread-local
+// dispatch), which the minimal loader does not have.
+bool hasBufferStorage() {
+#ifdef GLAD_MINIMAL_LOADER
+    GLint major = 0;
+    GLint minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    return glBufferStorage != nullptr &&
+        (major * 10 + minor >= 44 || hasExtension("GL_ARB_buffer_storage"));
+#elif defined(GLAD_THREAD_LOCAL_DISPATCH)
+    GladGLContext *context = gladGetGLContext();
+    return context != nullptr && context->capabilities.buffer_storage;
+#else
+    return GLCapabilities.buffer_storage != 0;
+#endif
+}
+
+}
+
+bool StreamBuffer::create(StateCache &state, GLsizeiptr frameSize, int frames, bool allowPersistent) {
+    frameSize_ = frameSize;
+    frame_ = frames - 1;
+    fences_.assign(frames, nullptr);
+    GLsizeiptr size = frameSize * frames;
+
+    glGenBuffers(1, &buffer_);
+    state.bindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+    if (allowPersistent && hasBufferStorage()) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+        mapped_ = (unsigned char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags);
+        if (mapped_ == nullptr) {
+            std::cerr << "Failed to map the stream buffer" << std::endl;
+            destroy(state);
+            return false;
+        }
+        mode_ = Mode::Persistent;
+    } else {
+        glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        mode_ = Mode::Unsynchronized;
+    }
+    return true;
+}
+
+void StreamBuffer::destroy(StateCache &state) {
+    for (GLsync fence : fences_) {
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+        }
+    }
+    if (buffer_ != 0) {
+        // Deleting a buffer unmaps it.
+        state.deletedBuffer(buffer_);
+        glDeleteBuffers(1, &buffer_);
+    }
+    *this = StreamBuffer();
+}
+
+void StreamBuffer::beginFrame(StateCache &state) {
+    unmap(state);
+    frame_ = (frame_ + 1) % (int)fences_.size();
+    GLsync &fence = fences_[frame_];
+    if (fence != nullptr) {
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            stats_.waits++;
+            do {
+                status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+            } while (status == GL_TIMEOUT_EXPIRED);
+            stats_.waitMilliseconds += std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+    head_ = frame_ * frameSize_;
+    stats_.frames++;
+}
+
+void *StreamBuffer::allocate(StateCache &state, GLsizeiptr size, GLsizeiptr alignment, GLintptr &offset) {
+    GLintptr start = (head_ + alignment - 1) & ~(GLintptr)(alignment - 1);
+    if (start + size > (frame_ + 1) * frameSize_) {
+        stats_.overflows++;
+        return nullptr;
+    }
+    if (mapped_ == nullptr && map(state) == nullptr) {
+        return nullptr;
+    }
+    offset = start;
+    head_ = start + size;
+    stats_.bytes += size;
+    return mapped_ + (start - mappedAt_);
+}
+
+void *StreamBuffer::map(StateCache &state) {
+    // The region may still hold data an earlier unmap() left to the GPU,
+    // but only below head_; the rest is this frame's to overwrite.
+    GLsizeiptr length = (frame_ + 1) * frameSize_ - head_;
+    state.bindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+    mapped_ = (unsigned char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, head_, length,
+        GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+    mappedAt_ = head_;
+    if (mapped_ == nullptr) {
+        std::cerr << "Failed to map the stream buffer" << std::endl;
+    }
+    return mapped_;
+}
+
+void StreamBuffer::unmap(StateCache &state) {
+    if (mode_ == Mode::Persistent || mapped_ == nullptr) {
+        return;
+    }
+    state.bindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+    if (head_ > mappedAt_) {
+        glFlushMappedBufferRange(GL_COPY_WRITE_BUFFER, 0, head_ - mappedAt_);
+    }
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    mapped_ = nullptr;
+}
+
+void StreamBuffer::endFrame() {
+    if (fences_[frame_] != nullptr) {
+        glDeleteSync(fences_[frame_]);
+    }
+    fences_[frame_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
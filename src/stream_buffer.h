@@ -0,0 +1,85 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <vector>
+
+class StateCache;
+
+// A ring over one large buffer for data rewritten every frame: dynamic
+// vertices and indices, uniform blocks. The buffer is split into a region
+// per frame in flight. A frame allocates from its own region, and a fence
+// after its draws says when the GPU is done with it; the region is only
+// written again once that fence has signaled, so the driver never has to
+// synchronize or orphan anything on our behalf.
+//
+// With buffer storage (GL 4.4 or ARB_buffer_storage) the whole buffer stays
+// mapped, persistent and coherent, for its lifetime. Otherwise each frame's
+// allocations are written through one glMapBufferRange of the rest of its
+// region, unsynchronized, and unmap() has to come before the draws that read
+// them.
+//
+// Mapping goes through GL_COPY_WRITE_BUFFER, so the buffer can back any
+// target without disturbing the vertex array bound at the time.
+class StreamBuffer {
+public:
+    enum class Mode {
+        Persistent,
+        Unsynchronized,
+    };
+
+    struct Stats {
+        unsigned long long bytes = 0;
+        int frames = 0;
+        // Frames that found their region still in use by the GPU.
+        int waits = 0;
+        double waitMilliseconds = 0.0;
+        // Allocations that did not fit in their frame's region.
+        int overflows = 0;
+    };
+
+    // Call with the context current. Pass allowPersistent false to map
+    // every frame even where buffer storage is there.
+    bool create(StateCache &state, GLsizeiptr frameSize, int frames = 3, bool allowPersistent = true);
+    void destroy(StateCache &state);
+
+    // Moves to the next frame's region, waiting until the GPU has finished
+    // with it.
+    void beginFrame(StateCache &state);
+
+    // `size` bytes at a multiple of `alignment` (a power of two) into the
+    // buffer, written through the returned pointer; nullptr when the
+    // frame's region is full. Valid until unmap().
+    void *allocate(StateCache &state, GLsizeiptr size, GLsizeiptr alignment, GLintptr &offset);
+
+    // Ends writing; what was allocated may be drawn from after this.
+    void unmap(StateCache &state);
+
+    // Fences the frame's region; call after its last draw.
+    void endFrame();
+
+    GLuint buffer() const { return buffer_; }
+    Mode mode() const { return mode_; }
+    GLsizeiptr frameSize() const { return frameSize_; }
+    const Stats &stats() const { return stats_; }
+
+private:
+    void *map(StateCache &state);
+
+    GLuint buffer_ = 0;
+    Mode mode_ = Mode::Unsynchronized;
+    GLsizeiptr frameSize_ = 0;
+    int frame_ = 0;
+    // The fence of each region's last frame, or nullptr.
+    std::vector<GLsync> fences_;
+    // Persistent: the whole buffer. Unsynchronized: the region from
+    // mappedAt_ on, while mapped.
+    unsigned char *mapped_ = nullptr;
+    GLintptr mappedAt_ = 0;
+    // Next free byte, from the start of the buffer.
+    GLintptr head_ = 0;
+    Stats stats_;
+};
+
+#endif
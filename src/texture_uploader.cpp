@@ -0,0 +1,206 @@
+#include "texture_uploader.h"
+#include "state_cache.h"
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iostream>
+
+TextureUploader::TextureUploader(StateCache &state, int workers, GLsizeiptr bufferSize, int buffers,
+                                 GLsizeiptr budget)
+    : state_(state), bufferSize_(bufferSize), budget_(budget), buffers_(buffers) {
+    for (int i = 0; i < buffers; i++) {
+        glGenBuffers(1, &buffers_[i].buffer);
+        state_.bindBuffer(GL_PIXEL_UNPACK_BUFFER, buffers_[i].buffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, bufferSize, nullptr, GL_STREAM_DRAW);
+        free_.push_back(i);
+    }
+    // Anything else uploading from client memory would read from a bound
+    // unpack buffer instead.
+    state_.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (workers <= 0) {
+        workers = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+    }
+    for (int i = 0; i < workers; i++) {
+        workers_.push_back(std::thread(&TextureUploader::work, this));
+    }
+}
+
+TextureUploader::~TextureUploader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+    // Textures still loading are left as they are.
+    for (Buffer &buffer : buffers_) {
+        if (buffer.fence != nullptr) {
+            glDeleteSync(buffer.fence);
+        }
+        // Deleting a buffer unmaps it.
+        state_.deletedBuffer(buffer.buffer);
+        glDeleteBuffers(1, &buffer.buffer);
+    }
+}
+
+bool TextureUploader::upload(GLuint texture, GLint level, int width, int height, const Fill &fill,
+                             const Done &done) {
+    if ((GLsizeiptr)width * 4 > bufferSize_) {
+        std::cerr << "A " << width << " pixel row does not fit the upload buffers" << std::endl;
+        return false;
+    }
+    Texture entry;
+    entry.texture = texture;
+    entry.level = level;
+    entry.width = width;
+    entry.height = height;
+    entry.fill = fill;
+    entry.done = done;
+    textures_.push_back(entry);
+    return true;
+}
+
+void TextureUploader::update() {
+    Clock::time_point began = Clock::now();
+    retire();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (!done_.empty()) {
+            written_.push_back(done_.front());
+            done_.pop_front();
+        }
+    }
+    submit();
+    start();
+    state_.bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    double milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - began).count();
+    if (milliseconds > stats_.longestUpdateMilliseconds) {
+        stats_.longestUpdateMilliseconds = milliseconds;
+    }
+}
+
+void TextureUploader::retire() {
+    for (size_t i = 0; i < copying_.size();) {
+        Buffer &buffer = buffers_[copying_[i]];
+        GLenum status = glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            i++;
+            continue;
+        }
+        glDeleteSync(buffer.fence);
+        buffer.fence = nullptr;
+        buffer.texture->bandsInFlight--;
+        buffer.texture = nullptr;
+        free_.push_back(copying_[i]);
+        copying_.erase(copying_.begin() + i);
+    }
+
+    for (auto texture = textures_.begin(); texture != textures_.end();) {
+        if (texture->nextRow < texture->height || texture->bandsInFlight > 0) {
+            ++texture;
+            continue;
+        }
+        GLuint name = texture->texture;
+        Done done = texture->done;
+        texture = textures_.erase(texture);
+        stats_.textures++;
+        if (done) {
+            done(name);
+        }
+    }
+}
+
+void TextureUploader::submit() {
+    GLsizeiptr copied = 0;
+    while (!written_.empty() && copied < budget_) {
+        int index = written_.front();
+        written_.pop_front();
+        Buffer &buffer = buffers_[index];
+        const Texture &texture = *buffer.texture;
+
+        state_.bindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.buffer);
+        if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) != GL_TRUE) {
+            // The mapping's contents were lost (e.g. a mode switch); the band
+            // is copied anyway rather than the texture never finishing.
+            std::cerr << "Lost an upload buffer's contents" << std::endl;
+        }
+        buffer.mapped = nullptr;
+        state_.bindTexture(GL_TEXTURE_2D, texture.texture);
+        glTexSubImage2D(GL_TEXTURE_2D, texture.level, 0, buffer.firstRow, texture.width, buffer.rows,
+                        GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+        buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        copying_.push_back(index);
+
+        GLsizeiptr bytes = (GLsizeiptr)texture.width * 4 * buffer.rows;
+        copied += bytes;
+        stats_.bands++;
+        stats_.bytes += bytes;
+    }
+}
+
+void TextureUploader::start() {
+    for (Texture &texture : textures_) {
+        while (texture.nextRow < texture.height && !free_.empty()) {
+            int index = free_.back();
+            Buffer &buffer = buffers_[index];
+            GLsizeiptr rowBytes = (GLsizeiptr)texture.width * 4;
+            int rows = std::min((int)(bufferSize_ / rowBytes), texture.height - texture.nextRow);
+
+            // The buffer's fence has signaled, nothing reads it any more.
+            state_.bindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.buffer);
+            buffer.mapped = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, rowBytes * rows,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+            if (buffer.mapped == nullptr) {
+                std::cerr << "Failed to map an upload buffer" << std::endl;
+                return;
+            }
+            free_.pop_back();
+            buffer.texture = &texture;
+            buffer.firstRow = texture.nextRow;
+            buffer.rows = rows;
+            texture.nextRow += rows;
+            texture.bandsInFlight++;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queued_.push_back(index);
+            }
+            wake_.notify_one();
+        }
+        if (free_.empty()) {
+            return;
+        }
+    }
+}
+
+void TextureUploader::work() {
+    // Behind the render thread for the cores; on Linux niceness is per
+    // thread.
+    setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), 10);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [this]() {
+            return stopping_ || !queued_.empty();
+        });
+        if (stopping_) {
+            return;
+        }
+        int index = queued_.front();
+        queued_.pop_front();
+        lock.unlock();
+
+        // Only this thread touches the buffer until it is handed back.
+        Buffer &buffer = buffers_[index];
+        buffer.texture->fill(buffer.firstRow, buffer.rows, buffer.mapped);
+
+        lock.lock();
+        done_.push_back(index);
+    }
+}
@@ -0,0 +1,121 @@
+#ifndef TEXTURE_UPLOADER_H
+#define TEXTURE_UPLOADER_H
+
+#include <glad/glad.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class StateCache;
+
+// Fills textures without the GL thread waiting for the pixels or for the
+// copy, through a pool of pixel buffer objects.
+//
+// An image is cut into bands of rows that fit a buffer. update(), once a
+// frame on the GL thread, maps free buffers and hands them to worker
+// threads, which write (decode, generate) the band's pixels straight into
+// the mapping. Once a band is written, update() unmaps its buffer and issues
+// glTexSubImage2D from it, which the driver can copy while the frame goes
+// on, and fences the buffer; when the fence has signaled the buffer is free
+// again. At most `budget` bytes are handed to glTexSubImage2D per update(),
+// so a level's worth of textures spreads over frames instead of landing in
+// one.
+//
+// Pixels are RGBA8, rows tightly packed, and the texture must already have
+// storage for the level.
+class TextureUploader {
+public:
+    // Writes `rows` rows from `firstRow` on into `pixels`. Runs on a worker
+    // thread, possibly for several bands of one image at once.
+    typedef std::function<void(int firstRow, int rows, unsigned char *pixels)> Fill;
+    // Called by update() once the texture's last band has been copied.
+    typedef std::function<void(GLuint texture)> Done;
+
+    struct Stats {
+        int textures = 0;
+        int bands = 0;
+        unsigned long long bytes = 0;
+        // The longest update(), which is what a frame waits for.
+        double longestUpdateMilliseconds = 0.0;
+    };
+
+    // Call with the context current; 0 workers for one per core but one.
+    explicit TextureUploader(StateCache &state, int workers = 0, GLsizeiptr bufferSize = 4 * 1024 * 1024,
+                             int buffers = 8, GLsizeiptr budget = 8 * 1024 * 1024);
+    ~TextureUploader();
+
+    TextureUploader(const TextureUploader &) = delete;
+    TextureUploader &operator=(const TextureUploader &) = delete;
+
+    // Queues filling `level` of the 2D texture, width x height. False when
+    // a row does not fit a buffer.
+    bool upload(GLuint texture, GLint level, int width, int height, const Fill &fill,
+                const Done &done = Done());
+
+    void update();
+
+    // Nothing queued or in flight.
+    bool idle() const { return textures_.empty(); }
+    const Stats &stats() const { return stats_; }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Texture {
+        GLuint texture;
+        GLint level;
+        int width;
+        int height;
+        Fill fill;
+        Done done;
+        // Rows handed to a worker so far.
+        int nextRow = 0;
+        // Bands handed out and not yet copied.
+        int bandsInFlight = 0;
+    };
+
+    struct Buffer {
+        GLuint buffer = 0;
+        unsigned char *mapped = nullptr;
+        GLsync fence = nullptr;
+        Texture *texture = nullptr;
+        int firstRow = 0;
+        int rows = 0;
+    };
+
+    void start();
+    void submit();
+    void retire();
+    void work();
+
+    StateCache &state_;
+    GLsizeiptr bufferSize_;
+    GLsizeiptr budget_;
+    std::vector<Buffer> buffers_;
+    // Buffers not in use, by index.
+    std::vector<int> free_;
+    // Copied to the texture, waiting for their fence.
+    std::vector<int> copying_;
+    // Written, not yet copied for lack of budget.
+    std::deque<int> written_;
+    // In upload() order; a list so workers can hold on to theirs.
+    std::list<Texture> textures_;
+
+    // Bands go to the workers through queued_ and come back through done_.
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<int> queued_;
+    std::deque<int> done_;
+    bool stopping_ = false;
+
+    Stats stats_;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#include "uniform_buffer.h"
+#include "state_cache.h"
+
+void UniformBuffer::create() {
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    alignment_ = alignment > 0 ? (size_t)alignment : 256;
+}
+
+void UniformBuffer::destroy(StateCache &state) {
+    stream_.destroy(state);
+    *this = UniformBuffer();
+}
+
+void UniformBuffer::begin() {
+    data_.clear();
+}
+
+void UniformBuffer::upload(StateCache &state) {
+    if (data_.empty()) {
+        return;
+    }
+    GLsizeiptr size = (GLsizeiptr)data_.size();
+    if (stream_.frameSize() < size) {
+        // A bigger buffer replaces the old one, which GL keeps until the
+        // draws reading it are done.
+        GLsizeiptr frameSize = stream_.frameSize() > 0 ? stream_.frameSize() : 64 * 1024;
+        while (frameSize < size) {
+            frameSize *= 2;
+        }
+        stream_.destroy(state);
+        if (!stream_.create(state, frameSize)) {
+            return;
+        }
+    }
+    stream_.beginFrame(state);
+    void *data = stream_.allocate(state, size, (GLsizeiptr)alignment_, uploadedAt_);
+    if (data != nullptr) {
+        memcpy(data, data_.data(), data_.size());
+    }
+    stream_.unmap(state);
+}
+
+void UniformBuffer::end() {
+    if (stream_.buffer() != 0) {
+        stream_.endFrame();
+    }
+}
+
+void UniformBuffer::bindRange(StateCache &state, GLuint binding, GLintptr offset, GLsizeiptr size) {
+    state.bindBufferRange(GL_UNIFORM_BUFFER, binding, stream_.buffer(), uploadedAt_ + offset, size);
+}
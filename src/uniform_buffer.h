@@ -0,0 +1,95 @@
+#ifndef UNIFORM_BUFFER_H
+#define UNIFORM_BUFFER_H
+
+#include "stream_buffer.h"
+
+#include <glad/glad.h>
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+class StateCache;
+
+// C++ stand-ins for GLSL types with their std140 alignment, so a struct of
+// them has the layout of the matching `layout(std140) uniform` block. Check
+// each block's offsets with static_assert next to its GLSL source. A vec3
+// takes 16 bytes here; std140 would fit a float into its last 4, so declare
+// any such float separately before the vec3 instead.
+namespace std140 {
+
+struct alignas(8) vec2 {
+    float x, y;
+};
+
+struct alignas(16) vec3 {
+    float x, y, z;
+};
+
+struct alignas(16) vec4 {
+    float x, y, z, w;
+};
+
+}
+
+// Block binding points, by how often their data changes. Every program
+// declares its blocks at these, whether it uses all of them or not.
+enum UniformBinding : GLuint {
+    FrameBinding = 0,
+    ViewBinding = 1,
+    MaterialBinding = 2,
+    ObjectBinding = 3,
+};
+
+// One buffer holding a frame's uniform blocks. Blocks are appended to a copy
+// in memory while the frame is recorded, uploaded together, and each draw
+// then binds its block's range with glBindBufferRange: one call where a
+// draw used to set each uniform with a glUniform* call of its own.
+//
+// Uploads go into a StreamBuffer, so writing the next frame's blocks never
+// waits for draws still reading the last.
+class UniformBuffer {
+public:
+    // Call with the context current.
+    void create();
+    void destroy(StateCache &state);
+
+    // Drops the blocks of the last frame.
+    void begin();
+
+    // Copies `block` in and returns its offset, a multiple of
+    // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT.
+    template<typename Block>
+    GLintptr append(const Block &block) {
+        static_assert(std::is_trivially_copyable<Block>::value, "uniform blocks are copied as bytes");
+        size_t offset = (data_.size() + alignment_ - 1) / alignment_ * alignment_;
+        data_.resize(offset + sizeof(Block));
+        memcpy(data_.data() + offset, &block, sizeof(Block));
+        return (GLintptr)offset;
+    }
+
+    // Sends everything appended since begin() to the buffer.
+    void upload(StateCache &state);
+
+    // Call after the last draw using the blocks.
+    void end();
+
+    // Binds the `Block` appended at `offset` to `binding`.
+    template<typename Block>
+    void bind(StateCache &state, GLuint binding, GLintptr offset) {
+        bindRange(state, binding, offset, sizeof(Block));
+    }
+
+    const StreamBuffer &stream() const { return stream_; }
+
+private:
+    void bindRange(StateCache &state, GLuint binding, GLintptr offset, GLsizeiptr size);
+
+    StreamBuffer stream_;
+    // Where the frame's blocks start in the stream buffer.
+    GLintptr uploadedAt_ = 0;
+    size_t alignment_ = 256;
+    std::vector<unsigned char> data_;
+};
+
+#endif
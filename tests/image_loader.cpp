@@ -0,0 +1,206 @@
+// Checks that decodeImage reads PNG and JPEG files written by libpng and
+// libjpeg, grey and color, as RGBA, and refuses truncated ones without
+// crashing, as well as TGA headers that claim more pixels than the file has;
+// then that loadImages builds full mip chains from such files.
+
+#include "image_loader.h"
+#include "job_system.h"
+
+#include <png.h>
+#include <jpeglib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void fail(const std::string &what, const std::string &why) {
+    std::cerr << what << ": " << why << std::endl;
+    failures++;
+}
+
+// A gradient, so rows and channels that come out swapped show.
+std::vector<unsigned char> makePixels(int width, int height, int channels) {
+    std::vector<unsigned char> pixels((size_t)width * height * channels);
+    for (size_t i = 0; i < pixels.size(); i++) {
+        size_t pixel = i / channels;
+        int x = (int)(pixel % width);
+        int y = (int)(pixel / width);
+        pixels[i] = (unsigned char)(x * 255 / width + (int)(i % channels) * 20 + y * 40);
+    }
+    return pixels;
+}
+
+std::vector<unsigned char> encodePng(int width, int height, int channels, const std::vector<unsigned char> &pixels) {
+    png_image png = {};
+    png.version = PNG_IMAGE_VERSION;
+    png.width = width;
+    png.height = height;
+    png.format = channels == 1 ? PNG_FORMAT_GRAY : channels == 3 ? PNG_FORMAT_RGB : PNG_FORMAT_RGBA;
+    png_alloc_size_t size = 0;
+    png_image_write_to_memory(&png, nullptr, &size, 0, pixels.data(), 0, nullptr);
+    std::vector<unsigned char> file(size);
+    if (size == 0 || !png_image_write_to_memory(&png, file.data(), &size, 0, pixels.data(), 0, nullptr)) {
+        file.clear();
+    }
+    file.resize(size);
+    return file;
+}
+
+std::vector<unsigned char> encodeJpeg(int width, int height, int channels, const std::vector<unsigned char> &pixels) {
+    jpeg_compress_struct info;
+    jpeg_error_mgr error;
+    info.err = jpeg_std_error(&error);
+    jpeg_create_compress(&info);
+    unsigned char *buffer = nullptr;
+    unsigned long size = 0;
+    jpeg_mem_dest(&info, &buffer, &size);
+    info.image_width = width;
+    info.image_height = height;
+    info.input_components = channels;
+    info.in_color_space = channels == 1 ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_set_defaults(&info);
+    jpeg_set_quality(&info, 100, TRUE);
+    // No chroma subsampling, so the colors come back close to exact.
+    for (int i = 0; i < info.num_components; i++) {
+        info.comp_info[i].h_samp_factor = 1;
+        info.comp_info[i].v_samp_factor = 1;
+    }
+    jpeg_start_compress(&info, TRUE);
+    while (info.next_scanline < info.image_height) {
+        JSAMPROW row = (JSAMPROW)pixels.data() + (size_t)info.next_scanline * width * channels;
+        jpeg_write_scanlines(&info, &row, 1);
+    }
+    jpeg_finish_compress(&info);
+    jpeg_destroy_compress(&info);
+    std::vector<unsigned char> file(buffer, buffer + size);
+    free(buffer);
+    return file;
+}
+
+// Just a TGA header, for a true color image of the given size.
+std::vector<unsigned char> tgaHeader(int type, int width, int height) {
+    std::vector<unsigned char> file(18);
+    file[2] = (unsigned char)type;
+    file[12] = (unsigned char)width;
+    file[13] = (unsigned char)(width >> 8);
+    file[14] = (unsigned char)height;
+    file[15] = (unsigned char)(height >> 8);
+    file[16] = 32;
+    return file;
+}
+
+// Every decoded pixel within `tolerance` of the source, expanded to RGBA.
+void checkDecode(const std::string &what, const std::vector<unsigned char> &file, int width, int height,
+                 int channels, const std::vector<unsigned char> &pixels, int tolerance) {
+    Image image;
+    std::string error;
+    if (!decodeImage(file.data(), file.size(), image, error)) {
+        fail(what, error);
+        return;
+    }
+    if (image.width != width || image.height != height || image.pixels.size() != (size_t)width * height * 4) {
+        fail(what, "decoded as " + std::to_string(image.width) + "x" + std::to_string(image.height));
+        return;
+    }
+    int worst = 0;
+    for (size_t i = 0; i < (size_t)width * height; i++) {
+        for (int c = 0; c < 4; c++) {
+            int expected = c == 3 ? (channels == 4 ? pixels[i * 4 + 3] : 255)
+                                  : pixels[i * channels + (channels == 1 ? 0 : c)];
+            worst = std::max(worst, std::abs(image.pixels[i * 4 + c] - expected));
+        }
+    }
+    if (worst > tolerance) {
+        fail(what, "off by up to " + std::to_string(worst));
+    }
+}
+
+void checkRefused(const std::string &what, const std::vector<unsigned char> &file) {
+    Image image;
+    std::string error;
+    if (decodeImage(file.data(), file.size(), image, error)) {
+        fail(what, "decoded");
+    } else if (error.empty()) {
+        fail(what, "refused without a reason");
+    }
+}
+
+}
+
+int main() {
+    const int width = 37;
+    const int height = 21;
+    for (int channels : {1, 3, 4}) {
+        std::vector<unsigned char> pixels = makePixels(width, height, channels);
+        std::string name = std::to_string(channels) + " channel ";
+        std::vector<unsigned char> png = encodePng(width, height, channels, pixels);
+        checkDecode(name + "PNG", png, width, height, channels, pixels, 0);
+        checkRefused("truncated " + name + "PNG",
+                     std::vector<unsigned char>(png.begin(), png.begin() + png.size() / 2));
+        if (channels != 4) {
+            std::vector<unsigned char> jpeg = encodeJpeg(width, height, channels, pixels);
+            checkDecode(name + "JPEG", jpeg, width, height, channels, pixels, 8);
+            checkRefused(name + "JPEG header only", std::vector<unsigned char>(jpeg.begin(), jpeg.begin() + 20));
+            checkRefused("truncated " + name + "JPEG",
+                         std::vector<unsigned char>(jpeg.begin(), jpeg.begin() + jpeg.size() * 3 / 4));
+        }
+    }
+
+    // Refused before the pixels are allocated; 65535x65535 would be 17 GB.
+    checkRefused("65535x65535 TGA header", tgaHeader(2, 65535, 65535));
+    checkRefused("65535x65535 run-length TGA header", tgaHeader(10, 65535, 65535));
+    checkRefused("16384x16384 TGA header", tgaHeader(2, 16384, 16384));
+    checkRefused("16384x16384 run-length TGA header", tgaHeader(10, 16384, 16384));
+
+    char directory[] = "/tmp/check_image_loader.XXXXXX";
+    if (mkdtemp(directory) == nullptr) {
+        std::cerr << "Failed to create a temporary directory" << std::endl;
+        return 1;
+    }
+    std::vector<std::string> paths;
+    for (int i = 0; i < 4; i++) {
+        std::vector<unsigned char> pixels = makePixels(64 + i, 48, 3);
+        bool png = i % 2 == 0;
+        std::vector<unsigned char> file = png ? encodePng(64 + i, 48, 3, pixels) : encodeJpeg(64 + i, 48, 3, pixels);
+        paths.push_back(std::string(directory) + "/" + std::to_string(i) + (png ? ".png" : ".jpg"));
+        FILE *out = fopen(paths.back().c_str(), "wb");
+        if (out == nullptr || fwrite(file.data(), 1, file.size(), out) != file.size()) {
+            fail(paths.back(), "cannot write");
+        }
+        if (out != nullptr) {
+            fclose(out);
+        }
+    }
+    // Called on the workers, so each only fills in its own entry.
+    std::vector<LoadedImage> loaded(paths.size());
+    jobs::JobSystem system(2);
+    loadImages(system, paths, [&](size_t index, LoadedImage &image) {
+        loaded[index] = std::move(image);
+    });
+    for (size_t i = 0; i < paths.size(); i++) {
+        const LoadedImage &image = loaded[i];
+        if (!image.error.empty()) {
+            fail(paths[i], image.error);
+        } else if (image.levels.size() != 7 || image.levels.back().width != 1 || image.levels.back().height != 1) {
+            fail(paths[i], std::to_string(image.levels.size()) + " mip levels, expected 7 down to 1x1");
+        }
+        unlink(paths[i].c_str());
+    }
+    rmdir(directory);
+
+    if (failures > 0) {
+        std::cerr << failures << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "image loader: all checks passed" << std::endl;
+    return 0;
+}
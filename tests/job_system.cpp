@@ -0,0 +1,75 @@
+// Checks that parallelFor calls the function on every item exactly once and
+// that parallelReduce adds them all up, on one and several workers, with
+// more pieces than a thread's job ring holds.
+
+#include "job_system.h"
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+
+namespace {
+
+int failures = 0;
+
+void checkFor(jobs::JobSystem &system, size_t items, size_t grain) {
+    std::unique_ptr<std::atomic<int>[]> visits(new std::atomic<int>[items]);
+    for (size_t i = 0; i < items; i++) {
+        visits[i].store(0, std::memory_order_relaxed);
+    }
+    jobs::parallelFor(system, 0, items, grain, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            visits[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    size_t wrong = 0;
+    for (size_t i = 0; i < items; i++) {
+        wrong += visits[i].load(std::memory_order_relaxed) != 1;
+    }
+    if (wrong != 0) {
+        std::cerr << system.threads() << " threads, " << items << " items, grain " << grain << ": " << wrong
+                  << " items not visited exactly once" << std::endl;
+        failures++;
+    }
+}
+
+void checkReduce(jobs::JobSystem &system, size_t items, size_t grain) {
+    size_t sum = jobs::parallelReduce(system, 0, items, grain, (size_t)0,
+        [](size_t first, size_t last) {
+            size_t sum = 0;
+            for (size_t i = first; i < last; i++) {
+                sum += i;
+            }
+            return sum;
+        },
+        [](size_t a, size_t b) { return a + b; });
+    size_t expected = items * (items - 1) / 2;
+    if (sum != expected) {
+        std::cerr << system.threads() << " threads, " << items << " items, grain " << grain << ": reduced to "
+                  << sum << ", expected " << expected << std::endl;
+        failures++;
+    }
+}
+
+}
+
+int main() {
+    const size_t ring = jobs::JobSystem::jobsPerThread;
+    for (int threads : {1, 4}) {
+        jobs::JobSystem system(threads);
+        checkFor(system, 1000, 1);
+        checkFor(system, ring + 1, 1);
+        checkFor(system, 5000, 1);
+        checkFor(system, 1000000, 64);
+        checkFor(system, 1000000, 1);
+        checkReduce(system, ring + 1, 1);
+        checkReduce(system, 1000000, 64);
+        checkReduce(system, 1000000, 1);
+    }
+    if (failures > 0) {
+        std::cerr << failures << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "job system: all checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,100 @@
+// Checks that RenderGraph's pool keeps only what the current frame uses:
+// resizing back and forth, and dropping a pass, must not leave textures or
+// framebuffers of the old frames alive. Runs against the mock GL backend and
+// counts its live objects.
+
+#include <glad/glad.h>
+#include "mock_gl.h"
+#include "render_graph.h"
+#include "state_cache.h"
+
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+void expect(const char *what, int value, int expected) {
+    if (value != expected) {
+        std::cerr << what << ": " << value << ", expected " << expected << std::endl;
+        failures++;
+    }
+}
+
+// A scene with depth, a half size bright pass and, with `bloom`, a blur of
+// it, composited into the window. Returns the scene's GL texture.
+GLuint frame(RenderGraph &graph, int width, int height, bool bloom) {
+    GLuint sceneTexture = 0;
+    RenderGraph::Resource window = graph.importFramebuffer("window", 0, width, height);
+    RenderGraph::Resource scene = -1;
+    RenderGraph::Resource bright = -1;
+    RenderGraph::Resource blurred = -1;
+    graph.addPass("scene", [&](RenderGraph::Builder &builder) {
+        scene = builder.create("scene", {width, height, GL_RGBA16F});
+        builder.create("depth", {width, height, GL_DEPTH24_STENCIL8});
+    }, [](const RenderGraph::Context &) {});
+    graph.addPass("bright", [&](RenderGraph::Builder &builder) {
+        builder.read(scene);
+        bright = builder.create("bright", {width / 2, height / 2, GL_RGBA16F});
+    }, [](const RenderGraph::Context &) {});
+    if (bloom) {
+        graph.addPass("blur", [&](RenderGraph::Builder &builder) {
+            builder.read(bright);
+            blurred = builder.create("blurred", {width / 2, height / 2, GL_RGBA16F});
+        }, [](const RenderGraph::Context &) {});
+    }
+    graph.addPass("composite", [&](RenderGraph::Builder &builder) {
+        builder.read(scene);
+        builder.read(bloom ? blurred : bright);
+        builder.write(window);
+    }, [&](const RenderGraph::Context &context) {
+        sceneTexture = context.texture(scene);
+    });
+    graph.compile();
+    graph.execute();
+    return sceneTexture;
+}
+
+}
+
+int main() {
+    if (!gladLoadGLLoader(mockgl::getProcAddress)) {
+        std::cerr << "Failed to load the mock backend" << std::endl;
+        return 1;
+    }
+    StateCache state;
+    RenderGraph graph(state);
+
+    // scene, depth, bright and blurred; the blur cannot share with bright,
+    // which it reads.
+    const int sizes[][2] = {{640, 360}, {800, 600}, {641, 361}, {640, 360}, {1920, 1080}, {800, 600}};
+    for (int repeat = 0; repeat < 2; repeat++) {
+        for (const int *size : sizes) {
+            frame(graph, size[0], size[1], true);
+            expect("textures alive after a resize", mockgl::stats().textures, 4);
+            expect("framebuffers alive after a resize", mockgl::stats().framebuffers, 3);
+            expect("pooled textures", graph.stats().pooledTextures, 4);
+            expect("pooled framebuffers", graph.stats().pooledFramebuffers, 3);
+        }
+    }
+
+    frame(graph, 800, 600, false);
+    expect("textures alive without the blur", mockgl::stats().textures, 3);
+    expect("framebuffers alive without the blur", mockgl::stats().framebuffers, 2);
+
+    // Same frame again: everything comes from the pool.
+    GLuint first = frame(graph, 800, 600, false);
+    GLuint second = frame(graph, 800, 600, false);
+    expect("scene texture kept from frame to frame", (int)second, (int)first);
+
+    graph.releaseMemory();
+    expect("textures alive after releaseMemory", mockgl::stats().textures, 0);
+    expect("framebuffers alive after releaseMemory", mockgl::stats().framebuffers, 0);
+
+    if (failures > 0) {
+        std::cerr << failures << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "render graph: all checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Checks that StateCache drops redundant calls and that invalidate() and the
+// deleted*() functions make the next call go through again. Runs against
+// the mock GL backend and counts the gl* calls that reach it.
+
+#include <glad/glad.h>
+#include "mock_gl.h"
+#include "state_cache.h"
+
+#include <functional>
+#include <iostream>
+
+namespace {
+
+int failures = 0;
+
+// The gl* calls `step` makes.
+unsigned long long callsOf(const std::function<void()> &step) {
+    unsigned long long before = mockgl::stats().calls;
+    step();
+    return mockgl::stats().calls - before;
+}
+
+void expect(const char *what, unsigned long long calls, unsigned long long expected) {
+    if (calls != expected) {
+        std::cerr << what << ": " << calls << " GL calls, expected " << expected << std::endl;
+        failures++;
+    }
+}
+
+}
+
+int main() {
+    if (!gladLoadGLLoader(mockgl::getProcAddress)) {
+        std::cerr << "Failed to load the mock backend" << std::endl;
+        return 1;
+    }
+    GLuint program = glCreateProgram();
+    GLuint buffers[2];
+    glGenBuffers(2, buffers);
+    GLuint texture;
+    glGenTextures(1, &texture);
+    GLuint array;
+    glGenVertexArrays(1, &array);
+
+    StateCache state;
+    expect("first program", callsOf([&] { state.useProgram(program); }), 1);
+    expect("same program", callsOf([&] { state.useProgram(program); }), 0);
+    expect("first buffer", callsOf([&] { state.bindBuffer(GL_ARRAY_BUFFER, buffers[0]); }), 1);
+    expect("same buffer", callsOf([&] { state.bindBuffer(GL_ARRAY_BUFFER, buffers[0]); }), 0);
+    expect("other buffer", callsOf([&] { state.bindBuffer(GL_ARRAY_BUFFER, buffers[1]); }), 1);
+    expect("same buffer, other target", callsOf([&] { state.bindBuffer(GL_COPY_READ_BUFFER, buffers[1]); }), 1);
+    expect("texture unit", callsOf([&] {
+        state.activeTexture(GL_TEXTURE0);
+        state.bindTexture(GL_TEXTURE_2D, texture);
+    }), 2);
+    expect("same texture", callsOf([&] {
+        state.activeTexture(GL_TEXTURE0);
+        state.bindTexture(GL_TEXTURE_2D, texture);
+    }), 0);
+    expect("first enable", callsOf([&] { state.enable(GL_BLEND); }), 1);
+    expect("enable again", callsOf([&] { state.enable(GL_BLEND); }), 0);
+    expect("disable", callsOf([&] { state.disable(GL_BLEND); }), 1);
+    expect("blend and depth", callsOf([&] {
+        state.blendFunc(GL_ONE, GL_ONE);
+        state.depthMask(GL_FALSE);
+        state.viewport(0, 0, 64, 64);
+    }), 3);
+    expect("same blend and depth", callsOf([&] {
+        state.blendFunc(GL_ONE, GL_ONE);
+        state.depthMask(GL_FALSE);
+        state.viewport(0, 0, 64, 64);
+    }), 0);
+    expect("uniform range", callsOf([&] { state.bindBufferRange(GL_UNIFORM_BUFFER, 1, buffers[0], 0, 256); }), 1);
+    expect("same range", callsOf([&] { state.bindBufferRange(GL_UNIFORM_BUFFER, 1, buffers[0], 0, 256); }), 0);
+    expect("other offset", callsOf([&] { state.bindBufferRange(GL_UNIFORM_BUFFER, 1, buffers[0], 256, 256); }), 1);
+    // The range also set the generic binding.
+    expect("generic after range", callsOf([&] { state.bindBuffer(GL_UNIFORM_BUFFER, buffers[0]); }), 0);
+    // The element array binding belongs to the vertex array.
+    expect("elements", callsOf([&] { state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]); }), 1);
+    expect("vertex array", callsOf([&] { state.bindVertexArray(array); }), 1);
+    expect("elements after vertex array", callsOf([&] {
+        state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+    }), 1);
+
+    // Deleting a bound object unbinds it in GL, so binding it again (or 0)
+    // has to go through.
+    state.deletedBuffer(buffers[1]);
+    expect("deleted buffer", callsOf([&] { state.bindBuffer(GL_ARRAY_BUFFER, buffers[1]); }), 1);
+    state.deletedBuffer(buffers[0]);
+    expect("deleted range", callsOf([&] { state.bindBufferRange(GL_UNIFORM_BUFFER, 1, buffers[0], 256, 256); }), 1);
+    state.deletedTexture(texture);
+    expect("deleted texture", callsOf([&] { state.bindTexture(GL_TEXTURE_2D, texture); }), 1);
+    state.deletedProgram(program);
+    expect("deleted program", callsOf([&] { state.useProgram(program); }), 1);
+    state.deletedVertexArray(array);
+    expect("deleted vertex array", callsOf([&] { state.bindVertexArray(array); }), 1);
+    // Deleting something else leaves the cache alone.
+    state.deletedBuffer(12345);
+    expect("unrelated deletion", callsOf([&] { state.bindBuffer(GL_ARRAY_BUFFER, buffers[1]); }), 0);
+
+    state.invalidate();
+    expect("after invalidate", callsOf([&] {
+        state.useProgram(program);
+        state.bindBuffer(GL_ARRAY_BUFFER, buffers[1]);
+        state.activeTexture(GL_TEXTURE0);
+        state.bindTexture(GL_TEXTURE_2D, texture);
+        state.disable(GL_BLEND);
+        state.viewport(0, 0, 64, 64);
+    }), 6);
+    expect("skipped after invalidate", callsOf([&] {
+        state.useProgram(program);
+        state.bindBuffer(GL_ARRAY_BUFFER, buffers[1]);
+        state.disable(GL_BLEND);
+    }), 0);
+
+    if (failures > 0) {
+        std::cerr << failures << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "state cache: " << state.stats().issued << " calls issued, " << state.stats().skipped
+              << " skipped" << std::endl;
+    return 0;
+}
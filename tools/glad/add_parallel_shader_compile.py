@@ -0,0 +1,42 @@
+"""Adds GL_KHR_parallel_shader_compile to the 4.5 loader; run regenerate.py after."""
+from glparse import HDR, SRC
+EXT = 'GL_KHR_parallel_shader_compile'
+
+h = open(HDR).read()
+def rep(text, a, b):
+    assert text.count(a) == 1, a
+    return text.replace(a, b)
+h = rep(h, '        GL_KHR_debug\n', '        GL_KHR_debug,\n        %s\n' % EXT)
+h = rep(h, ',GL_KHR_debug"', ',GL_KHR_debug,%s"' % EXT)
+h = rep(h, '&extensions=GL_KHR_debug', '&extensions=GL_KHR_debug&extensions=%s' % EXT)
+h = rep(h, '#ifndef GL_VERSION_1_0\n', '#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0\n#define GL_COMPLETION_STATUS_KHR 0x91B1\n#ifndef GL_VERSION_1_0\n')
+i = h.index('#ifndef GL_KHR_debug\n')
+j = h.index('#endif\n', i) + len('#endif\n')
+h = h[:j] + ('#ifndef {e}\n#define {e} 1\nGLAPI int GLAD_{e};\n'
+             'typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);\n'
+             'GLAPI PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;\n'
+             '#define glMaxShaderCompilerThreadsKHR glad_glMaxShaderCompilerThreadsKHR\n#endif\n').format(e=EXT) + h[j:]
+open(HDR, 'w').write(h)
+
+c = open(SRC).read()
+c = rep(c, '        GL_KHR_debug\n', '        GL_KHR_debug,\n        %s\n' % EXT)
+c = rep(c, ',GL_KHR_debug"', ',GL_KHR_debug,%s"' % EXT)
+c = rep(c, '&extensions=GL_KHR_debug', '&extensions=GL_KHR_debug&extensions=%s' % EXT)
+c = rep(c, 'int GLAD_GL_KHR_debug = 0;\n', 'int GLAD_GL_KHR_debug = 0;\nint GLAD_%s = 0;\n' % EXT)
+c = rep(c, 'PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;\n',
+        'PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;\n'
+        'PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;\n')
+i = c.index('static void load_GL_KHR_debug(GLADloadproc load) {')
+j = c.index('\n}\n', i) + 3
+c = c[:j] + ('static void load_{e}(GLADloadproc load) {{\n\tif(!GLAD_{e}) return;\n'
+             '\tglad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");\n}}\n').format(e=EXT) + c[j:]
+c = rep(c, '\tGLAD_GL_KHR_debug = has_ext(&exts_gl, "GL_KHR_debug");\n',
+        '\tGLAD_GL_KHR_debug = has_ext(&exts_gl, "GL_KHR_debug");\n\tGLAD_{e} = has_ext(&exts_gl, "{e}");\n'.format(e=EXT))
+c = rep(c, '\tload_GL_KHR_debug(load);\n', '\tload_GL_KHR_debug(load);\n\tload_%s(load);\n' % EXT)
+c = rep(c, '\tlazy_GL_KHR_debug();\n', '\tlazy_GL_KHR_debug();\n\tlazy_%s();\n' % EXT)
+c = rep(c, '\tcontext->KHR_debug = has_ext(&context->extensions, "GL_KHR_debug");\n',
+        '\tcontext->KHR_debug = has_ext(&context->extensions, "GL_KHR_debug");\n'
+        '\tcontext->{s} = has_ext(&context->extensions, "{e}");\n'.format(s=EXT[3:], e=EXT))
+c = rep(c, '\tload_GL_KHR_debug_context(context, load);\n',
+        '\tload_GL_KHR_debug_context(context, load);\n\tload_%s_context(context, load);\n' % EXT)
+open(SRC, 'w').write(c)
@@ -0,0 +1,123 @@
+"""One-shot: extend the glad 3.3 core loader to 4.5 plus four extensions,
+in the layout glad 0.1.33 produces for --api="gl=4.5" --extensions=..."""
+import re
+import glcorearb
+from glparse import HDR, SRC
+
+VERSIONS = ['GL_VERSION_4_0', 'GL_VERSION_4_1', 'GL_VERSION_4_2', 'GL_VERSION_4_3', 'GL_VERSION_4_4', 'GL_VERSION_4_5']
+EXTS = ['GL_ARB_buffer_storage', 'GL_ARB_direct_state_access', 'GL_ARB_multi_draw_indirect', 'GL_KHR_debug']
+
+arb = glcorearb.blocks()
+cmds = {}
+feature_cmds = {}
+for v in VERSIONS:
+    feature_cmds[v] = []
+    for ret, name, params, pfn in arb[v][1]:
+        cmds[name] = (ret, params, pfn)
+        feature_cmds[v].append(name)
+# Core 3.2 dropped glGetPointerv, 4.3 brings it back for KHR_debug.
+for ret, name, params, pfn in arb['GL_VERSION_1_1'][1]:
+    if name == 'glGetPointerv':
+        cmds[name] = (ret, params, pfn)
+feature_cmds['GL_VERSION_4_3'].append('glGetPointerv')
+
+v45 = feature_cmds['GL_VERSION_4_5']
+dsa = v45[v45.index('glCreateTransformFeedbacks'):v45.index('glGetQueryBufferObjectuiv') + 1]
+feature_cmds['GL_ARB_buffer_storage'] = ['glBufferStorage']
+feature_cmds['GL_ARB_direct_state_access'] = dsa
+feature_cmds['GL_ARB_multi_draw_indirect'] = ['glMultiDrawArraysIndirect', 'glMultiDrawElementsIndirect']
+feature_cmds['GL_KHR_debug'] = ['glDebugMessageControl', 'glDebugMessageInsert', 'glDebugMessageCallback',
+                                'glGetDebugMessageLog', 'glPushDebugGroup', 'glPopDebugGroup', 'glObjectLabel',
+                                'glGetObjectLabel', 'glObjectPtrLabel', 'glGetObjectPtrLabel', 'glGetPointerv']
+
+def ret_text(ret):
+    return ret if not ret.endswith('*') else ret[:-1].rstrip() + ' *'
+
+# ---------------------------------------------------------------- glad.h
+# The generated-file comment both files start with.
+def header(text):
+    text = text.replace('    APIs: gl=3.3\n', '    APIs: gl=4.5\n')
+    text = text.replace('    Extensions:\n        \n',
+                        '    Extensions:\n' + ''.join('        %s,\n' % e for e in EXTS[:-1]) + '        %s\n' % EXTS[-1])
+    text = text.replace('--api="gl=3.3" --generator="c" --spec="gl" --extensions=""',
+                        '--api="gl=4.5" --generator="c" --spec="gl" --extensions="%s"' % ','.join(EXTS))
+    return text.replace('&api=gl%3D3.3', '&api=gl%3D4.5' + ''.join('&extensions=%s' % e for e in EXTS))
+
+h = header(open(HDR).read())
+
+existing = set(re.findall(r'^#define (GL_\w+) ', h, re.M))
+enums = []
+for v in VERSIONS:
+    for name, value in arb[v][0]:
+        if name not in existing and not name.startswith('GL_VERSION_'):
+            existing.add(name)
+            enums.append('#define %s %s\n' % (name, value))
+i = h.index('#ifndef GL_VERSION_1_0\n')
+h = h[:i] + ''.join(enums) + h[i:]
+
+written = set(re.findall(r'^GLAPI PFN\w+ glad_(gl\w+);', h, re.M))
+blocks = []
+for feature in VERSIONS + EXTS:
+    b = '#ifndef %s\n#define %s 1\nGLAPI int GLAD_%s;\n' % (feature, feature, feature)
+    for name in feature_cmds[feature]:
+        if name in written:
+            continue
+        written.add(name)
+        ret, params, pfn = cmds[name]
+        b += 'typedef %s (APIENTRYP %s)(%s);\n' % (ret_text(ret), pfn, params)
+        b += 'GLAPI %s glad_%s;\n' % (pfn, name)
+        b += '#define %s glad_%s\n' % (name, name)
+    b += '#endif\n'
+    blocks.append(b)
+anchor = '#define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv\n#endif\n'
+assert h.count(anchor) == 1
+h = h.replace(anchor, anchor + ''.join(blocks))
+open(HDR, 'w').write(h)
+
+# ---------------------------------------------------------------- glad.c
+c = header(open(SRC).read())
+anchor = 'int GLAD_GL_VERSION_3_3 = 0;\n'
+c = c.replace(anchor, anchor + ''.join('int GLAD_%s = 0;\n' % f for f in VERSIONS + EXTS))
+
+# Pointer definitions, sorted by name as glad writes them.
+defs = re.findall(r'^(PFN\w+) glad_(gl\w+) = NULL;\n', c, re.M)
+start = c.index('PFN', c.index('int GLAD_GL_KHR_debug = 0;\n'))
+end = c.index('\n', c.rindex(' = NULL;\n', 0, c.index('static void load_GL_VERSION_1_0'))) + 1
+pointers = dict((n, p) for p, n in defs)
+for name, (ret, params, pfn) in cmds.items():
+    pointers[name] = pfn
+c = c[:start] + ''.join('%s glad_%s = NULL;\n' % (pointers[n], n) for n in sorted(pointers)) + c[end:]
+
+loaders = []
+for feature in VERSIONS + EXTS:
+    l = 'static void load_%s(GLADloadproc load) {\n\tif(!GLAD_%s) return;\n' % (feature, feature)
+    for name in feature_cmds[feature]:
+        l += '\tglad_%s = (%s)load("%s");\n' % (name, cmds[name][2], name)
+    l += '}\n'
+    loaders.append(l)
+anchor = '\tglad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");\n}\n'
+assert c.count(anchor) == 1
+c = c.replace(anchor, anchor + ''.join(loaders))
+
+anchor = '\tif (!get_exts(&exts_gl, max_loaded_major, glGetString, glGetIntegerv, glGetStringi)) return 0;\n'
+c = c.replace(anchor, anchor + ''.join('\tGLAD_%s = has_ext(&exts_gl, "%s");\n' % (e, e) for e in EXTS))
+
+anchor = '\tGLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;\n'
+lines = ''
+for v in VERSIONS:
+    ma, mi = v.split('_')[2:4]
+    lines += '\tGLAD_%s = (major == %s && minor >= %s) || major > %s;\n' % (v, ma, mi, ma)
+c = c.replace(anchor, anchor + lines)
+c = c.replace('''	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
+		max_loaded_major = 3;
+		max_loaded_minor = 3;
+	}''', '''	if (GLVersion.major > 4 || (GLVersion.major >= 4 && GLVersion.minor >= 5)) {
+		max_loaded_major = 4;
+		max_loaded_minor = 5;
+	}''')
+
+anchor = '\tload_GL_VERSION_3_3(load);\n\n\tif (!find_extensionsGL()) return 0;\n'
+assert c.count(anchor) == 1
+c = c.replace(anchor, '\tload_GL_VERSION_3_3(load);\n' + ''.join('\tload_%s(load);\n' % v for v in VERSIONS) +
+              '\n\tif (!find_extensionsGL()) return 0;\n' + ''.join('\tload_%s(load);\n' % e for e in EXTS))
+open(SRC, 'w').write(c)
@@ -0,0 +1,242 @@
+"""src/gl_capture_shims.inc (capture) or src/replay_decoders.inc (replay)."""
+import glparse, re, sys
+feats, funcs = glparse.parse()
+
+# Capture shims written by hand in gl_capture.cpp.
+HAND_CAPTURE = set('''
+glBindBuffer glPixelStorei glPixelStoref glMapBuffer glMapBufferRange glUnmapBuffer glFlushMappedBufferRange
+glShaderSource glTransformFeedbackVaryings glCreateShaderProgramv
+glMapNamedBuffer glMapNamedBufferRange glUnmapNamedBuffer glFlushMappedNamedBufferRange
+'''.split())
+
+# Decoders written by hand in replay.cpp.
+HAND_REPLAY = set('''
+glBindBuffer glPixelStorei glMapBuffer glMapBufferRange glUnmapBuffer glFlushMappedBufferRange
+glShaderSource glTransformFeedbackVaryings glReadPixels glUseProgram
+glCreateShader glCreateProgram glFenceSync glGetUniformLocation glGetUniformBlockIndex
+glCreateShaderProgramv glMapNamedBuffer glMapNamedBufferRange glUnmapNamedBuffer glFlushMappedNamedBufferRange
+glReadnPixels glCopyImageSubData
+'''.split())
+
+# Calls that only make sense in the capturing process: callbacks into it and
+# labels on its object names.
+REPLAY_DROPS = set('glDebugMessageCallback glObjectLabel glObjectPtrLabel'.split())
+
+# Queries whose answers replay does not need.
+def replay_skips(f):
+    if f.name in HAND_REPLAY:
+        return False
+    if f.name in ('glGetAttribLocation', 'glGetFragDataLocation', 'glGetFragDataIndex'):
+        return False
+    if f.name in REPLAY_DROPS:
+        return True
+    return bool(re.match(r'^gl(Get|Is)', f.name)) or f.name == 'glCheckFramebufferStatus'
+
+NAME_KINDS = {
+    'buffer': 'buffers', 'texture': 'textures', 'framebuffer': 'framebuffers',
+    'renderbuffer': 'renderbuffers', 'sampler': 'samplers', 'program': 'programs',
+    'shader': 'programs', 'array': 'vertexArrays', 'vaobj': 'vertexArrays',
+    'xfb': 'transformFeedbacks', 'pipeline': 'pipelines', 'origtexture': 'textures',
+    'readBuffer': 'buffers', 'writeBuffer': 'buffers',
+    'readFramebuffer': 'framebuffers', 'drawFramebuffer': 'framebuffers',
+}
+ARRAY_KINDS = {
+    'buffers': 'buffers', 'textures': 'textures', 'samplers': 'samplers', 'shaders': 'programs',
+}
+# Gen, Create and Delete functions by the kind of name they handle.
+OBJECT_KINDS = {
+    'Buffers': 'buffers', 'Textures': 'textures', 'Framebuffers': 'framebuffers',
+    'Renderbuffers': 'renderbuffers', 'Samplers': 'samplers', 'VertexArrays': 'vertexArrays',
+    'Queries': 'queries', 'TransformFeedbacks': 'transformFeedbacks', 'ProgramPipelines': 'pipelines',
+}
+
+def object_kind(f):
+    m = re.match(r'^gl(Gen|Create|Delete)(\w+)$', f.name)
+    return (m.group(1), OBJECT_KINDS[m.group(2)]) if m and m.group(2) in OBJECT_KINDS else (None, None)
+
+def count_param(f):
+    return [n for t, n in f.param_list() if t == 'GLsizei'][0]
+
+def name_kind(f, t, n):
+    if t != 'GLuint':
+        return None
+    if n == 'id':
+        if 'TransformFeedback' in f.name:
+            return 'transformFeedbacks'
+        return 'queries' if 'Query' in f.name or 'ConditionalRender' in f.name else None
+    return NAME_KINDS.get(n)
+
+def base_type(t):
+    return t.replace('const', '').replace('*', '').strip()
+
+def vector_size(f, t, n):
+    """Bytes behind pointer parameter n, or None when it is not read."""
+    elem = 'sizeof(%s)' % base_type(t)
+    name = f.name
+    m = re.match(r'^gl(?:Program)?Uniform([1-4])(f|i|ui|d)v$', name)
+    if m:
+        return 'count * %s * %s' % (m.group(1), elem)
+    m = re.match(r'^gl(?:Program)?UniformMatrix([2-4])(?:x([2-4]))?(f|d)v$', name)
+    if m:
+        cols, rows = m.group(1), m.group(2) or m.group(1)
+        return 'count * %s * %s * %s' % (cols, rows, elem)
+    m = re.match(r'^glVertexAttrib[IL]?([1-4])N?(d|f|s|i|b|ub|us|ui)v$', name)
+    if m:
+        return '%s * %s' % (m.group(1), elem)
+    if re.match(r'^gl\w+P[1-4]uiv$', name):
+        return elem
+    if re.match(r'^gl(Tex|Texture|Sampler)Parameter(f|i|Ii|Iui)v$', name):
+        return 'parameterCount(pname) * %s' % elem
+    if re.match(r'^glPointParameter(f|i)v$', name):
+        return elem
+    if re.match(r'^glClear(NamedFramebuffer|Buffer)(f|i|ui)v$', name):
+        return '(buffer == GL_COLOR ? 4 : 1) * %s' % elem
+    if re.match(r'^gl(Named)?Buffer(Sub)?(Data|Storage)$', name):
+        return '(data != nullptr ? (size_t)size : 0)'
+    if re.match(r'^glClear(Named)?Buffer(Sub)?Data$', name) or re.match(r'^glClearTex(Sub)?Image$', name):
+        return 'clearBytes(data, format, type)'
+    if n == 'indirect':
+        return None
+    if name in ('glViewportArrayv', 'glScissorArrayv'):
+        return 'count * 4 * %s' % elem
+    if name == 'glDepthRangeArrayv':
+        return 'count * 2 * %s' % elem
+    if name in ('glViewportIndexedfv', 'glScissorIndexedv'):
+        return '4 * %s' % elem
+    if name == 'glPatchParameterfv':
+        return '(pname == GL_PATCH_DEFAULT_OUTER_LEVEL ? 4 : 2) * %s' % elem
+    if name in ('glProgramBinary', 'glShaderBinary') and n == 'binary':
+        return '(size_t)length'
+    if n in ('label', 'buf', 'message') and t == 'const GLchar *':
+        return 'stringBytes(%s, length)' % n
+    if n == 'attachments':
+        return 'numAttachments * %s' % elem
+    if 'count' in [p for _, p in f.param_list()] and (name in ('glShaderBinary', 'glUniformSubroutinesuiv') or
+            re.match(r'^gl(Bind\w+s(Base|Range)?|VertexArrayVertexBuffers|DebugMessageControl)$', name)):
+        return '(%s != nullptr ? count * %s : 0)' % (n, elem)
+    m = re.match(r'^gl(Compressed)?Tex(?:ture)?(Sub)?Image([1-3])D$', name)
+    if m:
+        if m.group(1):
+            return 'unpackBytes(data, imageSize)'
+        dims = {'1': 'width, 1, 1', '2': 'width, height, 1', '3': 'width, height, depth'}[m.group(3)]
+        return 'unpackBytes(pixels, %s, format, type)' % dims
+    if re.match(r'^gl(NamedFramebuffer)?DrawBuffers$', name) or object_kind(f)[0]:
+        return '%s * %s' % (count_param(f), elem)
+    if re.match(r'^glMultiDraw', name) and n != 'indices':
+        return 'drawcount * %s' % elem
+    if name.startswith('glMultiDrawElements') and n == 'indices':
+        return 'drawcount * sizeof(const void*)'
+    if base_type(t) == 'GLchar' and t.startswith('const') and t.count('*') == 1:
+        return 'strlen(%s) + 1' % n
+    return None
+
+def capture(out):
+    out += ['// Generated from the entry points in include/glad/glad.h, one capture shim',
+            '// per function. Each calls the real entry point first, so outputs and the',
+            '// result are known, then appends the record. Included by gl_capture.cpp',
+            '// before the hand written shims.', '']
+    out.append('enum Opcode : uint16_t {')
+    for i, f in enumerate(funcs):
+        if f.name in HAND_CAPTURE:
+            out.append('    opcode_%s = %d,' % (f.name, i))
+    out.append('};')
+    out.append('')
+    for f in funcs:
+        if f.name in HAND_CAPTURE:
+            out.append('%s APIENTRY capture_%s(%s);' % (f.ret, f.name, f.proto_params()))
+    out.append('')
+    for i, f in enumerate(funcs):
+        if f.name in HAND_CAPTURE:
+            continue
+        out.append('static %s APIENTRY capture_%s(%s) {' % (f.ret, f.name, f.proto_params()))
+        call = 'capture.real.%s(%s);' % (f.short, f.arg_names())
+        out.append('    ' + (call if f.ret == 'void' else '%s result = %s' % (f.ret, call)))
+        out.append('    Record record(%d);' % i)
+        for t, n in f.param_list():
+            if '*' in t:
+                size = vector_size(f, t, n)
+                out.append('    record.pointer(%s, %s);' % (n, size or '0'))
+            else:
+                out.append('    record.arg(%s);' % n)
+        if f.ret != 'void':
+            out.append('    record.arg(result);')
+            out.append('    return result;')
+        out.append('}')
+        out.append('')
+    out.append('const CaptureEntryPoint entryPoints[] = {')
+    for f in funcs:
+        out.append('    {(void**)&glad_%s, offsetof(GladGLContext, %s), (void*)capture_%s},'
+                   % (f.name, f.short, f.name))
+    out.append('};')
+    out.append('')
+    out.append('const char *const opcodeNames[] = {')
+    for f in funcs:
+        out.append('    "%s",' % f.name)
+    out.append('};')
+
+def decode_param(f, t, n):
+    bt = base_type(t)
+    if '*' in t:
+        verb, kind = object_kind(f)
+        if verb == 'Delete':
+            return '%s %s = replay.%s.map(%s, (const GLuint*)call.pointer());' % (t, n, kind, count_param(f))
+        if n in ARRAY_KINDS and t == 'const GLuint *' and not verb:
+            return '%s %s = replay.%s.map(count, (const GLuint*)call.pointer());' % (t, n, ARRAY_KINDS[n])
+        return '%s %s = (%s)call.pointer();' % (t, n, t)
+    if t == 'GLsync':
+        return 'GLsync %s = replay.syncs.get(call.arg<GLsync>());' % n
+    if name_kind(f, t, n):
+        return 'GLuint %s = replay.%s.get(call.arg<GLuint>());' % (n, name_kind(f, t, n))
+    if t == 'GLint' and n == 'location' and f.name.startswith('glUniform'):
+        return 'GLint location = replay.uniformLocation(call.arg<GLint>());'
+    if t == 'GLint' and n == 'location' and f.name.startswith('glProgramUniform'):
+        return 'GLint location = replay.uniformLocation(program, call.arg<GLint>());'
+    if n == 'uniformBlockIndex' and f.name == 'glUniformBlockBinding':
+        return 'GLuint uniformBlockIndex = replay.uniformBlock(program, call.arg<GLuint>());'
+    return '%s %s = call.arg<%s>();' % (t, n, t)
+
+def replay(out):
+    out += ['// Generated from the entry points in include/glad/glad.h, one decoder per',
+            '// function. Object names, syncs and uniform locations recorded at capture',
+            '// time are translated to the ones the replaying context handed out.',
+            '// Included by replay.cpp after the hand written decoders.', '']
+    out.append('void decode(unsigned int opcode, Call &call) {')
+    out.append('    switch (opcode) {')
+    for i, f in enumerate(funcs):
+        out.append('    case %d: {' % i)
+        if f.name in HAND_REPLAY:
+            out.append('        replay_%s(call);' % f.name)
+        elif replay_skips(f):
+            out.append('        replay.skipped++;')
+        elif object_kind(f)[0] in ('Gen', 'Create'):
+            kind = object_kind(f)[1]
+            params = f.param_list()
+            names = params[-1][1]
+            count = count_param(f)
+            for t, n in params[:-1]:
+                out.append('        %s %s = call.arg<%s>();' % (t, n, t))
+            out.append('        const GLuint *captured = (const GLuint*)call.pointer();')
+            out.append('        GLuint *%s = replay.%s.scratch(%s);' % (names, kind, count))
+            out.append('        glad_%s(%s);' % (f.name, f.arg_names()))
+            out.append('        replay.%s.bind(%s, captured, %s);' % (kind, count, names))
+        else:
+            for t, n in f.param_list():
+                out.append('        ' + decode_param(f, t, n))
+            c = 'glad_%s(%s);' % (f.name, f.arg_names())
+            out.append('        ' + (c if f.ret == 'void' else '(void)' + c))
+        out.append('        break;')
+        out.append('    }')
+    out.append('    default:')
+    out.append('        replay.skipped++;')
+    out.append('        break;')
+    out.append('    }')
+    out.append('}')
+    out.append('')
+    out.append('const ReplayEntryPoint entryPoints[] = {')
+    for i, f in sorted(enumerate(funcs), key=lambda e: e[1].name):
+        out.append('    {"%s", %d, (void**)&glad_%s},' % (f.name, i, f.name))
+    out.append('};')
+
+out = []
+(capture if sys.argv[1] == 'capture' else replay)(out)
+print('\n'.join(out))
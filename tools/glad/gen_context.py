@@ -0,0 +1,38 @@
+"""GladGLContext pieces: header struct, loaders, versions, load calls, TLS macros."""
+import glparse, sys
+feats, funcs = glparse.parse()
+loads = glparse.parse_loads()
+byname = {f.name: f for f in funcs}
+which = sys.argv[1]
+out = []
+if which == 'header':
+    out.append('typedef struct GladGLContext {')
+    out.append('    struct gladGLversionStruct version;')
+    for ft in feats:
+        out.append('    int %s;' % ft[3:])
+    out.append('    struct gladGLExtensions extensions;')
+    out.append('    struct gladGLCapabilities capabilities;')
+    for f in funcs:
+        out.append('    %s %s;' % (f.pfn, f.short))
+    out.append('} GladGLContext;')
+elif which == 'loaders':
+    for ft in feats:
+        out.append('static void load_%s_context(GladGLContext *context, GLADloadproc load) {' % ft)
+        out.append('\tif(!context->%s) return;' % ft[3:])
+        for n in loads[ft]:
+            out.append('\tcontext->%s = (%s)load("%s");' % (n[2:], byname[n].pfn, n))
+        out.append('}')
+elif which == 'versions':
+    for ft in feats:
+        ma, mi = ft.split('_')[2:4]
+        out.append('\tcontext->%s = (major == %s && minor >= %s) || major > %s;' % (ft[3:], ma, mi, ma))
+elif which == 'calls':
+    for ft in feats:
+        out.append('\tload_%s_context(context, load);' % ft)
+print('\n'.join(out))
+if which == 'tls':
+    out = []
+    for f in funcs:
+        out.append('#undef %s' % f.name)
+        out.append('#define %s (glad_gl_current_context->%s)' % (f.name, f.short))
+    print('\n'.join(out))
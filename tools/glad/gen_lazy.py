@@ -0,0 +1,27 @@
+"""The lazy trampolines and lazy_<feature> installers."""
+import glparse
+feats, funcs = glparse.parse()
+byname = {f.name: f for f in funcs}
+loads = glparse.parse_loads()
+out = []
+out.append('static GLADloadproc glad_lazy_load = NULL;\n')
+for f in funcs:
+    args = f.arg_names()
+    out.append('static %s APIENTRY glad_lazy_%s(%s) {' % (f.ret, f.name, f.proto_params()))
+    out.append('\t%s proc = (%s)glad_lazy_load("%s");' % (f.pfn, f.pfn, f.name))
+    if f.ret == 'void':
+        out.append('\tif(proc == NULL) return;')
+        out.append('\tglad_%s = proc;' % f.name)
+        out.append('\tproc(%s);' % args)
+    else:
+        out.append('\tif(proc == NULL) return 0;')
+        out.append('\tglad_%s = proc;' % f.name)
+        out.append('\treturn proc(%s);' % args)
+    out.append('}')
+for feat in feats:
+    out.append('static void lazy_%s(void) {' % feat)
+    out.append('\tif(!GLAD_%s) return;' % feat)
+    for n in loads[feat]:
+        out.append('\tglad_%s = glad_lazy_%s;' % (n, n))
+    out.append('}')
+print('\n'.join(out))
@@ -0,0 +1,60 @@
+"""src/mock_gl_entry_points.inc: a recorder per entry point."""
+import glparse, re
+feats, funcs = glparse.parse()
+
+HOOKED = set('''
+glGenBuffers glDeleteBuffers glGenTextures glDeleteTextures glGenVertexArrays glDeleteVertexArrays
+glGenFramebuffers glDeleteFramebuffers glGenRenderbuffers glDeleteRenderbuffers glGenSamplers glDeleteSamplers
+glGenQueries glDeleteQueries glCreateShader glDeleteShader glCreateProgram glDeleteProgram
+glIsBuffer glIsTexture glIsVertexArray glIsFramebuffer glIsRenderbuffer glIsSampler glIsQuery glIsShader glIsProgram
+glBindBuffer glBindVertexArray glBufferData glBufferSubData glMapBuffer glMapBufferRange glUnmapBuffer glGetBufferParameteriv
+glGetString glGetStringi glGetIntegerv glGetShaderiv glGetProgramiv glGetShaderInfoLog glGetProgramInfoLog
+glCheckFramebufferStatus glGetUniformLocation glGetAttribLocation glGetUniformBlockIndex glGetFragDataLocation
+glFenceSync glClientWaitSync glIsSync glDeleteSync
+glDrawArrays glDrawArraysInstanced glDrawElements glDrawElementsInstanced glDrawRangeElements
+glDrawElementsBaseVertex glDrawRangeElementsBaseVertex glDrawElementsInstancedBaseVertex
+glMultiDrawArrays glMultiDrawElements glMultiDrawElementsBaseVertex
+'''.split())
+
+STATE = re.compile(r'^gl(Bind|Enable|Disable|Blend|Depth|Stencil|Viewport|Scissor|CullFace|FrontFace|PolygonMode|'
+                   r'PolygonOffset|UseProgram|ActiveTexture|ColorMask|ClearColor|ClearDepth|ClearStencil|LineWidth|'
+                   r'PointSize|PointParameter|SampleCoverage|SampleMaski|Hint|LogicOp|PixelStore|ProvokingVertex|'
+                   r'PrimitiveRestartIndex|ClampColor|DrawBuffer|ReadBuffer|VertexAttrib|Uniform|TexParameter|'
+                   r'SamplerParameter)')
+
+def is_state(f):
+    return bool(STATE.match(f.name))
+
+def put(ptype, pname):
+    if '*' in ptype or ptype == 'GLsync':
+        if pname in ('pointer', 'indices') or ptype == 'GLsync':
+            return 'record.putOffset(%s);' % pname
+        return 'record.putPresence(%s);' % pname
+    return 'record.put(%s);' % pname
+
+out = ['// Generated from the entry points in include/glad/glad.h, one recorder per',
+       '// function. Included by mock_gl.cpp after the hooks it calls.', '']
+for i, f in enumerate(funcs):
+    out.append('static %s APIENTRY mock_%s(%s) {' % (f.ret, f.name, f.proto_params()))
+    out.append('    Recorder record(%d);' % i)
+    for t, n in f.param_list():
+        out.append('    ' + put(t, n))
+    if is_state(f):
+        out.append('    mock.stats.stateChanges++;')
+    if f.name in HOOKED:
+        call = 'hook_%s(%s);' % (f.name, f.arg_names())
+        out.append('    ' + ('return ' if f.ret != 'void' else '') + call)
+    elif f.ret != 'void':
+        out.append('    return 0;')
+    out.append('}')
+    out.append('')
+out.append('const MockEntryPoint entryPoints[] = {')
+for f in sorted(funcs, key=lambda f: f.name):
+    out.append('    {"%s", (void*)mock_%s},' % (f.name, f.name))
+out.append('};')
+out.append('')
+out.append('const char *const opcodeNames[] = {')
+for f in funcs:
+    out.append('    "%s",' % f.name)
+out.append('};')
+print('\n'.join(out))
@@ -0,0 +1,9 @@
+"""The sorted proc_names table of the resident loader."""
+import glparse
+feats, funcs = glparse.parse()
+names = sorted(set(f.name for f in funcs))
+out = ['static const char *proc_names[] = {']
+out += ['    "%s",' % n for n in names]
+out[-1] = out[-1].rstrip(',')
+out.append('};')
+print('\n'.join(out))
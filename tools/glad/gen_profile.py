@@ -0,0 +1,35 @@
+"""The GLAD_PROFILE name table, shims and profile_install."""
+import glparse
+feats, funcs = glparse.parse()
+out = []
+out.append('static const char *profile_names[] = {')
+out += ['    "%s",' % f.name for f in funcs]
+out[-1] = out[-1].rstrip(',')
+out.append('};')
+out.append('')
+out.append('#define NUM_PROFILED (sizeof(profile_names) / sizeof(profile_names[0]))')
+out.append('')
+out.append('/* The real entry points, called by the shims below. */')
+out.append('static GladGLContext profile_real;')
+out.append('')
+for i, f in enumerate(funcs):
+    out.append('static %s APIENTRY glad_profile_%s(%s) {' % (f.ret, f.name, f.proto_params()))
+    if f.ret == 'void':
+        out.append('\tunsigned long long called_at = now_ns();')
+        out.append('\tprofile_real.%s(%s);' % (f.short, f.arg_names()))
+        out.append('\tprofile_record(%d, called_at);' % i)
+    else:
+        out.append('\t%s result;' % f.ret)
+        out.append('\tunsigned long long called_at = now_ns();')
+        out.append('\tresult = profile_real.%s(%s);' % (f.short, f.arg_names()))
+        out.append('\tprofile_record(%d, called_at);' % i)
+        out.append('\treturn result;')
+    out.append('}')
+out.append('static void profile_install(void) {')
+for f in funcs:
+    out.append('\tif(glad_%s != NULL && glad_%s != glad_profile_%s) {' % (f.name, f.name, f.name))
+    out.append('\t\tprofile_real.%s = glad_%s;' % (f.short, f.name))
+    out.append('\t\tglad_%s = glad_profile_%s;' % (f.name, f.name))
+    out.append('\t}')
+out.append('}')
+print('\n'.join(out))
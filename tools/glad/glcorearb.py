@@ -0,0 +1,35 @@
+"""Reads enums and commands per feature from Khronos' glcorearb.h ($GLCOREARB,
+or the system's)."""
+import os, re
+ARB = os.environ.get('GLCOREARB', '/usr/include/GL/glcorearb.h')
+
+def blocks(path=ARB):
+    """feature -> (enums [(name, value)], commands [(ret, name, params, pfn)])"""
+    out, cur = {}, None
+    for line in open(path):
+        line = line.rstrip('\n')
+        m = re.match(r'#ifndef (GL_\w+)$', line)
+        if m and cur is None:
+            cur = m.group(1); out[cur] = ([], []); continue
+        if cur is None: continue
+        if line == '#endif /* %s */' % cur:
+            cur = None; continue
+        m = re.match(r'#define (GL_\w+)\s+(\S+)$', line)
+        if m:
+            out[cur][0].append((m.group(1), m.group(2))); continue
+        m = re.match(r'typedef (.+?) ?\(APIENTRYP (PFN\w+PROC)\) \((.*)\);$', line)
+        if m:
+            ret, pfn, params = m.groups()
+            out[cur][1].append([ret, None, params, pfn]); continue
+        m = re.match(r'GLAPI .+?APIENTRY (gl\w+) \(', line)
+        if m:
+            for c in out[cur][1]:
+                if c[3] == 'PFN%sPROC' % m.group(1).upper() and c[1] is None:
+                    c[1] = m.group(1)
+    return out
+
+if __name__ == '__main__':
+    b = blocks()
+    for f in ['GL_VERSION_4_0','GL_VERSION_4_1','GL_VERSION_4_2','GL_VERSION_4_3','GL_VERSION_4_4','GL_VERSION_4_5']:
+        e, c = b[f]
+        print(f, len(e), len(c), [x for x in c if x[1] is None])
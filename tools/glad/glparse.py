@@ -0,0 +1,56 @@
+"""Reads the entry points and per-feature load lists back out of glad.h and
+glad.c, for the generators next to it."""
+import os, re
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+HDR = os.path.join(ROOT, 'include', 'glad', 'glad.h')
+SRC = os.path.join(ROOT, 'src', 'glad.c')
+
+class Func:
+    def __init__(s, feature, name, ret, params, pfn):
+        s.feature, s.name, s.ret, s.params, s.pfn = feature, name, ret, params, pfn
+    @property
+    def short(s): return s.name[2:]
+    def param_list(s):
+        p = s.params.strip()
+        if p in ('', 'void'): return []
+        out = []
+        for part in p.split(','):
+            part = part.strip()
+            m = re.match(r'(.*?)([A-Za-z_]\w*)$', part)
+            out.append((m.group(1).strip(), m.group(2)))
+        return out
+    def arg_names(s): return ', '.join(n for _, n in s.param_list())
+    def proto_params(s): return s.params if s.params.strip() else 'void'
+
+def parse(path=HDR):
+    feats, funcs = [], []
+    cur = None
+    for line in open(path):
+        m = re.match(r'#ifndef (GL_(?:VERSION|ARB|KHR|EXT)_\w+)$', line.strip())
+        if m: cur = m.group(1); feats.append(cur); continue
+        m = re.match(r'typedef (.+?) \(APIENTRYP (PFN\w+PROC)\)\((.*)\);', line.strip())
+        if m and cur:
+            ret, pfn, params = m.groups()
+            funcs.append([cur, None, ret, params, pfn]); continue
+        m = re.match(r'GLAPI (PFN\w+PROC) glad_(gl\w+);', line.strip())
+        if m and funcs and funcs[-1][1] is None and funcs[-1][4] == m.group(1):
+            funcs[-1][1] = m.group(2)
+    return feats, [Func(*f) for f in funcs]
+
+if __name__ == '__main__':
+    feats, funcs = parse()
+    print(feats, len(funcs))
+    print(len(set(f.name for f in funcs)))
+
+def parse_loads(path=SRC):
+    """Per-feature load lists as they appear in glad.c (may repeat names)."""
+    loads, cur = {}, None
+    for line in open(path):
+        m = re.match(r'static void load_(GL_\w+)\(GLADloadproc load\) \{', line)
+        if m: cur = m.group(1); loads[cur] = []; continue
+        if cur:
+            m = re.match(r'\tglad_(gl\w+) = \(PFN\w+\)load\("gl\w+"\);', line)
+            if m: loads[cur].append(m.group(1)); continue
+            if line.startswith('}'): cur = None
+    return loads
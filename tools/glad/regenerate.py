@@ -0,0 +1,66 @@
+"""Regenerates everything derived from the entry points in glad.h: the
+resident name table, lazy trampolines, per-context loaders, profile shims and
+thread-local macros in glad.c/glad.h, and the capture, replay and mock .inc
+files. Run after adding entry points; on an unchanged tree it changes
+nothing."""
+import os, re, subprocess, sys
+from glparse import HDR, ROOT, SRC
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+def run(*args):
+    return subprocess.check_output([sys.executable] + list(args), cwd=HERE).decode()
+
+def splice(text, start, end, new, include_end=False):
+    i = text.index(start)
+    j = text.index(end, i)
+    if include_end:
+        j += len(end)
+    return text[:i] + new + text[j:]
+
+c = open(SRC).read()
+h = open(HDR).read()
+
+# proc_names
+names = run('gen_names.py')
+c = splice(c, 'static const char *proc_names[] = {', '};\n', names, include_end=True)
+
+# lazy region, without the glGetString trampoline
+lazy = run('gen_lazy.py')
+lazy = re.sub(r'static const GLubyte \* APIENTRY glad_lazy_glGetString\(GLenum name\) \{\n.*?\n\}\n', '', lazy, flags=re.S)
+lazy = lazy.replace('\tglad_glGetString = glad_lazy_glGetString;\n', '')
+c = splice(c, 'static GLADloadproc glad_lazy_load = NULL;\n', 'static void load_GL_VERSION_1_0_context', lazy + '#endif\n')
+
+# context loaders
+loaders = run('gen_context.py', 'loaders')
+c = splice(c, 'static void load_GL_VERSION_1_0_context', '#ifdef GLAD_PROFILE\n/* Profiling', loaders)
+
+# profile
+prof = run('gen_profile.py')
+# gen_profile.py does not write the per-thread tables, keep glad.c's.
+tables = c[c.index('struct profile_entry {'):c.index('/* The real entry points')]
+head = prof[:prof.index('static void profile_install(void) {')]
+if 'struct profile_entry {' not in head:
+    mark = '#define NUM_PROFILED (sizeof(profile_names) / sizeof(profile_names[0]))\n\n'
+    head = head.replace(mark, mark + tables)
+c = splice(c, 'static const char *profile_names[] = {', 'static void profile_install(void) {', head)
+i = c.index('static void profile_install(void) {')
+j = c.index('\n}\n', i) + 3
+c = c[:i] + prof[prof.index('static void profile_install(void) {'):] + c[j:]
+
+open(SRC, 'w').write(c)
+
+# context struct and TLS macros
+hdr = run('gen_context.py', 'header')
+h = splice(h, 'typedef struct GladGLContext {', '} GladGLContext;\n', hdr, include_end=True)
+tls = run('gen_context.py', 'tls').lstrip('\n')
+i = h.index('#ifdef GLAD_THREAD_LOCAL_DISPATCH\n#undef glCullFace') + len('#ifdef GLAD_THREAD_LOCAL_DISPATCH\n')
+j = h.index('#endif', i)
+h = h[:i] + tls + h[j:]
+open(HDR, 'w').write(h)
+
+# the capture, replay and mock backends
+for out, args in (('gl_capture_shims.inc', ('gen_capture.py', 'capture')),
+                  ('replay_decoders.inc', ('gen_capture.py', 'replay')),
+                  ('mock_gl_entry_points.inc', ('gen_mock.py',))):
+    open(os.path.join(ROOT, 'src', out), 'w').write(run(*args))